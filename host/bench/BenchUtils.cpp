@@ -0,0 +1,52 @@
+/*
+  BenchUtils.cpp - Heap accounting for the host benchmarks
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+*/
+
+#include "BenchUtils.h"
+
+#include <new>
+
+namespace BenchUtils {
+    size_t allocations = 0;
+    size_t allocatedBytes = 0;
+}
+
+void* operator new(size_t size)
+{
+    BenchUtils::allocations++;
+    BenchUtils::allocatedBytes += size;
+    void* p = malloc(size ? size : 1);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    free(p);
+}
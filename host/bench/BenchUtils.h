@@ -0,0 +1,57 @@
+/*
+  BenchUtils.h - Timing and heap accounting for the host benchmarks
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+*/
+
+#ifndef BENCH_UTILS_H
+#define BENCH_UTILS_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+namespace BenchUtils {
+    // Counted by the replacement operator new in BenchUtils.cpp
+    extern size_t allocations;
+    extern size_t allocatedBytes;
+
+    // Iteration count from the command line, ctest passes a small one to keep the gate fast
+    inline int Iterations(int argc, char** argv, int defaultCount)
+    {
+        return argc > 1 ? atoi(argv[1]) : defaultCount;
+    }
+
+    // Runs fn() count times and prints time, heap allocations and heap bytes per call
+    template <typename Fn>
+    void Measure(const char* pName, int count, Fn fn)
+    {
+        size_t startAllocations = allocations;
+        size_t startBytes = allocatedBytes;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; i++)
+        {
+            fn();
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        printf("%-40s %9.1f ns %7.1f allocs %8.0f B heap\n", pName,
+            std::chrono::duration<double, std::nano>(end - start).count() / count,
+            (double)(allocations - startAllocations) / count,
+            (double)(allocatedBytes - startBytes) / count);
+    }
+
+    // Benchmarks double as smoke tests, a failed check makes ctest report the run
+    inline void Check(bool condition, const char* pWhat)
+    {
+        if (!condition)
+        {
+            fprintf(stderr, "check failed: %s\n", pWhat);
+            exit(1);
+        }
+    }
+}
+
+#endif // BENCH_UTILS_H
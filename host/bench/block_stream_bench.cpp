@@ -0,0 +1,188 @@
+/*
+  block_stream_bench.cpp - Filler callbacks of a static response of k items sent in m chunks
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+
+  Compares the response filler of ESPAsync_WiFiManagerUtils::responseText(), which resumes
+  at a cursor, with the former SendMemoryBlock that walked the items from the first one on
+  every callback. The items are in RAM, so the copies are memcpy bound on the host.
+*/
+
+#include <ESPAsync_WiFiManagerUtils.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchUtils.h"
+
+namespace {
+    // The former SendMemoryBlock, the position is searched from the first item on every call
+    size_t LinearSendMemoryBlock(const HTTPMemoryBlock2 *pBlock, uint8_t *pBuffer, size_t bufLen, size_t index)
+    {
+        uint8_t *pBufferWithOffset = pBuffer;
+        size_t remainingBufLen = (bufLen & 0xFFFC); // Align buffer length to 4
+        size_t currentIndex = index;
+        size_t blockStart = 0;
+        size_t sizeOfCopiedMem = 0;
+
+        for (size_t iBlock = 0; iBlock < pBlock->count && remainingBufLen > 0; iBlock++)
+        {
+            size_t itemSize = pBlock->pItems[iBlock].size;
+            size_t blockEnd = blockStart + itemSize;
+
+            while (blockStart <= currentIndex && blockEnd > currentIndex && remainingBufLen > 0)
+            {
+                size_t blockOffset = currentIndex - blockStart;
+                size_t blockSize = itemSize - blockOffset;
+                if (blockSize >= remainingBufLen)
+                {
+                    blockSize = remainingBufLen;
+                }
+
+                memcpy(pBufferWithOffset, pBlock->pItems[iBlock].pMemBlock + blockOffset, blockSize);
+                pBufferWithOffset += blockSize;
+                sizeOfCopiedMem += blockSize;
+                currentIndex += blockSize;
+                remainingBufLen -= blockSize;
+            }
+            blockStart = blockEnd;
+        }
+        return sizeOfCopiedMem;
+    }
+
+    // Page of count items of itemSize bytes, as the generated chunk tables lay it out.
+    // Program memory items go through CopyProgmem() instead of memcpy().
+    struct Page
+    {
+        Page(size_t count, size_t itemSize, bool progmem = false)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                texts.push_back(std::string(itemSize, (char)('a' + i % 26)));
+            }
+            for (const std::string& text : texts)
+            {
+                if (progmem)
+                {
+                    items.push_back({ nullptr, nullptr, FPSTR(text.c_str()), text.size() });
+                }
+                else
+                {
+                    items.push_back({ text.c_str(), nullptr, nullptr, text.size() });
+                }
+            }
+            block = { items.data(), items.size() };
+            response = { FPSTR(WM_HTTP_HEAD_CT_TEXT_HTML), &block, &gHTMLHeaders };
+        }
+
+        std::vector<std::string> texts;
+        std::vector<HTTPMemoryBlock2Item> items;
+        HTTPMemoryBlock2 block;
+        HTTPResponseBlock2 response;
+    };
+
+    // Calls the filler until the response is complete, as the server does
+    template <typename Fill>
+    std::string Drain(Fill fill, size_t bufLen)
+    {
+        std::string content;
+        std::vector<uint8_t> buffer(bufLen);
+        size_t length;
+        while ((length = fill(buffer.data(), bufLen, content.size())) > 0)
+        {
+            content.append((const char*)buffer.data(), length);
+        }
+        return content;
+    }
+
+    // Same callback sequence without keeping the content, what the measurement runs
+    template <typename Fill>
+    size_t Send(Fill& fill, uint8_t *pBuffer, size_t bufLen)
+    {
+        size_t index = 0;
+        size_t length;
+        while ((length = fill(pBuffer, bufLen, index)) > 0)
+        {
+            index += length;
+        }
+        return index;
+    }
+
+    AwsResponseFiller CursorFiller(AsyncWebServerRequest& request, const Page& page)
+    {
+        ESPAsync_WiFiManagerUtils::responseText(&request, &page.response);
+        return request.response()->filler;
+    }
+
+    void Compare(size_t count, size_t itemSize, size_t bufLen, int iterations)
+    {
+        Page page(count, itemSize);
+        auto linear = [&page](uint8_t *pBuffer, size_t length, size_t index)
+        {
+            return LinearSendMemoryBlock(&page.block, pBuffer, length, index);
+        };
+
+        AsyncWebServerRequest request;
+        std::string expected = Drain(linear, bufLen);
+        BenchUtils::Check(expected.size() == count * itemSize, "linear filler sends the whole page");
+        BenchUtils::Check(Drain(CursorFiller(request, page), bufLen) == expected, "cursor filler sends the same page");
+
+        // A callback at another index than where the previous one ended seeks the cursor
+        std::mt19937 random(count);
+        AwsResponseFiller filler = CursorFiller(request, page);
+        std::vector<uint8_t> buffer(bufLen);
+        for (int i = 0; i < 1000; i++)
+        {
+            size_t index = random() % expected.size();
+            size_t length = filler(buffer.data(), 4 + random() % (bufLen - 4), index);
+            BenchUtils::Check(expected.compare(index, length, (const char*)buffer.data(), length) == 0, "seek");
+        }
+
+        // The response is built once, a callback at index 0 starts it over
+        filler = CursorFiller(request, page);
+        size_t callbacks = (expected.size() + bufLen - 1) / (bufLen & ~(size_t)3);
+        printf("%zu items x %zu B, %zu B buffer, %zu callbacks per response\n", count, itemSize, bufLen, callbacks);
+        BenchUtils::Measure("  walk from the first item", iterations, [&] {
+            BenchUtils::Check(Send(linear, buffer.data(), bufLen) == expected.size(), "length");
+        });
+        BenchUtils::Measure("  resume at the cursor", iterations, [&] {
+            BenchUtils::Check(Send(filler, buffer.data(), bufLen) == expected.size(), "length");
+        });
+    }
+
+    // Throughput of program memory items against RAM items. On the host both are memcpy,
+    // this only shows that the program memory branch adds nothing to the copy itself.
+    void CompareSources(size_t count, size_t itemSize, size_t bufLen, int iterations)
+    {
+        Page ram(count, itemSize);
+        Page progmem(count, itemSize, true);
+        AsyncWebServerRequest ramRequest;
+        AsyncWebServerRequest progmemRequest;
+        AwsResponseFiller ramFiller = CursorFiller(ramRequest, ram);
+        AwsResponseFiller progmemFiller = CursorFiller(progmemRequest, progmem);
+        BenchUtils::Check(Drain(progmemFiller, bufLen) == Drain(ramFiller, bufLen), "program memory items");
+
+        std::vector<uint8_t> buffer(bufLen);
+        size_t length = count * itemSize;
+        printf("%zu items x %zu B, %zu B buffer, %zu B per response\n", count, itemSize, bufLen, length);
+        BenchUtils::Measure("  RAM items", iterations, [&] {
+            BenchUtils::Check(Send(ramFiller, buffer.data(), bufLen) == length, "length");
+        });
+        BenchUtils::Measure("  program memory items", iterations, [&] {
+            BenchUtils::Check(Send(progmemFiller, buffer.data(), bufLen) == length, "length");
+        });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int count = BenchUtils::Iterations(argc, argv, 20000);
+    Compare(10, 300, 1460, count);
+    Compare(64, 200, 1460, count);
+    Compare(256, 100, 536, count);
+    Compare(1024, 64, 536, count / 4 > 0 ? count / 4 : 1);
+    CompareSources(4, 8192, 1460, count);
+    return 0;
+}
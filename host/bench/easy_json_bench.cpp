@@ -0,0 +1,238 @@
+/*
+  easy_json_bench.cpp - EasyJSON arena document against a per-node heap document
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+
+  The per-node document is the former EasyJSON design (std::map<String, node*> members and
+  String values), the allocation pattern of DOM libraries that allocate per node.
+  ArduinoJson is not a dependency of the library and is not compared.
+*/
+
+#include <ESPAsync_WiFiManager_easyJSON.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "BenchUtils.h"
+
+namespace {
+    class StringOut : public Print
+    {
+    public:
+        size_t write(uint8_t c) override { text += (char) c; return 1; }
+        size_t write(const uint8_t* pData, size_t size) override { text.append((const char*) pData, size); return size; }
+
+        std::string text;
+    };
+
+    struct HeapNode
+    {
+        enum Type { Null, Object, Array, Text, Int, Float, Bool };
+
+        ~HeapNode()
+        {
+            for (auto& member : members)
+            {
+                delete member.second;
+            }
+            for (HeapNode* pItem : items)
+            {
+                delete pItem;
+            }
+        }
+
+        void printTo(JSONUtils::JSONWriter& json) const
+        {
+            switch (type)
+            {
+                case Object:
+                    json.BeginObject();
+                    for (auto& member : members)
+                    {
+                        json.Key(member.first.c_str());
+                        member.second->printTo(json);
+                    }
+                    json.EndObject();
+                    break;
+                case Array:
+                    json.BeginArray();
+                    for (HeapNode* pItem : items)
+                    {
+                        pItem->printTo(json);
+                    }
+                    json.EndArray();
+                    break;
+                case Text:  json.Value(text);        break;
+                case Int:   json.Value(intValue);    break;
+                case Float: json.Value(floatValue);  break;
+                case Bool:  json.Value(boolValue);   break;
+                default:    json.Null();             break;
+            }
+        }
+
+        Type type = Null;
+        String text;
+        long intValue = 0;
+        float floatValue = 0;
+        bool boolValue = false;
+        std::map<String, HeapNode*> members;
+        std::vector<HeapNode*> items;
+    };
+
+    class HeapParser : public JSONUtils::JSONTokenizer
+    {
+    public:
+        HeapParser() : JSONUtils::JSONTokenizer(_value, sizeof(_value)) {}
+
+        HeapNode* pRoot = nullptr;
+
+    protected:
+        void token(Token token, const char* pValue, size_t /*length*/) override
+        {
+            if (token == TokenKey)
+            {
+                _key = pValue;
+                return;
+            }
+            if (token == TokenObjectEnd || token == TokenArrayEnd)
+            {
+                _stack.pop_back();
+                return;
+            }
+
+            HeapNode* pNode = new HeapNode;
+            switch (token)
+            {
+                case TokenObjectStart:  pNode->type = HeapNode::Object;  break;
+                case TokenArrayStart:   pNode->type = HeapNode::Array;   break;
+                case TokenString:       pNode->type = HeapNode::Text;    pNode->text = pValue;  break;
+                case TokenTrue:
+                case TokenFalse:        pNode->type = HeapNode::Bool;    pNode->boolValue = (token == TokenTrue);  break;
+                case TokenNull:         break;
+                default:
+                    if (strpbrk(pValue, ".eE") != nullptr)
+                    {
+                        pNode->type = HeapNode::Float;
+                        pNode->floatValue = strtof(pValue, nullptr);
+                    }
+                    else
+                    {
+                        pNode->type = HeapNode::Int;
+                        pNode->intValue = strtol(pValue, nullptr, 10);
+                    }
+                    break;
+            }
+
+            if (_stack.empty())
+            {
+                pRoot = pNode;
+            }
+            else if (_stack.back()->type == HeapNode::Object)
+            {
+                _stack.back()->members[_key] = pNode;
+            }
+            else
+            {
+                _stack.back()->items.push_back(pNode);
+            }
+
+            if (token == TokenObjectStart || token == TokenArrayStart)
+            {
+                _stack.push_back(pNode);
+            }
+        }
+
+    private:
+        char _value[256];
+        String _key;
+        std::vector<HeapNode*> _stack;
+    };
+
+    const char CONFIG[] =
+        "{\"wifi\":[{\"ssid\":\"HomeNetwork-5G\",\"pass\":\"correct horse battery\"},{\"ssid\":\"Office \\\"Guest\\\"\",\"pass\":\"\"}],"
+        "\"static\":{\"ip\":\"192.168.1.50\",\"gw\":\"192.168.1.1\",\"sn\":\"255.255.255.0\",\"dns\":[\"1.1.1.1\",\"8.8.8.8\"]},"
+        "\"mqtt\":{\"host\":\"broker.local\",\"port\":1883,\"user\":\"device\",\"retain\":true,\"qos\":1,\"keepalive\":60},"
+        "\"tz\":\"Europe/Bratislava\",\"ntp\":null}";
+
+    const char* const HWINFO_NAMES[] = { "Chip ID", "IDE Flash Size", "Real Flash Size", "Access Point IP",
+        "Access Point MAC", "SSID", "Station IP", "Station MAC" };
+}
+
+int main(int argc, char** argv)
+{
+    const int count = BenchUtils::Iterations(argc, argv, 100000);
+    const size_t length = strlen(CONFIG);
+    const size_t capacity = EasyJSONDocument::capacityFor(CONFIG, length);
+
+    {
+        EasyJSONDocument document(capacity);
+        BenchUtils::Check(document.parse(CONFIG, length), "config parses");
+        BenchUtils::Check(document.root().toString() == CONFIG, "config prints back as parsed");
+        printf("config: %zu B JSON, arena %zu B of %zu B, %d iterations\n", length, document.memoryUsed(), capacity, count);
+    }
+
+    BenchUtils::Measure("parse+read config, per-node heap", count, [&] {
+        HeapParser parser;
+        parser.write((const uint8_t*) CONFIG, length);
+        BenchUtils::Check(parser.finish() && parser.pRoot->members["mqtt"]->members["port"]->intValue == 1883, "port");
+        delete parser.pRoot;
+    });
+    BenchUtils::Measure("parse+read config, EasyJSON malloc arena", count, [&] {
+        EasyJSONDocument document(capacity);
+        document.parse(CONFIG, length);
+        BenchUtils::Check(document.root()["mqtt"]["port"].asInt() == 1883, "port");
+    });
+    BenchUtils::Measure("parse+read config, EasyJSON stack arena", count, [&] {
+        char buffer[2048];
+        EasyJSONDocument document(buffer, sizeof(buffer));
+        document.parse(CONFIG, length);
+        BenchUtils::Check(document.root()["mqtt"]["port"].asInt() == 1883, "port");
+    });
+
+    StringOut heapOut;
+    StringOut arenaOut;
+    heapOut.text.reserve(1024);
+    arenaOut.text.reserve(1024);
+
+    BenchUtils::Measure("build+print hwinfo, per-node heap", count, [&] {
+        HeapNode root;
+        root.type = HeapNode::Array;
+        for (const char* pName : HWINFO_NAMES)
+        {
+            HeapNode* pRow = new HeapNode;
+            pRow->type = HeapNode::Object;
+            HeapNode* pKey = new HeapNode;
+            pKey->type = HeapNode::Text;
+            pKey->text = pName;
+            HeapNode* pValue = new HeapNode;
+            pValue->type = HeapNode::Text;
+            pValue->text = "192.168.4.1";
+            pRow->members[String("name")] = pKey;
+            pRow->members[String("value")] = pValue;
+            root.items.push_back(pRow);
+        }
+        heapOut.text.clear();
+        JSONUtils::JSONWriter json(heapOut);
+        root.printTo(json);
+    });
+    BenchUtils::Measure("build+print hwinfo, EasyJSON stack arena", count, [&] {
+        // Nodes take 40 B on the host, twice as much as on the chips
+        char buffer[2048];
+        EasyJSONDocument document(buffer, sizeof(buffer));
+        EasyJSONVariant rows = document.toArray();
+        for (const char* pName : HWINFO_NAMES)
+        {
+            EasyJSONObject row = rows.addObject();
+            row.set(F("name"), pName);
+            row.set(F("value"), "192.168.4.1");
+        }
+        BenchUtils::Check(!document.overflow(), "hwinfo fits the arena");
+        arenaOut.text.clear();
+        document.printTo(arenaOut);
+    });
+    BenchUtils::Check(heapOut.text == arenaOut.text, "both hwinfo documents print the same");
+    printf("hwinfo: %zu B JSON\n", arenaOut.text.size());
+    return 0;
+}
@@ -0,0 +1,74 @@
+/*
+  json_writer_bench.cpp - /sq?dx=hwinfo built with the JSONUtils helpers and with JSONWriter
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+
+  The device values are constants, the benchmark measures only how the response is built.
+*/
+
+#include <JSONUtils.h>
+
+#include "BenchUtils.h"
+
+namespace {
+    const unsigned long CHIP_ID = 0x1640ef;
+    const unsigned int FLASH_SIZE = 4194304;
+    const IPAddress AP_IP(192, 168, 4, 1);
+    const IPAddress STATION_IP(192, 168, 1, 50);
+    const uint8_t AP_MAC[6] = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15 };
+    const uint8_t STATION_MAC[6] = { 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5 };
+
+    // The former /sq?dx=hwinfo, one String per row concatenated into the response
+    String HwinfoStrings()
+    {
+        return JSONUtils::EncloseArray(
+            JSONUtils::NameValueRow(F("Chip ID"), String(CHIP_ID, HEX), true) +
+            JSONUtils::NameValueRow(F("IDE Flash Size"), FLASH_SIZE) +
+            JSONUtils::NameValueRow(F("Real Flash Size"), FLASH_SIZE) +
+            JSONUtils::NameValueRow(F("Access Point IP"), AP_IP.toString()) +
+            JSONUtils::NameValueRow(F("Access Point MAC"), String("10:11:12:13:14:15")) +
+            JSONUtils::NameValueRow(F("SSID"), String("HomeNetwork-5G")) +
+            JSONUtils::NameValueRow(F("Station IP"), STATION_IP.toString()) +
+            JSONUtils::NameValueRow(F("Station MAC"), String("A0:A1:A2:A3:A4:A5")));
+    }
+
+    // The same rows as ESPAsync_WiFiManager::queryHardwareInfo() writes them
+    void HwinfoWriter(Print& out)
+    {
+        JSONUtils::JSONWriter json(out);
+        json.BeginArray();
+        json.BeginObject().Pair(F("name"), F("Chip ID")).Key(F("value")).HexValue(CHIP_ID).EndObject();
+        json.NameValueRow(F("IDE Flash Size"), FLASH_SIZE);
+        json.NameValueRow(F("Real Flash Size"), FLASH_SIZE);
+        json.NameValueRow(F("Access Point IP"), AP_IP);
+        json.BeginObject().Pair(F("name"), F("Access Point MAC")).Key(F("value")).MacValue(AP_MAC).EndObject();
+        json.NameValueRow(F("SSID"), "HomeNetwork-5G");
+        json.NameValueRow(F("Station IP"), STATION_IP);
+        json.BeginObject().Pair(F("name"), F("Station MAC")).Key(F("value")).MacValue(STATION_MAC).EndObject();
+        json.EndArray();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int count = BenchUtils::Iterations(argc, argv, 200000);
+
+    char buffer[512];
+    JSONUtils::JSONBuffer out(buffer, sizeof(buffer));
+    HwinfoWriter(out);
+    BenchUtils::Check(!out.overflow(), "hwinfo fits the buffer");
+    BenchUtils::Check(HwinfoStrings() == out.c_str(), "both builders produce the same JSON");
+    printf("hwinfo response: %zu B, %d iterations\n", out.length(), count);
+
+    BenchUtils::Measure("JSONUtils Strings", count, [] {
+        String response = HwinfoStrings();
+        BenchUtils::Check(response.length() > 0, "response");
+    });
+    BenchUtils::Measure("JSONWriter into JSONBuffer", count, [&] {
+        out.clear();
+        HwinfoWriter(out);
+        BenchUtils::Check(out.length() > 0, "response");
+    });
+    return 0;
+}
@@ -0,0 +1,167 @@
+/*
+  Arduino.h - Minimal host stand-in for the Arduino core
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+
+  Only what the library sources built by host/CMakeLists.txt need. Flash is ordinary
+  memory on the host, so the *_P helpers map to their RAM counterparts the same way
+  arduino-esp32 maps them.
+*/
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+#include <math.h>
+#include <string>
+
+#define PROGMEM
+#define PSTR(s) (s)
+typedef const char* PGM_P;
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(PSTR(s)))
+#define FPSTR(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+
+#define strlen_P strlen
+#define memcpy_P memcpy
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strncasecmp_P strncasecmp
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+
+#define HEX 16
+#define DEC 10
+
+typedef uint8_t byte;
+
+inline void yield() {}
+
+class Print
+{
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* pData, size_t size)
+    {
+        size_t written = 0;
+        while (size--)
+        {
+            written += write(*pData++);
+        }
+        return written;
+    }
+
+    size_t write(const char* pText) { return write((const uint8_t*)pText, strlen(pText)); }
+    size_t write(char c) { return write((uint8_t)c); }
+
+    size_t print(const char* pText) { return write(pText); }
+    size_t print(const __FlashStringHelper* pText) { return write((const char*)pText); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t print(unsigned int value) { return printf("%u", value); }
+    size_t print(long value) { return printf("%ld", value); }
+    size_t print(unsigned long value) { return printf("%lu", value); }
+    size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+
+private:
+    template <typename... Args>
+    size_t printf(const char* pFormat, Args... args)
+    {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), pFormat, args...);
+        return write(buffer);
+    }
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+// Arduino String on top of std::string, formatting follows the Arduino core
+class String
+{
+public:
+    String() {}
+    String(const char* pText) : _s(pText ? pText : "") {}
+    String(const __FlashStringHelper* pText) : _s(pText ? (const char*)pText : "") {}
+    String(const std::string& text) : _s(text) {}
+    explicit String(char c) : _s(1, c) {}
+    String(int value, unsigned char base = DEC) : _s(format(base == HEX ? "%x" : "%d", value)) {}
+    String(unsigned int value, unsigned char base = DEC) : _s(format(base == HEX ? "%x" : "%u", value)) {}
+    String(long value, unsigned char base = DEC) : _s(format(base == HEX ? "%lx" : "%ld", value)) {}
+    String(unsigned long value, unsigned char base = DEC) : _s(format(base == HEX ? "%lx" : "%lu", value)) {}
+    String(float value, unsigned char decimals = 2) : _s(format("%.*f", (int)decimals, value)) {}
+
+    const char* c_str() const { return _s.c_str(); }
+    size_t length() const { return _s.size(); }
+    bool isEmpty() const { return _s.empty(); }
+    bool reserve(size_t size) { _s.reserve(size); return true; }
+    char operator[](size_t index) const { return _s[index]; }
+    char charAt(size_t index) const { return _s[index]; }
+
+    int indexOf(char c, unsigned int from = 0) const { return position(_s.find(c, from)); }
+    int indexOf(const char* pText, unsigned int from = 0) const { return position(_s.find(pText, from)); }
+    int indexOf(const String& text, unsigned int from = 0) const { return position(_s.find(text._s, from)); }
+    String substring(size_t from) const { return String(_s.substr(from)); }
+    String substring(size_t from, size_t to) const { return String(_s.substr(from, to - from)); }
+    bool startsWith(const String& prefix) const { return _s.rfind(prefix._s, 0) == 0; }
+    bool equals(const String& other) const { return _s == other._s; }
+    bool equalsIgnoreCase(const String& other) const { return strcasecmp(c_str(), other.c_str()) == 0; }
+    long toInt() const { return atol(c_str()); }
+
+    bool concat(const String& other) { _s += other._s; return true; }
+    bool concat(const char* pText, size_t size) { _s.append(pText, size); return true; }
+    bool concat(char c) { _s += c; return true; }
+
+    template <typename T>
+    String& operator+=(const T& value) { _s += String(value)._s; return *this; }
+    String& operator+=(const String& other) { _s += other._s; return *this; }
+    String& operator+=(const char* pText) { _s += pText; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+
+    bool operator==(const String& other) const { return _s == other._s; }
+    bool operator==(const char* pText) const { return _s == pText; }
+    bool operator!=(const String& other) const { return _s != other._s; }
+    bool operator!=(const char* pText) const { return _s != pText; }
+    bool operator<(const String& other) const { return _s < other._s; }
+
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    friend String operator+(const String& a, const char* b) { return String(a._s + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b._s); }
+    friend String operator+(const String& a, const __FlashStringHelper* b) { return String(a._s + (const char*)b); }
+    friend String operator+(const __FlashStringHelper* a, const String& b) { return String((const char*)a + b._s); }
+
+private:
+    template <typename T>
+    static std::string format(const char* pFormat, T value)
+    {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), pFormat, value);
+        return buffer;
+    }
+
+    static std::string format(const char* pFormat, int decimals, float value)
+    {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), pFormat, decimals, value);
+        return buffer;
+    }
+
+    static int position(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+
+    std::string _s;
+};
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,139 @@
+/*
+  ESPAsyncWebServer.h - Minimal host stand-in for ESPAsyncWebServer
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+
+  Requests answer from the headers the test put in them. Responses only record what
+  they were built with, the filler of a streamed response is called by the test.
+*/
+
+#ifndef HOST_ESPASYNCWEBSERVER_H
+#define HOST_ESPASYNCWEBSERVER_H
+
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+
+class AsyncWebHeader
+{
+public:
+    AsyncWebHeader(const String& name, const String& value) : _name(name), _value(value) {}
+
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+
+private:
+    String _name;
+    String _value;
+};
+
+class AsyncWebServerResponse
+{
+public:
+    virtual ~AsyncWebServerResponse() {}
+
+    void addHeader(const String& name, const String& value) { headers.emplace_back(name, value); }
+
+    int code = 200;
+    String contentType;
+    String content;                 // Content of a response sent from a String
+    const uint8_t* pContent = nullptr;  // Content of a response sent from program memory
+    size_t contentLength = 0;       // 0 for chunked responses
+    bool chunked = false;
+    AwsResponseFiller filler;
+    std::vector<AsyncWebHeader> headers;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print
+{
+public:
+    size_t write(uint8_t c) override { content.concat((char)c); return 1; }
+    using Print::write;
+};
+
+class AsyncWebServerRequest
+{
+public:
+    ~AsyncWebServerRequest() { delete _pResponse; }
+
+    void addRequestHeader(const String& name, const String& value) { _headers.emplace_back(name, value); }
+
+    const AsyncWebHeader* getHeader(const String& name) const
+    {
+        for (const AsyncWebHeader& header : _headers)
+        {
+            if (header.name().equalsIgnoreCase(name))
+            {
+                return &header;
+            }
+        }
+        return nullptr;
+    }
+
+    bool hasHeader(const String& name) const { return getHeader(name) != nullptr; }
+
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(), const String& content = String())
+    {
+        AsyncWebServerResponse* pResponse = new AsyncWebServerResponse;
+        pResponse->code = code;
+        pResponse->contentType = contentType;
+        pResponse->content = content;
+        pResponse->contentLength = content.length();
+        return pResponse;
+    }
+
+    AsyncWebServerResponse* beginResponse(const String& contentType, size_t length, AwsResponseFiller filler)
+    {
+        AsyncWebServerResponse* pResponse = beginResponse(200, contentType);
+        pResponse->contentLength = length;
+        pResponse->filler = filler;
+        return pResponse;
+    }
+
+    AsyncWebServerResponse* beginResponse_P(int code, const String& contentType, const uint8_t* pContent, size_t length)
+    {
+        AsyncWebServerResponse* pResponse = beginResponse(code, contentType);
+        pResponse->pContent = pContent;
+        pResponse->contentLength = length;
+        return pResponse;
+    }
+
+    AsyncWebServerResponse* beginChunkedResponse(const String& contentType, AwsResponseFiller filler)
+    {
+        AsyncWebServerResponse* pResponse = beginResponse(200, contentType);
+        pResponse->chunked = true;
+        pResponse->filler = filler;
+        return pResponse;
+    }
+
+    AsyncResponseStream* beginResponseStream(const String& contentType, size_t /*bufferSize*/ = 1460)
+    {
+        AsyncResponseStream* pResponse = new AsyncResponseStream;
+        pResponse->contentType = contentType;
+        return pResponse;
+    }
+
+    void send(AsyncWebServerResponse* pResponse)
+    {
+        delete _pResponse;
+        _pResponse = pResponse;
+    }
+
+    void send(int code, const String& contentType = String(), const String& content = String())
+    {
+        send(beginResponse(code, contentType, content));
+    }
+
+    // Response of the last send(), owned by the request
+    AsyncWebServerResponse* response() const { return _pResponse; }
+
+private:
+    std::vector<AsyncWebHeader> _headers;
+    AsyncWebServerResponse* _pResponse = nullptr;
+};
+
+#endif // HOST_ESPASYNCWEBSERVER_H
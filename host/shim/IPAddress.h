@@ -0,0 +1,33 @@
+/*
+  IPAddress.h - Minimal host stand-in for the Arduino IPAddress
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+*/
+
+#ifndef HOST_IPADDRESS_H
+#define HOST_IPADDRESS_H
+
+#include <Arduino.h>
+
+class IPAddress
+{
+public:
+    IPAddress() {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+
+    uint8_t operator[](int index) const { return _bytes[index]; }
+    bool operator==(const IPAddress& other) const { return memcmp(_bytes, other._bytes, sizeof(_bytes)) == 0; }
+
+    String toString() const
+    {
+        char buffer[16];
+        snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+        return String(buffer);
+    }
+
+private:
+    uint8_t _bytes[4] = {};
+};
+
+#endif // HOST_IPADDRESS_H
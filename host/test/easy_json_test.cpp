@@ -0,0 +1,131 @@
+/*
+  easy_json_test.cpp - EasyJSONDocument parsing, access, editing and arena sizing
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+*/
+
+#include <ESPAsync_WiFiManager_easyJSON.hpp>
+
+#include <string>
+
+namespace {
+    int failures = 0;
+
+    void Check(bool condition, const char* pWhat)
+    {
+        if (!condition)
+        {
+            printf("FAIL %s\n", pWhat);
+            failures++;
+        }
+    }
+
+    // Parses into an arena of capacityFor() and prints the document back, "error" if it fails
+    std::string RoundTrip(const char* pJson)
+    {
+        EasyJSONDocument document(EasyJSONDocument::capacityFor(pJson, strlen(pJson)));
+        if (!document.parse(pJson))
+        {
+            Check(!document.overflow(), "capacityFor() leaves room for the whole document");
+            return "error";
+        }
+        return document.root().toString().c_str();
+    }
+
+    void ExpectRoundTrip(const char* pJson, const char* pExpected)
+    {
+        std::string result = RoundTrip(pJson);
+        if (result != pExpected)
+        {
+            printf("FAIL %s\n  expected %s\n  got      %s\n", pJson, pExpected, result.c_str());
+            failures++;
+        }
+    }
+
+    const char CONFIG[] =
+        "{\"ssid1\":\"HomeNetwork-5G\",\"pwd1\":\"correct horse battery\",\"ssid2\":\"Office \\\"Guest\\\"\","
+        "\"pwd2\":\"\",\"static\":{\"ip\":\"192.168.1.50\",\"dns\":[\"1.1.1.1\",\"8.8.8.8\"]},"
+        "\"mqtt\":{\"port\":1883,\"retain\":true,\"keepalive\":60.25},\"ntp\":null}";
+}
+
+int main()
+{
+    // Top level scalars
+    {
+        EasyJSONDocument document(256);
+        Check(document.parse("123") && document.root().asInt() == 123, "parse(\"123\")");
+        Check(document.parse("-1.5e1") && document.root().asFloat() == -15.0f, "parse(\"-1.5e1\")");
+        Check(document.parse("true") && document.root().asBool(), "parse(\"true\")");
+        Check(document.parse("null") && document.root().getType() == EasyJSONVariant::NULLTYPE, "parse(\"null\")");
+        Check(document.parse(" \"x\" ") && strcmp(document.root().asString(), "x") == 0, "parse(\" \\\"x\\\" \")");
+    }
+
+    // Members of a config document, floats print with two decimals as on Arduino
+    {
+        EasyJSONDocument document(EasyJSONDocument::capacityFor(CONFIG, strlen(CONFIG)));
+        Check(document.parse(CONFIG), "parse(CONFIG)");
+        EasyJSONVariant root = document.root();
+        Check(strcmp(root["ssid2"].asString(), "Office \"Guest\"") == 0, "escaped string member");
+        Check(strcmp(root[F("static")]["dns"][1].asString(), "8.8.8.8") == 0, "nested array item");
+        Check(root["mqtt"]["port"].asInt() == 1883, "int member");
+        Check(root["mqtt"]["retain"].asBool(), "bool member");
+        Check(root["mqtt"]["keepalive"].asFloat() == 60.25f, "float member");
+        Check(root["ntp"].getType() == EasyJSONVariant::NULLTYPE, "null member");
+        Check(!root["missing"]["x"][3].isDefined(), "missing member");
+        Check(root.toString() == CONFIG, "printed back as parsed");
+
+        EasyJSONObject object = root.asObject();
+        object.remove("static");
+        object.set("pwd2", 5);
+        object.createArray("list").add(1.5f);
+        Check(root.toString() == "{\"ssid1\":\"HomeNetwork-5G\",\"pwd1\":\"correct horse battery\","
+            "\"ssid2\":\"Office \\\"Guest\\\"\",\"pwd2\":5,\"mqtt\":{\"port\":1883,\"retain\":true,\"keepalive\":60.25},"
+            "\"ntp\":null,\"list\":[1.50]}", "edited document");
+    }
+
+    // Pieces written to the parser, ended by finish()
+    {
+        EasyJSONDocument document(1024);
+        EasyJSONParser parser(document);
+        for (const char* p = CONFIG; *p != 0; p++)
+        {
+            parser.write((uint8_t) *p);
+        }
+        Check(parser.finish() && parser.valid(), "parser fed byte by byte");
+        Check(document.root().toString() == CONFIG, "parser fed byte by byte, content");
+    }
+
+    // A full arena is told apart from malformed JSON
+    {
+        char buffer[64];
+        EasyJSONDocument document(buffer, sizeof(buffer));
+        Check(!document.parse(CONFIG) && document.overflow(), "full arena");
+        Check(!document.root().isDefined(), "no root after a failed parse");
+
+        EasyJSONDocument large(1024);
+        Check(!large.parse("{\"a\":") && !large.overflow(), "malformed, not a full arena");
+    }
+
+    // capacityFor() is enough for the densest documents
+    ExpectRoundTrip("[1,2,3,4,5,6,7,8,9]", "[1,2,3,4,5,6,7,8,9]");
+    ExpectRoundTrip("[[],[[]],{},{\"\":{}}]", "[[],[[]],{},{\"\":{}}]");
+    ExpectRoundTrip("{\"a\":\"\",\"b\":\"\",\"c\":\"\"}", "{\"a\":\"\",\"b\":\"\",\"c\":\"\"}");
+    ExpectRoundTrip("0", "0");
+    ExpectRoundTrip(CONFIG, CONFIG);
+
+    // Malformed documents
+    ExpectRoundTrip("", "error");
+    ExpectRoundTrip("[1,]", "error");
+    ExpectRoundTrip("{\"a\":01}", "error");
+    ExpectRoundTrip("12abc", "error");
+    ExpectRoundTrip("[1", "error");
+
+    if (failures > 0)
+    {
+        printf("%d failed\n", failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
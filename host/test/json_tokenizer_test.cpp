@@ -0,0 +1,138 @@
+/*
+  json_tokenizer_test.cpp - JSONUtils::JSONTokenizer token stream, grammar and finish()
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+*/
+
+#include <JSONUtils.h>
+
+#include <string>
+
+namespace {
+    int failures = 0;
+
+    // Token stream as text: brackets as they are, K(key) S(string) N(number) T F 0 for null
+    class TokenDump : public JSONUtils::JSONTokenizer
+    {
+    public:
+        TokenDump() : JSONUtils::JSONTokenizer(_value, sizeof(_value)) {}
+
+        std::string tokens;
+
+    protected:
+        void token(Token token, const char* pValue, size_t length) override
+        {
+            static const char* const NAMES[] = { "{", "}", "[", "]", "K", "S", "N", "T", "F", "0" };
+            if (!tokens.empty())
+            {
+                tokens += ' ';
+            }
+            tokens += NAMES[token];
+            if (token == TokenKey || token == TokenString || token == TokenNumber)
+            {
+                tokens += '(';
+                tokens.append(pValue, length);
+                tokens += ')';
+            }
+        }
+
+    private:
+        char _value[64];
+    };
+
+    // Writes the document in pieces of chunk bytes and finishes it, expected is the token
+    // stream of a valid document or "error"
+    void Expect(const char* pJson, const char* pExpected, size_t chunk = 1)
+    {
+        TokenDump tokenizer;
+        size_t length = strlen(pJson);
+        for (size_t i = 0; i < length; i += chunk)
+        {
+            tokenizer.write(reinterpret_cast<const uint8_t*>(pJson) + i, std::min(chunk, length - i));
+        }
+        bool complete = tokenizer.finish();
+
+        std::string result = complete ? tokenizer.tokens : "error";
+        if (complete == tokenizer.error() || result != pExpected)
+        {
+            printf("FAIL %s (chunk %zu)\n  expected %s\n  got      %s\n", pJson, chunk, pExpected, result.c_str());
+            failures++;
+        }
+    }
+}
+
+int main()
+{
+    // Documents and the token stream they produce, whole and one byte at a time
+    for (size_t chunk : { (size_t) 1, (size_t) 3, (size_t) 1024 })
+    {
+        Expect("{\"a\":[1,-2.5e3,true,false,null,\"x\"],\"b\":{}}",
+            "{ K(a) [ N(1) N(-2.5e3) T F 0 S(x) ] K(b) { } }", chunk);
+        Expect("[0, -0, 0.5, 10, 1E+2, 1e-2, -0.0e0]",
+            "[ N(0) N(-0) N(0.5) N(10) N(1E+2) N(1e-2) N(-0.0e0) ]", chunk);
+        Expect("\"\\u00e9\\ud83d\\ude00\\n\\\"\\/\"", "S(\xC3\xA9\xF0\x9F\x98\x80\n\"/)", chunk);
+        Expect("[]", "[ ]", chunk);
+    }
+
+    // Top level scalars have no delimiter, finish() completes them
+    Expect("123", "N(123)");
+    Expect("-0.5e10", "N(-0.5e10)");
+    Expect(" 42 ", "N(42)");
+    Expect("true", "T");
+    Expect("false", "F");
+    Expect("null", "0");
+    Expect("\"text\"", "S(text)");
+
+    // Numbers outside the RFC 8259 grammar
+    Expect("12abc", "error");
+    Expect("-", "error");
+    Expect("1e", "error");
+    Expect("1e+", "error");
+    Expect("01", "error");
+    Expect("-01", "error");
+    Expect("1.", "error");
+    Expect(".5", "error");
+    Expect("+1", "error");
+    Expect("0x10", "error");
+    Expect("[1.e5]", "error");
+    Expect("[12abc]", "error");
+    Expect("{\"a\":01}", "error");
+    Expect("[-]", "error");
+
+    // Unterminated documents
+    Expect("", "error");
+    Expect("   ", "error");
+    Expect("{", "error");
+    Expect("[1,2", "error");
+    Expect("{\"a\":1", "error");
+    Expect("{\"a\":", "error");
+    Expect("{\"a\"", "error");
+    Expect("\"abc", "error");
+    Expect("[\"abc", "error");
+    Expect("[1", "error");
+
+    // Malformed structure and literals
+    Expect("{\"a\" 1}", "error");
+    Expect("{\"a\":1,}", "error");
+    Expect("[1,2]]", "error");
+    Expect("[1}", "error");
+    Expect("{\"a\":tru}", "error");
+    Expect("tru", "error");
+    Expect("nulls", "error");
+    Expect("\"\\ud83d\"", "error");
+    Expect("\"a\nb\"", "error");
+    Expect("{} x", "error");
+    Expect("1 2", "error");
+
+    // A string longer than the value buffer
+    Expect("[\"0123456789012345678901234567890123456789012345678901234567890123456789\"]", "error");
+
+    if (failures > 0)
+    {
+        printf("%d failed\n", failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
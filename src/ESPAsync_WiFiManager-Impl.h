@@ -41,55 +41,84 @@
 // Utilities and shared structs
 #include "JSONUtils.h"
 #include "ESPAsync_WiFiManagerUtils.h"
+#include "ESPAsync_WiFiManager_easyJSON.hpp"
 
 
 // index.html
-WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(gIndexHtml, WM_PK_INDEX_HTML);
+WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(gIndexHtml, WM_TRANSLATED_FILE(WM_PK_INDEX_HTML));
 // ota.html
-WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(gOTAHtml, WM_PK_OTA_HTML);
+WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(gOTAHtml, WM_TRANSLATED_FILE(WM_PK_OTA_HTML));
 // info.html
-WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(gInfoHtml, WM_PK_INFO_HTML);
+WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(gInfoHtml, WM_TRANSLATED_FILE(WM_PK_INFO_HTML));
 // wifi.html
-WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(gWiFiHtml, WM_PK_WIFI_HTML);
+WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(gWiFiHtml, WM_TRANSLATED_FILE(WM_PK_WIFI_HTML));
 #ifdef WM_SUPPORT_HOME_ASSISTANT
 // mqtt.html
-WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(gMQTTHtml, WM_PK_MQTT_HTML);
+WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(gMQTTHtml, WM_TRANSLATED_FILE(WM_PK_MQTT_HTML));
 #endif
 
 
 // style.css
 WM_DEFINE_STATIC_CSS_FILE_AS_SINGLE_BLOCK(gStyleCSS, WM_PK_STYLE_CSS);
-// ota.js
-WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gOTAJS, WM_PK_OTA_JS);
+// ota.js, bundled with utils.js, md5_utils.js and restart.js
+WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gOTAJS, WM_TRANSLATED_FILE(WM_PK_OTA_JS));
 // utils.js
 WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gUtilsJS, WM_PK_UTILS_JS);
-// md5_utils.js
-WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gMD5UtilsJS, WM_PK_MD5_UTILS_JS);
 // module_polyfill.js
 WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gModulePolyfillJS, WM_PK_MODULE_POLYFILL_JS);
 // restart.js
-WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gRestartJS, WM_PK_RESTART_JS);
+WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gRestartJS, WM_TRANSLATED_FILE(WM_PK_RESTART_JS));
+// hw-status.js
+WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gHWStatusJS, WM_PK_HW_STATUS_JS);
+#if USE_ESP_WIFIMANAGER_NTP && !USE_CLOUDFLARE_NTP
+// jstz.js, timezone detection referenced by WM_HTTP_SCRIPT_NTP
+WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gJSTZJS, WM_PK_JSTZ_JS);
+#endif
 #ifdef WM_REMOTE_UPDATE
 #include <ESP8266WiFi.h>
 #include <ESP8266HTTPClient.h>
 #include <ESP8266httpUpdate.h>
 #include <WiFiClientSecure.h>
 #include <IoTDevice.h>
-WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gOTARemoteJS, WM_PK_OTA_REMOTE_JS);
+WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gOTARemoteJS, WM_TRANSLATED_FILE(WM_PK_OTA_REMOTE_JS));
+#endif
+
+#if WM_LANGUAGE_TABLE
+// lang.js, loads the language table the translated files look their strings up in
+WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(gLangJS, WM_PK_LANG_JS);
+// lang/en.json, lang/sk.json
+WM_DEFINE_STATIC_JSON_FILE_AS_SINGLE_BLOCK(gLangEnJSON, WM_PK_LANG_EN_JSON);
+WM_DEFINE_STATIC_JSON_FILE_AS_SINGLE_BLOCK(gLangSkJSON, WM_PK_LANG_SK_JSON);
+#endif
+
+#if WM_RUNTIME_LANGUAGE
+// Translated files, assembled in the language of the request instead of the blocks above
+WM_DEFINE_LANGUAGE_HTML_FILE(gIndexHtmlLT, WM_PK_INDEX_HTML);
+WM_DEFINE_LANGUAGE_HTML_FILE(gOTAHtmlLT, WM_PK_OTA_HTML);
+WM_DEFINE_LANGUAGE_HTML_FILE(gInfoHtmlLT, WM_PK_INFO_HTML);
+WM_DEFINE_LANGUAGE_HTML_FILE(gWiFiHtmlLT, WM_PK_WIFI_HTML);
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+WM_DEFINE_LANGUAGE_HTML_FILE(gMQTTHtmlLT, WM_PK_MQTT_HTML);
+#endif
+WM_DEFINE_LANGUAGE_JS_FILE(gOTAJSLT, WM_PK_OTA_JS);
+WM_DEFINE_LANGUAGE_JS_FILE(gRestartJSLT, WM_PK_RESTART_JS);
+#ifdef WM_REMOTE_UPDATE
+WM_DEFINE_LANGUAGE_JS_FILE(gOTARemoteJSLT, WM_PK_OTA_REMOTE_JS);
+#endif
 #endif
 
 
-HTTPMemoryBlockItem gTrainControlHtmlChunks[] = {
-    WM_MEMORY_P_BLOCK_ITEM(FPSTR(WM_PK_HTML_HEAD_1)),
-    WM_MEMORY_P_BLOCK_ITEM(FPSTR(WM_PK_HTTP_FIRMWARE_UPDATE_MSG)),
-    WM_MEMORY_P_BLOCK_ITEM(FPSTR(WM_PK_HTML_HEAD_2)),
-    WM_MEMORY_P_BLOCK_ITEM(FPSTR(WM_PK_HTTP_PWMCTRL_SCRIPT)),
-    WM_MEMORY_P_BLOCK_ITEM(FPSTR(WM_PK_HTML_STYLE_S)),
-    WM_MEMORY_P_BLOCK_ITEM(FPSTR(WM_PK_HTTP_TRAIN_STYLE)),
-    WM_MEMORY_P_BLOCK_ITEM(FPSTR(WM_PK_HTML_STYLE_E)),
-    WM_MEMORY_P_BLOCK_ITEM(FPSTR(WM_PK_HTML_HEAD_3)),
-    WM_MEMORY_P_BLOCK_ITEM(FPSTR(WM_PK_HTTP_TRAIN_CONTROL)),
-    WM_MEMORY_P_BLOCK_ITEM(FPSTR(WM_PK_HTML_FOOT))
+const HTTPMemoryBlockItem gTrainControlHtmlChunks[] = {
+    WM_MEMORY_P_BLOCK_ITEM(WM_PK_HTML_HEAD_1),
+    WM_MEMORY_P_BLOCK_ITEM(WM_PK_HTTP_FIRMWARE_UPDATE_MSG),
+    WM_MEMORY_P_BLOCK_ITEM(WM_PK_HTML_HEAD_2),
+    WM_MEMORY_P_BLOCK_ITEM(WM_PK_HTTP_PWMCTRL_SCRIPT),
+    WM_MEMORY_P_BLOCK_ITEM(WM_PK_HTML_STYLE_S),
+    WM_MEMORY_P_BLOCK_ITEM(WM_PK_HTTP_TRAIN_STYLE),
+    WM_MEMORY_P_BLOCK_ITEM(WM_PK_HTML_STYLE_E),
+    WM_MEMORY_P_BLOCK_ITEM(WM_PK_HTML_HEAD_3),
+    WM_MEMORY_P_BLOCK_ITEM(WM_PK_HTTP_TRAIN_CONTROL),
+    WM_MEMORY_P_BLOCK_ITEM(WM_PK_HTML_FOOT)
 };
 
 const HTTPMemoryBlock gTrainControlHtmlBlock = WM_MEMORY_BLOCK(gTrainControlHtmlChunks);
@@ -103,110 +132,40 @@ const HTTPResponseBlock gTrainControlHtmlBlockResponse = {
 //////////////////////////////////////////
 // PK
 namespace {
-/*
-    void buildHtmlPage(String& page,
+    // Portal page head up to the body. Flash pieces are referenced, only customHeadElem is copied.
+    void beginHtmlPage(HTTPTemplateStream& page,
         const __FlashStringHelper *pTitle,
         const __FlashStringHelper *pScript,
         const __FlashStringHelper *pStyle,
         const String& customHeadElem,
-        const String& headTitle,
-        const String& body,
-        const String& optScriptElem = "")
-    {
-        LOGDEBUG(F("buildHtmlPage (start)"));
-
-        size_t sz = STRLEN_P(pTitle) + STRLEN_P(pScript) + STRLEN_P(pStyle) + customHeadElem.length() +
-            headTitle.length() + body.length() + optScriptElem.length() + STRLEN_P(FPSTR(WM_PK_HTTP_HTML));
-
-        page.reserve(sz);
-        LOGDEBUG1("buildHtmlPage: calc capacity", sz);
-        page += FPSTR(WM_PK_HTTP_HTML);
-        //LOGDEBUG1("buildHtmlPage: calc capacity", page.capacity());
-        page.replace(F("%{body}%"), body);
-        LOGDEBUG("buildHtmlPage: after {body}");
-        page.replace(F("%{customHeadElem}%"), customHeadElem);
-        page.replace(F("%{optScriptElem}%"), optScriptElem);
-        page.replace(F("%{headTitle}%"), headTitle);
-        REPLACE_P(page, F("%{title}%"), pTitle);
-        LOGDEBUG("buildHtmlPage: before {script}");
-        REPLACE_P(page, F("%{script}%"), pScript);
-        LOGDEBUG("buildHtmlPage: after {script}");
-        REPLACE_P(page, F("%{style}%"), pStyle);
-        LOGDEBUG("buildHtmlPage: after {style}");
-    }
-*/
-
-    void buildHtmlPage(String& page,
-        const __FlashStringHelper *pTitle,
-        const __FlashStringHelper *pScript,
-        const __FlashStringHelper *pStyle,
-        const String& customHeadElem,
-        const String& headTitle,
-        const String& body,
-        const String& optScriptElem = "")
-    {
-        LOGDEBUG(F("buildHtmlPage2 (start)"));
-
-        size_t sz = STRLEN_P(WM_PK_HTML_HEAD_1) + STRLEN_P(pTitle) + STRLEN_P(WM_PK_HTML_HEAD_2) +
-            STRLEN_P(pScript) + optScriptElem.length() + customHeadElem.length() + STRLEN_P(WM_PK_HTML_HEAD_3) +
-            body.length() + STRLEN_P(WM_PK_HTML_FOOT);
-
-        if (pStyle) 
+        const __FlashStringHelper *pHeadTitle,
+        const __FlashStringHelper *pOptScriptElem = nullptr)
+    {
+        page.add(FPSTR(WM_PK_HTML_HEAD_1));
+        page.add(pTitle);
+        page.add(FPSTR(WM_PK_HTML_HEAD_2));
+        page.add(pScript);
+        page.add(pOptScriptElem);
+        if (pStyle)
         {
-            sz += STRLEN_P(WM_PK_HTML_STYLE_S);
-            sz += STRLEN_P(pStyle);
-            sz += STRLEN_P(WM_PK_HTML_STYLE_E);
+            page.add(FPSTR(WM_PK_HTML_STYLE_S));
+            page.add(pStyle);
+            page.add(FPSTR(WM_PK_HTML_STYLE_E));
         }
-
-        if (!headTitle.isEmpty())
+        page.add(customHeadElem);
+        page.add(FPSTR(WM_PK_HTML_HEAD_3));
+        if (pHeadTitle)
         {
-            sz += STRLEN_P(WM_PK_HTML_H2_S);
-            sz += headTitle.length();
-            sz += STRLEN_P(WM_PK_HTML_H2_E);
+            page.add(FPSTR(WM_PK_HTML_H2_S));
+            page.add(pHeadTitle);
+            page.add(FPSTR(WM_PK_HTML_H2_E));
         }
+    }
 
-        //+ customHeadElem.length()
-        //    headTitle.length() + body.length() + optScriptElem.length() + STRLEN_P(FPSTR(WM_PK_HTTP_HTML));
-
-        page.reserve(sz);
-        LOGDEBUG1("buildHtmlPage2: calc capacity: ", sz);
-        page += FPSTR(WM_PK_HTML_HEAD_1);
-        APPEND_P(page, pTitle);
-        page += FPSTR(WM_PK_HTML_HEAD_2);
-        APPEND_P(page, pScript);
-        page += optScriptElem;
-        if (pStyle) 
-        {
-            APPEND_P(page, WM_PK_HTML_STYLE_S);
-            APPEND_P(page, pStyle);
-            APPEND_P(page, WM_PK_HTML_STYLE_E);
-        }
-        page += customHeadElem;
-        page += FPSTR(WM_PK_HTML_HEAD_3);
-        if (!headTitle.isEmpty())
-        {
-            APPEND_P(page, WM_PK_HTML_H2_S);
-            page += headTitle;
-            APPEND_P(page, WM_PK_HTML_H2_E);
-        }
-        page += body;
-        page += FPSTR(WM_PK_HTML_FOOT);
-
-        LOGDEBUG1("buildHtmlPage2: length: ", page.length());
-
-        /*
-        page.replace(F("%{body}%"), body);
-        LOGDEBUG("buildHtmlPage: after {body}");
-        page.replace(F("%{customHeadElem}%"), customHeadElem);
-        page.replace(F("%{optScriptElem}%"), optScriptElem);
-        page.replace(F("%{headTitle}%"), headTitle);
-        REPLACE_P(page, F("%{title}%"), pTitle);
-        LOGDEBUG("buildHtmlPage: before {script}");
-        REPLACE_P(page, F("%{script}%"), pScript);
-        LOGDEBUG("buildHtmlPage: after {script}");
-        REPLACE_P(page, F("%{style}%"), pStyle);
-        LOGDEBUG("buildHtmlPage: after {style}");
-        */
+    // Portal page end after the body
+    void endHtmlPage(HTTPTemplateStream& page)
+    {
+        page.add(FPSTR(WM_PK_HTML_FOOT));
     }
 };
 // PK
@@ -447,6 +406,22 @@ void ESPAsync_WiFiManager::init(const char *iHostname)
     LOGWARN1(F("RFC925 Hostname ="), _RFC952_hostname);
 
     setHostname();
+
+    // Station state shown on the info page changed, render it again on the next request
+#ifdef ESP8266
+    _infoConnectedHandler = WiFi.onStationModeConnected([this](const WiFiEventStationModeConnected&)
+        { _needInfo = true; });
+    _infoDisconnectedHandler = WiFi.onStationModeDisconnected([this](const WiFiEventStationModeDisconnected&)
+        { _needInfo = true; });
+    _infoGotIPHandler = WiFi.onStationModeGotIP([this](const WiFiEventStationModeGotIP&)
+        { _needInfo = true; });
+#else    //ESP32
+    // Event ids differ between core versions, any WiFi event marks the cache stale
+    _infoEventId = WiFi.onEvent([this](WiFiEvent_t, WiFiEventInfo_t)
+        { _needInfo = true; });
+#endif
+
+    addBuiltinSystemQueries();
 }
 
 
@@ -454,6 +429,10 @@ void ESPAsync_WiFiManager::init(const char *iHostname)
 
 ESPAsync_WiFiManager::~ESPAsync_WiFiManager()
 {
+#ifdef ESP32
+    WiFi.removeEvent(_infoEventId);
+#endif
+
 #if USE_DYNAMIC_PARAMS
 
     if (_params != NULL)
@@ -611,6 +590,9 @@ void ESPAsync_WiFiManager::setupConfigPortal()
 
     LOGWARN1(F("AP IP address ="), WiFi.softAPIP());
 
+    // AP address and MAC shown on the info page
+    _needInfo = true;
+
     /* Setup web pages: root, wifi config pages, SO captive portal detectors and not found. */
 
     attacheHandlers(ON_AP_FILTER);
@@ -695,7 +677,8 @@ void ESPAsync_WiFiManager::attacheHandlers(ArRequestFilterFunction filterFn)
     using namespace std::placeholders;  // for _1, _2, _3..
 
     _server->on("/", std::bind(&ESPAsync_WiFiManager::handleRoot, this, _1)).setFilter(filterFn);
-    _server->on("/wifisave", std::bind(&ESPAsync_WiFiManager::handleWiFiSave, this, _1)).setFilter(filterFn);
+    _server->on("/wifisave", HTTP_ANY, std::bind(&ESPAsync_WiFiManager::handleWiFiSave, this, _1), nullptr,
+        std::bind(&ESPAsync_WiFiManager::handleWiFiSaveBody, this, _1, _2, _3, _4, _5)).setFilter(filterFn);
     _server->on("/close",   std::bind(&ESPAsync_WiFiManager::handleServerClose, this, _1)).setFilter(filterFn);
     _server->on("/i",       std::bind(&ESPAsync_WiFiManager::handleInfo, this, _1)).setFilter(filterFn);
     _server->on("/r",       std::bind(&ESPAsync_WiFiManager::handleReset, this, _1)).setFilter(filterFn);
@@ -830,26 +813,27 @@ void ESPAsync_WiFiManager::scan()
         {
             if (_wifiSSIDscan)
             {
-                /* WE SHOULD MOVE THIS IN PLACE ATOMICALLY */
-                if (_wifiSSIDs)
-                    delete [] _wifiSSIDs;
+                // Built aside and published when complete, /scan responses still streaming keep
+                // their reference to the previous results
+                std::shared_ptr<WiFiScanResults> pResults = std::make_shared<WiFiScanResults>();
+                pResults->pItems.reset(new WiFiResult[n]);
+                pResults->count = n;
 
-                _wifiSSIDs     = new WiFiResult[n];
-                _wifiSSIDCount = n;
+                WiFiResult *pItems = pResults->pItems.get();
 
                 if (n > 0)
                     _shouldscan = false;
 
                 for (wifi_ssid_count_t i = 0; i < n; i++)
                 {
-                    _wifiSSIDs[i].duplicate = false;
+                    pItems[i].duplicate = false;
 
                 #if defined(ESP8266)
-                    WiFi.getNetworkInfo(i, _wifiSSIDs[i].SSID, _wifiSSIDs[i].encryptionType, _wifiSSIDs[i].RSSI, _wifiSSIDs[i].BSSID,
-                                        _wifiSSIDs[i].channel, _wifiSSIDs[i].isHidden);
+                    WiFi.getNetworkInfo(i, pItems[i].SSID, pItems[i].encryptionType, pItems[i].RSSI, pItems[i].BSSID,
+                                        pItems[i].channel, pItems[i].isHidden);
                 #else
-                    WiFi.getNetworkInfo(i, _wifiSSIDs[i].SSID, _wifiSSIDs[i].encryptionType, _wifiSSIDs[i].RSSI, _wifiSSIDs[i].BSSID,
-                                        _wifiSSIDs[i].channel);
+                    WiFi.getNetworkInfo(i, pItems[i].SSID, pItems[i].encryptionType, pItems[i].RSSI, pItems[i].BSSID,
+                                        pItems[i].channel);
                 #endif
                 }
 
@@ -859,9 +843,9 @@ void ESPAsync_WiFiManager::scan()
                 {
                     for (int j = i + 1; j < n; j++)
                     {
-                        if (_wifiSSIDs[j].RSSI > _wifiSSIDs[i].RSSI)
+                        if (pItems[j].RSSI > pItems[i].RSSI)
                         {
-                          std::swap(_wifiSSIDs[i], _wifiSSIDs[j]);
+                          std::swap(pItems[i], pItems[j]);
                         }
                     }
                 }
@@ -873,22 +857,26 @@ void ESPAsync_WiFiManager::scan()
 
                     for (int i = 0; i < n; i++)
                     {
-                        if (_wifiSSIDs[i].duplicate == true)
+                        if (pItems[i].duplicate == true)
                             continue;
 
-                        cssid = _wifiSSIDs[i].SSID;
+                        cssid = pItems[i].SSID;
 
                         for (int j = i + 1; j < n; j++)
                         {
-                            if (cssid == _wifiSSIDs[j].SSID)
+                            if (cssid == pItems[j].SSID)
                             {
-                                LOGDEBUG("DUP AP: " + _wifiSSIDs[j].SSID);
+                                LOGDEBUG("DUP AP: " + pItems[j].SSID);
                                 // set dup aps to NULL
-                                _wifiSSIDs[j].duplicate = true;
+                                pItems[j].duplicate = true;
                             }
                         }
                     }
                 }
+
+                std::atomic_store(&_wifiScanResults, pResults);
+                _wifiSSIDs     = pItems;
+                _wifiSSIDCount = n;
             }
         }
     }
@@ -938,14 +926,31 @@ void ESPAsync_WiFiManager::loop()
 
 //////////////////////////////////////////
 
+// Renders the dynamic parts of the info page when the cached ones are stale
 void ESPAsync_WiFiManager::setInfo()
 {
-    if (_needInfo)
+    if (!_needInfo)
     {
-        _pager       = infoAsString();
-        _wifiStatus  = WiFi.status();
-        _needInfo    = false;
+        return;
     }
+
+    // Cleared first, an event arriving while rendering marks the result stale again
+    _needInfo = false;
+
+    LOGDEBUG(F("setInfo: Rendering info page"));
+
+    _infoStatus = String();
+    reportStatus(_infoStatus);
+
+    _infoSlots[WM_CHIP_INFO_SLOT_CHIPID] = String(ESP_getChipId(), HEX);
+    _infoSlots[WM_CHIP_INFO_SLOT_FLASHID] = String(ESP_getFlashChipId(), HEX);
+    _infoSlots[WM_CHIP_INFO_SLOT_REAL_FLASH_SIZE] = String(ESP_getFlashChipRealSize());
+    _infoSlots[WM_CHIP_INFO_SLOT_IDE_FLASH_SIZE] = String(ESP.getFlashChipSize());
+    _infoSlots[WM_CHIP_INFO_SLOT_APIP] = WiFi.softAPIP().toString();
+    _infoSlots[WM_CHIP_INFO_SLOT_APMAC] = WiFi.softAPmacAddress();
+    _infoSlots[WM_CHIP_INFO_SLOT_SSID] = WiFi_SSID();
+    _infoSlots[WM_CHIP_INFO_SLOT_STAIP] = WiFi.localIP().toString();
+    _infoSlots[WM_CHIP_INFO_SLOT_STAMAC] = WiFi.macAddress();
 }
 
 //////////////////////////////////////////
@@ -1025,31 +1030,151 @@ void ESPAsync_WiFiManager::criticalLoop()
 
 #ifdef WM_REMOTE_UPDATE
 
-static String _jsonExtractString(const String& json, const String& key) {
-    int ki = json.indexOf("\"" + key + "\"");
-    if (ki < 0) return "";
-    int ci = json.indexOf(':', ki);
-    if (ci < 0) return "";
-    int q1 = json.indexOf('"', ci + 1);
-    if (q1 < 0) return "";
-    int q2 = json.indexOf('"', q1 + 1);
-    if (q2 < 0) return "";
-    return json.substring(q1 + 1, q2);
-}
+#ifndef WM_OTA_MANIFEST_FIRMWARES_SIZE
+    // Room for the firmwares object of the manifest (language -> URL)
+    #define WM_OTA_MANIFEST_FIRMWARES_SIZE      1024
+#endif
 
-static String _jsonExtractObject(const String& json, const String& key) {
-    int ki = json.indexOf("\"" + key + "\"");
-    if (ki < 0) return "{}";
-    int ob = json.indexOf('{', ki);
-    if (ob < 0) return "{}";
-    int depth = 0, i = ob;
-    for (; i < (int)json.length(); ++i) {
-        if      (json[i] == '{') ++depth;
-        else if (json[i] == '}') { if (--depth == 0) break; }
+// Picks hwid, version and firmwares out of the remote OTA manifest while it is downloaded, the
+// document itself is never buffered. Only members of the top level object count. firmwares is
+// rewritten as an object of strings, other values in it become null.
+class OTAManifestParser : public JSONUtils::JSONTokenizer
+{
+public:
+    OTAManifestParser()
+        : JSONUtils::JSONTokenizer(_value, sizeof(_value)),
+          _firmwaresBuffer(_firmwares, sizeof(_firmwares)), _firmwaresWriter(_firmwaresBuffer)
+    {
+        hwid[0] = 0;
+        version[0] = 0;
     }
-    return json.substring(ob, i + 1);
-}
 
+    // Complete, and nothing had to be cut
+    bool valid() const { return complete() && !_overflow && !_firmwaresBuffer.overflow(); }
+    const char* firmwares() const { return (_firmwaresBuffer.length() > 0) ? _firmwaresBuffer.c_str() : "{}"; }
+    // At least one firmware is listed
+    bool hasFirmwares() const { return _firmwaresBuffer.length() > 2; }
+
+    char hwid[65];
+    char version[33];
+
+protected:
+    void token(Token token, const char* pValue, size_t length) override
+    {
+        if (!_inFirmwares && token == TokenObjectStart && depth() == 2 && _member == MemberFirmwares)
+        {
+            _inFirmwares = true;
+            _firmwaresBuffer.clear();
+        }
+
+        if (_inFirmwares)
+        {
+            firmwaresToken(token, pValue);
+            return;
+        }
+
+        if (depth() != 1)
+        {
+            return;
+        }
+
+        switch (token)
+        {
+            case TokenKey:
+                _member = (strcmp_P(pValue, PSTR("hwid")) == 0) ? MemberHwid
+                        : (strcmp_P(pValue, PSTR("version")) == 0) ? MemberVersion
+                        : (strcmp_P(pValue, PSTR("firmwares")) == 0) ? MemberFirmwares
+                        : MemberOther;
+                break;
+
+            case TokenString:
+                if (_member == MemberHwid)
+                {
+                    copy(hwid, sizeof(hwid), pValue, length);
+                }
+                else if (_member == MemberVersion)
+                {
+                    copy(version, sizeof(version), pValue, length);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+private:
+    enum Member : uint8_t { MemberOther, MemberHwid, MemberVersion, MemberFirmwares };
+
+    // depth() is 2 for the members of firmwares, deeper values are replaced by null
+    void firmwaresToken(Token token, const char* pValue)
+    {
+        switch (token)
+        {
+            case TokenObjectStart:
+            case TokenArrayStart:
+                if (depth() == 2)
+                {
+                    _firmwaresWriter.BeginObject();
+                }
+                else if (depth() == 3)
+                {
+                    _firmwaresWriter.Null();
+                }
+                break;
+
+            case TokenObjectEnd:
+            case TokenArrayEnd:
+                if (depth() == 1)
+                {
+                    _firmwaresWriter.EndObject();
+                    _inFirmwares = false;
+                }
+                break;
+
+            case TokenKey:
+                if (depth() == 2)
+                {
+                    _firmwaresWriter.Key(pValue);
+                }
+                break;
+
+            case TokenString:
+                if (depth() == 2)
+                {
+                    _firmwaresWriter.Value(pValue);
+                }
+                break;
+
+            default:
+                if (depth() == 2)
+                {
+                    _firmwaresWriter.Null();
+                }
+                break;
+        }
+    }
+
+    void copy(char* pTarget, size_t size, const char* pValue, size_t length)
+    {
+        if (length >= size)
+        {
+            _overflow = true;
+            length = size - 1;
+        }
+        memcpy(pTarget, pValue, length);
+        pTarget[length] = 0;
+    }
+
+private:
+    char                    _value[256];
+    char                    _firmwares[WM_OTA_MANIFEST_FIRMWARES_SIZE];
+    JSONUtils::JSONBuffer   _firmwaresBuffer;
+    JSONUtils::JSONWriter   _firmwaresWriter;
+    Member                  _member = MemberOther;
+    bool                    _inFirmwares = false;
+    bool                    _overflow = false;
+};
 
 void ESPAsync_WiFiManager::handleOTARemoteCheck(AsyncWebServerRequest *request) {
     if (!request->hasArg("url")) {
@@ -1070,36 +1195,50 @@ void ESPAsync_WiFiManager::handleOTARemoteCheck(AsyncWebServerRequest *request)
             "{\"error\":\"HTTP " + String(code) + "\"}");
         return;
     }
-    String body = http.getString();
+
+    // Parsed while it is read, the memory used doesn't depend on the size of the manifest
+    std::unique_ptr<OTAManifestParser> pManifest(new OTAManifestParser());
+    http.writeToStream(pManifest.get());
     http.end();
+    pManifest->finish();
 
-    String remHwid   = _jsonExtractString(body, "hwid");
-    String localHwid = (_hardwareId != nullptr) ? String(FPSTR(_hardwareId)) : String("");
-    if (localHwid.length() > 0 && remHwid != localHwid) {
-        ESPAsync_WiFiManagerUtils::responseApplJson(request,
-            "{\"error\":\"Hardware ID mismatch\","
-            "\"remote\":\"" + remHwid + "\","
-            "\"local\":\"" + localHwid + "\"}");
+    AsyncResponseStream *pResponse = ESPAsync_WiFiManagerUtils::beginApplJson(request);
+    JSONUtils::JSONWriter json(*pResponse);
+
+    if (!pManifest->valid()) {
+        json.BeginObject().Pair(F("error"), F("Invalid manifest")).EndObject();
+        ESPAsync_WiFiManagerUtils::sendApplJson(request, pResponse);
         return;
     }
 
-    String remVerStr       = _jsonExtractString(body, "version");
-    SemanticVersion remVer = SemanticVersion::fromString(remVerStr);
+    if (_hardwareId != nullptr && strlen_P(_hardwareId) > 0 && strcmp_P(pManifest->hwid, _hardwareId) != 0) {
+        json.BeginObject()
+            .Pair(F("error"), F("Hardware ID mismatch"))
+            .Pair(F("remote"), pManifest->hwid)
+            .Pair(F("local"), FPSTR(_hardwareId))
+            .EndObject();
+        ESPAsync_WiFiManagerUtils::sendApplJson(request, pResponse);
+        return;
+    }
+
+    SemanticVersion remVer   = SemanticVersion::fromString(pManifest->version);
     SemanticVersion localVer = { SW_MAJOR_VERSION, SW_MINOR_VERSION, SW_PATCH_VERSION };
-    String fwJson          = _jsonExtractObject(body, "firmwares");
-    bool isNewer           = (remVer > localVer);
-    bool isSameVer         = (remVerStr == F(IOT_SW_VERSION_STRING));
-    bool canSwitch         = isSameVer && (fwJson.length() > 2);
+    bool isNewer             = (remVer > localVer);
+    bool isSameVer           = (strcmp_P(pManifest->version, PSTR(IOT_SW_VERSION_STRING)) == 0);
+    bool canSwitch           = isSameVer && pManifest->hasFirmwares();
 
-    ESPAsync_WiFiManagerUtils::responseApplJson(request,
-        "{\"available\":"  + String(isNewer   ? "true" : "false") +
-        ",\"canSwitch\":"  + String(canSwitch ? "true" : "false") +
-        ",\"version\":\""  + remVerStr + "\"" +
-        ",\"current\":\""  IOT_SW_VERSION_STRING "\"" +
-        ",\"lang\":\""     IOT_LANGUAGE_STRING "\"" +
-        ",\"firmwares\":"  + fwJson + "}");
+    json.BeginObject()
+        .Pair(F("available"), isNewer)
+        .Pair(F("canSwitch"), canSwitch)
+        .Pair(F("version"), pManifest->version)
+        .Pair(F("current"), F(IOT_SW_VERSION_STRING))
+        .Pair(F("lang"), F(IOT_LANGUAGE_STRING))
+        .Key(F("firmwares")).RawValue(pManifest->firmwares())
+        .EndObject();
+    ESPAsync_WiFiManagerUtils::sendApplJson(request, pResponse);
 }
 
+
 void ESPAsync_WiFiManager::handleOTARemoteStart(AsyncWebServerRequest *request) {
     if (!request->hasArg("url")) {
         request->send(400, "text/plain", "Missing url");
@@ -1588,6 +1727,8 @@ void ESPAsync_WiFiManager::resetSettings()
 {
     LOGINFO(F("Previous settings invalidated"));
 
+    _needInfo = true;
+
 #ifdef ESP8266
     WiFi.disconnect(true);
 #else
@@ -1806,25 +1947,97 @@ void ESPAsync_WiFiManager::handleRoot(AsyncWebServerRequest *pRequest)
     ESPAsync_WiFiManagerUtils::responseText(pRequest, &gIndexHtml);
 }
 
+#ifndef WM_WIFISAVE_JSON_MAX_LENGTH
+    // Longest JSON body accepted by /wifisave, the parsed document takes a few times more while it is read
+    #define WM_WIFISAVE_JSON_MAX_LENGTH     1024
+#endif
+
+// Collects a JSON body (Content-Type: application/json) of /wifisave. A form body is parsed into
+// the arguments by the server and never gets here. The server frees _tempObject with the request.
+void ESPAsync_WiFiManager::handleWiFiSaveBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+    size_t index, size_t total)
+{
+    if (index == 0 && total <= WM_WIFISAVE_JSON_MAX_LENGTH)
+    {
+        request->_tempObject = malloc(total + 1);
+    }
+
+    if (request->_tempObject != nullptr && index + len <= total)
+    {
+        char *pBody = static_cast<char *>(request->_tempObject);
+        memcpy(pBody + index, data, len);
+        pBody[index + len] = 0;
+    }
+}
+
 // Handle the WLAN save form and redirect to WLAN config page again
 inline void ESPAsync_WiFiManager::handleWiFiSave(AsyncWebServerRequest *request)
 {
     LOGDEBUG(F("ESPAsync_WiFiManager::handleWiFiSave"));
 
+    // The fields come either as form arguments, or as members of a JSON object with the same names
+    const char *pBody = static_cast<const char *>(request->_tempObject);
+    EasyJSONDocument json(pBody ? EasyJSONDocument::capacityFor(pBody, strlen(pBody)) : 0);
+
+    if (pBody == nullptr && request->contentType().startsWith(FPSTR(WM_HTTP_HEAD_CT_JSON)))
+    {
+        // An empty body never reaches handleWiFiSaveBody()
+        if (request->contentLength() == 0)
+        {
+            LOGDEBUG(F("ESPAsync_WiFiManager::handleWiFiSave: Empty JSON body"));
+            request->send(400, WM_HTTP_HEAD_CT_TEXT_PLAIN, F("Empty JSON body"));
+            return;
+        }
+
+        // Longer than WM_WIFISAVE_JSON_MAX_LENGTH, or no memory to keep it
+        LOGDEBUG(F("ESPAsync_WiFiManager::handleWiFiSave: JSON body not kept"));
+        request->send(413, WM_HTTP_HEAD_CT_TEXT_PLAIN, F("JSON body too long"));
+        return;
+    }
+
+    if (pBody != nullptr && (!json.parse(pBody) || json.root().getType() != EasyJSONVariant::OBJECT))
+    {
+        LOGDEBUG(F("ESPAsync_WiFiManager::handleWiFiSave: Invalid JSON"));
+        request->send(400, WM_HTTP_HEAD_CT_TEXT_PLAIN, F("Invalid JSON"));
+        return;
+    }
+
+    auto hasArg = [&](const char *pName) -> bool
+    {
+        return pBody ? json.root()[pName].isDefined() : request->hasArg(pName);
+    };
+
+    auto arg = [&](const char *pName) -> String
+    {
+        if (pBody == nullptr)
+        {
+            return request->arg(pName);
+        }
+
+        EasyJSONVariant value = json.root()[pName];
+        switch (value.getType())
+        {
+            case EasyJSONVariant::STRING:       return String(value.asString());
+            case EasyJSONVariant::UNDEFINED:
+            case EasyJSONVariant::NULLTYPE:     return String();
+            default:                            return value.toString();
+        }
+    };
+
     //SAVE/_connect here
-    _ssid = request->arg("ssid1").c_str();
-    _pass = request->arg("pwd1").c_str();
+    _ssid = arg("ssid1").c_str();
+    _pass = arg("pwd1").c_str();
 
-    _ssid1 = request->arg("ssid2").c_str();
-    _pass1 = request->arg("pwd2").c_str();
+    _ssid1 = arg("ssid2").c_str();
+    _pass1 = arg("pwd2").c_str();
 
     ///////////////////////
 
 #if USE_ESP_WIFIMANAGER_NTP
 
-    if (request->hasArg("timezone"))
+    if (hasArg("timezone"))
     {
-        _timezoneName = request->arg("timezone");   //.c_str();
+        _timezoneName = arg("timezone");   //.c_str();
 
         LOGDEBUG1(F("TZ ="), _timezoneName);
     }
@@ -1846,7 +2059,7 @@ inline void ESPAsync_WiFiManager::handleWiFiSave(AsyncWebServerRequest *request)
         }
 
         //read parameter
-        String value = request->arg(_params[i]->getID()).c_str();
+        String value = arg(_params[i]->getID()).c_str();
 
         //store it in array
         value.toCharArray(_params[i]->_WMParam_data._value, _params[i]->_WMParam_data._length);
@@ -1854,27 +2067,27 @@ inline void ESPAsync_WiFiManager::handleWiFiSave(AsyncWebServerRequest *request)
         LOGDEBUG2(F("Parameter and value :"), _params[i]->getID(), value);
     }
 
-    if (request->hasArg("staticip1"))
+    if (hasArg("staticip1"))
     {
-        String ip = request->arg("staticip1");
+        String ip = arg("staticip1");
 
         optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_ip, ip.c_str());
 
         LOGDEBUG1(F("New Static IP ="), _WiFi_STA_IPconfig._sta_static_ip.toString());
     }
 
-    if (request->hasArg("staticgw1"))
+    if (hasArg("staticgw1"))
     {
-        String gw = request->arg("staticgw1");
+        String gw = arg("staticgw1");
 
         optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_gw, gw.c_str());
 
         LOGDEBUG1(F("New Static Gateway ="), _WiFi_STA_IPconfig._sta_static_gw.toString());
     }
 
-    if (request->hasArg("staticsubnet1"))
+    if (hasArg("staticsubnet1"))
     {
-        String sn = request->arg("staticsubnet1");
+        String sn = arg("staticsubnet1");
 
         optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_sn, sn.c_str());
 
@@ -1884,18 +2097,18 @@ inline void ESPAsync_WiFiManager::handleWiFiSave(AsyncWebServerRequest *request)
 #if USE_CONFIGURABLE_DNS
 
     //*****  Added for DNS Options *****
-    if (request->hasArg("dns1"))
+    if (hasArg("dns1"))
     {
-        String dns1 = request->arg("dns1");
+        String dns1 = arg("dns1");
 
         optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_dns1, dns1.c_str());
 
         LOGDEBUG1(F("New Static DNS1 ="), _WiFi_STA_IPconfig._sta_static_dns1.toString());
     }
 
-    if (request->hasArg("dns2"))
+    if (hasArg("dns2"))
     {
-        String dns2 = request->arg("dns2");
+        String dns2 = arg("dns2");
 
         optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_dns2, dns2.c_str());
 
@@ -1905,27 +2118,26 @@ inline void ESPAsync_WiFiManager::handleWiFiSave(AsyncWebServerRequest *request)
     //*****  End added for DNS Options *****
 #endif
 
-    String body(FPSTR(WM_PK_HTTP_SAVED));
-    body.replace("%{v}%", _apName);
-    body.replace("%{x}%", _ssid);
-    body.replace("%{x1}%", _ssid1);
+    String slots[WM_SAVED_SLOT_COUNT];
+    slots[WM_SAVED_SLOT_V] = _apName;
+    slots[WM_SAVED_SLOT_X] = _ssid;
+    slots[WM_SAVED_SLOT_X1] = _ssid1;
 
-    String page;
-    buildHtmlPage(page,
+    auto pPage = std::make_shared<HTTPTemplateStream>();
+    beginHtmlPage(*pPage,
         FPSTR(WM_PK_HTTP_CREDENTIAL_SAVED_MSG),
         FPSTR(WM_PK_HTTP_WM_SCRIPT),
         FPSTR(WM_PK_HTTP_STYLE),
         _customHeadElement,
-        "",
-        body,
-        "");
-
+        nullptr);
+    pPage->add(WM_PK_HTTP_SAVED, slots);
+    endHtmlPage(*pPage);
 
-    //LOGDEBUG1(F("page ="), page);
-    ESPAsync_WiFiManagerUtils::responseTextHtml(request, page);
+    ESPAsync_WiFiManagerUtils::responseTemplate(request, FPSTR(WM_HTTP_HEAD_CT_TEXT_HTML), pPage, &gDynamicHTMLHeaders);
     LOGDEBUG(F("Sent wifi save page"));
 
     _connect = true; //signal ready to _connect/reset
+    _needInfo = true;
 }
 
 //////////////////////////////////////////
@@ -1935,23 +2147,24 @@ inline void ESPAsync_WiFiManager::handleServerClose(AsyncWebServerRequest *reque
 {
     LOGDEBUG(F("Server Close"));
 
-    String body(FPSTR(WM_PK_HTTP_NETWORK_INFO));
-    body.replace("%{ssid}%", WiFi_SSID());
-    body.replace("%{ip}%", WiFi.localIP().toString());
+    String slots[WM_NETWORK_INFO_SLOT_COUNT];
+    slots[WM_NETWORK_INFO_SLOT_SSID] = WiFi_SSID();
+    slots[WM_NETWORK_INFO_SLOT_IP] = WiFi.localIP().toString();
+
+    auto pPage = std::make_shared<HTTPTemplateStream>();
 
     //body += F("Push button on device to restart configuration _server!");
 
-    String page;
-    buildHtmlPage(page,
+    beginHtmlPage(*pPage,
         FPSTR(WM_PK_HTTP_CLOSE_SERVER_MSG),
         FPSTR(WM_PK_HTTP_WM_SCRIPT),
         FPSTR(WM_PK_HTTP_STYLE),
         _customHeadElement,
-        "",
-        body,
-        "");
+        nullptr);
+    pPage->add(WM_PK_HTTP_NETWORK_INFO, slots);
+    endHtmlPage(*pPage);
 
-    ESPAsync_WiFiManagerUtils::responseTextHtml(request, page);
+    ESPAsync_WiFiManagerUtils::responseTemplate(request, FPSTR(WM_HTTP_HEAD_CT_TEXT_HTML), pPage, &gDynamicHTMLHeaders);
 
     _stopConfigPortal = true; //signal ready to shutdown config portal
 
@@ -1973,79 +2186,22 @@ void ESPAsync_WiFiManager::handleInfo(AsyncWebServerRequest *request)
     if (_connect)
         customHeadElem += F("<meta http-equiv=\"refresh\" content=\"5; url=/i\">");
 
-    String customBlock(F("<dl>"));
-
-    if (_connect)
-    {
-        customBlock += F("<dt>Trying to connect</dt><dd>");
-        customBlock += _wifiStatus;
-        customBlock += F("</dd>");
-    }
+    setInfo();
 
-    customBlock += _pager;
-
-
-    String body;
-    reportStatus(body);
-
-#ifdef ESP8266
-    body += FPSTR(WM_PK_HTTP_CHIP_INFO_ESP8266);
-#else
-    body += FPSTR(WM_PK_HTTP_CHIP_INFO_ESP32);
-#endif
+    auto pPage = std::make_shared<HTTPTemplateStream>();
 
-#ifdef ESP8266
-    body.replace("%{chipid}%", String(ESP.getChipId(), HEX));
-#else   //ESP32
-    body.replace("%{chipid}%", String(ESP_getChipId(), HEX));
-
-    /*
-    page += F("<tr><td>Chip OUI</td><td>");
-    page += F("0x");
-    page += String(getChipOUI(), HEX);
-    page += F("</td></tr>");
-
-    page += F("<tr><td>Chip Model</td><td>");
-    page += ESP.getChipModel();
-    page += F(" Rev");
-    page += ESP.getChipRevision();
-    */
-#endif
-
-
-#ifdef ESP8266
-    body.replace("%{flashid}%", String(ESP.getFlashChipId(), HEX));
-#else   //ESP32
-    // TODO
-#endif
-
-    body.replace("%{ideFlashSize}%", String(ESP.getFlashChipSize()));
- 
-#ifdef ESP8266
-    body.replace("%{realFlashSize}%", String(ESP.getFlashChipRealSize()));
-#else   //ESP32
-    // TODO
-#endif
-
-    body.replace("%{apip}%", WiFi.softAPIP().toString());
-    body.replace("%{apmac}%", WiFi.softAPmacAddress());
-
-    body.replace("%{ssid}%", WiFi_SSID());
-    body.replace("%{staip}%", WiFi.localIP().toString());
-
-    body.replace("%{stamac}%",  WiFi.macAddress());
-
-    String page;
-    buildHtmlPage(page,
+    beginHtmlPage(*pPage,
         FPSTR(WM_PK_HTTP_INFO_MSG),
         FPSTR(WM_PK_HTTP_WM_SCRIPT),
         FPSTR(WM_PK_HTTP_STYLE),
         customHeadElem,
         FPSTR(WM_PK_HTTP_DEVICE_INFO_MSG),
-        body,
-        WM_HTTP_SCRIPT_NTP);
+        FPSTR(WM_HTTP_SCRIPT_NTP));
+    pPage->add(_infoStatus);
+    pPage->add(WM_PK_HTTP_CHIP_INFO, _infoSlots);
+    endHtmlPage(*pPage);
 
-    ESPAsync_WiFiManagerUtils::responseTextHtml(request, page);
+    ESPAsync_WiFiManagerUtils::responseTemplate(request, FPSTR(WM_HTTP_HEAD_CT_TEXT_HTML), pPage, &gDynamicHTMLHeaders);
 
     LOGDEBUG(F("Info page sent"));
 }
@@ -2063,60 +2219,274 @@ inline void ESPAsync_WiFiManager::handleSystemQuery(AsyncWebServerRequest *reque
         return;
     }
 
-    String page;
+    // Written straight into the response, no intermediate Strings
+    AsyncResponseStream *pResponse = ESPAsync_WiFiManagerUtils::beginApplJson(request);
+    JSONUtils::JSONWriter json(*pResponse);
 
     if (request->hasArg("dx"))
     {
-        String dx = request->arg("dx");
-
-        if (dx == "status")
-        {
-            page = JSONUtils::EncloseObject(
-                JSONUtils::Pair(F("Soft_AP_IP"),  WiFi.softAPIP().toString(), true) +
-                JSONUtils::Pair(F("Soft_AP_MAC"), WiFi.softAPmacAddress()) +
-                JSONUtils::Pair(F("Station_IP"), WiFi.localIP().toString()) +
-                JSONUtils::Pair(F("Station_MAC"), WiFi.macAddress()) +
-                JSONUtils::Pair(F("SSID"), WiFi_SSID()) +
-                JSONUtils::Pair(F("Password"), (WiFi.psk() != "") ? true : false));
-        }
-        else if(dx == "hwinfo")
-        {
-            page = JSONUtils::EncloseArray(
-            #ifdef ESP8266
-                JSONUtils::NameValueRow(F("Chip ID"), String(ESP.getFlashChipId(), HEX), true) +
-                JSONUtils::NameValueRow(F("IDE Flash Size"), ESP.getFlashChipSize()) +
-                JSONUtils::NameValueRow(F("Real Flash Size"), ESP.getFlashChipRealSize()) +
-            #else
-                // TODO
-                JSONUtils::NameValueRow(F("Chip ID"), "---", true) +
-                JSONUtils::NameValueRow(F("IDE Flash Size"), ESP.getFlashChipSize()) +
-                // TODO
-                JSONUtils::NameValueRow(F("Real Flash Size"), "---") +
-            #endif
+        const String& dx = request->arg("dx");
 
-                JSONUtils::NameValueRow(F("Access Point IP"), WiFi.softAPIP().toString()) +
-                JSONUtils::NameValueRow(F("Access Point MAC"), WiFi.softAPmacAddress()) +
-                JSONUtils::NameValueRow(F("SSID"), WiFi_SSID()) +
-                JSONUtils::NameValueRow(F("Station IP"), WiFi.localIP().toString()) +
-                JSONUtils::NameValueRow(F("Station MAC"), WiFi.macAddress()));
+        // A single name is answered with its result, a list with an object keyed by name (WM_SYSTEM_QUERY_NAME_MAX)
+        if (dx.indexOf(',') < 0)
+        {
+            if (!writeSystemQuery(json, request, dx.c_str()))
+            {
+                json.BeginObject().EndObject();
+            }
         }
         else
         {
-            LOGDEBUG(F("ESPAsync_WiFiManager::handleSystemQuery: Unsupported value of parameter dx"));
-            page = JSONUtils::EncloseObject("");
+            // dx=fwinfo,hwinfo,status: one object keyed by dx, the answers streamed in turn
+            char name[WM_SYSTEM_QUERY_NAME_MAX + 1];
+
+            json.BeginObject();
+
+            for (const char *pNames = dx.c_str(); *pNames != '\0'; )
+            {
+                size_t length = strcspn(pNames, ",");
+
+                if (length > 0 && length <= WM_SYSTEM_QUERY_NAME_MAX)
+                {
+                    memcpy(name, pNames, length);
+                    name[length] = '\0';
+
+                    json.Key(name);
+
+                    if (!writeSystemQuery(json, request, name))
+                    {
+                        json.Null();
+                    }
+                }
+
+                pNames += length;
+                if (*pNames == ',')
+                {
+                    pNames++;
+                }
+            }
+
+            json.EndObject();
         }
     }
     else
     {
-        page = JSONUtils::EncloseObject(JSONUtils::Pair(F("Error"), F("DX argument missing."), true));
+        json.BeginObject().Pair(F("Error"), F("DX argument missing.")).EndObject();
     }
 
+    ESPAsync_WiFiManagerUtils::sendApplJson(request, pResponse);
+}
 
-    ESPAsync_WiFiManagerUtils::responseApplJson(request, page);
+//////////////////////////////////////////
+
+bool ESPAsync_WiFiManager::addSystemQuery(uint32_t dxHash, WMSystemQueryProvider provider)
+{
+    // Linear probing from the home slot, a provider with the same hash is replaced
+    for (uint32_t i = 0; i < WM_SYSTEM_QUERY_SLOTS; i++)
+    {
+        WMSystemQueryEntry& entry = _systemQueries[(dxHash + i) & (WM_SYSTEM_QUERY_SLOTS - 1)];
+
+        if (!entry.provider || entry.hash == dxHash)
+        {
+            entry.hash = dxHash;
+            entry.provider = provider;
+            return true;
+        }
+    }
+
+    LOGERROR(F("addSystemQuery: Provider table full, increase WM_SYSTEM_QUERY_SLOTS"));
+    return false;
 }
 
 //////////////////////////////////////////
 
+// Writes the answer of the provider of pName, false if there is none
+bool ESPAsync_WiFiManager::writeSystemQuery(JSONUtils::JSONWriter& json, AsyncWebServerRequest *request, const char *pName)
+{
+    const WMSystemQueryProvider *pProvider = findSystemQuery(
+        ESPAsync_WiFiManagerUtils::HashPath(pName, ESPAsync_WiFiManagerUtils::FNV1A_OFFSET_BASIS));
+
+    if (pProvider == nullptr)
+    {
+        LOGDEBUG1(F("ESPAsync_WiFiManager::handleSystemQuery: Unsupported value of parameter dx"), pName);
+        return false;
+    }
+
+    (*pProvider)(json, request);
+    return true;
+}
+
+//////////////////////////////////////////
+
+const WMSystemQueryProvider* ESPAsync_WiFiManager::findSystemQuery(uint32_t dxHash) const
+{
+    for (uint32_t i = 0; i < WM_SYSTEM_QUERY_SLOTS; i++)
+    {
+        const WMSystemQueryEntry& entry = _systemQueries[(dxHash + i) & (WM_SYSTEM_QUERY_SLOTS - 1)];
+
+        if (!entry.provider)
+        {
+            return nullptr;
+        }
+
+        if (entry.hash == dxHash)
+        {
+            return &entry.provider;
+        }
+    }
+
+    return nullptr;
+}
+
+//////////////////////////////////////////
+
+void ESPAsync_WiFiManager::addBuiltinSystemQueries()
+{
+    // Lambdas capturing only this fit in std::function without a heap allocation
+    addSystemQuery(WM_SYSTEM_QUERY("status"), [this](JSONUtils::JSONWriter& json, AsyncWebServerRequest*)
+        { querySystemStatus(json); });
+    addSystemQuery(WM_SYSTEM_QUERY("hwinfo"), [this](JSONUtils::JSONWriter& json, AsyncWebServerRequest*)
+        { queryHardwareInfo(json); });
+    addSystemQuery(WM_SYSTEM_QUERY("fwinfo"), [this](JSONUtils::JSONWriter& json, AsyncWebServerRequest*)
+        { queryFirmwareInfo(json); });
+    addSystemQuery(WM_SYSTEM_QUERY("hwid"), [this](JSONUtils::JSONWriter& json, AsyncWebServerRequest*)
+        { queryHardwareId(json); });
+    addSystemQuery(WM_SYSTEM_QUERY("hwstatus"), [this](JSONUtils::JSONWriter& json, AsyncWebServerRequest*)
+        { queryHardwareStatus(json); });
+    addSystemQuery(WM_SYSTEM_QUERY("wifi"), [this](JSONUtils::JSONWriter& json, AsyncWebServerRequest*)
+        { queryWiFi(json); });
+#if defined(WM_SUPPORT_HOME_ASSISTANT) || WM_SUPPORT_MQTT
+    addSystemQuery(WM_SYSTEM_QUERY("mqtt"), [this](JSONUtils::JSONWriter& json, AsyncWebServerRequest*)
+        { queryMQTT(json); });
+#endif
+}
+
+//////////////////////////////////////////
+
+// dx=status
+void ESPAsync_WiFiManager::querySystemStatus(JSONUtils::JSONWriter& json)
+{
+    uint8_t mac[6];
+
+    json.BeginObject();
+    json.Pair(F("Soft_AP_IP"), WiFi.softAPIP());
+    json.Key(F("Soft_AP_MAC")).MacValue(WiFi.softAPmacAddress(mac));
+    json.Pair(F("Station_IP"), WiFi.localIP());
+    json.Key(F("Station_MAC")).MacValue(WiFi.macAddress(mac));
+    json.Pair(F("SSID"), WiFi_SSID());
+    json.Pair(F("Password"), (WiFi.psk() != "") ? true : false);
+    json.EndObject();
+}
+
+//////////////////////////////////////////
+
+// dx=hwinfo, name/value rows of the info page
+void ESPAsync_WiFiManager::queryHardwareInfo(JSONUtils::JSONWriter& json)
+{
+    uint8_t mac[6];
+
+    json.BeginArray();
+    json.BeginObject().Pair(F("name"), F("Chip ID")).Key(F("value")).HexValue(ESP_getFlashChipId()).EndObject();
+    json.NameValueRow(F("IDE Flash Size"), ESP.getFlashChipSize());
+    json.NameValueRow(F("Real Flash Size"), ESP_getFlashChipRealSize());
+
+    json.NameValueRow(F("Access Point IP"), WiFi.softAPIP());
+    json.BeginObject().Pair(F("name"), F("Access Point MAC")).Key(F("value")).MacValue(WiFi.softAPmacAddress(mac)).EndObject();
+    json.NameValueRow(F("SSID"), WiFi_SSID());
+    json.NameValueRow(F("Station IP"), WiFi.localIP());
+    json.BeginObject().Pair(F("name"), F("Station MAC")).Key(F("value")).MacValue(WiFi.macAddress(mac)).EndObject();
+    json.EndArray();
+}
+
+//////////////////////////////////////////
+
+// dx=fwinfo, name/value rows of the info page
+void ESPAsync_WiFiManager::queryFirmwareInfo(JSONUtils::JSONWriter& json)
+{
+    json.BeginArray();
+    json.NameValueRow(F("Firmware Version"), F(IOT_SW_VERSION_STRING));
+    json.NameValueRow(F("Language"), F(IOT_LANGUAGE_STRING));
+    json.NameValueRow(F("Build"), F(__DATE__ " " __TIME__));
+    json.NameValueRow(F("Library"), F(ESP_ASYNC_WIFIMANAGER_VERSION));
+#ifdef ESP8266
+    json.NameValueRow(F("Core Version"), ESP.getCoreVersion());
+#endif
+    json.NameValueRow(F("SDK Version"), ESP.getSdkVersion());
+    json.NameValueRow(F("Sketch Size"), ESP.getSketchSize());
+    json.NameValueRow(F("Free Sketch Space"), ESP.getFreeSketchSpace());
+    json.EndArray();
+}
+
+//////////////////////////////////////////
+
+// dx=hwid, checked by the OTA page against the ID of the uploaded firmware
+void ESPAsync_WiFiManager::queryHardwareId(JSONUtils::JSONWriter& json)
+{
+    json.BeginObject().Key(F("hwid"));
+
+    if (_hardwareId != nullptr)
+    {
+        json.Value(FPSTR(_hardwareId));
+    }
+    else
+    {
+        json.Null();
+    }
+
+    json.EndObject();
+}
+
+//////////////////////////////////////////
+
+// dx=hwstatus, name/value/unit rows polled by the main page
+void ESPAsync_WiFiManager::queryHardwareStatus(JSONUtils::JSONWriter& json)
+{
+    json.BeginArray();
+    json.NameValueUnitRow(F("Uptime"), millis() / 1000, F("s"));
+    json.NameValueUnitRow(F("Free Heap"), ESP.getFreeHeap(), F("B"));
+
+    if (WiFi.status() == WL_CONNECTED)
+    {
+        json.NameValueUnitRow(F("WiFi Signal"), WiFi.RSSI(), F("dBm"));
+    }
+
+    json.EndArray();
+}
+
+//////////////////////////////////////////
+
+// dx=wifi, keyed by the ids of the WiFi form inputs
+void ESPAsync_WiFiManager::queryWiFi(JSONUtils::JSONWriter& json)
+{
+    json.BeginObject();
+    json.Pair(F("ssid1"), (_ssid.length() > 0) ? _ssid : WiFi_SSID());
+    json.Pair(F("ssid2"), _ssid1);
+#if DISPLAY_STORED_CREDENTIALS_IN_CP
+    json.Pair(F("pwd1"), (_ssid.length() > 0) ? _pass : WiFi_Pass());
+    json.Pair(F("pwd2"), _pass1);
+#endif
+    json.EndObject();
+}
+
+//////////////////////////////////////////
+
+#if defined(WM_SUPPORT_HOME_ASSISTANT) || WM_SUPPORT_MQTT
+// dx=mqtt, keyed by the ids of the MQTT form inputs
+void ESPAsync_WiFiManager::queryMQTT(JSONUtils::JSONWriter& json)
+{
+    json.BeginObject();
+    json.Pair(F("host"), _mqttHost);
+    json.Pair(F("port"), (unsigned int) _mqttPort);
+    json.Pair(F("user"), _mqttUser);
+#if DISPLAY_STORED_CREDENTIALS_IN_CP
+    json.Pair(F("pwd"), _mqttPass);
+#endif
+    json.EndObject();
+}
+#endif
+
+//////////////////////////////////////////
+
 /** Handle the scan page */
 void ESPAsync_WiFiManager::handleScan(AsyncWebServerRequest *request)
 {
@@ -2127,62 +2497,121 @@ void ESPAsync_WiFiManager::handleScan(AsyncWebServerRequest *request)
 
     LOGDEBUG(F("Scan-Json"));
 
-     String jsonStr;
-    // KH, display networks in page using previously scan results
-    for (int i = 0; i < _wifiSSIDCount; i++)
-    {
-        if (_wifiSSIDs[i].duplicate == true)
-            continue; // skip dups
+    // Streamed in chunks, one access point serialized at a time from the results of the last scan
+    std::shared_ptr<WiFiScanJsonState> pState = std::make_shared<WiFiScanJsonState>();
+    pState->pResults       = std::atomic_load(&_wifiScanResults);
+    pState->count          = pState->pResults ? pState->pResults->count : 0;
+    pState->minimumQuality = _minimumQuality;
 
-        LOGDEBUG1(F("Index ="), i);
-        LOGDEBUG1(F("SSID ="), _wifiSSIDs[i].SSID);
-        LOGDEBUG1(F("RSSI ="), _wifiSSIDs[i].RSSI);
+    AsyncWebServerResponse *pResponse = request->beginChunkedResponse(WM_HTTP_HEAD_CT_JSON,
+        [this, pState](uint8_t *pBuffer, size_t maxLen, size_t index) -> size_t
+        {
+            return fillScanJson(*pState, pBuffer, maxLen);
+        });
 
-        int quality = getRSSIasQuality(_wifiSSIDs[i].RSSI);
+    ESPAsync_WiFiManagerUtils::addApplJsonHeaders(pResponse);
+    ESPAsync_WiFiManagerUtils::sendApplJson(request, pResponse);
 
-        if (_minimumQuality == -1 || _minimumQuality < quality)
+    LOGDEBUG(F("Sent WiFiScan Data in Json format"));
+}
+
+//////////////////////////////////////////
+
+size_t ESPAsync_WiFiManager::fillScanJson(WiFiScanJsonState& state, uint8_t *pBuffer, size_t maxLen)
+{
+    size_t written = 0;
+
+    while (written < maxLen)
+    {
+        if (state.offset == state.length && !nextScanJsonItem(state))
         {
-            // {\"SSID\":\"%{v}%\", \"Encryption\":%{i}%, \"Quality\":\"%{r}%\"}
-            String item = FPSTR(WM_PK_JSON_ITEM);
-            String rssiQ;
+            break;
+        }
 
-            rssiQ += quality;
-            bool encryption = false;
+        size_t size = std::min(state.length - state.offset, maxLen - written);
+        memcpy(pBuffer + written, state.pending + state.offset, size);
+        state.offset += size;
+        written += size;
+    }
 
-        #if defined(ESP8266)
-            if (_wifiSSIDs[i].encryptionType != ENC_TYPE_NONE)
-        #else
-            if (_wifiSSIDs[i].encryptionType != WIFI_AUTH_OPEN)
-        #endif
-            {
-                encryption = true;
-            }
+    return written;
+}
 
-            String row = JSONUtils::EncloseObject(
-                            JSONUtils::Pair(F("SSID"), _wifiSSIDs[i].SSID, true) +
-                            JSONUtils::Pair(F("Encryption"), encryption) +
-                            JSONUtils::Pair(F("Quality"), String(rssiQ))
-                     );
+// Serializes the next part of the /scan JSON into state.pending, false when all was sent
+bool ESPAsync_WiFiManager::nextScanJsonItem(WiFiScanJsonState& state)
+{
+    JSONUtils::JSONBuffer buffer(state.pending, sizeof(state.pending));
+    JSONUtils::JSONWriter json(buffer);
 
-            if (!jsonStr.isEmpty())
-            {
-                jsonStr += JSONUtils::ItemSeparator();
-            }
+    state.length = 0;
+    state.offset = 0;
 
-            jsonStr += row;
-            delay(0);
+    if (state.stage == 0)
+    {
+        json.BeginObject().Key(F("Access_Points")).BeginArray();
+        state.stage = 1;
+    }
+
+    while (state.stage == 1 && buffer.length() == 0)
+    {
+        if (state.next >= state.count)
+        {
+            json.EndArray().EndObject();
+            state.stage = 2;
+            break;
         }
-        else
+
+        const WiFiResult& result = state.pResults->pItems[state.next++];
+
+        // Skipping the duplicates
+        if (result.duplicate == true)
+            continue;
+
+        LOGDEBUG1(F("SSID ="), result.SSID);
+        LOGDEBUG1(F("RSSI ="), result.RSSI);
+
+        int quality = getRSSIasQuality(result.RSSI);
+
+        if (state.minimumQuality != -1 && state.minimumQuality >= quality)
         {
             LOGDEBUG(F("Skipping due to quality"));
+            continue;
         }
-    }
 
-    jsonStr = JSONUtils::EncloseObject(JSONUtils::Pair(F("Access_Points"), jsonStr, true));
+        bool encryption = false;
 
-    ESPAsync_WiFiManagerUtils::responseApplJson(request, jsonStr);
+    #if defined(ESP8266)
+        if (result.encryptionType != ENC_TYPE_NONE)
+    #else
+        if (result.encryptionType != WIFI_AUTH_OPEN)
+    #endif
+        {
+            encryption = true;
+        }
 
-    LOGDEBUG(F("Sent WiFiScan Data in Json format"));
+        if (state.hasItems)
+        {
+            buffer.write(',');
+        }
+
+        json.BeginObject()
+            .Pair(F("SSID"), result.SSID)
+            .Pair(F("Encryption"), encryption)
+            .Pair(F("Quality"), quality)
+            .EndObject();
+
+        if (buffer.overflow())
+        {
+            LOGDEBUG(F("Skipping, entry too long"));
+            buffer.clear();
+            continue;
+        }
+
+        state.hasItems = true;
+    }
+
+    state.length = buffer.length();
+    return state.length > 0;
 }
 
 //////////////////////////////////////////
@@ -2536,42 +2965,143 @@ void ESPAsync_WiFiManager::onOTAEnd(std::function<void(bool success)> callable)
 inline void ESPAsync_WiFiManager::attachCustomHandlers(ArRequestFilterFunction /*filter*/)
 {}
 
+namespace {
+    // Response block of a static file from the generated route table, nullptr if not built in
+    const HTTPResponseBlock* staticFileBlock(uint8_t file)
+    {
+        switch (file)
+        {
+        #if !WM_RUNTIME_LANGUAGE
+            // HTML pages
+            case WM_STATIC_FILE_OTA_HTML:           return &gOTAHtml;
+            case WM_STATIC_FILE_INFO_HTML:          return &gInfoHtml;
+            case WM_STATIC_FILE_INDEX_HTML:         return &gIndexHtml;
+            case WM_STATIC_FILE_WIFI_HTML:          return &gWiFiHtml;
+        #ifdef WM_SUPPORT_HOME_ASSISTANT
+            case WM_STATIC_FILE_MQTT_HTML:          return &gMQTTHtml;
+        #endif
+        #endif
+
+            // CSS styles
+            case WM_STATIC_FILE_STYLE_CSS:          return &gStyleCSS;
+
+            // JS scripts
+        #if !WM_RUNTIME_LANGUAGE
+            case WM_STATIC_FILE_OTA_JS:             return &gOTAJS;
+            case WM_STATIC_FILE_RESTART_JS:         return &gRestartJS;
+        #ifdef WM_REMOTE_UPDATE
+            case WM_STATIC_FILE_OTA_REMOTE_JS:      return &gOTARemoteJS;
+        #endif
+        #endif
+            case WM_STATIC_FILE_UTILS_JS:           return &gUtilsJS;
+            case WM_STATIC_FILE_MODULE_POLYFILL_JS: return &gModulePolyfillJS;
+            case WM_STATIC_FILE_HW_STATUS_JS:       return &gHWStatusJS;
+        #if USE_ESP_WIFIMANAGER_NTP && !USE_CLOUDFLARE_NTP
+            case WM_STATIC_FILE_JSTZ_JS:            return &gJSTZJS;
+        #endif
+        #if WM_LANGUAGE_TABLE
+            case WM_STATIC_FILE_LANG_JS:            return &gLangJS;
+
+            // Language tables
+            case WM_STATIC_FILE_LANG_EN_JSON:       return &gLangEnJSON;
+            case WM_STATIC_FILE_LANG_SK_JSON:       return &gLangSkJSON;
+        #endif
+
+            default:                                return nullptr;
+        }
+    }
+
+    // Build time string as a JSON string, which is also a valid Javascript literal for the slots of app.js
+    String appValue(const __FlashStringHelper *pValue)
+    {
+        char buffer[160];
+        JSONUtils::JSONBuffer json(buffer, sizeof(buffer));
+        JSONUtils::JSONWriter(json).Value(pValue);
+        return json.overflow() ? String(F("''")) : String(buffer);
+    }
+
+    // app.js: application defines of the firmware, kept out of the static pages so that they can be
+    // precompressed and tagged at build time
+    void responseAppScript(AsyncWebServerRequest *pRequest)
+    {
+        String slots[WM_APP_SLOT_COUNT];
+        slots[WM_APP_SLOT_TITLE] = appValue(F(IOT_APPLICATION_TITLE));
+        slots[WM_APP_SLOT_COPYRIGHT] = appValue(F(IOT_COPYRIGHT));
+        slots[WM_APP_SLOT_VERSION] = appValue(F(IOT_SW_VERSION_STRING));
+        slots[WM_APP_SLOT_OTA_URL] = appValue(F(IOT_OTA_UPDATE_URL));
+
+        auto pScript = std::make_shared<HTTPTemplateStream>();
+        pScript->add(WM_PK_HTTP_APP_JS, slots);
+        ESPAsync_WiFiManagerUtils::responseTemplate(pRequest, FPSTR(WM_HTTP_HEAD_CT_TEXT_JAVASCRIPT), pScript, &gJSHeaders);
+    }
+
+#if WM_RUNTIME_LANGUAGE
+    // Translated file of the route table, nullptr if the file is not translated or not built in
+    const HTTPLanguageResponseBlock* staticLanguageFile(uint8_t file)
+    {
+        switch (file)
+        {
+            case WM_STATIC_FILE_OTA_HTML:           return &gOTAHtmlLT;
+            case WM_STATIC_FILE_INFO_HTML:          return &gInfoHtmlLT;
+            case WM_STATIC_FILE_INDEX_HTML:         return &gIndexHtmlLT;
+            case WM_STATIC_FILE_WIFI_HTML:          return &gWiFiHtmlLT;
+        #ifdef WM_SUPPORT_HOME_ASSISTANT
+            case WM_STATIC_FILE_MQTT_HTML:          return &gMQTTHtmlLT;
+        #endif
+            case WM_STATIC_FILE_OTA_JS:             return &gOTAJSLT;
+            case WM_STATIC_FILE_RESTART_JS:         return &gRestartJSLT;
+        #ifdef WM_REMOTE_UPDATE
+            case WM_STATIC_FILE_OTA_REMOTE_JS:      return &gOTARemoteJSLT;
+        #endif
+
+            default:                                return nullptr;
+        }
+    }
+#endif
+}
+
 bool ESPAsync_WiFiManager::handleStaticFileRequest(AsyncWebServerRequest *pRequest)
 {
-    const static std::map<String, const HTTPResponseBlock*> handlerMap =
+    // Perfect hash gives the only slot the path can be in, the table lives in flash
+    const char *pUrl = pRequest->url().c_str();
+    uint32_t slot = ESPAsync_WiFiManagerUtils::HashPath(pUrl, WM_STATIC_ROUTES_SEED) >> WM_STATIC_ROUTES_SHIFT;
+
+    HTTPStaticRoute route;
+    memcpy_P(&route, WM_STATIC_ROUTES + slot, sizeof(route));
+    if (route.pPath == nullptr || strcmp_P(pUrl, route.pPath) != 0)
     {
-        // HTML pages
-        { "/ota", &gOTAHtml },
-        { "/info", &gInfoHtml },
-        { "/index", &gIndexHtml },
-        { "/wifi", &gWiFiHtml },
-    #ifdef WM_SUPPORT_HOME_ASSISTANT
-        { "/mqtt", &gMQTTHtml },
-    #endif
-    
-        // CSS styles
-        { "/style.css", &gStyleCSS },
-
-        // JS scripts
-        { "/ota.js", &gOTAJS },
-        { "/utils.js", &gUtilsJS },
-        { "/md5_utils.js", &gMD5UtilsJS },
-        { "/module_polyfill.js", &gModulePolyfillJS },
-        { "/restart.js", &gRestartJS },
-#ifdef WM_REMOTE_UPDATE
-        { "/ota-remote.js", &gOTARemoteJS }
+        return false;
+    }
+
+    if (route.file == WM_STATIC_FILE_APP_JS)
+    {
+        responseAppScript(pRequest);
+        return true;
+    }
+
+#if WM_RUNTIME_LANGUAGE
+    const HTTPLanguageResponseBlock *pLanguageFile = staticLanguageFile(route.file);
+    if (pLanguageFile != nullptr)
+    {
+        size_t language = ESPAsync_WiFiManagerUtils::SelectLanguage(pRequest, WM_LANGUAGES,
+            ARRAY_LENGTH(WM_LANGUAGES), WM_LANGUAGES_DEFAULT);
+        LOGDEBUG1(F("ESPAsync_WiFiManager::handleStaticFileRequest: language="), language);
+
+        ESPAsync_WiFiManagerUtils::responseText(pRequest, pLanguageFile, WM_LANGUAGES + language,
+            route.immutable ? &gImmutableHeaders : nullptr);
+        return true;
+    }
 #endif
-    };
 
-    auto it = handlerMap.find(pRequest->url());
-    if (it == handlerMap.end())
+    const HTTPResponseBlock *pBlock = staticFileBlock(route.file);
+    if (pBlock == nullptr)
     {
         return false;
     }
 
     LOGDEBUG1(F("ESPAsync_WiFiManager::handleStaticFileRequest: ulr="), pRequest->url());
 
-    ESPAsync_WiFiManagerUtils::responseText(pRequest, it->second);
+    ESPAsync_WiFiManagerUtils::responseText(pRequest, pBlock, route.immutable ? &gImmutableHeaders : nullptr);
     return true;
 }
 
@@ -2704,6 +3234,37 @@ uint32_t getChipOUI()
     return (uint32_t) (chipId64 >> 24);
 }
 
+//////////////////////////////////////////
+
+// JEDEC ID of the flash chip the firmware runs from
+uint32_t getFlashChipID()
+{
+#if ( defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 2) )
+    uint32_t id = 0;
+
+    // nullptr selects the main flash chip
+    if (esp_flash_read_id(nullptr, &id) != ESP_OK)
+    {
+        return 0;
+    }
+
+    return id;
+#else
+    return g_rom_flashchip.device_id;
+#endif
+}
+
+//////////////////////////////////////////
+
+// Size of the flash chip from the capacity byte of its ID (ESP.getFlashChipSize() is the one set in the IDE).
+// The ID is (manufacturer << 16) | (type << 8) | capacity here, ESP8266 stores the bytes the other way round.
+uint32_t getFlashChipRealSize()
+{
+    uint32_t capacity = getFlashChipID() & 0xFF;
+
+    return (capacity == 0 || capacity >= 32) ? 0 : (1UL << capacity);
+}
+
 #endif
 
 //////////////////////////////////////////
@@ -208,6 +208,7 @@
 
 #include "ESPAsync_WiFiManager_Debug.h"
 #include "ESPAsync_WiFiManagerUtils.h"
+#include "JSONUtils.h"
 
 ////////////////////////////////////////////////////
 
@@ -250,12 +251,21 @@
   }
   
   #define ESP_getChipId()   (ESP.getChipId())
+  #define ESP_getFlashChipId()        (ESP.getFlashChipId())
+  #define ESP_getFlashChipRealSize()  (ESP.getFlashChipRealSize())
 #else   //ESP32
 
   #include <esp_wifi.h>
+  #if ( defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 2) )
+    #include <esp_flash.h>
+  #else
+    #include <rom/spi_flash.h>
+  #endif
   
   uint32_t getChipID();
   uint32_t getChipOUI();
+  uint32_t getFlashChipID();
+  uint32_t getFlashChipRealSize();
    
   #if defined(ESP_getChipId)
     #undef ESP_getChipId
@@ -263,6 +273,8 @@
   
   #define ESP_getChipId()   getChipID()
   #define ESP_getChipOUI()  getChipOUI()
+  #define ESP_getFlashChipId()        getFlashChipID()
+  #define ESP_getFlashChipRealSize()  getFlashChipRealSize()
 #endif
 
 ////////////////////////////////////////////////////
@@ -339,21 +351,50 @@ typedef struct
 
 #include <WiFiManagerLangResources.h>
 
-const char WM_PK_EMPTY_STR[] PROGMEM = "";
+////////////////////////////////////////////////////
 
+// KH, update from v1.15.0
+// To permit display stored Credentials on CP (passwords sent with /sq?dx=wifi and dx=mqtt)
+#ifndef DISPLAY_STORED_CREDENTIALS_IN_CP   
+  #define DISPLAY_STORED_CREDENTIALS_IN_CP          true
+#endif
 
-//KH
-// Mofidy HTTP_HEAD to WM_HTTP_HEAD_START to avoid conflict in Arduino esp8266 core 2.6.0+
-const char WM_HTTP_200[] PROGMEM            = "HTTP/1.1 200 OK\r\nContent-Type: text/html\r\n\r\n";
-const char WM_HTTP_HEAD_START[] PROGMEM     = "<!DOCTYPE html><html lang='en'><head><meta name='viewport' content='width=device-width, initial-scale=1, user-scalable=no'/><title>{v}</title>";
+#if ( (_WIFIMGR_LOGLEVEL_ > 3) && DISPLAY_STORED_CREDENTIALS_IN_CP )
+  #warning Enable DISPLAY_STORED_CREDENTIALS_IN_CP
+#endif
+
+// The Available Pages table is no longer part of the portal pages
+#if USE_AVAILABLE_PAGES
+  #warning USE_AVAILABLE_PAGES is deprecated and has no effect
+#endif
 
 ////////////////////////////////////////////////////
 
-const char WM_HTTP_STYLE[] PROGMEM = "<style>div{padding:2px;font-size:1em;}body,textarea,input,select{background: 0;border-radius: 0;font: 16px sans-serif;margin: 0}textarea,input,select{outline: 0;font-size: 14px;border: 1px solid #ccc;padding: 8px;width: 90%}.btn a{text-decoration: none}.container{margin: auto;width: 90%}@media(min-width:1200px){.container{margin: auto;width: 30%}}@media(min-width:768px) and (max-width:1200px){.container{margin: auto;width: 50%}}.btn,h2{font-size: 2em}h1{font-size: 3em}.btn{background: #0ae;border-radius: 4px;border: 0;color: #fff;cursor: pointer;display: inline-block;margin: 2px 0;padding: 10px 14px 11px;width: 100%}.btn:hover{background: #09d}.btn:active,.btn:focus{background: #08b}label>*{display: inline}form>*{display: block;margin-bottom: 10px}textarea:focus,input:focus,select:focus{border-color: #5ab}.msg{background: #def;border-left: 5px solid #59d;padding: 1.5em}.q{float: right;width: 64px;text-align: right}.l{background: url('data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAACAAAAAgCAMAAABEpIrGAAAALVBMVEX///8EBwfBwsLw8PAzNjaCg4NTVVUjJiZDRUUUFxdiZGSho6OSk5Pg4eFydHTCjaf3AAAAZElEQVQ4je2NSw7AIAhEBamKn97/uMXEGBvozkWb9C2Zx4xzWykBhFAeYp9gkLyZE0zIMno9n4g19hmdY39scwqVkOXaxph0ZCXQcqxSpgQpONa59wkRDOL93eAXvimwlbPbwwVAegLS1HGfZAAAAABJRU5ErkJggg==') no-repeat left center;background-size: 1em}input[type='checkbox']{float: left;width: 20px}.table td{padding:.5em;text-align:left}.table tbody>:nth-child(2n-1){background:#ddd}fieldset{border-radius:0.5rem;margin:0px;}</style>";
+// Slots of the /sq provider table, a power of two. The built-in providers take 7.
+#ifndef WM_SYSTEM_QUERY_SLOTS
+  #define WM_SYSTEM_QUERY_SLOTS       16
+#endif
 
-////////////////////////////////////////////////////
+// /sq?dx=<name> answers with the result of that query, {} if it is unknown.
+// /sq?dx=<a>,<b>,... (any comma) answers {"a":...,"b":...}, null for an unknown name.
+// Longest dx name of such a list, longer ones are skipped
+#ifndef WM_SYSTEM_QUERY_NAME_MAX
+  #define WM_SYSTEM_QUERY_NAME_MAX    31
+#endif
 
-const char WM_HTTP_SCRIPT[] PROGMEM = "<script>function c(l){document.getElementById('s').value=l.innerText||l.textContent;document.getElementById('p').focus();document.getElementById('s1').value=l.innerText||l.textContent;document.getElementById('p1').focus();document.getElementById('timezone').value=timezone.name();}</script>";
+static_assert((WM_SYSTEM_QUERY_SLOTS & (WM_SYSTEM_QUERY_SLOTS - 1)) == 0, "WM_SYSTEM_QUERY_SLOTS must be a power of two");
+
+// Key of a /sq?dx=<name> provider, the hash of the name folded at compile time
+#define WM_SYSTEM_QUERY(name)       (std::integral_constant<uint32_t, ESPAsync_WiFiManagerUtils::HashName(name)>::value)
+
+// Provider of a /sq answer, writes exactly one JSON value
+typedef std::function<void(JSONUtils::JSONWriter& json, AsyncWebServerRequest *request)> WMSystemQueryProvider;
+
+typedef struct
+{
+  uint32_t              hash;
+  WMSystemQueryProvider provider;     // Empty in a free slot
+}  WMSystemQueryEntry;
 
 ////////////////////////////////////////////////////
 ////////////////////////////////////////////////////
@@ -371,7 +412,6 @@ const char WM_HTTP_SCRIPT[] PROGMEM = "<script>function c(l){document.getElement
 #include "utils/TZ.h"
 
 const char WM_HTTP_SCRIPT_NTP_MSG[] PROGMEM = "<p>Your Timezone is : <b><label id='timezone' name='timezone'></b><script>document.getElementById('timezone').innerHTML=timezone.name();document.getElementById('timezone').value=timezone.name();</script></p>";
-const char WM_HTTP_SCRIPT_NTP_HIDDEN[] PROGMEM = "<p><input type='hidden' id='timezone' name='timezone'><script>document.getElementById('timezone').innerHTML=timezone.name();document.getElementById('timezone').value=timezone.name();</script></p>";
 
 ////////////////////////////////////////////////////
 
@@ -397,76 +437,16 @@ const char WM_HTTP_SCRIPT_NTP_HIDDEN[] PROGMEM = "<p><input type='hidden' id='ti
 #if USE_CLOUDFLARE_NTP
 const char WM_HTTP_SCRIPT_NTP[] PROGMEM = "<script src='https://cdnjs.cloudflare.com/ajax/libs/jstimezonedetect/1.0.7/jstz.min.js'></script><script>var timezone=jstz.determine();console.log('Your CloudFlare timezone is:' + timezone.name());document.getElementById('timezone').innerHTML = timezone.name();</script>";
 #else
-const char WM_HTTP_SCRIPT_NTP[] PROGMEM = "<script>(function(e){var t=function(){'use strict';var e='s',n=function(e){var t=-e.getTimezoneOffset();return t!==null?t:0},r=function(e,t,n){var r=new Date;return e!==undefined&&r.setFullYear(e),r.setDate(n),r.setMonth(t),r},i=function(e){return n(r(e,0,2))},s=function(e){return n(r(e,5,2))},o=function(e){var t=e.getMonth()>7?s(e.getFullYear()):i(e.getFullYear()),r=n(e);return t-r!==0},u=function(){var t=i(),n=s(),r=i()-s();return r<0?t+',1':r>0?n+',1,'+e:t+',0'},a=function(){var e=u();return new t.TimeZone(t.olson.timezones[e])},f=function(e){var t=new Date(2010,6,15,1,0,0,0),n={'America/Denver':new Date(2011,2,13,3,0,0,0),'America/Mazatlan':new Date(2011,3,3,3,0,0,0),'America/Chicago':new Date(2011,2,13,3,0,0,0),'America/Mexico_City':new Date(2011,3,3,3,0,0,0),'America/Asuncion':new Date(2012,9,7,3,0,0,0),'America/Santiago':new Date(2012,9,3,3,0,0,0),'America/Campo_Grande':new Date(2012,9,21,5,0,0,0),'America/Montevideo':new Date(2011,9,2,3,0,0,0),'America/Sao_Paulo':new Date(2011,9,16,5,0,0,0),'America/Los_Angeles':new Date(2011,2,13,8,0,0,0),'America/Santa_Isabel':new Date(2011,3,5,8,0,0,0),'America/Havana':new Date(2012,2,10,2,0,0,0),'America/New_York':new Date(2012,2,10,7,0,0,0),'Asia/Beirut':new Date(2011,2,27,1,0,0,0),'Europe/Helsinki':new Date(2011,2,27,4,0,0,0),'Europe/Istanbul':new Date(2011,2,28,5,0,0,0),'Asia/Damascus':new Date(2011,3,1,2,0,0,0),'Asia/Jerusalem':new Date(2011,3,1,6,0,0,0),'Asia/Gaza':new Date(2009,2,28,0,30,0,0),'Africa/Cairo':new Date(2009,3,25,0,30,0,0),'Pacific/Auckland':new Date(2011,8,26,7,0,0,0),'Pacific/Fiji':new Date(2010,11,29,23,0,0,0),'America/Halifax':new Date(2011,2,13,6,0,0,0),'America/Goose_Bay':new Date(2011,2,13,2,1,0,0),'America/Miquelon':new Date(2011,2,13,5,0,0,0),'America/Godthab':new Date(2011,2,27,1,0,0,0),'Europe/Moscow':t,'Asia/Yekaterinburg':t,'Asia/Omsk':t,'Asia/Krasnoyarsk':t,'Asia/Irkutsk':t,'Asia/Yakutsk':t,'Asia/Vladivostok':t,'Asia/Kamchatka':t,'Europe/Minsk':t,'Australia/Perth':new Date(2008,10,1,1,0,0,0)};return n[e]};return{determine:a,date_is_dst:o,dst_start_for:f}}();t.TimeZone=function(e){'use strict';var n={'America/Denver':['America/Denver','America/Mazatlan'],'America/Chicago':['America/Chicago','America/Mexico_City'],'America/Santiago':['America/Santiago','America/Asuncion','America/Campo_Grande'],'America/Montevideo':['America/Montevideo','America/Sao_Paulo'],'Asia/Beirut':['Asia/Beirut','Europe/Helsinki','Europe/Istanbul','Asia/Damascus','Asia/Jerusalem','Asia/Gaza'],'Pacific/Auckland':['Pacific/Auckland','Pacific/Fiji'],'America/Los_Angeles':['America/Los_Angeles','America/Santa_Isabel'],'America/New_York':['America/Havana','America/New_York'],'America/Halifax':['America/Goose_Bay','America/Halifax'],'America/Godthab':['America/Miquelon','America/Godthab'],'Asia/Dubai':['Europe/Moscow'],'Asia/Dhaka':['Asia/Yekaterinburg'],'Asia/Jakarta':['Asia/Omsk'],'Asia/Shanghai':['Asia/Krasnoyarsk','Australia/Perth'],'Asia/Tokyo':['Asia/Irkutsk'],'Australia/Brisbane':['Asia/Yakutsk'],'Pacific/Noumea':['Asia/Vladivostok'],'Pacific/Tarawa':['Asia/Kamchatka'],'Africa/Johannesburg':['Asia/Gaza','Africa/Cairo'],'Asia/Baghdad':['Europe/Minsk']},r=e,i=function(){var e=n[r],i=e.length,s=0,o=e[0];for(;s<i;s+=1){o=e[s];if(t.date_is_dst(t.dst_start_for(o))){r=o;return}}},s=function(){return typeof n[r]!='undefined'};return s()&&i(),{name:function(){return r}}},t.olson={},t.olson.timezones={'-720,0':'Etc/GMT+12','-660,0':'Pacific/Pago_Pago','-600,1':'America/Adak','-600,0':'Pacific/Honolulu','-570,0':'Pacific/Marquesas','-540,0':'Pacific/Gambier','-540,1':'America/Anchorage','-480,1':'America/Los_Angeles','-480,0':'Pacific/Pitcairn','-420,0':'America/Phoenix','-420,1':'America/Denver','-360,0':'America/Guatemala','-360,1':'America/Chicago','-360,1,s':'Pacific/Easter','-300,0':'America/Bogota','-300,1':'America/New_York','-270,0':'America/Caracas','-240,1':'America/Halifax','-240,0':'America/Santo_Domingo','-240,1,s':'America/Santiago','-210,1':'America/St_Johns','-180,1':'America/Godthab','-180,0':'America/Argentina/Buenos_Aires','-180,1,s':'America/Montevideo','-120,0':'Etc/GMT+2','-120,1':'Etc/GMT+2','-60,1':'Atlantic/Azores','-60,0':'Atlantic/Cape_Verde','0,0':'Etc/UTC','0,1':'Europe/London','60,1':'Europe/Berlin','60,0':'Africa/Lagos','60,1,s':'Africa/Windhoek','120,1':'Asia/Beirut','120,0':'Africa/Johannesburg','180,0':'Asia/Baghdad','180,1':'Europe/Moscow','210,1':'Asia/Tehran','240,0':'Asia/Dubai','240,1':'Asia/Baku','270,0':'Asia/Kabul','300,1':'Asia/Yekaterinburg','300,0':'Asia/Karachi','330,0':'Asia/Kolkata','345,0':'Asia/Kathmandu','360,0':'Asia/Dhaka','360,1':'Asia/Omsk','390,0':'Asia/Rangoon','420,1':'Asia/Krasnoyarsk','420,0':'Asia/Jakarta','480,0':'Asia/Shanghai','480,1':'Asia/Irkutsk','525,0':'Australia/Eucla','525,1,s':'Australia/Eucla','540,1':'Asia/Yakutsk','540,0':'Asia/Tokyo','570,0':'Australia/Darwin','570,1,s':'Australia/Adelaide','600,0':'Australia/Brisbane','600,1':'Asia/Vladivostok','600,1,s':'Australia/Sydney','630,1,s':'Australia/Lord_Howe','660,1':'Asia/Kamchatka','660,0':'Pacific/Noumea','690,0':'Pacific/Norfolk','720,1,s':'Pacific/Auckland','720,0':'Pacific/Tarawa','765,1,s':'Pacific/Chatham','780,0':'Pacific/Tongatapu','780,1,s':'Pacific/Apia','840,0':'Pacific/Kiritimati'},typeof exports!='undefined'?exports.jstz=t:e.jstz=t})(this);</script><script>var timezone=jstz.determine();console.log('Your Timezone is:' + timezone.name());document.getElementById('timezone').innerHTML = timezone.name();</script>";
-#endif
-
-#else
-  const char WM_HTTP_SCRIPT_NTP_MSG[]     PROGMEM   = "";
-  const char WM_HTTP_SCRIPT_NTP_HIDDEN[]  PROGMEM   = "";
-  const char WM_HTTP_SCRIPT_NTP[]         PROGMEM   = "";
-#endif
-
-////////////////////////////////////////////////////
-////////////////////////////////////////////////////
-
-const char WM_HTTP_HEAD_END[] PROGMEM = "</head><body><div class='container'><div style='text-align:left;display:inline-block;min-width:260px;'>";
-
-const char WM_FLDSET_START[]  PROGMEM = "<fieldset>";
-const char WM_FLDSET_END[]    PROGMEM = "</fieldset>";
-
-////////////////////////////////////////////////////
-
-const char WM_HTTP_PORTAL_OPTIONS[] PROGMEM = "<form action='/wifi' method='get'><button class='btn'>Configuration</button></form><br/><form action='/i' method='get'><button class='btn'>Information</button></form><br/><form action='/close' method='get'><button class='btn'>Exit Portal</button></form><br/>";
-const char WM_HTTP_ITEM[] PROGMEM = "<div><a href='#p' onclick='c(this)'>{v}</a>&nbsp;<span class='q {i}'>{r}%</span></div>";
-const char JSON_ITEM[] PROGMEM    = "{\"SSID\":\"{v}\", \"Encryption\":{i}, \"Quality\":\"{r}\"}";
-
-////////////////////////////////////////////////////
-
-// KH, update from v1.15.0
-// To permit display stored Credentials on CP
-#ifndef DISPLAY_STORED_CREDENTIALS_IN_CP   
-  #define DISPLAY_STORED_CREDENTIALS_IN_CP          true
-#endif
-
-#if ( (_WIFIMGR_LOGLEVEL_ > 3) && DISPLAY_STORED_CREDENTIALS_IN_CP )
-  #warning Enable DISPLAY_STORED_CREDENTIALS_IN_CP
+// jstz is served as the static file /jstz.js (WM_PK_JSTZ_JS) under a fingerprinted name the browser caches
+#define WM_HTTP_SCRIPT_NTP    WM_PK_HTTP_JSTZ_SCRIPT
 #endif
 
-#if DISPLAY_STORED_CREDENTIALS_IN_CP
-const char WM_HTTP_FORM_START[] PROGMEM = "<form method='get' action='wifisave'><fieldset><div><label>SSID</label><input value='[[ssid]]' id='s' name='s' length=32 placeholder='SSID'><div></div></div><div><label>Password</label><input value='[[pwd]]' id='p' name='p' length=64 placeholder='password'><div></div></div><div><label>SSID1</label><input value='[[ssid1]]' id='s1' name='s1' length=32 placeholder='SSID1'><div></div></div><div><label>Password</label><input value='[[pwd1]]' id='p1' name='p1' length=64 placeholder='password1'><div></div></div></fieldset>";
 #else
-const char WM_HTTP_FORM_START[] PROGMEM = "<form method='get' action='wifisave'><fieldset><div><label>SSID</label><input id='s' name='s' length=32 placeholder='SSID'><div></div></div><div><label>Password</label><input id='p' name='p' length=64 placeholder='password'><div></div></div><div><label>SSID1</label><input id='s1' name='s1' length=32 placeholder='SSID1'><div></div></div><div><label>Password</label><input id='p1' name='p1' length=64 placeholder='password1'><div></div></div></fieldset>";
+  #define WM_HTTP_SCRIPT_NTP_MSG      WM_PK_EMPTY_STR
+  #define WM_HTTP_SCRIPT_NTP          WM_PK_EMPTY_STR
 #endif
 
 ////////////////////////////////////////////////////
-
-const char WM_HTTP_FORM_LABEL_BEFORE[]  PROGMEM   = "<div><label for='{i}'>{p}</label><input id='{i}' name='{n}' length={l} placeholder='{p}' value='{v}' {c}><div></div></div>";
-const char WM_HTTP_FORM_LABEL_AFTER[]   PROGMEM   = "<div><input id='{i}' name='{n}' length={l} placeholder='{p}' value='{v}' {c}><label for='{i}'>{p}</label><div></div></div>";
-
-////////////////////////////////////////////////////
-
-const char WM_HTTP_FORM_LABEL[] PROGMEM = "<label for='{i}'>{p}</label>";
-const char WM_HTTP_FORM_PARAM[] PROGMEM = "<input id='{i}' name='{n}' length={l} placeholder='{p}' value='{v}' {c}>";
-
-const char WM_HTTP_FORM_END[] PROGMEM = "<button class='btn' type='submit'>Save</button></form>";
-
-////////////////////////////////////////////////////
-
-const char WM_HTTP_SAVED[] PROGMEM = "<div class='msg'><b>Credentials Saved</b><br>Try connecting ESP to the {x}/{x1} network. Wait around 10 seconds then check <a href='/'>if it's OK.</a> <p/>The {v} AP will run on the same WiFi channel of the {x}/{x1} AP. You may have to manually reconnect to the {v} AP.</div>";
-
-////////////////////////////////////////////////////
-
-const char WM_HTTP_END[] PROGMEM = "</div></body></html>";
-
-
-////////////////////////////////////////////////////
-
-#if USE_AVAILABLE_PAGES
-  const char WM_HTTP_AVAILABLE_PAGES[] PROGMEM = "<h3>Available Pages</h3><table class='table'><thead><tr><th>Page</th><th>Function</th></tr></thead><tbody><tr><td><a href='/'>/</a></td><td>Menu page.</td></tr><tr><td><a href='/wifi'>/wifi</a></td><td>Enter WiFi Config Page with scan results.</td></tr><tr><td><a href='/wifisave'>/wifisave</a></td><td>Save Config. Portal Info with supplied variables.</td></tr><tr><td><a href='/close'>/close</a></td><td>Close the Config Portal.</td></tr><tr><td><a href='/i'>/i</a></td><td>This Info page.</td></tr><tr><td><a href='/r'>/r</a></td><td>Delete WiFi configuration and reboot. ESP device will not reconnect to a network until new WiFi configuration data is entered.</td></tr><tr><td><a href='/state'>/state</a></td><td>Current device state in JSON format. Interface for programmatic WiFi configuration.</td></tr><tr><td><a href='/scan'>/scan</a></td><td>Run a WiFi scan and return results in JSON format. Interface for programmatic WiFi configuration.</td></tr></table>";
-#else
-  const char WM_HTTP_AVAILABLE_PAGES[] PROGMEM = "";
-#endif
-
 ////////////////////////////////////////////////////
 
 #define WIFI_MANAGER_MAX_PARAMS 20
@@ -558,6 +538,29 @@ class WiFiResult
     }
 };
 
+// Results of one scan, published only once filled, sorted and de-duplicated
+struct WiFiScanResults
+{
+    std::unique_ptr<WiFiResult[]> pItems;
+    int     count = 0;
+};
+
+// Progress of a /scan response. The results are shared with the manager, a new scan replaces them
+// without touching the list being sent. pending holds the JSON of one access point (SSID of 32
+// bytes fully escaped fits).
+struct WiFiScanJsonState
+{
+    std::shared_ptr<WiFiScanResults> pResults;
+    int     count = 0;
+    int     next = 0;
+    int     minimumQuality = -1;
+    uint8_t stage = 0;
+    bool    hasItems = false;
+    char    pending[256];
+    size_t  length = 0;
+    size_t  offset = 0;
+};
+
 ////////////////////////////////////////////////////
 ////////////////////////////////////////////////////
 
@@ -832,6 +835,19 @@ public:
     {
         _hardwareId = hardwareId;
     }
+
+#if defined(WM_SUPPORT_HOME_ASSISTANT) || WM_SUPPORT_MQTT
+    ///////////////////////////
+
+    // MQTT broker the MQTT page is filled with
+    void setMQTTConfig(const String& host, uint16_t port, const String& user, const String& pwd)
+    {
+        _mqttHost = host;
+        _mqttPort = port;
+        _mqttUser = user;
+        _mqttPass = pwd;
+    }
+#endif
      
 ////////////////////////////////////////////////////
  
@@ -901,6 +917,10 @@ public:
 
     // Method to handle system query, return true if handled
     virtual bool handleCustomSystemQuery(AsyncWebServerRequest *request);
+
+    // Registers the provider of /sq?dx=<name> under WM_SYSTEM_QUERY("<name>"), replacing the one
+    // registered before. Returns false if the table is full.
+    bool          addSystemQuery(uint32_t dxHash, WMSystemQueryProvider provider);
    
     // Access to web server
     AsyncWebServer* getWebServer()
@@ -922,10 +942,25 @@ private:
     
     void          handleRoot(AsyncWebServerRequest *request);
     void          handleWiFiSave(AsyncWebServerRequest *request);
+    void          handleWiFiSaveBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
     void          handleServerClose(AsyncWebServerRequest *request);
     void          handleInfo(AsyncWebServerRequest *request);
     void          handleSystemQuery(AsyncWebServerRequest *request);
+    void          addBuiltinSystemQueries();
+    bool          writeSystemQuery(JSONUtils::JSONWriter& json, AsyncWebServerRequest *request, const char *pName);
+    const WMSystemQueryProvider* findSystemQuery(uint32_t dxHash) const;
+    void          querySystemStatus(JSONUtils::JSONWriter& json);
+    void          queryHardwareInfo(JSONUtils::JSONWriter& json);
+    void          queryFirmwareInfo(JSONUtils::JSONWriter& json);
+    void          queryHardwareId(JSONUtils::JSONWriter& json);
+    void          queryHardwareStatus(JSONUtils::JSONWriter& json);
+    void          queryWiFi(JSONUtils::JSONWriter& json);
+#if defined(WM_SUPPORT_HOME_ASSISTANT) || WM_SUPPORT_MQTT
+    void          queryMQTT(JSONUtils::JSONWriter& json);
+#endif
     void          handleScan(AsyncWebServerRequest *request);
+    size_t        fillScanJson(WiFiScanJsonState& state, uint8_t *pBuffer, size_t maxLen);
+    bool          nextScanJsonItem(WiFiScanJsonState& state);
     void          handleReset(AsyncWebServerRequest *request);
     void          handleOTAUpdateStart(AsyncWebServerRequest *pRequest);
     void          handleOTAUpdateUpload(AsyncWebServerRequest *request);
@@ -965,9 +1000,17 @@ private:
     bool                    _modeless = false;
     int                     _scannow = -1;
     int                     _shouldscan = true;
-    bool                    _needInfo = true;
-    String                  _pager;
-    wl_status_t             _wifiStatus;
+    // Info page cache, marked stale by WiFi events and configuration saves (rebuilt by setInfo())
+    volatile bool           _needInfo = true;
+    String                  _infoStatus;
+    String                  _infoSlots[WM_CHIP_INFO_SLOT_COUNT];
+#ifdef ESP8266
+    WiFiEventHandler        _infoConnectedHandler;
+    WiFiEventHandler        _infoDisconnectedHandler;
+    WiFiEventHandler        _infoGotIPHandler;
+#else
+    wifi_event_id_t         _infoEventId = 0;
+#endif
 
 #define RFC952_HOSTNAME_MAXLEN      24
     char                    _RFC952_hostname[RFC952_HOSTNAME_MAXLEN + 1];
@@ -991,6 +1034,17 @@ private:
     // If the hardware ID is provided it will be check on firmaware update
     PGM_P _hardwareId = nullptr;
 
+#if defined(WM_SUPPORT_HOME_ASSISTANT) || WM_SUPPORT_MQTT
+    // MQTT broker shown on the MQTT page
+    String                  _mqttHost = "";
+    uint16_t                _mqttPort = 1883;
+    String                  _mqttUser = "";
+    String                  _mqttPass = "";
+#endif
+
+    // /sq providers, open addressing on the dx hash
+    WMSystemQueryEntry      _systemQueries[WM_SYSTEM_QUERY_SLOTS];
+
     ////////////////////////////////////////////////////
 
     unsigned long           _configPortalTimeout  = 0;
@@ -998,6 +1052,7 @@ private:
     unsigned long           _configPortalStart = 0;
     int                     _numberOfNetworks;
     int                    *_networkIndices = nullptr;
+    std::shared_ptr<WiFiScanResults> _wifiScanResults;  // Owns _wifiSSIDs, std::atomic_load/store only
     WiFiResult             *_wifiSSIDs = nullptr;
     wifi_ssid_count_t       _wifiSSIDCount;
     bool                    _wifiSSIDscan = true;
@@ -7,27 +7,445 @@
 
 #include "ESPAsync_WiFiManagerUtils.h"
 
-// Definition of global variable for HTML headers to prevent caching
+// Definition of global variable for HTML headers, revalidated on every use (ETag turns that into 304)
 const HTTPHeaderItem gHTMLHeaderItems[] = {
-    { FPSTR("Cache-Control"), FPSTR("no-cache, no-store, must-revalidate") }, // HTTP 1.1.
+    { FPSTR("Cache-Control"), FPSTR("no-cache") },                            // HTTP 1.1.
     { FPSTR("Pragma"), FPSTR("no-cache") },                                   // HTTP 1.0.
     { FPSTR("Expires"), FPSTR("-1") }                                       // Proxies.
 };
 const HTTPHeaderBlock gHTMLHeaders = { gHTMLHeaderItems, ARRAY_LENGTH(gHTMLHeaderItems) };
 
-// Definition of global variable for CSS headers
+// Definition of global variable for CSS headers. Pages load the fingerprinted name,
+// the plain one is revalidated so it can't go stale after an update.
 const HTTPHeaderItem gCSSHeaderItems[] = {
-    { FPSTR("Cache-Control"), FPSTR("max-age=604800") }, // Cache for 1 week
+    { FPSTR("Cache-Control"), FPSTR("no-cache") },
 };
 const HTTPHeaderBlock gCSSHeaders = { gCSSHeaderItems, ARRAY_LENGTH(gCSSHeaderItems) };
 
-// Definition of global variable for Javascript headers
+// Definition of global variable for Javascript headers, same policy as CSS
 const HTTPHeaderItem gJSHeaderItems[] = {
-    { FPSTR("Cache-Control"), FPSTR("max-age=604800") }, // Cache for 1 week
+    { FPSTR("Cache-Control"), FPSTR("no-cache") },
 };
 const HTTPHeaderBlock gJSHeaders = { gJSHeaderItems, ARRAY_LENGTH(gJSHeaderItems) };
 
+// Definition of global variable for assets served under a fingerprinted name
+const HTTPHeaderItem gImmutableHeaderItems[] = {
+    { FPSTR("Cache-Control"), FPSTR("public, max-age=31536000, immutable") }, // Name changes with content
+};
+const HTTPHeaderBlock gImmutableHeaders = { gImmutableHeaderItems, ARRAY_LENGTH(gImmutableHeaderItems) };
+
+// Definition of global variable for pages rendered per request, never cached
+const HTTPHeaderItem gDynamicHTMLHeaderItems[] = {
+    { FPSTR("Cache-Control"), FPSTR("no-cache, no-store, must-revalidate") },
+    { FPSTR("Pragma"), FPSTR("no-cache") },
+    { FPSTR("Expires"), FPSTR("-1") }
+};
+const HTTPHeaderBlock gDynamicHTMLHeaders = { gDynamicHTMLHeaderItems, ARRAY_LENGTH(gDynamicHTMLHeaderItems) };
+
+//////////////////////////////////////////
+
+void HTTPTemplateStream::add(const __FlashStringHelper *pText)
+{
+    if (pText != nullptr)
+    {
+        _items.push_back({ reinterpret_cast<PGM_P>(pText), String(), false });
+    }
+}
+
+void HTTPTemplateStream::addTemplate(const __FlashStringHelper *pTemplate)
+{
+    if (pTemplate != nullptr)
+    {
+        _items.push_back({ reinterpret_cast<PGM_P>(pTemplate), String(), true });
+    }
+}
+
+void HTTPTemplateStream::add(String text)
+{
+    if (text.length() > 0)
+    {
+        _items.push_back({ nullptr, std::move(text), false });
+    }
+}
+
+void HTTPTemplateStream::add(const HTTPTemplate& tpl, const String *pValues)
+{
+    for (size_t i = 0; i < tpl.count; i++)
+    {
+        HTTPTemplatePart part;
+        memcpy_P(&part, tpl.pParts + i, sizeof(part));
+        add(FPSTR(part.pText));
+        if (part.slot != HTTP_TEMPLATE_NO_SLOT)
+        {
+            add(pValues[part.slot]);
+        }
+    }
+}
+
+void HTTPTemplateStream::add(const HTTPTemplate& tpl, const HTTPLanguage *pLanguage)
+{
+    HTTPLanguage language;
+    memcpy_P(&language, pLanguage, sizeof(language));
+    _items.reserve(_items.size() + 2 * tpl.count);
+    for (size_t i = 0; i < tpl.count; i++)
+    {
+        HTTPTemplatePart part;
+        memcpy_P(&part, tpl.pParts + i, sizeof(part));
+        add(FPSTR(part.pText));
+        if (part.slot != HTTP_TEMPLATE_NO_SLOT)
+        {
+            // The string is sent from the table in place, nothing is copied to RAM
+            add(FPSTR(language.pStrings + pgm_read_word(language.pOffsets + part.slot)));
+        }
+    }
+}
+
+bool HTTPTemplateStream::length(size_t& length) const
+{
+    length = 0;
+    for (const Item& item : _items)
+    {
+        if (item.isTemplate && _resolver)
+        {
+            return false;
+        }
+        length += item.pText ? strlen_P(item.pText) : item.text.length();
+    }
+    return true;
+}
+
+bool HTTPTemplateStream::resolve(PGM_P pText)
+{
+    // "%{name}%"
+    if (!_resolver || pgm_read_byte(pText + 1) != '{')
+    {
+        return false;
+    }
+
+    char name[MAX_NAME_LENGTH + 1];
+    size_t length = 0;
+    for (char c = pgm_read_byte(pText + 2); c != '}'; c = pgm_read_byte(pText + 2 + length))
+    {
+        if (c == 0 || c == '%' || length == MAX_NAME_LENGTH)
+        {
+            return false;
+        }
+        name[length++] = c;
+    }
+    if (pgm_read_byte(pText + 3 + length) != '%')
+    {
+        return false;
+    }
+    name[length] = 0;
+
+    _value = String();
+    _valueOffset = 0;
+    if (!_resolver(name, _value))
+    {
+        return false;
+    }
+    _offset += length + 4;
+    return true;
+}
+
+size_t HTTPTemplateStream::read(uint8_t *pBuffer, size_t bufLen)
+{
+    size_t written = 0;
+    while (written < bufLen)
+    {
+        if (_valueOffset < _value.length())
+        {
+            size_t size = std::min(bufLen - written, _value.length() - _valueOffset);
+            memcpy(pBuffer + written, _value.c_str() + _valueOffset, size);
+            written += size;
+            _valueOffset += size;
+            continue;
+        }
+        if (_item >= _items.size())
+        {
+            break;
+        }
+
+        const Item& item = _items[_item];
+        if (item.pText == nullptr)
+        {
+            size_t size = std::min(bufLen - written, item.text.length() - _offset);
+            memcpy(pBuffer + written, item.text.c_str() + _offset, size);
+            written += size;
+            _offset += size;
+            if (_offset >= item.text.length())
+            {
+                _item++;
+                _offset = 0;
+            }
+            continue;
+        }
+
+        // Literal run up to the next placeholder, one pass over the template
+        char c = pgm_read_byte(item.pText + _offset);
+        if (c == 0)
+        {
+            _item++;
+            _offset = 0;
+            continue;
+        }
+        if (c == '%' && item.isTemplate && resolve(item.pText + _offset))
+        {
+            continue;
+        }
+        do
+        {
+            pBuffer[written++] = c;
+            c = pgm_read_byte(item.pText + ++_offset);
+        } while (c != 0 && c != '%' && written < bufLen);
+    }
+    return written;
+}
+
+//////////////////////////////////////////
+
 namespace {
+    // Quality value of an Accept-Encoding or Accept-Language item in thousandths: "1" -> 1000, "0.8" -> 800
+    int ParseQuality(const char *p)
+    {
+        int quality = (*p == '1') ? 1000 : 0;
+        if (*p == '0' || *p == '1')
+        {
+            p++;
+        }
+        if (*p == '.')
+        {
+            for (int scale = 100; scale > 0 && *++p >= '0' && *p <= '9'; scale /= 10)
+            {
+                quality += (*p - '0') * scale;
+            }
+        }
+        return std::min(quality, 1000);
+    }
+
+    // True if Accept-Encoding allows the content coding: "gzip, deflate, br;q=0.9". Codings compare
+    // as whole tokens, q=0 refuses one, "*" stands for the codings not listed.
+    bool AcceptsEncoding(AsyncWebServerRequest *pRequest, const char *pEncoding)
+    {
+        const AsyncWebHeader *pHeader = pRequest->getHeader(FPSTR(WM_HTTP_HEAD_ACCEPT_ENCODING));
+        if (pHeader == nullptr)
+        {
+            return false;
+        }
+
+        size_t encodingLength = strlen(pEncoding);
+        int wildcardQuality = 0;
+        for (const char *p = pHeader->value().c_str(); *p != 0; )
+        {
+            while (*p == ' ' || *p == ',')
+            {
+                p++;
+            }
+            const char *pToken = p;
+            while (*p != 0 && *p != ',' && *p != ';' && *p != ' ')
+            {
+                p++;
+            }
+            size_t tokenLength = p - pToken;
+
+            int quality = 1000;
+            for (; *p != 0 && *p != ','; p++)
+            {
+                if ((*p == ';' || *p == ' ') && p[1] == 'q' && p[2] == '=')
+                {
+                    quality = ParseQuality(p + 3);
+                }
+            }
+
+            if (tokenLength == encodingLength && strncasecmp(pToken, pEncoding, tokenLength) == 0)
+            {
+                return quality > 0;
+            }
+            if (tokenLength == 1 && *pToken == '*')
+            {
+                wildcardQuality = quality;
+            }
+        }
+        return wildcardQuality > 0;
+    }
+
+    const char ETAG_SUFFIX_GZIP[]   = "-gz";
+    const char ETAG_SUFFIX_BROTLI[] = "-br";
+
+    // Pre-compressed copy of a response block and how it is labelled on the wire
+    struct ContentEncoding
+    {
+        const HTTPEncodedBlock* pData;  // nullptr for the plain content
+        const char* pName;              // Content-Encoding value
+        const char* pETagSuffix;        // Keeps the entity tags of the representations apart
+    };
+
+    // Smallest pre-compressed copy the client accepts, pData is nullptr if none fits
+    ContentEncoding SelectEncoding(AsyncWebServerRequest *pRequest, const HTTPResponseBlock *pBlock)
+    {
+        ContentEncoding encoding = { nullptr, nullptr, nullptr };
+        if (pBlock->gzip.size > 0 && AcceptsEncoding(pRequest, WM_HTTP_ENCODING_GZIP))
+        {
+            encoding = { &pBlock->gzip, WM_HTTP_ENCODING_GZIP, ETAG_SUFFIX_GZIP };
+        }
+        if (pBlock->brotli.size > 0 && (encoding.pData == nullptr || pBlock->brotli.size < encoding.pData->size) &&
+            AcceptsEncoding(pRequest, WM_HTTP_ENCODING_BROTLI))
+        {
+            encoding = { &pBlock->brotli, WM_HTTP_ENCODING_BROTLI, ETAG_SUFFIX_BROTLI };
+        }
+        return encoding;
+    }
+
+    // Quoted entity tag of the response, empty if the block has no content hash.
+    // The compressed representation gets its own tag, as required for strong validators.
+    String MakeETag(const HTTPResponseBlock *pBlock, const ContentEncoding& encoding)
+    {
+        String etag;
+        if (pBlock->pETag != nullptr && pgm_read_byte(reinterpret_cast<PGM_P>(pBlock->pETag)) != 0)
+        {
+            etag.reserve(STRLEN_P(pBlock->pETag) + 5);
+            etag += '"';
+            etag += pBlock->pETag;
+            if (encoding.pETagSuffix != nullptr)
+            {
+                etag += FPSTR(encoding.pETagSuffix);
+            }
+            etag += '"';
+        }
+        return etag;
+    }
+
+    // Check whether the client already holds the representation identified by etag
+    bool MatchesETag(AsyncWebServerRequest *pRequest, const String& etag)
+    {
+        const AsyncWebHeader *pHeader = pRequest->getHeader(FPSTR(WM_HTTP_HEAD_IF_NONE_MATCH));
+        return pHeader != nullptr &&
+            (pHeader->value() == F("*") || pHeader->value().indexOf(etag) >= 0);
+    }
+
+    void AddHeaders(AsyncWebServerResponse *pResponse, const HTTPResponseBlock *pBlock,
+        const HTTPHeaderBlock *pHeader, const String& etag)
+    {
+        if (etag.length() > 0)
+        {
+            pResponse->addHeader(FPSTR(WM_HTTP_HEAD_ETAG), etag);
+        }
+        if (pBlock->gzip.size > 0 || pBlock->brotli.size > 0)
+        {
+            // Caches must keep the plain and compressed variants apart
+            pResponse->addHeader(FPSTR(WM_HTTP_HEAD_VARY), FPSTR(WM_HTTP_HEAD_ACCEPT_ENCODING));
+        }
+        for (size_t i = 0; i < pHeader->count; i++)
+        {
+            pResponse->addHeader(pHeader->pItems[i].pName, pHeader->pItems[i].pValue);
+        }
+    }
+
+    // Index of the language whose code is the primary subtag of the tag ("sk" for "sk-SK"), count if none
+    size_t FindLanguage(const HTTPLanguage *pLanguages, size_t count, const char *pTag, size_t length)
+    {
+        size_t subtag = 0;
+        while (subtag < length && pTag[subtag] != '-')
+        {
+            subtag++;
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            HTTPLanguage language;
+            memcpy_P(&language, pLanguages + i, sizeof(language));
+            if (subtag > 0 && strlen_P(language.pCode) == subtag && strncasecmp_P(pTag, language.pCode, subtag) == 0)
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    // Language set by the page in the wm_lang cookie, count if none
+    size_t CookieLanguage(AsyncWebServerRequest *pRequest, const HTTPLanguage *pLanguages, size_t count)
+    {
+        const AsyncWebHeader *pHeader = pRequest->getHeader(FPSTR(WM_HTTP_HEAD_COOKIE));
+        if (pHeader == nullptr)
+        {
+            return count;
+        }
+
+        // "a=1; wm_lang=sk; b=2"
+        const size_t nameLength = sizeof(WM_HTTP_COOKIE_LANGUAGE) - 1;
+        for (const char *p = pHeader->value().c_str(); *p != 0; )
+        {
+            while (*p == ' ' || *p == ';')
+            {
+                p++;
+            }
+            const char *pEnd = p;
+            while (*pEnd != 0 && *pEnd != ';')
+            {
+                pEnd++;
+            }
+            if (strncmp_P(p, WM_HTTP_COOKIE_LANGUAGE, nameLength) == 0 && p[nameLength] == '=')
+            {
+                p += nameLength + 1;
+                return FindLanguage(pLanguages, count, p, pEnd - p);
+            }
+            p = pEnd;
+        }
+        return count;
+    }
+
+    // Best Accept-Language match, count if none. "sk-SK,sk;q=0.9,en;q=0.8"
+    size_t AcceptedLanguage(AsyncWebServerRequest *pRequest, const HTTPLanguage *pLanguages, size_t count)
+    {
+        const AsyncWebHeader *pHeader = pRequest->getHeader(FPSTR(WM_HTTP_HEAD_ACCEPT_LANGUAGE));
+        if (pHeader == nullptr)
+        {
+            return count;
+        }
+
+        size_t best = count;
+        int bestQuality = 0;
+        for (const char *p = pHeader->value().c_str(); *p != 0; )
+        {
+            while (*p == ' ' || *p == ',')
+            {
+                p++;
+            }
+            const char *pTag = p;
+            while (*p != 0 && *p != ',' && *p != ';' && *p != ' ')
+            {
+                p++;
+            }
+            size_t tagLength = p - pTag;
+
+            int quality = 1000;
+            for (; *p != 0 && *p != ','; p++)
+            {
+                if ((*p == ';' || *p == ' ') && p[1] == 'q' && p[2] == '=')
+                {
+                    quality = ParseQuality(p + 3);
+                }
+            }
+
+            // Equal quality keeps the earlier item, the client lists its preference first
+            if (quality > bestQuality)
+            {
+                size_t language = FindLanguage(pLanguages, count, pTag, tagLength);
+                if (language < count)
+                {
+                    best = language;
+                    bestQuality = quality;
+                }
+            }
+        }
+        return best;
+    }
+
+    // arduino-esp32 defines memcpy_P as memcpy, its flash is mapped into the data address space
+    inline void CopyProgmem(uint8_t *pBufferWithOffset, PGM_P pSrc, size_t size)
+    {
+        memcpy_P(pBufferWithOffset, pSrc, size);
+    }
+
     void CopyBlock(uint8_t *pBufferWithOffset, const HTTPMemoryBlockItem *pBlock, size_t blockOffset, 
         size_t blockSize)
     {
@@ -35,11 +453,10 @@ namespace {
         {
             memcpy(pBufferWithOffset, pBlock->pMemBlock + blockOffset, blockSize);
         }
-    #ifdef ESP8266
+    #if defined(ESP8266) || defined(ESP32)
         else if (pBlock->pPMemBlock != nullptr)
         {
-            PGM_P p = reinterpret_cast<PGM_P>(pBlock->pPMemBlock);
-            memcpy_P(pBufferWithOffset, p + blockOffset, blockSize);
+            CopyProgmem(pBufferWithOffset, reinterpret_cast<PGM_P>(pBlock->pPMemBlock) + blockOffset, blockSize);
         }
     #endif
     }
@@ -53,107 +470,146 @@ namespace {
         }
         else if (pBlock->pString != nullptr)
         {
-            PGM_P p = reinterpret_cast<PGM_P>(pBlock->pPMemBlock);
             memcpy(pBufferWithOffset, pBlock->pString->c_str() + blockOffset, blockSize);
         }
-    #ifdef ESP8266
+    #if defined(ESP8266) || defined(ESP32)
         else if (pBlock->pPMemBlock != nullptr)
         {
-            PGM_P p = reinterpret_cast<PGM_P>(pBlock->pPMemBlock);
-            memcpy_P(pBufferWithOffset, p + blockOffset, blockSize);
+            CopyProgmem(pBufferWithOffset, reinterpret_cast<PGM_P>(pBlock->pPMemBlock) + blockOffset, blockSize);
         }
     #endif
     }
 
+    inline size_t BlockItemSize(const HTTPMemoryBlockItem *pBlocks)
+    {
+        return pBlocks ? pBlocks->size : 0;
+    }
+
     inline size_t BlockItemSize(const HTTPMemoryBlock2Item *pBlocks)
     {
         return pBlocks ? (pBlocks->pString ? pBlocks->pString->length() : pBlocks->size) : 0;
     }
 
-    // Function to send memory block
-    size_t SendMemoryBlock (const HTTPMemoryBlock *pBlock, uint8_t *pBuffer, size_t bufLen, size_t index)
+    // Position of a chunked response within its memory block, kept between filler callbacks
+    struct MemoryBlockCursor
+    {
+        size_t item = 0;    // Index of the current item
+        size_t offset = 0;  // Offset within the current item
+        size_t index = 0;   // Response index the cursor points to
+    };
+
+    // Move the cursor to the response index by walking the items from the start.
+    // Only needed when the server doesn't continue where the previous callback ended.
+    template <typename TBlock>
+    void SeekMemoryBlock(const TBlock *pBlock, MemoryBlockCursor& cursor, size_t index)
+    {
+        cursor = MemoryBlockCursor();
+        while (cursor.item < pBlock->count)
+        {
+            size_t itemSize = BlockItemSize(pBlock->pItems + cursor.item);
+            if (cursor.index + itemSize > index)
+            {
+                break;
+            }
+            cursor.index += itemSize;
+            cursor.item++;
+        }
+        cursor.offset = index - cursor.index;
+        cursor.index = index;
+    }
+
+    // Function to send memory block, resumes at the cursor so a callback doesn't depend on the item count
+    template <typename TBlock>
+    size_t SendMemoryBlock(const TBlock *pBlock, MemoryBlockCursor& cursor,
+        uint8_t *pBuffer, size_t bufLen, size_t index)
     {
+        if (index != cursor.index)
+        {
+            SeekMemoryBlock(pBlock, cursor, index);
+        }
+
         uint8_t *pBufferWithOffset = pBuffer;
-        size_t remainingBufLen = (bufLen & 0xFFFC); // Align buffer length to 4
-        size_t currentIndex = index;
-        size_t blockStart = 0;
+        // Align buffer length to 4, unless the buffer is smaller than that
+        size_t remainingBufLen = (bufLen >= 4) ? (bufLen & ~static_cast<size_t>(3)) : bufLen;
         size_t sizeOfCopiedMem = 0;
 
         //LOGDEBUG1("SendMemoryBlock: bufLen=", bufLen);
-        //LOGDEBUG1("SendMemoryBlock: remainingBufLen=", remainingBufLen);
-        //LOGDEBUG1("SendMemoryBlock: countOfBlocks=", countOfBlocks);
+        //LOGDEBUG1("SendMemoryBlock: item=", cursor.item);
 
-        for (size_t iBlock = 0; iBlock < pBlock->count && remainingBufLen > 0; iBlock++)
+        while (cursor.item < pBlock->count && remainingBufLen > 0)
         {
-            size_t blockEnd = blockStart + pBlock->pItems[iBlock].size;
-
-            while (blockStart <= currentIndex &&
-                   blockEnd > currentIndex &&
-                   remainingBufLen > 0)
+            size_t itemSize = BlockItemSize(pBlock->pItems + cursor.item);
+            size_t blockSize = itemSize - cursor.offset;
+            if (blockSize >= remainingBufLen)
             {
-                size_t blockOffset = currentIndex - blockStart;
-                size_t blockSize = pBlock->pItems[iBlock].size - blockOffset;
-                if (blockSize >= remainingBufLen)
-                {
-                    blockSize = remainingBufLen;
-                }
-
-                CopyBlock(pBufferWithOffset, pBlock->pItems + iBlock, blockOffset, blockSize);
-                pBufferWithOffset += blockSize;
-                sizeOfCopiedMem += blockSize;
-                currentIndex += blockSize;
-                remainingBufLen -= blockSize;
+                blockSize = remainingBufLen;
             }
 
-            blockStart = blockEnd;
+            CopyBlock(pBufferWithOffset, pBlock->pItems + cursor.item, cursor.offset, blockSize);
+            pBufferWithOffset += blockSize;
+            sizeOfCopiedMem += blockSize;
+            remainingBufLen -= blockSize;
+
+            cursor.offset += blockSize;
+            if (cursor.offset >= itemSize)
+            {
+                cursor.item++;
+                cursor.offset = 0;
+            }
         }
+        cursor.index += sizeOfCopiedMem;
 
         //LOGDEBUG1("SendMemoryBlock: sizeOfCopiedMem=", sizeOfCopiedMem);
         return sizeOfCopiedMem;
     }
-    
-    // Function to send memory block
-    size_t SendMemoryBlock (const HTTPMemoryBlock2 *pBlock,
-        uint8_t *pBuffer, size_t bufLen, size_t index)
-    {
-        uint8_t *pBufferWithOffset = pBuffer;
-        size_t remainingBufLen = (bufLen & 0xFFFC); // Align buffer length to 4
-        size_t currentIndex = index;
-        size_t blockStart = 0;
-        size_t sizeOfCopiedMem = 0;
 
-        //LOGDEBUG1("SendMemoryBlock: bufLen=", bufLen);
-        //LOGDEBUG1("SendMemoryBlock: remainingBufLen=", remainingBufLen);
-        //LOGDEBUG1("SendMemoryBlock: countOfBlocks=", countOfBlocks);
+    // Plain blocks never refer to a String, their length is always fixed
+    inline bool HasFixedLength(const HTTPMemoryBlock * /*pBlock*/)
+    {
+        return true;
+    }
 
-        for (size_t iBlock = 0; iBlock < pBlock->count && remainingBufLen > 0; iBlock++)
+    // Length of a block is fixed when none of its items refers to a String
+    bool HasFixedLength(const HTTPMemoryBlock2 *pBlock)
+    {
+        for (size_t iBlock = 0; iBlock < pBlock->count; iBlock++)
         {
-            size_t bs = BlockItemSize(pBlock->pItems + iBlock);
-            size_t blockEnd = blockStart + bs;
-
-            while (blockStart <= currentIndex &&
-                   blockEnd > currentIndex &&
-                   remainingBufLen > 0)
+            if (pBlock->pItems[iBlock].pString != nullptr)
             {
-                size_t blockOffset = currentIndex - blockStart;
-                size_t blockSize = bs - blockOffset;
-                if (blockSize >= remainingBufLen)
-                {
-                    blockSize = remainingBufLen;
-                }
-
-                CopyBlock(pBufferWithOffset, pBlock->pItems + iBlock, blockOffset, blockSize);
-                pBufferWithOffset += blockSize;
-                sizeOfCopiedMem += blockSize;
-                currentIndex += blockSize;
-                remainingBufLen -= blockSize;
+                return false;
             }
+        }
+        return true;
+    }
 
-            blockStart = blockEnd;
+    template <typename TBlock>
+    size_t BlockLength(const TBlock *pBlock)
+    {
+        size_t length = 0;
+        for (size_t iBlock = 0; iBlock < pBlock->count; iBlock++)
+        {
+            length += BlockItemSize(pBlock->pItems + iBlock);
         }
+        return length;
+    }
 
-        //LOGDEBUG1("SendMemoryBlock: sizeOfCopiedMem=", sizeOfCopiedMem);
-        return sizeOfCopiedMem;
+    // Response streaming the memory block. Blocks of fixed length are sent with Content-Length,
+    // blocks referring to Strings fall back to chunked transfer encoding.
+    template <typename TBlock>
+    AsyncWebServerResponse* BeginBlockResponse(AsyncWebServerRequest *pRequest, const String& contentType,
+        const TBlock *pBlock)
+    {
+        MemoryBlockCursor cursor;
+        auto filler = [pBlock, cursor](uint8_t *pBuffer, size_t bufLen, size_t index) mutable -> size_t
+        {
+            return SendMemoryBlock(pBlock, cursor, pBuffer, bufLen, index);
+        };
+
+        if (HasFixedLength(pBlock))
+        {
+            return pRequest->beginResponse(contentType, BlockLength(pBlock), filler);
+        }
+        return pRequest->beginChunkedResponse(contentType, filler);
     }
 }
 
@@ -206,7 +662,8 @@ namespace ESPAsync_WiFiManagerUtils {
     #endif    // ( USING_ESP32_S2 || USING_ESP32_C3 )
     }
 
-    void responseText(AsyncWebServerRequest *pRequest, const HTTPResponseBlock *pBlock)
+    void responseText(AsyncWebServerRequest *pRequest, const HTTPResponseBlock *pBlock,
+        const HTTPHeaderBlock *pHeader)
     {
     #if ( USING_ESP32_S2 || USING_ESP32_C3 )
         // Ensure we send the configured content-type from the response block
@@ -216,21 +673,31 @@ namespace ESPAsync_WiFiManagerUtils {
         // Fix ESP32-S2 issue with WebServer (https://github.com/espressif/arduino-esp32/issues/4348)
         delay(1);
     #else
-        // Resolve content type from flash to a runtime string, then pass it to beginChunkedResponse
+        // Resolve content type from flash to a runtime string, then pass it to the response
         String _ct = String(pBlock->pContentType);
         //LOGDEBUG1(F("responseText"), _ct);
 
-        AsyncWebServerResponse *pResponse = pRequest->beginChunkedResponse(_ct.c_str(),
-            [pBlock](uint8_t *pBuffer, size_t bufLen, size_t index) -> size_t
-        {
-            return SendMemoryBlock(pBlock->pBlock, pBuffer, bufLen, index);
-        });
+        ContentEncoding encoding = SelectEncoding(pRequest, pBlock);
+        String etag = MakeETag(pBlock, encoding);
 
-        for (size_t i = 0; i < pBlock->pHeader->count; i++)
+        AsyncWebServerResponse *pResponse;
+        if (etag.length() > 0 && MatchesETag(pRequest, etag))
         {
-            pResponse->addHeader(pBlock->pHeader->pItems[i].pName, pBlock->pHeader->pItems[i].pValue);
+            // Client copy is up to date, answer without body
+            pResponse = pRequest->beginResponse(304);
         }
-        pResponse->addHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
+        else if (encoding.pData != nullptr)
+        {
+            // Pre-compressed copy has a known length, no need for chunked transfer
+            pResponse = pRequest->beginResponse_P(200, _ct.c_str(), encoding.pData->pData, encoding.pData->size);
+            pResponse->addHeader(FPSTR(WM_HTTP_HEAD_CONTENT_ENCODING), FPSTR(encoding.pName));
+        }
+        else
+        {
+            pResponse = BeginBlockResponse(pRequest, _ct, pBlock->pBlock);
+        }
+
+        AddHeaders(pResponse, pBlock, pHeader ? pHeader : pBlock->pHeader, etag);
 
         pRequest->send(pResponse);
     #endif    // ( USING_ESP32_S2 || USING_ESP32_C3 )
@@ -246,24 +713,117 @@ namespace ESPAsync_WiFiManagerUtils {
         // Fix ESP32-S2 issue with WebServer (https://github.com/espressif/arduino-esp32/issues/4348)
         delay(1);
     #else
-        // Resolve content type from flash to a runtime string, then pass it to beginChunkedResponse
+        // Resolve content type from flash to a runtime string, then pass it to the response
         String _ct = String(pBlock->pContentType);
-        AsyncWebServerResponse *pResponse = pRequest->beginChunkedResponse(_ct.c_str(),
-            [pBlock](uint8_t *pBuffer, size_t bufLen, size_t index) -> size_t
-        {
-            return SendMemoryBlock(pBlock->pBlock, pBuffer, bufLen, index);
-        });
+        AsyncWebServerResponse *pResponse = BeginBlockResponse(pRequest, _ct, pBlock->pBlock);
 
         for (size_t i = 0; i < pBlock->pHeader->count; i++)
         {
             pResponse->addHeader(pBlock->pHeader->pItems[i].pName, pBlock->pHeader->pItems[i].pValue);
         }
-        pResponse->addHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
 
         pRequest->send(pResponse);
     #endif    // ( USING_ESP32_S2 || USING_ESP32_C3 )
     }
 
+    void responseTemplate(AsyncWebServerRequest *pRequest, const __FlashStringHelper *pContentType,
+        std::shared_ptr<HTTPTemplateStream> pStream, const HTTPHeaderBlock *pHeader)
+    {
+        // The stream outlives the handler, the response owns it until the last chunk is sent
+        auto filler = [pStream](uint8_t *pBuffer, size_t bufLen, size_t /*index*/) -> size_t
+        {
+            return pStream->read(pBuffer, bufLen);
+        };
+
+        // Pages made only of texts and filled slots have a known length, no need for chunked transfer
+        size_t length;
+        AsyncWebServerResponse *pResponse = pStream->length(length) ?
+            pRequest->beginResponse(String(pContentType), length, filler) :
+            pRequest->beginChunkedResponse(String(pContentType), filler);
+
+        for (size_t i = 0; i < pHeader->count; i++)
+        {
+            pResponse->addHeader(pHeader->pItems[i].pName, pHeader->pItems[i].pValue);
+        }
+
+        pRequest->send(pResponse);
+    }
+
+    void responseText(AsyncWebServerRequest *pRequest, const HTTPLanguageResponseBlock *pBlock,
+        const HTTPLanguage *pLanguage, const HTTPHeaderBlock *pHeader)
+    {
+        HTTPLanguage language;
+        memcpy_P(&language, pLanguage, sizeof(language));
+
+        // Every language is a representation of its own, the tag carries the language code
+        String etag;
+        if (pBlock->pETag != nullptr && pgm_read_byte(reinterpret_cast<PGM_P>(pBlock->pETag)) != 0)
+        {
+            etag.reserve(STRLEN_P(pBlock->pETag) + strlen_P(language.pCode) + 3);
+            etag += '"';
+            etag += pBlock->pETag;
+            etag += '-';
+            etag += FPSTR(language.pCode);
+            etag += '"';
+        }
+
+        AsyncWebServerResponse *pResponse;
+        if (etag.length() > 0 && MatchesETag(pRequest, etag))
+        {
+            // Client copy is up to date, answer without body
+            pResponse = pRequest->beginResponse(304);
+        }
+        else
+        {
+            auto pStream = std::make_shared<HTTPTemplateStream>();
+            pStream->add(*pBlock->pTemplate, pLanguage);
+            size_t length;
+            pStream->length(length);
+            pResponse = pRequest->beginResponse(String(pBlock->pContentType), length,
+                [pStream](uint8_t *pBuffer, size_t bufLen, size_t /*index*/) -> size_t
+                {
+                    return pStream->read(pBuffer, bufLen);
+                });
+        }
+
+        if (etag.length() > 0)
+        {
+            pResponse->addHeader(FPSTR(WM_HTTP_HEAD_ETAG), etag);
+        }
+        pResponse->addHeader(FPSTR(WM_HTTP_HEAD_CONTENT_LANGUAGE), FPSTR(language.pCode));
+        // Caches must keep the languages apart
+        pResponse->addHeader(FPSTR(WM_HTTP_HEAD_VARY), FPSTR(WM_HTTP_VARY_LANGUAGE));
+        const HTTPHeaderBlock *pHeaders = pHeader ? pHeader : pBlock->pHeader;
+        for (size_t i = 0; i < pHeaders->count; i++)
+        {
+            pResponse->addHeader(pHeaders->pItems[i].pName, pHeaders->pItems[i].pValue);
+        }
+
+        pRequest->send(pResponse);
+    }
+
+    size_t SelectLanguage(AsyncWebServerRequest *pRequest, const HTTPLanguage *pLanguages, size_t count,
+        size_t defaultIndex)
+    {
+        // Choice made on the page wins over the browser preference
+        size_t language = CookieLanguage(pRequest, pLanguages, count);
+        if (language == count)
+        {
+            language = AcceptedLanguage(pRequest, pLanguages, count);
+        }
+        return (language < count) ? language : defaultIndex;
+    }
+
+    uint32_t HashPath(const char *pPath, uint32_t seed)
+    {
+        uint32_t hash = seed;
+        for (; *pPath != '\0'; pPath++)
+        {
+            hash = (hash ^ static_cast<uint8_t>(*pPath)) * 16777619u;
+        }
+        return hash;
+    }
+
     void responseApplJson(AsyncWebServerRequest *pRequest, const String& page)
     {
     #if ( USING_ESP32_S2 || USING_ESP32_C3 )
@@ -286,5 +846,34 @@ namespace ESPAsync_WiFiManagerUtils {
     #endif    // ( USING_ESP32_S2 || USING_ESP32_C3 )
     }
 
+    AsyncResponseStream* beginApplJson(AsyncWebServerRequest *pRequest)
+    {
+        AsyncResponseStream *pResponse = pRequest->beginResponseStream(WM_HTTP_HEAD_CT_JSON);
+        addApplJsonHeaders(pResponse);
+        return pResponse;
+    }
+
+    void addApplJsonHeaders(AsyncWebServerResponse *pResponse)
+    {
+        pResponse->addHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
+
+    #if USING_CORS_FEATURE
+        pResponse->addHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
+    #endif
+
+        pResponse->addHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
+        pResponse->addHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+    }
+
+    void sendApplJson(AsyncWebServerRequest *pRequest, AsyncWebServerResponse *pResponse)
+    {
+        pRequest->send(pResponse);
+
+    #if ( USING_ESP32_S2 || USING_ESP32_C3 )
+        // Fix ESP32-S2 issue with WebServer (https://github.com/espressif/arduino-esp32/issues/4348)
+        delay(1);
+    #endif
+    }
+
 } // namespace ESPAsync_WiFiManagerUtils
 
@@ -5,29 +5,42 @@
 
 #include <Arduino.h>
 #include <ESPAsyncWebServer.h>
+#include <functional>
+#include <memory>
+#include <vector>
 
 
 // Forward declarations
 class AsyncWebServerRequest;
 
 
+// Length of a string array (e.g. PROGMEM asset) known at compile time. Items built with it
+// are constant-initialized, no strlen_P() scan of flash runs during static initialization.
+// Pointers don't compile here, pass the array itself.
+template <size_t N>
+constexpr size_t WM_ArrayStrLen(const char (&)[N])
+{
+    return N - 1;
+}
+
 #if defined(ESP8266) ||  defined(ESP32)
     // New macro names (item suffix) to make intent clearer
     #define WM_MEMORY_BLOCK_ITEM(name) { name, nullptr, strlen(name) }
-    #define WM_MEMORY_P_BLOCK_ITEM(name) { nullptr, name, strlen_P((PGM_P)name) }
+    // name is a string array in program memory
+    #define WM_MEMORY_P_BLOCK_ITEM(name) { nullptr, FPSTR(name), WM_ArrayStrLen(name) }
     // Backwards-compatible aliases for existing code
     #define WM_MEMORY_BLOCK2(name) { name, nullptr, nullptr strlen(name) }
-    #define WM_MEMORY_P_BLOCK2(name) { nullptr, nullptr, name, strlen_P((PGM_P)name) }
+    #define WM_MEMORY_P_BLOCK2(name) { nullptr, nullptr, FPSTR(name), WM_ArrayStrLen(name) }
     #define WM_MEMORY_S_BLOCK2(name) { nullptr, &name, nullptr, name.length() }
 #else
     // New macro names (item suffix) to make intent clearer
     #define WM_MEMORY_BLOCK_ITEM(name) { name, strlen(name) }
-    #define WM_MEMORY_P_BLOCK_ITEM(name) WM_MEMORY_BLOCK_ITEM(name)
+    #define WM_MEMORY_P_BLOCK_ITEM(name) { name, WM_ArrayStrLen(name) }
     // Backwards-compatible aliases
     #define WM_MEMORY_BLOCK(name) WM_MEMORY_BLOCK_ITEM(name)
     #define WM_MEMORY_P_BLOCK(name) WM_MEMORY_P_BLOCK_ITEM(name)
     #define WM_MEMORY_BLOCK2(name) { name, nullptr, strlen(name) }
-    #define WM_MEMORY_P_BLOCK2(name) WM_MEMORY_BLOCK2(name)
+    #define WM_MEMORY_P_BLOCK2(name) { name, nullptr, WM_ArrayStrLen(name) }
     #define WM_MEMORY_S_BLOCK2(name) { nullptr, &name, name.length() }
 #endif
 
@@ -94,11 +107,21 @@ struct HTTPHeaderBlock
     size_t count;                  // Number of items in the array
 };
 
+// Pre-compressed copy of a static file stored in program memory
+struct HTTPEncodedBlock
+{
+    const uint8_t* pData;   // Pointer to compressed data in program memory
+    size_t size;            // Size of compressed data, 0 if not available
+};
+
 struct HTTPResponseBlock
 {
     const __FlashStringHelper* pContentType; // Pointer to string in program memory
     const HTTPMemoryBlock* pBlock;  // Pointer to HttpMemoryBlock
     const HTTPHeaderBlock* pHeader; // Pointer to HTTPHeaderBlock
+    const __FlashStringHelper* pETag; // Content hash in program memory, empty or nullptr if not available
+    HTTPEncodedBlock gzip;          // Gzip-compressed content, sent when the client accepts it
+    HTTPEncodedBlock brotli;        // Brotli-compressed content, sent instead of gzip when accepted and smaller
 };
 
 struct HTTPResponseBlock2
@@ -108,34 +131,177 @@ struct HTTPResponseBlock2
     const HTTPHeaderBlock* pHeader; // Pointer to HTTPHeaderBlock
 };
 
+// Template split into literal parts at build time (file_generator.py "slots"). Each part is
+// followed by the value of its slot, placeholders are never searched for at runtime.
+const uint8_t HTTP_TEMPLATE_NO_SLOT = 0xFF;
+
+struct HTTPTemplatePart
+{
+    const char* pText;  // Literal text in program memory
+    uint8_t slot;       // Slot sent after the text, HTTP_TEMPLATE_NO_SLOT after the last part
+};
+
+struct HTTPTemplate
+{
+    const HTTPTemplatePart* pParts; // Pointer to array of HTTPTemplatePart in program memory
+    size_t count;                   // Number of items in the array
+};
+
+// String table of one language (file_generator.py "strings"), used with WM_RUNTIME_LANGUAGE
+struct HTTPLanguage
+{
+    const char* pCode;          // Primary language subtag in program memory, e.g. "en"
+    uint16_t lcid;              // LANGUAGE_LCID of the language
+    const char* pStrings;       // '\0' separated strings in program memory
+    const uint16_t* pOffsets;   // Offset of each string in pStrings, indexed by string id (template slot)
+};
+
+// Page streamed from program memory texts and owned Strings. %{name}% placeholders in templates
+// are resolved while streaming, so the page is never assembled in RAM.
+class HTTPTemplateStream
+{
+public:
+    // Sets value of the placeholder, returns false to send the placeholder as it is
+    using Resolver = std::function<bool(const char *pName, String& value)>;
+
+    explicit HTTPTemplateStream(Resolver resolver = nullptr) : _resolver(resolver) {}
+
+    // Program memory text sent as it is, nullptr is skipped
+    void add(const __FlashStringHelper *pText);
+    // Program memory template with %{name}% placeholders, nullptr is skipped
+    void addTemplate(const __FlashStringHelper *pTemplate);
+    // Dynamic text, the stream keeps it until the response is sent
+    void add(String text);
+    // Precompiled template, pValues holds the value of each slot
+    void add(const HTTPTemplate& tpl, const String *pValues);
+    // Language neutral template, slots are filled from the string table in program memory
+    void add(const HTTPTemplate& tpl, const HTTPLanguage *pLanguage);
+
+    // Fills the buffer with the next part of the page, returns 0 at the end
+    size_t read(uint8_t *pBuffer, size_t bufLen);
+    // Length of the page, false if it depends on placeholders not resolved yet
+    bool length(size_t& length) const;
+
+private:
+    static const size_t MAX_NAME_LENGTH = 23;
+
+    struct Item
+    {
+        PGM_P pText;        // Program memory text, nullptr for a String item
+        String text;        // Dynamic text
+        bool isTemplate;    // Resolve placeholders in pText
+    };
+
+    // Starts sending the value of the placeholder at pText, false if it is not one
+    bool resolve(PGM_P pText);
+
+    std::vector<Item> _items;
+    Resolver _resolver;
+    size_t _item = 0;           // Item being sent
+    size_t _offset = 0;         // Offset in the item
+    String _value;              // Value of the placeholder being sent
+    size_t _valueOffset = 0;    // Offset in _value
+};
+
 extern const HTTPHeaderBlock gHTMLHeaders;
 extern const HTTPHeaderBlock gCSSHeaders;
 extern const HTTPHeaderBlock gJSHeaders;
+extern const HTTPHeaderBlock gImmutableHeaders;
+extern const HTTPHeaderBlock gDynamicHTMLHeaders;
+
+
+// Brotli copies of the static files cost extra flash. Browsers only offer br over HTTPS,
+// so the plain HTTP portal mostly gets gzip anyway; define WM_STATIC_BROTLI 1 to store them.
+#ifndef WM_STATIC_BROTLI
+    #define WM_STATIC_BROTLI 0
+#endif
 
+#if WM_STATIC_BROTLI
+    #define WM_BROTLI_BLOCK(CONTENT) { CONTENT##_BR, CONTENT##_BR_LEN }
+#else
+    #define WM_BROTLI_BLOCK(CONTENT) { nullptr, 0 }
+#endif
 
 #define WM_DEFINE_STATIC_FILE_AS_SINGLE_BLOCK(NAME, CONTENT, CONTENT_TYPE, HEADERS) \
-    HTTPMemoryBlockItem NAME##Chunks[] = { \
-        WM_MEMORY_P_BLOCK_ITEM(FPSTR(CONTENT)) \
+    const HTTPMemoryBlockItem NAME##Chunks[] = { \
+        WM_MEMORY_P_BLOCK_ITEM(CONTENT) \
     }; \
     const HTTPMemoryBlock NAME##Block = WM_MEMORY_BLOCK(NAME##Chunks); \
     const HTTPResponseBlock NAME = { \
         FPSTR(CONTENT_TYPE), \
         &NAME##Block, \
         &HEADERS, \
+        FPSTR(CONTENT##_ETAG), \
+        { CONTENT##_GZ, CONTENT##_GZ_LEN }, \
+        WM_BROTLI_BLOCK(CONTENT), \
     }
 
+// Translated static files are served in the language of the request (wm_lang cookie, then Accept-Language)
+// instead of the one LanguageSupport.h selects. Flash holds the language neutral templates once and
+// the strings of every language; the files are assembled per request, so they are sent uncompressed.
+#ifndef WM_RUNTIME_LANGUAGE
+    #define WM_RUNTIME_LANGUAGE 0
+#endif
+
+// Translated static files look their strings up by key in a table of the client language, which lang.js
+// fetches once from the fingerprinted /lang/<code>.json and the browser keeps. Shared strings are stored
+// once per language instead of in every file, and the files themselves don't depend on the language.
+#ifndef WM_LANGUAGE_TABLE
+    #define WM_LANGUAGE_TABLE 0
+#endif
+
+#if WM_LANGUAGE_TABLE && WM_RUNTIME_LANGUAGE
+    #error "WM_LANGUAGE_TABLE and WM_RUNTIME_LANGUAGE are alternatives, define only one of them"
+#endif
+
+// Content of a translated static file in the selected mode
+#if WM_LANGUAGE_TABLE
+    #define WM_TRANSLATED_FILE(CONTENT) CONTENT##_KEYS
+#else
+    #define WM_TRANSLATED_FILE(CONTENT) CONTENT
+#endif
+
+// Static file assembled from a language neutral template (file_generator.py "language")
+struct HTTPLanguageResponseBlock
+{
+    const __FlashStringHelper* pContentType; // Pointer to string in program memory
+    const HTTPTemplate* pTemplate;  // Template with a slot for each translated string
+    const HTTPHeaderBlock* pHeader; // Pointer to HTTPHeaderBlock
+    const __FlashStringHelper* pETag; // Content hash over all languages, empty if not available
+};
+
+#define WM_DEFINE_LANGUAGE_FILE(NAME, CONTENT, CONTENT_TYPE, HEADERS) \
+    const HTTPLanguageResponseBlock NAME = { \
+        FPSTR(CONTENT_TYPE), \
+        &CONTENT##_LT, \
+        &HEADERS, \
+        FPSTR(CONTENT##_LT_ETAG), \
+    }
+
+// Macro to define a translated HTML file assembled in the language of the request
+#define WM_DEFINE_LANGUAGE_HTML_FILE(NAME, CONTENT) \
+    WM_DEFINE_LANGUAGE_FILE(NAME, CONTENT, WM_HTTP_HEAD_CT_TEXT_HTML, gHTMLHeaders)
+
+// Macro to define a translated Javascript file assembled in the language of the request
+#define WM_DEFINE_LANGUAGE_JS_FILE(NAME, CONTENT) \
+    WM_DEFINE_LANGUAGE_FILE(NAME, CONTENT, WM_HTTP_HEAD_CT_TEXT_JAVASCRIPT, gJSHeaders)
+
 // Macro to define a static HTML file stored in program memory as a single memory block
 #define WM_DEFINE_STATIC_HTML_FILE_AS_SINGLE_BLOCK(NAME, CONTENT) \
     WM_DEFINE_STATIC_FILE_AS_SINGLE_BLOCK(NAME, CONTENT, WM_HTTP_HEAD_CT_TEXT_HTML, gHTMLHeaders)
 
 // Macro to define a static Javascript file stored in program memory as a single memory block
 #define WM_DEFINE_STATIC_JS_FILE_AS_SINGLE_BLOCK(NAME, CONTENT) \
-    WM_DEFINE_STATIC_FILE_AS_SINGLE_BLOCK(NAME, CONTENT, WM_HTTP_HEAD_CT_TEXT_JAVASCRIPT, gHTMLHeaders)
+    WM_DEFINE_STATIC_FILE_AS_SINGLE_BLOCK(NAME, CONTENT, WM_HTTP_HEAD_CT_TEXT_JAVASCRIPT, gJSHeaders)
 
 // Macro to define a static Javascript file stored in program memory as a single memory block
 #define WM_DEFINE_STATIC_CSS_FILE_AS_SINGLE_BLOCK(NAME, CONTENT) \
     WM_DEFINE_STATIC_FILE_AS_SINGLE_BLOCK(NAME, CONTENT, WM_HTTP_HEAD_CT_TEXT_CSS, gCSSHeaders)
 
+// Macro to define a static JSON file stored in program memory as a single memory block, cached like scripts
+#define WM_DEFINE_STATIC_JSON_FILE_AS_SINGLE_BLOCK(NAME, CONTENT) \
+    WM_DEFINE_STATIC_FILE_AS_SINGLE_BLOCK(NAME, CONTENT, WM_HTTP_HEAD_CT_JSON, gJSHeaders)
+
 
 
 ////////////////////////////////////////////////////
@@ -146,6 +312,18 @@ const char WM_HTTP_HEAD_CT_TEXT_PLAIN[] = "text/plain";
 const char WM_HTTP_HEAD_CT_TEXT_CSS[] = "text/css";
 const char WM_HTTP_HEAD_CT_TEXT_JAVASCRIPT[] = "text/javascript";
 const char WM_HTTP_HEAD_CT_JSON[]    ="application/json";
+const char WM_HTTP_HEAD_ACCEPT_ENCODING[] = "Accept-Encoding";
+const char WM_HTTP_HEAD_CONTENT_ENCODING[] = "Content-Encoding";
+const char WM_HTTP_HEAD_VARY[]       = "Vary";
+const char WM_HTTP_ENCODING_GZIP[]   = "gzip";
+const char WM_HTTP_ENCODING_BROTLI[] = "br";
+const char WM_HTTP_HEAD_ETAG[]       = "ETag";
+const char WM_HTTP_HEAD_IF_NONE_MATCH[] = "If-None-Match";
+const char WM_HTTP_HEAD_ACCEPT_LANGUAGE[] = "Accept-Language";
+const char WM_HTTP_HEAD_CONTENT_LANGUAGE[] = "Content-Language";
+const char WM_HTTP_HEAD_COOKIE[]     = "Cookie";
+const char WM_HTTP_VARY_LANGUAGE[]   = "Accept-Language, Cookie";
+const char WM_HTTP_COOKIE_LANGUAGE[] = "wm_lang";
 
 ////////////////////////////////////////////////////
 
@@ -165,11 +343,47 @@ namespace ESPAsync_WiFiManagerUtils {
     // Utility function to respond with application/json content type
     void responseApplJson(AsyncWebServerRequest *pRequest, const String& page);
 
-    // Utility function to respond with static content and specified content type
-    void responseText(AsyncWebServerRequest *pRequest, const HTTPResponseBlock *pBlock);
+    // Start an application/json response written through a Print (e.g. JSONUtils::JSONWriter),
+    // send it with sendApplJson() once complete
+    AsyncResponseStream* beginApplJson(AsyncWebServerRequest *pRequest);
+    void sendApplJson(AsyncWebServerRequest *pRequest, AsyncWebServerResponse *pResponse);
+
+    // No-store (and CORS) headers of the application/json responses, for responses built elsewhere
+    void addApplJsonHeaders(AsyncWebServerResponse *pResponse);
+
+    // Utility function to respond with static content and specified content type,
+    // pHeader replaces the headers of the block when given
+    void responseText(AsyncWebServerRequest *pRequest, const HTTPResponseBlock *pBlock,
+        const HTTPHeaderBlock *pHeader = nullptr);
 
     // Utility function to respond with static content and specified content type
     void responseText(AsyncWebServerRequest *pRequest, const HTTPResponseBlock2 *pBlock);
+
+    // Utility function to stream a page rendered from templates, with Content-Length when it is known
+    void responseTemplate(AsyncWebServerRequest *pRequest, const __FlashStringHelper *pContentType,
+        std::shared_ptr<HTTPTemplateStream> pStream, const HTTPHeaderBlock *pHeader);
+
+    // Utility function to respond with a translated static file in the given language (item of a table in
+    // program memory), pHeader replaces the headers of the block when given
+    void responseText(AsyncWebServerRequest *pRequest, const HTTPLanguageResponseBlock *pBlock,
+        const HTTPLanguage *pLanguage, const HTTPHeaderBlock *pHeader = nullptr);
+
+    // Index of the language to answer in: the wm_lang cookie, else the best Accept-Language match
+    // on the primary subtag, else defaultIndex. pLanguages is a table in program memory.
+    size_t SelectLanguage(AsyncWebServerRequest *pRequest, const HTTPLanguage *pLanguages, size_t count,
+        size_t defaultIndex);
+
+    // 32-bit FNV-1a hash of the URL path with the seed as offset basis (matches file_generator.py)
+    uint32_t HashPath(const char *pPath, uint32_t seed);
+
+    // Standard FNV-1a offset basis, the seed of names hashed with HashName
+    constexpr uint32_t FNV1A_OFFSET_BASIS = 2166136261u;
+
+    // HashPath(pName, FNV1A_OFFSET_BASIS) usable in constant expressions
+    constexpr uint32_t HashName(const char *pName, uint32_t hash = FNV1A_OFFSET_BASIS)
+    {
+        return (*pName == '\0') ? hash : HashName(pName + 1, (hash ^ static_cast<uint8_t>(*pName)) * 16777619u);
+    }
 }
 
 #endif // ESPAsync_WiFiManagerUtils_h
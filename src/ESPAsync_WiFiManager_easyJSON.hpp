@@ -1,63 +1,86 @@
-// MIT License
+/*
+  ESPAsync_WiFiManager_easyJSON.hpp - EasyJSON document model backed by a single arena.
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
 
-#ifndef EASYJSONVARIANT_H
-#define EASYJSONVARIANT_H
+  MIT License
+*/
+
+#ifndef ESPASYNC_WIFIMANAGER_EASYJSON_HPP
+#define ESPASYNC_WIFIMANAGER_EASYJSON_HPP
 
 // Include Arduino.h before stdlib.h to avoid conflict with atexit()
 #include <Arduino.h>
 
-#include <map>
+#include "EasyJSONBase.h"
+#include "EasyJSONVariant.h"
+#include "EasyJSONObject.h"
+#include "JSONUtils.h"
+
+// JSON document whose nodes and strings all live in one arena, sized per request:
+//
+//   EasyJSONDocument doc(EasyJSONDocument::capacityFor(pBody, strlen(pBody)));
+//   if (doc.parse(pBody))
+//       ssid = doc.root()["ssid1"].asString();
+//
+//   EasyJSONObject status = doc.toObject();
+//   status.set(F("SSID"), WiFi.SSID());
+//   doc.printTo(*pResponse);
+//
+// A full arena makes further changes fail (overflow()), the handles stay valid.
+class EasyJSONDocument
+{
+public:
+    explicit EasyJSONDocument(size_t capacity) : _arena(capacity), _pRoot(nullptr) {}
+    EasyJSONDocument(void* pBuffer, size_t size) : _arena(pBuffer, size), _pRoot(nullptr) {}
+
+    // Arena size that parse() of this JSON never overflows: one node per value and the strings
+    static size_t capacityFor(const char* pJson, size_t length);
+
+    // Replaces the content of the document, false for malformed JSON or a full arena
+    bool parse(const char* pJson, size_t length);
+    bool parse(const char* pJson) { return parse(pJson, strlen(pJson)); }
+    bool parse(const String& json) { return parse(json.c_str(), json.length()); }
+
+    // Replaces the content with an empty object or array
+    EasyJSONObject toObject();
+    EasyJSONVariant toArray();
+
+    EasyJSONVariant root() { return EasyJSONVariant(&_arena, _pRoot); }
 
+    size_t printTo(Print& out) const { return EasyJSONVariant(const_cast<EasyJSONArena*>(&_arena), _pRoot).printTo(out); }
 
+    void clear();
+    bool overflow() const { return _arena.overflow(); }
+    size_t memoryUsed() const { return _arena.used(); }
 
-class EasyJSONVariant
+private:
+    friend class EasyJSONParser;
+
+    EasyJSONNode* newRoot(uint8_t type);
+
+    EasyJSONArena   _arena;
+    EasyJSONNode*   _pRoot;
+};
+
+// Builds an EasyJSONDocument from JSON written to it in pieces, e.g. by the body handler of
+// a POST request or by HTTPClient::writeToStream(), and ended with finish(). Strings are
+// limited to 255 bytes.
+class EasyJSONParser : public JSONUtils::JSONTokenizer
 {
 public:
-    enum Type
-    {
-        UNDEFINED,
-        OBJECT,
-        ARRAY,
-        STRING,
-        INT,
-        FLOAT,
-        BOOL,
-        NULLTYPE
-    };
-
-    EasyJSONVariant() : _type(UNDEFINED) {}
-    EasyJSONVariant(Type t) : _type(t) {}
-    EasyJSONVariant(const char* s) : _type(STRING), _strValue(s) {}
-    EasyJSONVariant(int i) : _type(INT)
-    {
-        _number.intValue = i;
-    }
-    EasyJSONVariant(float f) : _type(FLOAT)
-    {
-        _number.floatValue = f;
-    }
-    EasyJSONVariant(bool b) : _type(BOOL)
-    {
-        _number.boolValue = b;
-    }
-
-    Type getType() const { return _type; }
-
-    const char* asString() const { return _strValue.c_str(); }
-    int asInt() const { return _number.intValue; }
-    float asFloat() const { return _number.floatValue; }
-    bool asBool() const { return _number.boolValue; }
-    String toString() const;
+    explicit EasyJSONParser(EasyJSONDocument& document);
+
+    // The document is complete and nothing was lost to a full arena
+    bool valid() const { return complete() && !_document.overflow(); }
+
+protected:
+    void token(Token token, const char* pValue, size_t length) override;
 
 private:
-    Type _type;
-    String _strValue;
-    union {
-        int intValue;
-        float floatValue;
-        bool boolValue;
-    } _number;
+    EasyJSONDocument&   _document;
+    EasyJSONNode*       _stack[32];
+    const char*         _pKey;
+    char                _value[256];
 };
 
-
-#endif // EASYJSONVARIANT_H
+#endif // ESPASYNC_WIFIMANAGER_EASYJSON_HPP
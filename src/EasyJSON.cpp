@@ -0,0 +1,700 @@
+/*
+  EasyJSON.cpp - EasyJSON document model backed by a single arena.
+  Copyright (c) 2024 Peter Kaleja.  All right reserved.
+
+  MIT License
+*/
+
+#include "ESPAsync_WiFiManager_easyJSON.hpp"
+
+#include <limits.h>
+
+namespace {
+    EasyJSONNode* NewNode(EasyJSONArena* pArena, uint8_t type, const char* pKey = nullptr, bool isKeyInFlash = false)
+    {
+        if (pArena == nullptr)
+        {
+            return nullptr;
+        }
+
+        EasyJSONNode* pNode = static_cast<EasyJSONNode*>(pArena->allocate(sizeof(EasyJSONNode), alignof(EasyJSONNode)));
+        if (pNode == nullptr)
+        {
+            return nullptr;
+        }
+
+        pNode->pNext = nullptr;
+        pNode->pKey = pKey;
+        pNode->value.children.pFirst = nullptr;
+        pNode->value.children.pLast = nullptr;
+        pNode->type = type;
+        pNode->flags = isKeyInFlash ? EasyJSONNode::KeyInFlash : 0;
+        return pNode;
+    }
+
+    void Link(EasyJSONNode* pParent, EasyJSONNode* pNode)
+    {
+        if (pParent->value.children.pLast != nullptr)
+        {
+            pParent->value.children.pLast->pNext = pNode;
+        }
+        else
+        {
+            pParent->value.children.pFirst = pNode;
+        }
+        pParent->value.children.pLast = pNode;
+    }
+
+    bool IsContainer(const EasyJSONNode* pNode)
+    {
+        return pNode != nullptr && (pNode->type == EasyJSONVariant::OBJECT || pNode->type == EasyJSONVariant::ARRAY);
+    }
+
+    // Either side may be in flash
+    bool KeyEquals(const char* pKey, bool isKeyInFlash, const char* pOther, bool isOtherInFlash)
+    {
+        for (;; pKey++, pOther++)
+        {
+            char a = isKeyInFlash ? (char) pgm_read_byte(pKey) : *pKey;
+            char b = isOtherInFlash ? (char) pgm_read_byte(pOther) : *pOther;
+            if (a != b)
+            {
+                return false;
+            }
+            if (a == 0)
+            {
+                return true;
+            }
+        }
+    }
+
+    const char* CopyFlashString(EasyJSONArena* pArena, const __FlashStringHelper* value)
+    {
+        PGM_P pValue = reinterpret_cast<PGM_P>(value);
+        size_t length = strlen_P(pValue);
+        char* pCopy = static_cast<char*>(pArena->allocate(length + 1, 1));
+        if (pCopy != nullptr)
+        {
+            memcpy_P(pCopy, pValue, length + 1);
+        }
+        return pCopy;
+    }
+
+    void PrintNode(JSONUtils::JSONWriter& json, const EasyJSONNode* pNode)
+    {
+        switch (pNode->type)
+        {
+            case EasyJSONVariant::OBJECT:
+                json.BeginObject();
+                for (const EasyJSONNode* pItem = pNode->value.children.pFirst; pItem != nullptr; pItem = pItem->pNext)
+                {
+                    if (pItem->flags & EasyJSONNode::KeyInFlash)
+                    {
+                        json.Key(reinterpret_cast<const __FlashStringHelper*>(pItem->pKey));
+                    }
+                    else
+                    {
+                        json.Key(pItem->pKey);
+                    }
+                    PrintNode(json, pItem);
+                }
+                json.EndObject();
+                break;
+
+            case EasyJSONVariant::ARRAY:
+                json.BeginArray();
+                for (const EasyJSONNode* pItem = pNode->value.children.pFirst; pItem != nullptr; pItem = pItem->pNext)
+                {
+                    PrintNode(json, pItem);
+                }
+                json.EndArray();
+                break;
+
+            case EasyJSONVariant::STRING:  json.Value(pNode->value.pString);      break;
+            case EasyJSONVariant::INT:     json.Value(pNode->value.intValue);     break;
+            case EasyJSONVariant::FLOAT:   json.Value(pNode->value.floatValue);   break;
+            case EasyJSONVariant::BOOL:    json.Value(pNode->value.boolValue);    break;
+            default:                       json.Null();                           break;
+        }
+    }
+
+    // Passes the output on and counts it, Print implementations don't all report it reliably
+    class CountingPrint : public Print
+    {
+    public:
+        explicit CountingPrint(Print& out) : _out(out), count(0) {}
+        size_t write(uint8_t c) override { size_t n = _out.write(c); count += n; return n; }
+        size_t write(const uint8_t* pData, size_t size) override { size_t n = _out.write(pData, size); count += n; return n; }
+
+        Print&  _out;
+        size_t  count;
+    };
+
+    class StringPrint : public Print
+    {
+    public:
+        explicit StringPrint(String& s) : _s(s) {}
+        size_t write(uint8_t c) override { _s += (char) c; return 1; }
+
+        String& _s;
+    };
+
+    // Counts the bytes instead of storing them
+    class LengthPrint : public Print
+    {
+    public:
+        size_t write(uint8_t) override { return 1; }
+        size_t write(const uint8_t*, size_t size) override { return size; }
+    };
+}
+
+//////////////////////////////////////////
+
+EasyJSONArena::EasyJSONArena(void* pBuffer, size_t size)
+    : _pBuffer(static_cast<uint8_t*>(pBuffer)), _size(size), _used(0), _owned(false), _overflow(false)
+{
+}
+
+EasyJSONArena::EasyJSONArena(size_t size)
+    : _pBuffer(static_cast<uint8_t*>(malloc(size))), _size(size), _used(0), _owned(true), _overflow(false)
+{
+    if (_pBuffer == nullptr)
+    {
+        _size = 0;
+        _overflow = true;
+    }
+}
+
+EasyJSONArena::~EasyJSONArena()
+{
+    if (_owned)
+    {
+        free(_pBuffer);
+    }
+}
+
+void* EasyJSONArena::allocate(size_t size, size_t alignment)
+{
+    uintptr_t address = reinterpret_cast<uintptr_t>(_pBuffer) + _used;
+    size_t padding = (alignment - (address % alignment)) % alignment;
+
+    if (_pBuffer == nullptr || padding + size > _size - _used)
+    {
+        _overflow = true;
+        return nullptr;
+    }
+
+    void* p = _pBuffer + _used + padding;
+    _used += padding + size;
+    return p;
+}
+
+const char* EasyJSONArena::copy(const char* pString, size_t length)
+{
+    char* pCopy = static_cast<char*>(allocate(length + 1, 1));
+    if (pCopy != nullptr)
+    {
+        memcpy(pCopy, pString, length);
+        pCopy[length] = 0;
+    }
+    return pCopy;
+}
+
+void EasyJSONArena::clear()
+{
+    _used = 0;
+    _overflow = (_pBuffer == nullptr);
+}
+
+//////////////////////////////////////////
+
+const char* EasyJSONVariant::asString() const
+{
+    return (getType() == STRING) ? _pNode->value.pString : nullptr;
+}
+
+int EasyJSONVariant::asInt() const
+{
+    return (int) asLong();
+}
+
+long EasyJSONVariant::asLong() const
+{
+    switch (getType())
+    {
+        case INT:   return _pNode->value.intValue;
+        case FLOAT: return (long) _pNode->value.floatValue;
+        default:    return 0;
+    }
+}
+
+float EasyJSONVariant::asFloat() const
+{
+    switch (getType())
+    {
+        case INT:   return (float) _pNode->value.intValue;
+        case FLOAT: return _pNode->value.floatValue;
+        default:    return 0;
+    }
+}
+
+bool EasyJSONVariant::asBool() const
+{
+    return (getType() == BOOL) && _pNode->value.boolValue;
+}
+
+size_t EasyJSONVariant::size() const
+{
+    size_t count = 0;
+    if (IsContainer(_pNode))
+    {
+        for (const EasyJSONNode* pItem = _pNode->value.children.pFirst; pItem != nullptr; pItem = pItem->pNext)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+EasyJSONVariant EasyJSONVariant::operator[](size_t index) const
+{
+    if (getType() != ARRAY)
+    {
+        return EasyJSONVariant();
+    }
+
+    EasyJSONNode* pItem = _pNode->value.children.pFirst;
+    while (pItem != nullptr && index-- > 0)
+    {
+        pItem = pItem->pNext;
+    }
+    return EasyJSONVariant(_pArena, pItem);
+}
+
+EasyJSONVariant EasyJSONVariant::operator[](const char* key) const
+{
+    return EasyJSONVariant(_pArena, find(key, false));
+}
+
+EasyJSONVariant EasyJSONVariant::operator[](const __FlashStringHelper* key) const
+{
+    return EasyJSONVariant(_pArena, find(reinterpret_cast<const char*>(key), true));
+}
+
+EasyJSONObject EasyJSONVariant::asObject() const
+{
+    return EasyJSONObject(_pArena, _pNode);
+}
+
+EasyJSONNode* EasyJSONVariant::find(const char* key, bool isKeyInFlash, EasyJSONNode** ppPrevious) const
+{
+    if (getType() != OBJECT || key == nullptr)
+    {
+        return nullptr;
+    }
+
+    EasyJSONNode* pPrevious = nullptr;
+    for (EasyJSONNode* pItem = _pNode->value.children.pFirst; pItem != nullptr; pItem = pItem->pNext)
+    {
+        if (KeyEquals(pItem->pKey, pItem->flags & EasyJSONNode::KeyInFlash, key, isKeyInFlash))
+        {
+            if (ppPrevious != nullptr)
+            {
+                *ppPrevious = pPrevious;
+            }
+            return pItem;
+        }
+        pPrevious = pItem;
+    }
+    return nullptr;
+}
+
+EasyJSONNode* EasyJSONVariant::append(Type type, const char* pKey, bool isKeyInFlash)
+{
+    if (!IsContainer(_pNode))
+    {
+        return nullptr;
+    }
+
+    EasyJSONNode* pNode = NewNode(_pArena, type, pKey, isKeyInFlash);
+    if (pNode != nullptr)
+    {
+        Link(_pNode, pNode);
+    }
+    return pNode;
+}
+
+EasyJSONVariant EasyJSONVariant::add(const char* value)
+{
+    EasyJSONVariant item(_pArena, (getType() == ARRAY) ? append(NULLTYPE) : nullptr);
+    item.set(value);
+    return item;
+}
+
+EasyJSONVariant EasyJSONVariant::add(const __FlashStringHelper* value)
+{
+    EasyJSONVariant item(_pArena, (getType() == ARRAY) ? append(NULLTYPE) : nullptr);
+    item.set(value);
+    return item;
+}
+
+EasyJSONVariant EasyJSONVariant::add(long value)
+{
+    EasyJSONVariant item(_pArena, (getType() == ARRAY) ? append(NULLTYPE) : nullptr);
+    item.set(value);
+    return item;
+}
+
+EasyJSONVariant EasyJSONVariant::add(float value)
+{
+    EasyJSONVariant item(_pArena, (getType() == ARRAY) ? append(NULLTYPE) : nullptr);
+    item.set(value);
+    return item;
+}
+
+EasyJSONVariant EasyJSONVariant::add(bool value)
+{
+    EasyJSONVariant item(_pArena, (getType() == ARRAY) ? append(NULLTYPE) : nullptr);
+    item.set(value);
+    return item;
+}
+
+EasyJSONVariant EasyJSONVariant::addNull()
+{
+    return EasyJSONVariant(_pArena, (getType() == ARRAY) ? append(NULLTYPE) : nullptr);
+}
+
+EasyJSONObject EasyJSONVariant::addObject()
+{
+    return EasyJSONObject(_pArena, (getType() == ARRAY) ? append(OBJECT) : nullptr);
+}
+
+EasyJSONVariant EasyJSONVariant::addArray()
+{
+    return EasyJSONVariant(_pArena, (getType() == ARRAY) ? append(ARRAY) : nullptr);
+}
+
+void EasyJSONVariant::set(const char* value)
+{
+    if (_pNode == nullptr)
+    {
+        return;
+    }
+
+    if (value == nullptr)
+    {
+        setNull();
+        return;
+    }
+
+    const char* pCopy = _pArena->copy(value, strlen(value));
+    if (pCopy != nullptr)
+    {
+        _pNode->type = STRING;
+        _pNode->value.pString = pCopy;
+    }
+}
+
+void EasyJSONVariant::set(const __FlashStringHelper* value)
+{
+    if (_pNode == nullptr)
+    {
+        return;
+    }
+
+    if (value == nullptr)
+    {
+        setNull();
+        return;
+    }
+
+    const char* pCopy = CopyFlashString(_pArena, value);
+    if (pCopy != nullptr)
+    {
+        _pNode->type = STRING;
+        _pNode->value.pString = pCopy;
+    }
+}
+
+void EasyJSONVariant::set(long value)
+{
+    if (_pNode != nullptr)
+    {
+        _pNode->type = INT;
+        _pNode->value.intValue = value;
+    }
+}
+
+void EasyJSONVariant::set(float value)
+{
+    if (_pNode != nullptr)
+    {
+        _pNode->type = FLOAT;
+        _pNode->value.floatValue = value;
+    }
+}
+
+void EasyJSONVariant::set(bool value)
+{
+    if (_pNode != nullptr)
+    {
+        _pNode->type = BOOL;
+        _pNode->value.boolValue = value;
+    }
+}
+
+void EasyJSONVariant::setNull()
+{
+    if (_pNode != nullptr)
+    {
+        _pNode->type = NULLTYPE;
+    }
+}
+
+size_t EasyJSONVariant::printTo(Print& out) const
+{
+    if (_pNode == nullptr)
+    {
+        return 0;
+    }
+
+    CountingPrint counter(out);
+
+    JSONUtils::JSONWriter json(counter);
+    PrintNode(json, _pNode);
+    return counter.count;
+}
+
+String EasyJSONVariant::toString() const
+{
+    LengthPrint length;
+    String result;
+
+    result.reserve(printTo(length));
+
+    StringPrint out(result);
+    printTo(out);
+    return result;
+}
+
+//////////////////////////////////////////
+
+EasyJSONNode* EasyJSONObject::member(const char* key)
+{
+    if (_pNode == nullptr || key == nullptr)
+    {
+        return nullptr;
+    }
+
+    EasyJSONNode* pMember = find(key, false);
+    if (pMember == nullptr)
+    {
+        const char* pKey = _pArena->copy(key, strlen(key));
+        pMember = pKey ? append(NULLTYPE, pKey) : nullptr;
+    }
+    return pMember;
+}
+
+EasyJSONNode* EasyJSONObject::member(const __FlashStringHelper* key)
+{
+    if (_pNode == nullptr || key == nullptr)
+    {
+        return nullptr;
+    }
+
+    EasyJSONNode* pMember = find(reinterpret_cast<const char*>(key), true);
+    if (pMember == nullptr)
+    {
+        pMember = append(NULLTYPE, reinterpret_cast<const char*>(key), true);
+    }
+    return pMember;
+}
+
+void EasyJSONObject::unlink(const char* key, bool isKeyInFlash)
+{
+    EasyJSONNode* pPrevious = nullptr;
+    EasyJSONNode* pMember = find(key, isKeyInFlash, &pPrevious);
+
+    if (pMember == nullptr)
+    {
+        return;
+    }
+
+    if (pPrevious != nullptr)
+    {
+        pPrevious->pNext = pMember->pNext;
+    }
+    else
+    {
+        _pNode->value.children.pFirst = pMember->pNext;
+    }
+
+    if (_pNode->value.children.pLast == pMember)
+    {
+        _pNode->value.children.pLast = pPrevious;
+    }
+}
+
+EasyJSONNode* EasyJSONObject::reset(EasyJSONNode* pNode, Type type)
+{
+    pNode->type = type;
+    pNode->value.children.pFirst = nullptr;
+    pNode->value.children.pLast = nullptr;
+    return pNode;
+}
+
+//////////////////////////////////////////
+
+EasyJSONNode* EasyJSONDocument::newRoot(uint8_t type)
+{
+    clear();
+    _pRoot = NewNode(&_arena, type);
+    return _pRoot;
+}
+
+void EasyJSONDocument::clear()
+{
+    _arena.clear();
+    _pRoot = nullptr;
+}
+
+EasyJSONObject EasyJSONDocument::toObject()
+{
+    return EasyJSONObject(&_arena, newRoot(EasyJSONVariant::OBJECT));
+}
+
+EasyJSONVariant EasyJSONDocument::toArray()
+{
+    return EasyJSONVariant(&_arena, newRoot(EasyJSONVariant::ARRAY));
+}
+
+size_t EasyJSONDocument::capacityFor(const char* pJson, size_t length)
+{
+    // Every value but the first follows a comma or opens a container, counting them in strings
+    // too only overestimates. A copied string is never longer than it is in the JSON.
+    size_t nodes = 1;
+    for (size_t i = 0; i < length; i++)
+    {
+        if (pJson[i] == ',' || pJson[i] == '[' || pJson[i] == '{')
+        {
+            nodes++;
+        }
+    }
+    return length + nodes * (sizeof(EasyJSONNode) + alignof(EasyJSONNode) - 1);
+}
+
+bool EasyJSONDocument::parse(const char* pJson, size_t length)
+{
+    clear();
+
+    EasyJSONParser parser(*this);
+    parser.write(reinterpret_cast<const uint8_t*>(pJson), length);
+    parser.finish();
+
+    // overflow() stays set to tell a full arena from malformed JSON
+    if (!parser.valid())
+    {
+        _pRoot = nullptr;
+        return false;
+    }
+    return true;
+}
+
+//////////////////////////////////////////
+
+EasyJSONParser::EasyJSONParser(EasyJSONDocument& document)
+    : JSONUtils::JSONTokenizer(_value, sizeof(_value)), _document(document), _pKey(nullptr)
+{
+    _document.clear();
+}
+
+void EasyJSONParser::token(Token token, const char* pValue, size_t length)
+{
+    EasyJSONArena* pArena = &_document._arena;
+    uint8_t type;
+
+    switch (token)
+    {
+        case TokenKey:
+            _pKey = pArena->copy(pValue, length);
+            return;
+
+        case TokenObjectEnd:
+        case TokenArrayEnd:
+            return;
+
+        case TokenObjectStart:  type = EasyJSONVariant::OBJECT;      break;
+        case TokenArrayStart:   type = EasyJSONVariant::ARRAY;       break;
+        case TokenString:       type = EasyJSONVariant::STRING;      break;
+        case TokenTrue:
+        case TokenFalse:        type = EasyJSONVariant::BOOL;        break;
+        case TokenNull:         type = EasyJSONVariant::NULLTYPE;    break;
+        default:
+            type = (strpbrk(pValue, ".eE") != nullptr) ? EasyJSONVariant::FLOAT : EasyJSONVariant::INT;
+            break;
+    }
+
+    // Containers are on the stack already, depth() counts them
+    bool isContainer = (token == TokenObjectStart || token == TokenArrayStart);
+    uint8_t level = isContainer ? depth() - 1 : depth();
+    EasyJSONNode* pParent = (level > 0) ? _stack[level - 1] : nullptr;
+    EasyJSONNode* pNode = nullptr;
+
+    // Nothing is attached below a node lost to a full arena, the document is invalid anyway
+    if (level == 0 || (pParent != nullptr && (pParent->type == EasyJSONVariant::ARRAY || _pKey != nullptr)))
+    {
+        pNode = NewNode(pArena, type, _pKey);
+    }
+    _pKey = nullptr;
+
+    if (isContainer)
+    {
+        _stack[level] = pNode;
+    }
+
+    if (pNode == nullptr)
+    {
+        return;
+    }
+
+    switch (type)
+    {
+        case EasyJSONVariant::STRING:
+            pNode->value.pString = pArena->copy(pValue, length);
+            if (pNode->value.pString == nullptr)
+            {
+                return;
+            }
+            break;
+
+        case EasyJSONVariant::BOOL:
+            pNode->value.boolValue = (token == TokenTrue);
+            break;
+
+        case EasyJSONVariant::INT:
+            pNode->value.intValue = strtol(pValue, nullptr, 10);
+            // Out of range of long, kept approximately
+            if (pNode->value.intValue == LONG_MAX || pNode->value.intValue == LONG_MIN)
+            {
+                pNode->type = EasyJSONVariant::FLOAT;
+                pNode->value.floatValue = strtof(pValue, nullptr);
+            }
+            break;
+
+        case EasyJSONVariant::FLOAT:
+            pNode->value.floatValue = strtof(pValue, nullptr);
+            break;
+
+        default:
+            break;
+    }
+
+    if (pParent == nullptr)
+    {
+        _document._pRoot = pNode;
+    }
+    else
+    {
+        Link(pParent, pNode);
+    }
+}
@@ -1,5 +1,5 @@
 /*
-  EasyJSONBase.h - EasyJSONBase class used internally.
+  EasyJSONBase.h - EasyJSONArena and EasyJSONNode used internally.
   Copyright (c) 2024 Peter Kaleja.  All right reserved.
 
   MIT License
@@ -11,19 +11,64 @@
 // Include Arduino.h before stdlib.h to avoid conflict with atexit()
 #include <Arduino.h>
 
-/*
-
-class EasyJSONBase
+// Bump allocator behind an EasyJSONDocument. Nodes and strings are carved out of one block
+// and released all at once, nothing is freed one by one. An allocation that doesn't fit fails
+// and sets overflow().
+class EasyJSONArena
 {
 public:
-    virtual ~EasyJSONBase() {}
+    // Block of the caller, e.g. a buffer on the stack
+    EasyJSONArena(void* pBuffer, size_t size);
+    // Block allocated once, sized for the request
+    explicit EasyJSONArena(size_t size);
+    ~EasyJSONArena();
+
+    EasyJSONArena(const EasyJSONArena&) = delete;
+    EasyJSONArena& operator=(const EasyJSONArena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(void*));
+    // Null terminated copy of the string, nullptr when full
+    const char* copy(const char* pString, size_t length);
+    // Releases everything allocated so far
+    void clear();
 
-    virtual String toString() const = 0;
+    size_t used() const { return _used; }
+    size_t capacity() const { return _size; }
+    bool overflow() const { return _overflow; }
 
 private:
-    EasyJSONVariant* _pValue;
+    uint8_t*    _pBuffer;
+    size_t      _size;
+    size_t      _used;
+    bool        _owned;
+    bool        _overflow;
 };
 
-*/
+// Value of a document as laid out in the arena. Objects and arrays keep their items in a
+// single linked list, members carry their name in pKey.
+struct EasyJSONNode
+{
+    enum Flags : uint8_t
+    {
+        KeyInFlash = 1         // pKey points to program memory (F() key), it was not copied
+    };
+
+    EasyJSONNode*   pNext;
+    const char*     pKey;
+    union
+    {
+        struct
+        {
+            EasyJSONNode*   pFirst;
+            EasyJSONNode*   pLast;
+        } children;
+        const char*     pString;
+        long            intValue;
+        float           floatValue;
+        bool            boolValue;
+    } value;
+    uint8_t         type;       // EasyJSONVariant::Type
+    uint8_t         flags;
+};
 
 #endif // EASYJSONBASE_H
@@ -1,5 +1,5 @@
 /*
-  EasyJSONObject.h - EasyJSONBase class used internally.
+  EasyJSONObject.h - EasyJSONObject class used internally.
   Copyright (c) 2024 Peter Kaleja.  All right reserved.
 
   MIT License
@@ -10,46 +10,61 @@
 
 // Include Arduino.h before stdlib.h to avoid conflict with atexit()
 #include <Arduino.h>
-#include <map>
 
-/*
-#include "EasyJSONBase.h"
 #include "EasyJSONVariant.h"
 
-class EasyJSONObject : public EasyJSONBase
+// Handle of an object in an EasyJSONDocument. Keys given as F() strings are kept in flash,
+// other keys and all strings are copied into the arena of the document.
+class EasyJSONObject : public EasyJSONVariant
 {
 public:
     EasyJSONObject() {}
-    ~EasyJSONObject() {}
+    EasyJSONObject(EasyJSONArena* pArena, EasyJSONNode* pNode)
+        : EasyJSONVariant(pArena, (pNode && pNode->type == OBJECT) ? pNode : nullptr) {}
 
-    void set(const String& key, const EasyJSONVariant& value) {
-        _data[key] = value;
+    // Adds the member, or replaces the value of an existing one
+    template <typename K, typename V>
+    EasyJSONVariant set(K key, V value)
+    {
+        EasyJSONVariant item(_pArena, member(key));
+        item.set(value);
+        return item;
     }
 
-    EasyJSONVariant get(const String& key) const {
-        auto it = _data.find(key);
-        if (it != _data.end()) {
-            return it->second;
-        }
-        return EasyJSONVariant(EasyJSONVariant::UNDEFINED);
+    template <typename K>
+    EasyJSONVariant get(K key) const
+    {
+        return (*this)[key];
     }
 
-    bool contains(const String& key) const {
-        return _data.find(key) != _data.end();
-    }
+    bool contains(const char* key) const { return find(key, false) != nullptr; }
+    bool contains(const __FlashStringHelper* key) const { return find(reinterpret_cast<const char*>(key), true) != nullptr; }
+
+    // The member is unlinked, its memory stays in the arena until the document is cleared
+    void remove(const char* key) { unlink(key, false); }
+    void remove(const __FlashStringHelper* key) { unlink(reinterpret_cast<const char*>(key), true); }
 
-    void remove(const String& key) {
-        _data.erase(key);
+    // Adds (or replaces) a member holding a new, empty object or array
+    template <typename K>
+    EasyJSONObject createObject(K key)
+    {
+        EasyJSONNode* pMember = member(key);
+        return EasyJSONObject(_pArena, pMember ? reset(pMember, OBJECT) : nullptr);
     }
 
-    size_t size() const {
-        return _data.size();
+    template <typename K>
+    EasyJSONVariant createArray(K key)
+    {
+        EasyJSONNode* pMember = member(key);
+        return EasyJSONVariant(_pArena, pMember ? reset(pMember, ARRAY) : nullptr);
     }
 
 private:
-    std::map<String, EasyJSONBase*> _data;
+    EasyJSONNode* member(const char* key);
+    EasyJSONNode* member(const __FlashStringHelper* key);
+    EasyJSONNode* member(const String& key) { return member(key.c_str()); }
+    void unlink(const char* key, bool isKeyInFlash);
+    static EasyJSONNode* reset(EasyJSONNode* pNode, Type type);
 };
 
-*/
-
 #endif // EASYJSONOBJECT_H
@@ -11,8 +11,12 @@
 // Include Arduino.h before stdlib.h to avoid conflict with atexit()
 #include <Arduino.h>
 
-/*
+#include "EasyJSONBase.h"
+
+class EasyJSONObject;
 
+// Handle of a value in an EasyJSONDocument, cheap to copy. A handle of a missing value
+// (wrong key, index out of range, full arena) is UNDEFINED and ignores changes.
 class EasyJSONVariant
 {
 public:
@@ -28,40 +32,66 @@ public:
         NULLTYPE
     };
 
-    EasyJSONVariant() : _type(UNDEFINED) {}
-    EasyJSONVariant(Type t) : _type(t) {}
-    EasyJSONVariant(const char* s) : _type(STRING), _strValue(s) {}
-    EasyJSONVariant(int i) : _type(INT)
-    {
-        _number.intValue = i;
-    }
-    EasyJSONVariant(float f) : _type(FLOAT)
-    {
-        _number.floatValue = f;
-    }
-    EasyJSONVariant(bool b) : _type(BOOL)
-    {
-        _number.boolValue = b;
-    }
+    EasyJSONVariant() : _pArena(nullptr), _pNode(nullptr) {}
+    EasyJSONVariant(EasyJSONArena* pArena, EasyJSONNode* pNode) : _pArena(pArena), _pNode(pNode) {}
+
+    Type getType() const { return _pNode ? (Type) _pNode->type : UNDEFINED; }
+    bool isDefined() const { return _pNode != nullptr; }
 
-    Type getType() const { return _type; }
+    // nullptr unless STRING
+    const char* asString() const;
+    // Numbers convert to each other, anything else is 0
+    int asInt() const;
+    long asLong() const;
+    float asFloat() const;
+    bool asBool() const;
 
-    const char* asString() const { return _strValue.c_str(); }
-    int asInt() const { return _number.intValue; }
-    float asFloat() const { return _number.floatValue; }
-    bool asBool() const { return _number.boolValue; }
+    // Items of an array or members of an object
+    size_t size() const;
+    EasyJSONVariant operator[](size_t index) const;
+    EasyJSONVariant operator[](int index) const { return (*this)[(size_t) index]; }
+    EasyJSONVariant operator[](const char* key) const;
+    EasyJSONVariant operator[](const __FlashStringHelper* key) const;
+    EasyJSONVariant operator[](const String& key) const { return (*this)[key.c_str()]; }
+    // The value as an object, UNDEFINED unless OBJECT
+    EasyJSONObject asObject() const;
+
+    // Appending to an array, the new item is returned
+    EasyJSONVariant add(const char* value);
+    EasyJSONVariant add(const String& value) { return add(value.c_str()); }
+    EasyJSONVariant add(const __FlashStringHelper* value);
+    EasyJSONVariant add(int value) { return add((long) value); }
+    EasyJSONVariant add(unsigned int value) { return add((long) value); }
+    EasyJSONVariant add(long value);
+    EasyJSONVariant add(unsigned long value) { return add((long) value); }
+    EasyJSONVariant add(float value);
+    EasyJSONVariant add(bool value);
+    EasyJSONVariant addNull();
+    EasyJSONObject addObject();
+    EasyJSONVariant addArray();
+
+    // Replaces the value, a member keeps its name
+    void set(const char* value);
+    void set(const String& value) { set(value.c_str()); }
+    void set(const __FlashStringHelper* value);
+    void set(int value) { set((long) value); }
+    void set(unsigned int value) { set((long) value); }
+    void set(long value);
+    void set(unsigned long value) { set((long) value); }
+    void set(float value);
+    void set(bool value);
+    void setNull();
+
+    size_t printTo(Print& out) const;
     String toString() const;
 
-private:
-    Type _type;
-    String _strValue;
-    union {
-        int intValue;
-        float floatValue;
-        bool boolValue;
-    } _number;
-};
+protected:
+    // New node of the type attached to this array or object, nullptr when that isn't possible
+    EasyJSONNode* append(Type type, const char* pKey = nullptr, bool isKeyInFlash = false);
+    EasyJSONNode* find(const char* key, bool isKeyInFlash, EasyJSONNode** ppPrevious = nullptr) const;
 
-*/
+    EasyJSONArena*  _pArena;
+    EasyJSONNode*   _pNode;
+};
 
 #endif // EASYJSONVARIANT_H
@@ -167,4 +167,731 @@ namespace JSONUtils{
     {
         return ArrayStart() + content + ArrayEnd() ;
     }
-}
\ No newline at end of file
+
+
+    JSONBuffer::JSONBuffer(char* pBuffer, size_t size)
+        : _pBuffer(pBuffer), _size(size), _length(0), _overflow(false)
+    {
+        clear();
+    }
+
+    void JSONBuffer::clear()
+    {
+        _length = 0;
+        _overflow = false;
+        if (_size > 0)
+        {
+            _pBuffer[0] = 0;
+        }
+    }
+
+    size_t JSONBuffer::write(uint8_t c)
+    {
+        return write(&c, 1);
+    }
+
+    size_t JSONBuffer::write(const uint8_t* pData, size_t size)
+    {
+        // One byte is kept for the terminator
+        size_t room = (_length + 1 < _size) ? _size - _length - 1 : 0;
+        if (size > room)
+        {
+            _overflow = true;
+            size = room;
+        }
+        memcpy(_pBuffer + _length, pData, size);
+        _length += size;
+        if (_size > 0)
+        {
+            _pBuffer[_length] = 0;
+        }
+        return size;
+    }
+
+
+    JSONWriter::JSONWriter(Print& out)
+        : _out(out), _hasItems(0), _depth(0), _afterKey(false)
+    {
+    }
+
+    void JSONWriter::separator()
+    {
+        if (_afterKey)
+        {
+            _afterKey = false;
+            return;
+        }
+
+        if (_depth == 0 || _depth > 32)
+        {
+            return;
+        }
+
+        uint32_t bit = 1UL << (_depth - 1);
+        if (_hasItems & bit)
+        {
+            _out.write(',');
+        }
+        _hasItems |= bit;
+    }
+
+    void JSONWriter::open(char c)
+    {
+        separator();
+        _out.write(c);
+        _depth++;
+        if (_depth <= 32)
+        {
+            _hasItems &= ~(1UL << (_depth - 1));
+        }
+    }
+
+    void JSONWriter::close(char c)
+    {
+        _out.write(c);
+        if (_depth > 0)
+        {
+            _depth--;
+        }
+    }
+
+    JSONWriter& JSONWriter::BeginObject()
+    {
+        open('{');
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::EndObject()
+    {
+        close('}');
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::BeginArray()
+    {
+        open('[');
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::EndArray()
+    {
+        close(']');
+        return *this;
+    }
+
+    // Quoted and escaped, runs of plain characters are passed to the Print in one call
+    void JSONWriter::string(const char* pValue, bool isFlash)
+    {
+        static const char hex[] = "0123456789abcdef";
+        char run[32];
+        size_t runLength = 0;
+
+        _out.write('"');
+        for (;;)
+        {
+            char c = isFlash ? (char) pgm_read_byte(pValue) : *pValue;
+            pValue++;
+
+            if (c == 0)
+            {
+                break;
+            }
+
+            const char* pEscape = nullptr;
+            char unicode[7];
+
+            switch (c)
+            {
+                case '"':  pEscape = "\\\""; break;
+                case '\\': pEscape = "\\\\"; break;
+                case '\n': pEscape = "\\n"; break;
+                case '\r': pEscape = "\\r"; break;
+                case '\t': pEscape = "\\t"; break;
+                case '\b': pEscape = "\\b"; break;
+                case '\f': pEscape = "\\f"; break;
+                default:
+                    if ((uint8_t) c < 0x20)
+                    {
+                        memcpy(unicode, "\\u00", 4);
+                        unicode[4] = hex[(uint8_t) c >> 4];
+                        unicode[5] = hex[c & 0x0F];
+                        unicode[6] = 0;
+                        pEscape = unicode;
+                    }
+                    break;
+            }
+
+            if (pEscape == nullptr && runLength < sizeof(run))
+            {
+                run[runLength++] = c;
+                continue;
+            }
+
+            if (runLength > 0)
+            {
+                _out.write((const uint8_t*) run, runLength);
+                runLength = 0;
+            }
+
+            if (pEscape != nullptr)
+            {
+                _out.write((const uint8_t*) pEscape, strlen(pEscape));
+            }
+            else
+            {
+                run[runLength++] = c;
+            }
+        }
+
+        if (runLength > 0)
+        {
+            _out.write((const uint8_t*) run, runLength);
+        }
+        _out.write('"');
+    }
+
+    JSONWriter& JSONWriter::Key(const char* key)
+    {
+        separator();
+        string(key, false);
+        _out.write(':');
+        _afterKey = true;
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Key(const __FlashStringHelper* key)
+    {
+        separator();
+        string(reinterpret_cast<const char*>(key), true);
+        _out.write(':');
+        _afterKey = true;
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Value(const char* pValue)
+    {
+        if (pValue == nullptr)
+        {
+            return Null();
+        }
+        separator();
+        string(pValue, false);
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Value(const String& value)
+    {
+        separator();
+        string(value.c_str(), false);
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Value(const __FlashStringHelper* pValue)
+    {
+        if (pValue == nullptr)
+        {
+            return Null();
+        }
+        separator();
+        string(reinterpret_cast<const char*>(pValue), true);
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Value(int value)
+    {
+        separator();
+        _out.print(value);
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Value(unsigned int value)
+    {
+        separator();
+        _out.print(value);
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Value(long value)
+    {
+        separator();
+        _out.print(value);
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Value(unsigned long value)
+    {
+        separator();
+        _out.print(value);
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Value(float value)
+    {
+        // NaN and infinity have no JSON representation
+        if (isnan(value) || isinf(value))
+        {
+            return Null();
+        }
+        separator();
+        _out.print(value, 2);
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Value(bool value)
+    {
+        separator();
+        _out.print(value ? F("true") : F("false"));
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Value(const IPAddress& value)
+    {
+        separator();
+        _out.write('"');
+        for (int i = 0; i < 4; i++)
+        {
+            if (i > 0)
+            {
+                _out.write('.');
+            }
+            _out.print((unsigned int) value[i]);
+        }
+        _out.write('"');
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::Null()
+    {
+        separator();
+        _out.print(F("null"));
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::RawValue(const char* pJson)
+    {
+        separator();
+        _out.print(pJson);
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::HexValue(unsigned long value)
+    {
+        char buffer[2 * sizeof(value) + 1];
+        char* p = buffer + sizeof(buffer) - 1;
+
+        *p = 0;
+        do
+        {
+            *--p = "0123456789abcdef"[value & 0x0F];
+            value >>= 4;
+        } while (value != 0);
+
+        separator();
+        string(p, false);
+        return *this;
+    }
+
+    JSONWriter& JSONWriter::MacValue(const uint8_t* pMac)
+    {
+        static const char hex[] = "0123456789ABCDEF";
+        char buffer[17];
+
+        for (int i = 0; i < 6; i++)
+        {
+            buffer[i * 3] = hex[pMac[i] >> 4];
+            buffer[i * 3 + 1] = hex[pMac[i] & 0x0F];
+            if (i < 5)
+            {
+                buffer[i * 3 + 2] = ':';
+            }
+        }
+
+        separator();
+        _out.write('"');
+        _out.write((const uint8_t*) buffer, sizeof(buffer));
+        _out.write('"');
+        return *this;
+    }
+
+
+    JSONTokenizer::JSONTokenizer(char* pValue, size_t size)
+        : _pValue(pValue), _size(size), _length(0), _objects(0), _unicode(0), _highSurrogate(0),
+          _unicodeDigits(0), _depth(0), _state(StateValue), _isKey(false)
+    {
+    }
+
+    size_t JSONTokenizer::write(uint8_t c)
+    {
+        return write(&c, 1);
+    }
+
+    size_t JSONTokenizer::write(const uint8_t* pData, size_t size)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            if (_state == StateError || !parse((char) pData[i]))
+            {
+                _state = StateError;
+                return 0;
+            }
+        }
+        return size;
+    }
+
+    bool JSONTokenizer::append(char c)
+    {
+        // One byte is kept for the terminator
+        if (_length + 1 >= _size)
+        {
+            return false;
+        }
+        _pValue[_length++] = c;
+        return true;
+    }
+
+    // UTF-8 encoding of a \uXXXX escape (or a surrogate pair of them)
+    bool JSONTokenizer::appendCodePoint(uint32_t codePoint)
+    {
+        if (codePoint < 0x80)
+        {
+            return append((char) codePoint);
+        }
+        if (codePoint < 0x800)
+        {
+            return append((char) (0xC0 | (codePoint >> 6))) && append((char) (0x80 | (codePoint & 0x3F)));
+        }
+        if (codePoint < 0x10000)
+        {
+            return append((char) (0xE0 | (codePoint >> 12))) && append((char) (0x80 | ((codePoint >> 6) & 0x3F)))
+                && append((char) (0x80 | (codePoint & 0x3F)));
+        }
+        return append((char) (0xF0 | (codePoint >> 18))) && append((char) (0x80 | ((codePoint >> 12) & 0x3F)))
+            && append((char) (0x80 | ((codePoint >> 6) & 0x3F))) && append((char) (0x80 | (codePoint & 0x3F)));
+    }
+
+    void JSONTokenizer::valueDone()
+    {
+        _state = (_depth == 0) ? StateDone : StateCommaOrEnd;
+    }
+
+    bool JSONTokenizer::startValue(char c)
+    {
+        _length = 0;
+
+        switch (c)
+        {
+            case '{':
+            case '[':
+                if (_depth >= 32)
+                {
+                    return false;
+                }
+                if (c == '{')
+                {
+                    _objects |= (1UL << _depth);
+                }
+                else
+                {
+                    _objects &= ~(1UL << _depth);
+                }
+                _depth++;
+                token(c == '{' ? TokenObjectStart : TokenArrayStart, "", 0);
+                _state = (c == '{') ? StateKeyOrEnd : StateValueOrEnd;
+                return true;
+
+            case '"':
+                _isKey = false;
+                _state = StateString;
+                return true;
+
+            default:
+                if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n')
+                {
+                    _state = StateLiteral;
+                    return append(c);
+                }
+                return false;
+        }
+    }
+
+    bool JSONTokenizer::close(bool isObject)
+    {
+        if (_depth == 0 || ((_objects >> (_depth - 1)) & 1) != (isObject ? 1U : 0U))
+        {
+            return false;
+        }
+        _depth--;
+        token(isObject ? TokenObjectEnd : TokenArrayEnd, "", 0);
+        valueDone();
+        return true;
+    }
+
+    // Number grammar of RFC 8259: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    static bool IsNumber(const char* p)
+    {
+        if (*p == '-')
+        {
+            p++;
+        }
+        if (*p == '0')
+        {
+            p++;
+        }
+        else if (*p >= '1' && *p <= '9')
+        {
+            while (*p >= '0' && *p <= '9')
+            {
+                p++;
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        if (*p == '.')
+        {
+            p++;
+            if (!(*p >= '0' && *p <= '9'))
+            {
+                return false;
+            }
+            while (*p >= '0' && *p <= '9')
+            {
+                p++;
+            }
+        }
+
+        if (*p == 'e' || *p == 'E')
+        {
+            p++;
+            if (*p == '+' || *p == '-')
+            {
+                p++;
+            }
+            if (!(*p >= '0' && *p <= '9'))
+            {
+                return false;
+            }
+            while (*p >= '0' && *p <= '9')
+            {
+                p++;
+            }
+        }
+        return *p == 0;
+    }
+
+    bool JSONTokenizer::finish()
+    {
+        if (_state == StateLiteral && _depth == 0)
+        {
+            if (!endLiteral())
+            {
+                _state = StateError;
+            }
+        }
+        else if (_state != StateDone)
+        {
+            // Empty document, or a string, object or array left open
+            _state = StateError;
+        }
+        return complete();
+    }
+
+    // true/false/null or a number, ended by the first character that can't be part of it
+    bool JSONTokenizer::endLiteral()
+    {
+        _pValue[_length] = 0;
+
+        if (strcmp(_pValue, "true") == 0)
+        {
+            token(TokenTrue, _pValue, _length);
+        }
+        else if (strcmp(_pValue, "false") == 0)
+        {
+            token(TokenFalse, _pValue, _length);
+        }
+        else if (strcmp(_pValue, "null") == 0)
+        {
+            token(TokenNull, _pValue, _length);
+        }
+        else if (IsNumber(_pValue))
+        {
+            token(TokenNumber, _pValue, _length);
+        }
+        else
+        {
+            return false;
+        }
+
+        valueDone();
+        return true;
+    }
+
+    bool JSONTokenizer::parse(char c)
+    {
+        bool isSpace = (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+
+        switch (_state)
+        {
+            case StateString:
+                if (c == '"' && _highSurrogate == 0)
+                {
+                    _pValue[_length] = 0;
+                    if (_isKey)
+                    {
+                        token(TokenKey, _pValue, _length);
+                        _state = StateColon;
+                    }
+                    else
+                    {
+                        token(TokenString, _pValue, _length);
+                        valueDone();
+                    }
+                    return true;
+                }
+                if (c == '\\')
+                {
+                    _state = StateEscape;
+                    return true;
+                }
+                if ((uint8_t) c < 0x20 || _highSurrogate != 0)
+                {
+                    return false;
+                }
+                return append(c);
+
+            case StateEscape:
+                _state = StateString;
+                if (_highSurrogate != 0 && c != 'u')
+                {
+                    return false;
+                }
+                switch (c)
+                {
+                    case '"':
+                    case '\\':
+                    case '/':  return append(c);
+                    case 'b':  return append('\b');
+                    case 'f':  return append('\f');
+                    case 'n':  return append('\n');
+                    case 'r':  return append('\r');
+                    case 't':  return append('\t');
+                    case 'u':
+                        _unicode = 0;
+                        _unicodeDigits = 0;
+                        _state = StateUnicode;
+                        return true;
+                    default:
+                        return false;
+                }
+
+            case StateUnicode:
+            {
+                uint8_t digit;
+                if (c >= '0' && c <= '9')       digit = c - '0';
+                else if (c >= 'a' && c <= 'f')  digit = c - 'a' + 10;
+                else if (c >= 'A' && c <= 'F')  digit = c - 'A' + 10;
+                else                            return false;
+
+                _unicode = (_unicode << 4) | digit;
+                if (++_unicodeDigits < 4)
+                {
+                    return true;
+                }
+
+                _state = StateString;
+                if (_highSurrogate != 0)
+                {
+                    if (_unicode < 0xDC00 || _unicode > 0xDFFF)
+                    {
+                        return false;
+                    }
+                    uint32_t codePoint = 0x10000 + (((uint32_t) _highSurrogate - 0xD800) << 10) + (_unicode - 0xDC00);
+                    _highSurrogate = 0;
+                    return appendCodePoint(codePoint);
+                }
+                if (_unicode >= 0xD800 && _unicode <= 0xDBFF)
+                {
+                    // The low surrogate has to follow as the next escape
+                    _highSurrogate = _unicode;
+                    return true;
+                }
+                if (_unicode >= 0xDC00 && _unicode <= 0xDFFF)
+                {
+                    return false;
+                }
+                return appendCodePoint(_unicode);
+            }
+
+            case StateLiteral:
+                if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'E')
+                {
+                    return append(c);
+                }
+                // The delimiter is parsed in the state following the literal
+                return endLiteral() && parse(c);
+
+            default:
+                break;
+        }
+
+        if (isSpace)
+        {
+            return true;
+        }
+
+        switch (_state)
+        {
+            case StateValue:
+                return startValue(c);
+
+            case StateValueOrEnd:
+                if (c == ']')
+                {
+                    return close(false);
+                }
+                return startValue(c);
+
+            case StateKeyOrEnd:
+                if (c == '}')
+                {
+                    return close(true);
+                }
+                // fall through
+            case StateKey:
+                if (c != '"')
+                {
+                    return false;
+                }
+                _length = 0;
+                _isKey = true;
+                _state = StateString;
+                return true;
+
+            case StateColon:
+                if (c != ':')
+                {
+                    return false;
+                }
+                _state = StateValue;
+                return true;
+
+            case StateCommaOrEnd:
+                if (c == ',')
+                {
+                    _state = ((_objects >> (_depth - 1)) & 1) ? StateKey : StateValue;
+                    return true;
+                }
+                if (c == '}' || c == ']')
+                {
+                    return close(c == '}');
+                }
+                return false;
+
+            default:
+                // Only whitespace may follow the top level value
+                return false;
+        }
+    }
+}
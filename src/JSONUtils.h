@@ -9,6 +9,7 @@
 #define JSONUTILS_H
 
 #include <Arduino.h>
+#include <IPAddress.h>
 
 namespace JSONUtils {
     inline const __FlashStringHelper* ObjectStart()
@@ -61,6 +62,190 @@ namespace JSONUtils {
 
     String EncloseObject(const String& content);
     String EncloseArray(const String& content);
+
+    // Print into a caller supplied buffer, the content is kept null terminated.
+    // Writes past the end are dropped and reported by overflow().
+    class JSONBuffer : public Print
+    {
+    public:
+        JSONBuffer(char* pBuffer, size_t size);
+
+        size_t write(uint8_t c) override;
+        size_t write(const uint8_t* pData, size_t size) override;
+        using Print::write;
+
+        const char* c_str() const { return _pBuffer; }
+        size_t length() const { return _length; }
+        bool overflow() const { return _overflow; }
+        void clear();
+
+    private:
+        char*   _pBuffer;
+        size_t  _size;
+        size_t  _length;
+        bool    _overflow;
+    };
+
+    // Streams JSON straight into a Print (JSONBuffer, AsyncResponseStream, ...) without building
+    // intermediate Strings. Separators are inserted automatically, strings are escaped and
+    // __FlashStringHelper keys and values are read from flash. Nesting is limited to 32 levels.
+    class JSONWriter
+    {
+    public:
+        explicit JSONWriter(Print& out);
+
+        JSONWriter& BeginObject();
+        JSONWriter& EndObject();
+        JSONWriter& BeginArray();
+        JSONWriter& EndArray();
+
+        JSONWriter& Key(const char* key);
+        JSONWriter& Key(const __FlashStringHelper* key);
+
+        JSONWriter& Value(const char* pValue);
+        JSONWriter& Value(const String& value);
+        JSONWriter& Value(const __FlashStringHelper* pValue);
+        JSONWriter& Value(int value);
+        JSONWriter& Value(unsigned int value);
+        JSONWriter& Value(long value);
+        JSONWriter& Value(unsigned long value);
+        JSONWriter& Value(float value);
+        JSONWriter& Value(bool value);
+        JSONWriter& Value(const IPAddress& value);
+        JSONWriter& Null();
+        // pJson is already serialized JSON, written as it is
+        JSONWriter& RawValue(const char* pJson);
+
+        // "1a2b3c" for ESP.getFlashChipId() and the like
+        JSONWriter& HexValue(unsigned long value);
+        // "AA:BB:CC:DD:EE:FF" from the six bytes filled by WiFi.macAddress(mac)
+        JSONWriter& MacValue(const uint8_t* pMac);
+
+        template <typename K, typename V>
+        JSONWriter& Pair(K key, V value)
+        {
+            Key(key);
+            return Value(value);
+        }
+
+        // {"name":"...","value":...} row of the name/value tables in the portal
+        template <typename V>
+        JSONWriter& NameValueRow(const __FlashStringHelper* name, V value)
+        {
+            BeginObject();
+            Pair(F("name"), name);
+            Pair(F("value"), value);
+            return EndObject();
+        }
+
+        // {"name":"...","value":...,"unit":"..."} row of the hardware status table
+        template <typename V>
+        JSONWriter& NameValueUnitRow(const __FlashStringHelper* name, V value, const __FlashStringHelper* unit)
+        {
+            BeginObject();
+            Pair(F("name"), name);
+            Pair(F("value"), value);
+            Pair(F("unit"), unit);
+            return EndObject();
+        }
+
+    private:
+        void separator();
+        void open(char c);
+        void close(char c);
+        void string(const char* pValue, bool isFlash);
+
+        Print&      _out;
+        uint32_t    _hasItems;
+        uint8_t     _depth;
+        bool        _afterKey;
+    };
+
+    // Incremental (SAX style) JSON tokenizer. The document is written to it in pieces of any size,
+    // e.g. by HTTPClient::writeToStream(), and token() is called for every key, value and bracket.
+    // Call finish() after the last piece, a top level number has no delimiter to end it otherwise.
+    // Memory is bounded by the caller supplied value buffer: a longer key or string is an error.
+    // Nesting is limited to 32 levels.
+    class JSONTokenizer : public Stream
+    {
+    public:
+        enum Token : uint8_t
+        {
+            TokenObjectStart,
+            TokenObjectEnd,
+            TokenArrayStart,
+            TokenArrayEnd,
+            TokenKey,
+            TokenString,
+            TokenNumber,            // pValue holds the number as written
+            TokenTrue,
+            TokenFalse,
+            TokenNull
+        };
+
+        JSONTokenizer(char* pValue, size_t size);
+        virtual ~JSONTokenizer() {}
+
+        // Parsing stops at the first error, write() returns 0 from then on
+        size_t write(uint8_t c) override;
+        size_t write(const uint8_t* pData, size_t size) override;
+        using Print::write;
+
+        // Nothing can be read back, the Stream interface is there for HTTPClient::writeToStream()
+        int available() override { return 0; }
+        int read() override { return -1; }
+        int peek() override { return -1; }
+
+        // Ends the document: a top level number or literal still open (e.g. "123") is completed,
+        // an unterminated string, object or array is an error. Returns complete().
+        bool finish();
+
+        bool error() const { return _state == StateError; }
+        // The top level value was parsed completely
+        bool complete() const { return _state == StateDone; }
+        // Number of open objects and arrays, 1 for the members of the top level object
+        uint8_t depth() const { return _depth; }
+
+    protected:
+        // pValue is null terminated, valid during the call only
+        virtual void token(Token token, const char* pValue, size_t length) = 0;
+
+    private:
+        enum State : uint8_t
+        {
+            StateValue,
+            StateValueOrEnd,
+            StateKey,
+            StateKeyOrEnd,
+            StateColon,
+            StateCommaOrEnd,
+            StateString,
+            StateEscape,
+            StateUnicode,
+            StateLiteral,
+            StateDone,
+            StateError
+        };
+
+        bool parse(char c);
+        bool startValue(char c);
+        bool close(bool isObject);
+        void valueDone();
+        bool append(char c);
+        bool appendCodePoint(uint32_t codePoint);
+        bool endLiteral();
+
+        char*       _pValue;
+        size_t      _size;
+        size_t      _length;
+        uint32_t    _objects;           // Bit per level, set for objects
+        uint16_t    _unicode;
+        uint16_t    _highSurrogate;
+        uint8_t     _unicodeDigits;
+        uint8_t     _depth;
+        State       _state;
+        bool        _isKey;
+    };
 }
 
 #endif // JSONUTILS_H
\ No newline at end of file
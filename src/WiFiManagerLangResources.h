@@ -14,6 +14,9 @@
 
 ////////////////////////////////////////////////////
 
+// Identical strings below are emitted as references to the first one (string pool of the generator)
+const char WM_PK_EMPTY_STR[] PROGMEM = "";
+
 const char WM_PK_HTML_HEAD_1[] PROGMEM = "<!DOCTYPE html>\n<html lang='" L_HTML_LANGUAGE "'>\n<head><meta name='viewport' content='width=device-width, initial-scale=1, user-scalable=no'/><title>\n";
 // Title
 const char WM_PK_HTML_HEAD_2[] PROGMEM = "</title>";
@@ -44,37 +47,4597 @@ const char WM_PK_HTTP_HTML[] PROGMEM =
 */
 
 // Javascript files
-const char WM_PK_UTILS_JS[] PROGMEM = "/**\n* Utility functions for DOM manipulation and simple logic.\n*/\n\n// Shorthand for document.getElementById\nconst gebi=s=>document.getElementById(s);\n\nconst qs=s=>document.querySelector(s);\n\nconst qsa=s=>document.querySelectorAll(s);\n\nconst wl=f=>window.addEventListener('load',f);\n\n// UI helper: set inner element\nconst IH=(l,v)=>{\ngebi(l).textContent=v\n};\n\n/**\n* Creates a complete HTML Table element (<table>) from an array of JSON objects.\n* * @param {Array<Object>} dt An array of objects, where each object is a table row.\n* @param {Object} [opt] Optional configuration settings.\n* @param {Object} [opt.rowHeadLocals] An object map where keys match dt keys\n* (e.g., { 'id': 'Employee ID' }). If a key is missing, the original key is used.\n* @param {boolean} [opt.colHeadLocals=null] An object map where keys match dt keys\n* (e.g., { 'id': 'Employee ID' }). If a key is missing, the original key is used.\n* @param {string} [opt.tableClass] An optional CSS class to be added to the <table> element.\n* @returns {HTMLTableElement | null} A fully constructed <table> element or null\n* if dt is invalid or empty.\n*/\nfunction j2t(dt, opt = {}) {\n// 1. Basic validation\nif (!Array.isArray(dt) || dt.length === 0 || typeof dt[0] !== 'object') {\nconsole.warn('jsonToTable requires a non-empty array of objects.');\nreturn null;\n}\n\nconst tbl = document.createElement('table');\n\n// Add optional class\nif (opt.tableClass) {\ntbl.classList.add(opt.tableClass);\n}\n\n// Get column headers (keys) from the first object\nconst colHds = Object.keys(dt[0]);\n\nconst firstColIsHeader = opt.firstColIsHeader === true;\n\nif (opt.rowHeadLocals)\n{\n// Create Table Header (<thead>)\nconst tHead = tbl.createTHead();\nconst hRow = tHead.insertRow();\n\ncolHds.forEach(key => {\nconst th = document.createElement('th');\n\n// Use localized header text if provided, otherwise use the original key.\nlet hdrTxt = opt.rowHeadLocals[key] || key;\nth.textContent = hdrTxt;\n\nhRow.appendChild(th);\n});\n}\n\n// 3. Create Table Body (<tbody>)\nconst tBody = tbl.createTBody();\n\ndt.forEach(dRow => {\nconst row = tBody.insertRow();\nlet rowIdentity = ''; // This will store the value of the first column\n\ncolHds.forEach((key, index) => {\nlet val = dRow[key];\nlet cellContent = val !== null && val !== undefined ? val.toString() : '';\nlet cell;\n\nif (index === 0) {\n// 1. Identify the row based on the first column's value\nif (opt.colHeadLocals) {\nrowIdentity = opt.colHeadLocals[key] || key;\n} else {\nrowIdentity = cellContent;\n}\n\n// Create the first cell (often a TH scope='row')\ncell = document.createElement('th');\ncell.setAttribute('scope', 'row');\ncell.textContent = rowIdentity;\n} else {\n// 2. Create standard data cells\ncell = row.insertCell();\ncell.textContent = cellContent;\n\n// 3. Set the data-label to the first column's value\n// if rowHeadLocals isn't provided\nconst mobileLabel = (opt.rowHeadLocals && opt.rowHeadLocals[key])\n? opt.rowHeadLocals[key]\n: rowIdentity;\n\ncell.setAttribute('data-label', mobileLabel);\n}\n\nrow.appendChild(cell);\n});\n});\n\nreturn tbl;\n}\n\n/**\n* (JSON to form) Populates HTML input elements with values from a JSON object.\n* The key of the JSON object must match the 'id' of the HTML element.\n*\n* @param {Object} data - A JSON object where keys are element IDs and values are the input values.\n*/\nfunction j2f(data) {\n// Check if the input is a valid object\nif (typeof data !== 'object' || data === null) {\nconsole.error('Input data must be a non-null object.');\nreturn;\n}\n\n// Iterate over each key-value pair in the JSON object\nfor (const elementId in data) {\nif (Object.prototype.hasOwnProperty.call(data, elementId)) {\nconst valueToSet = data[elementId];\n\n// 1. Get the HTML element by its ID\nconst element = gebi(elementId);\n\n// 2. Check if the element exists\nif (element) {\n// 3. Set the 'value' property of the input element\nelement.value = valueToSet;\n} else {\n//console.warn(`Element with ID '${elementId}' not found in the DOM.`);\n}\n}\n}\n}\n\n/**\n* Fetches JSON data from a server, converts it to an HTML table,\n* and inserts the table into a target element.\n* * @param {string} url The endpoint to fetch the JSON data from.\n* @param {string} targetElementId The ID of the HTML element where the table will be inserted.\n*/\nasync function u2t(url, id, opt = {}) {\nconst el = gebi(id);\n\n// Clear the target area and show a loading message\nel.innerHTML = 'Fetching data...';\n\nif (!el) {\nconsole.error(`Target element with ID '${id}' not found.`);\nreturn;\n}\n\ntry {\n// 1. Fetch Data\nconst response = await mfetch(url);\n\nif (!response.ok) {\nthrow new Error(`HTTP error! status: ${response.status}`);\n}\n\n// 2. Parse JSON\n// The data is expected to be an array of objects, e.g., [{'ID': 101, 'Name': 'Alpha'}, ...]\nconst data = await response.json();\n\nif (data.length === 0) {\nel.innerHTML = 'No data available.';\nreturn;\n}\n\n// Convert JSON to table\nconst table = j2t(data, opt);\n\n// 5. Insert Table into DOM\n// Instead of setting innerHTML, we replace the content with the new DOM node.\nel.innerHTML = ''; // Clear loading message\nel.appendChild(table);\n\n} catch (error) {\nconsole.error('Failed to load or convert data:', error);\nel.textContent = `Error: ${error.message}`;\n}\n}\n\n/**\n* Fetches JSON data from a server, converts it to an HTML table,\n* and inserts the table into a target element.\n* * @param {string} url The endpoint to fetch the JSON data from.\n* @param {string} targetElementId The ID of the HTML element where the table will be inserted.\n*/\nasync function u2f(url) {\ntry {\n// 1. Fetch Data\nconst response = await mfetch(url);\n\nif (!response.ok) {\nthrow new Error(`HTTP error! status: ${response.status}`);\n}\n\n// 2. Parse JSON\n// The data is expected to be an array of objects, e.g., [{'ID': 101, 'Name': 'Alpha'}, ...]\nconst data = await response.json();\n\nj2f(data);\n} catch (error) {\nconsole.error('Failed to load or convert data:', error);\n}\n}\n\nasync function mfetch(url) {\nreturn fetch(url);\n}\n\n// Export all utility functions for use in main.js\nexport { gebi, qs, qsa, wl, IH, j2t, u2t, j2f, u2f };\n";
-const char WM_PK_MD5_UTILS_JS[] PROGMEM = "/**\n* MD5 implementation and related byte/word/encoding utilities.\n* The variables L and x, and the function A are part of the original bundling structure.\n*/\n\nfunction A(l){\nreturn l&&l.__esModule&&Object.prototype.hasOwnProperty.call(l,'default')?l.default:l\n}\nvar L={exports:{}}, x={exports:{}};\n(function(){\nvar l='ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/',\nf={\nrotl:function(s,d){return s<<d|s>>>32-d},\nrotr:function(s,d){return s<<32-d|s>>>d},\nendian:function(s){\nif(s.constructor==Number)\nreturn f.rotl(s,8)&16711935|f.rotl(s,24)&4278255360;\nfor(var d=0;d<s.length;d++)s[d]=f.endian(s[d]);\nreturn s\n},\nrandomBytes:function(s){\nfor(var d=[];s>0;s--)\nd.push(Math.floor(Math.random()*256));\nreturn d\n},\nbytesToWords:function(s){\nfor(var d=[],a=0,c=0;a<s.length;a++,c+=8)\nd[c>>>5]|=s[a]<<24-c%32;\nreturn d\n},\nwordsToBytes:function(s){\nfor(var d=[],a=0;a<s.length*32;a+=8)\nd.push(s[a>>>5]>>>24-a%32&255);\nreturn d\n},\nbytesToHex:function(s){\nfor(var d=[],a=0;a<s.length;a++)\nd.push((s[a]>>>4).toString(16)),d.push((s[a]&15).toString(16));\nreturn d.join('')\n},\nhexToBytes:function(s){\nfor(var d=[],a=0;a<s.length;a+=2)\nd.push(parseInt(s.substr(a,2),16));\nreturn d\n},\nbytesToBase64:function(s){\nfor(var d=[],a=0;a<s.length;a+=3)\nfor(var c=s[a]<<16|s[a+1]<<8|s[a+2],i=0;i<4;i++)\na*8+i*6<=s.length*8?d.push(l.charAt(c>>>6*(3-i)&63)):d.push('=');\nreturn d.join('')\n},\nbase64ToBytes:function(s){\ns=s.replace(/[^A-Z0-9+\\/]/ig,'');\nfor(var d=[],a=0,c=0;a<s.length;c=++a%4)\nc!=0&&d.push((l.indexOf(s.charAt(a-1))&Math.pow(2,-2*c+8)-1)<<c*2|l.indexOf(s.charAt(a))>>>6-c*2);\nreturn d\n}\n};\nx.exports=f\n})();\nvar H=x.exports,\nF={\nutf8:{\nstringToBytes:function(l){\nreturn F.bin.stringToBytes(unescape(encodeURIComponent(l)))\n},\nbytesToString:function(l){\nreturn decodeURIComponent(escape(F.bin.bytesToString(l)))\n}\n},\nbin:{\nstringToBytes:function(l){\nfor(var f=[],s=0;s<l.length;s++)\nf.push(l.charCodeAt(s)&255);\nreturn f\n},\nbytesToString:function(l){\nfor(var f=[],s=0;s<l.length;s++)\nf.push(String.fromCharCode(l[s]));\nreturn f.join('')\n}\n}\n},\nI=F;\n/*!\n* Determine if an object is a Buffer\n*\n* @author    Feross Aboukhadijeh <https://feross.org>\n* @license   MIT\n*/\nvar O=function(l){\nreturn l!=null&&(M(l)||P(l)||!!l._isBuffer)\n};\nfunction M(l){\nreturn!!l.constructor&&typeof l.constructor.isBuffer=='function'&&l.constructor.isBuffer(l)\n}\nfunction P(l){\nreturn typeof l.readFloatLE=='function'&&typeof l.slice=='function'&&M(l.slice(0,0))\n}\n(function(){\nvar l=H,f=I.utf8,s=O,d=I.bin,\na=function(c,i){\nc.constructor==String?i&&i.encoding==='binary'?c=d.stringToBytes(c):c=f.stringToBytes(c):s(c)?c=Array.prototype.slice.call(c,0):!Array.isArray(c)&&c.constructor!==Uint8Array&&(c=c.toString());\nfor(var r=l.bytesToWords(c),p=c.length*8,n=1732584193,e=-271733879,o=-1732584194,t=271733878,u=0;u<r.length;u++)\nr[u]=(r[u]<<8|r[u]>>>24)&16711935|(r[u]<<24|r[u]>>>8)&4278255360;r[p>>>5]|=128<<p%32,r[(p+64>>>9<<4)+14]=p;\nfor(var m=a._ff,g=a._gg,h=a._hh,y=a._ii,u=0;u<r.length;u+=16){\nvar C=n,S=e,k=o,_=t;\nn=m(n,e,o,t,r[u+0],7,-680876936),\nt=m(t,n,e,o,r[u+1],12,-389564586),\no=m(o,t,n,e,r[u+2],17,606105819),\ne=m(e,o,t,n,r[u+3],22,-1044525330),\nn=m(n,e,o,t,r[u+4],7,-176418897),\nt=m(t,n,e,o,r[u+5],12,1200080426),\no=m(o,t,n,e,r[u+6],17,-1473231341),\ne=m(e,o,t,n,r[u+7],22,-45705983),\nn=m(n,e,o,t,r[u+8],7,1770035416),\nt=m(t,n,e,o,r[u+9],12,-1958414417),\no=m(o,t,n,e,r[u+10],17,-42063),\ne=m(e,o,t,n,r[u+11],22,-1990404162),\nn=m(n,e,o,t,r[u+12],7,1804603682),\nt=m(t,n,e,o,r[u+13],12,-40341101),\no=m(o,t,n,e,r[u+14],17,-1502002290),\ne=m(e,o,t,n,r[u+15],22,1236535329),\nn=g(n,e,o,t,r[u+1],5,-165796510),\nt=g(t,n,e,o,r[u+6],9,-1069501632),\no=g(o,t,n,e,r[u+11],14,643717713),\ne=g(e,o,t,n,r[u+0],20,-373897302),\nn=g(n,e,o,t,r[u+5],5,-701558691),\nt=g(t,n,e,o,r[u+10],9,38016083),\no=g(o,t,n,e,r[u+15],14,-660478335),\ne=g(e,o,t,n,r[u+4],20,-405537848),\nn=g(n,e,o,t,r[u+9],5,568446438),\nt=g(t,n,e,o,r[u+14],9,-1019803690),\no=g(o,t,n,e,r[u+3],14,-187363961),\ne=g(e,o,t,n,r[u+8],20,1163531501),\nn=g(n,e,o,t,r[u+13],5,-1444681467),\nt=g(t,n,e,o,r[u+2],9,-51403784),\no=g(o,t,n,e,r[u+7],14,1735328473),\ne=g(e,o,t,n,r[u+12],20,-1926607734),\nn=h(n,e,o,t,r[u+5],4,-378558),\nt=h(t,n,e,o,r[u+8],11,-2022574463),\no=h(o,t,n,e,r[u+11],16,1839030562),\ne=h(e,o,t,n,r[u+14],23,-35309556),\nn=h(n,e,o,t,r[u+1],4,-1530992060),\nt=h(t,n,e,o,r[u+4],11,1272893353),\no=h(o,t,n,e,r[u+7],16,-155497632),\ne=h(e,o,t,n,r[u+10],23,-1094730640),\nn=h(n,e,o,t,r[u+13],4,681279174),\nt=h(t,n,e,o,r[u+0],11,-358537222),\no=h(o,t,n,e,r[u+3],16,-722521979),\ne=h(e,o,t,n,r[u+6],23,76029189),\nn=h(n,e,o,t,r[u+9],4,-640364487),\nt=h(t,n,e,o,r[u+12],11,-421815835),\no=h(o,t,n,e,r[u+15],16,530742520),\ne=h(e,o,t,n,r[u+2],23,-995338651),\nn=y(n,e,o,t,r[u+0],6,-198630844),\nt=y(t,n,e,o,r[u+7],10,1126891415),\no=y(o,t,n,e,r[u+14],15,-1416354905),\ne=y(e,o,t,n,r[u+5],21,-57434055),\nn=y(n,e,o,t,r[u+12],6,1700485571),\nt=y(t,n,e,o,r[u+3],10,-1894986606),\no=y(o,t,n,e,r[u+10],15,-1051523),\ne=y(e,o,t,n,r[u+1],21,-2054922799),\nn=y(n,e,o,t,r[u+8],6,1873313359),\nt=y(t,n,e,o,r[u+15],10,-30611744),\no=y(o,t,n,e,r[u+6],15,-1560198380),\ne=y(e,o,t,n,r[u+13],21,1309151649),\nn=y(n,e,o,t,r[u+4],6,-145523070),\nt=y(t,n,e,o,r[u+11],10,-1120210379),\no=y(o,t,n,e,r[u+2],15,718787259),\ne=y(e,o,t,n,r[u+9],21,-343485551),\nn=n+C>>>0,\ne=e+S>>>0,\no=o+k>>>0,\nt=t+_>>>0\n}\nreturn l.endian([n,e,o,t])\n};\na._ff=function(c,i,r,p,n,e,o){\nvar t=c+(i&r|~i&p)+(n>>>0)+o;\nreturn(t<<e|t>>>32-e)+i\n},\na._gg=function(c,i,r,p,n,e,o){\nvar t=c+(i&p|r&~p)+(n>>>0)+o;\nreturn(t<<e|t>>>32-e)+i\n},\na._hh=function(c,i,r,p,n,e,o){\nvar t=c+(i^r^p)+(n>>>0)+o;\nreturn(t<<e|t>>>32-e)+i\n},\na._ii=function(c,i,r,p,n,e,o){\nvar t=c+(r^(i|~p))+(n>>>0)+o;\nreturn(t<<e|t>>>32-e)+i\n},\na._blocksize=16,\na._digestsize=16,\nL.exports=function(c,i){\nif(c==null)\nthrow new Error('" L_OTA_JS_ILEGAL_ARGUMENT "'+c);\nvar r=l.wordsToBytes(a(c,i));\nreturn i&&i.asBytes?r:i&&i.asString?d.bytesToString(r):l.bytesToHex(r)\n}\n})();\nvar U=L.exports;\n\n// Export the MD5 function as R (main function in the original bundle context)\nconst R=A(U);\n\n// Export MD5 utility\nexport { R };\n";
-const char WM_PK_OTA_JS[] PROGMEM = "/**\n* Main application logic for OTA update.\n*/\n\n// Import necessary utilities\nimport { gebi, IH, } from './utils.js';\n// Import the MD5 hash function\nimport { R } from './md5_utils.js';\nimport { showRestartModal } from './restart.js';\n\n// UI helper: make element visible (remove 'hidden' class)\nconst v=l=>{\ngebi(l).classList.remove('hidden');\n};\n\n// UI helper: hide element (add 'hidden' class)\nconst H=l=>{\ngebi(l).classList.add('hidden');\n};\n\n// UI helper: set progress title text\nconst w=l=>{\ngebi('progInfo').textContent = l;\n};\n\n// UI helper: set error title text\nconst E=l=>{\ngebi('err').textContent = l;\n};\n\n/**\n* Searches a byte array for a specific tag and extracts the null-terminated string identifier\n* immediately following the tag.\n* @param {ArrayBuffer} buf - The ArrayBuffer containing the file data.\n* @param {string} tag - The string tag to search for.\n* @returns {string | null} The extracted identifier string or null if not found.\n*/\nfunction fid(buf, tag) {\nconst b = new Uint8Array(buf);\nconst tb = new TextEncoder().encode(tag);\nfor (let i = 0; i <= b.length - tb.length; i++) {\nlet found = true;\nfor (let j = 0; j < tb.length; j++) {\nif (b[i + j] !== tb[j]) {\nfound = false;\nbreak;\n}\n}\nif (found) {\n// Identifier starts after tag\nlet ib = [];\nlet k = i + tb.length;\nwhile (k < b.length && b[k] !== 0) {\nib.push(b[k]);\nk++;\n}\nreturn new TextDecoder().decode(new Uint8Array(ib));\n}\n}\nreturn null;\n}\n\n/**\n* Reads a file and calculates MD5, extracts Hardware ID (hwid) and Firmware Version (ver).\n* @param {File} f - The file object to read.\n* @returns {Promise<{md5: string, hwid: string | null, ver: string | null}>} An object containing the MD5, hwid, and ver.\n*/\nconst D1 = async (f) => new Promise((resolve, reject) => {\nlet reader = new FileReader();\nreader.onload = function(event) {\nconst arrayBuffer = event.target.result;\nconst md5 = R(arrayBuffer); // R is the imported MD5 function\nconst hwid = fid(arrayBuffer, '@*MAGic*@:hw:');\nconst ver  = fid(arrayBuffer, '@*MAGic*@:ve:');\nconst lang = fid(arrayBuffer, '@*MAGic*@:lg:');\nresolve({ md5, hwid, ver, lang });\n};\nreader.onerror = reject;\nreader.readAsArrayBuffer(f);\n});\n\n/**\n* Main function to process the selected firmware file and prepare for upload.\n* @param {File} l - The firmware file object.\n*/\nconst N = async l => {\n//B('uploadColumn'),B('settingsColumn'),v('progressColumn'); // Commented out in original, keeping it this way.\nlet f='fr'; /*gebi('otaMode').value;*/ // Mode fixed to 'fr'\nconst { md5, hwid, ver, lang }=await D1(l);\nif(hwid!=null && ver!=null)\n{\nv('fileProps');\nIH('fwName',l.name);\nIH('filesize',l.size.toString() + ' B');\nIH('hwid',hwid);\nIH('fmver',ver);\nIH('fmlang',lang!=null?lang:'');\nH('successRow');\ntry {\nconst dR = await fetch('/sq?dx=hwid');\nconst dJ = await dR.json();\nif (dJ.hwid && dJ.hwid === hwid) {\ngebi('hwid').classList.remove('red-txt');\ngebi('updateBtn').disabled = false;\ngebi('err').textContent = '';\nH('errRow');\n} else {\ngebi('hwid').classList.add('red-txt');\ngebi('updateBtn').disabled = true;\nE('" L_OTA_JS_HWID_MISMATCH "');\nv('errRow');\nreturn null;\n}\n} catch(e) {\ngebi('updateBtn').disabled = true;\nE('" L_OTA_JS_HWID_MISMATCH "');\nv('errRow');\nreturn null;\n}\nreturn {'md5': md5, 'file': l, 'hwid': hwid };\n}\nelse\n{\nH('fileProps');\nIH('fwName',l.name);\ngebi('updateBtn').disabled = true;\nE('Incorrect file selected.');\nH('successRow');\nv('errRow');\n}\n\nreturn null; // Invalid file selected.\n};\n\n/**\n* Performs basic file validation (single file, .bin extension).\n* @param {FileList} l - The FileList object.\n* @returns {boolean} True if validation passes, false otherwise.\n*/\nconst V = l => l.length>1&&!multiple?(alert('" L_OTA_JS_UPLOAD_ONE_BIN_FILE "'),!1):l[0].name.split('.').pop()!='bin'?(alert('" L_OTA_JS_UPLOAD_ONLY_BIN_FILES "'),!1):!0;\n\n/**\n* Reloads the current page (used for reset).\n*/\nfunction G(){\nwindow.location.reload()\n}\n\nfunction PG(v){\ngebi('otaProg').value=v;\ngebi('otaProgTxt').innerHTML=v.toString()+'%';\n}\n\nvar timeOut;\n\nfunction updateProgress() {\nvar prog = gebi('otaProg');\nif (prog.value >= 100) {\n//stop running this function after value reaches 100 (percent)\nPG(100);\nclearTimeout(timeOut);\n//finishedOK();\nfailed('Updated failed');\nreturn;\n}\nPG(prog.value+10);\ntimeOut = setTimeout(updateProgress, 500);\n}\n\nfunction finishedOK(){\nH('progRow');\nshowRestartModal(15, '" L_OTA_UPDATE_IN_PROGRESS "');\n}\n\nfunction failed(msg){\nE(msg);\ngebi('updateBtn').disabled = false;\ngebi('back').disabled = false;\nH('progRow');\nv('errRow');\n}\n\n/**\n* Initiates the OTA update process (called on start button click).\n* This function should be modified to use the file/md5 data from N.\n* The logic below is adapted from the latter part of the original function N.\n* @param {File} file - The file to upload.\n* @param {string} md5 - The MD5 hash of the file.\n* @param {string} hwid - Hardware ID from the file.\n*/\nasync function startUpload(file, md5, hwid) {\nlet f='fr'; // otaMode, fixed as per original N function\n\nPG(0);\nH('errRow');\nH('successRow');\nv('progRow');\n\ntry {\nw('Uploading '+file.name);\n\n//clearInterval(timeOut);\n//timeOut = setTimeout(updateProgress, 500);\n//return;\n\nconst d=await fetch(`/ota/start?mode=${f}&hash=${md5}&hwid=${hwid}`);\nif(!d.ok)\n{\nthrow new Error(d.statusText);\n}\n\nif (d.status == 200 && d.statusText !== 'OK')\n{\nthrow new Error(d.statusText);\n}\n\nconst a=await d.text();\nconsole.log('Start OTA response:',a);\n\nconst c=new FormData;\nlet i=new XMLHttpRequest;\n\ni.open('POST','/ota/upload');\n\ni.upload.addEventListener('progress',function(r){\nlet p=Math.round(r.loaded/r.total*100);\nPG(p);\n},!1);\n\ni.upload.onprogress=function(r){\nif(r.lengthComputable){\nlet p=Math.round(r.loaded/r.total*100);\nPG(p);\n}\n};\n\ni.onreadystatechange=function(){\nif(i.readyState==4)\nif(i.status==200)\nfinishedOK();\nelse if(i.status==400){\nlet r=i.responseText;\nthrow new Error('" L_OTA_JS_UPLOAD_FAILED "'+' '+r);\n}\nelse{\nlet r='" L_OTA_JS_SERVER_RETURNED_STATUS "'+i.status;\nthrow new Error('" L_OTA_JS_UPLOAD_FAILED "'+' '+r);\n}\n};\n\nc.append('file',file,file.name);\ni.send(c);\n}\ncatch(s){\n//B('progressColumn'),\n//v('errorColumn'),\nfailed(s);\n}\n}\n\n\n// The file state needs to be maintained to be used by the start button.\n// This is a global/module-scoped variable to hold the selected file and its MD5.\nlet selectedFile = null;\n\nasync function z(files){\nif(!V(files))\nreturn false;\n\nconst result = await N(files[0]);\nif (result!=null) {\nselectedFile = result;\n} else {\nselectedFile = null;\n}\ngebi('fileInput').value = '';\n}\n\n// Event listeners and window exports\nwindow.resetView=G;\nwindow.onFileInput=z;\n\n// Original event listener logic adapted for module structure\ndocument.addEventListener('DOMContentLoaded', () => {\nvar q=gebi('selFile'),fileInp=gebi('fileInput'); // q=selFile, $=fileInput\nconst updateBtn = gebi('updateBtn'); // updateBtn is used in the main function N\n\nq.addEventListener('click',function(l){\nl.preventDefault(),fileInp.click()\n});\n\n// The file input's onchange calls z (onFileInput), which in turn calls N.\n// N will now save the file/md5 data and enable the start button.\n// We need to re-wire z/onFileInput to capture the results of N.\n\n// Override the function z (onFileInput) to store the result from N.\n/*\nwindow.onFileInput = async function(files) {\nif(!V(files)) return false;\n\nconst result = await N(files[0]);\nif (result) {\nselectedFile = result;\n} else {\nselectedFile = null;\n}\n};\n*/\n\n// Handle the start button click\nupdateBtn.addEventListener('click', async (e) => {\ne.preventDefault();\nif (selectedFile && selectedFile.file && selectedFile.md5) {\nupdateBtn.disabled = true; // Disable to prevent double-click\ngebi('back').disabled = true; // Disable back button\nstartUpload(selectedFile.file, selectedFile.md5, selectedFile.hwid);\n} else {\nconsole.error('No valid file selected for upload.');\nalert('Please select a valid firmware file first.');\n}\n});\n});\n";
-const char WM_PK_MODULE_POLYFILL_JS[] PROGMEM = "/**\n* Module Preload Polyfill/Loader (Bundler-generated code).\n*/\n\n(\nfunction(){\nconst f=document.createElement('link').relList;\nif (f&&f.supports&&f.supports('modulepreload'))\nreturn;\nfor(const a of document.querySelectorAll('link[rel=\\'modulepreload\\']'))d(a);\nnew MutationObserver(\na=>{\nfor(const c of a)\nif(c.type==='childList')\nfor(const i of c.addedNodes)\ni.tagName==='LINK'&&i.rel==='modulepreload'&&d(i)\n}\n).observe(document,{childList:!0,subtree:!0});\nfunction s(a){\nconst c={};\nreturn a.integrity && (c.integrity=a.integrity),a.referrerPolicy && (c.referrerPolicy=a.referrerPolicy),a.crossOrigin==='use-credentials'?c.credentials='include':a.crossOrigin==='anonymous'?c.credentials='omit':c.credentials='same-origin',c\n}\n\nfunction d(a){\nif(a.ep)\nreturn;\na.ep=!0;\nconst c=s(a);\nfetch(a.href,c)\n}\n}\n)();\n";
-const char WM_PK_RESTART_JS[] PROGMEM = "var _modalCss =\n'.modal-overlay{position:fixed;inset:0;background:rgba(0,0,0,0.55);display:flex;align-items:center;justify-content:center;z-index:9999}' +\n'.modal-box{background:#fff;border-radius:.75rem;box-shadow:0 8px 32px rgba(0,0,0,.28);padding:2.5rem 2rem;text-align:center;min-width:220px}' +\n'.spinner{width:52px;height:52px;border:5px solid rgba(25,118,210,.15);border-top-color:#1976d2;border-radius:50%;animation:spin .8s linear infinite;margin:0 auto 1.25rem}' +\n'@keyframes spin{to{transform:rotate(360deg)}}' +\n'.modal-msg{color:#718792;margin-bottom:.75rem;font-size:1.05rem;white-space:pre-line}' +\n'.modal-cnt{font-size:2.5rem;font-weight:700;color:#1976d2}' +\n'.modal-btn-row{display:flex;gap:.75rem;justify-content:center;margin-top:1.25rem}' +\n'.modal-btn{padding:.6rem 1.5rem;border:none;border-radius:.5rem;font-size:1rem;font-weight:600;cursor:pointer}' +\n'.modal-btn-yes{background:#1976d2;color:#fff}' +\n'.modal-btn-no{background:transparent;color:#718792;border:.125rem solid rgba(25,118,210,.2)}';\n\nfunction ensureModalCss() {\nif (!document.getElementById('rModalCss')) {\nvar s = document.createElement('style');\ns.id = 'rModalCss';\ns.textContent = _modalCss;\ndocument.head.appendChild(s);\n}\n}\n\nexport function showConfirmModal(onConfirm) {\nensureModalCss();\nvar overlay = document.createElement('div');\noverlay.className = 'modal-overlay';\noverlay.innerHTML =\n'<div class=\\'modal-box\\'>' +\n'<p class=\\'modal-msg\\'>' + '" L_RESTART_CONFIRM "' + '</p>' +\n'<div class=\\'modal-btn-row\\'>' +\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'mBtnY\\'>' + '" L_GENERAL_YES "' + '</button>' +\n'<button class=\\'modal-btn modal-btn-no\\' id=\\'mBtnN\\'>' + '" L_GENERAL_NO "' + '</button>' +\n'</div></div>';\ndocument.body.appendChild(overlay);\ndocument.getElementById('mBtnY').onclick = function() {\ndocument.body.removeChild(overlay);\nonConfirm();\n};\ndocument.getElementById('mBtnN').onclick = function() {\ndocument.body.removeChild(overlay);\n};\n}\n\nexport function showRestartModal(seconds, message) {\nensureModalCss();\nvar msg = (message !== undefined) ? message : '" L_RESTART_IN_PROGRESS "';\nvar div = document.createElement('div');\ndiv.className = 'modal-overlay';\ndiv.innerHTML =\n'<div class=\\'modal-box\\'>' +\n'<div class=\\'spinner\\'></div>' +\n'<p class=\\'modal-msg\\'>' + msg + '</p>' +\n'<div class=\\'modal-cnt\\' id=\\'rCnt\\'>' + seconds + '</div>' +\n'</div>';\ndocument.body.appendChild(div);\nvar n = seconds;\nvar t = setInterval(function () {\nn--;\nvar el = document.getElementById('rCnt');\nif (el) el.textContent = n;\nif (n <= 0) { clearInterval(t); location.href = '/'; }\n}, 1000);\n}\n";
-const char WM_PK_HW_STATUS_JS[] PROGMEM = "(function(){\nvar INTERVAL=10000;\nfunction refresh(){\nfetch('/sq?dx=hwstatus')\n.then(function(r){return r.json();})\n.then(function(data){\nvar tbody=document.getElementById('hw-st-body');\nif(!tbody)return;\nif(!Array.isArray(data)||data.length===0){\ntbody.innerHTML='<tr><td colspan=\\'3\\' style=\\'text-align:center;color:var(--muted)\\'>&#8212;</td></tr>';\nreturn;\n}\nvar h='';\nfor(var i=0;i<data.length;i++){\nh+='<tr><td>'+(data[i].name||'')+'</td>'\n+'<td class=\\'stval\\'>'+data[i].value+'</td>'\n+'<td>'+(data[i].unit||'')+'</td></tr>';\n}\ntbody.innerHTML=h;\n})\n.catch(function(){});\n}\ndocument.addEventListener('DOMContentLoaded',function(){\nrefresh();\nsetInterval(refresh,INTERVAL);\n});\n})();\n";
+const char WM_PK_UTILS_JS[] PROGMEM = "const gebi=s=>document.getElementById(s);const qs=s=>document.querySelector(s);const qsa=s=>document.querySelectorAll(s);const wl=f=>window.addEventListener('load',f);const IH=(l,v)=>{gebi(l).textContent=v};function j2t(dt,opt={}){if(!Array.isArray(dt)||dt.length===0||typeof dt[0]!=='object'){console.warn('jsonToTable requires a non-empty array of objects.');return null;}\nconst tbl=document.createElement('table');if(opt.tableClass){tbl.classList.add(opt.tableClass);}\nconst colHds=Object.keys(dt[0]);const firstColIsHeader=opt.firstColIsHeader===true;if(opt.rowHeadLocals)\n{const tHead=tbl.createTHead();const hRow=tHead.insertRow();colHds.forEach(key=>{const th=document.createElement('th');let hdrTxt=opt.rowHeadLocals[key]||key;th.textContent=hdrTxt;hRow.appendChild(th);});}\nconst tBody=tbl.createTBody();dt.forEach(dRow=>{const row=tBody.insertRow();let rowIdentity='';colHds.forEach((key,index)=>{let val=dRow[key];let cellContent=val!==null&&val!==undefined?val.toString():'';let cell;if(index===0){if(opt.colHeadLocals){rowIdentity=opt.colHeadLocals[key]||key;}else{rowIdentity=cellContent;}\ncell=document.createElement('th');cell.setAttribute('scope','row');cell.textContent=rowIdentity;}else{cell=row.insertCell();cell.textContent=cellContent;const mobileLabel=(opt.rowHeadLocals&&opt.rowHeadLocals[key])?opt.rowHeadLocals[key]:rowIdentity;cell.setAttribute('data-label',mobileLabel);}\nrow.appendChild(cell);});});return tbl;}\nfunction j2f(data){if(typeof data!=='object'||data===null){console.error('Input data must be a non-null object.');return;}\nfor(const elementId in data){if(Object.prototype.hasOwnProperty.call(data,elementId)){const valueToSet=data[elementId];const element=gebi(elementId);if(element){element.value=valueToSet;}else{}}}}\nasync function u2t(url,id,opt={}){const el=gebi(id);el.innerHTML='Fetching data...';if(!el){console.error(`Target element with ID '${id}' not found.`);return;}\ntry{const response=await mfetch(url);if(!response.ok){throw new Error(`HTTP error! status: ${response.status}`);}\nd2t(await response.json(),id,opt);}catch(error){console.error('Failed to load or convert data:',error);el.textContent=`Error: ${error.message}`;}}\nfunction d2t(data,id,opt={}){const el=gebi(id);if(!data||data.length===0){el.innerHTML='No data available.';return;}\nconst table=j2t(data,opt);el.innerHTML='';el.appendChild(table);}\nasync function sq(...dx){const response=await mfetch('./sq?dx='+dx.join(','));if(!response.ok){throw new Error(`HTTP error! status: ${response.status}`);}\nconst data=await response.json();return dx.length===1?{[dx[0]]:data}:data;}\nasync function u2f(url){try{const response=await mfetch(url);if(!response.ok){throw new Error(`HTTP error! status: ${response.status}`);}\nconst data=await response.json();j2f(data);}catch(error){console.error('Failed to load or convert data:',error);}}\nasync function mfetch(url){return fetch(url);}\nexport{gebi,qs,qsa,wl,IH,j2t,u2t,d2t,j2f,u2f,sq};\n";
+const char WM_PK_OTA_JS[] PROGMEM = "const $m0=(()=>{const gebi=s=>document.getElementById(s);const IH=(l,v)=>{gebi(l).textContent=v};return{IH,gebi};})();const $m1=(()=>{function A(l){return l&&l.__esModule&&Object.prototype.hasOwnProperty.call(l,'default')?l.default:l}\nvar L={exports:{}},x={exports:{}};(function(){var l='ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/',f={rotl:function(s,d){return s<<d|s>>>32-d},rotr:function(s,d){return s<<32-d|s>>>d},endian:function(s){if(s.constructor==Number)\nreturn f.rotl(s,8)&16711935|f.rotl(s,24)&4278255360;for(var d=0;d<s.length;d++)s[d]=f.endian(s[d]);return s},randomBytes:function(s){for(var d=[];s>0;s--)\nd.push(Math.floor(Math.random()*256));return d},bytesToWords:function(s){for(var d=[],a=0,c=0;a<s.length;a++,c+=8)\nd[c>>>5]|=s[a]<<24-c%32;return d},wordsToBytes:function(s){for(var d=[],a=0;a<s.length*32;a+=8)\nd.push(s[a>>>5]>>>24-a%32&255);return d},bytesToHex:function(s){for(var d=[],a=0;a<s.length;a++)\nd.push((s[a]>>>4).toString(16)),d.push((s[a]&15).toString(16));return d.join('')},hexToBytes:function(s){for(var d=[],a=0;a<s.length;a+=2)\nd.push(parseInt(s.substr(a,2),16));return d},bytesToBase64:function(s){for(var d=[],a=0;a<s.length;a+=3)\nfor(var c=s[a]<<16|s[a+1]<<8|s[a+2],i=0;i<4;i++)\na*8+i*6<=s.length*8?d.push(l.charAt(c>>>6*(3-i)&63)):d.push('=');return d.join('')},base64ToBytes:function(s){s=s.replace(/[^A-Z0-9+\\/]/ig,'');for(var d=[],a=0,c=0;a<s.length;c=++a%4)\nc!=0&&d.push((l.indexOf(s.charAt(a-1))&Math.pow(2,-2*c+8)-1)<<c*2|l.indexOf(s.charAt(a))>>>6-c*2);return d}};x.exports=f})();var H=x.exports,F={utf8:{stringToBytes:function(l){return F.bin.stringToBytes(unescape(encodeURIComponent(l)))},bytesToString:function(l){return decodeURIComponent(escape(F.bin.bytesToString(l)))}},bin:{stringToBytes:function(l){for(var f=[],s=0;s<l.length;s++)\nf.push(l.charCodeAt(s)&255);return f},bytesToString:function(l){for(var f=[],s=0;s<l.length;s++)\nf.push(String.fromCharCode(l[s]));return f.join('')}}},I=F;var O=function(l){return l!=null&&(M(l)||P(l)||!!l._isBuffer)};function M(l){return!!l.constructor&&typeof l.constructor.isBuffer=='function'&&l.constructor.isBuffer(l)}\nfunction P(l){return typeof l.readFloatLE=='function'&&typeof l.slice=='function'&&M(l.slice(0,0))}\n(function(){var l=H,f=I.utf8,s=O,d=I.bin,a=function(c,i){c.constructor==String?i&&i.encoding==='binary'?c=d.stringToBytes(c):c=f.stringToBytes(c):s(c)?c=Array.prototype.slice.call(c,0):!Array.isArray(c)&&c.constructor!==Uint8Array&&(c=c.toString());for(var r=l.bytesToWords(c),p=c.length*8,n=1732584193,e=-271733879,o=-1732584194,t=271733878,u=0;u<r.length;u++)\nr[u]=(r[u]<<8|r[u]>>>24)&16711935|(r[u]<<24|r[u]>>>8)&4278255360;r[p>>>5]|=128<<p%32,r[(p+64>>>9<<4)+14]=p;for(var m=a._ff,g=a._gg,h=a._hh,y=a._ii,u=0;u<r.length;u+=16){var C=n,S=e,k=o,_=t;n=m(n,e,o,t,r[u+0],7,-680876936),t=m(t,n,e,o,r[u+1],12,-389564586),o=m(o,t,n,e,r[u+2],17,606105819),e=m(e,o,t,n,r[u+3],22,-1044525330),n=m(n,e,o,t,r[u+4],7,-176418897),t=m(t,n,e,o,r[u+5],12,1200080426),o=m(o,t,n,e,r[u+6],17,-1473231341),e=m(e,o,t,n,r[u+7],22,-45705983),n=m(n,e,o,t,r[u+8],7,1770035416),t=m(t,n,e,o,r[u+9],12,-1958414417),o=m(o,t,n,e,r[u+10],17,-42063),e=m(e,o,t,n,r[u+11],22,-1990404162),n=m(n,e,o,t,r[u+12],7,1804603682),t=m(t,n,e,o,r[u+13],12,-40341101),o=m(o,t,n,e,r[u+14],17,-1502002290),e=m(e,o,t,n,r[u+15],22,1236535329),n=g(n,e,o,t,r[u+1],5,-165796510),t=g(t,n,e,o,r[u+6],9,-1069501632),o=g(o,t,n,e,r[u+11],14,643717713),e=g(e,o,t,n,r[u+0],20,-373897302),n=g(n,e,o,t,r[u+5],5,-701558691),t=g(t,n,e,o,r[u+10],9,38016083),o=g(o,t,n,e,r[u+15],14,-660478335),e=g(e,o,t,n,r[u+4],20,-405537848),n=g(n,e,o,t,r[u+9],5,568446438),t=g(t,n,e,o,r[u+14],9,-1019803690),o=g(o,t,n,e,r[u+3],14,-187363961),e=g(e,o,t,n,r[u+8],20,1163531501),n=g(n,e,o,t,r[u+13],5,-1444681467),t=g(t,n,e,o,r[u+2],9,-51403784),o=g(o,t,n,e,r[u+7],14,1735328473),e=g(e,o,t,n,r[u+12],20,-1926607734),n=h(n,e,o,t,r[u+5],4,-378558),t=h(t,n,e,o,r[u+8],11,-2022574463),o=h(o,t,n,e,r[u+11],16,1839030562),e=h(e,o,t,n,r[u+14],23,-35309556),n=h(n,e,o,t,r[u+1],4,-1530992060),t=h(t,n,e,o,r[u+4],11,1272893353),o=h(o,t,n,e,r[u+7],16,-155497632),e=h(e,o,t,n,r[u+10],23,-1094730640),n=h(n,e,o,t,r[u+13],4,681279174),t=h(t,n,e,o,r[u+0],11,-358537222),o=h(o,t,n,e,r[u+3],16,-722521979),e=h(e,o,t,n,r[u+6],23,76029189),n=h(n,e,o,t,r[u+9],4,-640364487),t=h(t,n,e,o,r[u+12],11,-421815835),o=h(o,t,n,e,r[u+15],16,530742520),e=h(e,o,t,n,r[u+2],23,-995338651),n=y(n,e,o,t,r[u+0],6,-198630844),t=y(t,n,e,o,r[u+7],10,1126891415),o=y(o,t,n,e,r[u+14],15,-1416354905),e=y(e,o,t,n,r[u+5],21,-57434055),n=y(n,e,o,t,r[u+12],6,1700485571),t=y(t,n,e,o,r[u+3],10,-1894986606),o=y(o,t,n,e,r[u+10],15,-1051523),e=y(e,o,t,n,r[u+1],21,-2054922799),n=y(n,e,o,t,r[u+8],6,1873313359),t=y(t,n,e,o,r[u+15],10,-30611744),o=y(o,t,n,e,r[u+6],15,-1560198380),e=y(e,o,t,n,r[u+13],21,1309151649),n=y(n,e,o,t,r[u+4],6,-145523070),t=y(t,n,e,o,r[u+11],10,-1120210379),o=y(o,t,n,e,r[u+2],15,718787259),e=y(e,o,t,n,r[u+9],21,-343485551),n=n+C>>>0,e=e+S>>>0,o=o+k>>>0,t=t+_>>>0}\nreturn l.endian([n,e,o,t])};a._ff=function(c,i,r,p,n,e,o){var t=c+(i&r|~i&p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._gg=function(c,i,r,p,n,e,o){var t=c+(i&p|r&~p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._hh=function(c,i,r,p,n,e,o){var t=c+(i^r^p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._ii=function(c,i,r,p,n,e,o){var t=c+(r^(i|~p))+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._blocksize=16,a._digestsize=16,L.exports=function(c,i){if(c==null)\nthrow new Error('" L_OTA_JS_ILEGAL_ARGUMENT "'+c);var r=l.wordsToBytes(a(c,i));return i&&i.asBytes?r:i&&i.asString?d.bytesToString(r):l.bytesToHex(r)}})();var U=L.exports;const R=A(U);return{R};})();const $m2=(()=>{var _modalCss='.modal-overlay{position:fixed;inset:0;background:rgba(0,0,0,0.55);display:flex;align-items:center;justify-content:center;z-index:9999}'+\n'.modal-box{background:#fff;border-radius:.75rem;box-shadow:0 8px 32px rgba(0,0,0,.28);padding:2.5rem 2rem;text-align:center;min-width:220px}'+\n'.spinner{width:52px;height:52px;border:5px solid rgba(25,118,210,.15);border-top-color:#1976d2;border-radius:50%;animation:spin .8s linear infinite;margin:0 auto 1.25rem}'+\n'@keyframes spin{to{transform:rotate(360deg)}}'+\n'.modal-msg{color:#718792;margin-bottom:.75rem;font-size:1.05rem;white-space:pre-line}'+\n'.modal-cnt{font-size:2.5rem;font-weight:700;color:#1976d2}'+\n'.modal-btn-row{display:flex;gap:.75rem;justify-content:center;margin-top:1.25rem}'+\n'.modal-btn{padding:.6rem 1.5rem;border:none;border-radius:.5rem;font-size:1rem;font-weight:600;cursor:pointer}'+\n'.modal-btn-yes{background:#1976d2;color:#fff}'+\n'.modal-btn-no{background:transparent;color:#718792;border:.125rem solid rgba(25,118,210,.2)}';function ensureModalCss(){if(!document.getElementById('rModalCss')){var s=document.createElement('style');s.id='rModalCss';s.textContent=_modalCss;document.head.appendChild(s);}}\nfunction showRestartModal(seconds,message){ensureModalCss();var msg=(message!==undefined)?message:'" L_RESTART_IN_PROGRESS "';var div=document.createElement('div');div.className='modal-overlay';div.innerHTML='<div class=\\'modal-box\\'>'+\n'<div class=\\'spinner\\'></div>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-cnt\\' id=\\'rCnt\\'>'+seconds+'</div>'+\n'</div>';document.body.appendChild(div);var n=seconds;var t=setInterval(function(){n--;var el=document.getElementById('rCnt');if(el)el.textContent=n;if(n<=0){clearInterval(t);location.href='/';}},1000);}\nreturn{showRestartModal};})();(()=>{const{gebi,IH}=$m0;const{R}=$m1;const{showRestartModal}=$m2;const v=l=>{gebi(l).classList.remove('hidden');};const H=l=>{gebi(l).classList.add('hidden');};const w=l=>{gebi('progInfo').textContent=l;};const E=l=>{gebi('err').textContent=l;};function fid(buf,tag){const b=new Uint8Array(buf);const tb=new TextEncoder().encode(tag);for(let i=0;i<=b.length-tb.length;i++){let found=true;for(let j=0;j<tb.length;j++){if(b[i+j]!==tb[j]){found=false;break;}}\nif(found){let ib=[];let k=i+tb.length;while(k<b.length&&b[k]!==0){ib.push(b[k]);k++;}\nreturn new TextDecoder().decode(new Uint8Array(ib));}}\nreturn null;}\nconst D1=async(f)=>new Promise((resolve,reject)=>{let reader=new FileReader();reader.onload=function(event){const arrayBuffer=event.target.result;const md5=R(arrayBuffer);const hwid=fid(arrayBuffer,'@*MAGic*@:hw:');const ver=fid(arrayBuffer,'@*MAGic*@:ve:');const lang=fid(arrayBuffer,'@*MAGic*@:lg:');resolve({md5,hwid,ver,lang});};reader.onerror=reject;reader.readAsArrayBuffer(f);});let hwidQuery=null;const devHwid=()=>hwidQuery||(hwidQuery=fetch('/sq?dx=hwid').then(r=>r.json()).catch(e=>{hwidQuery=null;throw e;}));const N=async l=>{let f='fr';const{md5,hwid,ver,lang}=await D1(l);if(hwid!=null&&ver!=null)\n{v('fileProps');IH('fwName',l.name);IH('filesize',l.size.toString()+' B');IH('hwid',hwid);IH('fmver',ver);IH('fmlang',lang!=null?lang:'');H('successRow');try{const dJ=await devHwid();if(dJ.hwid&&dJ.hwid===hwid){gebi('hwid').classList.remove('red-txt');gebi('updateBtn').disabled=false;gebi('err').textContent='';H('errRow');}else{gebi('hwid').classList.add('red-txt');gebi('updateBtn').disabled=true;E('" L_OTA_JS_HWID_MISMATCH "');v('errRow');return null;}}catch(e){gebi('updateBtn').disabled=true;E('" L_OTA_JS_HWID_MISMATCH "');v('errRow');return null;}\nreturn{'md5':md5,'file':l,'hwid':hwid};}\nelse\n{H('fileProps');IH('fwName',l.name);gebi('updateBtn').disabled=true;E('Incorrect file selected.');H('successRow');v('errRow');}\nreturn null;};const V=l=>l.length>1&&!multiple?(alert('" L_OTA_JS_UPLOAD_ONE_BIN_FILE "'),!1):l[0].name.split('.').pop()!='bin'?(alert('" L_OTA_JS_UPLOAD_ONLY_BIN_FILES "'),!1):!0;function G(){window.location.reload()}\nfunction PG(v){gebi('otaProg').value=v;gebi('otaProgTxt').innerHTML=v.toString()+'%';}\nvar timeOut;function updateProgress(){var prog=gebi('otaProg');if(prog.value>=100){PG(100);clearTimeout(timeOut);failed('Updated failed');return;}\nPG(prog.value+10);timeOut=setTimeout(updateProgress,500);}\nfunction finishedOK(){H('progRow');showRestartModal(15,'" L_OTA_UPDATE_IN_PROGRESS "');}\nfunction failed(msg){E(msg);gebi('updateBtn').disabled=false;gebi('back').disabled=false;H('progRow');v('errRow');}\nasync function startUpload(file,md5,hwid){let f='fr';PG(0);H('errRow');H('successRow');v('progRow');try{w('Uploading '+file.name);const d=await fetch(`/ota/start?mode=${f}&hash=${md5}&hwid=${hwid}`);if(!d.ok)\n{throw new Error(d.statusText);}\nif(d.status==200&&d.statusText!=='OK')\n{throw new Error(d.statusText);}\nconst a=await d.text();console.log('Start OTA response:',a);const c=new FormData;let i=new XMLHttpRequest;i.open('POST','/ota/upload');i.upload.addEventListener('progress',function(r){let p=Math.round(r.loaded/r.total*100);PG(p);},!1);i.upload.onprogress=function(r){if(r.lengthComputable){let p=Math.round(r.loaded/r.total*100);PG(p);}};i.onreadystatechange=function(){if(i.readyState==4)\nif(i.status==200)\nfinishedOK();else if(i.status==400){let r=i.responseText;throw new Error('" L_OTA_JS_UPLOAD_FAILED "'+' '+r);}\nelse{let r='" L_OTA_JS_SERVER_RETURNED_STATUS "'+i.status;throw new Error('" L_OTA_JS_UPLOAD_FAILED "'+' '+r);}};c.append('file',file,file.name);i.send(c);}\ncatch(s){failed(s);}}\nlet selectedFile=null;async function z(files){if(!V(files))\nreturn false;const result=await N(files[0]);if(result!=null){selectedFile=result;}else{selectedFile=null;}\ngebi('fileInput').value='';}\nwindow.resetView=G;window.onFileInput=z;document.addEventListener('DOMContentLoaded',()=>{var q=gebi('selFile'),fileInp=gebi('fileInput');const updateBtn=gebi('updateBtn');q.addEventListener('click',function(l){l.preventDefault(),fileInp.click()});updateBtn.addEventListener('click',async(e)=>{e.preventDefault();if(selectedFile&&selectedFile.file&&selectedFile.md5){updateBtn.disabled=true;gebi('back').disabled=true;startUpload(selectedFile.file,selectedFile.md5,selectedFile.hwid);}else{console.error('No valid file selected for upload.');alert('Please select a valid firmware file first.');}});});})();\n";
+const char WM_PK_MODULE_POLYFILL_JS[] PROGMEM = "(function(){const f=document.createElement('link').relList;if(f&&f.supports&&f.supports('modulepreload'))\nreturn;for(const a of document.querySelectorAll('link[rel=\\'modulepreload\\']'))d(a);new MutationObserver(a=>{for(const c of a)\nif(c.type==='childList')\nfor(const i of c.addedNodes)\ni.tagName==='LINK'&&i.rel==='modulepreload'&&d(i)}).observe(document,{childList:!0,subtree:!0});function s(a){const c={};return a.integrity&&(c.integrity=a.integrity),a.referrerPolicy&&(c.referrerPolicy=a.referrerPolicy),a.crossOrigin==='use-credentials'?c.credentials='include':a.crossOrigin==='anonymous'?c.credentials='omit':c.credentials='same-origin',c}\nfunction d(a){if(a.ep)\nreturn;a.ep=!0;const c=s(a);fetch(a.href,c)}})();\n";
+const char WM_PK_RESTART_JS[] PROGMEM = "var _modalCss='.modal-overlay{position:fixed;inset:0;background:rgba(0,0,0,0.55);display:flex;align-items:center;justify-content:center;z-index:9999}'+\n'.modal-box{background:#fff;border-radius:.75rem;box-shadow:0 8px 32px rgba(0,0,0,.28);padding:2.5rem 2rem;text-align:center;min-width:220px}'+\n'.spinner{width:52px;height:52px;border:5px solid rgba(25,118,210,.15);border-top-color:#1976d2;border-radius:50%;animation:spin .8s linear infinite;margin:0 auto 1.25rem}'+\n'@keyframes spin{to{transform:rotate(360deg)}}'+\n'.modal-msg{color:#718792;margin-bottom:.75rem;font-size:1.05rem;white-space:pre-line}'+\n'.modal-cnt{font-size:2.5rem;font-weight:700;color:#1976d2}'+\n'.modal-btn-row{display:flex;gap:.75rem;justify-content:center;margin-top:1.25rem}'+\n'.modal-btn{padding:.6rem 1.5rem;border:none;border-radius:.5rem;font-size:1rem;font-weight:600;cursor:pointer}'+\n'.modal-btn-yes{background:#1976d2;color:#fff}'+\n'.modal-btn-no{background:transparent;color:#718792;border:.125rem solid rgba(25,118,210,.2)}';function ensureModalCss(){if(!document.getElementById('rModalCss')){var s=document.createElement('style');s.id='rModalCss';s.textContent=_modalCss;document.head.appendChild(s);}}\nexport function showConfirmModal(onConfirm){ensureModalCss();var overlay=document.createElement('div');overlay.className='modal-overlay';overlay.innerHTML='<div class=\\'modal-box\\'>'+\n'<p class=\\'modal-msg\\'>'+'" L_RESTART_CONFIRM "'+'</p>'+\n'<div class=\\'modal-btn-row\\'>'+\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'mBtnY\\'>'+'" L_GENERAL_YES "'+'</button>'+\n'<button class=\\'modal-btn modal-btn-no\\' id=\\'mBtnN\\'>'+'" L_GENERAL_NO "'+'</button>'+\n'</div></div>';document.body.appendChild(overlay);document.getElementById('mBtnY').onclick=function(){document.body.removeChild(overlay);onConfirm();};document.getElementById('mBtnN').onclick=function(){document.body.removeChild(overlay);};}\nexport function showRestartModal(seconds,message){ensureModalCss();var msg=(message!==undefined)?message:'" L_RESTART_IN_PROGRESS "';var div=document.createElement('div');div.className='modal-overlay';div.innerHTML='<div class=\\'modal-box\\'>'+\n'<div class=\\'spinner\\'></div>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-cnt\\' id=\\'rCnt\\'>'+seconds+'</div>'+\n'</div>';document.body.appendChild(div);var n=seconds;var t=setInterval(function(){n--;var el=document.getElementById('rCnt');if(el)el.textContent=n;if(n<=0){clearInterval(t);location.href='/';}},1000);}\n";
+const char WM_PK_HW_STATUS_JS[] PROGMEM = "(function(){var INTERVAL=10000;function refresh(){fetch('/sq?dx=hwstatus')\n.then(function(r){return r.json();})\n.then(function(data){var tbody=document.getElementById('hw-st-body');if(!tbody)return;if(!Array.isArray(data)||data.length===0){tbody.innerHTML='<tr><td colspan=\\'3\\' style=\\'text-align:center;color:var(--muted)\\'>&#8212;</td></tr>';return;}\nvar h='';for(var i=0;i<data.length;i++){h+='<tr><td>'+(data[i].name||'')+'</td>'\n+'<td class=\\'stval\\'>'+data[i].value+'</td>'\n+'<td>'+(data[i].unit||'')+'</td></tr>';}\ntbody.innerHTML=h;})\n.catch(function(){});}\ndocument.addEventListener('DOMContentLoaded',function(){refresh();setInterval(refresh,INTERVAL);});})();\n";
+const char WM_PK_JSTZ_JS[] PROGMEM = "(function(e){var t=function(){'use strict';var e='s',n=function(e){var t=-e.getTimezoneOffset();return t!==null?t:0},r=function(e,t,n){var r=new Date;return e!==undefined&&r.setFullYear(e),r.setDate(n),r.setMonth(t),r},i=function(e){return n(r(e,0,2))},s=function(e){return n(r(e,5,2))},o=function(e){var t=e.getMonth()>7?s(e.getFullYear()):i(e.getFullYear()),r=n(e);return t-r!==0},u=function(){var t=i(),n=s(),r=i()-s();return r<0?t+',1':r>0?n+',1,'+e:t+',0'},a=function(){var e=u();return new t.TimeZone(t.olson.timezones[e])},f=function(e){var t=new Date(2010,6,15,1,0,0,0),n={'America/Denver':new Date(2011,2,13,3,0,0,0),'America/Mazatlan':new Date(2011,3,3,3,0,0,0),'America/Chicago':new Date(2011,2,13,3,0,0,0),'America/Mexico_City':new Date(2011,3,3,3,0,0,0),'America/Asuncion':new Date(2012,9,7,3,0,0,0),'America/Santiago':new Date(2012,9,3,3,0,0,0),'America/Campo_Grande':new Date(2012,9,21,5,0,0,0),'America/Montevideo':new Date(2011,9,2,3,0,0,0),'America/Sao_Paulo':new Date(2011,9,16,5,0,0,0),'America/Los_Angeles':new Date(2011,2,13,8,0,0,0),'America/Santa_Isabel':new Date(2011,3,5,8,0,0,0),'America/Havana':new Date(2012,2,10,2,0,0,0),'America/New_York':new Date(2012,2,10,7,0,0,0),'Asia/Beirut':new Date(2011,2,27,1,0,0,0),'Europe/Helsinki':new Date(2011,2,27,4,0,0,0),'Europe/Istanbul':new Date(2011,2,28,5,0,0,0),'Asia/Damascus':new Date(2011,3,1,2,0,0,0),'Asia/Jerusalem':new Date(2011,3,1,6,0,0,0),'Asia/Gaza':new Date(2009,2,28,0,30,0,0),'Africa/Cairo':new Date(2009,3,25,0,30,0,0),'Pacific/Auckland':new Date(2011,8,26,7,0,0,0),'Pacific/Fiji':new Date(2010,11,29,23,0,0,0),'America/Halifax':new Date(2011,2,13,6,0,0,0),'America/Goose_Bay':new Date(2011,2,13,2,1,0,0),'America/Miquelon':new Date(2011,2,13,5,0,0,0),'America/Godthab':new Date(2011,2,27,1,0,0,0),'Europe/Moscow':t,'Asia/Yekaterinburg':t,'Asia/Omsk':t,'Asia/Krasnoyarsk':t,'Asia/Irkutsk':t,'Asia/Yakutsk':t,'Asia/Vladivostok':t,'Asia/Kamchatka':t,'Europe/Minsk':t,'Australia/Perth':new Date(2008,10,1,1,0,0,0)};return n[e]};return{determine:a,date_is_dst:o,dst_start_for:f}}();t.TimeZone=function(e){'use strict';var n={'America/Denver':['America/Denver','America/Mazatlan'],'America/Chicago':['America/Chicago','America/Mexico_City'],'America/Santiago':['America/Santiago','America/Asuncion','America/Campo_Grande'],'America/Montevideo':['America/Montevideo','America/Sao_Paulo'],'Asia/Beirut':['Asia/Beirut','Europe/Helsinki','Europe/Istanbul','Asia/Damascus','Asia/Jerusalem','Asia/Gaza'],'Pacific/Auckland':['Pacific/Auckland','Pacific/Fiji'],'America/Los_Angeles':['America/Los_Angeles','America/Santa_Isabel'],'America/New_York':['America/Havana','America/New_York'],'America/Halifax':['America/Goose_Bay','America/Halifax'],'America/Godthab':['America/Miquelon','America/Godthab'],'Asia/Dubai':['Europe/Moscow'],'Asia/Dhaka':['Asia/Yekaterinburg'],'Asia/Jakarta':['Asia/Omsk'],'Asia/Shanghai':['Asia/Krasnoyarsk','Australia/Perth'],'Asia/Tokyo':['Asia/Irkutsk'],'Australia/Brisbane':['Asia/Yakutsk'],'Pacific/Noumea':['Asia/Vladivostok'],'Pacific/Tarawa':['Asia/Kamchatka'],'Africa/Johannesburg':['Asia/Gaza','Africa/Cairo'],'Asia/Baghdad':['Europe/Minsk']},r=e,i=function(){var e=n[r],i=e.length,s=0,o=e[0];for(;s<i;s+=1){o=e[s];if(t.date_is_dst(t.dst_start_for(o))){r=o;return}}},s=function(){return typeof n[r]!='undefined'};return s()&&i(),{name:function(){return r}}},t.olson={},t.olson.timezones={'-720,0':'Etc/GMT+12','-660,0':'Pacific/Pago_Pago','-600,1':'America/Adak','-600,0':'Pacific/Honolulu','-570,0':'Pacific/Marquesas','-540,0':'Pacific/Gambier','-540,1':'America/Anchorage','-480,1':'America/Los_Angeles','-480,0':'Pacific/Pitcairn','-420,0':'America/Phoenix','-420,1':'America/Denver','-360,0':'America/Guatemala','-360,1':'America/Chicago','-360,1,s':'Pacific/Easter','-300,0':'America/Bogota','-300,1':'America/New_York','-270,0':'America/Caracas','-240,1':'America/Halifax','-240,0':'America/Santo_Domingo','-240,1,s':'America/Santiago','-210,1':'America/St_Johns','-180,1':'America/Godthab','-180,0':'America/Argentina/Buenos_Aires','-180,1,s':'America/Montevideo','-120,0':'Etc/GMT+2','-120,1':'Etc/GMT+2','-60,1':'Atlantic/Azores','-60,0':'Atlantic/Cape_Verde','0,0':'Etc/UTC','0,1':'Europe/London','60,1':'Europe/Berlin','60,0':'Africa/Lagos','60,1,s':'Africa/Windhoek','120,1':'Asia/Beirut','120,0':'Africa/Johannesburg','180,0':'Asia/Baghdad','180,1':'Europe/Moscow','210,1':'Asia/Tehran','240,0':'Asia/Dubai','240,1':'Asia/Baku','270,0':'Asia/Kabul','300,1':'Asia/Yekaterinburg','300,0':'Asia/Karachi','330,0':'Asia/Kolkata','345,0':'Asia/Kathmandu','360,0':'Asia/Dhaka','360,1':'Asia/Omsk','390,0':'Asia/Rangoon','420,1':'Asia/Krasnoyarsk','420,0':'Asia/Jakarta','480,0':'Asia/Shanghai','480,1':'Asia/Irkutsk','525,0':'Australia/Eucla','525,1,s':'Australia/Eucla','540,1':'Asia/Yakutsk','540,0':'Asia/Tokyo','570,0':'Australia/Darwin','570,1,s':'Australia/Adelaide','600,0':'Australia/Brisbane','600,1':'Asia/Vladivostok','600,1,s':'Australia/Sydney','630,1,s':'Australia/Lord_Howe','660,1':'Asia/Kamchatka','660,0':'Pacific/Noumea','690,0':'Pacific/Norfolk','720,1,s':'Pacific/Auckland','720,0':'Pacific/Tarawa','765,1,s':'Pacific/Chatham','780,0':'Pacific/Tongatapu','780,1,s':'Pacific/Apia','840,0':'Pacific/Kiritimati'},typeof exports!='undefined'?exports.jstz=t:e.jstz=t})(this);var timezone=jstz.determine();\n";
 
 // HTML files
-const char WM_PK_INDEX_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width, initial-scale=1.0'>\n<title>" IOT_APPLICATION_TITLE "</title>\n<link rel='stylesheet' href='style.css'>\n<script src='module_polyfill.js'></script>\n<script src='hw-status.js'></script>\n</head>\n<body>\n<div class='container'>\n<h1>" IOT_APPLICATION_TITLE "</h1>\n<table class='sttbl' style='margin-bottom:1rem'>\n<thead><tr><th>" L_STATUS_SENSOR "</th><th>" L_STATUS_VALUE "</th><th>" L_STATUS_UNIT "</th></tr></thead>\n<tbody id='hw-st-body'>\n<tr><td colspan='3' style='text-align:center;color:var(--muted)'>" L_STATUS_LOADING "</td></tr>\n</tbody>\n</table>\n<div class='btncol'>\n<a class='mainbtn' href='/info'>" L_INFORMATION_3DOTS "</a>\n<a class='mainbtn' href='/wifi'>" L_WIFI_CONFIGURATION_3DOTS "</a>\n<a class='mainbtn' href='/mqtt'>" L_MQTT_CONFIGURATION_3DOTS "</a>\n<a class='mainbtn' href='/ota'>" L_FIRMWARE_UPDATE_3DOTS "</a>\n<a class='mainbtn' href='#' id='rstBtn'>" L_RESTART_3DOTS "</a>\n</div>\n\n<script type='module'>\nimport { showConfirmModal, showRestartModal } from './restart.js';\ndocument.getElementById('rstBtn').addEventListener('click', function(e) {\ne.preventDefault();\nshowConfirmModal(function() {\nfetch('/r');\nshowRestartModal(10, /*L_RESTART_IN_PROGRESS*/'Restart in progress...');\n});\n});\n</script>\n\n<footer class='ftr'>\n<hr>\n<div class='ftr-line'>" IOT_COPYRIGHT "<span class='muted'>Author: Kalejap</span></div>\n<div class='ftr-line' id='fwVer'>Firmware: " IOT_SW_VERSION_STRING "</div>\n</footer>\n</div>\n</body>\n</html>\n";
+const char WM_PK_INDEX_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width, initial-scale=1.0'>\n<title data-app='title'>IoT Device Control</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script src='hw-status.3bc5e939.js'></script>\n<script src='app.js'></script>\n</head>\n<body>\n<div class='container'>\n<h1 data-app='title'>IoT Device Control</h1>\n<table class='sttbl' style='margin-bottom:1rem'>\n<thead><tr><th>" L_STATUS_SENSOR "</th><th>" L_STATUS_VALUE "</th><th>" L_STATUS_UNIT "</th></tr></thead>\n<tbody id='hw-st-body'>\n<tr><td colspan='3' style='text-align:center;color:var(--muted)'>" L_STATUS_LOADING "</td></tr>\n</tbody>\n</table>\n<div class='btncol'>\n<a class='mainbtn' href='/info'>" L_INFORMATION_3DOTS "</a>\n<a class='mainbtn' href='/wifi'>" L_WIFI_CONFIGURATION_3DOTS "</a>\n<a class='mainbtn' href='/mqtt'>" L_MQTT_CONFIGURATION_3DOTS "</a>\n<a class='mainbtn' href='/ota'>" L_FIRMWARE_UPDATE_3DOTS "</a>\n<a class='mainbtn' href='#' id='rstBtn'>" L_RESTART_3DOTS "</a>\n</div>\n<script type='module'>import{showConfirmModal,showRestartModal}from'./restart.9232ccfc.js';document.getElementById('rstBtn').addEventListener('click',function(e){e.preventDefault();showConfirmModal(function(){fetch('/r');showRestartModal(10,/*L_RESTART_IN_PROGRESS*/'Restart in progress...');});});</script>\n<footer class='ftr'>\n<hr>\n<div class='ftr-line'><span data-app='copyright'>© 2025 Kalejap — </span><span class='muted'>Author: Kalejap</span></div>\n<div class='ftr-line' id='fwVer'>Firmware: <span data-app='version'>v1.0.3</span></div>\n</footer>\n</div>\n</body>\n</html>\n";
 #ifdef WM_REMOTE_UPDATE
-const char WM_PK_OTA_REMOTE_JS[] PROGMEM = "/**\n* Remote OTA update module — served as /ota-remote.js when WM_REMOTE_UPDATE is defined.\n*/\nimport { gebi } from './utils.js';\nimport { showRestartModal } from './restart.js';\n\nfunction showInfoModal(msg) {\nvar overlay = document.createElement('div');\noverlay.className = 'modal-overlay';\noverlay.innerHTML =\n'<div class=\\'modal-box\\'>' +\n'<p class=\\'modal-msg\\'>' + msg + '</p>' +\n'<div class=\\'modal-btn-row\\'>' +\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'rmOk\\'>OK</button>' +\n'</div></div>';\ndocument.body.appendChild(overlay);\ndocument.getElementById('rmOk').onclick = function() {\ndocument.body.removeChild(overlay);\n};\n}\n\nfunction showUpdateModal(data) {\nvar langs = Object.keys(data.firmwares);\nvar opts = langs.map(function(l) {\nvar sel = (l === data.lang) ? ' selected' : '';\nreturn '<option value=\\'' + l + '\\'' + sel + '>' + l + '</option>';\n}).join('');\n\nvar msg = data.available\n? ('" L_OTA_REMOTE_NEW_VERSION "' + '<strong>' + data.version + '</strong><br>' + '" L_OTA_REMOTE_CURRENT "' + data.current)\n: ('" L_OTA_REMOTE_SWITCH_LANG "' + data.version + ')');\n\nvar overlay = document.createElement('div');\noverlay.className = 'modal-overlay';\noverlay.innerHTML =\n'<div class=\\'modal-box\\'>' +\n'<p class=\\'modal-msg\\'>' + msg + '</p>' +\n'<div style=\\'margin-bottom:0.75rem;\\'>' +\n'<label class=\\'flbl\\' for=\\'rmLang\\'>' + '" L_OTA_REMOTE_LANGUAGE_LABEL "' + '</label>' +\n'<select class=\\'finp\\' id=\\'rmLang\\'>' + opts + '</select>' +\n'</div>' +\n'<div class=\\'modal-btn-row\\'>' +\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'rmUpdate\\'>' + '" L_OTA_REMOTE_UPDATE_BTN "' + '</button>' +\n'<button class=\\'modal-btn modal-btn-no\\' id=\\'rmBack\\'>' + '" L_GENERAL_BACK "' + '</button>' +\n'</div></div>';\ndocument.body.appendChild(overlay);\n\ndocument.getElementById('rmUpdate').onclick = function() {\nvar lang = document.getElementById('rmLang').value;\nvar url  = data.firmwares[lang];\ndocument.body.removeChild(overlay);\nfetch('/ota/remote-start?url=' + encodeURIComponent(url))\n.then(function() {\nshowRestartModal(30, '" L_OTA_UPDATE_IN_PROGRESS "');\n})\n.catch(function(e) {\ngebi('remoteStatus').textContent = '" L_OTA_REMOTE_START_FAILED "' + e.message;\n});\n};\ndocument.getElementById('rmBack').onclick = function() {\ndocument.body.removeChild(overlay);\n};\n}\n\ndocument.addEventListener('DOMContentLoaded', function() {\ngebi('checkRemoteBtn').addEventListener('click', async function() {\nvar url = gebi('remoteUrl').value.trim();\nif (!url) return;\ngebi('remoteStatus').textContent = '" L_OTA_REMOTE_CHECKING "';\ntry {\nvar r = await fetch('/ota/remote-check?url=' + encodeURIComponent(url));\nvar j = await r.json();\nif (j.error) {\ngebi('remoteStatus').textContent = '" L_OTA_REMOTE_ERROR "' + j.error;\nreturn;\n}\ngebi('remoteStatus').textContent = '';\nif (!j.available && !j.canSwitch) {\nshowInfoModal('" L_OTA_REMOTE_UP_TO_DATE "' + j.current);\n} else {\nshowUpdateModal(j);\n}\n} catch(e) {\ngebi('remoteStatus').textContent = '" L_OTA_REMOTE_CHECK_FAILED "' + e.message;\n}\n});\n});\n";
-const char WM_PK_OTA_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>" L_OTA_TITLE "</title>\n<link rel='stylesheet' href='style.css'>\n<script src='module_polyfill.js'></script>\n<script type='module' src='ota.js'></script>\n</head>\n<body>\n<div class='container'>\n<h1>" L_OTA_HEADING "</h1>\n\n<div class='btncol' aria-live='polite'>\n<button id='selFile' class='mainbtn' type='button'>" L_OTA_SELECT_FILE "</button>\n<span id='fwName' class='fname'>" L_OTA_NO_FILE_CHOSEN "</span>\n<input class='hidden' type='file' id='fileInput' name='firmware' accept='.bin,.bin.gz' onchange='onFileInput(files)'>\n\n<div id='fileProps' class='meta-wrap hidden' aria-hidden='false'>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_FILESIZE_LABEL "</div>\n<div id='filesize' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_FIRMWARE_VERSION_LABEL "</div>\n<div id='fmver' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_HARDWARE_ID_LABEL "</div>\n<div id='hwid' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_LANGUAGE_LABEL "</div>\n<div id='fmlang' class='meta-val'></div>\n</div>\n</div>\n</div>\n\n<div class='btncol hidden' id='progRow'>\n<div class='progwrap'>\n<progress id='otaProg' class='prog' value='0' max='100'></progress>\n<div id='otaProgTxt' class='prog-txt'>0%</div>\n</div>\n<div id='progInfo' class='meta-val'>" L_OTA_UPLOADING_FILE "</div>\n</div>\n\n<div id='errRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='red-txt'><path d='m21.73 18-8-14a2 2 0 0 0-3.48 0l-8 14A2 2 0 0 0 4 21h16a2 2 0 0 0 1.73-3Z'/><path d='M12 9v4'/><path d='M12 17h.01'/></svg>\n<div id='err' class='meta-val'></div>\n</div>\n\n<div id='successRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='green-txt'><path d='M3.85 8.62a4 4 0 0 1 4.78-4.77 4 4 0 0 1 6.74 0 4 4 0 0 1 4.78 4.78 4 4 0 0 1 0 6.74 4 4 0 0 1-4.77 4.78 4 4 0 0 1-6.75 0 4 4 0 0 1-4.78-4.77 4 4 0 0 1 0-6.76Z'/><path d='m9 12 2 2 4-4'/></svg>\n<div id='success' class='meta-val'></div>\n</div>\n\n<div class='row-center'>\n<button id='updateBtn' class='formbtn' disabled>" L_OTA_UPLOAD_UPDATE "</button>\n<a class='formbtn secbtn' id='back' href='./'>" L_GENERAL_BACK "</a>\n</div>\n\n<div id='otaStatus' class='muted center-txt' style='margin-top:0.625rem;'>" L_OTA_STATUS_HINT "</div>\n\n<hr>\n<h2>" L_OTA_REMOTE_HEADING "</h2>\n<div class='btncol'>\n<div>\n<label class='flbl' for='remoteUrl'>" L_OTA_REMOTE_URL_LABEL "</label>\n<input class='finp' type='text' id='remoteUrl' value='" IOT_OTA_UPDATE_URL "'>\n</div>\n<button id='checkRemoteBtn' class='mainbtn' type='button'>" L_OTA_REMOTE_CHECK_BTN "</button>\n</div>\n<div id='remoteStatus' class='muted center-txt' style='margin-top:0.625rem;'>" L_OTA_REMOTE_STATUS_HINT "</div>\n<script type='module' src='ota-remote.js'></script>\n</div>\n</body>\n</html>\n";
+const char WM_PK_OTA_REMOTE_JS[] PROGMEM = "const $m0=(()=>{const gebi=s=>document.getElementById(s);const IH=(l,v)=>{gebi(l).textContent=v};return{IH,gebi};})();const $m1=(()=>{function A(l){return l&&l.__esModule&&Object.prototype.hasOwnProperty.call(l,'default')?l.default:l}\nvar L={exports:{}},x={exports:{}};(function(){var l='ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/',f={rotl:function(s,d){return s<<d|s>>>32-d},rotr:function(s,d){return s<<32-d|s>>>d},endian:function(s){if(s.constructor==Number)\nreturn f.rotl(s,8)&16711935|f.rotl(s,24)&4278255360;for(var d=0;d<s.length;d++)s[d]=f.endian(s[d]);return s},randomBytes:function(s){for(var d=[];s>0;s--)\nd.push(Math.floor(Math.random()*256));return d},bytesToWords:function(s){for(var d=[],a=0,c=0;a<s.length;a++,c+=8)\nd[c>>>5]|=s[a]<<24-c%32;return d},wordsToBytes:function(s){for(var d=[],a=0;a<s.length*32;a+=8)\nd.push(s[a>>>5]>>>24-a%32&255);return d},bytesToHex:function(s){for(var d=[],a=0;a<s.length;a++)\nd.push((s[a]>>>4).toString(16)),d.push((s[a]&15).toString(16));return d.join('')},hexToBytes:function(s){for(var d=[],a=0;a<s.length;a+=2)\nd.push(parseInt(s.substr(a,2),16));return d},bytesToBase64:function(s){for(var d=[],a=0;a<s.length;a+=3)\nfor(var c=s[a]<<16|s[a+1]<<8|s[a+2],i=0;i<4;i++)\na*8+i*6<=s.length*8?d.push(l.charAt(c>>>6*(3-i)&63)):d.push('=');return d.join('')},base64ToBytes:function(s){s=s.replace(/[^A-Z0-9+\\/]/ig,'');for(var d=[],a=0,c=0;a<s.length;c=++a%4)\nc!=0&&d.push((l.indexOf(s.charAt(a-1))&Math.pow(2,-2*c+8)-1)<<c*2|l.indexOf(s.charAt(a))>>>6-c*2);return d}};x.exports=f})();var H=x.exports,F={utf8:{stringToBytes:function(l){return F.bin.stringToBytes(unescape(encodeURIComponent(l)))},bytesToString:function(l){return decodeURIComponent(escape(F.bin.bytesToString(l)))}},bin:{stringToBytes:function(l){for(var f=[],s=0;s<l.length;s++)\nf.push(l.charCodeAt(s)&255);return f},bytesToString:function(l){for(var f=[],s=0;s<l.length;s++)\nf.push(String.fromCharCode(l[s]));return f.join('')}}},I=F;var O=function(l){return l!=null&&(M(l)||P(l)||!!l._isBuffer)};function M(l){return!!l.constructor&&typeof l.constructor.isBuffer=='function'&&l.constructor.isBuffer(l)}\nfunction P(l){return typeof l.readFloatLE=='function'&&typeof l.slice=='function'&&M(l.slice(0,0))}\n(function(){var l=H,f=I.utf8,s=O,d=I.bin,a=function(c,i){c.constructor==String?i&&i.encoding==='binary'?c=d.stringToBytes(c):c=f.stringToBytes(c):s(c)?c=Array.prototype.slice.call(c,0):!Array.isArray(c)&&c.constructor!==Uint8Array&&(c=c.toString());for(var r=l.bytesToWords(c),p=c.length*8,n=1732584193,e=-271733879,o=-1732584194,t=271733878,u=0;u<r.length;u++)\nr[u]=(r[u]<<8|r[u]>>>24)&16711935|(r[u]<<24|r[u]>>>8)&4278255360;r[p>>>5]|=128<<p%32,r[(p+64>>>9<<4)+14]=p;for(var m=a._ff,g=a._gg,h=a._hh,y=a._ii,u=0;u<r.length;u+=16){var C=n,S=e,k=o,_=t;n=m(n,e,o,t,r[u+0],7,-680876936),t=m(t,n,e,o,r[u+1],12,-389564586),o=m(o,t,n,e,r[u+2],17,606105819),e=m(e,o,t,n,r[u+3],22,-1044525330),n=m(n,e,o,t,r[u+4],7,-176418897),t=m(t,n,e,o,r[u+5],12,1200080426),o=m(o,t,n,e,r[u+6],17,-1473231341),e=m(e,o,t,n,r[u+7],22,-45705983),n=m(n,e,o,t,r[u+8],7,1770035416),t=m(t,n,e,o,r[u+9],12,-1958414417),o=m(o,t,n,e,r[u+10],17,-42063),e=m(e,o,t,n,r[u+11],22,-1990404162),n=m(n,e,o,t,r[u+12],7,1804603682),t=m(t,n,e,o,r[u+13],12,-40341101),o=m(o,t,n,e,r[u+14],17,-1502002290),e=m(e,o,t,n,r[u+15],22,1236535329),n=g(n,e,o,t,r[u+1],5,-165796510),t=g(t,n,e,o,r[u+6],9,-1069501632),o=g(o,t,n,e,r[u+11],14,643717713),e=g(e,o,t,n,r[u+0],20,-373897302),n=g(n,e,o,t,r[u+5],5,-701558691),t=g(t,n,e,o,r[u+10],9,38016083),o=g(o,t,n,e,r[u+15],14,-660478335),e=g(e,o,t,n,r[u+4],20,-405537848),n=g(n,e,o,t,r[u+9],5,568446438),t=g(t,n,e,o,r[u+14],9,-1019803690),o=g(o,t,n,e,r[u+3],14,-187363961),e=g(e,o,t,n,r[u+8],20,1163531501),n=g(n,e,o,t,r[u+13],5,-1444681467),t=g(t,n,e,o,r[u+2],9,-51403784),o=g(o,t,n,e,r[u+7],14,1735328473),e=g(e,o,t,n,r[u+12],20,-1926607734),n=h(n,e,o,t,r[u+5],4,-378558),t=h(t,n,e,o,r[u+8],11,-2022574463),o=h(o,t,n,e,r[u+11],16,1839030562),e=h(e,o,t,n,r[u+14],23,-35309556),n=h(n,e,o,t,r[u+1],4,-1530992060),t=h(t,n,e,o,r[u+4],11,1272893353),o=h(o,t,n,e,r[u+7],16,-155497632),e=h(e,o,t,n,r[u+10],23,-1094730640),n=h(n,e,o,t,r[u+13],4,681279174),t=h(t,n,e,o,r[u+0],11,-358537222),o=h(o,t,n,e,r[u+3],16,-722521979),e=h(e,o,t,n,r[u+6],23,76029189),n=h(n,e,o,t,r[u+9],4,-640364487),t=h(t,n,e,o,r[u+12],11,-421815835),o=h(o,t,n,e,r[u+15],16,530742520),e=h(e,o,t,n,r[u+2],23,-995338651),n=y(n,e,o,t,r[u+0],6,-198630844),t=y(t,n,e,o,r[u+7],10,1126891415),o=y(o,t,n,e,r[u+14],15,-1416354905),e=y(e,o,t,n,r[u+5],21,-57434055),n=y(n,e,o,t,r[u+12],6,1700485571),t=y(t,n,e,o,r[u+3],10,-1894986606),o=y(o,t,n,e,r[u+10],15,-1051523),e=y(e,o,t,n,r[u+1],21,-2054922799),n=y(n,e,o,t,r[u+8],6,1873313359),t=y(t,n,e,o,r[u+15],10,-30611744),o=y(o,t,n,e,r[u+6],15,-1560198380),e=y(e,o,t,n,r[u+13],21,1309151649),n=y(n,e,o,t,r[u+4],6,-145523070),t=y(t,n,e,o,r[u+11],10,-1120210379),o=y(o,t,n,e,r[u+2],15,718787259),e=y(e,o,t,n,r[u+9],21,-343485551),n=n+C>>>0,e=e+S>>>0,o=o+k>>>0,t=t+_>>>0}\nreturn l.endian([n,e,o,t])};a._ff=function(c,i,r,p,n,e,o){var t=c+(i&r|~i&p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._gg=function(c,i,r,p,n,e,o){var t=c+(i&p|r&~p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._hh=function(c,i,r,p,n,e,o){var t=c+(i^r^p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._ii=function(c,i,r,p,n,e,o){var t=c+(r^(i|~p))+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._blocksize=16,a._digestsize=16,L.exports=function(c,i){if(c==null)\nthrow new Error('" L_OTA_JS_ILEGAL_ARGUMENT "'+c);var r=l.wordsToBytes(a(c,i));return i&&i.asBytes?r:i&&i.asString?d.bytesToString(r):l.bytesToHex(r)}})();var U=L.exports;const R=A(U);return{R};})();const $m2=(()=>{var _modalCss='.modal-overlay{position:fixed;inset:0;background:rgba(0,0,0,0.55);display:flex;align-items:center;justify-content:center;z-index:9999}'+\n'.modal-box{background:#fff;border-radius:.75rem;box-shadow:0 8px 32px rgba(0,0,0,.28);padding:2.5rem 2rem;text-align:center;min-width:220px}'+\n'.spinner{width:52px;height:52px;border:5px solid rgba(25,118,210,.15);border-top-color:#1976d2;border-radius:50%;animation:spin .8s linear infinite;margin:0 auto 1.25rem}'+\n'@keyframes spin{to{transform:rotate(360deg)}}'+\n'.modal-msg{color:#718792;margin-bottom:.75rem;font-size:1.05rem;white-space:pre-line}'+\n'.modal-cnt{font-size:2.5rem;font-weight:700;color:#1976d2}'+\n'.modal-btn-row{display:flex;gap:.75rem;justify-content:center;margin-top:1.25rem}'+\n'.modal-btn{padding:.6rem 1.5rem;border:none;border-radius:.5rem;font-size:1rem;font-weight:600;cursor:pointer}'+\n'.modal-btn-yes{background:#1976d2;color:#fff}'+\n'.modal-btn-no{background:transparent;color:#718792;border:.125rem solid rgba(25,118,210,.2)}';function ensureModalCss(){if(!document.getElementById('rModalCss')){var s=document.createElement('style');s.id='rModalCss';s.textContent=_modalCss;document.head.appendChild(s);}}\nfunction showRestartModal(seconds,message){ensureModalCss();var msg=(message!==undefined)?message:'" L_RESTART_IN_PROGRESS "';var div=document.createElement('div');div.className='modal-overlay';div.innerHTML='<div class=\\'modal-box\\'>'+\n'<div class=\\'spinner\\'></div>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-cnt\\' id=\\'rCnt\\'>'+seconds+'</div>'+\n'</div>';document.body.appendChild(div);var n=seconds;var t=setInterval(function(){n--;var el=document.getElementById('rCnt');if(el)el.textContent=n;if(n<=0){clearInterval(t);location.href='/';}},1000);}\nreturn{showRestartModal};})();const $m3=(()=>{const{gebi,IH}=$m0;const{R}=$m1;const{showRestartModal}=$m2;const v=l=>{gebi(l).classList.remove('hidden');};const H=l=>{gebi(l).classList.add('hidden');};const w=l=>{gebi('progInfo').textContent=l;};const E=l=>{gebi('err').textContent=l;};function fid(buf,tag){const b=new Uint8Array(buf);const tb=new TextEncoder().encode(tag);for(let i=0;i<=b.length-tb.length;i++){let found=true;for(let j=0;j<tb.length;j++){if(b[i+j]!==tb[j]){found=false;break;}}\nif(found){let ib=[];let k=i+tb.length;while(k<b.length&&b[k]!==0){ib.push(b[k]);k++;}\nreturn new TextDecoder().decode(new Uint8Array(ib));}}\nreturn null;}\nconst D1=async(f)=>new Promise((resolve,reject)=>{let reader=new FileReader();reader.onload=function(event){const arrayBuffer=event.target.result;const md5=R(arrayBuffer);const hwid=fid(arrayBuffer,'@*MAGic*@:hw:');const ver=fid(arrayBuffer,'@*MAGic*@:ve:');const lang=fid(arrayBuffer,'@*MAGic*@:lg:');resolve({md5,hwid,ver,lang});};reader.onerror=reject;reader.readAsArrayBuffer(f);});let hwidQuery=null;const devHwid=()=>hwidQuery||(hwidQuery=fetch('/sq?dx=hwid').then(r=>r.json()).catch(e=>{hwidQuery=null;throw e;}));const N=async l=>{let f='fr';const{md5,hwid,ver,lang}=await D1(l);if(hwid!=null&&ver!=null)\n{v('fileProps');IH('fwName',l.name);IH('filesize',l.size.toString()+' B');IH('hwid',hwid);IH('fmver',ver);IH('fmlang',lang!=null?lang:'');H('successRow');try{const dJ=await devHwid();if(dJ.hwid&&dJ.hwid===hwid){gebi('hwid').classList.remove('red-txt');gebi('updateBtn').disabled=false;gebi('err').textContent='';H('errRow');}else{gebi('hwid').classList.add('red-txt');gebi('updateBtn').disabled=true;E('" L_OTA_JS_HWID_MISMATCH "');v('errRow');return null;}}catch(e){gebi('updateBtn').disabled=true;E('" L_OTA_JS_HWID_MISMATCH "');v('errRow');return null;}\nreturn{'md5':md5,'file':l,'hwid':hwid};}\nelse\n{H('fileProps');IH('fwName',l.name);gebi('updateBtn').disabled=true;E('Incorrect file selected.');H('successRow');v('errRow');}\nreturn null;};const V=l=>l.length>1&&!multiple?(alert('" L_OTA_JS_UPLOAD_ONE_BIN_FILE "'),!1):l[0].name.split('.').pop()!='bin'?(alert('" L_OTA_JS_UPLOAD_ONLY_BIN_FILES "'),!1):!0;function G(){window.location.reload()}\nfunction PG(v){gebi('otaProg').value=v;gebi('otaProgTxt').innerHTML=v.toString()+'%';}\nvar timeOut;function finishedOK(){H('progRow');showRestartModal(15,'" L_OTA_UPDATE_IN_PROGRESS "');}\nfunction failed(msg){E(msg);gebi('updateBtn').disabled=false;gebi('back').disabled=false;H('progRow');v('errRow');}\nasync function startUpload(file,md5,hwid){let f='fr';PG(0);H('errRow');H('successRow');v('progRow');try{w('Uploading '+file.name);const d=await fetch(`/ota/start?mode=${f}&hash=${md5}&hwid=${hwid}`);if(!d.ok)\n{throw new Error(d.statusText);}\nif(d.status==200&&d.statusText!=='OK')\n{throw new Error(d.statusText);}\nconst a=await d.text();console.log('Start OTA response:',a);const c=new FormData;let i=new XMLHttpRequest;i.open('POST','/ota/upload');i.upload.addEventListener('progress',function(r){let p=Math.round(r.loaded/r.total*100);PG(p);},!1);i.upload.onprogress=function(r){if(r.lengthComputable){let p=Math.round(r.loaded/r.total*100);PG(p);}};i.onreadystatechange=function(){if(i.readyState==4)\nif(i.status==200)\nfinishedOK();else if(i.status==400){let r=i.responseText;throw new Error('" L_OTA_JS_UPLOAD_FAILED "'+' '+r);}\nelse{let r='" L_OTA_JS_SERVER_RETURNED_STATUS "'+i.status;throw new Error('" L_OTA_JS_UPLOAD_FAILED "'+' '+r);}};c.append('file',file,file.name);i.send(c);}\ncatch(s){failed(s);}}\nlet selectedFile=null;async function z(files){if(!V(files))\nreturn false;const result=await N(files[0]);if(result!=null){selectedFile=result;}else{selectedFile=null;}\ngebi('fileInput').value='';}\nwindow.resetView=G;window.onFileInput=z;document.addEventListener('DOMContentLoaded',()=>{var q=gebi('selFile'),fileInp=gebi('fileInput');const updateBtn=gebi('updateBtn');q.addEventListener('click',function(l){l.preventDefault(),fileInp.click()});updateBtn.addEventListener('click',async(e)=>{e.preventDefault();if(selectedFile&&selectedFile.file&&selectedFile.md5){updateBtn.disabled=true;gebi('back').disabled=true;startUpload(selectedFile.file,selectedFile.md5,selectedFile.hwid);}else{console.error('No valid file selected for upload.');alert('Please select a valid firmware file first.');}});});return{};})();(()=>{const{gebi}=$m0;const{showRestartModal}=$m2;function showInfoModal(msg){var overlay=document.createElement('div');overlay.className='modal-overlay';overlay.innerHTML='<div class=\\'modal-box\\'>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-btn-row\\'>'+\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'rmOk\\'>OK</button>'+\n'</div></div>';document.body.appendChild(overlay);document.getElementById('rmOk').onclick=function(){document.body.removeChild(overlay);};}\nfunction showUpdateModal(data){var langs=Object.keys(data.firmwares);var opts=langs.map(function(l){var sel=(l===data.lang)?' selected':'';return'<option value=\\''+l+'\\''+sel+'>'+l+'</option>';}).join('');var msg=data.available?('" L_OTA_REMOTE_NEW_VERSION "'+'<strong>'+data.version+'</strong><br>'+'" L_OTA_REMOTE_CURRENT "'+data.current):('" L_OTA_REMOTE_SWITCH_LANG "'+data.version+')');var overlay=document.createElement('div');overlay.className='modal-overlay';overlay.innerHTML='<div class=\\'modal-box\\'>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div style=\\'margin-bottom:0.75rem;\\'>'+\n'<label class=\\'flbl\\' for=\\'rmLang\\'>'+'" L_OTA_REMOTE_LANGUAGE_LABEL "'+'</label>'+\n'<select class=\\'finp\\' id=\\'rmLang\\'>'+opts+'</select>'+\n'</div>'+\n'<div class=\\'modal-btn-row\\'>'+\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'rmUpdate\\'>'+'" L_OTA_REMOTE_UPDATE_BTN "'+'</button>'+\n'<button class=\\'modal-btn modal-btn-no\\' id=\\'rmBack\\'>'+'" L_GENERAL_BACK "'+'</button>'+\n'</div></div>';document.body.appendChild(overlay);document.getElementById('rmUpdate').onclick=function(){var lang=document.getElementById('rmLang').value;var url=data.firmwares[lang];document.body.removeChild(overlay);fetch('/ota/remote-start?url='+encodeURIComponent(url))\n.then(function(){showRestartModal(30,'" L_OTA_UPDATE_IN_PROGRESS "');})\n.catch(function(e){gebi('remoteStatus').textContent='" L_OTA_REMOTE_START_FAILED "'+e.message;});};document.getElementById('rmBack').onclick=function(){document.body.removeChild(overlay);};}\ndocument.addEventListener('DOMContentLoaded',function(){gebi('checkRemoteBtn').addEventListener('click',async function(){var url=gebi('remoteUrl').value.trim();if(!url)return;gebi('remoteStatus').textContent='" L_OTA_REMOTE_CHECKING "';try{var r=await fetch('/ota/remote-check?url='+encodeURIComponent(url));var j=await r.json();if(j.error){gebi('remoteStatus').textContent='" L_OTA_REMOTE_ERROR "'+j.error;return;}\ngebi('remoteStatus').textContent='';if(!j.available&&!j.canSwitch){showInfoModal('" L_OTA_REMOTE_UP_TO_DATE "'+j.current);}else{showUpdateModal(j);}}catch(e){gebi('remoteStatus').textContent='" L_OTA_REMOTE_CHECK_FAILED "'+e.message;}});});})();\n";
+const char WM_PK_OTA_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>" L_OTA_TITLE "</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script type='module' src='ota-remote.e05884bb.js'></script>\n<script src='app.js'></script>\n</head>\n<body>\n<div class='container'>\n<h1>" L_OTA_HEADING "</h1>\n<div class='btncol' aria-live='polite'>\n<button id='selFile' class='mainbtn' type='button'>" L_OTA_SELECT_FILE "</button>\n<span id='fwName' class='fname'>" L_OTA_NO_FILE_CHOSEN "</span>\n<input class='hidden' type='file' id='fileInput' name='firmware' accept='.bin,.bin.gz' onchange='onFileInput(files)'>\n<div id='fileProps' class='meta-wrap hidden' aria-hidden='false'>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_FILESIZE_LABEL "</div>\n<div id='filesize' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_FIRMWARE_VERSION_LABEL "</div>\n<div id='fmver' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_HARDWARE_ID_LABEL "</div>\n<div id='hwid' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_LANGUAGE_LABEL "</div>\n<div id='fmlang' class='meta-val'></div>\n</div>\n</div>\n</div>\n<div class='btncol hidden' id='progRow'>\n<div class='progwrap'>\n<progress id='otaProg' class='prog' value='0' max='100'></progress>\n<div id='otaProgTxt' class='prog-txt'>0%</div>\n</div>\n<div id='progInfo' class='meta-val'>" L_OTA_UPLOADING_FILE "</div>\n</div>\n<div id='errRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='red-txt'><path d='m21.73 18-8-14a2 2 0 0 0-3.48 0l-8 14A2 2 0 0 0 4 21h16a2 2 0 0 0 1.73-3Z'/><path d='M12 9v4'/><path d='M12 17h.01'/></svg>\n<div id='err' class='meta-val'></div>\n</div>\n<div id='successRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='green-txt'><path d='M3.85 8.62a4 4 0 0 1 4.78-4.77 4 4 0 0 1 6.74 0 4 4 0 0 1 4.78 4.78 4 4 0 0 1 0 6.74 4 4 0 0 1-4.77 4.78 4 4 0 0 1-6.75 0 4 4 0 0 1-4.78-4.77 4 4 0 0 1 0-6.76Z'/><path d='m9 12 2 2 4-4'/></svg>\n<div id='success' class='meta-val'></div>\n</div>\n<div class='row-center'>\n<button id='updateBtn' class='formbtn' disabled>" L_OTA_UPLOAD_UPDATE "</button>\n<a class='formbtn secbtn' id='back' href='./'>" L_GENERAL_BACK "</a>\n</div>\n<div id='otaStatus' class='muted center-txt' style='margin-top:0.625rem;'>" L_OTA_STATUS_HINT "</div>\n<hr>\n<h2>" L_OTA_REMOTE_HEADING "</h2>\n<div class='btncol'>\n<div>\n<label class='flbl' for='remoteUrl'>" L_OTA_REMOTE_URL_LABEL "</label>\n<input class='finp' type='text' id='remoteUrl' value='' data-app='otaUrl'>\n</div>\n<button id='checkRemoteBtn' class='mainbtn' type='button'>" L_OTA_REMOTE_CHECK_BTN "</button>\n</div>\n<div id='remoteStatus' class='muted center-txt' style='margin-top:0.625rem;'>" L_OTA_REMOTE_STATUS_HINT "</div>\n</div>\n</body>\n</html>\n";
 #else
-const char WM_PK_OTA_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>" L_OTA_TITLE "</title>\n<link rel='stylesheet' href='style.css'>\n<script src='module_polyfill.js'></script>\n<script type='module' src='ota.js'></script>\n</head>\n<body>\n<div class='container'>\n<h1>" L_OTA_HEADING "</h1>\n\n<div class='btncol' aria-live='polite'>\n<button id='selFile' class='mainbtn' type='button'>" L_OTA_SELECT_FILE "</button>\n<span id='fwName' class='fname'>" L_OTA_NO_FILE_CHOSEN "</span>\n<input class='hidden' type='file' id='fileInput' name='firmware' accept='.bin,.bin.gz' onchange='onFileInput(files)'>\n\n<div id='fileProps' class='meta-wrap hidden' aria-hidden='false'>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_FILESIZE_LABEL "</div>\n<div id='filesize' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_FIRMWARE_VERSION_LABEL "</div>\n<div id='fmver' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_HARDWARE_ID_LABEL "</div>\n<div id='hwid' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_LANGUAGE_LABEL "</div>\n<div id='fmlang' class='meta-val'></div>\n</div>\n</div>\n</div>\n\n<div class='btncol hidden' id='progRow'>\n<div class='progwrap'>\n<progress id='otaProg' class='prog' value='0' max='100'></progress>\n<div id='otaProgTxt' class='prog-txt'>0%</div>\n</div>\n<div id='progInfo' class='meta-val'>" L_OTA_UPLOADING_FILE "</div>\n</div>\n\n<div id='errRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='red-txt'><path d='m21.73 18-8-14a2 2 0 0 0-3.48 0l-8 14A2 2 0 0 0 4 21h16a2 2 0 0 0 1.73-3Z'/><path d='M12 9v4'/><path d='M12 17h.01'/></svg>\n<div id='err' class='meta-val'></div>\n</div>\n\n<div id='successRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='green-txt'><path d='M3.85 8.62a4 4 0 0 1 4.78-4.77 4 4 0 0 1 6.74 0 4 4 0 0 1 4.78 4.78 4 4 0 0 1 0 6.74 4 4 0 0 1-4.77 4.78 4 4 0 0 1-6.75 0 4 4 0 0 1-4.78-4.77 4 4 0 0 1 0-6.76Z'/><path d='m9 12 2 2 4-4'/></svg>\n<div id='success' class='meta-val'></div>\n</div>\n\n<div class='row-center'>\n<button id='updateBtn' class='formbtn' disabled>" L_OTA_UPLOAD_UPDATE "</button>\n<a class='formbtn secbtn' id='back' href='./'>" L_GENERAL_BACK "</a>\n</div>\n\n<div id='otaStatus' class='muted center-txt' style='margin-top:0.625rem;'>" L_OTA_STATUS_HINT "</div>\n</div>\n</body>\n</html>\n";
+const char WM_PK_OTA_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>" L_OTA_TITLE "</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script type='module' src='ota.cc5ed494.js'></script>\n</head>\n<body>\n<div class='container'>\n<h1>" L_OTA_HEADING "</h1>\n<div class='btncol' aria-live='polite'>\n<button id='selFile' class='mainbtn' type='button'>" L_OTA_SELECT_FILE "</button>\n<span id='fwName' class='fname'>" L_OTA_NO_FILE_CHOSEN "</span>\n<input class='hidden' type='file' id='fileInput' name='firmware' accept='.bin,.bin.gz' onchange='onFileInput(files)'>\n<div id='fileProps' class='meta-wrap hidden' aria-hidden='false'>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_FILESIZE_LABEL "</div>\n<div id='filesize' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_FIRMWARE_VERSION_LABEL "</div>\n<div id='fmver' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_HARDWARE_ID_LABEL "</div>\n<div id='hwid' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>" L_OTA_LANGUAGE_LABEL "</div>\n<div id='fmlang' class='meta-val'></div>\n</div>\n</div>\n</div>\n<div class='btncol hidden' id='progRow'>\n<div class='progwrap'>\n<progress id='otaProg' class='prog' value='0' max='100'></progress>\n<div id='otaProgTxt' class='prog-txt'>0%</div>\n</div>\n<div id='progInfo' class='meta-val'>" L_OTA_UPLOADING_FILE "</div>\n</div>\n<div id='errRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='red-txt'><path d='m21.73 18-8-14a2 2 0 0 0-3.48 0l-8 14A2 2 0 0 0 4 21h16a2 2 0 0 0 1.73-3Z'/><path d='M12 9v4'/><path d='M12 17h.01'/></svg>\n<div id='err' class='meta-val'></div>\n</div>\n<div id='successRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='green-txt'><path d='M3.85 8.62a4 4 0 0 1 4.78-4.77 4 4 0 0 1 6.74 0 4 4 0 0 1 4.78 4.78 4 4 0 0 1 0 6.74 4 4 0 0 1-4.77 4.78 4 4 0 0 1-6.75 0 4 4 0 0 1-4.78-4.77 4 4 0 0 1 0-6.76Z'/><path d='m9 12 2 2 4-4'/></svg>\n<div id='success' class='meta-val'></div>\n</div>\n<div class='row-center'>\n<button id='updateBtn' class='formbtn' disabled>" L_OTA_UPLOAD_UPDATE "</button>\n<a class='formbtn secbtn' id='back' href='./'>" L_GENERAL_BACK "</a>\n</div>\n<div id='otaStatus' class='muted center-txt' style='margin-top:0.625rem;'>" L_OTA_STATUS_HINT "</div>\n</div>\n</body>\n</html>\n";
 #endif
-const char WM_PK_INFO_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>" L_DEVICE_STATUS "</title>\n<link rel='stylesheet' href='style.css'>\n<script src='module_polyfill.js'></script>\n<script type='module'>\n// Import necessary utilities\nimport { gebi, IH, j2t, u2t } from './utils.js';\n\nwindow.onload = () => {\nu2t('./sq?dx=hwinfo', 'tcont1', {tableClass: 'sttbl', colHeadLocals: {}});\nu2t('./sq?dx=fwinfo', 'tcont2', {tableClass: 'sttbl', colHeadLocals: {}});\n};\n</script>\n</head>\n<body>\n<div class='container'>\n<h1>" L_DEVICE_INFO "</h1>\n<div id='tcont1'></div>\n<div id='tcont2'></div>\n<div class='row-center' style='margin-top:1.125rem;'>\n<a class='mainbtn' href='/status/update'>" L_GENERAL_REFRESH "</a>\n<a class='formbtn secbtn' href='/'>" L_GENERAL_BACK "</a>\n</div>\n</div>\n</body>\n</html>\n";
-const char WM_PK_WIFI_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width, initial-scale=1.0'>\n<title>" L_WIFI_CONFIGURATION "</title>\n<link rel='stylesheet' href='style.css'>\n<script src='module_polyfill.js'></script>\n<script type='module'>\n// Import necessary utilities\nimport { gebi, qsa, u2f } from './utils.js';\n\n// Get all password toggle buttons\n//const toggleButtons = document.querySelectorAll('.toggle-password');\nconst toggleButtons = qsa('.toggle-password');\n\n// Original event listener logic adapted for module structure\ndocument.addEventListener('DOMContentLoaded', () => {\n\n// Iterate over each button and attach the click listener\ntoggleButtons.forEach(button => {\nbutton.addEventListener('click', function() {\n// Get the ID of the target input from the data-target attribute\nconst targetId = this.getAttribute('data-target');\nconst passwordInput = gebi(targetId);\n\nif (passwordInput) {\n// Toggle the type attribute\nconst type = passwordInput.getAttribute('type') === 'password' ? 'text' : 'password';\npasswordInput.setAttribute('type', type);\n\n// Toggle the button icon\nthis.textContent = type === 'password' ? '👁️' : '🔒';\n}\n});\n});\n});\n\nwindow.onload = () => {\nu2f('./sq?dx=wifi');\n};\n\n</script>\n</head>\n<body>\n<div class='container'>\n<h1>" L_WIFI_CONFIGURATION "</h1>\n<form class='formsec' method='POST' action='./wifi'>\n<h2>" L_WIFI_PRIMARY_NETWORK "</h2>\n<div>\n<label class='flbl' for='ssid1'>" L_WIFI_SSID_1 "</label>\n<input class='finp' type='text' id='ssid1' name='ssid1' required aria-label='WiFi SSID'>\n</div>\n<div>\n<label class='flbl' for='pwd1'>" L_WIFI_PASSWORD_1 "</label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd1' name='pwd1' aria-label='WiFi Password'>\n<button type='button' class='toggle-password' id='toggle_p' data-target='pwd1' aria-label='Toggle password 1 visibility'>👁️</button>\n</div>\n</div>\n<div class='muted'>" L_WIFI_OPEN_NETWORK_HINT "</div>\n<hr>\n<h2>" L_WIFI_ALT_NETWORK "</h2>\n<div>\n<label class='flbl' for='ssid2'>" L_WIFI_SSID_2 "</label>\n<input class='finp' type='text' id='ssid2' name='ssid2' required aria-label='WiFi SSID'>\n</div>\n<div>\n<label class='flbl' for='pwd2'>" L_WIFI_PASSWORD_2 "</label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd2' name='pwd2' aria-label='WiFi Password'>\n<button type='button' class='toggle-password' id='toggle_pwd1' data-target='pwd2' aria-label='Toggle password 2 visibility'>👁️</button>\n</div>\n</div>\n<div class='muted'>" L_WIFI_OPEN_NETWORK_HINT "</div>\n\n<div class='row-center'>\n<button class='formbtn' type='submit'>" L_WIFI_SAVE "</button>\n<a class='formbtn secbtn' href='/'>" L_GENERAL_BACK "</a>\n</div>\n</form>\n</div>\n</body>\n</html>\n";
+const char WM_PK_INFO_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>" L_DEVICE_STATUS "</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script type='module'>import{gebi,IH,d2t,sq}from'./utils.f070d5e4.js';window.onload=async()=>{const opt={tableClass:'sttbl',colHeadLocals:{}};try{const d=await sq('hwinfo','fwinfo');d2t(d.hwinfo,'tcont1',opt);d2t(d.fwinfo,'tcont2',opt);}catch(error){IH('tcont1',`Error: ${error.message}`);}};</script>\n</head>\n<body>\n<div class='container'>\n<h1>" L_DEVICE_INFO "</h1>\n<div id='tcont1'></div>\n<div id='tcont2'></div>\n<div class='row-center' style='margin-top:1.125rem;'>\n<a class='mainbtn' href='/status/update'>" L_GENERAL_REFRESH "</a>\n<a class='formbtn secbtn' href='/'>" L_GENERAL_BACK "</a>\n</div>\n</div>\n</body>\n</html>\n";
+const char WM_PK_WIFI_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width, initial-scale=1.0'>\n<title>" L_WIFI_CONFIGURATION "</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script type='module'>import{gebi,qsa,u2f}from'./utils.f070d5e4.js';const toggleButtons=qsa('.toggle-password');document.addEventListener('DOMContentLoaded',()=>{toggleButtons.forEach(button=>{button.addEventListener('click',function(){const targetId=this.getAttribute('data-target');const passwordInput=gebi(targetId);if(passwordInput){const type=passwordInput.getAttribute('type')==='password'?'text':'password';passwordInput.setAttribute('type',type);this.textContent=type==='password'?'👁️':'🔒';}});});});window.onload=()=>{u2f('./sq?dx=wifi');};</script>\n</head>\n<body>\n<div class='container'>\n<h1>" L_WIFI_CONFIGURATION "</h1>\n<form class='formsec' method='POST' action='./wifi'>\n<h2>" L_WIFI_PRIMARY_NETWORK "</h2>\n<div>\n<label class='flbl' for='ssid1'>" L_WIFI_SSID_1 "</label>\n<input class='finp' type='text' id='ssid1' name='ssid1' required aria-label='WiFi SSID'>\n</div>\n<div>\n<label class='flbl' for='pwd1'>" L_WIFI_PASSWORD_1 "</label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd1' name='pwd1' aria-label='WiFi Password'>\n<button type='button' class='toggle-password' id='toggle_p' data-target='pwd1' aria-label='Toggle password 1 visibility'>👁️</button>\n</div>\n</div>\n<div class='muted'>" L_WIFI_OPEN_NETWORK_HINT "</div>\n<hr>\n<h2>" L_WIFI_ALT_NETWORK "</h2>\n<div>\n<label class='flbl' for='ssid2'>" L_WIFI_SSID_2 "</label>\n<input class='finp' type='text' id='ssid2' name='ssid2' required aria-label='WiFi SSID'>\n</div>\n<div>\n<label class='flbl' for='pwd2'>" L_WIFI_PASSWORD_2 "</label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd2' name='pwd2' aria-label='WiFi Password'>\n<button type='button' class='toggle-password' id='toggle_pwd1' data-target='pwd2' aria-label='Toggle password 2 visibility'>👁️</button>\n</div>\n</div>\n<div class='muted'>" L_WIFI_OPEN_NETWORK_HINT "</div>\n<div class='row-center'>\n<button class='formbtn' type='submit'>" L_WIFI_SAVE "</button>\n<a class='formbtn secbtn' href='/'>" L_GENERAL_BACK "</a>\n</div>\n</form>\n</div>\n</body>\n</html>\n";
 #ifdef WM_SUPPORT_HOME_ASSISTANT
-const char WM_PK_MQTT_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>" L_MQTT_CONFIGURATION "</title>\n<link rel='stylesheet' href='style.css'>\n<script src='module_polyfill.js'></script>\n<script type='module'>\nimport { gebi, qsa, u2f } from './utils.js';\n\nconst toggleButtons = qsa('.toggle-password');\n\nwindow.onload = () => { u2f('./sq?dx=mqtt'); };\n\ndocument.addEventListener('DOMContentLoaded', () => {\ntoggleButtons.forEach(button => {\nbutton.addEventListener('click', function() {\nconst targetId = this.getAttribute('data-target');\nconst passwordInput = gebi(targetId);\n\nif (passwordInput) {\nconst type = passwordInput.getAttribute('type') === 'password' ? 'text' : 'password';\npasswordInput.setAttribute('type', type);\nthis.textContent = type === 'password' ? '👁️' : '🔒';\n}\n});\n});\n});\n</script>\n</head>\n<body>\n<div class='container'>\n<h1 class='ttl'>" L_MQTT_CONFIGURATION "</h1>\n<form class='formsec' method='POST' action='/mqtt'>\n<div>\n<label class='flbl' for='host'>" L_MQTT_HOST "</label>\n<input class='finp' type='text' id='host' name='host' required aria-label='MQTT host'>\n</div>\n<div>\n<label class='flbl' for='port'>" L_MQTT_PORT "</label>\n<input class='finp' type='number' id='port' name='port' value='1883' required aria-label='MQTT port'>\n</div>\n<div>\n<label class='flbl' for='user'>" L_MQTT_USERNAME "</label>\n<input class='finp' type='text' id='user' name='user' aria-label='MQTT username'>\n</div>\n<div>\n<label class='flbl' for='pwd'>" L_MQTT_PASSWORD "</label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd' name='pwd' aria-label='MQTT Password'>\n<button type='button' class='toggle-password' id='toggle_pwd' data-target='pwd' aria-label='Toggle password visibility'>👁️</button>\n</div>\n</div>\n<div class='muted'>" L_MQTT_BROKER_HINT "</div>\n<div class='row-center'>\n<button class='formbtn' type='submit'>" L_MQTT_SAVE "</button>\n<a class='formbtn secbtn' href='/'>" L_GENERAL_BACK "</a>\n</div>\n</form>\n</div>\n</body>\n</html>\n";
+const char WM_PK_MQTT_HTML[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>" L_MQTT_CONFIGURATION "</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script type='module'>import{gebi,qsa,u2f}from'./utils.f070d5e4.js';const toggleButtons=qsa('.toggle-password');window.onload=()=>{u2f('./sq?dx=mqtt');};document.addEventListener('DOMContentLoaded',()=>{toggleButtons.forEach(button=>{button.addEventListener('click',function(){const targetId=this.getAttribute('data-target');const passwordInput=gebi(targetId);if(passwordInput){const type=passwordInput.getAttribute('type')==='password'?'text':'password';passwordInput.setAttribute('type',type);this.textContent=type==='password'?'👁️':'🔒';}});});});</script>\n</head>\n<body>\n<div class='container'>\n<h1 class='ttl'>" L_MQTT_CONFIGURATION "</h1>\n<form class='formsec' method='POST' action='/mqtt'>\n<div>\n<label class='flbl' for='host'>" L_MQTT_HOST "</label>\n<input class='finp' type='text' id='host' name='host' required aria-label='MQTT host'>\n</div>\n<div>\n<label class='flbl' for='port'>" L_MQTT_PORT "</label>\n<input class='finp' type='number' id='port' name='port' value='1883' required aria-label='MQTT port'>\n</div>\n<div>\n<label class='flbl' for='user'>" L_MQTT_USERNAME "</label>\n<input class='finp' type='text' id='user' name='user' aria-label='MQTT username'>\n</div>\n<div>\n<label class='flbl' for='pwd'>" L_MQTT_PASSWORD "</label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd' name='pwd' aria-label='MQTT Password'>\n<button type='button' class='toggle-password' id='toggle_pwd' data-target='pwd' aria-label='Toggle password visibility'>👁️</button>\n</div>\n</div>\n<div class='muted'>" L_MQTT_BROKER_HINT "</div>\n<div class='row-center'>\n<button class='formbtn' type='submit'>" L_MQTT_SAVE "</button>\n<a class='formbtn secbtn' href='/'>" L_GENERAL_BACK "</a>\n</div>\n</form>\n</div>\n</body>\n</html>\n";
 #endif
 
 
 // CSS files
-const char WM_PK_STYLE_CSS[] PROGMEM = ":root {\n--bg-1: #f4f7fb;\n--card-bg: #ffffff;\n--accent: #1976d2;\n--accent-2: #38e0fc;\n--muted: #718792;\n--header: #29b4d3;\n--danger: #d84315;\n--disabled: #dddddd;\n--radius-lg: 0.75rem; /* 12px */\n--radius-sm: 0.375rem; /* 6px */\n--tw-text-opacity: 1;\n}\n\n/* Global layout */\nhtml, body {\nmargin: 0;\npadding: 0;\nfont-family: 'Segoe UI', Roboto, Arial, sans-serif;\nbackground: var(--bg-1);\ncolor: #12232b;\n-webkit-font-smoothing: antialiased;\n}\n\n.container {\nmax-width: 26.25rem; /* 420px */\nwidth: 100%;\nmargin: 1.75rem auto; /* 28px */\nbackground: var(--card-bg);\nborder-radius: var(--radius-lg);\nbox-shadow: 0 0.375rem 1.125rem rgba(10,30,40,0.06); /* 6px 18px */\npadding: 1.375rem; /* 22px */\nbox-sizing: border-box;\ntext-align: center;\nborder: 0.0625rem solid rgba(25,118,210,0.06); /* 1px */\n}\n\nh1 {\nfont-size: 1.8rem;\ncolor: var(--accent);\nmargin: 0.375rem 0 1.25rem 0; /* 6px 0 20px 0 */\nfont-weight: 700;\n}\n\nh2 {\nfont-size: 1.1rem;\ncolor: var(--accent);\nmargin: 0.375rem 0 1.25rem 0; /* 6px 0 20px 0 */\nfont-weight: 700;\n}\n\n\n/* Reusable column with consistent max width */\n.btncol,\n.formsec {\nmax-width: 340px;\nmargin-left: auto;\nmargin-right: auto;\n}\n\n.btncol {\ndisplay: flex;\nflex-direction: column;\ngap: 0.875rem; /* 14px */\nalign-items: stretch;\n}\n\n/* Primary button style used for anchors and buttons */\n.mainbtn,\n.formbtn {\ndisplay: inline-block;\ntext-decoration: none;\ntext-align: center;\nbackground: linear-gradient(90deg, var(--accent) 0%, var(--accent-2) 100%);\ncolor: #ffffff;\nborder: none;\nborder-radius: 0.625rem; /* 10px */\npadding: 0.75rem 0.875rem; /* 12px 14px */\nfont-size: 1.05rem;\nfont-weight: 600;\ncursor: pointer;\ntransition: transform 0.08s ease, box-shadow 0.12s ease;\nbox-shadow: 0 0.375rem 0.875rem rgba(25,118,210,0.08); /* 6px 14px */\n}\n\n.mainbtn:active,\n.formbtn:active { transform: translateY(0.0625rem); /* 1px */ }\n.mainbtn:hover,\n.formbtn:hover { box-shadow: 0 0.625rem 1.25rem rgba(25,118,210,0.12); /* 10px 20px */ }\n.mainbtn:disabled,\n.formbtn:disabled { background: var(--disabled); transition: unset; }\n\n.secbtn {\nbackground: transparent;\ncolor: var(--accent);\nborder: 0.125rem solid rgba(25,118,210,0.12); /* 2px */\nbox-shadow: none;\n}\n\n/* ... existing styles ... */\n\n/* Form styles - UNCOMMENTED, you had it commented out, I'm assuming you need it\n.formsec {\nmargin: 0.5rem 0 2rem 0;\ntext-align: left;\ndisplay: flex;\nflex-direction: column;\ngap: 0.625rem;\n}\n*/\n/* END Form styles */\n\n.flbl {\ndisplay: block;\nmargin-bottom: 0.375rem; /* 6px */\nmargin-top: 0.5rem;\ntext-align: left;\ncolor: var(--accent);\nfont-weight: 600;\nfont-size: 0.95rem;\n}\n\n/* New wrapper for password input and toggle button */\n.password-wrapper {\nposition: relative;\ndisplay: flex;\nalign-items: center; /* Ensures vertical alignment */\n}\n\n/* Ensure password input fills the wrapper and has padding for the button */\n.password-input {\npadding-right: 3rem !important; /* Make space for the button */\n}\n\n.finp {\nwidth: 100%;\npadding: 0.625rem 0.75rem; /* 10px 12px */\nborder: 0.0625rem solid rgba(33,150,243,0.12); /* 1px */\nborder-radius: var(--radius-sm);\nfont-size: 1rem;\nbackground: #f6fdff;\nbox-sizing: border-box;\n}\n\n/* Style for the password toggle button */\n.toggle-password {\nposition: absolute;\nright: 0.5rem; /* Position it on the right */\npadding: 0.3rem 0.4rem;\nbackground: transparent;\nborder: none;\ncursor: pointer;\nfont-size: 1.1rem; /* Adjust icon size */\nline-height: 1;\ncolor: var(--muted);\nz-index: 10; /* Ensure button is above the input */\ntransition: color 0.15s ease;\nborder-radius: var(--radius-sm);\n}\n\n.toggle-password:hover {\ncolor: var(--accent);\nbackground-color: rgba(25,118,210,0.06);\n}\n\n/* ... rest of the existing styles ... */\n.hint {\nfont-size: 0.9rem;\ncolor: var(--muted);\n}\n\n.stmsg {\nmargin: 0.5rem 0;\ncolor: var(--danger);\nfont-weight: 600;\n}\n\n@media (max-width: 600px) {\n.container { margin: 0.75rem; padding: 0.875rem; }\n.title { font-size: 1.4rem; }\n.main-btn, .form-btn { font-size: 1rem; padding: 0.625rem 0.75rem; }\n.form-input { font-size: 0.95rem; padding: 0.5rem 0.625rem; }\n}\n\n/* Utility */\n.muted { color: var(--muted); font-size: 0.9rem; }\n\n/* Footer */\n.ftr {\nmargin-top: 1.125rem; /* 18px */\npadding-top: 0.75rem; /* 12px */\nborder-top: 0.0625rem solid rgba(10,30,40,0.04);\n}\n.ftr-line {\nfont-size: 0.85rem;\ncolor: var(--muted);\n}\n\n/* OTA / file upload styles */\n.fileinp {\nwidth: 100%;\npadding: 0.5rem 0.625rem; /* 8px 10px */\nborder: 0.0625rem dashed rgba(25,118,210,0.12); /* 1px */\nborder-radius: 0.375rem; /* 6px */\nbackground: #fbfeff;\nbox-sizing: border-box;\nfont-size: 0.95rem;\n}\n.filebtn {\ndisplay: inline-block;\npadding: 0.5rem 0.75rem; /* 8px 12px */\nborder-radius: 0.5rem; /* 8px */\nbackground: rgba(25,118,210,0.12);\ncolor: var(--accent);\nborder: 0.0625rem solid rgba(25,118,210,0.12);\ncursor: pointer;\nfont-weight: 700;\n}\n.fname { font-size: 0.95rem; color: var(--muted); margin-left:0.5rem; }\n\n/* File meta display under Select File */\n.meta-wrap {\ndisplay: flex;\nflex-direction: column;\ngap: 0.5rem; /* 8px */\nalign-items: stretch;\nmargin-top: 0.5rem;\n}\n.meta-item {\nwidth: 100%;\ndisplay: flex;\nflex-direction: column;\nalign-items: flex-start;\n}\n.meta-label {\nfont-size: 1.1rem;\ncolor: var(--muted);\nfont-weight: 700;\n}\n.meta-val {\nfont-size: 0.95rem;\ncolor: #12343b;\nfont-weight: 700;\n}\n.row-center { margin-top: 0.75rem; display:flex; gap:0.5rem; justify-content:center; align-items:center; }\n.row-center-sm { margin-top: 0.5rem; display:flex; gap:0.5rem; justify-content:center; align-items:center; }\n.vis-hidden { display:none; }\n.center-txt { text-align:center; }\n.progwrap {\nmargin-top: 0.75rem; /* 12px */\ndisplay: flex;\ngap: 0.5rem; /* 8px */\nalign-items: center;\njustify-content: center;\n}\n.prog {\nwidth: 60%;\nheight: 0.75rem; /* 12px */\nappearance: none;\n-webkit-appearance: none;\nborder-radius: 0.5rem; /* 8px */\noverflow: hidden;\nbackground: linear-gradient(90deg, rgba(25,118,210,0.06), rgba(56,224,252,0.03));\n}\n.prog::-webkit-progress-bar { background: rgba(10,30,40,0.03); }\n.prog::-webkit-progress-value { background: linear-gradient(90deg, var(--accent), var(--accent-2)); }\n.prog-txt { font-size: 0.9rem; color: var(--muted); min-width: 3rem; text-align: center; }\n\n/* Table styles for status pages */\n.sttbl {\nwidth: 100%;\nborder-collapse: collapse;\nmargin-top: 0.5rem; /* 8px */\nfont-size: 0.95rem;\n}\n.sttbl-sm {\nwidth: 100%;\nborder-collapse: collapse;\nmargin-top: 0.25rem; /* 4px */\nfont-size: 0.85rem;\n}\n\n.sttbl th,\n.sttbl td {\ntext-align: left;\npadding: 0.25rem 0.5rem; /* 10px 8px */\nborder-bottom: 1px solid rgba(10,30,40,0.04); /* 1px 0.0625rem */\n}\n.sttbl-sm th,\n.sttbl-sm td {\ntext-align: left;\npadding: 0.125rem 0.5rem; /* 6px 4px */\nborder-bottom: 1px solid rgba(10,30,40,0.04); /* 1px 0.0625rem */\n}\n\n.sttbl th,.sttbl-sm th {\ncolor: var(--header);\nfont-weight: 700;\n/* width: 30%; */\n}\n.stval,\n.sttbl td,.sttbl-sm td {\ncolor: #12343b;\nfont-weight: 600;\n}\n\n/*\n@media (max-width:440px) {\n.sttbl th, .sttbl-sm th { display: none; }\n.sttbl td, .sttbl-sm td { display: block; padding: 0.5rem 0; }\n.sttbl tr, .sttbl-sm tr { margin-bottom: 0.75rem; display: block; border-bottom: 0.0625rem solid rgba(10,30,40,0.06); }\n.sttbl td::before, .sttbl-sm td::before { content: attr(data-label) \": \"; font-weight: 700; color: var(--header); }\n}\n*/\n\n/* Column style for compact status view */\n.stcol {\ndisplay: flex;\nflex-direction: column;\ngap: 0.5rem; /* 8px */\nmargin-top: 0.375rem; /* 6px */\n}\n.stitem {\ndisplay: flex;\nflex-direction: row;\nalign-items: center;\ngap: 0.75rem; /* 12px */\npadding: 0.5rem 0.625rem; /* 8px 10px */\nborder-radius: 0.5rem; /* 8px */\nbackground: rgba(25,118,210,0.03);\n}\n.lbl {\nflex: 0 0 6.875rem; /* 110px */\nfont-size: 0.9rem;\ncolor: var(--muted);\nfont-weight: 700;\n}\n.stval { /* compact row value */\nflex: 1 1 auto;\nfont-size: 0.95rem;\ncolor: #12343b;\nfont-weight: 700;\n}\n.green-txt{\ncolor:rgb(34 197 94 / var(--tw-text-opacity))\n}\n.red-txt{\ncolor:rgb(239 68 68 / var(--tw-text-opacity))\n}\n.yellow-txt{\ncolor:rgb(234 179 8 / var(--tw-text-opacity))\n}\n\n.hidden { display: none; }\n\n@media (max-width:440px) {\n.stitem { flex-direction: row; padding: 8px; }\n.lbl { flex: 0 0 40%; }\n.stval { flex: 1 1 60%; }\n}\n\n/* ── Hardware status table — compact, always row layout ── */\n.sttbl-hw {\nwidth: 100%;\nmax-width: 340px;\nmargin: 0 auto 0 auto;\nborder-collapse: collapse;\nmargin-top: 0.5rem;\nfont-size: 0.8rem;\n}\n.sttbl-hw th,\n.sttbl-hw td {\ntext-align: left;\npadding: 0.25rem 0.3rem;\nborder-bottom: 0.0625rem solid rgba(10,30,40,0.04);\n}\n.sttbl-hw th { color: var(--header); font-weight: 700; }\n.sttbl-hw td { color: #12343b; font-weight: 600; }\n\n/* ── Restart modal ──────────────────────────────────────── */\n.modal-overlay {\nposition: fixed; inset: 0;\nbackground: rgba(0,0,0,0.55);\ndisplay: flex; align-items: center; justify-content: center;\nz-index: 9999;\n}\n.modal-box {\nbackground: var(--card-bg);\nborder-radius: var(--radius-lg);\nbox-shadow: 0 8px 32px rgba(0,0,0,0.28);\npadding: 2.5rem 2rem;\ntext-align: center;\nmin-width: 220px;\n}\n.spinner {\nwidth: 52px; height: 52px;\nborder: 5px solid rgba(25,118,210,0.15);\nborder-top-color: var(--accent);\nborder-radius: 50%;\nanimation: spin 0.8s linear infinite;\nmargin: 0 auto 1.25rem;\n}\n@keyframes spin { to { transform: rotate(360deg); } }\n.modal-msg  { color: var(--muted); margin-bottom: 0.75rem; font-size: 1.05rem; white-space: pre-line; }\n.modal-cnt  { font-size: 2.5rem; font-weight: 700; color: var(--accent); }\n.modal-btn-row { display:flex; gap:0.75rem; justify-content:center; margin-top:1.25rem; }\n.modal-btn { padding:0.6rem 1.5rem; border:none; border-radius:0.5rem; font-size:1rem; font-weight:600; cursor:pointer; transition:opacity 0.1s; }\n.modal-btn:active { opacity:0.8; }\n.modal-btn-yes { background:var(--accent); color:#fff; }\n.modal-btn-no  { background:transparent; color:var(--muted); border:0.125rem solid rgba(25,118,210,0.2); }\n\n";
+const char WM_PK_STYLE_CSS[] PROGMEM = ":root{--bg-1:#f4f7fb;--card-bg:#ffffff;--accent:#1976d2;--accent-2:#38e0fc;--muted:#718792;--header:#29b4d3;--danger:#d84315;--disabled:#dddddd;--radius-lg:0.75rem;--radius-sm:0.375rem;--tw-text-opacity:1}html,body{margin:0;padding:0;font-family:'Segoe UI',Roboto,Arial,sans-serif;background:var(--bg-1);color:#12232b;-webkit-font-smoothing:antialiased}.container{max-width:26.25rem;width:100%;margin:1.75rem auto;background:var(--card-bg);border-radius:var(--radius-lg);box-shadow:0 0.375rem 1.125rem rgba(10,30,40,0.06);padding:1.375rem;box-sizing:border-box;text-align:center;border:0.0625rem solid rgba(25,118,210,0.06)}h1{font-size:1.8rem;color:var(--accent);margin:0.375rem 0 1.25rem 0;font-weight:700}h2{font-size:1.1rem;color:var(--accent);margin:0.375rem 0 1.25rem 0;font-weight:700}.btncol,.formsec{max-width:340px;margin-left:auto;margin-right:auto}.btncol{display:flex;flex-direction:column;gap:0.875rem;align-items:stretch}.mainbtn,.formbtn{display:inline-block;text-decoration:none;text-align:center;background:linear-gradient(90deg,var(--accent) 0%,var(--accent-2) 100%);color:#ffffff;border:none;border-radius:0.625rem;padding:0.75rem 0.875rem;font-size:1.05rem;font-weight:600;cursor:pointer;transition:transform 0.08s ease,box-shadow 0.12s ease;box-shadow:0 0.375rem 0.875rem rgba(25,118,210,0.08)}.mainbtn:active,.formbtn:active{transform:translateY(0.0625rem)}.mainbtn:hover,.formbtn:hover{box-shadow:0 0.625rem 1.25rem rgba(25,118,210,0.12)}.mainbtn:disabled,.formbtn:disabled{background:var(--disabled);transition:unset}.secbtn{background:transparent;color:var(--accent);border:0.125rem solid rgba(25,118,210,0.12);box-shadow:none}.flbl{display:block;margin-bottom:0.375rem;margin-top:0.5rem;text-align:left;color:var(--accent);font-weight:600;font-size:0.95rem}.password-wrapper{position:relative;display:flex;align-items:center}.password-input{padding-right:3rem !important}.finp{width:100%;padding:0.625rem 0.75rem;border:0.0625rem solid rgba(33,150,243,0.12);border-radius:var(--radius-sm);font-size:1rem;background:#f6fdff;box-sizing:border-box}.toggle-password{position:absolute;right:0.5rem;padding:0.3rem 0.4rem;background:transparent;border:none;cursor:pointer;font-size:1.1rem;line-height:1;color:var(--muted);z-index:10;transition:color 0.15s ease;border-radius:var(--radius-sm)}.toggle-password:hover{color:var(--accent);background-color:rgba(25,118,210,0.06)}.hint{font-size:0.9rem;color:var(--muted)}.stmsg{margin:0.5rem 0;color:var(--danger);font-weight:600}@media (max-width:600px){.container{margin:0.75rem;padding:0.875rem}.title{font-size:1.4rem}.main-btn,.form-btn{font-size:1rem;padding:0.625rem 0.75rem}.form-input{font-size:0.95rem;padding:0.5rem 0.625rem}}.muted{color:var(--muted);font-size:0.9rem}.ftr{margin-top:1.125rem;padding-top:0.75rem;border-top:0.0625rem solid rgba(10,30,40,0.04)}.ftr-line{font-size:0.85rem;color:var(--muted)}.fileinp{width:100%;padding:0.5rem 0.625rem;border:0.0625rem dashed rgba(25,118,210,0.12);border-radius:0.375rem;background:#fbfeff;box-sizing:border-box;font-size:0.95rem}.filebtn{display:inline-block;padding:0.5rem 0.75rem;border-radius:0.5rem;background:rgba(25,118,210,0.12);color:var(--accent);border:0.0625rem solid rgba(25,118,210,0.12);cursor:pointer;font-weight:700}.fname{font-size:0.95rem;color:var(--muted);margin-left:0.5rem}.meta-wrap{display:flex;flex-direction:column;gap:0.5rem;align-items:stretch;margin-top:0.5rem}.meta-item{width:100%;display:flex;flex-direction:column;align-items:flex-start}.meta-label{font-size:1.1rem;color:var(--muted);font-weight:700}.meta-val{font-size:0.95rem;color:#12343b;font-weight:700}.row-center{margin-top:0.75rem;display:flex;gap:0.5rem;justify-content:center;align-items:center}.row-center-sm{margin-top:0.5rem;display:flex;gap:0.5rem;justify-content:center;align-items:center}.vis-hidden{display:none}.center-txt{text-align:center}.progwrap{margin-top:0.75rem;display:flex;gap:0.5rem;align-items:center;justify-content:center}.prog{width:60%;height:0.75rem;appearance:none;-webkit-appearance:none;border-radius:0.5rem;overflow:hidden;background:linear-gradient(90deg,rgba(25,118,210,0.06),rgba(56,224,252,0.03))}.prog::-webkit-progress-bar{background:rgba(10,30,40,0.03)}.prog::-webkit-progress-value{background:linear-gradient(90deg,var(--accent),var(--accent-2))}.prog-txt{font-size:0.9rem;color:var(--muted);min-width:3rem;text-align:center}.sttbl{width:100%;border-collapse:collapse;margin-top:0.5rem;font-size:0.95rem}.sttbl-sm{width:100%;border-collapse:collapse;margin-top:0.25rem;font-size:0.85rem}.sttbl th,.sttbl td{text-align:left;padding:0.25rem 0.5rem;border-bottom:1px solid rgba(10,30,40,0.04)}.sttbl-sm th,.sttbl-sm td{text-align:left;padding:0.125rem 0.5rem;border-bottom:1px solid rgba(10,30,40,0.04)}.sttbl th,.sttbl-sm th{color:var(--header);font-weight:700}.stval,.sttbl td,.sttbl-sm td{color:#12343b;font-weight:600}.stcol{display:flex;flex-direction:column;gap:0.5rem;margin-top:0.375rem}.stitem{display:flex;flex-direction:row;align-items:center;gap:0.75rem;padding:0.5rem 0.625rem;border-radius:0.5rem;background:rgba(25,118,210,0.03)}.lbl{flex:0 0 6.875rem;font-size:0.9rem;color:var(--muted);font-weight:700}.stval{flex:1 1 auto;font-size:0.95rem;color:#12343b;font-weight:700}.green-txt{color:rgb(34 197 94 / var(--tw-text-opacity))}.red-txt{color:rgb(239 68 68 / var(--tw-text-opacity))}.yellow-txt{color:rgb(234 179 8 / var(--tw-text-opacity))}.hidden{display:none}@media (max-width:440px){.stitem{flex-direction:row;padding:8px}.lbl{flex:0 0 40%}.stval{flex:1 1 60%}}.sttbl-hw{width:100%;max-width:340px;margin:0 auto 0 auto;border-collapse:collapse;margin-top:0.5rem;font-size:0.8rem}.sttbl-hw th,.sttbl-hw td{text-align:left;padding:0.25rem 0.3rem;border-bottom:0.0625rem solid rgba(10,30,40,0.04)}.sttbl-hw th{color:var(--header);font-weight:700}.sttbl-hw td{color:#12343b;font-weight:600}.modal-overlay{position:fixed;inset:0;background:rgba(0,0,0,0.55);display:flex;align-items:center;justify-content:center;z-index:9999}.modal-box{background:var(--card-bg);border-radius:var(--radius-lg);box-shadow:0 8px 32px rgba(0,0,0,0.28);padding:2.5rem 2rem;text-align:center;min-width:220px}.spinner{width:52px;height:52px;border:5px solid rgba(25,118,210,0.15);border-top-color:var(--accent);border-radius:50%;animation:spin 0.8s linear infinite;margin:0 auto 1.25rem}@keyframes spin{to{transform:rotate(360deg)}}.modal-msg{color:var(--muted);margin-bottom:0.75rem;font-size:1.05rem;white-space:pre-line}.modal-cnt{font-size:2.5rem;font-weight:700;color:var(--accent)}.modal-btn-row{display:flex;gap:0.75rem;justify-content:center;margin-top:1.25rem}.modal-btn{padding:0.6rem 1.5rem;border:none;border-radius:0.5rem;font-size:1rem;font-weight:600;cursor:pointer;transition:opacity 0.1s}.modal-btn:active{opacity:0.8}.modal-btn-yes{background:var(--accent);color:#fff}.modal-btn-no{background:transparent;color:var(--muted);border:0.125rem solid rgba(25,118,210,0.2)}\n";
+
+// Gzip-compressed copies of the files above, sent when the client accepts gzip.
+// *_LEN is 0 when the file can't be compressed at build time (e.g. it depends on application defines).
+const uint8_t WM_PK_UTILS_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xbd,0x56,0xdb,0x6e,0xdb,0x38,0x10,0x7d,0xcf,0x57,0x28,0x40,0x11,0x49,0x58,0x95,0xdb,0xdd,0xc7,0x18,0x4c,0x90,
+0x66,0x53,0xd8,0x40,0xb6,0x2d,0x36,0x7e,0x0b,0x02,0x84,0x16,0x47,0xb1,0x52,0x46,0xb4,0x49,0x2a,0xb6,0x21,0xeb,0xdf,0x77,0x86,0xba,0x58,0x8e,0xdd,0xec,0x4b,0xb1,
+0x41,0x60,0x8b,0xe4,0x5c,0xce,0x9c,0x39,0x1a,0x3a,0xd5,0x85,0x75,0xc1,0x13,0xcc,0x72,0x6e,0xf9,0x85,0xd4,0x69,0xf9,0x02,0x85,0x63,0x4f,0xe0,0x6e,0x14,0xd0,0xe3,
+0xe7,0xcd,0x44,0x46,0x36,0x1e,0xa5,0xde,0x70,0x69,0xf7,0xcc,0x96,0x25,0x98,0xcd,0x1d,0x28,0x48,0x9d,0x36,0x43,0x2b,0xf1,0x73,0xb3,0x2b,0xa5,0x76,0x96,0x2b,0xc5,
+0x33,0x7e,0xb1,0xca,0x0b,0xa9,0x57,0x4c,0x48,0x79,0xf3,0x8a,0xf6,0xb7,0xb9,0x75,0x50,0x80,0x89,0x42,0xa5,0x85,0x0c,0x93,0xac,0xb3,0x9e,0x8c,0x79,0xa4,0x92,0xd7,
+0x98,0x5f,0x54,0x84,0x38,0x52,0x31,0x73,0xb0,0x76,0xd7,0xba,0x40,0x7b,0xc7,0x5f,0xeb,0x51,0x56,0x16,0xa9,0xcb,0x75,0x11,0x3c,0xff,0xe9,0x22,0xe9,0x12,0xbd,0x70,
+0xbc,0xaa,0xe3,0x2a,0xcf,0xa2,0xd3,0x2b,0x63,0xc4,0x86,0xe5,0xd6,0x7f,0xe3,0x61,0xbc,0xdd,0x4a,0xc7,0x14,0x14,0x4f,0x6e,0xce,0x39,0xff,0xb4,0xdd,0xba,0xcd,0x02,
+0x74,0x16,0x48,0x77,0xff,0xe9,0xe1,0x94,0xf3,0x50,0xcf,0x9e,0x11,0x72,0x18,0x57,0x94,0x5e,0x2b,0x60,0x2b,0x61,0x8a,0x28,0x7c,0xb6,0xba,0x98,0xea,0xa9,0x98,0x29,
+0x08,0x0c,0x2c,0xcb,0xdc,0x80,0x0d,0x44,0x50,0xe8,0xe2,0x23,0xbc,0x2c,0xdc,0x26,0x10,0x94,0x21,0xc0,0x48,0x4d,0x00,0xcb,0xc2,0x78,0x64,0xc0,0x95,0xa6,0x08,0x8a,
+0x52,0xa9,0x51,0x7d,0xd2,0xd4,0xe3,0x66,0x8a,0xf7,0x24,0xa5,0x06,0x84,0x83,0x96,0xf5,0x28,0x74,0x14,0x1e,0xfd,0x10,0x39,0x16,0xc1,0xfc,0xf2,0x5a,0x09,0x6b,0xe3,
+0x0a,0xdd,0x58,0x4a,0x8f,0x44,0x14,0xb1,0xf6,0xd6,0xa2,0x4f,0x90,0x6a,0x35,0x96,0x96,0x7f,0xf3,0x30,0xd8,0x0f,0xd8,0xd8,0xc8,0x17,0xd7,0x11,0x9a,0xe5,0xc6,0x22,
+0x7d,0x6a,0x62,0xc7,0x20,0x24,0x18,0x4e,0x81,0x0e,0x36,0x39,0x77,0xa6,0x84,0x0e,0x89,0xd1,0x2b,0xda,0xbf,0xd5,0xa9,0x50,0x36,0x3e,0xa9,0xda,0x52,0x68,0x8f,0x7b,
+0x64,0xbe,0x8e,0x29,0xad,0xa3,0x2e,0xcf,0xfc,0x1f,0xbd,0xe2,0xde,0x84,0xe5,0x85,0x05,0xe3,0x70,0xed,0x0f,0x09,0x1e,0xcb,0xb4,0xb9,0x11,0xe9,0x3c,0x42,0x7c,0xd8,
+0xd9,0x36,0xde,0xfc,0xe7,0xcc,0xcc,0x91,0x16,0x05,0x18,0x55,0x9a,0xe9,0xda,0xf1,0x03,0x50,0xf7,0x18,0xe8,0x61,0xbb,0xc5,0xcf,0x91,0x9b,0xef,0x29,0xa4,0xf1,0x18,
+0x11,0x1c,0x26,0x16,0x0b,0x28,0xe4,0xf5,0x3c,0x57,0x32,0x72,0x73,0xe4,0x6c,0x47,0x9b,0xfb,0xac,0xe5,0x66,0x58,0x0c,0xad,0x11,0x2f,0xca,0xa5,0xc3,0x2a,0xa9,0xa2,
+0x0e,0xac,0xa1,0xea,0xc8,0x66,0xaf,0x3a,0x82,0x88,0x27,0x13,0x89,0x99,0x73,0xb7,0xe1,0x61,0xf8,0xb6,0x60,0xaa,0x38,0x41,0xed,0xc3,0x9a,0x24,0x4d,0xf6,0xaf,0x02,
+0x15,0x81,0xee,0xbe,0x04,0x1f,0x21,0x05,0xa5,0x7a,0x81,0x0b,0x85,0xb2,0x24,0x09,0x9d,0x9d,0x35,0xcf,0x25,0x3a,0x67,0x79,0x01,0xf2,0x12,0xd7,0xcc,0xe9,0x3b,0x67,
+0xf2,0xe2,0x29,0x8a,0xcf,0x31,0x59,0xe7,0x4d,0x8d,0xf3,0x49,0x48,0xe4,0xfe,0x55,0x20,0xc6,0x08,0xca,0xae,0x8d,0xd5,0x10,0xe8,0xc1,0xf1,0x80,0xd0,0x1a,0x94,0x85,
+0x3d,0xeb,0x01,0x40,0x22,0x10,0x57,0xef,0x77,0x8e,0x2c,0x98,0x05,0x77,0xe5,0x10,0xeb,0xac,0x74,0x10,0x85,0x36,0xd5,0x0b,0x08,0x93,0x10,0xc3,0x76,0x06,0xc3,0xae,
+0x0d,0xb2,0xb5,0xf9,0x7d,0x16,0xdc,0x6e,0xf9,0xbe,0xc6,0x65,0x74,0xc4,0x71,0x08,0xad,0xe9,0xd4,0x8b,0x9e,0xe5,0x0a,0x6e,0xc5,0x0c,0x14,0x3f,0x54,0xf3,0xd9,0xd9,
+0x71,0x2d,0xc5,0x97,0xc7,0xf7,0xcf,0x87,0xc8,0x8e,0xd4,0x25,0x85,0x13,0x1f,0x15,0x25,0x0b,0x93,0x41,0x66,0x12,0x9a,0x79,0xa3,0x40,0xf2,0x6e,0x34,0xd8,0x8f,0x0a,
+0xd4,0x1f,0x1a,0x0e,0x26,0x5a,0x16,0x51,0x40,0xdf,0xc1,0x6e,0x52,0xe1,0x7a,0x30,0xa8,0x70,0xa0,0xe1,0x06,0x6f,0x24,0xb2,0x9b,0x5a,0x60,0x0c,0x4e,0xe7,0x70,0x52,
+0x2c,0x4a,0xe7,0x5d,0x82,0x97,0x12,0xb9,0x98,0x41,0x3b,0xb4,0xc8,0xba,0x1d,0x55,0xbb,0x49,0x45,0xa9,0xd1,0xab,0xa1,0x0d,0x9a,0x0e,0x4e,0x64,0x90,0x17,0x41,0x0f,
+0xa2,0x1d,0x2b,0x0b,0xa3,0x9d,0x26,0x40,0x6c,0x2e,0xec,0xb7,0x55,0xf1,0xdd,0x60,0x37,0x8d,0xdb,0x30,0xe4,0x49,0x79,0xc8,0x49,0xef,0x1f,0xc7,0xed,0x2b,0x83,0x72,
+0x2d,0x61,0xaa,0xef,0xc0,0x71,0xb2,0xb8,0xef,0x2d,0x1e,0x46,0x7b,0x29,0xb9,0x1f,0xf4,0x3b,0x7f,0x12,0x73,0xbb,0x8a,0xab,0xf6,0x81,0xf9,0x60,0x7c,0x17,0xb2,0x55,
+0x49,0x8d,0x7f,0x27,0xc2,0x6e,0x8a,0x34,0xe8,0x59,0x2c,0xf1,0x5e,0x28,0x8d,0x4a,0x72,0xd9,0xdf,0x0d,0x5d,0xbe,0x26,0x55,0x8e,0x39,0x40,0xa1,0xb0,0xf0,0x02,0x1a,
+0x4f,0xff,0xbe,0xe5,0xe1,0x17,0x70,0xe9,0x1c,0xdf,0x2a,0x5f,0x38,0x63,0x2c,0x24,0x0c,0xa7,0x70,0x40,0xf0,0xe3,0x54,0x18,0xbc,0x37,0x3b,0xe4,0xc1,0x2a,0x77,0xf3,
+0x60,0xf2,0x57,0x10,0x7e,0xa8,0x72,0x59,0x87,0x48,0x35,0x0e,0x5c,0x8d,0x6f,0x2c,0x7b,0x1c,0x90,0xec,0xcc,0xa6,0x9b,0x22,0x60,0x17,0xf8,0x00,0x5c,0xac,0x44,0x8e,
+0x52,0xcd,0x28,0x2f,0x81,0xf5,0x45,0x9f,0x76,0xc7,0x4c,0xff,0xc0,0x2b,0x60,0x8e,0x02,0x0a,0x0a,0x58,0x05,0x37,0x4d,0xee,0xf1,0x74,0xfa,0x3d,0xf0,0x38,0x4e,0x03,
+0xeb,0x84,0x2b,0xed,0x79,0xf0,0xa1,0xea,0x7d,0x9a,0xad,0xfa,0x91,0xa4,0x27,0x91,0x82,0x26,0x45,0x7f,0x4c,0x37,0x5a,0x14,0xb7,0xa4,0xa0,0x4d,0x2a,0x28,0xb5,0x0f,
+0x77,0x20,0xa3,0x2f,0x02,0x75,0x2c,0x03,0xa7,0x03,0xba,0x9d,0x03,0x6d,0xf0,0x96,0x29,0x5e,0xb1,0xe1,0x9e,0x9f,0xf3,0x30,0x69,0xdc,0x88,0xc4,0xe1,0xbb,0xf8,0xe8,
+0x81,0x12,0x28,0x7f,0xce,0x5e,0xc0,0x5a,0xf1,0x04,0xf5,0xe3,0xa8,0x1e,0x88,0x9c,0xb0,0x79,0xc5,0xbc,0xdb,0x1f,0xa2,0x83,0xac,0x1a,0xbd,0x0f,0xae,0x70,0x92,0xc4,
+0xb0,0x75,0x5f,0x75,0xa3,0x77,0xf1,0x8a,0xa0,0xe9,0x7e,0xc4,0xe6,0xf5,0xcc,0xb7,0xb3,0x9e,0xb6,0xf9,0x73,0x97,0xd7,0xd7,0xbf,0x1f,0x24,0xa4,0xf5,0xde,0x6d,0x41,
+0x2e,0xc4,0xe4,0x1b,0x6d,0xd9,0x65,0x84,0xf2,0x90,0xeb,0xf8,0xdd,0x86,0x86,0xec,0x77,0xbb,0xbc,0x94,0x6b,0x1e,0xfe,0x26,0xd7,0xec,0x59,0xe7,0xf8,0x8b,0x22,0x09,
+0xe3,0x5f,0xdc,0xe4,0x06,0x81,0x1f,0x07,0x47,0x7b,0xdd,0x0d,0x19,0x84,0xd0,0xd3,0xf7,0xc7,0x65,0x75,0x2f,0xd7,0xf8,0xf3,0xe0,0xe1,0x9c,0x1c,0x6b,0xff,0x39,0x3a,
+0xf2,0x0a,0x65,0x5e,0x95,0xd5,0xff,0x2f,0xdd,0xff,0xac,0xaa,0x1f,0x92,0xbf,0x46,0xc3,0x87,0xf3,0x63,0x50,0x5a,0xd5,0x52,0x38,0x28,0xb6,0x3e,0x81,0xf5,0x42,0x1b,
+0xe7,0x7f,0x9e,0x26,0x4b,0x8b,0xff,0x22,0x59,0xa9,0x64,0x32,0x4e,0x50,0x61,0x09,0x0e,0x9f,0x04,0x15,0x8e,0xcf,0x19,0x3e,0x67,0x89,0x5d,0xd6,0xa3,0x93,0x7f,0x01,
+0x0c,0xc9,0x9f,0xf0,0x82,0x0b,0x00,0x00
+};
+const size_t WM_PK_UTILS_JS_GZ_LEN = 1192;
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_OTA_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xc5,0x5a,0x6b,0x7b,0x9b,0x46,0x16,0xfe,0xee,0x5f,0x21,0x3f,0xdb,0x0a,0x88,0x10,0xe6,0x2e,0x90,0x34,0x49,0x73,
+0xb7,0xdb,0x24,0xce,0xe6,0xd2,0xbd,0x38,0x6e,0x16,0xc1,0x48,0x22,0x46,0x40,0x01,0xd9,0x56,0x65,0xed,0x6f,0xdf,0x73,0x66,0x40,0x02,0x21,0xa7,0xee,0xa7,0x6d,0x9f,
+0x27,0x82,0x99,0x33,0x67,0xde,0x73,0x3f,0x33,0xd8,0x4f,0xe2,0xbc,0xe8,0xfc,0xb0,0x50,0x89,0x28,0x4a,0xe4,0xf1,0xda,0x67,0xef,0x33,0x3a,0x09,0x49,0x4e,0x1e,0x07,
+0x89,0xbf,0x5c,0xd0,0xb8,0x50,0x66,0xb4,0x78,0x19,0x51,0x7c,0x7c,0xb6,0x3a,0x0b,0xc4,0x5c,0x1a,0x71,0xc2,0xb3,0x53,0x22,0x46,0xf2,0x35,0xae,0xc4,0x35,0x62,0x24,
+0x29,0x05,0xbd,0x2d,0x9e,0x27,0x71,0x01,0xb4,0xe4,0x7a,0x33,0xca,0x68,0xb1,0xcc,0xe2,0xf5,0xd9,0xa9,0x8c,0x04,0x9b,0xd1,0x46,0x12,0xab,0xc5,0x3f,0x2c,0xb4,0x72,
+0xd7,0xe9,0x32,0xf6,0x8b,0x30,0x89,0x3b,0x4f,0x81,0xc3,0x9a,0x2f,0xe9,0x44,0xdd,0x6e,0xa4,0x7c,0xfd,0x4a,0xf3,0xb7,0x49,0xb0,0x8c,0x68,0xb7,0x7b,0x3e,0xf9,0x46,
+0xfd,0x42,0x49,0xb3,0xa4,0x48,0x8a,0x55,0x4a,0x95,0xb9,0x97,0x9f,0xdf,0xc4,0xef,0xb3,0x24,0xa5,0x59,0xb1,0x52,0x7c,0x2f,0x8a,0x00,0x8d,0x10,0xd0,0xa9,0xb7,0x8c,
+0x0a,0x41,0x7a,0x12,0x29,0xe5,0xf3,0x30,0xda,0x1c,0x5d,0x7b,0x59,0xe7,0x0d,0x59,0xd3,0xdb,0x34,0xc9,0x8a,0x7c,0xb8,0xde,0x6c,0xe4,0xdb,0xc6,0xeb,0x48,0xac,0x70,
+0x88,0xd2,0x1a,0xa9,0x23,0x22,0x3c,0x7d,0xf6,0xfc,0xc5,0xcb,0x57,0xaf,0x4f,0xcf,0x7e,0xfe,0xe5,0xcd,0xdb,0x77,0xe7,0xef,0xff,0xfe,0xe1,0xe3,0xa7,0xcf,0xbf,0xfe,
+0xe3,0x9f,0xff,0xfa,0xb7,0x37,0xf1,0x81,0xf9,0x6c,0x1e,0x7e,0xbb,0x8a,0x16,0x71,0x92,0xfe,0x9e,0xe5,0xc5,0xf2,0xfa,0xe6,0x76,0xf5,0x87,0xaa,0xe9,0x86,0x69,0xd9,
+0x03,0xc7,0xed,0x9d,0x08,0xf2,0x94,0xac,0x01,0x70,0x34,0xdc,0xf2,0xce,0xe5,0x60,0x2b,0x63,0x3e,0x1e,0x07,0x77,0xf9,0xe3,0xc7,0x8f,0x0d,0xbd,0x1f,0x6c,0x64,0x20,
+0xcc,0xee,0x25,0x44,0x12,0x46,0x0b,0x84,0x34,0x0e,0x42,0x2f,0xae,0x91,0x4a,0xeb,0x70,0x2a,0xe6,0x0a,0x53,0x6c,0xb6,0xf4,0x8b,0x24,0x23,0xe4,0xdd,0x72,0x31,0xa1,
+0x99,0x74,0x54,0xb2,0x98,0x2a,0x88,0x03,0xb8,0x3a,0x52,0x57,0xb3,0x07,0x9a,0xe6,0x1a,0xd6,0xdd,0x76,0x50,0x37,0xa5,0xae,0xa9,0x0f,0x1c,0xdd,0xb2,0x0c,0x5b,0x1d,
+0x4d,0x93,0x4c,0x44,0x15,0x04,0x44,0x1d,0x05,0xe3,0x5c,0x89,0x68,0x3c,0x2b,0xe6,0xa3,0xa0,0xd7,0x93,0xf2,0x8b,0xe0,0x92,0x4c,0x15,0x0e,0x41,0xc4,0x37,0x69,0x54,
+0xa1,0x04,0x11,0xbc,0x38,0x48,0x16,0xcf,0x56,0x05,0xcd,0x1b,0xf0,0x76,0x0c,0x2f,0x2e,0x47,0xf9,0x63,0x75,0x94,0xf7,0xfb,0xd2,0x51,0xa0,0xa4,0xcb,0x7c,0x2e,0xbe,
+0xf5,0x8a,0xb9,0x32,0x8d,0x12,0xa0,0x61,0x8f,0x9c,0x89,0x28,0x3d,0xd2,0x2d,0x5b,0xda,0x72,0x07,0xb9,0x27,0xc8,0xf7,0x53,0xf2,0x8f,0x24,0x0b,0xee,0x67,0x2f,0x7b,
+0x44,0x95,0x7d,0x00,0xee,0xed,0x80,0x7b,0xbd,0x9e,0xec,0xf7,0x88,0x03,0x5b,0x5e,0xf8,0xa0,0x43,0xeb,0xf2,0x8e,0xe4,0x17,0xde,0xe5,0x78,0xac,0x9b,0x7d,0xff,0x47,
+0x43,0xaf,0x6d,0x72,0x83,0xdc,0x3f,0x25,0xdf,0x97,0x01,0x37,0xa9,0x6d,0xf0,0x08,0x38,0x78,0x9c,0x3f,0x17,0x09,0x98,0xb3,0x6d,0xe0,0x1f,0xd8,0xc1,0x83,0x1d,0xba,
+0xa0,0xda,0x03,0xb2,0x9c,0xd2,0xdb,0x87,0x6e,0x82,0x52,0x6c,0x37,0xc0,0x1d,0x90,0xbb,0x09,0x21,0x97,0x7c,0x2c,0xb2,0x30,0x9e,0x89,0x1a,0x68,0x4b,0xae,0xcf,0x77,
+0x35,0x6b,0x6f,0x7a,0x0b,0x40,0xf9,0x96,0x84,0xb1,0x28,0x08,0xd2,0x46,0x9e,0xd3,0xdb,0xbf,0x28,0x2e,0xca,0xaa,0x6f,0xa1,0xa4,0x5e,0x96,0xd3,0xb3,0xb8,0x00,0x07,
+0xcc,0x97,0x13,0x70,0x40,0xd1,0x93,0x75,0x49,0xd6,0x0e,0xda,0xee,0x99,0x97,0x53,0xdb,0xfc,0x2b,0x1b,0x19,0xd2,0x51,0x45,0xe1,0x97,0x46,0xd3,0xec,0x3b,0x78,0xe8,
+0x69,0xf0,0xe8,0xb0,0x27,0xfd,0x52,0x0e,0x61,0x61,0x38,0x36,0x47,0x21,0x2a,0xc9,0x7b,0xe4,0xf4,0xc2,0x47,0xf6,0x98,0x6c,0x0d,0xe4,0x3c,0x29,0xd1,0x46,0x8a,0x3f,
+0xf7,0xb2,0xa7,0x85,0x88,0x7e,0x60,0x3f,0x12,0x8d,0x7e,0x28,0x75,0x6d,0x43,0x92,0x86,0x25,0x81,0x40,0x84,0x83,0x6a,0x9a,0x30,0xe4,0x87,0x34,0x95,0xc3,0x36,0x19,
+0x4d,0x23,0xcf,0xa7,0xe2,0xc9,0xc5,0x6f,0x4f,0xfb,0xff,0x56,0xfb,0x6e,0xef,0xcb,0xc9,0xe5,0x49,0x38,0x93,0x61,0xed,0xe8,0xcf,0xdc,0xd3,0x27,0xbd,0x9e,0xf7,0xa3,
+0x29,0x1d,0xf9,0xc7,0x44,0xed,0x76,0x2b,0x13,0x46,0x4a,0x18,0x07,0xf4,0xf6,0x9c,0x85,0x36,0x07,0xed,0xf5,0x35,0x49,0xea,0xb2,0x28,0x49,0x93,0x1b,0x51,0x97,0xfb,
+0xfa,0x23,0xbf,0xe7,0x48,0x30,0x3c,0x1e,0xfb,0x8f,0xf4,0xbb,0x43,0x6b,0x24,0x09,0x45,0xed,0xc3,0x74,0xcd,0x20,0x9b,0xd1,0xad,0x52,0x66,0x3f,0x32,0x65,0x69,0x19,
+0x11,0x9e,0x92,0xed,0xa8,0xfc,0x8a,0xac,0x97,0xc5,0xd4,0x19,0xae,0x73,0xe6,0x3f,0x2d,0xc9,0x77,0xb9,0xfa,0x95,0x32,0x09,0x63,0xa5,0x41,0x26,0x2e,0x63,0x9a,0xfb,
+0x5e,0x4a,0x45,0x1a,0xfb,0x49,0x40,0x3f,0x7f,0x38,0x7b,0x9e,0x2c,0xd2,0x24,0x86,0xc2,0x00,0x2b,0x25,0x69,0xeb,0x11,0xdc,0x3b,0x0f,0xb1,0x0d,0x68,0x6b,0x65,0xc9,
+0x93,0x6f,0xd8,0x60,0xc0,0x99,0x02,0xd7,0x30,0xfe,0x1e,0xe2,0xca,0x14,0x53,0x34,0x45,0x0e,0x66,0xc8,0xc7,0x51,0x65,0x86,0x1c,0x5d,0x67,0x5a,0x77,0x93,0xe7,0xb0,
+0x3f,0x68,0x30,0x97,0x1a,0xd1,0x3b,0xfd,0x1e,0xf6,0x87,0x6e,0xc0,0x97,0x2a,0xd3,0x2c,0x59,0x3c,0x2f,0x77,0x12,0xa3,0x8b,0xfc,0x72,0x17,0x34,0xd3,0x9d,0xf3,0x81,
+0x5c,0x67,0xe4,0x15,0xb3,0xd0,0x39,0x39,0xa0,0xa9,0xe8,0x98,0xc4,0xcb,0x08,0x4a,0xa6,0xf8,0x16,0x46,0xef,0xee,0xde,0xb3,0x7f,0x8f,0x8f,0xa1,0x82,0x86,0xf9,0xb3,
+0xe5,0x74,0x0a,0x85,0x60,0x33,0xda,0xd6,0xd9,0xb7,0xbb,0xa5,0x48,0x53,0x2b,0x1b,0xdd,0x2e,0x96,0xd6,0x64,0xda,0x69,0x8c,0x2a,0x15,0x13,0x42,0x84,0x8a,0x89,0x80,
+0xf5,0xf9,0x10,0x0d,0xf0,0xde,0x1c,0x6d,0xb7,0x7a,0x5f,0x43,0xb9,0x65,0x9d,0x51,0x2f,0x78,0x15,0x25,0x5e,0xf1,0xe6,0x65,0x93,0xe3,0x96,0x22,0x8f,0x42,0x9f,0x36,
+0xe7,0x00,0x34,0x1f,0x16,0x55,0x59,0x05,0x53,0x1f,0xb5,0xeb,0xf5,0x29,0x94,0xdb,0x33,0x05,0x9d,0x16,0x34,0x7f,0x2e,0x07,0xf0,0x02,0xee,0x00,0x11,0xb7,0xa5,0xf4,
+0xe5,0x50,0x5a,0xfb,0xcd,0x42,0xc9,0x2d,0xf1,0x24,0xec,0x76,0x43,0x85,0x39,0x2b,0xbc,0x11,0xd8,0x1b,0x96,0x7a,0xd9,0x4a,0x78,0xe2,0x93,0x60,0xcf,0xb7,0x7d,0x69,
+0xe8,0x43,0x0d,0x6c,0x0d,0xe2,0x3f,0x40,0xfe,0x34,0xcb,0xbc,0x55,0xad,0x51,0x61,0xa8,0x79,0x7f,0xe2,0x03,0xf4,0xe1,0x31,0x27,0x08,0x73,0xf6,0x0b,0x6b,0xba,0xdd,
+0x06,0xa4,0x63,0x42,0x3e,0x87,0x71,0xe1,0xb0,0x69,0xb0,0xa9,0x4f,0xfc,0x5d,0x16,0x97,0x76,0xe9,0x24,0x23,0x91,0x52,0x2f,0x89,0xc0,0x49,0x4e,0x81,0xb6,0x4a,0x79,
+0x72,0x4c,0xb4,0x81,0xa1,0x5b,0x8e,0x09,0xc5,0x5e,0xa6,0xa4,0xaf,0x0f,0xe0,0xdd,0x70,0x06,0xae,0x9c,0x90,0xfe,0x76,0xca,0x94,0x0b,0x52,0xcd,0x38,0xf2,0x12,0x5c,
+0x76,0x39,0xce,0x2a,0x97,0x5d,0xa2,0xcb,0x66,0x17,0xcb,0x4b,0x22,0xe2,0xbf,0x98,0x70,0xf1,0x97,0xd5,0xb5,0x5a,0x23,0x51,0x4e,0xea,0x66,0x35,0xeb,0x34,0xfa,0x89,
+0xec,0x22,0x2d,0xab,0xae,0xa6,0x3b,0xe3,0x71,0x0a,0xf5,0x50,0xce,0x2e,0xc4,0xb4,0x67,0x9b,0x30,0xee,0x8e,0xc7,0xa6,0xd4,0xd3,0xcc,0x4b,0x92,0x6e,0x65,0x5b,0x10,
+0x4f,0xf9,0x3a,0x9d,0xca,0x33,0xfc,0x9d,0xcd,0xe4,0x39,0xfe,0xce,0xe7,0xf2,0x0a,0x7f,0xc3,0xb0,0x0d,0x93,0x40,0xbd,0x61,0x6e,0xf0,0x9c,0xc4,0xf2,0x47,0x42,0xe5,
+0x2b,0x92,0xc8,0x5f,0x49,0x31,0x8a,0xc9,0x42,0x8c,0x65,0x2a,0x27,0x72,0x01,0x7b,0x2e,0x7b,0xea,0xa5,0x3c,0x90,0xfb,0xb6,0xa3,0x3a,0x03,0xdb,0x35,0x6c,0x09,0xa4,
+0x5f,0x88,0x85,0xcc,0x49,0x90,0x40,0xbb,0x94,0x35,0x48,0xac,0x86,0xe3,0x5a,0xb6,0x69,0x39,0x40,0x91,0x00,0x05,0x2e,0x47,0x1a,0xa4,0x80,0x72,0xa3,0x0d,0x64,0x5b,
+0xb5,0x35,0xd5,0x72,0x34,0x57,0x02,0xdd,0x2e,0x44,0xbe,0x43,0xcc,0x08,0x8c,0x4b,0x59,0x07,0x16,0x9a,0x6a,0x9a,0x96,0x6e,0x19,0x86,0x2a,0xc9,0xfb,0x30,0x4c,0x06,
+0x43,0x1b,0xd8,0xa6,0xe6,0x38,0xee,0xa0,0x0d,0xc3,0x62,0x30,0x34,0x5d,0x55,0x55,0x47,0x35,0xf5,0x03,0x30,0x6c,0x06,0xa3,0xaf,0x99,0x60,0x49,0x43,0x33,0x4c,0xad,
+0x0d,0x64,0xc0,0x81,0x98,0xd6,0x40,0xb5,0x5c,0xc7,0x68,0xc3,0x70,0x10,0x86,0x36,0x18,0xa8,0xaa,0x61,0x99,0xda,0x01,0x6d,0xb8,0x5c,0x1b,0x9a,0x8b,0xbe,0x62,0x9a,
+0xda,0xa0,0x8d,0x43,0x53,0x39,0x10,0x53,0x57,0xa1,0x90,0xb6,0x30,0x68,0x5a,0xa9,0x0d,0xd7,0x55,0x4d,0x15,0x36,0xd1,0xdb,0x30,0x34,0x9d,0xe1,0x00,0x41,0x6d,0xd5,
+0xb0,0x1d,0xfd,0x80,0x55,0x0c,0x0e,0xc4,0x54,0x41,0x50,0x4d,0xd5,0x0e,0xc0,0x30,0x4b,0x7d,0x58,0x2a,0x28,0x4d,0xd7,0x5d,0xf5,0x00,0x16,0x8b,0x61,0x81,0x16,0xdd,
+0xb6,0x0c,0xcb,0xd0,0x5d,0x84,0x32,0x6b,0x42,0xb9,0x94,0x2d,0x60,0x62,0x5b,0x03,0xd7,0xb6,0x34,0x15,0x91,0xcc,0x1a,0x48,0x40,0xed,0x2e,0xda,0xd6,0x76,0x2d,0x55,
+0xb3,0x0d,0x1d,0x91,0xcc,0x9a,0x48,0xd0,0x85,0x4c,0xd9,0x36,0x0d,0x08,0xab,0x81,0xc6,0x74,0x32,0x6b,0xe0,0x00,0x8d,0xe9,0x2a,0xf8,0xd8,0x00,0xbc,0x6c,0x60,0xa8,
+0x7a,0x1b,0x86,0xc5,0x60,0x0c,0x54,0xcd,0x02,0x17,0x74,0xb5,0x36,0x0c,0xd4,0xba,0x2b,0x1b,0x0e,0x60,0x50,0xd1,0xb2,0x2d,0x10,0x16,0x03,0xd1,0xb7,0x6d,0xd5,0x1c,
+0x38,0x86,0x61,0xb5,0x51,0x98,0x1c,0x85,0xa9,0x42,0x94,0x0e,0x1c,0xd3,0x69,0xa3,0x70,0x11,0x85,0x65,0x3b,0xa6,0x09,0xc2,0x38,0x07,0x40,0x98,0xa5,0x32,0x34,0xd7,
+0x01,0xc3,0xa1,0xca,0xf7,0x71,0x18,0x1c,0x86,0xe6,0x0c,0x0c,0xdb,0x70,0x6d,0xad,0x0d,0xc3,0x61,0x30,0x34,0xd0,0xa5,0x65,0x80,0xf1,0xb4,0x03,0x36,0x31,0xb8,0x51,
+0x4c,0xc0,0xe1,0x68,0xa6,0x3d,0x68,0x23,0xd1,0x19,0x10,0x4b,0x03,0xff,0x00,0x51,0xda,0x30,0x06,0x0c,0x06,0x64,0x39,0xb0,0xba,0x03,0x11,0xd3,0x86,0x81,0x3e,0x88,
+0xea,0xd0,0x5c,0x1d,0x74,0x36,0x18,0x18,0x26,0x02,0x99,0xef,0x5b,0xc5,0x44,0xb3,0x39,0x60,0x15,0xc4,0x30,0x6f,0x60,0x00,0x41,0x34,0x0d,0x5a,0x32,0x70,0x3e,0x6b,
+0x00,0x50,0x99,0x55,0xe6,0x6d,0xd7,0xb0,0xc1,0xd3,0x0d,0x57,0x35,0x54,0x0b,0x63,0x81,0x02,0x49,0x03,0x07,0x9a,0xc5,0x80,0x5d,0x2c,0x43,0x75,0x2d,0x38,0x02,0xb5,
+0x50,0x68,0x0c,0x85,0x86,0xf3,0x2e,0xc4,0x9c,0xda,0x46,0x62,0x32,0x24,0x9a,0x3e,0xd0,0x1d,0x17,0x4c,0x7f,0x00,0xc8,0x80,0xe1,0x00,0x26,0x96,0xe9,0x0e,0x98,0x17,
+0xb7,0x70,0xa8,0x1c,0x87,0xa6,0xba,0xa0,0x2f,0xd5,0x36,0xd5,0x03,0x48,0x0c,0x84,0x02,0x36,0xd1,0x07,0xae,0x36,0x30,0xdb,0x40,0x54,0xae,0x12,0xc3,0x72,0xc0,0xc5,
+0x74,0x5d,0x6f,0x03,0x31,0x38,0x10,0x98,0xb4,0x74,0xcd,0x1d,0xb8,0x6d,0x20,0x36,0xc3,0x31,0xb0,0x55,0xdd,0xd5,0x1c,0xb7,0x0d,0xc2,0x65,0xea,0x00,0x7c,0x86,0x6d,
+0x9a,0xce,0xa0,0x0d,0x02,0x2d,0x8b,0x28,0x4c,0x5d,0x73,0x34,0xcb,0xc1,0x50,0x68,0xd9,0xc5,0x62,0x30,0x40,0xa5,0x03,0x13,0x80,0xa8,0x6d,0x14,0x3a,0xd7,0x86,0xeb,
+0x42,0x3e,0x77,0x20,0x33,0x20,0x8e,0xd5,0x7e,0x65,0x41,0x8d,0xba,0x8e,0x6d,0xa8,0x10,0x31,0x88,0x63,0xd5,0xc0,0x81,0x3a,0x47,0x47,0xd7,0x6d,0xc7,0xd5,0x4c,0x8d,
+0xc1,0x58,0xb5,0x73,0x18,0xf3,0x74,0x8c,0x06,0xd3,0x55,0x59,0xd4,0xae,0x1a,0x40,0x30,0x85,0x81,0x30,0xe0,0x61,0x06,0x46,0x6e,0x1b,0x07,0x8a,0x0b,0x2e,0x06,0x39,
+0xdd,0x04,0x3f,0x1d,0x68,0x6d,0x20,0x06,0x03,0x02,0x31,0xe9,0x9a,0x80,0x16,0x0a,0xd9,0x01,0x24,0x6a,0x89,0x44,0xb5,0x34,0x4b,0x37,0xda,0x30,0x34,0x0e,0x43,0x57,
+0x01,0xa6,0x0e,0xe6,0x77,0xdb,0x40,0x1c,0x86,0x03,0x02,0x1f,0xaa,0x93,0x61,0xb9,0x6d,0x1c,0x4c,0xeb,0x98,0x07,0xa1,0x94,0x82,0xfb,0x98,0x6d,0x18,0x76,0x89,0xc2,
+0xb2,0x31,0xc5,0x40,0xb6,0x3b,0x00,0xc4,0x60,0x48,0x34,0x88,0x06,0xcd,0xd2,0x6c,0xf3,0x00,0x10,0x93,0x5b,0xc6,0xb4,0x40,0x12,0x75,0xa0,0x1e,0x00,0xa2,0x95,0x1a,
+0x81,0x7a,0xab,0x6b,0x90,0x42,0xdc,0x36,0x14,0x9d,0x41,0x19,0x80,0x3c,0xce,0x40,0xb7,0xdc,0x36,0x10,0x97,0x6b,0xc4,0x00,0xbb,0x80,0xde,0xb9,0x87,0xc4,0xbd,0xe7,
+0xd0,0xe1,0xa8,0x40,0x4b,0x7b,0x1f,0xd9,0x53,0x42,0x92,0xde,0x15,0x7b,0x2a,0x48,0xd1,0xfb,0x8a,0x4f,0x9b,0xea,0x92,0x26,0xaa,0xee,0x55,0x2e,0x4a,0xf4,0x97,0xd0,
+0xb6,0xb3,0x46,0xa8,0xd1,0xc2,0xca,0x99,0x9c,0x72,0xf0,0xbc,0xe5,0x29,0x88,0xdf,0x13,0xc3,0x6e,0x76,0xf7,0xdf,0xb0,0x9b,0x4a,0x3d,0x31,0x46,0xa6,0x52,0x2f,0x29,
+0x4f,0x12,0x62,0x31,0x1e,0xd3,0xbb,0x82,0xdf,0x33,0x51,0xa9,0x17,0x6e,0x64,0xd6,0x54,0x3d,0x84,0x67,0x7a,0x97,0x75,0xff,0xfb,0x60,0x9e,0xf3,0xf9,0x03,0x78,0xfe,
+0x96,0xfd,0xf6,0x60,0x86,0x61,0xf8,0xe7,0x0c,0xb3,0xdf,0xc4,0xf0,0x0e,0x30,0x3e,0x94,0xe7,0x24,0x4a,0xfc,0xab,0x3c,0xfc,0x83,0x42,0xcb,0x88,0xef,0x41,0x38,0xa3,
+0x79,0x51,0x0d,0xbc,0xd9,0x9d,0x8a,0x1b,0x87,0x86,0x70,0x0a,0x7d,0x38,0x3b,0x65,0x49,0x47,0xc5,0x3c,0x4b,0x6e,0x3a,0x31,0xbd,0xe9,0xbc,0xcc,0x32,0x68,0x58,0x85,
+0xb3,0x28,0xa2,0x33,0x2f,0xea,0x78,0xd9,0x8c,0xdd,0x98,0x76,0x84,0x9e,0xcf,0x0f,0xd4,0xd8,0xa3,0xd7,0x6f,0x94,0x44,0x8f,0xb1,0xdb,0x1e,0xf2,0xd8,0xa9,0xc3,0xcb,
+0xd9,0xdc,0x93,0x6c,0x58,0xbe,0x96,0x47,0x92,0x60,0xef,0x88,0x9b,0x49,0xc3,0x6d,0xc7,0x7f,0x4a,0x6f,0xe1,0x7d,0xb3,0x3d,0xb9,0x7f,0x26,0x5b,0xe4,0xe5,0x05,0xeb,
+0x07,0xf2,0x54,0xfc,0x5c,0x6d,0xb4,0xfe,0xb0,0x77,0xf9,0xaa,0x97,0x97,0xaf,0xb8,0xf6,0xeb,0x22,0x09,0xbc,0xe8,0x79,0x9e,0x13,0x41,0x61,0x8f,0xfd,0xe4,0x9a,0x66,
+0x91,0xb7,0x5a,0xa7,0x49,0x1e,0xa2,0x0e,0x86,0xd3,0xf0,0x96,0x06,0xa3,0x30,0xce,0x69,0x31,0x54,0x47,0x13,0xcf,0xbf,0x9a,0x65,0xc9,0x32,0x0e,0x86,0xd9,0x6c,0xe2,
+0xe1,0x89,0x0c,0xff,0x57,0xf0,0x90,0x1c,0x84,0x79,0x0a,0x4b,0x87,0xd3,0x88,0xde,0x8e,0xbc,0x28,0x9c,0xc5,0xfd,0xb0,0xa0,0x8b,0x7c,0xe8,0x83,0x62,0x68,0x36,0xfa,
+0xb6,0xcc,0x8b,0x70,0xba,0xea,0xfb,0xfc,0x96,0xb8,0x1a,0xfe,0xa3,0xcf,0x2e,0x2e,0x86,0x2e,0xfc,0xb7,0x11,0x7a,0x47,0x15,0x92,0x49,0x72,0xbb,0xae,0x6d,0xf7,0xb7,
+0xe9,0x74,0x3a,0x9a,0x80,0x42,0x69,0xd6,0xcf,0xbc,0x20,0x5c,0xe6,0x43,0x65,0x60,0x65,0x74,0x01,0x83,0xb7,0xfd,0x7c,0xee,0x05,0xc9,0xcd,0x50,0xed,0x38,0xe9,0x6d,
+0xc7,0xd0,0xe1,0x9f,0x1a,0x3c,0x45,0x77,0xa4,0x51,0xea,0x05,0x78,0xbe,0x1b,0xea,0x0a,0x2e,0xea,0xe8,0xb8,0x12,0xef,0xac,0xfb,0x0c,0x69,0x05,0x66,0x11,0xc6,0xfd,
+0x9b,0x30,0x28,0xe6,0x43,0x5d,0x57,0xd3,0x5b,0x8e,0x27,0x4f,0xc3,0x38,0xa6,0xd9,0x9a,0x4f,0x58,0xc0,0x7d,0x34,0xa7,0xe1,0x6c,0x5e,0xf0,0x67,0x0e,0x6a,0x68,0xc1,
+0xa6,0x79,0x12,0x85,0x01,0xdf,0x5a,0xb7,0x20,0xdf,0x3b,0x90,0x17,0x60,0x7f,0x48,0xf8,0x15,0xf4,0x22,0x49,0x41,0x01,0x51,0x92,0x0d,0xff,0x06,0x35,0xcf,0x0e,0xf4,
+0x3d,0x99,0x2c,0xf5,0xc7,0x91,0x17,0x87,0x0b,0x8f,0x29,0x1f,0x77,0xee,0x28,0x4e,0xde,0x89,0xc2,0x98,0x82,0xbd,0xc2,0x78,0x1a,0xc6,0xa0,0xd4,0xd1,0x02,0x1c,0x2e,
+0x8c,0x41,0x5e,0x6f,0x59,0x24,0x1d,0x4d,0xd1,0x51,0x28,0x86,0xf6,0xa7,0x2b,0xba,0x9a,0x66,0xde,0x82,0xe6,0x1d,0x5c,0xbd,0x2e,0x92,0x75,0x91,0x79,0x71,0x0e,0xe7,
+0xab,0xc5,0x10,0x4e,0xa6,0x5e,0x41,0x45,0x38,0x99,0x05,0x74,0x06,0x3e,0x54,0x53,0xf7,0x22,0x9f,0xad,0x4b,0x60,0x98,0xe9,0x5c,0xbd,0xdc,0x03,0xec,0x50,0x14,0xc9,
+0xa2,0x52,0xf6,0x14,0x8c,0xd7,0xc7,0x90,0x19,0x6a,0x8a,0xca,0x46,0x6e,0xe6,0x00,0xa8,0x9f,0xa7,0x9e,0x4f,0x87,0x69,0x46,0xfb,0x08,0xb5,0xce,0xd8,0x8f,0x8b,0xf5,
+0x6e,0x15,0x57,0x3f,0x67,0x73,0xc3,0x95,0x08,0xe5,0x6a,0xd4,0x50,0x49,0xc3,0x0b,0x8a,0xb8,0x0f,0x31,0xb7,0x6e,0x38,0xd7,0xcc,0x4b,0x2b,0x3c,0xf7,0x38,0x55,0x89,
+0x1d,0xb4,0x3d,0xac,0x2b,0x67,0xc7,0x74,0x5d,0xf9,0x83,0x62,0xa3,0x3b,0x68,0x4a,0xe9,0x4a,0xcc,0x94,0x71,0x12,0xd3,0x7d,0x5f,0xdb,0x97,0x7e,0x5f,0x0a,0x1b,0xa5,
+0x58,0x66,0x39,0x88,0x91,0x26,0x21,0x82,0xd8,0x17,0x63,0x45,0xf3,0x86,0x43,0x97,0xf6,0x2f,0x45,0x07,0xf7,0xde,0x5f,0x10,0x27,0x75,0x7a,0x66,0xc5,0xd4,0xcb,0x40,
+0xc0,0x51,0xd3,0x50,0x25,0x6a,0x45,0x63,0x82,0xde,0xe7,0x84,0xba,0xb4,0x11,0x76,0x37,0x41,0x34,0xce,0x97,0x19,0x7d,0x5b,0x86,0xbf,0xc8,0xd2,0xdc,0xf1,0x7d,0xdf,
+0x7d,0x84,0xac,0x22,0x14,0x24,0x9e,0x7f,0x73,0xb2,0xa5,0xf5,0x33,0x0a,0x3e,0x55,0x92,0x8b,0x42,0x5e,0xac,0x22,0x2a,0x48,0xa3,0x5c,0x09,0x03,0x52,0x5b,0x08,0x03,
+0xf5,0x4f,0x44,0xdb,0xcc,0x33,0xda,0x32,0x9a,0x53,0x2f,0x50,0xbc,0x34,0x85,0x4a,0xf8,0x7c,0x1e,0x46,0xec,0x73,0xd3,0xa6,0x76,0xa3,0x94,0xcf,0x93,0x9b,0x0f,0x90,
+0xb0,0xbd,0xac,0x60,0x5c,0xc5,0x9c,0x82,0xd5,0x83,0x5c,0x06,0x5f,0xcf,0xbd,0x19,0x95,0xd6,0xfb,0x42,0xb1,0xfc,0x08,0x8e,0x4d,0xc4,0x92,0xe4,0x98,0x10,0x50,0x25,
+0x85,0x20,0xa2,0x81,0xf4,0xa4,0x1c,0x1c,0x0a,0x25,0x57,0x08,0xaf,0x4e,0x9a,0x25,0xb3,0x0c,0xc6,0x15,0x45,0x11,0xd8,0xf2,0x20,0xbc,0xbe,0x57,0x56,0x98,0x13,0x30,
+0xef,0x5d,0x2b,0x7e,0xe4,0xe5,0xf9,0x3b,0x88,0x3a,0x22,0x34,0xf2,0xa8,0xc0,0x66,0x59,0xfa,0x38,0xfd,0xf4,0xf6,0x0d,0x11,0xc6,0xf0,0xde,0x61,0xd4,0xe4,0x8b,0xb0,
+0x4d,0x74,0x5f,0x84,0xc7,0x68,0xfb,0xc6,0x64,0x99,0x75,0x60,0x6a,0x7c,0x02,0xe3,0x9c,0x20,0xdd,0x5b,0x0b,0xc2,0xb1,0xb5,0xf0,0xdb,0x13,0xc6,0x27,0x69,0x9b,0xcd,
+0x36,0x08,0xbf,0x08,0x1d,0xb0,0xc8,0x17,0x21,0x7b,0x8e,0xcf,0x40,0x58,0xaa,0x0f,0xd7,0x6d,0xf9,0xf3,0xa7,0x9d,0x4d,0x26,0x49,0xb0,0x6a,0xd8,0x04,0xe6,0xb9,0x5a,
+0x63,0x52,0xae,0x1f,0xf1,0x7a,0x0c,0xf5,0xe1,0x0c,0xbd,0xfe,0x1a,0x0c,0x53,0xbb,0x9f,0x8b,0xfb,0x7d,0x46,0x40,0x23,0x72,0xbf,0x77,0x01,0x22,0xd0,0x23,0x78,0x20,
+0x8d,0x24,0x1a,0x35,0xfc,0x24,0xc6,0xe1,0x78,0x4c,0x54,0x69,0xed,0x47,0x90,0x02,0xb7,0x7b,0x14,0xd2,0x08,0xca,0x39,0x4b,0x93,0xca,0x3c,0xa3,0x53,0x22,0x9c,0x08,
+0xe0,0x2e,0xd0,0xcc,0xa9,0x2a,0xf8,0x4d,0xd9,0x58,0xad,0xf7,0x9d,0xa6,0x2c,0x86,0xb5,0xaf,0x9e,0xec,0x0b,0xa6,0x7c,0x76,0xba,0x21,0x3f,0x2c,0x54,0x5e,0x25,0xa1,
+0x66,0xc2,0x8b,0x56,0xbe,0xb4,0x58,0xc0,0x9c,0x5e,0x96,0xd3,0x6b,0x12,0xd5,0xbe,0x81,0x32,0x9d,0xbf,0x09,0xf3,0x42,0x81,0x38,0x04,0x0f,0x10,0x85,0x79,0x18,0x04,
+0x34,0x06,0xe1,0x36,0xe5,0x82,0xd3,0x7b,0x16,0x40,0x36,0x3a,0x40,0x7d,0xb3,0xa3,0x16,0xd0,0x33,0xcf,0xe2,0x69,0x22,0x34,0xbf,0xb5,0x46,0x5b,0xe2,0x97,0x35,0x62,
+0x9a,0x65,0x07,0xe8,0xb6,0xa1,0x34,0x0d,0x03,0x71,0xb2,0x9c,0xca,0x85,0x37,0x93,0xca,0x6f,0xbf,0x13,0x82,0x6d,0xcd,0xee,0xfa,0x11,0xe7,0xab,0xa6,0xa1,0xe0,0x93,
+0x9f,0x80,0xdd,0x4b,0x76,0xa9,0x9f,0x89,0x12,0xbf,0x31,0xa5,0x22,0xb2,0x60,0x97,0x77,0x11,0x85,0x00,0x62,0xdf,0x62,0xc8,0xa4,0xbc,0x9d,0xeb,0x17,0xd5,0x13,0xfb,
+0x3a,0xb3,0x46,0x92,0x29,0x26,0x33,0x52,0x64,0x4b,0xba,0x5d,0xf5,0x0d,0x56,0x7d,0x1b,0xef,0x68,0xbf,0x21,0x2d,0x98,0x7d,0x72,0x11,0xf6,0xbe,0x5d,0x42,0xcc,0x16,
+0x93,0x8b,0x6f,0x97,0x78,0xc3,0x8e,0x4b,0xa7,0x5e,0x94,0x43,0x76,0x86,0x48,0xbc,0xc2,0xf4,0x00,0x74,0x6c,0x9c,0x73,0x0f,0x27,0xf8,0x9d,0x11,0x9f,0xae,0x48,0xd8,
+0xdb,0xb1,0x84,0x22,0x15,0x51,0xf1,0x6a,0x5c,0x0d,0x74,0xbb,0x93,0x8b,0x2b,0x64,0x0d,0x7e,0x15,0x4e,0xf8,0xc5,0x3c,0x8e,0x48,0xa3,0xab,0x5e,0x6f,0xeb,0x3d,0x9d,
+0x4a,0xea,0x17,0xb4,0x92,0x9a,0x7f,0x9a,0x10,0xf7,0x74,0x15,0x4e,0x24,0x96,0xab,0xaa,0x65,0xd0,0x2c,0x02,0x13,0xae,0xbc,0x17,0x1a,0xf1,0xf2,0x55,0xec,0x8b,0x53,
+0x70,0x39,0x5c,0xf7,0x3e,0x4b,0x16,0x61,0x4e,0x45,0x11,0xf2,0x4c,0x12,0x5d,0xc3,0x19,0x83,0xe2,0x07,0x6e,0x74,0x48,0x04,0x8e,0x77,0xe4,0x34,0x63,0x0a,0x7f,0x05,
+0xa0,0x3f,0xb0,0x57,0x11,0xdb,0x39,0x7c,0x50,0x92,0x38,0x4a,0xbc,0x60,0xd7,0xa3,0xd2,0x6b,0xb0,0x6e,0x65,0x44,0x0f,0xd1,0x94,0x37,0xf6,0x6c,0x42,0x01,0xaf,0x85,
+0x70,0x03,0x7f,0xcc,0x97,0x51,0x51,0x9a,0x73,0x11,0x58,0xe4,0x83,0x58,0xa3,0xad,0xec,0x3c,0x87,0x0e,0x87,0xa0,0x6f,0xd4,0xe6,0x64,0xe1,0xa7,0x47,0x6f,0x9f,0xbe,
+0x0e,0xfd,0x47,0x3f,0x0d,0xe7,0x37,0x43,0xa1,0xa2,0x85,0xfc,0xf6,0x3d,0xd2,0x6b,0xba,0x23,0x8d,0xbc,0x78,0xf6,0x3d,0xda,0x68,0x36,0x64,0x5f,0xde,0x98,0x36,0xc4,
+0x35,0xc0,0x93,0x11,0x89,0x0c,0x5b,0xc8,0xb8,0x76,0x83,0x01,0xb1,0x15,0x9f,0x62,0xe7,0x4d,0xb8,0xce,0xaa,0x51,0xfc,0x79,0xca,0x6f,0xd5,0xcb,0x6f,0x11,0xe0,0xbb,
+0xb0,0x0c,0xf5,0x89,0xac,0xfe,0xbe,0xa4,0xd9,0x8a,0xf5,0xf0,0x25,0xa4,0x80,0x5e,0x9f,0xa2,0xb0,0x98,0x06,0xb6,0x04,0x77,0x77,0xe2,0x8e,0x78,0x4a,0x0b,0x7f,0x2e,
+0x0a,0x27,0xf9,0xef,0x4f,0x82,0x5b,0x82,0xe3,0x18,0x50,0x73,0x1a,0x8b,0x19,0x79,0x9c,0x29,0xdf,0x72,0x4c,0x6f,0x10,0xc1,0x1e,0x92,0x51,0xb0,0xdd,0xde,0x3e,0xfc,
+0xa8,0x40,0x01,0x45,0xa5,0x86,0x77,0xdc,0x0f,0x3a,0x51,0x69,0x68,0x48,0x59,0xd3,0x4c,0x28,0x93,0x4c,0x5b,0x68,0xe2,0xdd,0x78,0x21,0xba,0x0f,0x24,0x0a,0x4c,0x82,
+0x38,0x5b,0x7d,0xed,0x01,0xa2,0xe3,0xf2,0x48,0xb2,0xbe,0x16,0x85,0x29,0xf8,0x09,0xfe,0x39,0x04,0x94,0xe7,0xd1,0xd9,0x29,0xbc,0xdf,0x60,0x29,0x12,0xe4,0x48,0x89,
+0xe1,0xb7,0x1c,0x03,0x1a,0xec,0x5c,0x70,0x14,0x7f,0x6b,0x1f,0x16,0x7a,0x42,0xe7,0x59,0xb9,0x92,0xc9,0xc9,0x80,0x94,0xab,0x16,0xb0,0x95,0x80,0xa0,0xaa,0x77,0xc4,
+0x26,0x30,0x84,0x1c,0xc1,0x13,0x7c,0x1c,0xe2,0xc7,0x4e,0x98,0xce,0x97,0xbe,0x0f,0xc5,0xf3,0x43,0x72,0x03,0xef,0x45,0xb6,0x2a,0xdd,0x32,0xf8,0xb9,0x14,0xa6,0x54,
+0xbb,0xc8,0x04,0x0a,0x7e,0x56,0x70,0xa3,0x6e,0xb7,0x7c,0x20,0x84,0xa9,0x59,0x2a,0x53,0x58,0xa9,0xf2,0x76,0x4e,0xcd,0x68,0xd0,0x2f,0x6e,0xb1,0x62,0x70,0xc2,0x65,
+0x1a,0x40,0x51,0x7e,0x56,0x40,0xe2,0x54,0xa0,0x4d,0xf4,0x26,0x11,0xad,0xb2,0xc4,0x7d,0xc9,0x50,0x10,0x10,0x2d,0x8c,0x73,0xa4,0x1b,0x0a,0xc4,0xf7,0x6d,0xcb,0x32,
+0xf3,0x83,0xf6,0x64,0x49,0xed,0xa5,0x28,0x9c,0x7a,0x59,0x70,0x03,0x8d,0x5a,0xe7,0xec,0x45,0x07,0x22,0x7d,0x81,0x2e,0xa2,0x74,0x3e,0xcd,0xc3,0x1c,0x12,0x6f,0xb6,
+0x60,0x53,0xf0,0x1c,0x27,0x98,0x0d,0xa1,0x76,0xe2,0x04,0x68,0x06,0xbf,0x15,0xc1,0x06,0xd7,0x35,0x60,0x8d,0x7c,0xb2,0x29,0x7d,0xad,0x52,0xd0,0xff,0x03,0x43,0x55,
+0x56,0x05,0xf0,0x57,0x61,0x88,0x4e,0xcb,0x1c,0x4b,0x18,0x46,0x32,0xd7,0xdc,0x10,0xff,0x85,0x22,0x7b,0x84,0x2a,0x3d,0x5a,0x9f,0xfe,0xb9,0x73,0x3e,0x40,0x98,0x33,
+0x28,0x35,0x59,0x06,0xf1,0xde,0x41,0x66,0x9d,0x9c,0x46,0xf0,0x4c,0x03,0xe5,0x80,0xd3,0xd5,0x91,0xef,0xe5,0xe3,0x32,0x0c,0x7f,0xc5,0x32,0x59,0x7d,0x99,0x7d,0xac,
+0x75,0xbb,0xc7,0x0b,0x48,0x8d,0x61,0x1a,0xd1,0x27,0xa2,0x17,0xd1,0x0c,0xfa,0xba,0x7f,0x25,0xcb,0x8e,0xef,0xc5,0x1d,0xc8,0xb5,0xab,0xce,0x32,0xc5,0x84,0x0b,0xcf,
+0xb4,0x23,0xe2,0x57,0x45,0x89,0x83,0xf0,0x20,0xdb,0x76,0x8a,0x70,0x81,0xfa,0x92,0x8f,0x35,0x38,0xa0,0x5f,0xa8,0x97,0x4c,0x24,0x38,0x2f,0x46,0x21,0x70,0x81,0x09,
+0x25,0x4d,0x52,0x51,0x3a,0x66,0x9f,0x14,0x85,0xef,0xb2,0xaf,0xb1,0xce,0x2b,0x8e,0xc7,0xea,0xae,0x62,0xbf,0x86,0x5e,0xea,0x06,0x0e,0xca,0xc9,0x8d,0xb2,0x6d,0x7b,
+0x32,0x8a,0x4b,0xc5,0xc6,0x57,0xd7,0xd7,0xe2,0x75,0xe5,0x1f,0x70,0xd6,0x03,0xbd,0xcf,0x00,0x05,0xf4,0x4b,0x4b,0x4a,0xae,0x47,0x8d,0xf1,0x4f,0xe8,0xce,0xb5,0xd6,
+0xf4,0xba,0x91,0x11,0x7e,0x84,0x66,0x8a,0xfd,0xe9,0x14,0x8a,0x78,0xbe,0x2c,0x76,0x48,0xb8,0xa5,0xde,0x97,0x7d,0x72,0xf9,0x09,0x16,0x9b,0x13,0xb2,0xb7,0x2d,0xc6,
+0x38,0x8e,0xf3,0xed,0x1f,0x13,0xe8,0xcc,0xa4,0x35,0x00,0xc4,0xdf,0x11,0x6b,0xe6,0x3e,0x01,0xef,0x64,0x59,0x88,0xe5,0x1e,0xd0,0x47,0x78,0x20,0x3f,0x84,0xdb,0x67,
+0xb6,0x47,0xd0,0xe1,0xef,0x5b,0x27,0x04,0x48,0xb0,0x7e,0xc7,0xb3,0xa7,0x01,0xa7,0x72,0x31,0x36,0xa0,0x15,0xbf,0x26,0x44,0xd9,0xe2,0x1d,0x61,0xad,0xfb,0x89,0xc3,
+0x7c,0x4e,0x83,0xf3,0x5f,0x00,0xfd,0x29,0xef,0xac,0xb8,0xc7,0xb4,0x8e,0x18,0x1a,0x38,0xf8,0xab,0x2a,0x5e,0x38,0xdb,0xc6,0x29,0xe1,0x4b,0xfc,0x22,0x61,0x41,0xc4,
+0xfc,0x2c,0x99,0x4e,0x21,0x92,0x68,0x2d,0x90,0xea,0xbb,0x72,0xd9,0xa0,0x53,0x97,0xd6,0x2f,0xd9,0xcf,0x43,0xf3,0x17,0x1e,0x02,0xdb,0x73,0x0d,0xe0,0x4d,0xb7,0xe7,
+0x75,0x66,0x77,0x70,0x42,0x79,0x3e,0x33,0x3f,0x13,0xd1,0xc1,0xe4,0xaa,0xd8,0x48,0xf5,0x3a,0x04,0x9a,0x55,0xa5,0x46,0x5a,0x3c,0x10,0x5b,0xbb,0x1d,0x31,0xbb,0xdf,
+0xa0,0xa5,0x90,0x2d,0x38,0x4d,0x47,0xe8,0x21,0xef,0x32,0xa8,0xcb,0xbc,0x5f,0xa6,0x7d,0x5e,0x4b,0xff,0x73,0x02,0xae,0x71,0xc2,0xc0,0x3c,0x81,0x53,0x09,0x25,0x3f,
+0xac,0xa7,0x9b,0xee,0xdc,0xcb,0xe7,0xf0,0x04,0x90,0xe0,0x19,0xab,0xc0,0x0f,0xac,0x92,0x6e,0xfe,0xc3,0xfc,0xe7,0x38,0x50,0x92,0x2b,0x28,0x72,0xfb,0x17,0x6f,0xf8,
+0x61,0xde,0x2b,0x96,0x39,0x36,0x67,0x28,0x31,0x96,0x93,0x72,0x88,0x10,0x5d,0x65,0x7f,0x4b,0xb3,0xa3,0x80,0x3e,0x4f,0x38,0xff,0x45,0x78,0x00,0x9f,0xb2,0x8d,0xaa,
+0xca,0x15,0x2b,0x1a,0xe5,0xdd,0x59,0x02,0xc2,0x45,0xc9,0x4c,0x14,0x3e,0xb2,0xb3,0xe2,0xf9,0xa7,0xa7,0xd0,0xaa,0xe5,0x29,0xcc,0x40,0xab,0x23,0x7b,0x95,0xcc,0x3e,
+0xef,0xdc,0x92,0x6c,0xf1,0xc2,0x2b,0xbc,0x11,0xef,0x8a,0x71,0xe8,0x9f,0x6f,0xdf,0x9c,0x16,0x45,0xfa,0x81,0xfe,0xbe,0x04,0x0f,0x1b,0x85,0x4a,0x02,0xa7,0x2a,0x51,
+0x78,0x7f,0xfe,0xf1,0x93,0x20,0x0b,0x4c,0x37,0x3c,0x17,0x60,0xe4,0x28,0xfc,0x11,0x8b,0xcf,0x4b,0xec,0xe3,0xb0,0x12,0x51,0x88,0x54,0x6e,0x01,0x74,0x3d,0x41,0xde,
+0xb6,0x80,0x19,0xb7,0x63,0x4a,0xf8,0x1f,0xd1,0x61,0x37,0x2c,0x66,0x0a,0xae,0xa7,0xc1,0x49,0x06,0x61,0x5d,0x78,0xd1,0x23,0x16,0x75,0x18,0x3d,0x20,0x26,0x66,0x97,
+0xdd,0x1e,0x49,0x5c,0xf1,0x24,0x75,0x96,0xa0,0xd2,0xea,0x2b,0x3b,0xfe,0x19,0xce,0xb2,0x40,0xe7,0xfb,0xab,0x3b,0x6d,0x50,0xce,0x18,0xdb,0xb3,0x15,0x2a,0x9a,0xfa,
+0x73,0xe8,0x16,0x28,0xa9,0x1d,0x10,0x61,0x9b,0x90,0xf5,0x6f,0xab,0x8f,0x48,0x40,0x88,0x29,0x1d,0xb1,0xb1,0x9a,0x35,0xa5,0xa3,0x7a,0xc8,0x8e,0xb0,0xb4,0x74,0x1a,
+0x34,0x26,0xa6,0x16,0xd6,0x3c,0x13,0x64,0xc6,0xad,0x82,0x36,0x1d,0xb5,0x6e,0x6c,0xb9,0xc3,0x56,0x99,0x05,0x5a,0x1f,0xa1,0x97,0x49,0x65,0xbd,0x2a,0x59,0x08,0x1f,
+0xe1,0x88,0x49,0xb3,0x0e,0x4f,0x3a,0x90,0x86,0xf8,0x36,0x1d,0xec,0xfc,0x81,0xbc,0xda,0xf6,0xc1,0xbc,0xa1,0xf2,0x94,0x67,0x68,0x5e,0x0d,0xc1,0x74,0x18,0x85,0xb5,
+0x70,0x01,0x96,0x38,0xeb,0x33,0x17,0x64,0x55,0x1e,0xff,0x3c,0x8e,0x27,0x0c,0x7e,0x0b,0x82,0xc8,0xaa,0xba,0x87,0xc7,0x02,0xde,0x64,0xee,0x05,0xfa,0x1f,0x2c,0xbc,
+0xf9,0x1f,0x85,0x1e,0xff,0x5a,0xbe,0xec,0xfe,0x10,0x94,0xa5,0x0d,0xee,0xa5,0xfc,0x3c,0x50,0xba,0xf9,0x3b,0x4e,0x09,0xf5,0x8b,0xc5,0x1c,0x9f,0x2b,0xfb,0xcb,0x75,
+0x63,0xd3,0xf2,0x18,0xc1,0xfb,0xa5,0x36,0x9c,0xcd,0x11,0x4f,0x58,0xc8,0xee,0x2c,0x06,0x97,0xd9,0xd6,0x1e,0x01,0xcb,0x49,0x59,0xbf,0x80,0x09,0x2d,0x7e,0x0d,0xe9,
+0x0d,0x79,0x3d,0x2a,0x87,0x92,0xf8,0x55,0xb5,0x84,0xfc,0xb1,0xbb,0x7d,0x68,0x7b,0xff,0x8b,0xf3,0xb7,0x65,0x0f,0xf7,0x86,0x39,0x9d,0x20,0x6f,0xef,0xb2,0x7f,0x2f,
+0xeb,0x0f,0xc0,0x42,0x66,0x50,0x43,0x4b,0x18,0xa4,0x05,0xaa,0x54,0xc2,0x36,0xf1,0x92,0x56,0x22,0x1e,0xfd,0x7e,0x60,0x73,0x3f,0x0a,0x21,0x11,0xcb,0xf5,0x3f,0xc3,
+0x8a,0x94,0x34,0x63,0x07,0xad,0x17,0xfc,0x0f,0x8e,0xc5,0xed,0xae,0x0a,0xa3,0x86,0xe2,0x2c,0x8d,0xb6,0x7c,0xef,0xe7,0xc9,0x4f,0x88,0x14,0x65,0xa1,0x2d,0x96,0x68,
+0x94,0xba,0xb2,0xbb,0xdd,0xfa,0x9b,0x32,0x6d,0x0f,0x41,0x36,0x95,0xd6,0xbb,0x6d,0x9b,0x0d,0xd5,0xe1,0xa2,0xc2,0xa6,0xea,0x95,0xa2,0xb5,0x87,0xbc,0xbf,0x45,0x73,
+0x80,0x1f,0x1a,0xb8,0x6b,0x54,0xf9,0x92,0xf2,0xb8,0x78,0x97,0x74,0xc0,0x0d,0xc2,0xa0,0xd9,0xbe,0xb1,0xc6,0xb3,0xcc,0x41,0xa0,0xf1,0xb2,0x39,0x7a,0x0f,0x8d,0x41,
+0x5e,0x11,0x41,0x8b,0x55,0x2d,0x2c,0x6b,0x30,0xe3,0x00,0x6f,0xd0,0x98,0x63,0xa9,0xdb,0xb0,0x63,0x1e,0xbb,0xd2,0x39,0xfa,0x1f,0x80,0xaa,0x6a,0x0d,0xd4,0x2e,0x00,
+0x00
+};
+const size_t WM_PK_OTA_JS_GZ_LEN = 4929;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_OTA_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xc5,0x5a,0x4b,0x77,0xdb,0x46,0x96,0xde,0xeb,0x57,0x50,0xa7,0x13,0x02,0x30,0x41,0x18,0x6f,0x02,0x24,0xcb,0x8e,
+0x9f,0x91,0x12,0xdb,0x72,0xfb,0x91,0xee,0x69,0x59,0x71,0x83,0x40,0x91,0x84,0x04,0x02,0x0c,0x00,0x52,0xa2,0x29,0xf6,0x7f,0xc9,0x62,0x16,0xb3,0x98,0xd5,0xcc,0x6a,
+0xce,0xe9,0xd9,0xf8,0xe4,0x7f,0xcd,0xbd,0x55,0x05,0xbe,0x40,0xa5,0x95,0xd5,0x24,0xe7,0x98,0x40,0xd5,0xad,0x7b,0xbf,0xba,0xef,0x2a,0x28,0xcc,0xd2,0xa2,0x6c,0x7c,
+0x33,0xd1,0x89,0x2c,0x2b,0xe4,0xd1,0x32,0x64,0xef,0x23,0x3a,0x88,0x49,0x41,0x1e,0x45,0x59,0x38,0x9b,0xd0,0xb4,0xd4,0x46,0xb4,0x7c,0x91,0x50,0x7c,0x7c,0xba,0x38,
+0x8d,0xe4,0x42,0xe9,0x71,0xc2,0xd3,0x13,0x22,0x27,0xea,0x1c,0x57,0xe2,0x1a,0x39,0x51,0xb4,0x92,0xde,0x94,0xcf,0xb2,0xb4,0x04,0x5a,0x32,0x5f,0xf5,0x72,0x5a,0xce,
+0xf2,0x74,0x79,0x7a,0xa2,0x22,0xc1,0xaa,0xb7,0x52,0xe4,0x6a,0xf1,0x37,0x13,0x43,0x48,0x1d,0xce,0xd2,0xb0,0x8c,0xb3,0xb4,0xf1,0x04,0x38,0x2c,0xf9,0x92,0x46,0xd2,
+0x6c,0x26,0xda,0xe7,0xcf,0xb4,0x78,0x9d,0x45,0xb3,0x84,0x36,0x9b,0x67,0x83,0x4b,0x1a,0x96,0xda,0x34,0xcf,0xca,0xac,0x5c,0x4c,0xa9,0x36,0x0e,0x8a,0xb3,0xeb,0xf4,
+0x6d,0x9e,0x4d,0x69,0x5e,0x2e,0xb4,0x30,0x48,0x12,0x40,0x23,0x45,0x74,0x18,0xcc,0x92,0x52,0x52,0x1e,0x27,0x9a,0x78,0xee,0x26,0xab,0xa3,0x79,0x90,0x37,0x5e,0x91,
+0x25,0xbd,0x99,0x66,0x79,0x59,0x74,0x97,0xab,0x95,0x7a,0xb3,0xf3,0xda,0x93,0x2b,0x1c,0xb2,0xb2,0x44,0xea,0x84,0x48,0x4f,0x9e,0x3e,0x7b,0xfe,0xe2,0xe5,0xf7,0x27,
+0xa7,0x3f,0xfc,0xf8,0xea,0xf5,0x9b,0xb3,0xb7,0x7f,0x7e,0xf7,0xfe,0xc3,0xc7,0x9f,0xfe,0xf2,0xd7,0x7f,0xfb,0x5b,0x30,0x08,0x81,0xf9,0x68,0x1c,0x5f,0x5e,0x25,0x93,
+0x34,0x9b,0xfe,0x92,0x17,0xe5,0x6c,0x7e,0x7d,0xb3,0xf8,0xa2,0x1b,0xa6,0x65,0x3b,0x6e,0xc7,0xf3,0x5b,0x0f,0x25,0x75,0x48,0x96,0x00,0x38,0xe9,0xae,0x79,0x17,0x6a,
+0xb4,0xde,0x63,0xd1,0xef,0x47,0xb7,0xc5,0xa3,0x47,0x8f,0x2c,0xb3,0x1d,0xad,0x54,0x20,0xcc,0xef,0x24,0x44,0x12,0x46,0x0b,0x84,0x34,0x8d,0xe2,0x20,0xdd,0x22,0x55,
+0x96,0xf1,0x50,0x2e,0x34,0xa6,0xd8,0x7c,0x16,0x96,0x59,0x4e,0xc8,0x9b,0xd9,0x64,0x40,0x73,0xe5,0x48,0xb0,0x18,0x6a,0x88,0x03,0xb8,0x7a,0x4a,0xd3,0x70,0x3b,0x86,
+0xe1,0x5b,0xce,0xed,0x7a,0xd0,0xb4,0x95,0xa6,0x6d,0x76,0x3c,0xd3,0x71,0x2c,0x57,0xef,0x0d,0xb3,0x5c,0x46,0x15,0x44,0x44,0xef,0x45,0xfd,0x42,0x4b,0x68,0x3a,0x2a,
+0xc7,0xbd,0xa8,0xd5,0x52,0x8a,0xf3,0xe8,0x82,0x0c,0x35,0x0e,0x41,0xc6,0x37,0xa5,0x57,0xa1,0x84,0x2d,0x04,0x69,0x94,0x4d,0x9e,0x2e,0x4a,0x5a,0xec,0xc0,0xdb,0x30,
+0x3c,0xbf,0xe8,0x15,0x8f,0xf4,0x5e,0xd1,0x6e,0x2b,0x47,0x91,0x36,0x9d,0x15,0x63,0xf9,0x75,0x50,0x8e,0xb5,0x61,0x92,0x01,0x0d,0x7b,0xe4,0x4c,0x64,0xe5,0x81,0xe9,
+0xb8,0xca,0x9a,0x3b,0xec,0x7b,0x80,0x7c,0x3f,0x64,0x7f,0xc9,0xf2,0xe8,0x6e,0xf6,0x6a,0x40,0x74,0x35,0x04,0xe0,0xc1,0x06,0x78,0xd0,0x6a,0xa9,0x61,0x8b,0x78,0x20,
+0xf2,0x3c,0x04,0x1d,0x3a,0x17,0xb7,0xa4,0x38,0x0f,0x2e,0xfa,0x7d,0xd3,0x6e,0x87,0xdf,0x5a,0xe6,0x96,0x90,0x6b,0xe4,0xfe,0x21,0xfb,0xfd,0x3d,0xa0,0x90,0x2d,0x01,
+0x0f,0x80,0x43,0xc0,0xf9,0xf3,0x2d,0x01,0x73,0x26,0x06,0xfe,0x01,0x09,0x01,0x48,0x68,0x82,0x6a,0x0f,0xec,0xe5,0x84,0xde,0xdc,0x57,0x08,0xee,0x62,0x2d,0x00,0x25,
+0x20,0x77,0x1b,0x42,0x2e,0x7b,0x5f,0xe6,0x71,0x3a,0x92,0x0d,0xd0,0x96,0xba,0x3d,0xdf,0x34,0x9c,0xbd,0xe9,0x35,0x00,0xed,0x32,0x8b,0x53,0x59,0x92,0x94,0x95,0x3a,
+0xa6,0x37,0x7f,0x70,0xbb,0xb8,0x57,0x73,0x0d,0x65,0x1a,0xe4,0x05,0x3d,0x4d,0x4b,0x70,0xc0,0x62,0x36,0x00,0x07,0x94,0x03,0xd5,0x54,0x54,0xe3,0xa0,0xed,0x9e,0x06,
+0x05,0x75,0xed,0x3f,0x22,0xc8,0x52,0x8e,0x2a,0x8a,0x50,0x18,0xcd,0x70,0x6f,0xe1,0xa1,0x65,0xc0,0xa3,0xc7,0x9e,0xcc,0x0b,0x35,0x86,0x85,0x71,0xdf,0xee,0xc5,0xa8,
+0xa4,0xe0,0x81,0xd7,0x8a,0x1f,0xb8,0x7d,0xb2,0x36,0x90,0xf7,0x58,0xa0,0x4d,0xb4,0x70,0x1c,0xe4,0x4f,0x4a,0x19,0xfd,0xc0,0x7d,0x20,0x5b,0xed,0x58,0x69,0xba,0x96,
+0xa2,0x74,0x05,0x81,0x44,0xa4,0x83,0x6a,0x1a,0x30,0xe4,0x87,0x34,0x55,0x80,0x98,0x9c,0x4e,0x93,0x20,0xa4,0xf2,0xc3,0xf3,0x9f,0x9f,0xb4,0xff,0xa6,0xb7,0xfd,0xd6,
+0xa7,0x87,0x17,0x0f,0xe3,0x91,0x0a,0x6b,0x7b,0xff,0xca,0x3d,0x43,0xd2,0x6a,0x05,0xdf,0xda,0xca,0x51,0x78,0x4c,0xf4,0x66,0xb3,0x32,0x61,0xa2,0xc5,0x69,0x44,0x6f,
+0xce,0x58,0x68,0x73,0xd0,0x41,0xdb,0x50,0x94,0x26,0x8b,0x92,0x69,0x76,0x2d,0x9b,0x6a,0xdb,0x7c,0x10,0xb6,0x3c,0x05,0x86,0xfb,0xfd,0xf0,0x81,0x79,0x7b,0x68,0x8d,
+0xa2,0xe0,0x56,0xdb,0x30,0xbd,0x65,0x90,0x55,0xef,0x46,0x13,0xd9,0x8f,0x0c,0x59,0x5a,0x46,0x84,0x27,0x64,0x3d,0xaa,0xbe,0x24,0xcb,0x59,0x39,0xf4,0xba,0xcb,0x82,
+0xf9,0x4f,0x6d,0xe7,0x9b,0x5c,0xfd,0x52,0x1b,0xc4,0xa9,0xb6,0x43,0x26,0xcf,0x52,0x5a,0x84,0xc1,0x94,0xca,0x34,0x0d,0xb3,0x88,0x7e,0x7c,0x77,0xfa,0x2c,0x9b,0x4c,
+0xb3,0x14,0x0a,0x03,0xac,0x54,0x94,0xb5,0x47,0x70,0xef,0x3c,0xc4,0x36,0xa2,0xb5,0x95,0x82,0x27,0x17,0xb8,0xc3,0x80,0x33,0x05,0xae,0x71,0xfa,0x7b,0x88,0x2b,0x53,
+0x0c,0xd1,0x14,0x05,0x98,0xa1,0xe8,0x27,0x95,0x19,0x0a,0x74,0x9d,0xe1,0xb6,0x9b,0x3c,0x03,0xf9,0xa0,0xc1,0x42,0xd9,0x89,0xde,0xe1,0xef,0x61,0xbf,0xaf,0x00,0xbe,
+0x54,0x1b,0xe6,0xd9,0xe4,0x99,0x90,0x24,0x27,0xe7,0xc5,0xc5,0x26,0x68,0x86,0x1b,0xe7,0x83,0x7d,0x9d,0x92,0x97,0xcc,0x42,0x67,0xe4,0x80,0xa6,0x92,0x63,0x92,0xce,
+0x12,0x28,0x99,0xf2,0x6b,0x18,0xbd,0xbd,0x7d,0xcb,0xfe,0x3d,0x3e,0x86,0x0a,0x1a,0x17,0x4f,0x67,0xc3,0x21,0x14,0x82,0x55,0x6f,0x5d,0x67,0x5f,0x6f,0x96,0x22,0xcd,
+0x56,0xd9,0x68,0x36,0xb1,0xb4,0x66,0xc3,0xc6,0xce,0xa8,0x56,0x31,0x21,0x44,0xaa,0x98,0x48,0x58,0x9f,0x0f,0xd1,0x00,0xef,0xd5,0xd1,0x5a,0xd4,0xdb,0x2d,0x94,0x6b,
+0xd6,0x39,0x0d,0xa2,0x97,0x49,0x16,0x94,0xaf,0x5e,0xec,0x72,0x5c,0x53,0x14,0x49,0x1c,0xd2,0xdd,0x39,0x00,0xcd,0x87,0x65,0x5d,0xd5,0xc1,0xd4,0x47,0xf5,0x7a,0x7d,
+0x02,0xe5,0xf6,0x54,0x43,0xa7,0x05,0xcd,0x9f,0xa9,0x11,0xbc,0x80,0x3b,0x40,0xc4,0xad,0x29,0x43,0x35,0x56,0x96,0xe1,0x6e,0xa1,0xe4,0x96,0x78,0x1c,0x37,0x9b,0xb1,
+0xc6,0x9c,0x15,0xde,0x08,0xc8,0x86,0xa5,0x41,0xbe,0x90,0x1e,0x87,0x24,0xda,0xf3,0xed,0x50,0xe9,0x86,0x50,0x03,0x6b,0x83,0xf8,0x0f,0x90,0x3f,0xc9,0xf3,0x60,0xb1,
+0xd5,0xa8,0x30,0xd4,0xbc,0x3f,0x09,0x01,0x7a,0xf7,0x98,0x13,0xc4,0x05,0xfb,0x85,0x35,0xcd,0xe6,0x0e,0xa4,0x63,0x42,0x3e,0xc6,0x69,0xe9,0xb1,0x69,0xb0,0x69,0x48,
+0xc2,0x4d,0x16,0x57,0x36,0xe9,0x24,0x27,0x89,0xb6,0x5d,0x12,0x81,0x93,0x3a,0x05,0xda,0x2a,0xe5,0xa9,0x29,0x31,0x3a,0x96,0xe9,0x78,0x36,0x14,0x7b,0x95,0x92,0xb6,
+0xd9,0x81,0x77,0xcb,0xeb,0xf8,0x6a,0x46,0xda,0xeb,0x29,0x5b,0x2d,0x49,0x35,0xe3,0xa9,0x33,0x70,0xd9,0x59,0x3f,0xaf,0x5c,0x76,0x86,0x2e,0x9b,0x9f,0xcf,0x2e,0x88,
+0x8c,0xff,0x62,0xc2,0xc5,0x5f,0x56,0xd7,0xb6,0x1a,0x09,0x31,0x69,0xda,0xd5,0xac,0xb7,0xd3,0x4f,0xe4,0xe7,0x53,0x51,0x75,0x0d,0xd3,0xeb,0xf7,0xa7,0x50,0x0f,0xd5,
+0xfc,0x5c,0x9e,0xb6,0x5c,0x1b,0xc6,0xfd,0x7e,0xdf,0x56,0x5a,0x86,0x7d,0x41,0xa6,0xeb,0xbd,0x4d,0x48,0xa0,0x7d,0x1e,0x0e,0xd5,0x11,0xfe,0x8e,0x46,0xea,0x18,0x7f,
+0xc7,0x63,0x75,0x81,0xbf,0x71,0x5c,0x87,0x49,0xa0,0xde,0x30,0x37,0x78,0x46,0x52,0xf5,0x3d,0xa1,0xea,0x15,0xc9,0xd4,0xcf,0xa4,0xec,0xa5,0x64,0x22,0xa7,0x2a,0x55,
+0x33,0xb5,0x04,0x99,0xb3,0x96,0x7e,0xa1,0x76,0xd4,0xb6,0xeb,0xe9,0x5e,0xc7,0xf5,0x2d,0x57,0x81,0xdd,0x4f,0xe4,0x52,0xe5,0x24,0x48,0x60,0x5c,0xa8,0x06,0x24,0x56,
+0xcb,0xf3,0x1d,0xd7,0x76,0x3c,0xa0,0xc8,0x80,0x02,0x97,0x23,0x0d,0x52,0x40,0xb9,0x31,0x3a,0xaa,0xab,0xbb,0x86,0xee,0x78,0x86,0xaf,0x80,0x6e,0x27,0x32,0x97,0x90,
+0x32,0x02,0xeb,0x42,0x35,0x81,0x85,0xa1,0xdb,0xb6,0x63,0x3a,0x96,0xa5,0x2b,0xea,0x3e,0x0c,0x9b,0xc1,0x30,0x3a,0xae,0x6d,0x78,0x9e,0xdf,0xa9,0xc3,0x70,0x18,0x0c,
+0xc3,0xd4,0x75,0xdd,0xd3,0x6d,0xf3,0x00,0x0c,0x97,0xc1,0x68,0x1b,0x36,0x58,0xd2,0x32,0x2c,0xdb,0xa8,0x03,0xe9,0x70,0x20,0xb6,0xd3,0xd1,0x1d,0xdf,0xb3,0xea,0x30,
+0x3c,0x84,0x61,0x74,0x3a,0xba,0x6e,0x39,0xb6,0x71,0x40,0x1b,0x3e,0xd7,0x86,0xe1,0xa3,0xaf,0xd8,0xb6,0xd1,0xa9,0xe3,0x30,0x74,0x0e,0xc4,0x36,0x75,0x28,0xa4,0x35,
+0x0c,0x86,0x21,0xb4,0xe1,0xfb,0xba,0xad,0x83,0x10,0xb3,0x0e,0xc3,0x30,0x19,0x0e,0xd8,0xa8,0xab,0x5b,0xae,0x67,0x1e,0xb0,0x8a,0xc5,0x81,0xd8,0x3a,0x6c,0xd4,0xd0,
+0x8d,0x03,0x30,0x6c,0xa1,0x0f,0x47,0x07,0xa5,0x99,0xa6,0xaf,0x1f,0xc0,0xe2,0x30,0x2c,0xd0,0xa2,0xbb,0x8e,0xe5,0x58,0xa6,0x8f,0x50,0x46,0xbb,0x50,0x2e,0x54,0x07,
+0x98,0xb8,0x4e,0xc7,0x77,0x1d,0x43,0x47,0x24,0xa3,0x1d,0x24,0xa0,0x76,0x1f,0x6d,0xeb,0xfa,0x8e,0x6e,0xb8,0x96,0x89,0x48,0x46,0xbb,0x48,0xd0,0x85,0x6c,0xd5,0xb5,
+0x2d,0x08,0xab,0x8e,0xc1,0x74,0x32,0xda,0xc1,0x01,0x1a,0x33,0x75,0xf0,0xb1,0x0e,0x78,0x59,0xc7,0xd2,0xcd,0x3a,0x0c,0x87,0xc1,0xe8,0xe8,0x86,0x03,0x2e,0xe8,0x1b,
+0x75,0x18,0xa8,0x75,0x5f,0xb5,0x3c,0xc0,0xa0,0xa3,0x65,0x6b,0x20,0x1c,0x06,0xa2,0xed,0xba,0xba,0xdd,0xf1,0x2c,0xcb,0xa9,0xa3,0xb0,0x39,0x0a,0x5b,0x87,0x28,0xed,
+0x78,0xb6,0x57,0x47,0xe1,0x23,0x0a,0xc7,0xf5,0x6c,0x1b,0x36,0xe3,0x1d,0x00,0x61,0x0b,0x65,0x18,0xbe,0x07,0x86,0x43,0x95,0xef,0xe3,0xb0,0x38,0x0c,0xc3,0xeb,0x58,
+0xae,0xe5,0xbb,0x46,0x1d,0x86,0xc7,0x60,0x18,0xa0,0x4b,0xc7,0x02,0xe3,0x19,0x07,0x6c,0x62,0x71,0xa3,0xd8,0x80,0xc3,0x33,0x6c,0xb7,0x53,0x47,0x62,0x32,0x20,0x8e,
+0x01,0xfe,0x01,0x5b,0xa9,0xc3,0xe8,0x30,0x18,0x90,0xe5,0xc0,0xea,0x1e,0x44,0x4c,0x1d,0x06,0xfa,0x20,0xaa,0xc3,0xf0,0x4d,0xd0,0x59,0xa7,0x63,0xd9,0x08,0x64,0xbc,
+0x6f,0x15,0x1b,0xcd,0xe6,0x81,0x55,0x10,0xc3,0x78,0x07,0x03,0x6c,0xc4,0x30,0xa0,0x25,0x03,0xe7,0x73,0x3a,0x00,0x95,0x59,0x65,0x5c,0x77,0x0d,0x17,0x3c,0xdd,0xf2,
+0x75,0x4b,0x77,0x30,0x16,0x28,0x90,0xec,0xe0,0x40,0xb3,0x58,0x20,0xc5,0xb1,0x74,0xdf,0x81,0x23,0x50,0x0d,0x85,0xc1,0x50,0x18,0x38,0xef,0x43,0xcc,0xe9,0x75,0x24,
+0x36,0x43,0x62,0x98,0x1d,0xd3,0xf3,0xc1,0xf4,0x07,0x80,0x74,0x18,0x0e,0x60,0xe2,0xd8,0x7e,0x87,0x79,0x71,0x0d,0x87,0xce,0x71,0x18,0xba,0x0f,0xfa,0xd2,0x5d,0x5b,
+0x3f,0x80,0xc4,0x42,0x28,0x60,0x13,0xb3,0xe3,0x1b,0x1d,0xbb,0x0e,0x44,0xe7,0x2a,0xb1,0x1c,0x0f,0x5c,0xcc,0x34,0xcd,0x3a,0x10,0x8b,0x03,0x81,0x49,0xc7,0x34,0xfc,
+0x8e,0x5f,0x07,0xe2,0x32,0x1c,0x1d,0x57,0x37,0x7d,0xc3,0xf3,0xeb,0x20,0x7c,0xa6,0x0e,0xc0,0x67,0xb9,0xb6,0xed,0x75,0xea,0x20,0xd0,0xb2,0x88,0xc2,0x36,0x0d,0xcf,
+0x70,0x3c,0x0c,0x85,0x9a,0x5d,0x1c,0x06,0x03,0x54,0xda,0xb1,0x01,0x88,0x5e,0x47,0x61,0x72,0x6d,0xf8,0x3e,0xe4,0x73,0x0f,0x32,0x03,0xe2,0x58,0xec,0x57,0x16,0xd4,
+0xa8,0xef,0xb9,0x96,0x0e,0x11,0x83,0x38,0x16,0x3b,0x38,0x50,0xe7,0xe8,0xe8,0xa6,0xeb,0xf9,0x86,0x6d,0x30,0x18,0x8b,0x7a,0x0e,0x63,0x9e,0x8e,0xd1,0x60,0xfb,0x3a,
+0x8b,0xda,0xc5,0x0e,0x10,0x4c,0x61,0xb0,0x19,0xf0,0x30,0x0b,0x23,0xb7,0x8e,0x03,0xb7,0x0b,0x2e,0x06,0x39,0xdd,0x06,0x3f,0xed,0x18,0x75,0x20,0x16,0x03,0x02,0x31,
+0xe9,0xdb,0x80,0x16,0x0a,0xd9,0x01,0x24,0xba,0x40,0xa2,0x3b,0x86,0x63,0x5a,0x75,0x18,0x06,0x87,0x61,0xea,0x00,0xd3,0x04,0xf3,0xfb,0x75,0x20,0x1e,0xc3,0x01,0x81,
+0x0f,0xd5,0xc9,0x72,0xfc,0x3a,0x0e,0xa6,0x75,0xcc,0x83,0x50,0x4a,0xc1,0x7d,0xec,0x3a,0x0c,0x57,0xa0,0x70,0x5c,0x4c,0x31,0x90,0xed,0x0e,0x00,0xb1,0x18,0x12,0x03,
+0xa2,0xc1,0x70,0x0c,0xd7,0x3e,0x00,0xc4,0xe6,0x96,0xb1,0x1d,0xd8,0x89,0xde,0xd1,0x0f,0x00,0x31,0x84,0x46,0xa0,0xde,0x9a,0x06,0xa4,0x10,0xbf,0x0e,0xc5,0x64,0x50,
+0x3a,0xb0,0x1f,0xaf,0x63,0x3a,0x7e,0x1d,0x88,0xcf,0x35,0x62,0x81,0x5d,0x40,0xef,0xdc,0x43,0xd2,0xd6,0x33,0xe8,0x70,0x74,0xa0,0xa5,0xad,0xf7,0xec,0x29,0x23,0x59,
+0xeb,0x8a,0x3d,0x95,0xa4,0x6c,0x7d,0xc6,0xa7,0x55,0x75,0x49,0x93,0x54,0xf7,0x2a,0xe7,0x02,0xfd,0x05,0xb4,0xed,0xac,0x11,0xda,0x69,0x61,0xd5,0x5c,0x9d,0x72,0xf0,
+0xbc,0xe5,0x29,0x49,0xd8,0x92,0xe3,0x66,0x7e,0xfb,0x8f,0xb8,0x39,0x55,0x5a,0x72,0x8a,0x4c,0x95,0x56,0x26,0x4e,0x12,0x72,0xd9,0xef,0xd3,0xdb,0x92,0xdf,0x33,0x51,
+0xa5,0x15,0xaf,0x54,0xd6,0x54,0xdd,0x87,0xe7,0xf4,0x36,0x6f,0xfe,0xe3,0xde,0x3c,0xc7,0xe3,0x7b,0xf0,0xfc,0x39,0xff,0xf9,0xde,0x0c,0xe3,0xf8,0x5f,0x33,0xcc,0x7f,
+0x96,0xe3,0x5b,0xc0,0x78,0x5f,0x9e,0x83,0x24,0x0b,0xaf,0x8a,0xf8,0x0b,0x85,0x96,0x11,0xdf,0xa3,0x78,0x44,0x8b,0xb2,0x1a,0x78,0xb5,0x39,0x15,0xef,0x1c,0x1a,0xe2,
+0x21,0xf4,0xe1,0xec,0x94,0xa5,0x1c,0x95,0xe3,0x3c,0xbb,0x6e,0xa4,0xf4,0xba,0xf1,0x22,0xcf,0xa1,0x61,0x95,0xde,0xe0,0xe9,0xbf,0x4c,0xbf,0xfe,0xb3,0x11,0xe4,0x23,
+0x76,0x67,0xda,0x90,0x5a,0x21,0x3f,0x52,0x63,0x97,0xbe,0x7d,0xa7,0x24,0x07,0x8c,0xe1,0xfa,0x98,0xc7,0xce,0x1d,0x41,0xc1,0xe6,0x1e,0xe7,0x5d,0xf1,0x2a,0x0e,0x25,
+0xd1,0xde,0x21,0x37,0x57,0xba,0xeb,0x9e,0xff,0x84,0xde,0xc0,0xfb,0x6a,0x7d,0x76,0xff,0x48,0xd6,0xd8,0xc5,0x15,0xeb,0x3b,0xf2,0x44,0xfe,0x58,0x09,0x5a,0xbe,0xdb,
+0xbb,0x7e,0x35,0xc5,0xf5,0x2b,0xae,0xfd,0x3c,0xc9,0xa2,0x20,0x79,0x56,0x14,0x44,0xd2,0xd8,0x63,0x3b,0x9b,0xd3,0x3c,0x09,0x16,0xcb,0x69,0x56,0xc4,0xa8,0x85,0xee,
+0x30,0xbe,0xa1,0x51,0x2f,0x4e,0x0b,0x5a,0x76,0xf5,0xde,0x20,0x08,0xaf,0x46,0x79,0x36,0x4b,0xa3,0x6e,0x3e,0x1a,0x04,0x78,0x26,0xc3,0xff,0x35,0x3c,0x26,0x47,0x71,
+0x01,0xea,0x58,0x74,0x87,0x09,0xbd,0xe9,0x05,0x49,0x3c,0x4a,0xdb,0x71,0x49,0x27,0x45,0x37,0x04,0xc5,0xd0,0xbc,0x77,0x39,0x2b,0xca,0x78,0xb8,0x68,0x87,0xfc,0x9e,
+0xb8,0x1a,0xfe,0xd2,0x66,0x57,0x17,0x5d,0x1f,0xfe,0x5b,0x49,0xad,0xa3,0x0a,0xc9,0x20,0xbb,0x59,0x6e,0x89,0xfb,0xd3,0x70,0x38,0xec,0x0d,0x40,0xa1,0x34,0x6f,0xe7,
+0x41,0x14,0xcf,0x8a,0xae,0xd6,0x71,0x72,0x3a,0x81,0xc1,0x9b,0x76,0x31,0x0e,0xa2,0xec,0xba,0xab,0x37,0xbc,0xe9,0x4d,0xc3,0x32,0xe1,0x9f,0x2d,0x78,0x9a,0xe9,0x29,
+0xbd,0x69,0x10,0xe1,0x09,0xaf,0x6b,0x6a,0xb8,0xa8,0x61,0xe2,0x4a,0xbc,0xb5,0x6e,0x33,0xa4,0x15,0x98,0x49,0x9c,0xb6,0xaf,0xe3,0xa8,0x1c,0x77,0x4d,0x53,0x9f,0xde,
+0x70,0x3c,0xc5,0x34,0x4e,0x53,0x9a,0x2f,0xf9,0x84,0x03,0xdc,0x7b,0x63,0x1a,0x8f,0xc6,0x25,0x7f,0xe6,0xa0,0xba,0x0e,0x08,0x2d,0xb2,0x24,0x8e,0xb8,0x68,0xd3,0x81,
+0x8c,0xef,0x41,0x66,0x00,0xf9,0x90,0xf2,0x2b,0xe8,0x65,0x36,0x05,0x05,0x24,0x59,0xde,0xfd,0x13,0x54,0x3d,0x37,0x32,0xf7,0xf6,0xe4,0xe8,0xdf,0xf6,0x82,0x34,0x9e,
+0x04,0x4c,0xf9,0x28,0xb9,0xa1,0x79,0x45,0x23,0x89,0x53,0x0a,0xf6,0x8a,0xd3,0x61,0x9c,0x82,0x52,0x7b,0x13,0x70,0xb8,0x38,0x85,0xfd,0x06,0xb3,0x32,0x6b,0x18,0x9a,
+0x89,0x9b,0x62,0x68,0xbf,0xbb,0xa2,0x8b,0x61,0x1e,0x4c,0x68,0xd1,0xc0,0xd5,0xcb,0x32,0x5b,0x96,0x79,0x90,0x16,0x70,0xc2,0x9a,0x74,0xe1,0x6c,0x1a,0x94,0x54,0x86,
+0xb3,0x59,0x44,0x47,0xe0,0x43,0x5b,0xea,0x9e,0x14,0xa3,0xa5,0x00,0x86,0xb9,0xce,0x37,0x85,0x0c,0xb0,0x43,0x59,0x66,0x93,0x4a,0xd9,0x43,0x30,0x5e,0x1b,0x83,0xa6,
+0x6b,0x68,0x3a,0x1b,0xb9,0x1e,0x03,0xa0,0x76,0x31,0x0d,0x42,0xda,0x9d,0xe6,0xb4,0x8d,0x50,0xb7,0x19,0x87,0x69,0xb9,0xdc,0xac,0xe2,0xea,0xe7,0x6c,0xae,0xb9,0x12,
+0xa1,0x60,0xf5,0x76,0x54,0xb2,0xe3,0x05,0x65,0xda,0x86,0xa8,0x5b,0xee,0x38,0xd7,0x28,0x98,0x56,0x78,0xee,0x70,0x2a,0x81,0x1d,0xb4,0xdd,0xdd,0x56,0xce,0x86,0xe9,
+0xb2,0xf2,0x07,0xcd,0x45,0x77,0x30,0x34,0xe1,0x4a,0xcc,0x94,0x69,0x96,0xd2,0x7d,0x5f,0xdb,0xdf,0xfd,0xfe,0x2e,0x5c,0xdc,0xc5,0x2c,0x2f,0x60,0x1b,0xd3,0x2c,0x46,
+0x10,0xfb,0xdb,0x58,0xd0,0x62,0xc7,0xa1,0x85,0xfd,0xc5,0xd6,0xc1,0xbd,0xf7,0x17,0xa4,0xd9,0x36,0x3d,0xb3,0xe2,0x34,0xc8,0x61,0x83,0xbd,0x5d,0x43,0x09,0xd4,0x9a,
+0xc1,0x36,0x7a,0x97,0x13,0x9a,0xca,0x4a,0xda,0xdc,0x05,0xd1,0xb4,0x98,0xe5,0xf4,0xb5,0x08,0x7f,0x99,0x25,0xba,0xe3,0xbb,0xbe,0xfc,0x48,0x79,0x45,0x28,0x29,0x3c,
+0x03,0x17,0x64,0x4d,0x1b,0xe6,0x14,0x7c,0x4a,0x90,0xcb,0x52,0x51,0x2e,0x12,0x2a,0x29,0xbd,0x42,0x8b,0x23,0xb2,0xb5,0x10,0x06,0xb6,0x3f,0x12,0xad,0x33,0x4f,0x6f,
+0xcd,0x68,0x4c,0x83,0x48,0x0b,0xa6,0x53,0xa8,0x85,0xcf,0xc6,0x71,0xc2,0x3e,0x38,0xad,0xb6,0xee,0x94,0x8a,0x71,0x76,0xfd,0x0e,0x52,0x76,0x90,0x97,0x8c,0xab,0x5c,
+0x50,0xb0,0x7a,0x54,0xa8,0xe0,0xeb,0x45,0x30,0xa2,0xca,0x72,0x7f,0x53,0x2c,0x3f,0x82,0x63,0x13,0x59,0x90,0x1c,0x13,0x02,0xaa,0xa4,0x10,0x44,0x34,0x52,0x1e,0x8b,
+0xc1,0xae,0xf4,0x8e,0xfe,0xf6,0x2b,0xb2,0x6d,0x80,0xff,0x0e,0x62,0x3a,0x0e,0x34,0x4d,0x93,0xd8,0xe2,0x28,0x9e,0xdf,0xb9,0x53,0x98,0x93,0x30,0xeb,0xcd,0xb5,0x30,
+0x09,0x8a,0xe2,0x0d,0xc4,0x1c,0x91,0x76,0xb2,0xa8,0xc4,0x66,0x59,0xf2,0x38,0xf9,0xf0,0xfa,0x15,0x91,0xfa,0xf0,0xde,0x60,0xd4,0xe4,0x93,0xb4,0x4e,0x73,0x9f,0xa4,
+0x47,0x68,0xf9,0x9d,0x49,0x91,0x73,0x60,0xaa,0xff,0x10,0xc6,0x39,0xc1,0x74,0x6f,0x2d,0x6c,0x8d,0xad,0x85,0xdf,0x96,0xd4,0x7f,0x38,0xad,0xb3,0x59,0x87,0xe0,0x27,
+0xa9,0x01,0xf6,0xf8,0x24,0xe5,0xcf,0xf0,0x19,0x08,0x85,0xf2,0x70,0xdd,0x9a,0x3f,0x7f,0xda,0x58,0x64,0x90,0x45,0x8b,0x1d,0x8b,0xc0,0x3c,0x57,0x6a,0x4a,0xc4,0xfa,
+0x1e,0xaf,0xc7,0x50,0x1d,0x4e,0xd1,0xe7,0xe7,0x60,0x96,0xad,0xfb,0xb9,0xb4,0xdd,0x66,0x04,0x34,0x21,0x77,0xfb,0x16,0x20,0x02,0x3d,0x82,0xff,0xd1,0x44,0xa1,0xc9,
+0x8e,0x97,0xa4,0x38,0x9c,0xf6,0x89,0xae,0x2c,0xc3,0x04,0x12,0xe0,0x5a,0x46,0xa9,0xf4,0xa0,0x9c,0xb3,0x24,0xa9,0x8d,0x73,0x3a,0x24,0xd2,0x43,0x09,0x9c,0x05,0x9a,
+0x39,0x5d,0x07,0xaf,0x11,0x8d,0xd5,0x72,0xdf,0x65,0x44,0x29,0xdc,0xfa,0xea,0xc9,0xbe,0x60,0xaa,0xa7,0x27,0x2b,0xf2,0xcd,0x44,0xe7,0x35,0x12,0x2a,0x26,0xbc,0x18,
+0xe2,0xa5,0xc6,0x02,0xe6,0x4c,0x51,0x4c,0xe7,0x24,0xd9,0xfa,0x06,0xca,0x74,0xfe,0x2a,0x2e,0x4a,0x0d,0xa2,0x10,0x3c,0x40,0x96,0xc6,0x71,0x14,0xd1,0x14,0x36,0xb7,
+0x12,0x0b,0x4e,0xee,0x58,0x00,0xb9,0xe8,0x00,0xf5,0xf5,0x86,0x5a,0x9a,0xe6,0xd9,0xe8,0x34,0x1d,0x66,0xd2,0xee,0xb7,0xd6,0x64,0x4d,0xfc,0x62,0x8b,0x98,0xe6,0xf9,
+0x01,0xba,0x75,0x20,0x0d,0xe3,0x48,0x1e,0xcc,0x86,0x6a,0x19,0x8c,0x14,0xf1,0xed,0x77,0x40,0xb0,0xad,0xd9,0x5c,0x3f,0xe2,0x7c,0xd5,0x32,0x94,0x7c,0xf2,0x03,0xb0,
+0x7b,0xc1,0x2e,0xf5,0x73,0x59,0xe1,0x37,0xa6,0x54,0x46,0x16,0xec,0xf2,0x2e,0xa1,0x65,0x83,0x7f,0x8b,0x21,0x03,0x71,0x3b,0xd7,0x2e,0xab,0x27,0xf6,0x75,0x66,0x89,
+0x24,0x43,0x4c,0x65,0xa4,0xcc,0x67,0x74,0xbd,0xea,0x12,0x56,0x5d,0xf6,0x37,0xb4,0x97,0x48,0x0b,0x66,0x1f,0x9c,0xc7,0xad,0xcb,0x0b,0x88,0xd8,0x72,0x70,0x7e,0x79,
+0x81,0x37,0xec,0xb8,0x74,0x18,0x24,0x05,0xe4,0x66,0x88,0xc4,0x2b,0x4c,0x0e,0x40,0xc7,0xc6,0x39,0xf7,0x78,0x80,0xdf,0x19,0xf1,0xe9,0x8a,0xc4,0xad,0x0d,0x4b,0x28,
+0x51,0x09,0x95,0xaf,0xfa,0xd5,0x40,0xb3,0x39,0x38,0xbf,0x42,0xd6,0xe0,0x57,0xf1,0x80,0x5f,0xcc,0xe3,0x88,0xd2,0xbb,0x6a,0xb5,0xd6,0xde,0xd3,0xa8,0x76,0xfd,0x9c,
+0x56,0xbb,0xe6,0x9f,0x26,0xe4,0x3d,0x5d,0xc5,0x03,0x85,0x65,0xaa,0x6a,0x19,0x34,0x8b,0xc0,0x84,0x2b,0xef,0xb9,0x41,0x82,0x62,0x91,0x86,0xf2,0x10,0x5c,0x0e,0xd7,
+0xbd,0xcd,0xb3,0x49,0x5c,0x50,0x59,0xce,0x29,0x24,0xea,0x39,0x9c,0x31,0x28,0x7e,0xe0,0x46,0x87,0x44,0xe0,0x78,0x47,0x4e,0x73,0xa6,0xf0,0x97,0x00,0xfa,0x1d,0x7b,
+0x95,0xb1,0x99,0xc3,0x07,0x2d,0x4b,0x93,0x2c,0x88,0x36,0x3d,0x2a,0x9d,0x83,0x75,0x2b,0x23,0x06,0x88,0x46,0xdc,0xd8,0xb3,0x09,0x0d,0xbc,0x16,0xc2,0x0d,0xfc,0xb1,
+0x98,0x25,0xa5,0x30,0xe7,0x24,0x72,0xc8,0x3b,0x79,0x8b,0xb6,0xb2,0xf3,0x18,0xfa,0x1b,0x82,0xbe,0xb1,0x35,0xa7,0x4a,0xdf,0x3d,0x78,0xfd,0xe4,0xfb,0x38,0x7c,0xf0,
+0x5d,0x77,0x7c,0xdd,0x95,0x2a,0x5a,0xc8,0x6f,0xbf,0x47,0x3a,0xa7,0x1b,0xd2,0x24,0x48,0x47,0xbf,0x47,0x9b,0x8c,0xba,0xec,0xcb,0x1b,0xd3,0x86,0xbc,0x04,0x78,0x2a,
+0x22,0x51,0x41,0x84,0x8a,0x6b,0x57,0x18,0x10,0xeb,0xed,0x53,0xec,0xbc,0x09,0xd7,0x59,0x35,0x8a,0x3f,0x4f,0xf8,0xad,0xba,0xf8,0x16,0x01,0xbe,0x0b,0xcb,0x50,0x9f,
+0xc8,0xea,0xcf,0x33,0x9a,0x2f,0x58,0x0f,0x2f,0x20,0x45,0x74,0x7e,0x82,0x9b,0xc5,0x34,0xb0,0x26,0xb8,0xbd,0x95,0x37,0xc4,0x43,0x5a,0x86,0x63,0x59,0x7a,0x58,0xfc,
+0xf2,0x38,0xba,0x21,0x38,0x8e,0x01,0x35,0xa6,0xa9,0x9c,0x93,0x47,0xb9,0x76,0x59,0x60,0x7a,0x83,0x08,0x0e,0x90,0x8c,0x82,0xed,0xf6,0xe4,0xf0,0xa3,0x02,0x05,0x14,
+0x95,0x1a,0xde,0x70,0x3f,0x68,0x24,0xc2,0xd0,0x90,0xb2,0x86,0xb9,0x24,0x92,0x4c,0x7d,0xd3,0x24,0xb8,0x0e,0x62,0x74,0x1f,0x48,0x14,0x98,0x04,0x71,0xb6,0xfa,0xda,
+0x03,0x44,0xc7,0xe2,0x48,0xb2,0x9c,0xcb,0xd2,0x10,0xfc,0x04,0xff,0x1c,0x02,0x8a,0x73,0xef,0xf4,0x04,0xde,0xaf,0xb1,0x14,0x49,0x6a,0xa2,0xa5,0xf0,0x2b,0xc6,0x80,
+0x06,0xfb,0x16,0x1c,0xc5,0xdf,0xad,0x0f,0x0b,0x2d,0xa9,0xf1,0x54,0xac,0x64,0xfb,0x64,0x40,0xc4,0xaa,0x09,0x88,0x92,0x10,0x54,0xf5,0x8e,0xd8,0x24,0x86,0x90,0x23,
+0x78,0x8c,0x8f,0x5d,0xfc,0xd8,0x09,0xd3,0xc5,0x2c,0x0c,0xa1,0xa4,0xbe,0xcb,0xae,0xe1,0xbd,0xcc,0x17,0xc2,0x2d,0xa3,0x1f,0xc4,0x66,0x84,0xda,0x65,0xb6,0xa1,0xe8,
+0x07,0x0d,0x05,0x35,0x9b,0xe2,0x81,0x10,0xa6,0x66,0x45,0xa4,0x30,0xa1,0xf2,0x7a,0x4e,0xcd,0x69,0xd4,0x2e,0x6f,0xb0,0x62,0x70,0xc2,0xd9,0x34,0x82,0xa2,0xfc,0xb4,
+0x84,0xc4,0xa9,0x41,0x93,0x18,0x0c,0x12,0x5a,0x65,0x89,0xbb,0x92,0xa1,0x24,0x21,0x5a,0x18,0xe7,0x48,0x57,0x14,0x88,0xef,0x12,0xcb,0x32,0xf3,0xbd,0x64,0xb2,0xa4,
+0xf6,0x02,0x0f,0x85,0x5f,0xc6,0x59,0x94,0x7e,0xfd,0xb5,0x71,0x12,0xe4,0xd1,0x35,0x34,0x6c,0x8d,0xd3,0xe7,0x1a,0x24,0x92,0x14,0x3a,0xf5,0x61,0x9c,0x4f,0xe6,0x5f,
+0xff,0x03,0x0a,0x68,0x4c,0x1b,0x97,0x14,0x1b,0x8e,0x46,0x99,0xc1,0xc4,0x97,0x20,0x8f,0xc1,0x99,0x61,0x58,0x03,0x31,0xf3,0x2d,0x78,0x3b,0x59,0x65,0x25,0x3c,0xae,
+0x52,0xd3,0xff,0x1f,0x92,0xaa,0xc4,0x4a,0xe0,0xbb,0x52,0x17,0x1d,0x98,0x39,0x99,0xd4,0x4d,0x54,0xae,0xc5,0x2e,0xfe,0x0b,0x05,0xf7,0x08,0xd5,0x7b,0xb4,0x3c,0xf9,
+0xd7,0x8e,0x7a,0x8f,0x2d,0x9d,0x42,0xd9,0xc9,0x73,0x88,0xfd,0x06,0x32,0x6b,0x14,0x34,0x81,0x67,0x1a,0x69,0x07,0x1c,0x70,0x1b,0xf9,0x5e,0x6e,0x16,0x21,0xf9,0x13,
+0x96,0xcc,0xea,0x2b,0xed,0x23,0xa3,0xd9,0x3c,0x9e,0x40,0x9a,0x8c,0xa7,0x09,0x7d,0x2c,0x07,0x09,0xcd,0xa1,0xc7,0x7b,0xfd,0xf5,0xbf,0x7f,0xfb,0x5f,0x5a,0xd2,0x46,
+0x1a,0x8c,0xf3,0xe0,0xb7,0x7f,0x87,0x12,0x13,0x80,0xb6,0x40,0x3d,0x8d,0xe2,0xeb,0xff,0x40,0xe3,0xdd,0x90,0xf1,0x5b,0xa3,0x02,0xf3,0x79,0xf0,0x05,0x60,0xa8,0xc7,
+0x06,0x9c,0xd5,0xcf,0xf5,0x0b,0xb6,0x27,0x38,0x3a,0x26,0x31,0xb0,0x81,0x09,0x6d,0x9a,0x4d,0x65,0xe5,0x98,0x7d,0x5f,0x94,0x0e,0xf3,0xff,0xfa,0xeb,0xbc,0x12,0xc1,
+0x99,0x2f,0x04,0xf7,0x8a,0xef,0xb1,0xbe,0x29,0xe2,0xdf,0x43,0x7b,0x75,0x0d,0x27,0xe7,0xec,0x5a,0x5b,0x77,0x42,0x39,0xc5,0xea,0x20,0xef,0x7c,0x88,0xfd,0x5e,0x9e,
+0x57,0xce,0x02,0x87,0x3f,0x50,0xff,0x08,0xb0,0x40,0x0b,0x35,0xa3,0x64,0xde,0xdb,0x19,0xff,0x80,0x1e,0xbe,0xd5,0xad,0xce,0x77,0x92,0xc4,0xb7,0xd0,0x5f,0xb1,0xbf,
+0xa6,0x2a,0xe3,0x09,0x3d,0x9b,0x95,0x1b,0x24,0xdc,0x60,0xc8,0x01,0x92,0x78,0x21,0xbe,0xca,0x62,0xbf,0x42,0xf6,0xc4,0x62,0xd8,0xe3,0x38,0x17,0xff,0x88,0x40,0xb3,
+0xa6,0x2c,0x01,0x20,0xfe,0xf6,0x58,0x7f,0xf7,0x01,0x78,0x67,0xb3,0x52,0x16,0x32,0xa0,0xb5,0x08,0xc0,0xcc,0x10,0x81,0x1f,0x99,0x8c,0xa8,0xc1,0xdf,0xd7,0xbe,0x08,
+0x90,0x60,0xfd,0x86,0x67,0xcb,0x00,0x4e,0x62,0x31,0xf6,0xa4,0x15,0xbf,0x5d,0x88,0xaa,0xc3,0x9b,0xc4,0xad,0x86,0x28,0x8d,0x8b,0x31,0x8d,0xce,0x7e,0x04,0xf4,0x27,
+0xbc,0xd9,0xe2,0x8e,0x53,0x3b,0x73,0x18,0xe0,0xe7,0x6f,0xc5,0x29,0xa1,0x11,0x5c,0x95,0xb3,0x20,0x89,0xbf,0x7c,0xfd,0x35,0x8c,0x83,0x75,0x44,0xcd,0xb4,0x4f,0xe9,
+0x1b,0x3a,0x5f,0x4c,0xbf,0xfe,0x67,0x1a,0x5c,0x82,0x6d,0x77,0x23,0x6a,0x5b,0x2e,0xdf,0x1d,0xb4,0xef,0xca,0xf2,0x05,0xfb,0xb9,0x6f,0x52,0xc3,0x73,0x61,0x7d,0x6e,
+0x07,0xfa,0xae,0xff,0xf3,0xe2,0xb3,0x39,0x4b,0xe1,0x8e,0x3e,0x4e,0x99,0xbb,0x60,0x24,0xa9,0x55,0x05,0x52,0xb6,0x8b,0x13,0xe8,0x56,0x57,0x76,0x72,0xe5,0x81,0x20,
+0xdb,0x48,0xc4,0x94,0x7f,0x8d,0xb6,0x42,0xb6,0xe0,0x36,0x0d,0xa9,0x85,0xbc,0x45,0x74,0x8b,0x62,0x20,0x6a,0x01,0x2f,0xb0,0x7f,0x7f,0x08,0xce,0xf1,0x90,0x81,0x79,
+0x0c,0x47,0x15,0x4a,0xbe,0x59,0x0e,0x57,0xcd,0x71,0x50,0x8c,0xe1,0x09,0x20,0xc1,0x33,0x96,0x86,0x6f,0x58,0x79,0x5d,0xfd,0x9d,0x79,0xd0,0x71,0xa4,0x65,0x57,0x50,
+0xf9,0xf6,0x6f,0xe3,0xf0,0x6b,0x7d,0x50,0xce,0x0a,0xec,0xd8,0x70,0xc7,0x58,0x63,0xc4,0x10,0x21,0xa6,0xce,0xfe,0xc0,0x66,0x43,0x01,0xcd,0x9f,0x74,0xf6,0xa3,0x74,
+0x0f,0x3e,0xa2,0xb7,0xaa,0x6a,0x18,0xab,0x24,0xe2,0x3a,0x2d,0x83,0xcd,0x25,0xd9,0x48,0x96,0xde,0xb3,0xd3,0xe3,0xd9,0x87,0x27,0xd0,0xbf,0x15,0x53,0x98,0x81,0xfe,
+0x47,0x0d,0xaa,0x3d,0x87,0xbc,0x9d,0xcb,0xf2,0xc9,0xf3,0xa0,0x0c,0x7a,0xbc,0x55,0xc6,0xa1,0xbf,0xbe,0x7e,0x75,0x52,0x96,0xd3,0x77,0xf4,0x97,0x19,0xf8,0x58,0x2f,
+0xd6,0x32,0x38,0x6a,0xc9,0xd2,0xdb,0xb3,0xf7,0x1f,0x24,0x55,0x62,0xba,0x99,0x31,0x65,0x62,0xec,0x68,0xfc,0x11,0x2b,0xd2,0x0b,0x6c,0xee,0xb0,0x3c,0x51,0x88,0x55,
+0x6e,0x01,0xf4,0x6b,0x49,0x5d,0xf7,0x85,0x39,0xb7,0xe3,0x94,0xf0,0xbf,0xac,0xc3,0x16,0x59,0xce,0x35,0x5c,0x4f,0xa3,0x87,0x39,0x04,0x76,0x19,0x24,0x0f,0x58,0xdc,
+0x61,0xfc,0xc0,0x36,0x31,0xbf,0x6c,0x64,0x64,0x69,0xc5,0x93,0x6c,0xb3,0x04,0x95,0x56,0x9f,0xde,0xf1,0x6f,0x73,0x66,0x25,0x3a,0xdf,0x1f,0x95,0xb4,0xc2,0x7d,0xa6,
+0xd8,0xb3,0x2d,0x50,0xd1,0x34,0x1c,0x43,0x0b,0x41,0xc9,0xd6,0xa9,0x11,0xc4,0xc4,0xac,0xa9,0x5b,0xbc,0x47,0x02,0x42,0x6c,0xe5,0x88,0x8d,0x6d,0x59,0x53,0x39,0xda,
+0x0e,0xda,0x1e,0xd6,0x98,0xc6,0x0e,0x8d,0x8d,0xc9,0x85,0x75,0xd4,0x04,0x99,0x71,0xab,0xa0,0x4d,0x7b,0xf5,0x6b,0x5c,0x91,0x7b,0xb1,0x12,0x7e,0x49,0x16,0xe3,0x20,
+0xc9,0x24,0xe8,0x8a,0xa4,0x56,0xae,0x88,0xf2,0x25,0x18,0x49,0xef,0xe1,0xf4,0x49,0xf3,0xc6,0x1c,0xc8,0xcb,0x38,0xc1,0x28,0x9a,0x67,0xf3,0xaf,0xff,0x6c,0x5c,0x7d,
+0xfd,0xaf,0x08,0xe8,0x2b,0xe9,0x7f,0x50,0x04,0xd4,0x23,0x71,0xca,0xe6,0x35,0x12,0xec,0x88,0x21,0xb9,0x15,0x3b,0xc0,0x18,0x67,0x43,0xe6,0x8f,0xac,0x03,0xc0,0x3f,
+0xa0,0xe3,0xd9,0x83,0xdf,0x92,0x20,0xc0,0xaa,0x1a,0xe2,0xc1,0x81,0xb7,0xa1,0x7b,0x51,0xff,0x85,0xc5,0x3a,0xff,0xb3,0xd1,0xe3,0x9f,0xc4,0xcb,0xe6,0x4f,0x45,0x59,
+0x0e,0xe1,0x2e,0xcb,0x4f,0x0c,0xc2,0xe7,0xdf,0x70,0x4a,0x28,0x6a,0x2c,0x00,0xf9,0x9c,0xe8,0x40,0x97,0x3b,0x42,0xc5,0x41,0x83,0x77,0x54,0x75,0x38,0xab,0x23,0x9e,
+0xbd,0x90,0xdd,0x69,0x0a,0xfe,0xb3,0x2e,0x45,0x12,0x56,0x17,0x51,0xce,0x80,0x09,0x2d,0x7f,0x8a,0xe9,0x35,0xf9,0xbe,0x27,0x86,0xb2,0xf4,0x65,0xb5,0x84,0x7c,0xd9,
+0xdc,0x4f,0xd4,0x43,0xe1,0xf9,0xd9,0x6b,0xd1,0xe5,0xbd,0x62,0x1e,0x28,0xa9,0xeb,0xbb,0xee,0x5f,0x44,0x39,0x02,0x58,0xc8,0x0c,0x4a,0xaa,0x80,0x41,0x6a,0xa0,0x84,
+0x12,0xd6,0x59,0x98,0xd4,0xb2,0x72,0xef,0x97,0x03,0xc2,0xc3,0x24,0x86,0xac,0xac,0x6e,0xff,0xa1,0x56,0xa2,0x41,0x5f,0x85,0x54,0xcf,0xf9,0x9f,0x24,0xcb,0x6b,0xa9,
+0x1a,0xa3,0x86,0x5a,0xad,0xf4,0xd6,0x7c,0xef,0xe6,0xc9,0xcf,0x90,0x14,0xf7,0x42,0x6b,0x2c,0xd1,0x28,0xdb,0xca,0x6e,0x36,0xb7,0xdf,0xb4,0x61,0x7d,0x08,0x52,0xab,
+0xb2,0xdc,0x88,0xdd,0x6d,0xb3,0x0e,0x57,0x18,0x36,0xb5,0x5d,0x36,0x6a,0x32,0xd4,0x7d,0x11,0xbb,0x03,0xfc,0x58,0xc1,0x5d,0xa3,0x4a,0x9e,0x54,0x44,0x47,0xd6,0x00,
+0x37,0x88,0xa3,0xdd,0xa6,0xae,0x31,0x84,0xf6,0x4a,0x24,0x24,0xd0,0xb8,0xe8,0x98,0xde,0x42,0x9f,0x50,0x54,0x44,0x8d,0x60,0xbd,0x30,0x9f,0xb0,0x06,0x97,0x71,0x80,
+0x37,0x68,0xdd,0xb1,0xee,0xad,0xd8,0x41,0x90,0x5d,0xfa,0x1c,0xfd,0x1f,0xae,0x4f,0xfb,0xf8,0xf6,0x2e,0x00,0x00
+};
+const size_t WM_PK_OTA_JS_GZ_LEN = 5014;
+#else
+const uint8_t WM_PK_OTA_JS_GZ[] PROGMEM = { 0 };
+const size_t WM_PK_OTA_JS_GZ_LEN = 0;
+#endif
+const uint8_t WM_PK_MODULE_POLYFILL_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x65,0x52,0x4d,0x6f,0xdc,0x20,0x14,0xbc,0xfb,0x57,0x38,0x17,0x03,0x92,0x83,0x72,0x5e,0x8b,0x46,0x3d,0xf4,0x50,
+0x35,0xdd,0x54,0xea,0xb1,0xe9,0x81,0x3c,0x1e,0xbb,0xa8,0x18,0x5c,0x3e,0x5a,0xad,0x2c,0xff,0xf7,0x42,0xdc,0x75,0x76,0x93,0x1b,0x83,0x67,0x98,0x37,0xf3,0x4c,0x75,
+0x76,0x90,0x8c,0x77,0x94,0xcd,0xe0,0x5d,0x4c,0xad,0x16,0xca,0x43,0x1e,0xd1,0x25,0x0e,0x01,0x65,0xc2,0x4f,0x16,0x2b,0xa2,0xc4,0x1a,0xf7,0x8b,0x30,0x1e,0xd0,0x3e,
+0x98,0x98,0x06,0xa3,0xa9,0xee,0x3a,0xcd,0x63,0x9e,0x26,0x1f,0x52,0xbc,0x3c,0x53,0x32,0x7a,0x95,0x2d,0x4e,0x85,0xec,0xa5,0x22,0x8c,0x35,0x01,0x53,0x0e,0x6e,0xd0,
+0x3e,0xd0,0xd5,0x48,0xb6,0x5e,0xb7,0x9b,0xd7,0xef,0x8c,0xe1,0xf4,0x1d,0x2d,0x42,0xf2,0xe1,0xa3,0xb5,0xab,0xdd,0x8f,0xa2,0x17,0x4f,0xd7,0x8f,0x3d,0x91,0x9f,0xe5,
+0x3d,0x45,0x25,0x1b,0x1c,0xfe,0x6d,0xbf,0xe6,0x24,0x6b,0x80,0xc7,0xe7,0x88,0xe1,0x0f,0x06,0x2a,0xc5,0x87,0xf9,0xd5,0x05,0xaa,0x8b,0x64,0x4d,0x99,0x16,0x78,0x3a,
+0x4d,0x28,0x84,0x20,0x70,0x34,0x56,0xd5,0x10,0x84,0x35,0xaf,0x54,0x53,0xa9,0xc0,0xa5,0x52,0xa8,0xf6,0x5e,0x61,0x2c,0x2a,0x9e,0xe4,0x61,0x2f,0xc7,0x17,0xd5,0xc3,
+0xe7,0xfd,0x17,0xd2,0x75,0xa6,0x36,0x50,0xf1,0x75,0xc4,0xae,0x53,0xd4,0xb0,0x85,0x71,0xbf,0x0e,0x42,0xcf,0xd1,0xfa,0x79,0xb3,0xdb,0xdd,0xdc,0xf5,0x31,0x3f,0xa7,
+0x80,0x58,0x8e,0x0b,0x1b,0xce,0xed,0xb7,0xb1,0xc4,0xf9,0xbf,0x00,0x10,0xf3,0x32,0xac,0x6d,0xb5,0x92,0x1b,0x97,0xf0,0x10,0x4c,0x3a,0x75,0x5d,0x09,0xb0,0x21,0x71,
+0xf1,0x85,0xf5,0xb2,0x8c,0xa4,0x31,0x04,0x0c,0xdf,0xbc,0x35,0xb0,0x72,0xaf,0xaf,0xc4,0x5b,0x4e,0x55,0x41,0xf0,0x31,0x3e,0x06,0x73,0x30,0xae,0x06,0xca,0x11,0x6f,
+0xcb,0xce,0x55,0x19,0xda,0x48,0x1b,0xc9,0x3d,0xf0,0x0b,0x28,0x88,0x71,0x60,0xb3,0x42,0xb2,0x7b,0xa7,0x94,0xce,0xbb,0xd3,0xe8,0xf3,0x7b,0x8d,0x1f,0x4d,0x22,0xbb,
+0x37,0x97,0xb1,0x34,0x7a,0xeb,0x5f,0xd4,0xa4,0x87,0xa5,0xd9,0x6a,0xa8,0x5b,0x9d,0xcb,0xaa,0x24,0xc7,0x69,0xfb,0x65,0x2a,0x10,0x37,0x77,0xc3,0xb9,0x9e,0xda,0xd5,
+0xa0,0x31,0xc1,0xb1,0xf0,0x8e,0x25,0x55,0x0f,0x6c,0x59,0x18,0x65,0x43,0xf3,0x0f,0x85,0xdb,0x4a,0x72,0xcf,0x02,0x00,0x00
+};
+const size_t WM_PK_MODULE_POLYFILL_JS_GZ_LEN = 408;
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_RESTART_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x55,0x6d,0x8f,0x9b,0x38,0x10,0xfe,0xbe,0xbf,0x82,0xaa,0x3a,0x39,0xa8,0x81,0x05,0xaa,0x6c,0xb2,0xb0,0xb4,
+0xa7,0xee,0x9d,0x74,0x95,0xda,0xfd,0x50,0xdd,0x97,0x4a,0x2b,0x9d,0x1c,0x3c,0x10,0xdf,0x82,0x8d,0x6c,0xe7,0xad,0x28,0xff,0xfd,0x06,0x30,0x59,0x92,0x36,0xdb,0xea,
+0x76,0x25,0x02,0xf6,0xcc,0x33,0xcf,0xcc,0x3c,0x1e,0x6f,0xa8,0x72,0xfe,0xa9,0x24,0xa3,0xe5,0xbd,0xd6,0x29,0xf1,0xbb,0x57,0x4f,0x6e,0x40,0x95,0x74,0xdf,0xd4,0x52,
+0x73,0xc3,0xa5,0x88,0x73,0xbe,0x03,0x96,0x70,0xa1,0xc1,0xc4,0x41,0xb2,0xa4,0xd9,0x53,0xa1,0xe4,0x5a,0xb0,0x58,0x15,0x4b,0x3a,0x09,0xa6,0xdd,0xbf,0x3f,0x9b,0xb9,
+0x09,0xe3,0xba,0x46,0xd7,0x38,0x2f,0x61,0x97,0xd0,0x92,0x17,0xc2,0xe3,0x06,0x2a,0x1d,0x67,0x20,0x0c,0xa8,0xe4,0xdf,0xb5,0x36,0x3c,0xdf,0x7b,0x99,0xc4,0x4f,0x61,
+0x86,0xe5,0x6f,0x1e,0x17,0x0c,0x76,0xf1,0x2d,0xfe,0x1d,0xc8,0x9b,0xab,0x81,0xc9,0x52,0xee,0x9a,0x51,0xb8,0xd7,0x79,0x9e,0x27,0x4b,0xa9,0x18,0x28,0x4f,0x51,0xc6,
+0xd7,0x3a,0xf6,0xe7,0x33,0x05,0x15,0x2e,0xee,0x3c,0xbd,0xa2,0x4c,0x6e,0xe3,0xc0,0x59,0xd4,0x3b,0xe7,0x6d,0x84,0x8f,0x11,0x3d,0x3f,0x5a,0xb8,0x49,0x4d,0x19,0xe3,
+0xa2,0x88,0x23,0xbf,0x75,0x72,0xa2,0xd6,0xd3,0xc0,0xce,0x78,0x1d,0xd3,0x81,0x4c,0xc5,0x85,0xb7,0xe5,0xcc,0xac,0xe2,0x28,0x0a,0xea,0x5d,0xcf,0x47,0xd7,0x5c,0x08,
+0x50,0x4d,0xbf,0x31,0x43,0xf4,0x64,0x05,0xbc,0x58,0x99,0xfe,0xbd,0x27,0x15,0xcf,0x30,0xa8,0x96,0x25,0x67,0x7d,0xe8,0x68,0x36,0x0d,0xc3,0xc5,0x34,0x0a,0x31,0x7e,
+0x88,0xd5,0xb1,0xd4,0x8d,0xac,0xb1,0x00,0xa5,0x54,0xf1,0xeb,0xf0,0x76,0x7e,0xc3,0xa2,0xb3,0x9c,0x66,0xc1,0x6f,0x09,0x15,0xbc,0xa2,0x5d,0xf1,0xdb,0xc8,0x8e,0xbf,
+0xd0,0x4e,0xc9,0x05,0x60,0xbf,0xb8,0xc8,0xb9,0xc0,0xa2,0x26,0x15,0x55,0x05,0x17,0x98,0x2f,0x5d,0x1b,0xe9,0x84,0x7e,0xd4,0x26,0xd5,0xb1,0xfd,0xfd,0x09,0xf6,0xb9,
+0xa2,0x15,0x68,0xa7,0xf5,0x6e,0x8c,0x6c,0x8c,0xa2,0x42,0xe7,0x52,0x55,0xb1,0x92,0x86,0x1a,0x98,0xbc,0xbd,0x09,0x18,0x14,0xee,0x61,0x5c,0xee,0x4a,0x17,0x8d,0x25,
+0x36,0x0f,0x17,0xf3,0xdb,0xc8,0xc6,0xc0,0x3e,0x18,0x23,0xab,0xa1,0xd8,0x39,0x36,0xcf,0xd3,0xfc,0x1b,0xc4,0xa1,0x1f,0x74,0x2b,0xdb,0x15,0x12,0xf2,0x74,0x4d,0x33,
+0x88,0x6b,0x05,0x5e,0x4b,0x75,0x0c,0x9c,0x09,0xd3,0x3c,0x7b,0xf5,0xe5,0xef,0x61,0xb6,0x7d,0x11,0xe7,0x41,0x90,0x9c,0x94,0xe4,0x44,0x05,0x46,0x78,0x4a,0x6e,0x9b,
+0x13,0x71,0x15,0xb4,0x1e,0xf8,0x5c,0x10,0x95,0xe5,0x8e,0xd5,0x8e,0xc7,0xc5,0x79,0x06,0x6d,0x06,0x3d,0xf8,0x37,0xad,0x1c,0x42,0xdf,0x4a,0xa9,0x6b,0xa5,0x90,0x02,
+0xce,0xb5,0x76,0x9e,0xfd,0x79,0x16,0x37,0x6d,0x16,0x6b,0xa5,0x31,0x8d,0x5a,0xf2,0x96,0xc4,0x79,0x1a,0x7b,0xd0,0x27,0x82,0xb6,0xfd,0xb7,0xa9,0xa3,0xbc,0xcf,0x1d,
+0x84,0x1c,0xdb,0x77,0x5d,0xac,0xa9,0xc2,0x04,0x93,0xd3,0x46,0x59,0xd6,0x7e,0xd8,0x25,0x7a,0x49,0x84,0x91,0x7b,0x20,0x49,0xbe,0x16,0x59,0xab,0x2c,0x07,0x84,0x5e,
+0x2b,0xf8,0x6c,0x8f,0xff,0xc4,0x6d,0x78,0x3e,0x79,0xc5,0x64,0xb6,0xae,0x10,0xdf,0x2f,0xc0,0xfc,0x59,0x42,0xfb,0xfa,0x61,0xff,0x91,0x4d,0x88,0x1a,0x0c,0x89,0xeb,
+0x36,0x1b,0x14,0xa2,0x4e,0x8f,0xb6,0x99,0x02,0xd4,0x94,0x35,0x9f,0x10,0x6d,0xf6,0x25,0x10,0x37,0xd1,0x3e,0x67,0xe9,0xc8,0x11,0x17,0xda,0xe3,0x76,0xdf,0xf7,0x29,
+0x3d,0x4e,0x9e,0xe4,0x08,0xb4,0x02,0xca,0x7c,0x5a,0xd7,0x20,0xd8,0xfd,0x8a,0x97,0x6c,0xa2,0xdd,0xe4,0x70,0xb8,0x82,0x5d,0x2d,0x95,0x71,0x8e,0xcc,0xf5,0x4a,0x6e,
+0x11,0x25,0xe7,0xaa,0xea,0xc0,0x27,0x52,0xd8,0x4f,0xb7,0x39,0xcf,0x2a,0x69,0xb9,0xda,0x91,0x76,0x91,0x31,0xe3,0x1b,0xe4,0x6b,0xad,0xfc,0xac,0xa4,0x5a,0x3f,0xe0,
+0xf9,0x49,0xc9,0xc9,0x44,0x24,0x47,0x8b,0x6e,0x18,0xfc,0xf5,0xf7,0xe7,0x4f,0x29,0xb9,0x43,0x5f,0xa7,0xf3,0x48,0x1f,0xc9,0x71,0x6c,0x3d,0x92,0x77,0x6d,0x27,0xef,
+0xea,0xb3,0x2d,0x3c,0x62,0xdd,0x16,0xf9,0x43,0x3a,0x7b,0xb9,0x76,0xb6,0x54,0x18,0x07,0x8f,0xaf,0x02,0x6d,0x28,0xa6,0x68,0x56,0xe0,0x30,0xd8,0xf0,0x0c,0xde,0xa3,
+0xd1,0xdd,0x75,0xdd,0xc3,0xfc,0x20,0x46,0x7f,0x28,0x86,0x38,0xcb,0x35,0x9e,0x50,0xf1,0xbd,0x8d,0x73,0xa2,0xbd,0x47,0xe2,0x60,0x47,0x70,0xfb,0x83,0x11,0x5f,0x7b,
+0x1e,0x5f,0x41,0x77,0x81,0x7a,0x80,0x5f,0x06,0x13,0x72,0x8c,0xf5,0xd0,0x63,0x3d,0xc8,0xef,0xa0,0xae,0x91,0xf9,0xbb,0xfe,0x49,0x9e,0xdb,0xbc,0x94,0x6c,0x7f,0xd2,
+0x66,0x5b,0x57,0x37,0xb9,0x28,0xbf,0x8e,0x32,0x71,0x7d,0x29,0xb2,0x92,0x67,0x4f,0xe9,0xa0,0x05,0x94,0xed,0x29,0x2c,0xca,0x1f,0xd1,0xce,0x60,0x8f,0xfa,0x40,0x3d,
+0x1c,0x5e,0x0e,0xf2,0xf0,0xbf,0x83,0x1c,0x92,0x1f,0x2b,0xf5,0x4b,0xdf,0xdb,0x5e,0xa9,0x1a,0x70,0x4c,0x31,0x3d,0xc5,0xe1,0xac,0x69,0x01,0x17,0xf4,0x8a,0x32,0x49,
+0x27,0xd6,0xe4,0x55,0x9a,0xe2,0xd9,0x07,0x9c,0xfa,0xc0,0xdc,0xf7,0x76,0x31,0x26,0x16,0x15,0xef,0x03,0xa7,0x56,0xb2,0x40,0x01,0x69,0xdf,0xf7,0x49,0xe7,0x8e,0xe5,
+0xfe,0x89,0xd4,0xf1,0xf9,0x82,0xcc,0xdb,0xdd,0x5f,0x96,0xf8,0x78,0xd3,0x5e,0x93,0xb8,0x65,0x7b,0xfe,0xd2,0x19,0xc0,0xdf,0x17,0x25,0x8e,0xb7,0xc6,0x20,0x32,0x75,
+0xdf,0xbe,0xa3,0xa1,0x2d,0xdf,0x1b,0x32,0xc2,0xff,0xa9,0xba,0x70,0xbf,0x2f,0xab,0x48,0xad,0x7f,0xf7,0x65,0xf0,0xcb,0x7c,0x6c,0xc7,0xf4,0x06,0x1b,0x33,0xea,0xb5,
+0xf0,0xbc,0xce,0x00,0xca,0xf4,0xf2,0x38,0x44,0x46,0x58,0x47,0x1c,0x99,0x50,0xba,0x50,0x9e,0x0c,0x36,0xd1,0x2e,0x8b,0xbb,0x34,0x70,0x9b,0xac,0xc4,0x3b,0xfb,0x18,
+0xc3,0xb8,0x49,0x29,0xb3,0xee,0x5e,0xf7,0x57,0x0a,0xf2,0x94,0x5c,0x13,0x9c,0x6f,0xd3,0x30,0x08,0x02,0xd4,0xcf,0xd5,0x7f,0x07,0xe6,0x8c,0x4d,0x90,0x09,0x00,0x00
+};
+const size_t WM_PK_RESTART_JS_GZ_LEN = 1024;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_RESTART_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x55,0xcd,0x6e,0xdc,0x36,0x10,0xbe,0xfb,0x29,0x14,0x04,0x05,0x57,0x88,0x25,0x4b,0x0a,0xd6,0x6b,0x4b,0x56,
+0x52,0xc4,0x08,0xd0,0x00,0x8d,0x0f,0x41,0x2f,0x05,0x0c,0x14,0x5c,0x71,0x24,0xb1,0x96,0x48,0x81,0xe4,0xfe,0x59,0xd8,0x43,0x1f,0xa5,0x87,0x3c,0x49,0x90,0xf7,0xea,
+0x48,0xe2,0xae,0xb5,0x9b,0xac,0x13,0xd4,0x06,0xb4,0x12,0x39,0xf3,0xcd,0x37,0x33,0x1f,0x87,0x4b,0xaa,0x9c,0xbf,0x6a,0xc9,0x68,0x75,0xab,0x75,0x4a,0xfc,0xfe,0xd5,
+0x93,0x4b,0x50,0x15,0xdd,0xb4,0x8d,0xd4,0xdc,0x70,0x29,0xe2,0x9c,0xaf,0x81,0x25,0x5c,0x68,0x30,0x71,0x90,0xcc,0x69,0xf6,0x50,0x28,0xb9,0x10,0x2c,0x56,0xc5,0x9c,
+0x4e,0x82,0xf3,0xfe,0xdf,0x9f,0x4e,0xdd,0x84,0x71,0xdd,0xa0,0x6b,0x9c,0x57,0xb0,0x4e,0x68,0xc5,0x0b,0xe1,0x71,0x03,0xb5,0x8e,0x33,0x10,0x06,0x54,0xf2,0xf7,0x42,
+0x1b,0x9e,0x6f,0xbc,0x4c,0xe2,0xa7,0x30,0xbb,0xe5,0x47,0x8f,0x0b,0x06,0xeb,0xf8,0x1a,0xff,0xb6,0xe4,0xd5,0xd9,0x8e,0xc9,0x5c,0xae,0xdb,0x51,0xb8,0x97,0x79,0x9e,
+0x27,0x73,0xa9,0x18,0x28,0x4f,0x51,0xc6,0x17,0x3a,0xf6,0x67,0x53,0x05,0x35,0x2e,0xae,0x3d,0x5d,0x52,0x26,0x57,0x71,0xe0,0x5c,0x35,0x6b,0xe7,0x75,0x84,0x8f,0x11,
+0x3d,0x3f,0xba,0x72,0x93,0x86,0x32,0xc6,0x45,0x11,0x47,0x7e,0xe7,0xe4,0x44,0x9d,0xa7,0x81,0xb5,0xf1,0x7a,0xa6,0x3b,0x32,0x35,0x17,0xde,0x8a,0x33,0x53,0xc6,0x51,
+0x14,0x34,0xeb,0x81,0x8f,0x6e,0xb8,0x10,0xa0,0xda,0x61,0x63,0x8a,0xe8,0x49,0x09,0xbc,0x28,0xcd,0xf0,0x3e,0x90,0x8a,0xa7,0x18,0x54,0xcb,0x8a,0xb3,0x21,0x74,0x34,
+0x3d,0x0f,0xc3,0xab,0xf3,0x28,0xc4,0xf8,0x21,0x56,0xc7,0x52,0x37,0xb2,0xc1,0x02,0x54,0x52,0xc5,0x2f,0xc3,0xeb,0xd9,0x25,0x8b,0x8e,0x72,0x9a,0x06,0xbf,0x24,0x54,
+0xf0,0x9a,0xf6,0xc5,0xef,0x22,0x3b,0xfe,0x95,0x76,0x2a,0x2e,0x00,0xfb,0xc5,0x45,0xce,0x05,0x16,0x35,0xa9,0xa9,0x2a,0xb8,0xc0,0x7c,0xe9,0xc2,0x48,0x27,0xf4,0xa3,
+0x2e,0xa9,0x9e,0xed,0xaf,0x0f,0xb0,0xc9,0x15,0xad,0x41,0x3b,0x9d,0x77,0x6b,0x64,0x6b,0x14,0x15,0x3a,0x97,0xaa,0x8e,0x95,0x34,0xd4,0xc0,0xe4,0xf5,0x65,0xc0,0xa0,
+0x70,0xb7,0xe3,0x72,0xd7,0xba,0x68,0x2d,0xb1,0x59,0x78,0x35,0xbb,0x8e,0x6c,0x0c,0xec,0x83,0x31,0xb2,0xde,0x15,0x3b,0xc7,0xe6,0x79,0x9a,0x3f,0x42,0x1c,0xfa,0x41,
+0xbf,0xb2,0x2a,0x91,0x90,0xa7,0x1b,0x9a,0x41,0xdc,0x28,0xf0,0x3a,0xaa,0x63,0xe0,0x4c,0x98,0xf6,0xc9,0x6b,0x28,0xff,0x00,0xb3,0x1a,0x8a,0x38,0x0b,0x82,0xe4,0xa0,
+0x24,0x07,0x2a,0x30,0xc2,0x53,0x72,0xd5,0x1e,0x88,0xab,0xa0,0xcd,0x8e,0xcf,0x09,0x51,0x59,0xee,0x58,0xed,0x78,0x5c,0x9c,0x27,0xd0,0x76,0xa7,0x07,0xff,0xb2,0x93,
+0x43,0xe8,0x5b,0x29,0xf5,0xad,0x14,0x52,0xc0,0xb1,0xd6,0x8e,0xb3,0x3f,0xce,0xe2,0xb2,0xcb,0x62,0xa1,0x34,0xa6,0xd1,0x48,0xde,0x91,0x38,0x4e,0x63,0x03,0xfa,0x40,
+0xd0,0xb6,0xff,0x36,0x75,0x94,0xf7,0xb1,0x83,0x90,0x63,0xfb,0xbe,0x8b,0x0d,0x55,0x98,0x60,0x72,0xd8,0x28,0xcb,0xda,0x0f,0xfb,0x44,0x4f,0x89,0x30,0x72,0xb7,0x24,
+0xc9,0x17,0x22,0xeb,0x94,0xe5,0x80,0xd0,0x0b,0x05,0x1f,0xed,0xf1,0x9f,0xb8,0x2d,0xcf,0x27,0x2f,0x98,0xcc,0x16,0x35,0xe2,0xfb,0x05,0x98,0xf7,0x15,0x74,0xaf,0xef,
+0x36,0x1f,0xd8,0x84,0xa8,0x9d,0x21,0x71,0xdd,0x76,0x89,0x42,0xd4,0xe9,0xde,0x36,0x53,0x80,0x9a,0xb2,0xe6,0x13,0xa2,0xcd,0xa6,0x02,0xe2,0x26,0xda,0xe7,0x2c,0x1d,
+0x39,0xe2,0x42,0x77,0xdc,0x6e,0x87,0x3e,0xa5,0xfb,0xc9,0x93,0xec,0x81,0x4a,0xa0,0xcc,0xa7,0x4d,0x03,0x82,0xdd,0x96,0xbc,0x62,0x13,0xed,0x26,0xdb,0xed,0x19,0xac,
+0x1b,0xa9,0x8c,0xb3,0x67,0xae,0x4b,0xb9,0x42,0x94,0x9c,0xab,0xba,0x07,0x9f,0x48,0x61,0x3f,0xdd,0xf6,0x38,0xab,0xa4,0xe3,0x6a,0x47,0xda,0x49,0xc6,0x8c,0x2f,0x91,
+0xaf,0xb5,0xf2,0xb3,0x8a,0x6a,0x7d,0x87,0xe7,0x27,0x25,0x07,0x13,0x91,0xec,0x2d,0xfa,0x61,0xf0,0xdb,0x1f,0x1f,0x7f,0x4f,0xc9,0x0d,0xfa,0x3a,0xbd,0x47,0x7a,0x4f,
+0xf6,0x63,0xeb,0x9e,0xbc,0xe9,0x3a,0x79,0xd3,0x1c,0x6d,0xe1,0x11,0xeb,0xb7,0xc8,0x6d,0x99,0x81,0x01,0x47,0xc1,0xd7,0x7f,0x0d,0x55,0x46,0x2e,0xe9,0xd7,0xcf,0xce,
+0x23,0x55,0x9c,0x32,0x10,0x1c,0xde,0xa2,0xc9,0xcd,0x45,0x33,0x80,0x7c,0x27,0xc2,0x70,0x24,0x76,0x51,0xe6,0x0b,0x3c,0x9f,0xe2,0x5b,0x1b,0xe7,0x40,0x79,0xf7,0xc4,
+0xc1,0x7e,0xe0,0xf6,0x3b,0x23,0xfe,0x1c,0x58,0x7c,0xf9,0x47,0xc8,0x3e,0xd2,0x80,0xf0,0xd3,0x68,0x42,0x8e,0xc1,0xee,0x06,0xb0,0x3b,0x0e,0xdf,0x60,0x5d,0x20,0xf7,
+0x37,0xc3,0x93,0x3c,0xb5,0x79,0x2e,0xd9,0xe6,0xa0,0xcd,0xb6,0xae,0x6e,0x72,0x52,0x7e,0x3d,0x69,0xe2,0xfa,0x52,0x64,0x15,0xcf,0x1e,0xd2,0x9d,0x16,0x50,0xb6,0x87,
+0xb0,0x28,0x7f,0x44,0x3b,0x82,0xdd,0xeb,0x03,0xf5,0xb0,0x7d,0x3e,0xc8,0xdd,0xff,0x0e,0xb2,0x4d,0xbe,0xaf,0xd4,0x4f,0xa0,0xbb,0x16,0x0f,0x4a,0xd5,0x80,0x63,0x8a,
+0xe9,0x73,0x1c,0xce,0x9a,0x16,0x70,0x42,0xaf,0x28,0x93,0x74,0x62,0x4d,0x5e,0xa4,0x29,0x9e,0x7d,0xc0,0xa9,0x0f,0xcc,0x7d,0x6b,0x17,0x63,0xf2,0xc9,0x2a,0xc7,0xc1,
+0x81,0x3b,0xe7,0x50,0x52,0xdf,0xf7,0x49,0xef,0x8c,0xc5,0xfe,0x81,0xd0,0xf1,0xf9,0x8c,0xc8,0xbb,0xdd,0x9f,0x16,0xf8,0x78,0xd3,0x5e,0x92,0xb8,0x65,0x3b,0xfe,0xdc,
+0x09,0xc0,0xdf,0x67,0x25,0x8e,0x77,0xc6,0x4e,0x63,0xea,0xb6,0x7b,0x47,0x43,0x5b,0xbc,0x57,0x64,0x84,0xff,0x43,0x6d,0xe1,0xfe,0x50,0x54,0x91,0x5a,0xff,0xfe,0xcb,
+0xe0,0x97,0xf9,0xd0,0x0d,0xe9,0x25,0xb6,0x65,0xd4,0x69,0xe1,0x79,0xbd,0x01,0x54,0xe9,0xe9,0x61,0x88,0x8c,0xb0,0x8e,0x38,0x30,0xa1,0x72,0xa1,0x3a,0x18,0x6b,0xa2,
+0x5b,0x16,0x37,0x69,0xe0,0xb6,0x59,0x85,0x37,0xf6,0x3e,0x86,0x71,0x93,0x4a,0x66,0xfd,0xad,0xee,0x97,0x0a,0xf2,0x94,0x5c,0x10,0x9c,0x6e,0xe7,0x61,0x10,0x04,0xa8,
+0x9e,0xb3,0xff,0x00,0xb2,0x67,0xd5,0xd4,0x8e,0x09,0x00,0x00
+};
+const size_t WM_PK_RESTART_JS_GZ_LEN = 1036;
+#else
+const uint8_t WM_PK_RESTART_JS_GZ[] PROGMEM = { 0 };
+const size_t WM_PK_RESTART_JS_GZ_LEN = 0;
+#endif
+const uint8_t WM_PK_HW_STATUS_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x65,0x52,0xdf,0x8f,0xd3,0x30,0x0c,0x7e,0xef,0x5f,0x31,0x84,0x84,0x53,0xf5,0xda,0xdb,0x1d,0x2f,0xe8,0xb2,0x14,
+0x1d,0x30,0x89,0x49,0x3b,0x90,0xd0,0x89,0x17,0xc6,0x43,0x68,0xdc,0x35,0xa8,0x4b,0x21,0x71,0x77,0x37,0x6d,0xfb,0xdf,0x71,0xba,0x1f,0x1a,0x10,0x55,0x89,0xe3,0x7e,
+0xfe,0xfc,0xc5,0xb6,0xa8,0x7b,0x57,0x91,0xed,0x9c,0x48,0xb7,0x6b,0xed,0x47,0xb3,0x4f,0x8f,0xd3,0x2f,0x5f,0xef,0xe7,0xea,0x66,0xcc,0x4b,0x9e,0xfe,0x8e,0x3c,0xd6,
+0x1e,0x43,0xc3,0xa8,0x1a,0xa9,0x6a,0x04,0x5c,0x87,0xdf,0x6f,0xcd,0xb3,0x6a,0x9e,0x02,0x69,0xea,0x03,0xa4,0x49,0x41,0x0d,0x3a,0x71,0xe6,0xf3,0xe9,0xd6,0x23,0xf5,
+0x9e,0x63,0x8b,0x9f,0x21,0x26,0x90,0xfb,0xff,0x40,0x46,0x93,0x3e,0x24,0xa6,0x1f,0x9d,0xd9,0x28,0xd3,0x55,0xfd,0x0a,0x1d,0x15,0x4b,0xa4,0x69,0x8b,0xd1,0x7c,0xb7,
+0x99,0x19,0x01,0xcd,0x53,0x1e,0x28,0x8f,0x18,0x48,0xa5,0xad,0xc5,0x8b,0x01,0x9f,0x1e,0x32,0x0c,0x8e,0x7b,0xef,0xf5,0xa6,0xb0,0x61,0x38,0x0f,0xc4,0xbb,0x5d,0x3c,
+0x8a,0x16,0xdd,0x92,0x1a,0xa5,0xd4,0x38,0xdd,0x0e,0x61,0x85,0x75,0x0e,0xfd,0xc7,0xc7,0x87,0xb9,0x82,0x09,0xf9,0x72,0x42,0x66,0x54,0x75,0x6d,0xf8,0xa5,0x9d,0x5a,
+0xc0,0xeb,0x05,0x8c,0x02,0x6d,0x5a,0x64,0x9b,0xf0,0x99,0x72,0xdd,0xda,0xa5,0xbb,0xab,0x58,0x0b,0x7a,0xc9,0xb8,0xce,0xdf,0xb1,0x62,0x91,0xe7,0xab,0x9e,0xd0,0xa4,
+0x0b,0x28,0x5f,0xbd,0x7c,0x73,0x7b,0x73,0x2b,0x27,0xd7,0x64,0x4a,0xde,0x7c,0x09,0xf2,0xa8,0x6c,0x9f,0xc4,0xc7,0x35,0x0a,0x40,0xd6,0x9d,0x17,0xf1,0x62,0xd5,0x58,
+0xda,0xc9,0x85,0x32,0x69,0xb3,0x2c,0xdd,0x36,0xd9,0x59,0x4c,0x09,0xd9,0xf0,0x80,0x6f,0xf6,0x7b,0xe1,0xf4,0x0a,0x77,0x3b,0x80,0x34,0x83,0x81,0x1e,0x12,0x36,0xa2,
+0xde,0x56,0x87,0xc0,0x0a,0x03,0xad,0x75,0xcb,0x12,0x20,0x3b,0x45,0xf0,0xbd,0xc7,0xbf,0xd1,0x97,0x84,0xbd,0xb3,0x74,0x49,0x78,0xd4,0xbb,0x4f,0xfe,0x2d,0x4d,0x33,
+0xf4,0xab,0xd2,0xb1,0xdd,0x17,0x53,0xb2,0xe7,0x3e,0x26,0xe7,0x3e,0x69,0x63,0xa6,0x6b,0x36,0xe6,0x36,0x10,0x72,0xa4,0x80,0x0f,0x9f,0x1f,0xde,0x77,0x5c,0x2a,0xf6,
+0x75,0xda,0xa0,0x81,0xab,0x8b,0xe0,0xf3,0x18,0xc9,0x80,0x34,0x8b,0x05,0x65,0xb5,0xe2,0xe8,0xbd,0x3a,0x0d,0x5f,0x9c,0x14,0xfe,0x18,0x95,0xfc,0x01,0xd7,0xb7,0x6e,
+0xfc,0xa0,0x02,0x00,0x00
+};
+const size_t WM_PK_HW_STATUS_JS_GZ_LEN = 421;
+const uint8_t WM_PK_JSTZ_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x8d,0x57,0x6d,0x4f,0xe3,0x38,0x10,0xfe,0x7e,0xbf,0x82,0xfd,0x42,0x5a,0x91,0x96,0xb4,0xa5,0x2d,0x94,0xed,0x21,
+0xde,0x16,0x76,0x17,0x76,0xd1,0xc1,0xed,0x69,0xaf,0x8a,0x22,0xd3,0xb8,0x8d,0xb7,0xa9,0xcd,0xd9,0x0e,0xaf,0xea,0x7f,0xbf,0x71,0x12,0x27,0x4e,0x62,0xa4,0x15,0x12,
+0x6a,0xe7,0xcd,0x33,0xe3,0xf1,0xf3,0x4c,0x5b,0x8b,0x84,0xce,0x25,0x61,0xb4,0x85,0xdb,0x6f,0x8f,0x88,0x6f,0xc9,0x69,0x21,0x69,0xbf,0x39,0x89,0xc0,0x5b,0x42,0x72,
+0x32,0x97,0xce,0xa1,0xd2,0xe2,0xa9,0x23,0x1c,0x97,0x4e,0x9b,0x5e,0x1d,0xdc,0x5d,0x62,0x79,0x47,0xd6,0xf8,0x95,0x51,0xfc,0x7d,0xb1,0x10,0x58,0xb6,0xda,0x87,0x1c,
+0xcb,0x84,0xd3,0x2d,0xf9,0x61,0x3a,0xa5,0x49,0x1c,0x1f,0xc9,0x89,0xb7,0x71,0xb9,0xe1,0xef,0x4a,0x97,0x66,0x31,0xf8,0x94,0xe2,0xa7,0xad,0x33,0x24,0xb1,0xf6,0xc2,
+0xe0,0x95,0xd0,0x10,0x2f,0x08,0xc5,0xe1,0xf6,0x36,0xef,0x42,0xcc,0x4f,0x10,0xe5,0x27,0x46,0x1c,0x4e,0x76,0x53,0x81,0x72,0x68,0xd1,0xfc,0xcb,0x35,0xa3,0x32,0x6a,
+0x49,0xf8,0xb6,0x71,0x49,0x25,0xcb,0x3c,0x24,0x6d,0x81,0xa7,0xeb,0xb9,0xfd,0x76,0x7b,0xe3,0x8a,0xf7,0x2d,0x86,0x99,0x05,0xb3,0x54,0x9a,0x16,0x9a,0x1d,0xd4,0xfe,
+0x73,0x7c,0x24,0x5a,0xa9,0xa0,0xc8,0xab,0xdd,0x9e,0x90,0x86,0x08,0x4a,0x56,0x11,0x8a,0x76,0x74,0x38,0x94,0x06,0x9d,0x48,0xcc,0x6e,0x67,0xe1,0x49,0xab,0x0d,0x0d,
+0x16,0x2d,0xe5,0x03,0x9f,0x3b,0xa2,0xec,0x22,0xff,0xe8,0x1d,0xc9,0x1d,0xc7,0xed,0x39,0x13,0xfe,0xa7,0x77,0x44,0xd5,0x47,0xd7,0xd9,0xc1,0x13,0x25,0xf4,0x9c,0x8d,
+0x8b,0xea,0xe1,0xf0,0x34,0x29,0xdd,0x55,0x7b,0x65,0x57,0x5d,0xd1,0xbf,0x70,0x45,0x2d,0xd9,0x65,0xb1,0x60,0xb4,0x2b,0xf3,0x3b,0x13,0x33,0xec,0x43,0xc9,0x0b,0x4b,
+0xc9,0xfa,0x62,0x5a,0x7d,0xaf,0xe7,0xb9,0x23,0xb7,0x37,0x84,0x83,0x3d,0xf5,0xa7,0x72,0x7d,0x73,0x8e,0xd7,0x18,0x66,0x04,0xed,0x9e,0x61,0xfa,0x88,0xb9,0x33,0x31,
+0xed,0x7b,0x6e,0xdf,0xed,0x0d,0xdc,0x81,0xb6,0x2f,0x8c,0xaf,0xd1,0x2b,0x92,0x31,0xa2,0x75,0xf3,0x81,0x6b,0xb3,0x3e,0x8d,0xe0,0xff,0x92,0xfd,0x6e,0x6c,0xfc,0x4c,
+0xe6,0x2c,0x38,0x25,0xf2,0xe5,0xf7,0xc2,0x1f,0x0b,0x28,0x1a,0x6a,0xae,0x5a,0xf7,0xdd,0x03,0x77,0x6c,0xb1,0xbe,0x45,0x54,0x92,0x46,0x36,0xca,0xda,0x9a,0x3a,0x5a,
+0x3f,0xb0,0xe0,0x82,0x23,0x18,0xe5,0xa6,0x47,0xbf,0x07,0xc3,0xd6,0xc8,0x1f,0xc6,0x0b,0x3f,0x92,0x10,0x37,0x0a,0x06,0x07,0x6b,0x42,0x2c,0xb8,0x41,0x49,0x6c,0x31,
+0xef,0x8d,0x2c,0xf1,0xaf,0x98,0x08,0x8e,0xe9,0x12,0xc7,0x58,0x58,0x3b,0xba,0x6f,0x2d,0x19,0x05,0x9f,0x05,0xba,0xc7,0x71,0xb3,0xa5,0x43,0x8b,0xc7,0x25,0x7a,0x44,
+0x14,0xd5,0x0b,0x86,0xf0,0xf0,0xfa,0x1a,0xc6,0xdf,0xf0,0x53,0xf0,0x93,0xf1,0x95,0xd5,0x7c,0x5c,0x9a,0x0b,0x82,0x76,0x4f,0x30,0xe1,0x89,0x6c,0xe6,0xdd,0x1f,0x97,
+0x53,0xe9,0x9c,0x27,0x9c,0x3d,0xe0,0xdd,0x4b,0x1c,0x0b,0x42,0x57,0xc4,0x6a,0xbd,0x57,0xb7,0xfe,0x2c,0x24,0xa2,0xf7,0x49,0x6c,0xb1,0xde,0x37,0xbb,0xa8,0xb2,0x38,
+0x43,0x6b,0x24,0xe6,0x89,0x68,0x36,0xa3,0x67,0xd6,0xa7,0x4c,0xbf,0x60,0x9e,0x08,0x14,0xe3,0xb5,0xcd,0x76,0x54,0xb5,0xbd,0x80,0x57,0x51,0x31,0xf3,0x0e,0xb2,0xe3,
+0x3d,0x77,0x50,0x18,0x2e,0xf2,0xb9,0x22,0x9c,0xd5,0x6d,0x07,0x6e,0x7f,0x68,0xda,0xde,0xa0,0x39,0x59,0x90,0xf9,0xee,0x71,0x32,0x5f,0xc1,0x63,0x0b,0xeb,0x29,0xec,
+0xbb,0xfd,0x91,0xd1,0x60,0x6d,0xfe,0x89,0xfc,0xaa,0xf5,0xcc,0x73,0x55,0x23,0x20,0x99,0x81,0xe5,0xa6,0x63,0xb2,0x40,0xcf,0xd6,0x49,0x1a,0x35,0xac,0x2f,0x18,0x13,
+0x38,0x38,0x41,0x2f,0x56,0xfb,0x7e,0x76,0x87,0xe6,0x5b,0x20,0xff,0x25,0x38,0x66,0xd4,0x6a,0x3e,0xb4,0x84,0x0f,0x65,0x84,0xee,0x7f,0x6f,0x3c,0xae,0x99,0x98,0xb3,
+0x27,0x67,0x22,0xf3,0xee,0xff,0xc4,0x2b,0xf0,0xe0,0x04,0x86,0x80,0x2f,0x4b,0xf1,0xf7,0xb5,0x58,0x95,0xdf,0xbe,0x72,0x24,0x28,0x7b,0x41,0xdc,0x14,0x7e,0xe6,0xab,
+0x44,0x9a,0x82,0x9f,0xa8,0x26,0xf8,0x11,0xa3,0x90,0x3c,0x32,0x21,0x99,0x19,0x0b,0xad,0xe7,0x11,0x92,0x2b,0x94,0x8a,0x74,0x56,0x84,0x6a,0xc7,0x04,0xd8,0x17,0xba,
+0x8b,0x76,0x6f,0x30,0x97,0x51,0xf5,0xb2,0xf7,0xd5,0xdb,0xe8,0x15,0x45,0x6d,0x0a,0x9c,0x07,0x20,0xd7,0x5f,0xde,0x42,0x0c,0xf5,0xac,0x81,0x40,0x27,0xc8,0x0d,0xc1,
+0x31,0x20,0x22,0x08,0x85,0x9c,0x30,0x17,0xfe,0x07,0x30,0xef,0x5c,0x06,0x0b,0xc6,0x27,0x8b,0xcd,0x06,0x98,0xa2,0xa4,0x87,0x0a,0x0b,0x34,0xf6,0x00,0x1b,0xe8,0xcf,
+0xea,0x12,0x0b,0xd4,0xfb,0x16,0x40,0x9f,0x35,0x44,0x76,0x1c,0xf7,0x6d,0xf8,0x3b,0x6b,0xca,0x2c,0xa0,0xfe,0x0e,0x16,0xfb,0x76,0xc0,0x9d,0xd9,0xa4,0x36,0xac,0xf5,
+0x6b,0x80,0x34,0xab,0x7c,0x6d,0x62,0x50,0x13,0x67,0xea,0x58,0xd2,0x00,0x0c,0x13,0x15,0x7c,0xdb,0x6b,0x9e,0x35,0x65,0xb5,0x57,0xec,0xbf,0x03,0xfb,0x33,0xab,0xf8,
+0x1d,0xc4,0xf7,0x6d,0x50,0x3d,0xab,0x63,0xbd,0xc5,0xc8,0xb7,0xc0,0xc4,0xcc,0x82,0x05,0x4d,0x33,0xdf,0xf2,0xa6,0x67,0x4d,0x54,0x68,0x5a,0xe9,0x6b,0x39,0x4b,0xee,
+0x11,0x51,0x3e,0xd5,0xc7,0x5e,0xa8,0x23,0xa4,0x9e,0xdd,0xcc,0xf6,0xf2,0xb5,0xcd,0x17,0x30,0xe1,0xb2,0xb4,0x4a,0x81,0x40,0x2b,0x6f,0x23,0x44,0x97,0x51,0x76,0x44,
+0x03,0x18,0x9a,0x6f,0x57,0xbb,0xdd,0xb1,0xd5,0x0b,0x2b,0x7c,0x34,0x6e,0xf8,0xa6,0xc3,0x09,0x27,0xe2,0x1e,0x51,0x5c,0x66,0x87,0x0a,0x2b,0x7d,0xb7,0xdf,0x58,0xb2,
+0xc6,0x65,0x66,0x26,0xba,0x18,0x56,0x77,0x88,0xa3,0xa7,0xd2,0xaa,0x84,0x1b,0xbf,0xa0,0x91,0x2f,0x0c,0xea,0x80,0xf5,0x2f,0x83,0xbc,0x99,0x31,0x70,0x35,0xa6,0x29,
+0xc6,0x1d,0x2d,0xa3,0x10,0x85,0x66,0x67,0x53,0xc0,0xf2,0xd5,0x66,0x8f,0xcd,0xbd,0x5b,0x2f,0xa1,0x74,0xc6,0x7d,0x90,0xe3,0x6e,0x8c,0xe9,0x52,0x46,0xb0,0x78,0x7b,
+0xb0,0x5a,0xe3,0x99,0xe7,0x1f,0x02,0xf6,0xb4,0x0e,0xc5,0x47,0x72,0x28,0x76,0xa6,0xbd,0xf6,0x9b,0x92,0x0a,0xff,0x90,0x2c,0x60,0x3d,0x35,0xe0,0x4a,0x7d,0x33,0xe1,
+0xaa,0xc5,0xda,0x6d,0xd8,0xd8,0xa7,0x2c,0x87,0xb9,0xcd,0xa6,0xb2,0xcd,0x17,0xcb,0xbc,0x7c,0x79,0xc0,0x6c,0xb1,0xa5,0xce,0xff,0x30,0x75,0x8a,0xdf,0x12,0x4e,0x81,
+0x95,0xb0,0x5d,0x6f,0x6f,0xab,0x95,0xfb,0x8d,0xa2,0x35,0x9e,0x34,0x23,0x70,0x15,0x3a,0x5f,0x95,0xa7,0x6f,0xc5,0xc7,0x72,0x6b,0x06,0x24,0xec,0x8c,0xfb,0x00,0xc0,
+0xce,0xc4,0x39,0x97,0xf3,0xdd,0x8b,0xeb,0xbb,0x9d,0x5e,0x1f,0x7a,0xd7,0x19,0x8d,0x32,0xa9,0xbe,0x8b,0x1b,0x40,0xa7,0xe0,0x26,0x83,0xa8,0xce,0xc8,0xf3,0xd4,0x1e,
+0x5f,0x62,0x55,0x88,0x56,0x5a,0x6e,0x3a,0x5d,0x32,0xca,0xe2,0x24,0x4e,0x94,0x6e,0x38,0xae,0xea,0xae,0x11,0x87,0x47,0x20,0x90,0x48,0x95,0x7b,0x55,0xe5,0x05,0x5a,
+0xdf,0x93,0x14,0x85,0x53,0x55,0xe5,0x2c,0x3a,0x8f,0x18,0x47,0x4b,0xac,0x94,0x7b,0xfb,0x55,0x65,0x15,0x0c,0x52,0x75,0xa5,0x08,0x22,0xe7,0x30,0x0d,0x34,0xd5,0xe5,
+0x65,0x6b,0xd7,0x9b,0x88,0x61,0x4a,0x9e,0xb5,0xca,0x8c,0x5a,0x50,0x42,0x67,0x30,0xaa,0x3a,0x5d,0x24,0x70,0xcd,0x6b,0x14,0x23,0xad,0x34,0xdd,0x4a,0x46,0xc8,0x54,
+0xae,0x30,0x52,0x39,0x47,0x42,0xe6,0x31,0xbd,0x6a,0xcc,0x13,0xb6,0x64,0x12,0x69,0x8d,0x19,0xb0,0xc0,0x25,0xd0,0xf5,0xc7,0x55,0xaf,0x53,0x78,0x2b,0xf3,0xac,0x99,
+0xfd,0x5a,0xc7,0x34,0x26,0xe5,0x2a,0xd3,0x4b,0xc1,0x24,0x0b,0xce,0x18,0x70,0x6c,0x96,0x68,0xea,0x9b,0x26,0x6a,0xa1,0xa6,0x4e,0xbf,0x57,0x8d,0x7c,0x2b,0x03,0x78,
+0x80,0x34,0x3d,0xb5,0x57,0xbb,0x0a,0x0d,0x68,0xb9,0xca,0x3c,0xf5,0x98,0x2f,0x31,0x04,0xa5,0x50,0x6b,0x82,0xa9,0xba,0x32,0xc2,0x71,0x19,0xa4,0x72,0x7c,0x85,0xc5,
+0x3a,0xbd,0xda,0xac,0xf6,0xb5,0xb0,0x57,0x17,0xea,0xbb,0x50,0xcc,0x2d,0x15,0xc1,0xbc,0xb2,0xfc,0x0c,0x7d,0x85,0x5a,0x73,0x8a,0x1e,0x70,0xf0,0x03,0xf3,0x50,0x4d,
+0x54,0x19,0xfe,0xef,0xbb,0xd3,0xf4,0x7b,0x1a,0x39,0x43,0x8a,0x2b,0x46,0xc3,0x14,0xb4,0x47,0x15,0xf1,0x09,0xe6,0x31,0xc9,0xc5,0x69,0xe4,0x0c,0x77,0xae,0xa0,0x69,
+0x22,0x37,0xce,0x4a,0xca,0xe4,0xff,0x10,0x1a,0xc2,0xac,0xa9,0x5b,0xd4,0x99,0x57,0x99,0x57,0x17,0x69,0x83,0x38,0xd0,0xea,0x66,0x9a,0x68,0x96,0x89,0x8d,0x9c,0x72,
+0xba,0x70,0x9d,0xe2,0xca,0x52,0xf4,0xc6,0x11,0x2c,0x0f,0x4a,0xba,0x67,0x04,0xc9,0xa8,0x26,0x13,0x96,0xd9,0x00,0x68,0x2b,0xd9,0xd8,0x30,0xfc,0x8a,0x32,0xda,0x2f,
+0xe6,0xb2,0xc9,0x3d,0x99,0xd2,0xf0,0x80,0xa9,0x8c,0x54,0xf0,0xc1,0xc0,0x14,0xb3,0x18,0x9c,0xd4,0x8c,0x0f,0xf6,0x86,0xa6,0xb5,0x8c,0xd6,0xb0,0x04,0xa8,0x83,0x8b,
+0x97,0x56,0xb2,0x5d,0x26,0x2c,0x0e,0x4e,0xe9,0x0c,0x64,0x07,0x86,0xe1,0x5f,0x40,0x6a,0x2c,0xbd,0xa2,0x3d,0xb3,0xb5,0x55,0x6e,0x2b,0x5e,0xbe,0x49,0x92,0x20,0x36,
+0x1b,0x5b,0xd0,0x63,0x26,0x2f,0x22,0x69,0xc6,0x73,0x9d,0x61,0x3f,0xcf,0xbc,0x20,0xbe,0xf3,0x64,0x9e,0x02,0x81,0xd2,0xe4,0x37,0xde,0xd4,0x99,0x3d,0xd6,0xc4,0x98,
+0x89,0x8b,0xb3,0x33,0x8e,0x05,0xa1,0xee,0x7d,0x11,0xe5,0x0c,0xf1,0xa7,0x74,0xd2,0x94,0xaa,0x7e,0xc4,0x71,0x88,0x63,0x44,0xd2,0x29,0xd6,0x38,0x6c,0x21,0xe5,0x4c,
+0x59,0xa4,0x60,0x32,0x6f,0xae,0xaa,0x85,0xbd,0x7d,0x09,0x29,0x56,0x2b,0xce,0x68,0xd0,0x54,0x5e,0x31,0x1e,0x06,0x97,0xec,0x29,0x8d,0x6b,0x5e,0x4e,0xc9,0xd5,0x99,
+0xc2,0x44,0xe1,0x9c,0xfc,0x41,0x71,0x50,0x57,0xf0,0x05,0x4c,0x06,0x68,0x14,0x27,0x55,0xf1,0xd2,0x58,0x10,0x35,0x61,0xd5,0xd6,0x04,0x50,0x8c,0x86,0x35,0xaf,0x53,
+0xc8,0x21,0x42,0x6a,0x13,0x1d,0xd7,0xa8,0xe0,0x8e,0xd1,0x25,0x8c,0xe0,0x43,0x92,0xeb,0x6a,0xa7,0x3d,0x10,0x15,0x70,0xbf,0x46,0x4b,0x5f,0x09,0x27,0xc0,0x9d,0x48,
+0x12,0x07,0xc8,0x34,0xa3,0x67,0xfc,0xfc,0xc0,0xb8,0x14,0x15,0x86,0x3e,0xca,0x85,0xdd,0x5f,0x42,0xbe,0x4e,0xe5,0x04,0xe7,0x1f,0x36,0xed,0x96,0x8c,0x88,0x68,0xa7,
+0x3f,0x43,0x34,0x09,0x4f,0x95,0xae,0x5b,0xfc,0xd4,0x81,0x1f,0x32,0x7f,0xfc,0x0f,0x90,0x0f,0x48,0x84,0xd9,0x14,0x00,0x00
+};
+const size_t WM_PK_JSTZ_JS_GZ_LEN = 1752;
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_INDEX_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x55,0xdd,0x6e,0xd3,0x4a,0x10,0xbe,0xe7,0x29,0x16,0x71,0xb1,0x09,0xaa,0xed,0x26,0xa1,0x1c,0xda,0xc6,0x96,
+0x80,0xb6,0x47,0xd5,0x29,0x7f,0x6d,0xe0,0x88,0xab,0x6a,0xb3,0x3b,0x8e,0x17,0xd6,0x5e,0xb3,0x3b,0x4e,0x88,0x2a,0x24,0x1e,0x82,0x67,0x40,0xe2,0x35,0x78,0x14,0x9e,
+0xe4,0xcc,0x3a,0x76,0x29,0x11,0xe2,0x80,0x94,0xc4,0x99,0xc9,0x37,0x7f,0xdf,0x7e,0xb3,0x99,0xde,0x3e,0x7a,0xf6,0x78,0xf6,0xfa,0xf9,0x31,0x2b,0xb0,0x34,0xd9,0xad,
+0x69,0x78,0x30,0x23,0xaa,0x45,0xca,0xa1,0xe2,0xc1,0x01,0x42,0xd1,0xa3,0x04,0x14,0x4c,0x16,0xc2,0x79,0xc0,0x94,0xbf,0x9c,0x9d,0x44,0x0f,0x78,0xef,0xae,0x44,0x09,
+0x29,0x5f,0x6a,0x58,0xd5,0xd6,0x21,0x67,0xd2,0x56,0x08,0x15,0xc1,0x56,0x5a,0x61,0x91,0x2a,0x58,0x6a,0x09,0x51,0x6b,0xec,0x30,0x5d,0x69,0xd4,0xc2,0x44,0x5e,0x0a,
+0x03,0xe9,0x28,0xde,0x0d,0x69,0x50,0xa3,0x01,0xa6,0x04,0x8a,0x48,0xd4,0x75,0xca,0x5b,0x9b,0x67,0xa7,0x76,0xc6,0x8e,0xda,0x68,0xf6,0x98,0x72,0x3a,0x6b,0xa6,0x49,
+0xfb,0x13,0x85,0x18,0x5d,0xbd,0x65,0x0e,0x4c,0xca,0x3d,0xae,0x0d,0xf8,0x02,0x80,0x4a,0x17,0x0e,0xf2,0xce,0x13,0xcb,0x7d,0xb9,0x77,0xef,0x01,0xdc,0x8f,0xa5,0xf7,
+0xa1,0x88,0x97,0x4e,0xd7,0xc8,0xbc,0x93,0x29,0x2f,0xad,0x6a,0x0c,0x5c,0xd6,0xd6,0xac,0x73,0x6d,0x4c,0xbc,0x37,0x02,0x31,0xbe,0xf7,0xd7,0x3c,0x7e,0x43,0xd0,0x69,
+0xb2,0x81,0x6e,0xc5,0x14,0xab,0xc8,0xa3,0xc0,0xc6,0xc7,0x93,0xb9,0xdc,0x83,0xfd,0xc9,0xfe,0xaf,0xd0,0x34,0xc7,0xf6,0xcf,0x49,0xc7,0xe5,0xdc,0xaa,0x35,0x3d,0x94,
+0x5e,0x32,0x69,0x84,0xf7,0x29,0x0f,0x8c,0x09,0x5d,0x81,0x6b,0x19,0x1f,0xfd,0x1e,0x13,0xc5,0x28,0x30,0x27,0xe6,0xc4,0x5c,0x97,0xc6,0x23,0xce,0x0d,0x67,0xed,0xf8,
+0x34,0xa3,0x70,0x0b,0x5d,0x45,0x73,0x8b,0x68,0xcb,0x83,0x91,0x83,0xb2,0xa5,0xba,0x6d,0x62,0x8a,0x8e,0xde,0x45,0x76,0x01,0x95,0xb7,0x8e,0x58,0x2d,0x5a,0xf3,0x95,
+0x30,0x0d,0x5c,0x5b,0x2f,0xe9,0xa8,0x36,0x46,0x12,0xe0,0x09,0x76,0xfd,0x63,0x18,0x80,0x69,0xd5,0x51,0x12,0x05,0xb3,0x4d,0x1d,0x72,0x2a,0x3a,0x7e,0xe3,0x6b,0x51,
+0xa5,0x7c,0x72,0xdd,0x0a,0xc2,0x7b,0x8c,0x84,0xd1,0x8b,0xea,0x40,0x92,0x32,0xc0,0x1d,0x12,0xc8,0xba,0x83,0xa5,0x70,0x83,0x28,0x2a,0x1b,0x04,0x35,0xe4,0xd9,0x99,
+0x15,0x4a,0x57,0x8b,0x6f,0x1f,0x3f,0x53,0x2d,0xb5,0xa9,0x4a,0xac,0x61,0xc7,0x57,0xd2,0xce,0xfa,0x23,0x71,0x73,0xac,0x28,0x53,0x28,0x2e,0x7a,0x57,0x49,0x44,0x92,
+0xbb,0xd7,0x42,0xa2,0xab,0xdc,0x12,0x81,0xf4,0xe9,0x4a,0x81,0xda,0x56,0x71,0x1c,0x4f,0x13,0xf1,0xab,0x90,0x95,0xce,0x35,0xcf,0xfe,0xd5,0x27,0x3a,0xb0,0x9d,0xeb,
+0x45,0xe3,0x7e,0x33,0xb2,0x7c,0x87,0xc8,0xb3,0x27,0x2f,0x66,0xb3,0x3f,0x8d,0xb4,0x28,0x78,0x76,0xa2,0x5d,0xb9,0x12,0x0e,0x58,0x53,0x93,0x04,0xe0,0x7f,0xa3,0xee,
+0xf0,0xf6,0x18,0x9c,0xc7,0x47,0xe4,0xcc,0xce,0x81,0x04,0xea,0xf0,0x3a,0x2c,0x21,0xa6,0xbe,0xcb,0x12,0xd7,0x35,0xf4,0xca,0xe7,0x99,0x2e,0xc3,0xb2,0x5e,0xf9,0xc2,
+0xae,0xda,0x4e,0x5d,0xf9,0xc4,0x2a,0x61,0x76,0x82,0xa3,0xcb,0xd3,0x3a,0x3e,0xe4,0xce,0x96,0x3c,0x4e,0x5c,0x97,0x7b,0x7f,0x3c,0x19,0x4b,0x99,0xcb,0x20,0xee,0x43,
+0x65,0x65,0x53,0xd2,0x81,0xc6,0x0b,0xc0,0x63,0x03,0xe1,0xeb,0xa3,0xf5,0xa9,0x1a,0xf4,0x1d,0x0d,0x63,0xa1,0xd4,0xf1,0x92,0xdc,0x67,0xda,0xd3,0x9d,0x00,0x6e,0xc0,
+0xa5,0xd1,0xf2,0x2d,0xdf,0xc9,0x9b,0x4a,0x06,0x66,0x06,0x30,0xbc,0x82,0xb8,0x76,0x10,0x50,0x47,0x90,0x8b,0xc6,0xe0,0x60,0x78,0xb8,0xdd,0xd7,0xe0,0x1a,0x3f,0xbc,
+0xca,0x01,0x65,0x31,0xe0,0x89,0xe3,0x1b,0xdc,0xcd,0x76,0x07,0xa3,0xdd,0x9d,0xe4,0xee,0xd9,0xe5,0xf9,0xf1,0xc5,0xec,0xe1,0xf9,0xec,0xf2,0xf4,0xe9,0xe5,0xf3,0xf3,
+0x67,0x7f,0x93,0x79,0x71,0x37,0xe1,0x1d,0x92,0x2e,0x21,0x56,0x3b,0xbb,0xa0,0x99,0x3c,0x91,0x45,0x69,0x3e,0xb4,0xaf,0x1b,0xbb,0x9a,0x5b,0x4b,0x32,0xed,0x69,0xcf,
+0x71,0xb3,0x99,0xee,0x47,0xf5,0x91,0x3b,0xa2,0x7b,0x88,0xd8,0x9c,0x06,0xc5,0xdf,0x58,0x5b,0x69,0xeb,0xb5,0xd3,0x8b,0x82,0xc4,0xf0,0xf5,0x0b,0x1b,0xef,0x8e,0xf7,
+0xd8,0x3f,0x74,0xdf,0xbd,0x11,0x35,0xfb,0xf6,0xf1,0x13,0xa3,0x42,0x84,0xef,0xa2,0xfa,0xa3,0x0d,0x5b,0xc0,0xb3,0x87,0x0d,0x16,0xb4,0x19,0x3d,0xbc,0x47,0x76,0x47,
+0xf9,0xb3,0xe2,0xad,0x04,0xf2,0xd5,0xab,0x70,0x7b,0xf4,0x02,0x3a,0x60,0xdb,0x1d,0x2d,0xc1,0x79,0xa2,0x8f,0x67,0x4b,0xba,0x73,0xe3,0xc9,0x56,0xde,0x64,0x33,0xef,
+0x77,0xcd,0x24,0xfd,0xd2,0x6d,0xfe,0x17,0xfe,0x03,0xd1,0x61,0xe9,0x05,0x28,0x06,0x00,0x00
+};
+const size_t WM_PK_INDEX_HTML_GZ_LEN = 818;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_INDEX_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x8d,0x55,0xcd,0x6e,0xdb,0x46,0x10,0xbe,0xf7,0x29,0xb6,0xe8,0x61,0xa5,0xc0,0x24,0x2d,0x29,0x6e,0x63,0x5b,0x24,
+0x90,0xf8,0xa7,0x75,0xf3,0x5b,0x59,0x6d,0xd1,0x93,0xb1,0x5a,0x0e,0xc5,0x8d,0x97,0x5c,0x66,0x77,0x48,0x55,0x31,0x02,0xe4,0x05,0x7a,0xeb,0x0b,0xe4,0x52,0x20,0x87,
+0xbe,0x44,0xdd,0xbe,0x48,0x9e,0xa4,0xb3,0x14,0xe9,0x38,0x42,0x11,0x17,0x90,0xb4,0x9a,0xe1,0x7c,0xf3,0xf3,0xed,0xcc,0x70,0xfa,0xe5,0xf1,0xf3,0xa3,0xf9,0x2f,0x2f,
+0x4e,0x58,0x8e,0x85,0x4e,0xbe,0x98,0xfa,0x83,0x69,0x51,0x2e,0x63,0x0e,0x25,0xf7,0x0a,0x10,0x29,0x1d,0x05,0xa0,0x60,0x32,0x17,0xd6,0x01,0xc6,0xfc,0xc7,0xf9,0x69,
+0xf0,0x80,0xf7,0xea,0x52,0x14,0x10,0xf3,0x46,0xc1,0xaa,0x32,0x16,0x39,0x93,0xa6,0x44,0x28,0xc9,0x6c,0xa5,0x52,0xcc,0xe3,0x14,0x1a,0x25,0x21,0x68,0x85,0x1d,0xa6,
+0x4a,0x85,0x4a,0xe8,0xc0,0x49,0xa1,0x21,0x1e,0x85,0xbb,0xde,0x0d,0x2a,0xd4,0xc0,0x52,0x81,0x22,0x10,0x55,0x15,0xf3,0x56,0xe6,0xc9,0x99,0x99,0xb3,0xe3,0x16,0xcd,
+0x8e,0xc8,0xa7,0x35,0x7a,0x1a,0xb5,0x8f,0x08,0xa2,0x55,0x79,0xc9,0x2c,0xe8,0x98,0x3b,0x5c,0x6b,0x70,0x39,0x00,0x85,0xce,0x2d,0x64,0x9d,0x26,0x94,0xfb,0x72,0xef,
+0xfe,0x03,0xf8,0x3a,0x94,0xce,0xf9,0x20,0x4e,0x5a,0x55,0x21,0x73,0x56,0xc6,0xbc,0x30,0x69,0xad,0xe1,0xa2,0x32,0x7a,0x9d,0x29,0xad,0xc3,0xbd,0x11,0x88,0xf1,0xfd,
+0x6f,0x16,0xe1,0x4b,0x32,0x9d,0x46,0x1b,0xd3,0x2d,0x4c,0xbe,0x0a,0x1c,0x0a,0xac,0x5d,0x38,0x59,0xc8,0x3d,0xd8,0x9f,0xec,0x7f,0xce,0x9a,0xea,0xd8,0x7e,0x1c,0x75,
+0x5c,0x2e,0x4c,0xba,0xa6,0x23,0x55,0x0d,0x93,0x5a,0x38,0x17,0x73,0xcf,0x98,0x50,0x25,0xd8,0x96,0xf1,0xd1,0xff,0x63,0x22,0x1f,0x79,0xe6,0xc4,0x82,0x98,0xeb,0xdc,
+0x38,0xc4,0x85,0xe6,0xac,0x2d,0x9f,0x6a,0x14,0x76,0xa9,0xca,0x60,0x61,0x10,0x4d,0x71,0x30,0xb2,0x50,0xb4,0x54,0xb7,0x49,0x4c,0xd1,0xd2,0x37,0x4f,0xce,0xa1,0x7c,
+0x6d,0x2c,0xb1,0x9a,0xb7,0xe2,0x77,0x26,0x2d,0x0d,0x8a,0x1b,0xf9,0x7b,0xf0,0xf2,0x65,0xa7,0x88,0x3c,0x28,0xc2,0xae,0x0a,0xf4,0x65,0x30,0x95,0x76,0xc4,0x04,0x5e,
+0x6c,0x03,0x78,0xcf,0x29,0x35,0x81,0x76,0x95,0x28,0x63,0x3e,0xb9,0x49,0x08,0xe1,0x57,0x0c,0x84,0x56,0xcb,0xf2,0x40,0x52,0x7f,0x80,0x3d,0x24,0x23,0x63,0x0f,0x1a,
+0x61,0x07,0x41,0x50,0xd4,0x08,0xe9,0x90,0x27,0xcf,0xc4,0xdf,0xbf,0x5d,0xff,0x89,0xa2,0x11,0xc5,0x87,0xb7,0x7f,0x50,0xbc,0x74,0x13,0x99,0xf8,0xc3,0x8e,0xb9,0xa8,
+0xad,0xfa,0x53,0x0a,0x17,0x58,0x92,0x37,0x9f,0x80,0xe8,0x55,0x05,0x51,0x4a,0xea,0xbe,0x2b,0x22,0x55,0x66,0x86,0xa8,0xa4,0x5f,0x5b,0x5c,0xbf,0x93,0x0a,0xc2,0x30,
+0x9c,0x46,0xe2,0x73,0x90,0x95,0xca,0x14,0x4f,0x1e,0x9b,0x32,0x53,0xcb,0xda,0x7a,0x90,0x60,0x3f,0xab,0x53,0x75,0x37,0xb2,0x78,0x85,0xb8,0x8d,0x7c,0xfa,0xc3,0x7c,
+0x7e,0x37,0x92,0x2e,0x80,0x27,0x0f,0x2f,0xb1,0x26,0xaa,0x5e,0x6f,0x80,0x99,0xb2,0x45,0x73,0xfd,0xde,0xd6,0x77,0xa2,0xbf,0xe2,0xed,0x95,0x58,0x87,0x8f,0x48,0x99,
+0xcc,0xe0,0x9f,0x77,0x28,0x2c,0xde,0xe0,0x22,0xa2,0xec,0x63,0xa7,0xe2,0xba,0x82,0x7e,0x18,0x78,0xa2,0x0a,0x3f,0xbf,0x57,0x2e,0x37,0xab,0x23,0x9f,0xb7,0x2d,0x9e,
+0x9a,0x54,0xe8,0x1d,0xaf,0x98,0x81,0xf3,0x7e,0x5a,0xc5,0x9b,0xcc,0x9a,0x82,0x87,0x91,0xdd,0xe8,0xc2,0xfd,0xf1,0x64,0x2c,0x65,0x26,0x7d,0xbf,0x1f,0xa6,0x46,0xd6,
+0x05,0xdd,0x6e,0xb8,0x04,0x3c,0xd1,0xe0,0xff,0x3e,0x5a,0x9f,0xa5,0x83,0x3e,0xa5,0x61,0x28,0xd2,0xf4,0xa4,0x21,0xf5,0x13,0xe5,0x68,0x4d,0x80,0x1d,0x70,0xa9,0x95,
+0xbc,0xe4,0x3b,0x59,0x5d,0x4a,0x54,0xa6,0x1c,0xc0,0xf0,0x0a,0xc2,0xca,0x82,0xb7,0x3a,0x86,0x4c,0xd4,0x1a,0x07,0xc3,0xc3,0xed,0xbc,0x06,0x37,0xf6,0xc3,0xab,0x0c,
+0x50,0xe6,0x03,0x1e,0x59,0xbe,0xb1,0xbb,0x9d,0xee,0x60,0xb4,0xbb,0x13,0xdd,0x7b,0x72,0x31,0x3b,0x39,0x9f,0x3f,0x9c,0xcd,0x2f,0xce,0x9e,0x5d,0xbc,0x98,0x3d,0xff,
+0x96,0xc4,0xf3,0x7b,0x11,0xef,0x2c,0x69,0x2f,0xb1,0xca,0x9a,0x25,0xd5,0xe4,0x88,0x2c,0x72,0xf3,0xa6,0xfd,0xdc,0x1a,0xdf,0xcc,0x18,0xea,0xd9,0x9e,0xf7,0x0c,0x37,
+0xc3,0x6a,0x3f,0x6d,0x43,0x52,0x07,0xb4,0x9a,0x88,0xcd,0xa9,0x6f,0xff,0x5b,0x93,0x2c,0x4d,0xb5,0xb6,0x6a,0x99,0x53,0x57,0xfc,0xf5,0x9e,0x8d,0x77,0xc7,0x7b,0xec,
+0x31,0xad,0xc0,0x97,0xa2,0x62,0x1f,0xde,0xfe,0xce,0x28,0x10,0xd9,0x77,0xa8,0xfe,0x6e,0xfd,0x48,0x50,0x2f,0xd4,0x98,0xd3,0x98,0xf4,0xe6,0xbd,0x65,0x77,0x95,0xff,
+0x15,0xbc,0xed,0x81,0x6c,0xf5,0x93,0x5f,0x28,0xa7,0xc4,0xd7,0x4a,0x58,0x38,0x60,0xdb,0x19,0x35,0x60,0x1d,0xd1,0xc7,0x93,0x86,0xd6,0x70,0x38,0xd9,0xf2,0x1b,0x6d,
+0xea,0xfd,0xd8,0x33,0x51,0x3f,0x7d,0x9b,0x57,0xc5,0xbf,0xe3,0xe8,0xca,0x3f,0x3b,0x06,0x00,0x00
+};
+const size_t WM_PK_INDEX_HTML_GZ_LEN = 851;
+#else
+const uint8_t WM_PK_INDEX_HTML_GZ[] PROGMEM = { 0 };
+const size_t WM_PK_INDEX_HTML_GZ_LEN = 0;
+#endif
+#ifdef WM_REMOTE_UPDATE
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_OTA_REMOTE_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xd5,0x5a,0x7b,0x77,0x9b,0x48,0xb2,0xff,0xdf,0x9f,0x42,0x3e,0x3b,0x23,0x20,0x42,0x98,0xa7,0x04,0x92,0x48,0x26,
+0xcf,0xb1,0x67,0x92,0x71,0x36,0x8f,0xd9,0x87,0xe3,0xc9,0x22,0x68,0x49,0xd8,0x08,0x18,0x40,0xb6,0x35,0xb2,0xf6,0xb3,0xdf,0xaa,0xee,0x06,0x81,0x50,0x12,0xcf,0xde,
+0x7b,0xcf,0x3d,0x37,0x39,0xc7,0x82,0xee,0xea,0xea,0x5f,0x3d,0xba,0xaa,0xba,0x1b,0x3f,0x89,0xf3,0xa2,0xf3,0xdd,0x52,0x75,0x45,0x51,0x72,0x1f,0x6f,0x7c,0xfa,0x3e,
+0x27,0xd3,0xd0,0xcd,0xdd,0xc7,0x41,0xe2,0xaf,0x96,0x24,0x2e,0x94,0x39,0x29,0x5e,0x46,0x04,0x1f,0x9f,0xad,0xcf,0x02,0x31,0x97,0xc6,0x8c,0xf0,0xec,0xd4,0x15,0x23,
+0xf9,0x06,0x47,0xe2,0x18,0x31,0x92,0x94,0x82,0xdc,0x15,0xcf,0x93,0xb8,0x00,0x5a,0xf7,0x66,0x3b,0xce,0x48,0xb1,0xca,0xe2,0xcd,0xd9,0xa9,0x8c,0x04,0xdb,0xf1,0x56,
+0x12,0xcb,0xc1,0xdf,0x2d,0x35,0x3e,0xeb,0x6c,0x15,0xfb,0x45,0x98,0xc4,0x9d,0xa7,0xc0,0x61,0xc3,0x86,0x74,0xa2,0x6e,0x37,0x52,0x3e,0x7f,0x26,0xf9,0x9b,0x24,0x58,
+0x45,0xa4,0xdb,0x3d,0x9f,0x5e,0x11,0xbf,0x50,0xd2,0x2c,0x29,0x92,0x62,0x9d,0x12,0x65,0xe1,0xe5,0xe7,0xb7,0xf1,0xdb,0x2c,0x49,0x49,0x56,0xac,0x15,0xdf,0x8b,0x22,
+0x40,0x23,0x04,0x64,0xe6,0xad,0xa2,0x42,0x90,0x9e,0x44,0x0a,0x7f,0x1e,0x45,0xdb,0xa3,0x1b,0x2f,0xeb,0xbc,0x76,0x37,0xe4,0x2e,0x4d,0xb2,0x22,0x1f,0x6d,0xb6,0x5b,
+0xf9,0xae,0xf1,0x3a,0x16,0x4b,0x1c,0xa2,0xb4,0x41,0xea,0xc8,0x15,0x9e,0x3e,0x7b,0xfe,0xe2,0xe5,0xab,0x1f,0x4f,0xcf,0x7e,0xfa,0xf9,0xf5,0x9b,0x5f,0xce,0xdf,0xfe,
+0xf5,0xdd,0xfb,0x0f,0x1f,0x7f,0xfd,0xdb,0xdf,0xff,0xf1,0x4f,0x6f,0xea,0x03,0xf3,0xf9,0x22,0xbc,0xba,0x8e,0x96,0x71,0x92,0xfe,0x9e,0xe5,0xc5,0xea,0xe6,0xf6,0x6e,
+0xfd,0x87,0xaa,0xe9,0x86,0x69,0x0d,0x86,0xb6,0xd3,0x3b,0x11,0xe4,0x99,0xbb,0x01,0xc0,0xd1,0xa8,0xe2,0x9d,0xcb,0x41,0x25,0x63,0x3e,0x99,0x04,0xf7,0xf9,0xe3,0xc7,
+0x8f,0x0d,0xbd,0x1f,0x6c,0x65,0x20,0xcc,0xbe,0x48,0x88,0x24,0x94,0x16,0x08,0x49,0x1c,0x84,0x5e,0x5c,0x23,0x95,0x36,0xe1,0x4c,0xcc,0x15,0xaa,0xd8,0x6c,0xe5,0x17,
+0x49,0xe6,0xba,0xbf,0xac,0x96,0x53,0x92,0x49,0x47,0x9c,0xc5,0x4c,0x41,0x1c,0xc0,0xd5,0x96,0xba,0xda,0x60,0xa8,0x69,0x8e,0x61,0xdd,0x57,0x8d,0xba,0x29,0x75,0x4d,
+0x7d,0x68,0xeb,0x96,0x65,0x0c,0xd4,0xf1,0x2c,0xc9,0x44,0x54,0x41,0xe0,0xaa,0xe3,0x60,0x92,0x2b,0x11,0x89,0xe7,0xc5,0x62,0x1c,0xf4,0x7a,0x52,0x7e,0x11,0x5c,0xba,
+0x33,0x85,0x41,0x10,0xf1,0x4d,0x1a,0x97,0x28,0x41,0x04,0x2f,0x0e,0x92,0xe5,0xb3,0x75,0x41,0xf2,0x06,0xbc,0x1d,0xc3,0x8b,0xcb,0x71,0xfe,0x58,0x1d,0xe7,0xfd,0xbe,
+0x74,0x14,0x28,0xe9,0x2a,0x5f,0x88,0x6f,0xbc,0x62,0xa1,0xcc,0xa2,0x04,0x68,0xe8,0x23,0x63,0x22,0x4a,0x8f,0x74,0x6b,0x20,0x55,0xdc,0x41,0xee,0x29,0xf2,0xfd,0x90,
+0xfc,0x2d,0xc9,0x82,0x2f,0xb3,0x97,0x3d,0x57,0x95,0x7d,0x00,0xee,0xed,0x80,0x7b,0xbd,0x9e,0xec,0xf7,0x5c,0x1b,0xa6,0xbc,0xf0,0x41,0x87,0xd6,0xe5,0xbd,0x9b,0x5f,
+0x78,0x97,0x93,0x89,0x6e,0xf6,0xfd,0xef,0x0d,0xbd,0x36,0xc9,0x2d,0x72,0xff,0x90,0x7c,0x5d,0x06,0x9c,0xa4,0x36,0xc1,0x23,0xe0,0xe0,0x31,0xfe,0x4c,0x24,0x60,0x4e,
+0xa7,0x81,0x3f,0x30,0x83,0x07,0x33,0x74,0x41,0xb5,0x07,0x64,0x39,0x25,0x77,0x0f,0x9d,0x04,0xa5,0xa8,0x26,0xc0,0x19,0x90,0xbb,0x09,0x4b,0x2e,0x79,0x5f,0x64,0x61,
+0x3c,0x17,0x35,0xd0,0x96,0x5c,0xef,0xef,0x6a,0xd6,0x5e,0x77,0x05,0x40,0xb9,0x4a,0xc2,0x58,0x14,0x04,0x69,0x2b,0x2f,0xc8,0xdd,0x9f,0x14,0x17,0x65,0xd5,0x2b,0x28,
+0xa9,0x97,0xe5,0xe4,0x2c,0x2e,0xc0,0x01,0xf3,0xd5,0x14,0x1c,0x50,0xf4,0x64,0x5d,0x92,0xb5,0x83,0xb6,0x7b,0xe6,0xe5,0x64,0x60,0xfe,0x99,0x89,0x0c,0xe9,0xa8,0xa4,
+0xf0,0xb9,0xd1,0xb4,0xc1,0x3d,0x3c,0xf4,0x34,0x78,0xb4,0xe9,0x93,0x7e,0x29,0x87,0x30,0x30,0x9c,0x98,0xe3,0x10,0x95,0xe4,0x3d,0xb2,0x7b,0xe1,0xa3,0xc1,0xc4,0xad,
+0x0c,0x64,0x3f,0xe1,0x68,0x23,0xc5,0x5f,0x78,0xd9,0xd3,0x42,0x44,0x3f,0x18,0x3c,0x12,0x8d,0x7e,0x28,0x75,0x07,0x86,0x24,0x8d,0x38,0x81,0xe0,0x0a,0x07,0xd5,0x34,
+0xa5,0xc8,0x0f,0x69,0x2a,0x87,0x69,0x32,0x92,0x46,0x9e,0x4f,0xc4,0x93,0x8b,0xdf,0x9e,0xf6,0xff,0xa9,0xf6,0x9d,0xde,0xa7,0x93,0xcb,0x93,0x70,0x2e,0xc3,0xd8,0xf1,
+0xb7,0xdc,0xd3,0x77,0x7b,0x3d,0xef,0x7b,0x53,0x3a,0xf2,0x8f,0x5d,0xb5,0xdb,0x2d,0x4d,0x18,0x29,0x61,0x1c,0x90,0xbb,0x73,0xba,0xb4,0x19,0x68,0xaf,0xaf,0x49,0x52,
+0x97,0xae,0x92,0x34,0xb9,0x15,0x75,0xb9,0xaf,0x3f,0xf2,0x7b,0xb6,0x04,0xcd,0x93,0x89,0xff,0x48,0xbf,0x3f,0x34,0x46,0x92,0x50,0xd4,0x3e,0x74,0xd7,0x0c,0xb2,0x1d,
+0xdf,0x29,0x3c,0xfa,0xb9,0x33,0x1a,0x96,0x11,0xe1,0xa9,0x5b,0xb5,0xca,0xaf,0xdc,0xcd,0xaa,0x98,0xd9,0xa3,0x4d,0x4e,0xfd,0xa7,0x25,0xf9,0x2e,0x56,0xbf,0x52,0xa6,
+0x61,0xac,0x34,0xc8,0xc4,0x55,0x4c,0x72,0xdf,0x4b,0x89,0x48,0x62,0x3f,0x09,0xc8,0xc7,0x77,0x67,0xcf,0x93,0x65,0x9a,0xc4,0x90,0x18,0x60,0xa4,0x24,0x55,0x1e,0xc1,
+0xbc,0xf3,0x10,0xdb,0x80,0xb4,0x46,0x72,0x9e,0x6c,0xc2,0x06,0x03,0xc6,0x14,0xb8,0x86,0xf1,0xd7,0x10,0x97,0xa6,0x98,0xa1,0x29,0x72,0x30,0x43,0x3e,0x89,0x4a,0x33,
+0xe4,0xe8,0x3a,0xb3,0xba,0x9b,0x3c,0x87,0xf9,0x41,0x83,0xb9,0xd4,0x58,0xbd,0xb3,0xaf,0x61,0x7f,0xe8,0x04,0x6c,0xa8,0x32,0xcb,0x92,0xe5,0x73,0x3e,0x93,0x18,0x5d,
+0xe4,0x97,0xbb,0x45,0x33,0xdb,0x39,0x1f,0xc8,0x75,0xe6,0xbe,0xa2,0x16,0x3a,0x77,0x0f,0x68,0x2a,0x3a,0x76,0xe3,0x55,0x04,0x29,0x53,0x7c,0x03,0xad,0xf7,0xf7,0x6f,
+0xe9,0xdf,0xe3,0x63,0xc8,0xa0,0x61,0xfe,0x6c,0x35,0x9b,0x41,0x22,0xd8,0x8e,0xab,0x3c,0xfb,0x66,0x37,0x14,0x69,0x6a,0x69,0xa3,0xdb,0xc5,0xd4,0x9a,0xcc,0x3a,0x8d,
+0x56,0xa5,0x64,0xe2,0xba,0x42,0xc9,0x44,0xc0,0xfc,0x7c,0x88,0x06,0x78,0x6f,0x8f,0xaa,0xa9,0xde,0xd6,0x50,0x56,0xac,0x33,0xe2,0x05,0xaf,0xa2,0xc4,0x2b,0x5e,0xbf,
+0x6c,0x72,0xac,0x28,0xf2,0x28,0xf4,0x49,0xb3,0x0f,0x40,0xb3,0x66,0x51,0x95,0x55,0x30,0xf5,0x51,0x3b,0x5f,0x9f,0x42,0xba,0x3d,0x53,0xd0,0x69,0x41,0xf3,0xe7,0x72,
+0x00,0x2f,0xe0,0x0e,0xb0,0xe2,0x2a,0x4a,0x5f,0x0e,0xa5,0x8d,0xdf,0x4c,0x94,0xcc,0x12,0x4f,0xc2,0x6e,0x37,0x54,0xa8,0xb3,0xc2,0x9b,0x0b,0x73,0xc3,0x50,0x2f,0x5b,
+0x0b,0x4f,0x7c,0x37,0xd8,0xf3,0x6d,0x5f,0x1a,0xf9,0x90,0x03,0x5b,0x8d,0xf8,0x07,0xc8,0x9f,0x66,0x99,0xb7,0xae,0x15,0x2a,0x14,0x35,0xab,0x4f,0x7c,0x80,0x3e,0x3a,
+0x66,0x04,0x61,0x4e,0x7f,0x61,0x4c,0xb7,0xdb,0x80,0x74,0xec,0xba,0x1f,0xc3,0xb8,0xb0,0x69,0x37,0xd8,0xd4,0x77,0xfd,0x5d,0x14,0x97,0x76,0xe1,0x24,0x73,0x23,0xa5,
+0x9e,0x12,0x81,0x93,0x9c,0x02,0x6d,0x19,0xf2,0xe4,0xd8,0xd5,0x86,0x86,0x6e,0xd9,0x26,0x24,0x7b,0x99,0xb8,0x7d,0x7d,0x08,0xef,0x86,0x3d,0x74,0xe4,0xc4,0xed,0x57,
+0x5d,0xa6,0x5c,0xb8,0x65,0x8f,0x2d,0xaf,0xc0,0x65,0x57,0x93,0xac,0x74,0xd9,0x15,0xba,0x6c,0x76,0xb1,0xba,0x74,0x45,0xfc,0x8b,0x01,0x17,0x7f,0x69,0x5e,0xab,0x15,
+0x12,0xbc,0x53,0x37,0xcb,0x5e,0xbb,0x51,0x4f,0x64,0x17,0x29,0xcf,0xba,0x9a,0x6e,0x4f,0x26,0x29,0xe4,0x43,0x39,0xbb,0x10,0xd3,0xde,0xc0,0x84,0x76,0x67,0x32,0x31,
+0xa5,0x9e,0x66,0x5e,0xba,0x69,0x25,0xdb,0xd2,0xf5,0x94,0xcf,0xb3,0x99,0x3c,0xc7,0xdf,0xf9,0x5c,0x5e,0xe0,0xef,0x62,0x21,0xaf,0xf1,0x37,0x0c,0xdb,0x30,0x5d,0xc8,
+0x37,0xd4,0x0d,0x9e,0xbb,0xb1,0xfc,0xde,0x25,0xf2,0xb5,0x9b,0xc8,0x9f,0xdd,0x62,0x1c,0xbb,0x4b,0x31,0x96,0x89,0x9c,0xc8,0x05,0xcc,0xb9,0xea,0xa9,0x97,0xf2,0x50,
+0xee,0x0f,0x6c,0xd5,0x1e,0x0e,0x1c,0x63,0x20,0x81,0xf4,0x4b,0xb1,0x90,0x19,0x09,0x12,0x68,0x97,0xb2,0x06,0x81,0xd5,0xb0,0x1d,0x6b,0x60,0x5a,0x36,0x50,0x24,0x40,
+0x81,0xc3,0x91,0x06,0x29,0x20,0xdd,0x68,0x43,0x79,0xa0,0x0e,0x34,0xd5,0xb2,0x35,0x47,0x02,0xdd,0x2e,0x45,0x36,0x43,0x4c,0x09,0x8c,0x4b,0x59,0x07,0x16,0x9a,0x6a,
+0x9a,0x96,0x6e,0x19,0x86,0x2a,0xc9,0xfb,0x30,0x4c,0x0a,0x43,0x1b,0x0e,0x4c,0xcd,0xb6,0x9d,0x61,0x1b,0x86,0x45,0x61,0x68,0xba,0xaa,0xaa,0xb6,0x6a,0xea,0x07,0x60,
+0x0c,0x28,0x8c,0xbe,0x66,0x82,0x25,0x0d,0xcd,0x30,0xb5,0x36,0x90,0x21,0x03,0x62,0x5a,0x43,0xd5,0x72,0x6c,0xa3,0x0d,0xc3,0x46,0x18,0xda,0x70,0xa8,0xaa,0x86,0x65,
+0x6a,0x07,0xb4,0xe1,0x30,0x6d,0x68,0x0e,0xfa,0x8a,0x69,0x6a,0xc3,0x36,0x0e,0x4d,0x65,0x40,0x4c,0x5d,0x85,0x44,0xda,0xc2,0xa0,0x69,0x5c,0x1b,0x8e,0xa3,0x9a,0x2a,
+0x4c,0xa2,0xb7,0x61,0x68,0x3a,0xc5,0x01,0x82,0x0e,0x54,0x63,0x60,0xeb,0x07,0xac,0x62,0x30,0x20,0xa6,0x0a,0x82,0x6a,0xaa,0x76,0x00,0x86,0xc9,0xf5,0x61,0xa9,0xa0,
+0x34,0x5d,0x77,0xd4,0x03,0x58,0x2c,0x8a,0x05,0x4a,0xf4,0x81,0x65,0x58,0x86,0xee,0x20,0x94,0x79,0x13,0xca,0xa5,0x6c,0x01,0x93,0x81,0x35,0x74,0x06,0x96,0xa6,0x22,
+0x92,0x79,0x03,0x09,0xa8,0xdd,0x41,0xdb,0x0e,0x1c,0x4b,0xd5,0x06,0x86,0x8e,0x48,0xe6,0x4d,0x24,0xe8,0x42,0xa6,0x3c,0x30,0x0d,0x58,0x56,0x43,0x8d,0xea,0x64,0xde,
+0xc0,0x01,0x1a,0xd3,0x55,0xf0,0xb1,0x21,0x78,0xd9,0xd0,0x50,0xf5,0x36,0x0c,0x8b,0xc2,0x18,0xaa,0x9a,0x05,0x2e,0xe8,0x68,0x6d,0x18,0xa8,0x75,0x47,0x36,0x6c,0xc0,
+0xa0,0xa2,0x65,0x5b,0x20,0x2c,0x0a,0xa2,0x3f,0x18,0xa8,0xe6,0xd0,0x36,0x0c,0xab,0x8d,0xc2,0x64,0x28,0x4c,0x15,0x56,0xe9,0xd0,0x36,0xed,0x36,0x0a,0x07,0x51,0x58,
+0x03,0xdb,0x34,0x41,0x18,0xfb,0x00,0x08,0x93,0x2b,0x43,0x73,0x6c,0x30,0x1c,0xaa,0x7c,0x1f,0x87,0xc1,0x60,0x68,0xf6,0xd0,0x18,0x18,0xce,0x40,0x6b,0xc3,0xb0,0x29,
+0x0c,0x0d,0x74,0x69,0x19,0x60,0x3c,0xed,0x80,0x4d,0x0c,0x66,0x14,0x13,0x70,0xd8,0x9a,0x39,0x18,0xb6,0x91,0xe8,0x14,0x88,0xa5,0x81,0x7f,0x80,0x28,0x6d,0x18,0x43,
+0x0a,0x03,0xa2,0x1c,0x58,0xdd,0x86,0x15,0xd3,0x86,0x81,0x3e,0x88,0xea,0xd0,0x1c,0x1d,0x74,0x36,0x1c,0x1a,0x26,0x02,0x59,0xec,0x5b,0xc5,0x44,0xb3,0xd9,0x60,0x15,
+0xc4,0xb0,0x68,0x60,0x00,0x41,0x34,0x0d,0x4a,0x32,0x70,0x3e,0x6b,0x08,0x50,0xa9,0x55,0x16,0x6d,0xd7,0x18,0x80,0xa7,0x1b,0x8e,0x6a,0xa8,0x16,0xae,0x05,0x02,0x24,
+0x0d,0x1c,0x68,0x16,0x03,0x66,0xb1,0x0c,0xd5,0xb1,0x60,0x0b,0xd4,0x42,0xa1,0x51,0x14,0x1a,0xf6,0x3b,0xb0,0xe6,0xd4,0x36,0x12,0x93,0x22,0xd1,0xf4,0xa1,0x6e,0x3b,
+0x60,0xfa,0x03,0x40,0x86,0x14,0x07,0x30,0xb1,0x4c,0x67,0x48,0xbd,0xb8,0x85,0x43,0x65,0x38,0x34,0xd5,0x01,0x7d,0xa9,0x03,0x53,0x3d,0x80,0xc4,0x40,0x28,0x60,0x13,
+0x7d,0xe8,0x68,0x43,0xb3,0x0d,0x44,0x65,0x2a,0x31,0x2c,0x1b,0x5c,0x4c,0xd7,0xf5,0x36,0x10,0x83,0x01,0x81,0x4e,0x4b,0xd7,0x9c,0xa1,0xd3,0x06,0x32,0xa0,0x38,0x86,
+0x03,0x55,0x77,0x34,0xdb,0x69,0x83,0x70,0xa8,0x3a,0x00,0x9f,0x31,0x30,0x4d,0x7b,0xd8,0x06,0x81,0x96,0x45,0x14,0xa6,0xae,0xd9,0x9a,0x65,0xe3,0x52,0x68,0xd9,0xc5,
+0xa2,0x30,0x40,0xa5,0x43,0x13,0x80,0xa8,0x6d,0x14,0x3a,0xd3,0x86,0xe3,0x40,0x3c,0xb7,0x21,0x32,0x20,0x8e,0xf5,0x7e,0x66,0x41,0x8d,0x3a,0xf6,0xc0,0x50,0x61,0xc5,
+0x20,0x8e,0x75,0x03,0x07,0xea,0x1c,0x1d,0x5d,0x1f,0xd8,0x8e,0x66,0x6a,0x14,0xc6,0xba,0x1d,0xc3,0xa8,0xa7,0xe3,0x6a,0x30,0x1d,0x95,0xae,0xda,0x75,0x03,0x08,0x86,
+0x30,0x10,0x06,0x3c,0xcc,0xc0,0x95,0xdb,0xc6,0x81,0xe2,0x82,0x8b,0x41,0x4c,0x37,0xc1,0x4f,0x87,0x5a,0x1b,0x88,0x41,0x81,0xc0,0x9a,0x74,0x4c,0x40,0x0b,0x89,0xec,
+0x00,0x12,0x95,0x23,0x51,0x2d,0xcd,0xd2,0x8d,0x36,0x0c,0x8d,0xc1,0xd0,0x55,0x80,0xa9,0x83,0xf9,0x9d,0x36,0x10,0x9b,0xe2,0x80,0x85,0x0f,0xd9,0xc9,0xb0,0x9c,0x36,
+0x0e,0xaa,0x75,0x8c,0x83,0x90,0x4a,0xc1,0x7d,0xcc,0x36,0x8c,0x01,0x47,0x61,0x0d,0x30,0xc4,0x40,0xb4,0x3b,0x00,0xc4,0xa0,0x48,0x34,0x58,0x0d,0x9a,0xa5,0x0d,0xcc,
+0x03,0x40,0x4c,0x66,0x19,0xd3,0x02,0x49,0xd4,0xa1,0x7a,0x00,0x88,0xc6,0x35,0x02,0xf9,0x56,0xd7,0x20,0x84,0x38,0x6d,0x28,0x3a,0x85,0x32,0x04,0x79,0xec,0xa1,0x6e,
+0x39,0x6d,0x20,0x0e,0xd3,0x88,0x01,0x76,0x01,0xbd,0x33,0x0f,0x89,0x7b,0xcf,0xa1,0xc2,0x51,0x81,0x96,0xf4,0xde,0xd3,0xa7,0xc4,0x4d,0x7a,0xd7,0xf4,0xa9,0x70,0x8b,
+0xde,0x67,0x7c,0xda,0x96,0x87,0x34,0x51,0x79,0xae,0x72,0xc1,0xd1,0x5f,0x42,0xd9,0x4e,0x0b,0xa1,0x46,0x09,0x2b,0x67,0x72,0xca,0xc0,0xb3,0x92,0xa7,0x70,0xfd,0x9e,
+0x18,0x76,0xb3,0xfb,0x7f,0x87,0xdd,0x54,0xea,0x89,0x31,0x32,0x95,0x7a,0x09,0xdf,0x49,0x88,0xc5,0x64,0x42,0xee,0x0b,0x76,0xce,0x44,0xa4,0x5e,0xb8,0x95,0x69,0x51,
+0xf5,0x10,0x9e,0xe9,0x7d,0xd6,0xfd,0xf7,0x83,0x79,0x2e,0x16,0x0f,0xe0,0xf9,0x5b,0xf6,0xdb,0x83,0x19,0x86,0xe1,0xb7,0x19,0x66,0xbf,0x89,0xe1,0x3d,0x60,0x7c,0x28,
+0xcf,0x69,0x94,0xf8,0xd7,0x79,0xf8,0x07,0x81,0x92,0x11,0xdf,0x83,0x70,0x4e,0xf2,0xa2,0x6c,0x78,0xbd,0xdb,0x15,0x37,0x36,0x0d,0xe1,0x0c,0xea,0x70,0xba,0xcb,0x92,
+0x8e,0x8a,0x45,0x96,0xdc,0x76,0x62,0x72,0xdb,0x79,0x99,0x65,0x50,0xb0,0x0a,0x67,0x51,0x44,0xe6,0x5e,0xd4,0xf1,0xb2,0x39,0x3d,0x31,0xed,0x08,0x3d,0x9f,0x6d,0xa8,
+0xb1,0x46,0xaf,0x9f,0x28,0x89,0x1e,0x65,0x57,0x6d,0xf2,0xe8,0xae,0xc3,0xcb,0x69,0xdf,0x93,0x6c,0xc4,0x5f,0xf9,0x96,0x24,0xd8,0xdb,0xe2,0x66,0xd2,0xa8,0xaa,0xf8,
+0x4f,0xc9,0x1d,0xbc,0x6f,0xab,0x9d,0xfb,0x47,0xb7,0x42,0xce,0x0f,0x58,0xdf,0xb9,0x4f,0xc5,0x8f,0xe5,0x44,0x9b,0x77,0x7b,0x87,0xaf,0x3a,0x3f,0x7c,0xc5,0xb1,0x9f,
+0x97,0x49,0xe0,0x45,0xcf,0xf3,0xdc,0x15,0x14,0xfa,0xd8,0x4f,0x6e,0x48,0x16,0x79,0xeb,0x4d,0x9a,0xe4,0x21,0xea,0x60,0x34,0x0b,0xef,0x48,0x30,0x0e,0xe3,0x9c,0x14,
+0x23,0x75,0x3c,0xf5,0xfc,0xeb,0x79,0x96,0xac,0xe2,0x60,0x94,0xcd,0xa7,0x1e,0xee,0xc8,0xf0,0xbf,0x82,0x9b,0xe4,0x20,0xcc,0x53,0x18,0x3a,0x9a,0x45,0xe4,0x6e,0xec,
+0x45,0xe1,0x3c,0xee,0x87,0x05,0x59,0xe6,0x23,0x1f,0x14,0x43,0xb2,0xf1,0xd5,0x2a,0x2f,0xc2,0xd9,0xba,0xef,0xb3,0x53,0xe2,0xb2,0xf9,0x8f,0x3e,0x3d,0xb8,0x18,0x39,
+0xf0,0x6f,0x2b,0xf4,0x8e,0x4a,0x24,0xd3,0xe4,0x6e,0x53,0x9b,0xee,0x2f,0xb3,0xd9,0x6c,0x3c,0x05,0x85,0x92,0xac,0x9f,0x79,0x41,0xb8,0xca,0x47,0xca,0xd0,0xca,0xc8,
+0x12,0x1a,0xef,0xfa,0xf9,0xc2,0x0b,0x92,0xdb,0x91,0xda,0xb1,0xd3,0xbb,0x8e,0xa1,0xc3,0x9f,0x1a,0x3c,0x45,0xb7,0xa5,0x71,0xea,0x05,0xb8,0xbf,0x1b,0xe9,0x0a,0x0e,
+0xea,0xe8,0x38,0x12,0xcf,0xac,0xfb,0x14,0x69,0x09,0x66,0x19,0xc6,0xfd,0xdb,0x30,0x28,0x16,0x23,0x5d,0x57,0xd3,0x3b,0x86,0x27,0x4f,0xc3,0x38,0x26,0xd9,0x86,0x75,
+0x58,0xc0,0x7d,0xbc,0x20,0xe1,0x7c,0x51,0xb0,0x67,0x06,0x6a,0x64,0xc1,0xa4,0x79,0x12,0x85,0x01,0x9b,0x5a,0xb7,0x20,0xde,0xdb,0x10,0x17,0x60,0x7e,0x08,0xf8,0x25,
+0xf4,0x22,0x49,0x41,0x01,0x51,0x92,0x8d,0xfe,0x02,0x39,0x6f,0x10,0xe8,0x7b,0x32,0x59,0xea,0xf7,0x63,0x2f,0x0e,0x97,0x1e,0x55,0x3e,0xce,0xdc,0x51,0xec,0xbc,0x13,
+0x85,0x31,0x01,0x7b,0x85,0xf1,0x2c,0x8c,0x41,0xa9,0xe3,0x25,0x38,0x5c,0x18,0x83,0xbc,0xde,0xaa,0x48,0x3a,0x9a,0xa2,0xa3,0x50,0x14,0xed,0x0f,0xd7,0x64,0x3d,0xcb,
+0xbc,0x25,0xc9,0x3b,0x38,0x7a,0x53,0x24,0x9b,0x22,0xf3,0xe2,0x1c,0xf6,0x57,0xcb,0x11,0xec,0x4c,0xbd,0x82,0x88,0xb0,0x33,0x0b,0xc8,0x1c,0x7c,0xa8,0xa6,0xee,0x65,
+0x3e,0xdf,0x70,0x60,0x18,0xe9,0x1c,0x9d,0xcf,0x01,0x76,0x28,0x8a,0x64,0x59,0x2a,0x7b,0x06,0xc6,0xeb,0xe3,0x92,0x19,0x69,0x8a,0x4a,0x5b,0x6e,0x17,0x00,0xa8,0x9f,
+0xa7,0x9e,0x4f,0x46,0x69,0x46,0xfa,0x08,0xb5,0xce,0xd8,0x8f,0x8b,0xcd,0x6e,0x14,0x53,0x3f,0x63,0x73,0xcb,0x94,0x08,0xe9,0x6a,0xdc,0x50,0x49,0xc3,0x0b,0x8a,0xb8,
+0x0f,0x6b,0x6e,0xd3,0x70,0xae,0xb9,0x97,0x96,0x78,0xbe,0xe0,0x54,0x1c,0x3b,0x68,0x7b,0x54,0x57,0xce,0x8e,0xe9,0xa6,0xf4,0x07,0x65,0x80,0xee,0xa0,0x29,0xdc,0x95,
+0xa8,0x29,0xe3,0x24,0x26,0xfb,0xbe,0xb6,0x2f,0xfd,0xbe,0x14,0x03,0x94,0x62,0x95,0xe5,0x20,0x46,0x9a,0x84,0x08,0x62,0x5f,0x8c,0x35,0xc9,0x1b,0x0e,0xcd,0xed,0xcf,
+0x45,0x07,0xf7,0xde,0x1f,0x10,0x27,0x75,0x7a,0x6a,0xc5,0xd4,0xcb,0x40,0xc0,0x71,0xd3,0x50,0x1c,0xb5,0xa2,0x51,0x41,0xbf,0xe4,0x84,0xba,0xb4,0x15,0x76,0x27,0x41,
+0x24,0xce,0x57,0x19,0x79,0xc3,0x97,0xbf,0x48,0xc3,0xdc,0xf1,0x97,0xee,0x7d,0x84,0xac,0x24,0x14,0x24,0x16,0x7f,0x73,0xb7,0xa2,0xf5,0x33,0x02,0x3e,0xc5,0xc9,0x45,
+0x21,0x2f,0xd6,0x11,0x11,0xa4,0x71,0xae,0x84,0x81,0x5b,0x1b,0x08,0x0d,0xf5,0x2b,0xa2,0x2a,0xf2,0x8c,0x2b,0x46,0x0b,0xe2,0x05,0x8a,0x97,0xa6,0x90,0x09,0x9f,0x2f,
+0xc2,0x88,0x5e,0x37,0x6d,0x6b,0x27,0x4a,0xf9,0x22,0xb9,0x7d,0x07,0x01,0xdb,0xcb,0x0a,0xca,0x55,0xcc,0x09,0x58,0x3d,0xc8,0x65,0xf0,0xf5,0xdc,0x9b,0x13,0x69,0xb3,
+0x2f,0x14,0x8d,0x8f,0xe0,0xd8,0xae,0xc8,0x49,0x8e,0x5d,0x17,0x54,0x49,0x60,0x11,0x91,0x40,0x7a,0xc2,0x1b,0x47,0x02,0xe7,0x0a,0xcb,0xab,0x93,0x66,0xc9,0x3c,0x83,
+0x76,0x45,0x51,0x04,0x3a,0x3c,0x08,0x6f,0xbe,0x28,0x2b,0xf4,0x09,0x18,0xf7,0x6e,0x14,0x3f,0xf2,0xf2,0xfc,0x17,0x58,0x75,0xae,0xd0,0x88,0xa3,0x02,0xed,0xa5,0xe1,
+0xe3,0xf4,0xc3,0x9b,0xd7,0xae,0x30,0x81,0xf7,0x0e,0xa5,0x76,0x3f,0x09,0x55,0xa0,0xfb,0x24,0x3c,0x46,0xdb,0x37,0x3a,0x79,0xd4,0x81,0xae,0xc9,0x09,0xb4,0x33,0x82,
+0x74,0x6f,0x2c,0x08,0x47,0xc7,0xc2,0x6f,0x4f,0x98,0x9c,0xa4,0x6d,0x36,0xd5,0x22,0xfc,0x24,0x74,0xc0,0x22,0x9f,0x84,0xec,0x39,0x3e,0x03,0x21,0x57,0x1f,0x8e,0xab,
+0xf8,0xb3,0xa7,0x9d,0x4d,0xa6,0x49,0xb0,0x6e,0xd8,0x04,0xfa,0x99,0x5a,0x63,0x97,0x8f,0x1f,0xb3,0x7c,0x0c,0xf9,0xe1,0x0c,0xbd,0xfe,0x06,0x0c,0x53,0x3b,0x9f,0x8b,
+0xfb,0x7d,0x4a,0x40,0x22,0xf7,0xcb,0xde,0x05,0x88,0x40,0x8f,0xe0,0x81,0x24,0x92,0x48,0xd4,0xf0,0x93,0x18,0x9b,0xe3,0x89,0xab,0x4a,0x1b,0x3f,0x82,0x10,0x58,0xcd,
+0x51,0x48,0x63,0x48,0xe7,0x34,0x4c,0x2a,0x8b,0x8c,0xcc,0x5c,0xe1,0x44,0x00,0x77,0x81,0x62,0x4e,0x55,0xc1,0x6f,0x78,0x61,0xb5,0xd9,0x77,0x9a,0xbd,0x64,0x68,0xd4,
+0xef,0x3f,0xe9,0x5d,0xa6,0x7c,0x76,0xba,0x75,0xbf,0x5b,0xaa,0x8c,0x04,0xb2,0x27,0xbc,0x68,0xfc,0xa5,0xc5,0x0c,0xfa,0x74,0xce,0xeb,0xc6,0x8d,0x6a,0xb7,0xa1,0x54,
+0xfb,0xaf,0xc3,0xbc,0x50,0x60,0x45,0x82,0x2f,0x88,0xc2,0x22,0x0c,0x02,0x12,0x83,0x98,0x5b,0x3e,0xe0,0xf4,0x0b,0x03,0x20,0x2e,0x1d,0xa0,0xbe,0xdd,0x51,0x0b,0xe8,
+0xa3,0x67,0xf1,0x2c,0x11,0x9a,0xb7,0xae,0x51,0x45,0xfc,0xb2,0x46,0x4c,0xb2,0xec,0x00,0x5d,0xb5,0xa8,0x66,0x61,0x20,0x4e,0x57,0x33,0xb9,0xf0,0xe6,0x12,0xbf,0x05,
+0x9e,0xba,0x58,0xe0,0xec,0x0e,0x22,0xb1,0xbf,0xd4,0x58,0xc1,0x3a,0x3f,0x00,0xbb,0x97,0xf4,0x78,0x3f,0x13,0x25,0x76,0x76,0x4a,0x44,0x64,0x41,0x8f,0xf1,0x22,0x02,
+0x4b,0x89,0xde,0xca,0xb8,0x53,0x7e,0x4e,0xd7,0x2f,0xca,0x27,0x7a,0x4f,0xb3,0x41,0x92,0x19,0x86,0x35,0xb7,0xc8,0x56,0xa4,0x1a,0x75,0x05,0xa3,0xae,0x26,0x3b,0xda,
+0x2b,0xa4,0x05,0x07,0x98,0x5e,0x84,0xbd,0xab,0x4b,0x58,0xbd,0xc5,0xf4,0xe2,0xea,0x12,0xcf,0xda,0x71,0xe8,0xcc,0x8b,0x72,0x88,0xd3,0xb0,0x26,0xaf,0x31,0x50,0x00,
+0x1d,0x6d,0x67,0xdc,0xc3,0x29,0xde,0x38,0xe2,0xd3,0xb5,0x1b,0xf6,0x76,0x2c,0x21,0x5d,0x45,0x44,0xbc,0x9e,0x94,0x0d,0xdd,0xee,0xf4,0xe2,0x1a,0x59,0x83,0x87,0x85,
+0x53,0x76,0x44,0x8f,0x2d,0xd2,0xf8,0xba,0xd7,0xab,0xfc,0xa8,0x53,0x4a,0xfd,0x82,0x94,0x52,0xb3,0x4b,0x0a,0x71,0x4f,0x57,0xe1,0x54,0xa2,0x51,0xab,0x1c,0x06,0x65,
+0x23,0x30,0x61,0xca,0x7b,0xa1,0xb9,0x5e,0xbe,0x8e,0x7d,0x71,0x06,0x2e,0x87,0xe3,0xde,0x66,0xc9,0x32,0xcc,0x89,0x28,0x42,0xc4,0x49,0xa2,0x1b,0xd8,0x6d,0x10,0xbc,
+0xea,0x46,0x87,0x44,0xe0,0x78,0x5a,0x4e,0x32,0xaa,0xf0,0x57,0x00,0xfa,0x1d,0x7d,0x15,0xb1,0xb0,0xc3,0x07,0x25,0x89,0xa3,0xc4,0x0b,0x76,0xd5,0x2a,0xb9,0x01,0xeb,
+0x96,0x46,0xf4,0x10,0x0d,0x3f,0xbb,0xa7,0x1d,0x0a,0x78,0x2d,0x2c,0x3c,0xf0,0xc7,0x7c,0x15,0x15,0xdc,0x9c,0xcb,0xc0,0x72,0xdf,0x89,0x35,0xda,0xd2,0xce,0x0b,0xa8,
+0x75,0x5c,0xf4,0x8d,0x5a,0x9f,0x2c,0xfc,0xf0,0xe8,0xcd,0xd3,0x1f,0x43,0xff,0xd1,0x0f,0xa3,0xc5,0xed,0x48,0x28,0x69,0x21,0xd2,0x7d,0x8d,0xf4,0x86,0xec,0x48,0x23,
+0x2f,0x9e,0x7f,0x8d,0x36,0x9a,0x8f,0xe8,0x1d,0x1c,0xd5,0x86,0xb8,0x01,0x78,0x32,0x22,0x91,0x61,0x0a,0x19,0xc7,0x6e,0x71,0x41,0x54,0xe2,0x13,0xac,0xc1,0x5d,0xa6,
+0xb3,0xb2,0x15,0x7f,0x9e,0xb2,0xf3,0x75,0x7e,0x2b,0x01,0xbe,0x0b,0xc3,0x50,0x9f,0xc8,0xea,0xaf,0x2b,0x92,0xad,0x69,0x35,0xcf,0x21,0x05,0xe4,0xe6,0x14,0x85,0xc5,
+0x30,0x50,0x11,0xdc,0xdf,0x8b,0x3b,0xe2,0x19,0x29,0xfc,0x85,0x28,0x9c,0xe4,0xbf,0x3f,0x09,0xee,0x5c,0x6c,0xc7,0x05,0xb5,0x20,0xb1,0x98,0xb9,0x8f,0x33,0xe5,0x2a,
+0xc7,0x40,0x07,0x2b,0xd8,0x43,0x32,0x02,0xb6,0xdb,0x9b,0x87,0x6d,0x1a,0x08,0xa0,0x28,0xd5,0xf0,0x0b,0xf3,0x83,0x4e,0xc4,0x0d,0x0d,0xc1,0x6b,0x96,0x09,0x3c,0xc8,
+0xb4,0x85,0x76,0xbd,0x5b,0x2f,0x44,0xf7,0x81,0x40,0x81,0xe1,0x10,0x7b,0xcb,0x7b,0x1f,0x20,0x3a,0xe6,0x9b,0x93,0xcd,0x8d,0x28,0xcc,0xc0,0x4f,0xf0,0xc3,0x08,0x48,
+0xd4,0xe3,0xb3,0x53,0x78,0xbf,0xc5,0xa4,0x24,0xc8,0x91,0x12,0xc3,0x2f,0x6f,0x03,0x1a,0xac,0x61,0xb0,0x15,0x7f,0x6b,0x57,0x0c,0x3d,0xa1,0xf3,0x8c,0x8f,0xa4,0x72,
+0x52,0x20,0x7c,0xd4,0x12,0xa6,0x12,0x10,0x54,0xf9,0x8e,0xd8,0x04,0x8a,0x90,0x21,0x78,0x82,0x8f,0x23,0xbc,0xf6,0x84,0xee,0x7c,0xe5,0xfb,0x90,0x46,0xdf,0x25,0xb7,
+0xf0,0x5e,0x64,0x6b,0xee,0x96,0xc1,0x4f,0x5c,0x18,0xae,0x76,0x91,0x0a,0x14,0xfc,0xa4,0xe0,0x44,0xdd,0x2e,0x7f,0x70,0x5d,0xaa,0x66,0x89,0x87,0x30,0xae,0xf2,0x76,
+0x4c,0xcd,0x48,0xd0,0x2f,0xee,0x30,0x77,0x30,0xc2,0x55,0x1a,0x40,0x7a,0x7e,0x56,0x40,0xe0,0x54,0xa0,0x60,0xf4,0xa6,0x11,0x29,0xa3,0xc4,0x97,0x82,0xa1,0x20,0x20,
+0x5a,0x68,0x67,0x48,0xb7,0x04,0x88,0xbf,0x34,0x2d,0x8d,0xcc,0x0f,0x9a,0x93,0x06,0xb5,0x97,0xa2,0x70,0xea,0x65,0xc1,0x2d,0x94,0x6c,0x9d,0xb3,0x17,0x1d,0x58,0xe9,
+0x4b,0x74,0x11,0xa5,0xf3,0x61,0x11,0xe6,0x10,0x78,0xb3,0x25,0xed,0x82,0xe7,0x38,0xc1,0x68,0x08,0x59,0x14,0x3b,0x40,0x33,0x78,0x6b,0x04,0x13,0xdc,0xd4,0x80,0x35,
+0xe2,0xc9,0x96,0xfb,0x5a,0xa9,0xa0,0xff,0x0b,0x0c,0x65,0x82,0x15,0xc0,0x5f,0x85,0x11,0x3a,0x2d,0x75,0x2c,0x61,0x14,0xc9,0x4c,0x73,0x23,0xfc,0x0b,0xe9,0xf6,0x08,
+0x55,0x7a,0xb4,0x39,0xfd,0xb6,0x73,0x3e,0x40,0x98,0x33,0x48,0x35,0x59,0x06,0xeb,0xbd,0x83,0xcc,0x3a,0x39,0x89,0xe0,0x99,0x04,0xca,0x01,0xa7,0xab,0x23,0xdf,0x8b,
+0xc7,0x7c,0x19,0xfe,0x8a,0x69,0xb2,0xbc,0xa3,0x7d,0xac,0x75,0xbb,0xc7,0x4b,0x08,0x8d,0x61,0x1a,0x91,0x27,0xa2,0x17,0x91,0x0c,0x2a,0xbc,0x7f,0x24,0xab,0x8e,0xef,
+0xc5,0x1d,0x88,0xb5,0xeb,0xce,0x2a,0xc5,0x80,0x0b,0xcf,0xa4,0x23,0xe2,0xfd,0xa2,0xc4,0x40,0x78,0x10,0x6d,0x3b,0x45,0xb8,0x44,0x7d,0xc9,0xc7,0x1a,0x6c,0xd5,0x2f,
+0xd4,0x4b,0x2a,0x12,0xec,0x1c,0xa3,0x10,0xb8,0x40,0x87,0x92,0x26,0xa9,0x28,0x1d,0xd3,0xcb,0x45,0xe1,0xab,0xec,0x6b,0xac,0xf3,0x92,0xe3,0xb1,0xba,0xcb,0xd8,0x3f,
+0x42,0x55,0x75,0x0b,0x5b,0xe6,0xe4,0x56,0xa9,0x0a,0xa0,0x8c,0xe0,0x50,0xb1,0x71,0xff,0xfa,0xa3,0x78,0x53,0xfa,0x07,0xec,0xfa,0x40,0xef,0x73,0x40,0x01,0x95,0xd3,
+0x8a,0xb8,0x37,0xe3,0x46,0xfb,0x07,0x74,0xe7,0x5a,0x91,0x7a,0xd3,0x88,0x08,0xdf,0x43,0x59,0x45,0x3f,0xa2,0x42,0x11,0xcf,0x57,0x45,0xbd,0x76,0x88,0xc3,0x7c,0x41,
+0x82,0xf3,0x9f,0x01,0xd2,0x29,0xab,0x4b,0x98,0xbe,0x5b,0xa5,0xba,0x06,0xee,0xf1,0xaa,0xf4,0x36,0x66,0xe1,0x46,0xb5,0xfd,0x29,0x7e,0x91,0x50,0x17,0xa4,0x56,0x4a,
+0x66,0x33,0xf0,0x43,0x52,0x73,0xc3,0x9a,0x60,0x33,0x0f,0x34,0x13,0x88,0x50,0xf1,0x4a,0x9b,0x97,0xf4,0xe7,0xa1,0xab,0x1f,0x37,0x53,0xed,0xbe,0x06,0xf0,0xa6,0xd3,
+0xb0,0x28,0xbd,0xdb,0x80,0xa0,0x3c,0x1f,0xa9,0x95,0x44,0x34,0x8f,0x5c,0x86,0x6a,0xa9,0x1e,0xc5,0x41,0xf1,0xaa,0xd4,0x08,0x2a,0x07,0x3c,0x73,0x37,0x23,0xc6,0xc6,
+0x5b,0x51,0x60,0x6c,0x41,0xe5,0x1d,0xa1,0x87,0xbc,0xf9,0x92,0xe0,0x51,0x93,0x07,0x4d,0x96,0x89,0xfe,0x75,0x02,0x76,0x3b,0xa1,0x60,0x9e,0x40,0x75,0x4f,0xdc,0xef,
+0x36,0xb3,0x6d,0x77,0xe1,0xe5,0x0b,0x78,0x02,0x48,0xf0,0x8c,0x31,0xf4,0x3b,0x9a,0x87,0xb6,0xff,0xa2,0x11,0xf6,0x38,0x50,0x92,0x6b,0x48,0x11,0xfb,0x07,0x58,0x78,
+0xc1,0xed,0x15,0xab,0x1c,0x4b,0x1b,0x94,0x18,0x83,0x31,0x6f,0x72,0x5d,0x5d,0xa5,0xdf,0xa4,0xec,0x28,0xa0,0x4a,0x12,0xce,0x7f,0x16,0x1e,0xc0,0x87,0x17,0x21,0x65,
+0xb0,0xa7,0x21,0x97,0x97,0xdd,0x09,0x08,0x17,0x25,0x73,0x51,0x78,0x4f,0xf7,0x5c,0xe7,0x1f,0x9e,0x42,0xa1,0x93,0xa7,0xd0,0x03,0x85,0x82,0xec,0x95,0x32,0xfb,0xac,
+0xee,0x49,0xb2,0xe5,0x0b,0xaf,0xf0,0xc6,0xac,0xa6,0xc4,0xa6,0xbf,0xbf,0x79,0x7d,0x5a,0x14,0xe9,0x3b,0xf2,0xfb,0x0a,0x3c,0x6c,0x1c,0x2a,0x09,0xec,0x4e,0x44,0xe1,
+0xed,0xf9,0xfb,0x0f,0x82,0x2c,0x50,0xdd,0xb0,0x95,0x84,0x5b,0x0a,0x85,0x3d,0x62,0xe8,0x7e,0x89,0x55,0x10,0xc6,0x71,0x02,0x7e,0xce,0x2c,0x80,0xae,0x27,0xc8,0x55,
+0x01,0x95,0x31,0x3b,0xa6,0x2e,0xfb,0x18,0x0d,0x6b,0x49,0x31,0x53,0x70,0x3c,0x09,0x4e,0x32,0x58,0x14,0x85,0x17,0x3d,0xd2,0x70,0x7b,0x01,0x36,0x4e,0x41,0x4c,0x5c,
+0x9b,0xbb,0x39,0x92,0xb8,0xe4,0xe9,0xd6,0x59,0x82,0x4a,0xcb,0xdb,0x6a,0xfc,0x9c,0x65,0x55,0xa0,0xf3,0xfd,0xd9,0x99,0xb6,0x28,0x67,0x8c,0xc5,0xcd,0x1a,0x15,0x4d,
+0xfc,0x05,0xe4,0x5a,0xe2,0xd6,0x36,0x5a,0x30,0x4d,0x48,0xab,0x9f,0xf5,0x7b,0x24,0x70,0x5d,0x53,0x3a,0xa2,0x6d,0x35,0x6b,0x4a,0x47,0xf5,0x25,0x3b,0xc6,0xc0,0xdc,
+0x69,0xd0,0x98,0x40,0xc3,0x4a,0x4f,0x17,0x99,0x31,0xab,0xa0,0x4d,0xc7,0xad,0x93,0x4f,0xe6,0xb0,0x7c,0x35,0x0a,0x50,0x38,0x08,0xbd,0x4c,0xe2,0xd1,0x9e,0xb3,0x10,
+0xde,0xc3,0x56,0x8d,0x64,0x1d,0x16,0x7b,0x49,0xd0,0x61,0xd3,0x74,0xb0,0x6e,0x06,0xf2,0x72,0xda,0x07,0xf3,0x86,0xb8,0xcd,0xf7,0xa2,0x2c,0x97,0x80,0xe9,0x70,0x15,
+0xd6,0x96,0x0b,0xb0,0xc4,0x5e,0x9f,0xba,0x20,0xcd,0x91,0xf8,0x99,0x19,0x0b,0x18,0xec,0x34,0x01,0x91,0x95,0x59,0x03,0x8b,0x6a,0x56,0xa2,0xed,0x2d,0xf4,0x3f,0xe8,
+0xf2,0x66,0x1f,0x57,0x1e,0xff,0xca,0x5f,0x76,0x1f,0x54,0xd2,0xb0,0xc1,0xbc,0x94,0x55,0xd3,0xdc,0xcd,0x7f,0x61,0x94,0x10,0xfd,0xe9,0x9a,0x63,0x7d,0xbc,0x3a,0xdb,
+0x34,0x26,0xe5,0x45,0x38,0xab,0x36,0xda,0x70,0xb6,0x47,0x2c,0x60,0x21,0xbb,0xb3,0x18,0x5c,0xa6,0x8a,0xdc,0x02,0x06,0x63,0x1e,0xfd,0x81,0x09,0x29,0x7e,0x0d,0xc9,
+0xad,0xfb,0xe3,0x98,0x37,0x25,0xf1,0xab,0x72,0x88,0xfb,0xc7,0x6e,0x17,0xdf,0xf6,0xfe,0x17,0xe7,0x6f,0x78,0x05,0xf4,0x9a,0x3a,0x9d,0x20,0x57,0x67,0xc2,0xbf,0xbb,
+0x6c,0x72,0x80,0x85,0xcc,0x20,0x03,0x71,0x18,0x6e,0x0b,0x14,0x57,0x42,0x15,0x78,0xdd,0x56,0x20,0x1e,0xff,0x7e,0x60,0x72,0x3f,0x0a,0x21,0x10,0xcb,0xf5,0xcf,0x99,
+0x22,0x25,0xcd,0xe8,0x36,0xe5,0x05,0xfb,0x70,0x57,0xac,0x66,0x55,0x28,0x35,0xa4,0x36,0x69,0x5c,0xf1,0xfd,0x32,0x4f,0xb6,0xbf,0x22,0x28,0x0b,0x69,0xb1,0x44,0xa3,
+0xd4,0x95,0xdd,0xed,0xd6,0xdf,0x94,0x59,0xbb,0x09,0xa2,0xa9,0xb4,0xd9,0x4d,0xdb,0x2c,0x47,0x0e,0x27,0x15,0xda,0x55,0xcf,0x14,0xad,0x39,0xe4,0xfd,0x29,0x9a,0x0d,
+0xac,0xe4,0x66,0xae,0x51,0xc6,0x4b,0xc2,0xd6,0xc5,0x2f,0x49,0x07,0xdc,0x20,0x0c,0x9a,0xc5,0x0f,0x2d,0xdb,0x78,0x0c,0x02,0x8d,0xf3,0xd2,0xe2,0x6d,0x44,0xbc,0xbc,
+0x24,0x82,0x02,0xa5,0x1c,0xc8,0x73,0x30,0xe5,0x00,0x6f,0x50,0xd6,0x62,0xaa,0xdb,0xd2,0x4d,0x12,0x2f,0xe9,0xf8,0x19,0xc9,0xfe,0xc9,0x48,0xfd,0x58,0xe4,0xf0,0x49,
+0x48,0xe3,0xa8,0x0e,0x4f,0x28,0x58,0xf2,0xa7,0xa9,0x1a,0x5d,0x8b,0x1f,0x8a,0x7d,0xe3,0x3c,0x8d,0x53,0x7d,0xe5,0x4c,0xad,0xa4,0x78,0xf0,0xb9,0xda,0x7f,0x7a,0x6c,
+0xc6,0x4f,0x9f,0x4b,0x36,0xd3,0x55,0x51,0x80,0x74,0x2d,0x9a,0x4e,0xe3,0x90,0xb7,0x3a,0x68,0x5b,0x9e,0x5f,0xc3,0xc8,0xf3,0x9f,0x27,0x27,0x6c,0x60,0xed,0x88,0xed,
+0xdb,0x07,0x6d,0x5c,0x46,0x69,0xfc,0xe5,0x63,0x33,0xe0,0x0f,0x9e,0x97,0xc4,0xd4,0xf7,0xeb,0xb9,0xa0,0xc9,0x95,0xed,0x96,0xf6,0xb8,0x6e,0xc7,0x7b,0x27,0xab,0x1f,
+0xa9,0x97,0x33,0x83,0xc1,0x93,0xc7,0x3f,0xad,0x83,0x34,0x93,0xbb,0xfc,0x0b,0xfc,0x6b,0xb2,0xce,0x69,0x9f,0x52,0xba,0x51,0xce,0xce,0x02,0x93,0xb4,0xc8,0x5d,0x4a,
+0xaa,0x2c,0xbd,0x54,0xac,0x2f,0x6c,0x7a,0x58,0x4c,0x22,0x57,0x8c,0x60,0x53,0x47,0xc7,0x22,0x9d,0xf4,0x44,0xa8,0xdc,0x57,0x80,0x2d,0x23,0xf7,0x3c,0x61,0x02,0x9c,
+0x10,0x10,0x0b,0x76,0x9f,0x04,0xa1,0x17,0xf5,0x04,0xfc,0x01,0xe2,0x1e,0x1a,0x21,0x42,0x73,0x31,0x22,0xd0,0xde,0x56,0xaa,0xbe,0x94,0xac,0x8e,0x7a,0xe9,0x1c,0xde,
+0x0d,0xc4,0x7c,0x5c,0x8f,0x4f,0x60,0xd1,0x40,0x5e,0x01,0xa9,0x73,0xe4,0x5b,0xb5,0x8f,0x20,0xa5,0x08,0x93,0xbc,0xc8,0x92,0x78,0x0e,0x6c,0xe9,0x20,0x4e,0x84,0x33,
+0xf0,0x8e,0xc9,0x34,0x83,0x4e,0xe1,0xf9,0x2a,0xc3,0x53,0x77,0x1c,0x43,0x09,0x7d,0xf6,0x2e,0x8d,0xa0,0x86,0xb9,0x0d,0x21,0xcb,0x50,0x35,0xad,0xbc,0x39,0xec,0x0b,
+0xca,0x99,0xf6,0x79,0x4a,0x1c,0xe2,0xff,0x83,0x25,0x40,0x4f,0xf0,0x91,0xae,0x71,0xff,0xa3,0xf2,0x0b,0x97,0x92,0x1f,0xa8,0x91,0x44,0x15,0xcf,0x59,0x34,0x8d,0xc0,
+0xef,0x21,0x12,0x51,0xc7,0x7f,0x0d,0xfa,0xa0,0x84,0xc2,0x6b,0xae,0x99,0x11,0xea,0xfb,0x84,0x0e,0x62,0xe3,0x79,0x60,0xaa,0x18,0x84,0x71,0xba,0x5b,0x38,0xd5,0x78,
+0xf4,0x2c,0x6a,0x10,0x4a,0x5d,0x3f,0xa3,0xfe,0x5f,0x59,0xb0,0x6c,0x11,0x30,0xe4,0xec,0x99,0xc2,0xae,0x2f,0xdf,0x07,0xb0,0x8c,0x93,0x1d,0xc7,0x67,0x90,0x1e,0x18,
+0x3f,0x7c,0x6a,0x71,0xfb,0x1f,0x0c,0x06,0x1c,0xef,0xc1,0x80,0x50,0x2e,0xe5,0xaf,0x9c,0xc1,0x53,0x9d,0x97,0x75,0x06,0x75,0xd5,0x55,0x16,0xb9,0xcd,0xd5,0x7e,0x81,
+0x3c,0x2e,0xc7,0x0f,0x08,0x2f,0xe5,0x99,0x19,0x56,0xe3,0x48,0x80,0x37,0x84,0x74,0xc3,0x82,0x4c,0x85,0xde,0x81,0x4f,0xc3,0xa1,0x03,0x4a,0x2c,0x76,0xae,0x56,0x43,
+0xde,0xda,0x49,0x1a,0xea,0x7f,0x73,0x27,0x09,0x93,0xb0,0xd2,0x70,0x77,0x70,0x5a,0xee,0x93,0x19,0xd2,0xf7,0xb4,0x2a,0xdd,0x3f,0x27,0x62,0xbb,0x15,0x56,0x4b,0x62,
+0x24,0x80,0xcc,0xcd,0xae,0x8f,0xc6,0xf4,0x50,0xf2,0x2b,0x8a,0x7d,0xc6,0x2a,0x84,0xff,0x3c,0x4e,0xff,0xa9,0x3a,0xae,0xc6,0x9e,0x09,0xe5,0x2f,0x88,0x7f,0xfd,0x8e,
+0x4a,0xc6,0xf6,0xc6,0x5f,0x2f,0x9e,0x3a,0x7b,0x6e,0x83,0x06,0xab,0x6b,0xe7,0x63,0x16,0x95,0x5e,0xa2,0x14,0x59,0xb8,0x64,0x65,0xd5,0x31,0x9a,0x8f,0x05,0xf1,0xf1,
+0xb7,0x75,0xf9,0x1c,0x21,0xe1,0x47,0xf0,0x78,0xc9,0x86,0x1b,0x60,0xf6,0xc1,0x44,0x7d,0x93,0xdb,0x70,0x1d,0x2a,0xc2,0x37,0x5c,0x87,0xba,0xec,0x15,0xe7,0x51,0x9e,
+0xca,0x22,0xb4,0x2b,0x56,0x3d,0x3d,0xc4,0xc6,0x74,0xfb,0x81,0xc6,0xe5,0x63,0x78,0x5a,0xaa,0xea,0xf1,0xaf,0x8d,0x15,0xa8,0x1a,0xae,0x76,0xa9,0xa7,0xdb,0x85,0x37,
+0xdf,0x8b,0x59,0x8a,0x60,0x9e,0xbc,0xab,0x89,0x76,0x3e,0x1c,0xe6,0xe0,0xc6,0x9d,0x22,0xe9,0xa0,0x2b,0x2b,0x9d,0x5f,0x59,0xc6,0x60,0x28,0xca,0x4c,0x53,0xee,0x14,
+0xf6,0xf2,0xf4,0x95,0xd4,0x3e,0x0b,0xfc,0xa6,0xde,0x0f,0xfb,0x30,0x2b,0x00,0x69,0xdd,0x77,0xf4,0x5f,0xe0,0x5b,0x85,0xbe,0x1d,0x38,0x00,0x00
+};
+const size_t WM_PK_OTA_REMOTE_JS_GZ_LEN = 5500;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_OTA_REMOTE_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xd5,0x5a,0x4b,0x73,0xdb,0x48,0x92,0xbe,0xeb,0x57,0x50,0x31,0xdd,0x04,0x60,0x82,0x10,0x9e,0x24,0xf8,0x80,0xdd,
+0x7e,0xb6,0xd4,0x6d,0x5b,0x1e,0x3f,0x7a,0x66,0x5b,0x56,0xf7,0x80,0x40,0x91,0x84,0x04,0x02,0x68,0x00,0x94,0x44,0x53,0x9c,0xff,0xd2,0x11,0xbb,0x87,0x3d,0xec,0x69,
+0xf7,0xb4,0x11,0xb3,0x17,0x47,0xff,0xaf,0xcd,0xac,0x2a,0x80,0x00,0x41,0xdb,0xea,0x99,0xdd,0xd8,0x58,0x3b,0x42,0x04,0x50,0x59,0x59,0x5f,0x3e,0x2a,0x33,0x2b,0x01,
+0x2f,0x8e,0xb2,0xbc,0xf5,0xd5,0x42,0x75,0x44,0x51,0x72,0xee,0xaf,0x3d,0x7a,0x3f,0x23,0x93,0xc0,0xc9,0x9c,0xfb,0x7e,0xec,0x2d,0x17,0x24,0xca,0x95,0x19,0xc9,0x9f,
+0x86,0x04,0x2f,0x1f,0xad,0x4e,0x7c,0x31,0x93,0x46,0x8c,0xf0,0xe4,0xd8,0x11,0x43,0xf9,0x0a,0x67,0xe2,0x1c,0x31,0x94,0x94,0x9c,0xdc,0xe4,0x8f,0xe3,0x28,0x07,0x5a,
+0xe7,0x6a,0x33,0x4a,0x49,0xbe,0x4c,0xa3,0xf5,0xc9,0xb1,0x8c,0x04,0x9b,0xd1,0x46,0x12,0x8b,0xc9,0x5f,0x2d,0x34,0xbe,0xea,0x74,0x19,0x79,0x79,0x10,0x47,0xad,0x87,
+0xc0,0x61,0xcd,0xa6,0xb4,0xc2,0x76,0x3b,0x54,0x7e,0xfe,0x99,0x64,0x2f,0x62,0x7f,0x19,0x92,0x76,0xfb,0x74,0x72,0x41,0xbc,0x5c,0x49,0xd2,0x38,0x8f,0xf3,0x55,0x42,
+0x94,0xb9,0x9b,0x9d,0x5e,0x47,0xaf,0xd2,0x38,0x21,0x69,0xbe,0x52,0x3c,0x37,0x0c,0x01,0x8d,0xe0,0x93,0xa9,0xbb,0x0c,0x73,0x41,0x7a,0x10,0x2a,0xfc,0x7a,0x18,0x6e,
+0x0e,0xae,0xdc,0xb4,0xf5,0xdc,0x59,0x93,0x9b,0x24,0x4e,0xf3,0x6c,0xb8,0xde,0x6c,0xe4,0x9b,0xda,0xed,0x48,0x2c,0x70,0x88,0xd2,0x1a,0xa9,0x43,0x47,0x78,0xf8,0xe8,
+0xf1,0x93,0xa7,0xcf,0xbe,0x3d,0x3e,0xf9,0xee,0xfb,0xe7,0x2f,0x5e,0x9e,0xbe,0xfa,0xe3,0xeb,0x37,0x6f,0xdf,0xfd,0xf0,0xa7,0x3f,0xff,0xd3,0x8f,0xee,0xc4,0x03,0xe6,
+0xb3,0x79,0x70,0x71,0x19,0x2e,0xa2,0x38,0xf9,0x25,0xcd,0xf2,0xe5,0xd5,0xf5,0xcd,0xea,0x83,0xaa,0xe9,0x86,0x69,0xf5,0xfa,0xf6,0xa0,0x73,0x24,0xc8,0x53,0x67,0x0d,
+0x80,0xc3,0x61,0xc9,0x3b,0x93,0xfd,0x52,0xc6,0x6c,0x3c,0xf6,0x6f,0xb3,0xfb,0xf7,0xef,0x1b,0x7a,0xd7,0xdf,0xc8,0x40,0x98,0x7e,0x92,0x10,0x49,0x28,0x2d,0x10,0x92,
+0xc8,0x0f,0xdc,0xa8,0x42,0x2a,0xad,0x83,0xa9,0x98,0x29,0x54,0xb1,0xe9,0xd2,0xcb,0xe3,0xd4,0x71,0x5e,0x2e,0x17,0x13,0x92,0x4a,0x07,0x9c,0xc5,0x54,0x41,0x1c,0xc0,
+0xd5,0x96,0xda,0x5a,0xaf,0xaf,0x69,0x03,0xc3,0xba,0x2d,0x1f,0xea,0xa6,0xd4,0x36,0xf5,0xbe,0xad,0x5b,0x96,0xd1,0x53,0x47,0xd3,0x38,0x15,0x51,0x05,0xbe,0xa3,0x8e,
+0xfc,0x71,0xa6,0x84,0x24,0x9a,0xe5,0xf3,0x91,0xdf,0xe9,0x48,0xd9,0x99,0x7f,0xee,0x4c,0x15,0x06,0x41,0xc4,0x3b,0x69,0x54,0xa0,0x04,0x11,0xdc,0xc8,0x8f,0x17,0x8f,
+0x56,0x39,0xc9,0x6a,0xf0,0xb6,0x0c,0xcf,0xce,0x47,0xd9,0x7d,0x75,0x94,0x75,0xbb,0xd2,0x81,0xaf,0x24,0xcb,0x6c,0x2e,0xbe,0x70,0xf3,0xb9,0x32,0x0d,0x63,0xa0,0xa1,
+0x97,0x8c,0x89,0x28,0xdd,0xd3,0xad,0x9e,0x54,0x72,0x07,0xb9,0x27,0xc8,0xf7,0x6d,0xfc,0xa7,0x38,0xf5,0x3f,0xcd,0x5e,0x76,0x1d,0x55,0xf6,0x00,0xb8,0xbb,0x05,0xee,
+0x76,0x3a,0xb2,0xd7,0x71,0x6c,0x58,0xf2,0xcc,0x03,0x1d,0x5a,0xe7,0xb7,0x4e,0x76,0xe6,0x9e,0x8f,0xc7,0xba,0xd9,0xf5,0xbe,0x36,0xf4,0xca,0x22,0xd7,0xc8,0xfd,0x6d,
+0xfc,0x79,0x19,0x70,0x91,0xca,0x02,0xf7,0x80,0x83,0xcb,0xf8,0x33,0x91,0x80,0x39,0x5d,0x06,0xfe,0xc0,0x0a,0x2e,0xac,0xd0,0x06,0xd5,0xee,0x91,0xe5,0x98,0xdc,0xdc,
+0x75,0x11,0x94,0xa2,0x5c,0x00,0x57,0x40,0xee,0x26,0x6c,0xb9,0xf8,0x4d,0x9e,0x06,0xd1,0x4c,0xd4,0x40,0x5b,0x72,0x75,0xbc,0xad,0x59,0x3b,0xc3,0x25,0x00,0xe5,0x22,
+0x0e,0x22,0x51,0x10,0xa4,0x8d,0x3c,0x27,0x37,0xbf,0x53,0x5c,0x94,0x55,0x2f,0xa1,0x24,0x6e,0x9a,0x91,0x93,0x28,0x07,0x07,0xcc,0x96,0x13,0x70,0x40,0xd1,0x95,0x75,
+0x49,0xd6,0xf6,0xda,0xee,0x91,0x9b,0x91,0x9e,0xf9,0x7b,0x16,0x32,0xa4,0x83,0x82,0xc2,0xe3,0x46,0xd3,0x7a,0xb7,0x70,0xd1,0xd1,0xe0,0xd2,0xa6,0x57,0xfa,0xb9,0x1c,
+0xc0,0xc4,0x60,0x6c,0x8e,0x02,0x54,0x92,0x7b,0xcf,0xee,0x04,0xf7,0x7a,0x63,0xa7,0x34,0x90,0xfd,0x80,0xa3,0x0d,0x15,0x6f,0xee,0xa6,0x0f,0x73,0x11,0xfd,0xa0,0x77,
+0x4f,0x34,0xba,0x81,0xd4,0xee,0x19,0x92,0x34,0xe4,0x04,0x82,0x23,0xec,0x55,0xd3,0x84,0x22,0xdf,0xa7,0xa9,0x0c,0x96,0x49,0x49,0x12,0xba,0x1e,0x11,0x8f,0xce,0x7e,
+0x7a,0xd8,0xfd,0x51,0xed,0x0e,0x3a,0xef,0x8f,0xce,0x8f,0x82,0x99,0x0c,0x73,0x47,0x5f,0x72,0x4f,0xcf,0xe9,0x74,0xdc,0xaf,0x4d,0xe9,0xc0,0x3b,0x74,0xd4,0x76,0xbb,
+0x30,0x61,0xa8,0x04,0x91,0x4f,0x6e,0x4e,0xe9,0xd6,0x66,0xa0,0xdd,0xae,0x26,0x49,0x6d,0xba,0x4b,0x92,0xf8,0x5a,0xd4,0xe5,0xae,0x7e,0xcf,0xeb,0xd8,0x12,0x3c,0x1e,
+0x8f,0xbd,0x7b,0xfa,0xed,0xbe,0x39,0x92,0x84,0xa2,0x76,0x61,0xb8,0x62,0x90,0xcd,0xe8,0x46,0xe1,0xd1,0xcf,0x99,0xd2,0xb0,0x8c,0x08,0x8f,0x9d,0xf2,0xa9,0xfc,0xcc,
+0x59,0x2f,0xf3,0xa9,0x3d,0x5c,0x67,0xd4,0x7f,0x1a,0x92,0x6f,0x63,0xf5,0x33,0x65,0x12,0x44,0x4a,0x8d,0x4c,0x5c,0x46,0x24,0xf3,0xdc,0x84,0x88,0x24,0xf2,0x62,0x9f,
+0xbc,0x7b,0x7d,0xf2,0x38,0x5e,0x24,0x71,0x04,0x89,0x01,0x66,0x4a,0x52,0xe9,0x11,0xcc,0x3b,0xf7,0xb1,0xf5,0x49,0x63,0x26,0xe7,0xc9,0x16,0xac,0x31,0x60,0x4c,0x81,
+0x6b,0x10,0x7d,0x0e,0x71,0x61,0x8a,0x29,0x9a,0x22,0x03,0x33,0x64,0xe3,0xb0,0x30,0x43,0x86,0xae,0x33,0xad,0xba,0xc9,0x63,0x58,0x1f,0x34,0x98,0x49,0xb5,0xdd,0x3b,
+0xfd,0x1c,0xf6,0xbb,0x2e,0xc0,0xa6,0x2a,0xd3,0x34,0x5e,0x3c,0xe6,0x2b,0x89,0xe1,0x59,0x76,0xbe,0xdd,0x34,0xd3,0xad,0xf3,0x81,0x5c,0x27,0xce,0x33,0x6a,0xa1,0x53,
+0x67,0x8f,0xa6,0xc2,0x43,0x27,0x5a,0x86,0x90,0x32,0xc5,0x17,0xf0,0xf4,0xf6,0xf6,0x15,0xfd,0x7b,0x78,0x08,0x19,0x34,0xc8,0x1e,0x2d,0xa7,0x53,0x48,0x04,0x9b,0x51,
+0x99,0x67,0x5f,0x6c,0xa7,0x22,0x4d,0x25,0x6d,0xb4,0xdb,0x98,0x5a,0xe3,0x69,0xab,0xf6,0x54,0x29,0x98,0x38,0x8e,0x50,0x30,0x11,0x30,0x3f,0xef,0xa3,0x01,0xde,0x9b,
+0x83,0x72,0xa9,0x57,0x15,0x94,0x25,0xeb,0x94,0xb8,0xfe,0xb3,0x30,0x76,0xf3,0xe7,0x4f,0xeb,0x1c,0x4b,0x8a,0x2c,0x0c,0x3c,0x52,0x1f,0x03,0xd0,0xec,0xb1,0xa8,0xca,
+0x2a,0x98,0xfa,0xa0,0x99,0xaf,0x8f,0x21,0xdd,0x9e,0x28,0xe8,0xb4,0xa0,0xf9,0x53,0xd9,0x87,0x1b,0x70,0x07,0xd8,0x71,0x25,0xa5,0x27,0x07,0xd2,0xda,0xab,0x27,0x4a,
+0x66,0x89,0x07,0x41,0xbb,0x1d,0x28,0xd4,0x59,0xe1,0xce,0x81,0xb5,0x61,0xaa,0x9b,0xae,0x84,0x07,0x9e,0xe3,0xef,0xf8,0xb6,0x27,0x0d,0x3d,0xc8,0x81,0x8d,0x87,0xf8,
+0x07,0xc8,0x1f,0xa6,0xa9,0xbb,0xaa,0x14,0x2a,0x14,0x35,0xab,0x4f,0x3c,0x80,0x3e,0x3c,0x64,0x04,0x41,0x46,0x7f,0x61,0x4e,0xbb,0x5d,0x83,0x74,0xe8,0x38,0xef,0x82,
+0x28,0xb7,0xe9,0x30,0xd8,0xd4,0x73,0xbc,0x6d,0x14,0x97,0xb6,0xe1,0x24,0x75,0x42,0xa5,0x9a,0x12,0x81,0x93,0x9c,0x00,0x6d,0x11,0xf2,0xe4,0xc8,0xd1,0xfa,0x86,0x6e,
+0xd9,0x26,0x24,0x7b,0x99,0x38,0x5d,0xbd,0x0f,0xf7,0x86,0xdd,0x1f,0xc8,0xb1,0xd3,0x2d,0x87,0x4c,0x39,0x77,0x8a,0x11,0x5b,0x5e,0x82,0xcb,0x2e,0xc7,0x69,0xe1,0xb2,
+0x4b,0x74,0xd9,0xf4,0x6c,0x79,0xee,0x88,0xf8,0x17,0x03,0x2e,0xfe,0xd2,0xbc,0x56,0x29,0x24,0xf8,0xa0,0x6e,0x16,0xa3,0x76,0xad,0x9e,0x48,0xcf,0x12,0x9e,0x75,0x35,
+0xdd,0x1e,0x8f,0x13,0xc8,0x87,0x72,0x7a,0x26,0x26,0x9d,0x9e,0x09,0xcf,0x07,0xe3,0xb1,0x29,0x75,0x34,0xf3,0xdc,0x49,0x4a,0xd9,0x16,0x8e,0xab,0xfc,0x3c,0x9d,0xca,
+0x33,0xfc,0x9d,0xcd,0xe4,0x39,0xfe,0xce,0xe7,0xf2,0x0a,0x7f,0x83,0xa0,0x09,0xd3,0x81,0x7c,0x43,0xdd,0xe0,0xb1,0x13,0xc9,0x6f,0x1c,0x22,0x5f,0x3a,0xb1,0xfc,0xb3,
+0x93,0x8f,0x22,0x67,0x21,0x46,0x32,0x91,0x63,0x39,0x87,0x35,0x97,0x1d,0xf5,0x5c,0xee,0xcb,0xdd,0x9e,0xad,0xda,0xfd,0xde,0xc0,0xe8,0x49,0x20,0xfd,0x42,0xcc,0x65,
+0x46,0x82,0x04,0xda,0xb9,0xac,0x41,0x60,0x35,0xec,0x81,0xd5,0x33,0x2d,0x1b,0x28,0x62,0xa0,0xc0,0xe9,0x48,0x83,0x14,0x90,0x6e,0xb4,0xbe,0xdc,0x53,0x7b,0x9a,0x6a,
+0xd9,0xda,0x40,0x02,0xdd,0x2e,0x44,0xb6,0x42,0x44,0x09,0x8c,0x73,0x59,0x07,0x16,0x9a,0x6a,0x9a,0x96,0x6e,0x19,0x86,0x2a,0xc9,0xbb,0x30,0x4c,0x0a,0x43,0xeb,0xf7,
+0x4c,0xcd,0xb6,0x07,0xfd,0x26,0x0c,0x8b,0xc2,0xd0,0x74,0x55,0x55,0x6d,0xd5,0xd4,0xf7,0xc0,0xe8,0x51,0x18,0x5d,0xcd,0x04,0x4b,0x1a,0x9a,0x61,0x6a,0x4d,0x20,0x7d,
+0x06,0xc4,0xb4,0xfa,0xaa,0x35,0xb0,0x8d,0x26,0x0c,0x1b,0x61,0x68,0xfd,0xbe,0xaa,0x1a,0x96,0xa9,0xed,0xd1,0xc6,0x80,0x69,0x43,0x1b,0xa0,0xaf,0x98,0xa6,0xd6,0x6f,
+0xe2,0xd0,0x54,0x06,0xc4,0xd4,0x55,0x48,0xa4,0x0d,0x0c,0x9a,0xc6,0xb5,0x31,0x18,0xa8,0xa6,0x0a,0x8b,0xe8,0x4d,0x18,0x9a,0x4e,0x71,0x80,0xa0,0x3d,0xd5,0xe8,0xd9,
+0xfa,0x1e,0xab,0x18,0x0c,0x88,0xa9,0x82,0xa0,0x9a,0xaa,0xed,0x81,0x61,0x72,0x7d,0x58,0x2a,0x28,0x4d,0xd7,0x07,0xea,0x1e,0x2c,0x16,0xc5,0x02,0x25,0x7a,0xcf,0x32,
+0x2c,0x43,0x1f,0x20,0x94,0x59,0x1d,0xca,0xb9,0x6c,0x01,0x93,0x9e,0xd5,0x1f,0xf4,0x2c,0x4d,0x45,0x24,0xb3,0x1a,0x12,0x50,0xfb,0x00,0x6d,0xdb,0x1b,0x58,0xaa,0xd6,
+0x33,0x74,0x44,0x32,0xab,0x23,0x41,0x17,0x32,0xe5,0x9e,0x69,0xc0,0xb6,0xea,0x6b,0x54,0x27,0xb3,0x1a,0x0e,0xd0,0x98,0xae,0x82,0x8f,0xf5,0xc1,0xcb,0xfa,0x86,0xaa,
+0x37,0x61,0x58,0x14,0x46,0x5f,0xd5,0x2c,0x70,0xc1,0x81,0xd6,0x84,0x81,0x5a,0x1f,0xc8,0x86,0x0d,0x18,0x54,0xb4,0x6c,0x03,0x84,0x45,0x41,0x74,0x7b,0x3d,0xd5,0xec,
+0xdb,0x86,0x61,0x35,0x51,0x98,0x0c,0x85,0xa9,0xc2,0x2e,0xed,0xdb,0xa6,0xdd,0x44,0x31,0x40,0x14,0x56,0xcf,0x36,0x4d,0x10,0xc6,0xde,0x03,0xc2,0xe4,0xca,0xd0,0x06,
+0x36,0x18,0x0e,0x55,0xbe,0x8b,0xc3,0x60,0x30,0x34,0xbb,0x6f,0xf4,0x8c,0x41,0x4f,0x6b,0xc2,0xb0,0x29,0x0c,0x0d,0x74,0x69,0x19,0x60,0x3c,0x6d,0x8f,0x4d,0x0c,0x66,
+0x14,0x13,0x70,0xd8,0x9a,0xd9,0xeb,0x37,0x91,0xe8,0x14,0x88,0xa5,0x81,0x7f,0x80,0x28,0x4d,0x18,0x7d,0x0a,0x03,0xa2,0x1c,0x58,0xdd,0x86,0x1d,0xd3,0x84,0x81,0x3e,
+0x88,0xea,0xd0,0x06,0x3a,0xe8,0xac,0xdf,0x37,0x4c,0x04,0x32,0xdf,0xb5,0x8a,0x89,0x66,0xb3,0xc1,0x2a,0x88,0x61,0x5e,0xc3,0x00,0x82,0x68,0x1a,0x94,0x64,0xe0,0x7c,
+0x56,0x1f,0xa0,0x52,0xab,0xcc,0x9b,0xae,0xd1,0x03,0x4f,0x37,0x06,0xaa,0xa1,0x5a,0xb8,0x17,0x08,0x90,0xd4,0x70,0xa0,0x59,0x0c,0x58,0xc5,0x32,0xd4,0x81,0x05,0x47,
+0xa0,0x06,0x0a,0x8d,0xa2,0xd0,0x70,0x7c,0x00,0x7b,0x4e,0x6d,0x22,0x31,0x29,0x12,0x4d,0xef,0xeb,0xf6,0x00,0x4c,0xbf,0x07,0x48,0x9f,0xe2,0x00,0x26,0x96,0x39,0xe8,
+0x53,0x2f,0x6e,0xe0,0x50,0x19,0x0e,0x4d,0x1d,0x80,0xbe,0xd4,0x9e,0xa9,0xee,0x41,0x62,0x20,0x14,0xb0,0x89,0xde,0x1f,0x68,0x7d,0xb3,0x09,0x44,0x65,0x2a,0x31,0x2c,
+0x1b,0x5c,0x4c,0xd7,0xf5,0x26,0x10,0x83,0x01,0x81,0x41,0x4b,0xd7,0x06,0xfd,0x41,0x13,0x48,0x8f,0xe2,0xe8,0xf7,0x54,0x7d,0xa0,0xd9,0x83,0x26,0x88,0x01,0x55,0x07,
+0xe0,0x33,0x7a,0xa6,0x69,0xf7,0x9b,0x20,0xd0,0xb2,0x88,0xc2,0xd4,0x35,0x5b,0xb3,0x6c,0xdc,0x0a,0x0d,0xbb,0x58,0x14,0x06,0xa8,0xb4,0x6f,0x02,0x10,0xb5,0x89,0x42,
+0x67,0xda,0x18,0x0c,0x20,0x9e,0xdb,0x10,0x19,0x10,0xc7,0x6a,0x37,0xb3,0xa0,0x46,0x07,0x76,0xcf,0x50,0x61,0xc7,0x20,0x8e,0x55,0x0d,0x07,0xea,0x1c,0x1d,0x5d,0xef,
+0xd9,0x03,0xcd,0xd4,0x28,0x8c,0x55,0x33,0x86,0x51,0x4f,0xc7,0xdd,0x60,0x0e,0x54,0xba,0x6b,0x57,0x35,0x20,0x18,0xc2,0x40,0x18,0xf0,0x30,0x03,0x77,0x6e,0x13,0x07,
+0x8a,0x0b,0x2e,0x06,0x31,0xdd,0x04,0x3f,0xed,0x6b,0x4d,0x20,0x06,0x05,0x02,0x7b,0x72,0x60,0x02,0x5a,0x48,0x64,0x7b,0x90,0xa8,0x1c,0x89,0x6a,0x69,0x96,0x6e,0x34,
+0x61,0x68,0x0c,0x86,0xae,0x02,0x4c,0x1d,0xcc,0x3f,0x68,0x02,0xb1,0x29,0x0e,0xd8,0xf8,0x90,0x9d,0x0c,0x6b,0xd0,0xc4,0x41,0xb5,0x8e,0x71,0x10,0x52,0x29,0xb8,0x8f,
+0xd9,0x84,0xd1,0xe3,0x28,0xac,0x1e,0x86,0x18,0x88,0x76,0x7b,0x80,0x18,0x14,0x89,0x06,0xbb,0x41,0xb3,0xb4,0x9e,0xb9,0x07,0x88,0xc9,0x2c,0x63,0x5a,0x20,0x89,0xda,
+0x57,0xf7,0x00,0xd1,0xb8,0x46,0x20,0xdf,0xea,0x1a,0x84,0x90,0x41,0x13,0x8a,0x4e,0xa1,0xf4,0x41,0x1e,0xbb,0xaf,0x5b,0x83,0x26,0x90,0x01,0xd3,0x88,0x01,0x76,0x01,
+0xbd,0x33,0x0f,0x89,0x3a,0x8f,0xa1,0xc2,0x51,0x81,0x96,0x74,0xde,0xd0,0xab,0xd8,0x89,0x3b,0x97,0xf4,0x2a,0x77,0xf2,0xce,0xcf,0x78,0xb5,0x29,0x9a,0x34,0x61,0xd1,
+0x57,0x39,0xe3,0xe8,0xcf,0xa1,0x6c,0xa7,0x85,0x50,0xad,0x84,0x95,0x53,0x39,0x61,0xe0,0x59,0xc9,0x93,0x3b,0x5e,0x47,0x0c,0xda,0xe9,0xed,0x5f,0x83,0x76,0x22,0x75,
+0xc4,0x08,0x99,0x4a,0x9d,0x98,0x9f,0x24,0xc4,0x7c,0x3c,0x26,0xb7,0x39,0xeb,0x33,0x11,0xa9,0x13,0x6c,0x64,0x5a,0x54,0xdd,0x85,0x67,0x72,0x9b,0xb6,0xff,0x7a,0x67,
+0x9e,0xf3,0xf9,0x1d,0x78,0xfe,0x94,0xfe,0x74,0x67,0x86,0x41,0xf0,0x65,0x86,0xe9,0x4f,0x62,0x70,0x0b,0x18,0xef,0xca,0x73,0x12,0xc6,0xde,0x65,0x16,0x7c,0x20,0x50,
+0x32,0xe2,0xbd,0x1f,0xcc,0x48,0x96,0x17,0x0f,0x9e,0x6f,0x4f,0xc5,0xb5,0x43,0x43,0x30,0x85,0x3a,0x9c,0x9e,0xb2,0xa4,0x83,0x7c,0x9e,0xc6,0xd7,0xad,0x88,0x5c,0xb7,
+0x9e,0xa6,0x29,0x14,0xac,0xc2,0x4b,0x3c,0xfd,0xe7,0xd1,0xc7,0xbf,0xb5,0xdc,0x74,0x46,0x7b,0xa6,0x2d,0xa1,0xe3,0xb1,0x23,0x35,0x56,0xe9,0xd5,0x9e,0x92,0xe8,0x52,
+0x86,0xe5,0x31,0x8f,0x9e,0x3b,0xdc,0x8c,0x8e,0x3d,0x48,0x87,0xfc,0x96,0x1f,0x4a,0xfc,0x9d,0x43,0x6e,0x2a,0x0d,0xcb,0x9a,0xff,0x98,0xdc,0xc0,0xfd,0xa6,0x3c,0xbb,
+0xbf,0x73,0x4a,0xec,0xbc,0xc5,0xfa,0xda,0x79,0x28,0xbe,0x2b,0x16,0x5a,0xbf,0xde,0x69,0xbf,0xea,0xbc,0xfd,0x8a,0x73,0x7f,0x5e,0xc4,0xbe,0x1b,0x3e,0xce,0x32,0x47,
+0x50,0xe8,0x65,0x37,0xbe,0x22,0x69,0xe8,0xae,0xd6,0x49,0x9c,0x05,0xa8,0x85,0xe1,0x34,0xb8,0x21,0xfe,0x28,0x88,0x32,0x92,0x0f,0xd5,0xd1,0xc4,0xf5,0x2e,0x67,0x69,
+0xbc,0x8c,0xfc,0x61,0x3a,0x9b,0xb8,0x78,0x26,0xc3,0xff,0x0a,0x1e,0x93,0xfd,0x20,0x03,0x75,0xac,0x86,0xd3,0x90,0xdc,0x8c,0xdc,0x30,0x98,0x45,0xdd,0x20,0x27,0x8b,
+0x6c,0xe8,0x81,0x62,0x48,0x3a,0xba,0x58,0x66,0x79,0x30,0x5d,0x75,0x3d,0xd6,0x27,0x2e,0x1e,0x7f,0xe8,0xd2,0xd6,0xc5,0x70,0x00,0xff,0x36,0x42,0xe7,0xa0,0x40,0x32,
+0x89,0x6f,0xd6,0x95,0xe5,0xfe,0x30,0x9d,0x4e,0x47,0x13,0x50,0x28,0x49,0xbb,0xa9,0xeb,0x07,0xcb,0x6c,0xa8,0xf4,0xad,0x94,0x2c,0xe0,0xe1,0x4d,0x37,0x9b,0xbb,0x7e,
+0x7c,0x3d,0x54,0x5b,0x76,0x72,0xd3,0x32,0x74,0xf8,0x53,0x81,0xa7,0xe8,0xb6,0x34,0x4a,0x5c,0x1f,0x4f,0x78,0x43,0x5d,0xc1,0x49,0x2d,0x1d,0x67,0x62,0xd7,0xba,0x4b,
+0x91,0x16,0x60,0x16,0x41,0xd4,0xbd,0x0e,0xfc,0x7c,0x3e,0xd4,0x75,0x35,0xb9,0x61,0x78,0xb2,0x24,0x88,0x22,0x92,0xae,0xd9,0x80,0x05,0xdc,0x47,0x73,0x12,0xcc,0xe6,
+0x39,0xbb,0x66,0xa0,0x86,0x16,0x2c,0x9a,0xc5,0x61,0xe0,0xb3,0xa5,0x75,0x0b,0x22,0xbe,0x0d,0x91,0x01,0xd6,0x87,0x90,0x5f,0x40,0xcf,0xe3,0x04,0x14,0x10,0xc6,0xe9,
+0xf0,0x0f,0x90,0xf5,0x7a,0xbe,0xbe,0x23,0x93,0xa5,0x7e,0x3d,0x72,0xa3,0x60,0xe1,0x52,0xe5,0xe3,0xca,0x2d,0xc5,0xce,0x5a,0x61,0x10,0x11,0xb0,0x57,0x10,0x4d,0x83,
+0x08,0x94,0x3a,0x5a,0x80,0xc3,0x05,0x11,0xc8,0xeb,0x2e,0xf3,0xb8,0xa5,0x29,0x3a,0x0a,0x45,0xd1,0x7e,0x73,0x49,0x56,0xd3,0xd4,0x5d,0x90,0xac,0x85,0xb3,0xd7,0x79,
+0xbc,0xce,0x53,0x37,0xca,0xe0,0x84,0xb5,0x18,0xc2,0xd9,0xd4,0xcd,0x89,0x08,0x67,0x33,0x9f,0xcc,0xc0,0x87,0x2a,0xea,0x5e,0x64,0xb3,0x35,0x07,0x86,0xb1,0x6e,0xa0,
+0xf3,0x35,0xc0,0x0e,0x79,0x1e,0x2f,0x0a,0x65,0x4f,0xc1,0x78,0x5d,0xdc,0x34,0x43,0x4d,0x51,0xe9,0x93,0xeb,0x39,0x00,0xea,0x66,0x89,0xeb,0x91,0x61,0x92,0x92,0x2e,
+0x42,0xad,0x32,0xf6,0xa2,0x7c,0xbd,0x9d,0xc5,0xd4,0xcf,0xd8,0x5c,0x33,0x25,0x42,0xc2,0x1a,0xd5,0x54,0x52,0xf3,0x82,0x3c,0xea,0xc2,0xae,0x5b,0xd7,0x9c,0x6b,0xe6,
+0x26,0x05,0x9e,0x4f,0x38,0x15,0xc7,0x0e,0xda,0x1e,0x56,0x95,0xb3,0x65,0xba,0x2e,0xfc,0x41,0xe9,0xa1,0x3b,0x68,0x0a,0x77,0x25,0x6a,0xca,0x28,0x8e,0xc8,0xae,0xaf,
+0xed,0x4a,0xbf,0x2b,0x45,0x0f,0xa5,0x58,0xa6,0x19,0x88,0x91,0xc4,0x01,0x82,0xd8,0x15,0x63,0x45,0xb2,0x9a,0x43,0x73,0xfb,0x73,0xd1,0xc1,0xbd,0x77,0x27,0x44,0x71,
+0x95,0x9e,0x5a,0x31,0x71,0x53,0x10,0x70,0x54,0x37,0x14,0x47,0xad,0x68,0x54,0xd0,0x4f,0x39,0xa1,0x2e,0x6d,0x84,0x6d,0x2f,0x88,0x44,0xd9,0x32,0x25,0x2f,0xf8,0xf6,
+0x17,0x69,0xa0,0x3b,0xfc,0xd4,0x9b,0x1f,0x21,0x2d,0x08,0x05,0x89,0x45,0xe0,0xcc,0x29,0x69,0xbd,0x94,0x80,0x4f,0x71,0x72,0x51,0xc8,0xf2,0x55,0x48,0x04,0x69,0x94,
+0x29,0x81,0xef,0x54,0x26,0xc2,0x83,0xea,0x4b,0xa2,0x32,0xf2,0x8c,0x4a,0x46,0x73,0xe2,0xfa,0x8a,0x9b,0x24,0x90,0x0b,0x1f,0xcf,0x83,0x90,0xbe,0x70,0xda,0x54,0x7a,
+0x4a,0xd9,0x3c,0xbe,0x7e,0x0d,0x21,0xdb,0x4d,0x73,0xca,0x55,0xcc,0x08,0x58,0xdd,0xcf,0x64,0xf0,0xf5,0xcc,0x9d,0x11,0x69,0xbd,0x2b,0x14,0x8d,0x8f,0xe0,0xd8,0x8e,
+0xc8,0x49,0x0e,0x1d,0x07,0x54,0x49,0x60,0x13,0x11,0x5f,0x7a,0xc0,0x1f,0x0e,0x85,0xd7,0xe4,0xb7,0x5f,0x91,0x6d,0x0b,0xfc,0x77,0x12,0x90,0xb9,0xab,0x28,0x8a,0x40,
+0x27,0xfb,0xc1,0xd5,0x27,0x25,0x85,0x31,0x01,0xa3,0xde,0x95,0xe2,0x85,0x6e,0x96,0xbd,0x84,0x3d,0xe7,0x08,0xb5,0x28,0x2a,0xd0,0x51,0x1a,0x3c,0x8e,0xdf,0xbe,0x78,
+0xee,0x08,0x63,0xb8,0x6f,0x51,0x6a,0xe7,0xbd,0x50,0x86,0xb9,0xf7,0xc2,0x7d,0xb4,0x7c,0x6d,0x90,0xc7,0x1c,0x18,0x1a,0x1f,0xc1,0x73,0x46,0x90,0xec,0xcc,0x05,0xd1,
+0xe8,0x5c,0xf8,0xed,0x08,0xe3,0xa3,0xa4,0xc9,0xa6,0xdc,0x82,0xef,0x85,0x16,0xd8,0xe3,0xbd,0x90,0x3e,0xc6,0x6b,0x20,0xe4,0xca,0xc3,0x79,0x25,0x7f,0x76,0xb5,0xb5,
+0xc8,0x24,0xf6,0x57,0x35,0x8b,0xc0,0x38,0x53,0x6a,0xe4,0xf0,0xf9,0x23,0x96,0x8f,0x21,0x3b,0x9c,0xa0,0xcf,0x5f,0x81,0x59,0x2a,0xfd,0xb9,0xa8,0xdb,0xa5,0x04,0x24,
+0x74,0x3e,0xed,0x5b,0x80,0x08,0xf4,0x08,0xfe,0x47,0x42,0x89,0x84,0x35,0x2f,0x89,0xf0,0x71,0x34,0x76,0x54,0x69,0xed,0x85,0x10,0x00,0xcb,0x35,0x72,0x69,0x04,0xe9,
+0x9c,0x06,0x49,0x65,0x9e,0x92,0xa9,0x23,0x1c,0x09,0xe0,0x2c,0x50,0xcc,0xa9,0x2a,0x78,0x0d,0x2f,0xac,0xd6,0xbb,0x2e,0xb3,0x93,0x0a,0x8d,0xea,0xfb,0x4f,0xfa,0x2e,
+0x53,0x3e,0x39,0xde,0x38,0x5f,0x2d,0x54,0x46,0x02,0xb9,0x13,0x6e,0x34,0x7e,0xd3,0x60,0x06,0x63,0x3a,0xe7,0x75,0xe5,0x84,0x95,0xb7,0xa1,0x54,0xfb,0xcf,0x83,0x2c,
+0x57,0x60,0x3f,0x82,0x2f,0x88,0xc2,0x3c,0xf0,0x7d,0x12,0x81,0x98,0x1b,0x3e,0xe1,0xf8,0x13,0x13,0x20,0x2a,0xed,0xa1,0xbe,0xde,0x52,0x0b,0x49,0x1a,0xcf,0x4e,0xa2,
+0x69,0x2c,0xd4,0xdf,0xba,0x86,0x25,0xf1,0xd3,0x0a,0x31,0x49,0xd3,0x3d,0x74,0xe5,0x96,0x9a,0x06,0xbe,0x38,0x59,0x4e,0xe5,0xdc,0x9d,0x49,0xfc,0x2d,0xf0,0xc4,0xc1,
+0x02,0x67,0xdb,0x88,0xc4,0xf1,0x42,0x63,0x39,0x1b,0x7c,0x0b,0xec,0x9e,0xd2,0xf6,0x7e,0x2a,0x4a,0xac,0x77,0x4a,0x44,0x64,0x41,0xdb,0x78,0x21,0xc9,0x5b,0xec,0xad,
+0x8c,0x33,0xe1,0x7d,0xba,0x6e,0x5e,0x5c,0xd1,0xf7,0x34,0x6b,0x24,0x99,0x62,0x50,0x73,0xf2,0x74,0x49,0xca,0x59,0x17,0x30,0xeb,0x62,0xbc,0xa5,0xbd,0x40,0x5a,0x70,
+0x80,0xc9,0x59,0xd0,0xb9,0x38,0x87,0xbd,0x9b,0x4f,0xce,0x2e,0xce,0xb1,0xd7,0x8e,0x53,0xa7,0x6e,0x98,0x41,0x94,0x86,0x3d,0x79,0x89,0x61,0x02,0xe8,0xe8,0x73,0xc6,
+0x3d,0x98,0xe0,0x1b,0x47,0xbc,0xba,0x74,0x82,0xce,0x96,0x25,0x24,0xab,0x90,0x88,0x97,0xe3,0xe2,0x41,0xbb,0x3d,0x39,0xbb,0x44,0xd6,0xe0,0x61,0xc1,0x84,0xb5,0xe8,
+0xf1,0x89,0x34,0xba,0xec,0x74,0x4a,0x3f,0x6a,0x15,0x52,0x3f,0x21,0x85,0xd4,0xec,0x25,0x85,0xb8,0xa3,0xab,0x60,0x22,0xd1,0x98,0x55,0x4c,0x83,0xb2,0x11,0x98,0x30,
+0xe5,0x3d,0xd1,0x1c,0x37,0x5b,0x45,0x9e,0x38,0x05,0x97,0xc3,0x79,0xaf,0xd2,0x78,0x11,0x64,0x44,0x14,0x53,0x02,0x21,0xfb,0x0a,0x4e,0x1b,0x04,0x5f,0x75,0xa3,0x43,
+0x22,0x70,0xec,0x96,0x93,0x94,0x2a,0xfc,0x19,0x80,0x7e,0x4d,0x6f,0x45,0x2c,0xeb,0xf0,0x42,0x89,0xa3,0x30,0x76,0xfd,0x6d,0xb5,0x4a,0xae,0xc0,0xba,0x85,0x11,0x5d,
+0x44,0xc3,0x7b,0xf7,0x74,0x40,0x01,0xaf,0x85,0x8d,0x07,0xfe,0x98,0x2d,0xc3,0x9c,0x9b,0x73,0xe1,0x5b,0xce,0x6b,0xb1,0x42,0x5b,0xd8,0x79,0x0e,0x95,0x8e,0x83,0xbe,
+0x51,0x19,0x93,0x85,0x6f,0xee,0xbd,0x78,0xf8,0x6d,0xe0,0xdd,0xfb,0x66,0x38,0xbf,0x1e,0x0a,0x05,0x2d,0x44,0xba,0xcf,0x91,0x5e,0x91,0x2d,0x69,0xe8,0x46,0xb3,0xcf,
+0xd1,0x86,0xb3,0x21,0x7d,0x07,0x47,0xb5,0x21,0xae,0x01,0x9e,0x8c,0x48,0x64,0x58,0x42,0xc6,0xb9,0x1b,0xdc,0x10,0xa5,0xf8,0x04,0x6b,0x70,0x87,0xe9,0xac,0x78,0x8a,
+0x3f,0x0f,0x59,0x7f,0x9d,0xbf,0x95,0x00,0xdf,0x85,0x69,0xa8,0x4f,0x64,0xf5,0xc7,0x25,0x49,0x57,0xb4,0x9a,0xe7,0x90,0x7c,0x72,0x75,0x8c,0xc2,0x62,0x18,0x28,0x09,
+0x6e,0x6f,0xc5,0x2d,0xf1,0x94,0xe4,0xde,0x5c,0x14,0x8e,0xb2,0x5f,0x1e,0xf8,0x37,0x0e,0x3e,0xc7,0x0d,0x35,0x27,0x91,0x98,0x3a,0xf7,0x53,0xe5,0x22,0xc3,0x40,0x07,
+0x3b,0xd8,0x45,0x32,0x02,0xb6,0xdb,0x59,0x87,0x1d,0x1a,0x08,0xa0,0x28,0xd4,0xf0,0x92,0xf9,0x41,0x2b,0xe4,0x86,0x86,0xe0,0x35,0x4d,0x05,0x1e,0x64,0x9a,0x42,0x3b,
+0xee,0xb5,0x1b,0xa0,0xfb,0x40,0xa0,0xc0,0x70,0x88,0xa3,0xc5,0x7b,0x1f,0x20,0x3a,0xe4,0x87,0x93,0xf5,0x95,0x28,0x4c,0xc1,0x4f,0xf0,0xc3,0x08,0x48,0xd3,0xa3,0x93,
+0x63,0xb8,0xbf,0xc6,0xa4,0x24,0xc8,0xa1,0x12,0xc1,0x2f,0x7f,0x06,0x34,0x58,0xc1,0xe0,0x53,0xfc,0xad,0xbc,0x62,0xe8,0x08,0xad,0x47,0x7c,0x26,0x95,0x93,0x02,0xe1,
+0xb3,0x16,0xb0,0x94,0x80,0xa0,0x8a,0x7b,0xc4,0x26,0x50,0x84,0x0c,0xc1,0x03,0xbc,0x1c,0xe2,0x6b,0x4f,0x18,0xce,0x96,0x9e,0x07,0xc9,0xf5,0x75,0x7c,0x0d,0xf7,0x79,
+0xba,0xe2,0x6e,0xe9,0x7f,0xc7,0x85,0xe1,0x6a,0x17,0xa9,0x40,0xfe,0x77,0x0a,0x2e,0xd4,0x6e,0xf3,0x0b,0xc7,0xa1,0x6a,0x96,0x78,0x08,0xe3,0x2a,0x6f,0xc6,0xd4,0x94,
+0xf8,0xdd,0xfc,0x06,0x73,0x07,0x23,0x5c,0x26,0x3e,0xa4,0xe7,0x47,0x39,0x04,0x4e,0x05,0xca,0x45,0x77,0x12,0x92,0x22,0x4a,0x7c,0x2a,0x18,0x0a,0x02,0xa2,0x85,0xe7,
+0x0c,0xe9,0x86,0x00,0xf1,0xa7,0x96,0xa5,0x91,0xf9,0x4e,0x6b,0xd2,0xa0,0xf6,0x14,0x8f,0x87,0x1f,0xe6,0xb1,0x1f,0x7d,0xfc,0xb5,0x75,0xec,0xa6,0xfe,0x35,0x94,0x6e,
+0xad,0x93,0x27,0x0a,0x04,0x92,0x08,0x6a,0xf6,0x69,0x90,0x2e,0xae,0x3e,0xfe,0x2b,0xa4,0xd2,0x80,0xb4,0x2e,0x08,0x96,0x1e,0xad,0x3c,0x86,0x81,0x0f,0x6e,0x1a,0x80,
+0x33,0xc3,0x63,0x05,0x96,0xb9,0xaa,0xc0,0xab,0x45,0x95,0x0d,0xf7,0xb8,0x42,0x4d,0xff,0x77,0x48,0x8a,0x64,0x2b,0x80,0xef,0x0a,0x43,0x74,0x60,0xea,0x64,0xc2,0x30,
+0x94,0x99,0x16,0x87,0xf8,0x17,0x52,0xef,0x01,0xaa,0xf7,0x60,0x7d,0xfc,0x65,0x47,0xbd,0x83,0x48,0x27,0x90,0x76,0xd2,0x14,0xf6,0x7e,0x0b,0x99,0xb5,0x32,0x12,0xc2,
+0x35,0xf1,0x95,0x3d,0x0e,0x58,0x45,0xbe,0x13,0x9b,0xf9,0x96,0xfc,0x01,0x53,0x66,0xf1,0xbe,0xf6,0xbe,0xd6,0x6e,0x1f,0x2e,0x20,0x4c,0x06,0x49,0x48,0x1e,0x88,0x6e,
+0x48,0x52,0xa8,0xf6,0x5e,0x7c,0xfc,0x8f,0xdf,0xfe,0x8b,0xe4,0xa4,0x15,0xb9,0xf3,0xd4,0xfd,0xed,0x5f,0x20,0xc5,0xb8,0xa0,0x2d,0x50,0x4f,0x2b,0xfb,0xf8,0x9f,0x50,
+0x82,0xb7,0x44,0x7c,0xeb,0x28,0xc1,0x78,0xea,0x7e,0x00,0x18,0xf2,0xa1,0x06,0xa7,0xf6,0x33,0xf5,0x9c,0xca,0x04,0x87,0xc8,0x30,0x00,0x36,0x30,0xa0,0x24,0x71,0x22,
+0x4a,0x87,0xf4,0x4d,0xa3,0xb0,0x9f,0xff,0xc7,0x5f,0xaf,0x8a,0x25,0x18,0xf3,0x15,0xe7,0x5e,0xf0,0x3d,0x54,0xb7,0x49,0xfc,0x5b,0x28,0xb4,0xae,0xe1,0x0c,0x1d,0x5f,
+0x2b,0x65,0x4d,0x94,0x12,0xcc,0x0e,0x62,0xed,0x95,0xec,0xb7,0xe2,0x55,0xe1,0x2c,0x70,0x0c,0x04,0xf5,0xcf,0x00,0x0b,0x14,0x53,0x4b,0xe2,0x5c,0x8d,0x6a,0xcf,0xdf,
+0xa2,0x87,0x57,0xea,0xd6,0xab,0x5a,0x90,0xf8,0x1a,0x2a,0x2d,0xfa,0x5d,0x55,0x1e,0x2c,0xc8,0xe9,0x32,0xaf,0x96,0x13,0x51,0x90,0xcd,0x89,0x7f,0xfa,0x3d,0x40,0x3a,
+0x66,0xa5,0x0a,0x53,0x7b,0xa3,0x76,0xd7,0xc0,0x4b,0x5e,0xf1,0x6a,0xbb,0xe5,0x5e,0xe6,0x4b,0x38,0x86,0x7f,0xf8,0xf8,0xab,0x17,0xb8,0xa5,0x3f,0x2e,0x95,0xf7,0xd1,
+0x4b,0x72,0xb5,0x4a,0x3e,0xfe,0x5b,0xe4,0x5e,0x80,0x66,0xea,0xfe,0x58,0x11,0x6d,0xea,0x82,0x0b,0xf8,0x22,0x94,0xc1,0xd2,0xfa,0x29,0xfd,0xb9,0x6b,0x48,0xc0,0xf3,
+0x55,0x73,0xac,0x06,0xbd,0xee,0x3d,0x2c,0x74,0x6f,0xcf,0x24,0x28,0xd1,0xbb,0x84,0x2a,0x1b,0xfd,0x50,0x2e,0xe2,0xb7,0x54,0x0d,0xed,0xa0,0x7a,0x55,0xaa,0x45,0x9a,
+0x3d,0x2e,0xba,0x5d,0x11,0x03,0xe6,0xb5,0x28,0x30,0xb6,0xa0,0xf4,0x96,0xd0,0x41,0xde,0x7c,0x6f,0xf0,0x50,0xca,0x23,0x29,0x4b,0x4f,0x7f,0x39,0x02,0xcb,0x1d,0x51,
+0x30,0x0f,0xa0,0xe4,0x27,0xce,0x57,0xeb,0xe9,0xa6,0x3d,0x77,0xb3,0x39,0x5c,0x01,0x24,0xb8,0xc6,0xc0,0xfa,0x15,0x4d,0x4e,0x9b,0xbf,0xd0,0xb0,0x7b,0xe8,0x2b,0xf1,
+0x25,0xe4,0x8d,0xdd,0xae,0x16,0xbe,0xf5,0x76,0xf3,0x65,0x86,0xf5,0x0e,0x4a,0x8c,0x11,0x9a,0x3f,0x72,0x1c,0x5d,0xa5,0x1f,0xaa,0x6c,0x29,0xa0,0x74,0x12,0x4e,0xbf,
+0x17,0xee,0xc0,0x87,0x57,0x26,0x45,0x06,0xa0,0x71,0x98,0xd7,0xe2,0x31,0x08,0x17,0xc6,0x33,0x51,0x78,0x43,0x4f,0x61,0xa7,0x6f,0x1f,0x42,0xf5,0x93,0x25,0x30,0x02,
+0xd5,0x83,0xec,0x16,0x32,0x7b,0xac,0x18,0x8a,0xd3,0xc5,0x13,0x37,0x77,0x47,0xac,0xd0,0xc4,0x47,0x7f,0x7e,0xf1,0xfc,0x38,0xcf,0x93,0xd7,0xe4,0x97,0x25,0xf8,0xd8,
+0x28,0x50,0x62,0x38,0xb2,0x88,0xc2,0xab,0xd3,0x37,0x6f,0x05,0x59,0xa0,0xba,0x59,0x52,0x65,0xe2,0x39,0x43,0x61,0x97,0x18,0xcf,0x9f,0x62,0x69,0x84,0xc1,0x9d,0x80,
+0xa7,0x33,0x0b,0xc0,0xba,0x99,0x20,0x97,0x55,0x55,0xca,0xec,0x98,0x38,0xec,0x0b,0x35,0x2c,0x30,0xc5,0x54,0xc1,0xf9,0xc4,0x3f,0x4a,0x61,0x5b,0xe4,0x6e,0x78,0x4f,
+0xc3,0x33,0x07,0xd8,0x38,0x01,0x31,0x71,0x77,0x6e,0xd7,0x88,0xa3,0x82,0xa7,0x53,0x65,0x09,0x2a,0x2d,0x5e,0x61,0xe3,0x37,0x2e,0xcb,0x1c,0x9d,0xef,0xf7,0xae,0xb4,
+0x41,0x39,0x23,0xac,0x78,0x56,0xa8,0x68,0xe2,0xcd,0x21,0x01,0x13,0xa7,0x72,0xfa,0x82,0x65,0x02,0x5a,0x12,0xad,0xde,0x20,0x81,0xe3,0x98,0xd2,0x01,0x7d,0x56,0xb1,
+0xa6,0x74,0x50,0xdd,0xb4,0x23,0x8c,0xd0,0xad,0x1a,0x8d,0x09,0x34,0xac,0x1e,0x75,0x90,0x19,0xb3,0x0a,0xda,0x74,0xd4,0x6c,0x87,0xf2,0xc8,0x85,0x79,0xe4,0x43,0xb8,
+0x9a,0xbb,0x61,0x2c,0x40,0x4d,0x21,0x74,0x52,0x89,0x07,0x7f,0xce,0x48,0x78,0x03,0xa7,0x38,0x92,0xb6,0xae,0x80,0x3c,0x0f,0x42,0xdc,0x45,0x57,0xf1,0xd5,0xc7,0xbf,
+0xb5,0x2e,0x3f,0xfe,0xbb,0x0f,0xf4,0xc5,0xea,0xbf,0x73,0x09,0x88,0xe6,0xfc,0xb4,0xca,0x32,0x0c,0xd8,0x11,0xb7,0x64,0x65,0xef,0x00,0x63,0x1c,0xf5,0xa8,0x3f,0xd2,
+0xfc,0x89,0x1f,0xa2,0xb1,0xe8,0xc1,0xba,0x0d,0x08,0xb0,0xc8,0x25,0x58,0x76,0xb3,0x22,0x6e,0x67,0xd7,0x7f,0xa0,0x7b,0x9d,0x7d,0x7e,0x79,0xf8,0x03,0xbf,0xd9,0x7e,
+0x72,0x49,0x63,0x08,0x73,0x59,0x56,0x6f,0x73,0x9f,0x7f,0xc9,0x28,0x21,0x25,0xd0,0x0d,0xc8,0xc6,0x78,0xfd,0xb6,0xae,0x2d,0xca,0xcb,0x74,0x56,0x8f,0x34,0xe1,0x6c,
+0x0e,0x58,0xf4,0x42,0x76,0x27,0x11,0xf8,0x4f,0x19,0xc8,0x05,0x8c,0xcd,0x3c,0x19,0x00,0x13,0x92,0xff,0x10,0x90,0x6b,0xe7,0xdb,0x11,0x7f,0x14,0x47,0xcf,0x8a,0x29,
+0xce,0x87,0xed,0x39,0xbf,0xb9,0x15,0x9e,0x9c,0xbe,0xe0,0x35,0xd2,0x73,0xea,0x81,0x82,0x5c,0xf6,0x8c,0x7f,0x71,0xd8,0xe2,0x00,0x0b,0x99,0x41,0x42,0xe2,0x30,0x9c,
+0x06,0x28,0xae,0x84,0x32,0x0a,0x3b,0x8d,0xa8,0x3c,0xfa,0x65,0xcf,0xe2,0x5e,0x18,0x40,0x54,0x96,0xab,0x1f,0x3c,0x85,0x0a,0x54,0x25,0x48,0xf5,0x84,0x7d,0xda,0x2b,
+0x96,0xab,0x2a,0x94,0x1a,0x32,0x9d,0x34,0x2a,0xf9,0x7e,0x9a,0x27,0x3b,0x81,0x11,0x94,0x85,0x34,0x58,0xa2,0x51,0xaa,0xca,0x6e,0xb7,0xab,0x77,0xca,0xb4,0xf9,0x08,
+0x42,0xab,0xb4,0xde,0x2e,0x5b,0x2f,0x52,0xf6,0x67,0x18,0x3a,0x54,0x4d,0x1b,0x8d,0x35,0xe4,0xdd,0x25,0xea,0x0f,0x58,0x51,0xce,0x5c,0xa3,0x08,0x9e,0x84,0xef,0x8e,
+0xb8,0x05,0x6e,0x10,0xf8,0xf5,0x92,0x08,0x8e,0xda,0x69,0x8b,0x07,0x24,0xd0,0x38,0xaf,0x37,0x5e,0x85,0xc4,0xcd,0x0a,0xa2,0x96,0x5b,0x4e,0x4c,0x17,0xb4,0x3c,0xa4,
+0x1c,0xe0,0x0e,0x0a,0x5f,0xcc,0x7b,0x1b,0x7a,0x8c,0xe2,0x85,0x1e,0xef,0xa2,0xec,0xf6,0x4e,0xaa,0x8d,0x93,0xfd,0xbd,0x92,0x5a,0x2b,0x0f,0x7b,0x18,0xac,0x16,0xa0,
+0x79,0x1b,0x5d,0x8b,0xb7,0xcd,0xbe,0xd0,0x71,0xe3,0x54,0x9f,0xe9,0xba,0x15,0x14,0x77,0xee,0xbc,0xfd,0xbd,0x8d,0x35,0xde,0x9d,0x2e,0xd8,0x4c,0x96,0x79,0x0e,0xd2,
+0x35,0x68,0x5a,0xb5,0x26,0x70,0xd9,0x8a,0x5b,0x9c,0x5e,0xc2,0xcc,0xd3,0xef,0xc7,0x47,0x6c,0x62,0xa5,0x09,0xf7,0xe5,0x56,0x1c,0x97,0x51,0x1a,0x7d,0xba,0xb1,0x06,
+0xfc,0xc1,0xf3,0xe2,0x88,0xfa,0x7e,0x35,0x31,0xd4,0xb9,0xb2,0xf3,0xd4,0x0e,0xd7,0xcd,0x68,0xa7,0xf3,0xfa,0x8e,0x7a,0x39,0x33,0x18,0x5c,0xb9,0xfc,0xe3,0x3b,0xc8,
+0x39,0x99,0xc3,0xbf,0xd1,0xbf,0x24,0xab,0x8c,0x8e,0x29,0x85,0x1b,0x65,0xac,0x5b,0x18,0x27,0x79,0xe6,0x50,0x52,0x65,0xe1,0x26,0x62,0x75,0x63,0xd3,0x66,0x32,0x09,
+0x1d,0x31,0x84,0x63,0x1f,0x9d,0x8b,0x74,0xd2,0x03,0xa1,0x74,0x5f,0x01,0x0e,0x95,0xdc,0xf3,0x84,0x31,0x70,0x42,0x40,0x2c,0xd8,0xbd,0x17,0x84,0x4e,0xd8,0x11,0xf0,
+0x07,0x88,0x3b,0x68,0x84,0x10,0xcd,0xc5,0x88,0x40,0x7b,0x1b,0xa9,0xfc,0x96,0xb2,0x6c,0x05,0xd3,0x35,0xdc,0x2b,0x88,0xf9,0xb8,0x1f,0x1f,0x40,0xa8,0x8b,0xb3,0x7c,
+0x99,0xe0,0xd9,0x28,0x82,0x1c,0xf4,0x2b,0x36,0x34,0x3e,0x04,0xee,0x10,0x72,0x8a,0x30,0xce,0xf2,0x34,0x8e,0x66,0xc0,0x97,0xce,0x82,0x91,0x0c,0x18,0xe3,0x12,0x7c,
+0x60,0x3c,0x49,0x61,0x50,0x78,0x08,0xf5,0xeb,0xc7,0x5f,0xc3,0x88,0xce,0xa2,0xa4,0xde,0x32,0xc5,0x46,0xbd,0x34,0x14,0x85,0x1f,0x41,0xd3,0x70,0x52,0x70,0x3f,0xac,
+0x2e,0xdd,0x96,0xc8,0xb8,0xb7,0x76,0x39,0x4a,0x1c,0xe1,0xff,0x83,0x1d,0x40,0x1b,0xfc,0x48,0x57,0x7b,0x3d,0xa4,0xf2,0xf7,0x31,0x05,0x3f,0xd0,0x2e,0x09,0x4b,0x9e,
+0xd3,0x70,0x12,0x82,0xdb,0x43,0x20,0xa2,0x7e,0xff,0x1c,0x4c,0x4c,0x09,0x85,0xef,0x50,0x2d,0x43,0x54,0xf5,0x11,0x9d,0xc1,0x26,0xf3,0xa0,0x54,0xce,0x0e,0xa2,0x64,
+0xbb,0x69,0xca,0xc9,0xe8,0x55,0xd4,0x16,0x94,0xba,0xda,0xc1,0xfe,0x5f,0xd9,0xac,0x6c,0x03,0x30,0xd8,0x0f,0xf9,0x81,0x25,0xc6,0x63,0x1a,0x45,0x5f,0xdd,0xc1,0x77,
+0xe0,0x1c,0xc5,0x5b,0xc6,0x8f,0x20,0x43,0x30,0xb6,0x6f,0x92,0x8f,0xff,0xbc,0x87,0xdf,0xff,0x60,0x44,0x60,0x42,0xec,0x8f,0x0a,0xc5,0x7e,0xfe,0x4c,0xab,0x9e,0x2a,
+0xbf,0x28,0x36,0xa8,0xc3,0x2e,0xd3,0xd0,0xa9,0x6f,0xf9,0x33,0xe4,0x71,0x3e,0xba,0x43,0x8c,0x29,0x5a,0x6b,0x58,0x9f,0x23,0x01,0xbe,0x46,0xa4,0x47,0x18,0x64,0x2a,
+0x74,0xf6,0x7c,0x41,0x0e,0x03,0x50,0x67,0xb1,0xf6,0x5b,0x05,0x79,0xe3,0x74,0x69,0xa8,0xff,0xf0,0xe9,0x12,0x96,0x61,0x15,0xe2,0xb6,0xc3,0x5a,0x9c,0x9e,0x19,0xd6,
+0x37,0xb4,0x44,0xdd,0x6d,0x28,0xbd,0x49,0x96,0x58,0x72,0x6c,0xcb,0x53,0x0c,0x09,0x90,0xc5,0xd9,0xab,0xa6,0x11,0x6d,0x61,0x7e,0x46,0xbf,0x8f,0x58,0xb5,0xf0,0xf7,
+0xc7,0xec,0xdf,0x55,0xd3,0x55,0xd8,0x33,0xc9,0xbc,0x39,0xf1,0x2e,0x5f,0x53,0xf1,0xd8,0xa1,0xf9,0xf3,0x85,0x54,0x6b,0xc7,0x7b,0xd0,0x6e,0x55,0x15,0xbd,0x4b,0xc3,
+0xc2,0x59,0x94,0x3c,0x0d,0x16,0xac,0xc4,0x3a,0x44,0x2b,0xb2,0x80,0x3e,0xfa,0xb2,0x42,0xbf,0x87,0x8b,0x34,0x0e,0x97,0x17,0x64,0x41,0xdf,0xca,0xe1,0xe1,0x98,0x7d,
+0x5f,0x51,0x3d,0x00,0xd7,0x9c,0x88,0x4a,0xf1,0x05,0x27,0xa2,0xce,0x7b,0xc1,0x79,0x14,0x6d,0x5c,0x44,0x77,0xc1,0x8a,0xa9,0xbb,0xd8,0xfa,0xf1,0x7c,0x35,0xa1,0x21,
+0x9f,0xcf,0xe1,0x59,0xaa,0x2c,0xcf,0x3f,0x37,0x57,0xa0,0x9a,0xb8,0xd8,0x66,0xa2,0x76,0x1b,0xee,0x3c,0x37,0x7a,0x73,0x1d,0x80,0x40,0xcc,0xa7,0xb7,0x25,0x92,0xf0,
+0xac,0x68,0xd2,0x5d,0x10,0xea,0xd0,0x98,0x6e,0x56,0x4a,0xeb,0x87,0x32,0x59,0x5d,0x94,0x39,0xa7,0x38,0x36,0xec,0x24,0xed,0x0b,0xa9,0xd9,0x34,0xbc,0x83,0xe2,0x5d,
+0xee,0xc8,0xee,0x8e,0x23,0xb3,0x8a,0x90,0x16,0x82,0x07,0xff,0x0d,0x25,0x20,0x05,0x20,0x50,0x38,0x00,0x00
+};
+const size_t WM_PK_OTA_REMOTE_JS_GZ_LEN = 5621;
+#else
+const uint8_t WM_PK_OTA_REMOTE_JS_GZ[] PROGMEM = { 0 };
+const size_t WM_PK_OTA_REMOTE_JS_GZ_LEN = 0;
+#endif
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_OTA_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xdd,0x57,0x59,0x6f,0xdb,0x46,0x10,0x7e,0xcf,0xaf,0xd8,0x3e,0xb4,0x9b,0x00,0xe1,0x25,0xd3,0xb6,0xec,0x4a,0x02,
+0xe2,0x1c,0xa8,0x81,0x5c,0x70,0xec,0x87,0xf6,0x6d,0x45,0x8e,0xc4,0x8d,0x97,0xbb,0xc4,0x72,0x29,0xc5,0xf9,0xf5,0x9d,0x59,0x1e,0x92,0x68,0x19,0x6d,0xd0,0x3c,0x15,
+0x10,0x78,0x0c,0xe7,0xfe,0x66,0x67,0x46,0xb3,0x5f,0xde,0x7c,0x7a,0x7d,0xfb,0xe7,0xe7,0xb7,0xac,0x70,0xa5,0x5a,0x3c,0x9b,0xd1,0x8d,0x29,0xa1,0xd7,0x73,0x0e,0x9a,
+0x13,0x01,0x44,0x8e,0xb7,0x12,0x9c,0x60,0x59,0x21,0x6c,0x0d,0x6e,0xce,0x1b,0xb7,0x0a,0xa6,0xbc,0x27,0x6b,0x51,0xc2,0x9c,0x6f,0x24,0x6c,0x2b,0x63,0x1d,0x67,0x99,
+0xd1,0x0e,0x34,0xb2,0x6d,0x65,0xee,0x8a,0x79,0x0e,0x1b,0x99,0x41,0xe0,0x5f,0x5e,0x4a,0x2d,0x9d,0x14,0x2a,0xa8,0x33,0xa1,0x60,0x9e,0x90,0x0e,0x27,0x9d,0x82,0xc5,
+0xa7,0xdb,0x57,0xec,0xae,0xca,0x85,0x83,0x59,0xd4,0x52,0x9e,0xcd,0x94,0xd4,0xf7,0xcc,0x82,0x9a,0xf3,0xda,0x3d,0x28,0xa8,0x0b,0x00,0x54,0x5f,0x58,0x58,0x75,0x94,
+0x30,0xbb,0xc8,0x4e,0xd3,0x29,0x9c,0x85,0x59,0x5d,0x93,0xae,0x3a,0xb3,0xb2,0x72,0xcc,0x3d,0x54,0xe8,0x51,0x69,0xf2,0x46,0x01,0x67,0xb5,0xcd,0xe6,0xdc,0x38,0x11,
+0x58,0x28,0x8d,0x83,0x10,0xe2,0xd3,0xe9,0x34,0x5d,0x2e,0xc3,0xaf,0x28,0x33,0x8b,0x5a,0x99,0x9d,0xb0,0x67,0x17,0x55,0x35,0xfe,0x1c,0x75,0xa9,0x58,0x9a,0xfc,0x01,
+0x6f,0xb9,0xdc,0xb0,0x4c,0x89,0xba,0x9e,0x73,0x0a,0x58,0x48,0x0d,0xd6,0x27,0x2c,0x59,0xbc,0x93,0xb6,0xdc,0x0a,0x0b,0x6c,0x3f,0x28,0xa4,0x1f,0x08,0x2d,0x9d,0xce,
+0x8c,0xe2,0x4c,0x58,0x29,0x02,0x25,0x37,0xe8,0x70,0x65,0x94,0x74,0x40,0x4a,0x96,0x8d,0x73,0x46,0x33,0x99,0x63,0xa0,0xa0,0xde,0x49,0x0a,0xa3,0x93,0x2b,0xd1,0x12,
+0xca,0xf2,0x2e,0xc8,0x96,0x93,0x2f,0xbe,0x80,0x82,0xcc,0x31,0x62,0x9d,0x45,0x2d,0x91,0x42,0xaa,0x44,0xab,0x65,0xb5,0xfd,0x88,0x28,0x0d,0x4a,0x56,0x84,0x19,0x5f,
+0x7c,0x34,0x6c,0x85,0x02,0x08,0xac,0xa9,0x41,0x63,0xac,0xc8,0x8e,0x52,0x52,0x57,0x8d,0xeb,0x59,0x0b,0x99,0xe7,0x30,0x98,0x5b,0x79,0x57,0xbc,0x46,0x7c,0xba,0x26,
+0x46,0xde,0x15,0xc0,0xaa,0x8b,0x1a,0x43,0xca,0x32,0xa8,0x10,0xff,0x70,0x29,0xf5,0x4b,0xba,0x84,0xeb,0xef,0x9c,0x19,0x8d,0xf5,0xa3,0xd7,0xc8,0x69,0xf4,0xbb,0x5e,
+0xf8,0x39,0xa9,0xa9,0x5f,0xf0,0x2e,0x37,0xbd,0xe2,0xcf,0xd6,0x54,0xf5,0x2e,0x64,0xac,0xb2,0x60,0x6b,0x45,0xc5,0x7a,0x67,0x7c,0xd2,0xda,0x17,0x14,0x10,0xaa,0x06,
+0x7e,0x98,0x5d,0x2f,0x82,0xc9,0x2c,0x8f,0xd1,0x95,0x58,0x82,0xe2,0x0b,0x72,0xa2,0x96,0xdf,0xe1,0x72,0x16,0x21,0xc7,0xc8,0x03,0xfa,0x70,0xe8,0xc0,0x46,0x28,0xaa,
+0x87,0x96,0x75,0x4f,0xe2,0x87,0x2c,0x76,0x85,0xb1,0x01,0x5b,0x4b,0xa3,0x1f,0x5b,0x2e,0xf1,0xcb,0x4f,0x37,0xfb,0x87,0xb0,0xb9,0x37,0x7b,0xfd,0xe6,0x91,0xc5,0x02,
+0xcf,0xe5,0x4f,0x37,0xf8,0x1e,0x71,0x6e,0xc4,0xfa,0x48,0x66,0x4b,0xea,0x2d,0xff,0x6c,0xef,0x49,0xeb,0xed,0xa9,0x19,0xea,0x80,0x74,0x56,0xd6,0xac,0x6f,0xcc,0x76,
+0xe4,0x0e,0x51,0xa9,0x64,0x88,0x4c,0xcf,0x16,0xea,0xda,0xb3,0x63,0x23,0xc0,0xea,0xda,0xf9,0x50,0xf9,0x17,0x74,0xa2,0xc1,0xca,0x8c,0x39,0x2b,0xc5,0xb7,0x39,0x4f,
+0xe2,0x98,0x7c,0xea,0x05,0xf7,0x22,0xe8,0xc4,0x6f,0xbf,0xb9,0x03,0x0d,0x81,0x43,0xc2,0x22,0xfe,0xf5,0x88,0xe7,0xbd,0x8f,0xd7,0x7a,0x65,0x8e,0x44,0x7e,0x57,0x29,
+0x23,0x72,0xa9,0xd7,0xfe,0x28,0x86,0x4f,0x28,0x00,0x6b,0x29,0xc6,0x5e,0xdc,0x9a,0x6d,0x90,0x61,0x8f,0x05,0x3b,0xa4,0x82,0x4e,0xfb,0x66,0xcd,0xbe,0x95,0x4a,0xd3,
+0xa9,0x75,0xae,0xba,0x8c,0xa2,0xed,0x76,0x1b,0x6e,0x4f,0x42,0x63,0xd7,0xd1,0x24,0x8e,0xe3,0x08,0x39,0x38,0x6b,0xdb,0x32,0x4f,0x27,0xd8,0x4b,0x41,0xae,0x0b,0xd7,
+0x3e,0x53,0x03,0xbf,0x32,0x18,0x7c,0xcc,0x62,0x36,0x49,0xf1,0xc7,0xc9,0x25,0xec,0xbe,0xda,0x68,0x6a,0xa3,0xce,0x9a,0x7b,0xcc,0x51,0xd6,0x58,0x8b,0xa6,0x5f,0x1b,
+0x65,0x6c,0x4f,0x0d,0x3a,0x9d,0x93,0x81,0x80,0xbd,0x1b,0x32,0x51,0x91,0xab,0x8d,0xce,0x0f,0xc8,0x5f,0x8d,0xd4,0x03,0xbd,0x0f,0x08,0xf2,0x36,0x85,0xb3,0x4a,0xb8,
+0x82,0x61,0xc4,0xe5,0x24,0x09,0xcf,0x4f,0x58,0x32,0x0d,0xa6,0x41,0x92,0x8a,0x09,0x9b,0x30,0x72,0x2c,0x0e,0x4e,0xc2,0x74,0xca,0x62,0x15,0x4c,0x59,0x92,0xbe,0x1a,
+0xc8,0x0c,0x1d,0x4e,0x8a,0xe4,0x6c,0xc7,0xc8,0x48,0x3e,0x38,0xf9,0x8b,0x47,0x3b,0xa5,0x1f,0x92,0x09,0xbb,0xd8,0xa4,0x63,0x52,0x72,0x5e,0x84,0x71,0x42,0x54,0xca,
+0xd0,0x61,0xda,0xff,0xdd,0xe1,0xf0,0x9d,0xba,0xc1,0xbe,0x57,0xd7,0xff,0x6b,0x9c,0xf0,0x38,0x80,0x1e,0x21,0xf5,0xe1,0x24,0x9c,0x9e,0xb2,0x69,0x78,0x36,0x11,0x29,
+0xc2,0xe0,0x53,0xcf,0xd2,0xf0,0x7c,0x1a,0xe0,0xe5,0x9c,0xed,0x68,0x67,0xe1,0x79,0xea,0x91,0xda,0x67,0xea,0x2e,0x03,0x2d,0x6e,0xd9,0x06,0x42,0xa7,0xe4,0x80,0x29,
+0x40,0x96,0xd3,0x7d,0x4d,0xc1,0x31,0x73,0x31,0xb1,0x9d,0x1d,0xe0,0x5f,0x5e,0xb0,0x84,0x0a,0x64,0xc2,0xd2,0x20,0x3d,0x82,0x77,0x07,0xe1,0x0f,0x35,0xc4,0x1d,0xc6,
+0xa3,0xc9,0xdd,0xf8,0xc9,0x7f,0x45,0xb3,0xba,0x1f,0xbb,0xc6,0x96,0x7e,0x76,0xe7,0xb2,0x16,0x4b,0x05,0x79,0x77,0xfa,0xd9,0x6f,0xc3,0x9a,0x30,0x8c,0x6e,0x31,0x12,
+0x62,0x35,0x64,0x5e,0x96,0x54,0x2f,0x45,0x76,0xdf,0x6f,0x42,0x61,0xc4,0x17,0x57,0xf8,0x3e,0x8b,0xc4,0xe3,0x9a,0xc4,0x76,0xf5,0xc5,0x09,0xd7,0xec,0x85,0xd4,0x38,
+0xc8,0x59,0xeb,0xb0,0x07,0x92,0xf9,0x55,0x8a,0x16,0x0b,0xbb,0x96,0x88,0xad,0xa9,0x2e,0x63,0xc4,0xf2,0x14,0xb7,0xa5,0xdf,0x87,0xbd,0x42,0xb0,0x7e,0xbc,0xb7,0x1b,
+0xc3,0x73,0x1a,0xeb,0x2f,0x98,0xd0,0x39,0xab,0x7c,0x6b,0x1d,0x05,0x32,0xf4,0xb1,0xc2,0xd2,0x65,0xb2,0xb8,0xf1,0xbb,0xd7,0x6e,0x1b,0x9a,0x1c,0xdd,0x86,0x5a,0x22,
+0xad,0x7e,0x34,0x48,0x86,0x0c,0xa8,0x25,0x2e,0x4a,0x98,0x07,0xea,0x13,0xa4,0xe6,0xce,0xfa,0xc6,0x49,0xaa,0x30,0x2d,0x16,0x67,0x26,0xbb,0xbb,0x79,0x8f,0xd3,0xc6,
+0x8b,0x8d,0x37,0x98,0x15,0xbe,0xf5,0xfb,0x8b,0x03,0x8a,0x98,0x32,0xb3,0xd3,0xd4,0x37,0x7f,0x84,0x45,0x20,0xdc,0xb8,0xfa,0xf9,0xbc,0x79,0x23,0x43,0x42,0xf7,0x70,
+0xcd,0x0a,0xc8,0xee,0xdb,0x78,0xf6,0xc1,0x7d,0x62,0x31,0x7b,0x4d,0xdc,0xe4,0xfc,0x63,0x88,0x47,0x58,0xb5,0x1e,0xfd,0x37,0xb8,0xde,0xfa,0x5e,0xe3,0x0a,0x60,0xcd,
+0x38,0x3d,0x7b,0x60,0x8d,0x7d,0x1a,0x4f,0x9d,0xa8,0xdb,0x71,0xa3,0xf6,0x5f,0xc1,0xdf,0x73,0xf8,0xd0,0x0f,0x26,0x0c,0x00,0x00
+};
+const size_t WM_PK_OTA_HTML_GZ_LEN = 1145;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_OTA_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xdd,0x57,0x59,0x6f,0xdb,0x46,0x10,0x7e,0xcf,0xaf,0xd8,0x3e,0x14,0x9b,0x00,0xe1,0x25,0xd3,0xb6,0xec,0x4a,0x02,
+0x72,0x34,0x88,0x8b,0xe6,0x80,0xed,0x04,0x68,0xde,0x96,0xe4,0x4a,0x5c,0x6b,0xb9,0x4b,0x2c,0x97,0x94,0xe5,0xff,0xd0,0x1f,0x61,0xa0,0x7d,0xc8,0x5f,0x28,0x90,0xbe,
+0x28,0xf9,0x5f,0x9d,0xe1,0xa5,0xc3,0x72,0xdb,0xa0,0x79,0x2a,0x20,0xf0,0x18,0xce,0xf9,0xcd,0xec,0xcc,0x68,0xf4,0xdd,0xf3,0x37,0xcf,0x2e,0x7f,0x79,0xfb,0x23,0x49,
+0x6d,0x26,0x27,0x0f,0x46,0x78,0x23,0x92,0xa9,0xd9,0x98,0x72,0x45,0x91,0xc0,0x59,0x02,0xb7,0x8c,0x5b,0x46,0xe2,0x94,0x99,0x82,0xdb,0x31,0x2d,0xed,0xd4,0x19,0xd2,
+0x8e,0xac,0x58,0xc6,0xc7,0xb4,0x12,0x7c,0x91,0x6b,0x63,0x29,0x89,0xb5,0xb2,0x5c,0x01,0xdb,0x42,0x24,0x36,0x1d,0x27,0xbc,0x12,0x31,0x77,0xea,0x97,0xc7,0x42,0x09,
+0x2b,0x98,0x74,0x8a,0x98,0x49,0x3e,0x0e,0x50,0x87,0x15,0x56,0xf2,0xc9,0x9b,0xcb,0x27,0x84,0xcd,0x6d,0xc9,0xa4,0xb8,0x59,0xdd,0xc6,0x82,0x8d,0xbc,0xe6,0xc3,0x83,
+0x91,0x14,0x6a,0x4e,0x0c,0x97,0x63,0x5a,0xd8,0xa5,0xe4,0x45,0xca,0x39,0x58,0x49,0x0d,0x9f,0xb6,0x14,0x37,0x3e,0x89,0x0f,0xc3,0x21,0x3f,0x72,0xe3,0xa2,0x40,0x95,
+0x45,0x6c,0x44,0x6e,0x89,0x5d,0xe6,0xe0,0x58,0xa6,0x93,0x52,0x72,0x4a,0x0a,0x13,0x8f,0xa9,0xb6,0xcc,0x31,0x3c,0xd3,0x96,0xbb,0xdc,0x3f,0x1c,0x0e,0xc3,0x28,0x72,
+0xaf,0x40,0x66,0xe4,0x35,0x32,0x6b,0xe1,0x9a,0x9d,0xe5,0xf9,0xee,0x67,0xaf,0x45,0x24,0xd2,0xc9,0x12,0x6e,0x89,0xa8,0x48,0x2c,0x59,0x51,0x8c,0x29,0xc6,0xcd,0x84,
+0xe2,0xa6,0xc6,0x2d,0xb8,0x1b,0x12,0x99,0x0a,0x93,0x55,0xab,0x8f,0xa6,0x04,0x2d,0xc1,0xb6,0x70,0x64,0x55,0xac,0x25,0x25,0xcc,0x08,0xe6,0x48,0x51,0x81,0xe3,0xb9,
+0x96,0xc2,0x72,0x54,0x16,0x95,0xd6,0x6a,0x45,0x44,0x02,0x01,0x73,0xf9,0x42,0x60,0x38,0xad,0x5c,0x06,0x16,0x41,0x96,0xb6,0xc1,0x36,0x9c,0x74,0xf2,0x7e,0x19,0x19,
+0xf6,0xe5,0x77,0x52,0xac,0xfe,0x88,0xb4,0x19,0x79,0x0d,0x1d,0xa3,0xcb,0x59,0xa3,0x68,0xba,0x78,0x0d,0x79,0xeb,0xf5,0x4c,0x31,0x8b,0x74,0xf2,0xe5,0x93,0x60,0x89,
+0x5a,0xb6,0x72,0x44,0x09,0x4e,0xae,0x38,0xa9,0x50,0x9b,0x5a,0x7d,0x02,0x18,0x40,0x1c,0xb4,0x08,0x95,0x97,0xb6,0x13,0x4d,0x45,0x92,0xf0,0xde,0x83,0x69,0xed,0x5d,
+0x6d,0x01,0x9e,0xce,0x90,0x91,0xb6,0x25,0x82,0xe1,0x2f,0x98,0x81,0xcf,0x2c,0x8e,0x79,0x0e,0x15,0xe2,0x46,0x42,0x3d,0xc6,0x8b,0x3b,0xbb,0xa1,0x44,0x2b,0xa8,0x30,
+0x35,0x03,0x4e,0xad,0x5e,0x74,0xc2,0x0f,0x51,0x4d,0xf1,0x88,0xb6,0x70,0x75,0x8a,0xdf,0x1a,0x9d,0x17,0x6b,0x14,0xa0,0x0e,0x9d,0x85,0x61,0x39,0xe9,0x9c,0xa9,0x71,
+0x6c,0x5e,0x40,0x80,0xc9,0x82,0xd3,0x6d,0xc0,0x6b,0x11,0xc0,0x37,0xdb,0x47,0x97,0x2c,0xe2,0x12,0x50,0xe4,0x9f,0xff,0x9c,0xeb,0xa2,0xc7,0xb1,0x3c,0x1d,0x79,0xc0,
+0xba,0xe3,0x4a,0x21,0x6e,0xf8,0xb6,0x27,0x15,0x93,0x58,0x33,0x0d,0xeb,0x86,0xc4,0x57,0x99,0x36,0x37,0x9b,0x15,0x73,0xd7,0x72,0x56,0x41,0xa5,0x7d,0x6b,0xb3,0x2f,
+0x99,0x49,0x30,0x45,0xe4,0xec,0xf9,0x1d,0x8b,0x29,0x1c,0xe1,0x6f,0x6e,0xf0,0x27,0x76,0xb3,0x9c,0xef,0x09,0x0e,0x7b,0xd0,0x3f,0x1b,0xbb,0xd7,0x74,0x73,0x9c,0xfa,
+0x6a,0x40,0x9d,0xb9,0xd1,0xb3,0x73,0xbd,0xd8,0xf1,0x05,0xa9,0x58,0x38,0x48,0xc6,0x67,0xc3,0x8b,0xa2,0x66,0x87,0x4e,0x01,0x35,0xb6,0xf6,0x21,0xaf,0x5f,0xc0,0x89,
+0x12,0xea,0xd3,0xa7,0x24,0x63,0xd7,0x63,0x1a,0xf8,0x3e,0xfa,0xd4,0x09,0x6e,0x44,0xd0,0x8a,0x5f,0x5e,0xdb,0x2d,0x0d,0x8e,0x05,0xc2,0xc4,0xff,0x7e,0x8f,0xe7,0x9d,
+0x8f,0x67,0x6a,0xaa,0xf7,0x44,0xfe,0x9a,0xa5,0x66,0x75,0x5b,0xb1,0xac,0xad,0x45,0xf7,0x1e,0x15,0xdc,0x18,0x8c,0xb2,0x53,0x60,0xf4,0xc2,0x89,0xa1,0x1b,0x73,0xd3,
+0x83,0x81,0x5d,0xa0,0x9a,0x91,0xeb,0x4c,0x2a,0x3c,0xbd,0xd6,0xe6,0xa7,0x9e,0xb7,0x58,0x2c,0xdc,0xc5,0x81,0xab,0xcd,0xcc,0x1b,0xf8,0xbe,0xef,0x01,0x07,0x25,0x4d,
+0x03,0xa7,0xe1,0x00,0xda,0x2d,0x17,0xb3,0xd4,0x36,0xcf,0xd8,0xea,0x9f,0x6a,0x08,0xdf,0x27,0x3e,0x19,0x84,0xf0,0xa3,0x50,0xa8,0x12,0x1a,0xb4,0xd2,0x0a,0x3b,0xad,
+0x35,0x7a,0x0e,0x28,0xc5,0xa5,0x31,0x60,0xfa,0x99,0x96,0xda,0x74,0x54,0xa7,0xd5,0x39,0xe8,0x09,0xd0,0xde,0x79,0xcc,0x72,0x74,0xb5,0x54,0xc9,0x16,0xf9,0x4a,0x0b,
+0xd5,0xd3,0xbb,0x80,0x78,0xd2,0x80,0x38,0xca,0x99,0x4d,0x09,0x44,0x9c,0x0d,0x02,0xf7,0xf8,0x80,0x04,0x43,0x67,0xe8,0x04,0x21,0x1b,0x90,0x01,0x41,0xc7,0x7c,0xe7,
+0xc0,0x0d,0x87,0xc4,0x97,0xce,0x90,0x04,0xe1,0x93,0x9e,0x4c,0xc0,0xe1,0x20,0x0d,0x8e,0xd6,0x8c,0x04,0xe5,0x9d,0x83,0x0f,0xd4,0x5b,0x2b,0x7d,0x15,0x0c,0xc8,0x49,
+0x15,0xee,0x92,0x82,0xe3,0xd4,0xf5,0x03,0xa4,0x22,0x42,0xdb,0xb0,0xff,0xbb,0xb3,0x51,0x37,0xf1,0x12,0xfa,0x5f,0x51,0xfc,0xaf,0xf3,0x04,0x07,0x82,0xab,0x9d,0x4c,
+0xbd,0x3a,0x70,0x87,0x87,0x64,0xe8,0x1e,0x0d,0x58,0x08,0x69,0xa8,0xa1,0x27,0xa1,0x7b,0x3c,0x74,0xe0,0x72,0x4c,0xd6,0xb4,0x23,0xf7,0x38,0xac,0x33,0xb5,0xc9,0xd4,
+0x5e,0x7a,0x9a,0xdf,0xb0,0xf5,0x84,0x56,0xc9,0x16,0x93,0x03,0x2c,0x87,0x9b,0x9a,0x9c,0x7d,0xe6,0x7c,0x64,0x3b,0xda,0xca,0x7f,0x76,0x42,0x02,0x2c,0x90,0x01,0x09,
+0x9d,0x70,0x4f,0xbe,0xdb,0x14,0x7e,0x55,0x3f,0x5c,0xe7,0x78,0x67,0xa8,0x97,0x79,0xc2,0x2c,0x7f,0x8a,0x63,0xbc,0x1b,0xc7,0xda,0x64,0xf5,0x58,0x4f,0x44,0xc1,0x22,
+0xc9,0x93,0xfa,0xfc,0xe3,0x44,0x67,0xfd,0x4e,0xa1,0x2b,0x78,0xdf,0x18,0xed,0x6c,0x47,0x98,0x14,0x3c,0xae,0x75,0xa0,0x89,0x88,0xc5,0xf3,0x6e,0x69,0x72,0x3d,0x3a,
+0xb9,0xc8,0x57,0xbf,0xa1,0x34,0xbb,0x5b,0x9d,0xd0,0xba,0x2e,0x2c,0xb3,0xe5,0x46,0x70,0xa5,0xe5,0x09,0x69,0x5c,0xaf,0x53,0x4a,0xea,0xbd,0x0b,0xb7,0x0f,0x33,0x13,
+0x90,0x65,0x9d,0x9f,0xfa,0x90,0xd5,0x43,0x58,0xad,0x7e,0xa8,0x97,0x0f,0x6e,0x2c,0xef,0x96,0x88,0x7e,0x86,0x91,0x87,0x38,0xea,0x1f,0x41,0x08,0x85,0x95,0xec,0xf3,
+0xaf,0xc0,0x72,0x4f,0x54,0x7d,0x73,0x4b,0x0d,0x5e,0x06,0x93,0xf7,0x37,0x09,0xac,0x8d,0x5c,0xad,0x6e,0x77,0xb7,0x44,0xf8,0xb8,0x6f,0x91,0x6a,0x88,0xb8,0x3d,0xe2,
+0x9c,0xe9,0x91,0x91,0x11,0xec,0x58,0x80,0x0f,0xf6,0x11,0xdc,0x02,0xdf,0x19,0x60,0x7d,0x77,0xfe,0x73,0xaf,0x15,0xdc,0x52,0xab,0x8f,0xa9,0x06,0xf0,0x0c,0x0c,0x58,
+0x06,0xa3,0xa9,0xd6,0xb0,0xbb,0xf4,0x4c,0xe1,0xad,0x5b,0x79,0x2c,0x47,0x48,0x10,0xba,0xb5,0xd2,0x6e,0x52,0x40,0x06,0x19,0x54,0x06,0x2c,0x92,0x35,0xb0,0xb5,0xbd,
+0x1e,0xf1,0x8d,0x12,0x88,0x53,0x1e,0xcf,0xcf,0x6b,0xf1,0xcd,0x3a,0xb8,0x67,0xbd,0xbb,0x98,0xc3,0xae,0x69,0xe0,0xbc,0x56,0x35,0x78,0x1b,0x88,0x94,0x1b,0x05,0xb1,
+0x93,0xd7,0xc6,0xb9,0xff,0x96,0xda,0x0f,0x2c,0x61,0x57,0x90,0x37,0x84,0xac,0x45,0x68,0x33,0x9d,0x7f,0xe3,0xd7,0xee,0xbc,0xf2,0xda,0x05,0xda,0x6b,0xfe,0x79,0xfc,
+0x05,0xf2,0x70,0x5c,0xca,0x8a,0x0c,0x00,0x00
+};
+const size_t WM_PK_OTA_HTML_GZ_LEN = 1225;
+#else
+const uint8_t WM_PK_OTA_HTML_GZ[] PROGMEM = { 0 };
+const size_t WM_PK_OTA_HTML_GZ_LEN = 0;
+#endif
+#else
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_OTA_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xdd,0x56,0x59,0x6f,0xdb,0x38,0x10,0x7e,0xef,0xaf,0x98,0x7d,0xe8,0xb2,0x05,0xaa,0xcb,0x56,0x12,0x27,0x6b,0x1b,
+0x68,0xda,0x0d,0x36,0xc0,0xf6,0x40,0x9b,0x3e,0xec,0xbe,0xd1,0xd2,0xd8,0x62,0x43,0x91,0x02,0x49,0x59,0x49,0x7f,0xfd,0x0e,0x75,0xf9,0x88,0x8b,0xdd,0x02,0x7d,0x5a,
+0xc0,0x90,0xc4,0xcf,0x73,0x7c,0x73,0x70,0xc8,0xf9,0x2f,0x6f,0x3f,0xbc,0xb9,0xfb,0xeb,0xe3,0xef,0x50,0xb8,0x52,0x2e,0x9f,0xcd,0xfd,0x0b,0x24,0x57,0x9b,0x05,0x43,
+0xc5,0x3c,0x80,0x3c,0xa7,0x57,0x89,0x8e,0x43,0x56,0x70,0x63,0xd1,0x2d,0x58,0xed,0xd6,0xc1,0x8c,0x0d,0xb0,0xe2,0x25,0x2e,0xd8,0x56,0x60,0x53,0x69,0xe3,0x18,0x64,
+0x5a,0x39,0x54,0x24,0xd6,0x88,0xdc,0x15,0x8b,0x1c,0xb7,0x22,0xc3,0xa0,0x5d,0xbc,0x12,0x4a,0x38,0xc1,0x65,0x60,0x33,0x2e,0x71,0x91,0x78,0x1b,0x4e,0x38,0x89,0xcb,
+0x0f,0x77,0xaf,0xe1,0x4b,0x95,0x73,0x87,0xf3,0xa8,0x43,0x9e,0xcd,0xa5,0x50,0xf7,0x60,0x50,0x2e,0x98,0x75,0x8f,0x12,0x6d,0x81,0x48,0xe6,0x0b,0x83,0xeb,0x1e,0x09,
+0xb3,0xcb,0xec,0x2c,0x9d,0xe1,0x79,0x98,0x59,0xeb,0x6d,0xd9,0xcc,0x88,0xca,0x81,0x7b,0xac,0x88,0x51,0xa9,0xf3,0x5a,0x22,0x03,0x6b,0xb2,0x05,0xd3,0x8e,0x87,0x59,
+0x76,0x86,0x79,0x7a,0x99,0x86,0x5f,0x49,0x78,0x1e,0x75,0xc2,0xa4,0x15,0xf5,0x41,0xae,0x74,0xfe,0x48,0xaf,0x5c,0x6c,0x21,0x93,0xdc,0xda,0x05,0xf3,0xa1,0x70,0xa1,
+0xd0,0xb4,0xa9,0x48,0x96,0x37,0xc2,0x94,0x0d,0x37,0x08,0xfb,0x74,0x09,0x3f,0x50,0x5a,0x39,0x95,0x69,0xc9,0x80,0x1b,0xc1,0x03,0x29,0xb6,0x44,0xa5,0xd2,0x52,0x38,
+0xf4,0x46,0x56,0xb5,0x73,0x5a,0x81,0xc8,0x29,0x04,0x94,0x37,0xc2,0x13,0xec,0xf5,0x4a,0xf2,0x44,0xba,0xac,0xa7,0xdf,0x49,0xb2,0xe5,0x67,0x94,0x98,0x39,0xf0,0xa2,
+0xf3,0xa8,0x03,0x7d,0xa4,0x15,0xef,0xac,0xac,0x9b,0xf7,0x94,0xff,0xd1,0xc8,0xda,0x57,0x83,0x2d,0xdf,0x6b,0x58,0x93,0x02,0x95,0x4c,0x5b,0x54,0x14,0x2b,0x89,0x93,
+0x96,0x50,0x55,0xed,0x06,0xd1,0x42,0xe4,0x39,0x8e,0xee,0xd6,0x2d,0x95,0xd6,0x22,0x7d,0xdd,0x7a,0x41,0xd6,0x97,0x76,0xdd,0x47,0x4d,0x21,0x65,0x19,0x56,0x54,0xd9,
+0x70,0x25,0xd4,0x2b,0xff,0x08,0x37,0xdf,0x18,0x68,0x45,0x9d,0xa1,0x36,0x24,0xa9,0xd5,0xcd,0xa0,0xfc,0xc2,0x9b,0xb1,0x2f,0x59,0x9f,0x9b,0xc1,0xf0,0x47,0xa3,0x2b,
+0xbb,0x0b,0x99,0xfa,0x27,0x68,0x0c,0xaf,0x60,0x20,0xd3,0x26,0xad,0x5b,0x90,0x02,0x97,0x16,0xd9,0x61,0x76,0x5b,0x15,0x4a,0x66,0x79,0x0a,0x97,0x7c,0x85,0x92,0x2d,
+0x3d,0x09,0x2b,0xbe,0xe1,0xd5,0x3c,0x22,0x89,0x23,0x06,0xfe,0x8f,0x43,0x02,0x5b,0x2e,0x7d,0x3f,0x74,0xa2,0x7b,0x1a,0x3f,0xe4,0xb1,0x6f,0x8c,0x2d,0x1a,0x2b,0xb4,
+0x7a,0xea,0xb9,0xa4,0x7f,0x7e,0xba,0xdb,0x3f,0xb8,0xc9,0x5b,0xb7,0xb7,0x6f,0x9f,0x78,0x2c,0x68,0xc7,0xfd,0x74,0x87,0x7f,0x52,0x9d,0x6b,0xbe,0x39,0x91,0xd9,0xd2,
+0x4f,0x8d,0x7f,0xf7,0xf7,0x5d,0xef,0xdd,0xae,0x19,0xfb,0xc0,0xdb,0xac,0x8c,0xde,0x7c,0xd2,0xcd,0x11,0x1d,0x8f,0xfa,0x96,0xf1,0xb0,0xff,0x36,0x68,0x6d,0x2b,0x4e,
+0x5b,0x9c,0xba,0x6b,0xc7,0xa1,0x6a,0x17,0x44,0xa2,0xa6,0xce,0x8c,0x19,0x94,0xfc,0x61,0xc1,0x92,0x38,0xf6,0x9c,0x06,0xc5,0xbd,0x08,0x7a,0xf5,0xbb,0x07,0x77,0x60,
+0x21,0x70,0x04,0x2c,0xe3,0xe7,0x27,0x98,0x0f,0x1c,0x6f,0xd5,0x5a,0x9f,0x88,0xfc,0x4b,0x25,0x35,0xcf,0x85,0xda,0xb4,0x5b,0x31,0xfc,0x8e,0x01,0x34,0xc6,0xc7,0x38,
+0xa8,0x1b,0xdd,0x04,0x19,0x4d,0x4f,0x34,0x63,0x2a,0xfc,0x6e,0xdf,0x6e,0xe0,0xa1,0x94,0xca,0xef,0x5a,0xe7,0xaa,0xab,0x28,0x6a,0x9a,0x26,0x6c,0xa6,0xa1,0x36,0x9b,
+0x68,0x12,0xc7,0x71,0x44,0x12,0x0c,0xba,0x81,0xcb,0xd2,0x09,0x4d,0x49,0x14,0x9b,0xc2,0x75,0xdf,0x7e,0x34,0x5f,0x6b,0x0a,0x3e,0x86,0x18,0x26,0x29,0xfd,0x98,0xa7,
+0x44,0x73,0x55,0x69,0xe5,0x07,0xa4,0x33,0xfa,0x9e,0x72,0x94,0xd5,0xc6,0x90,0xeb,0x37,0x5a,0x6a,0x33,0xa0,0x41,0x6f,0x73,0x32,0x02,0x34,0x95,0x31,0xe3,0x95,0xa7,
+0x5a,0xab,0xfc,0x00,0xfe,0xaa,0x85,0x1a,0xf1,0x21,0x20,0xcc,0xbb,0x14,0xce,0x2b,0xee,0x0a,0xa0,0x88,0xcb,0x49,0x12,0x5e,0x4c,0x21,0x99,0x05,0xb3,0x20,0x49,0xf9,
+0x04,0x26,0xe0,0x89,0xc5,0xc1,0x34,0x4c,0x67,0x10,0xcb,0x60,0x06,0x49,0xfa,0x7a,0x84,0x81,0x08,0x27,0x45,0x72,0xbe,0x13,0x04,0xaf,0x1f,0x4c,0xff,0x66,0xd1,0xce,
+0xe8,0xbb,0x64,0x02,0x97,0xdb,0xf4,0x18,0x4a,0x2e,0x8a,0x30,0x4e,0x3c,0xea,0x33,0x74,0x98,0xf6,0xff,0xb6,0x39,0xda,0x49,0x5d,0xd3,0xdc,0xb3,0xf6,0x7f,0x5d,0x27,
+0xda,0x0e,0xa8,0x8e,0x2a,0xf5,0x6e,0x1a,0xce,0xce,0x60,0x16,0x9e,0x4f,0x78,0x4a,0x65,0x68,0x53,0x0f,0x69,0x78,0x31,0x0b,0xe8,0x71,0x01,0x3b,0xec,0x3c,0xbc,0x48,
+0xdb,0x4a,0xed,0x0b,0xf5,0x8f,0x11,0x8b,0x3b,0xb1,0x11,0xe8,0x8d,0x1c,0x08,0x05,0x24,0x72,0xb6,0x6f,0x29,0x38,0xe5,0x2e,0xf6,0x62,0xe7,0x07,0xf5,0x2f,0x2f,0x21,
+0xf1,0x0d,0x32,0x81,0x34,0x48,0x4f,0xd4,0xbb,0x2f,0xe1,0x0f,0x0d,0xc4,0x5d,0x8d,0x8f,0x4e,0xee,0xba,0x3d,0xf9,0xaf,0xfd,0x59,0x3d,0x1c,0xbb,0xda,0x94,0xed,0xd9,
+0x9d,0x0b,0xcb,0x57,0x12,0xf3,0x7e,0xf7,0xc3,0xaf,0xe3,0x35,0x61,0x3c,0xba,0xf9,0x91,0x12,0x58,0xcc,0x5a,0x5d,0x6f,0x7a,0xc5,0xb3,0xfb,0xe1,0x8e,0x13,0x46,0x6c,
+0x79,0x4d,0xeb,0x79,0xc4,0x9f,0xf6,0x24,0x8d,0xab,0xcf,0x8e,0xbb,0x7a,0x2f,0xa4,0xda,0x61,0x0e,0x1d,0xe1,0xb6,0x90,0xd0,0x5e,0x92,0xfc,0xc5,0xc2,0x6c,0x04,0xd5,
+0x56,0x57,0x57,0x31,0xd5,0xf2,0xcc,0x60,0xf9,0xdb,0x78,0xaf,0xe0,0x30,0x1c,0xef,0xdd,0x8d,0xe1,0x85,0x3f,0xd6,0x5f,0x02,0x57,0x39,0x54,0xed,0x68,0x3d,0x0a,0xe4,
+0x78,0x8e,0x45,0xfd,0xad,0x29,0xea,0x6e,0x90,0xff,0x00,0x26,0x50,0xe4,0x8d,0x52,0x0a,0x00,0x00
+};
+const size_t WM_PK_OTA_HTML_GZ_LEN = 1011;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_OTA_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xdd,0x56,0xdb,0x8e,0xdb,0x36,0x10,0x7d,0xcf,0x57,0xb0,0x0f,0x05,0x13,0x20,0xba,0x79,0xb5,0xbb,0xde,0xad,0x6d,
+0x20,0x97,0x06,0xdd,0x02,0xb9,0xa0,0x59,0x14,0x68,0xdf,0x68,0x69,0x6c,0x71,0x4d,0x91,0x02,0x49,0x49,0xeb,0xfd,0x87,0x7e,0x44,0x80,0xf6,0xa1,0xbf,0x50,0x20,0x7d,
+0x71,0xf2,0x5f,0x1d,0xea,0xe6,0xcb,0x7a,0xd1,0x06,0xc8,0x53,0x01,0x43,0x12,0xc7,0x33,0x67,0xce,0x5c,0x38,0xe4,0xe4,0x9b,0x97,0x6f,0x5f,0x5c,0xff,0xf2,0xee,0x7b,
+0x92,0xd9,0x5c,0xcc,0x1e,0x4d,0xdc,0x8b,0x08,0x26,0x97,0x53,0x0a,0x92,0x3a,0x01,0xb0,0x14,0x5f,0x39,0x58,0x46,0x92,0x8c,0x69,0x03,0x76,0x4a,0x4b,0xbb,0xf0,0xc6,
+0xb4,0x17,0x4b,0x96,0xc3,0x94,0x56,0x1c,0xea,0x42,0x69,0x4b,0x49,0xa2,0xa4,0x05,0x89,0x6a,0x35,0x4f,0x6d,0x36,0x4d,0xa1,0xe2,0x09,0x78,0xcd,0xe2,0x29,0x97,0xdc,
+0x72,0x26,0x3c,0x93,0x30,0x01,0xd3,0xc8,0x61,0x58,0x6e,0x05,0xcc,0xde,0x5e,0x3f,0x23,0x6c,0x65,0x4b,0x26,0xf8,0xdd,0xe6,0x43,0xc2,0xd9,0x24,0x68,0xff,0x78,0x34,
+0x11,0x5c,0xae,0x88,0x06,0x31,0xa5,0xc6,0xae,0x05,0x98,0x0c,0x00,0xbd,0x64,0x1a,0x16,0x9d,0xc4,0x4f,0x2e,0x92,0xd3,0x78,0x0c,0x67,0x7e,0x62,0x8c,0x83,0x34,0x89,
+0xe6,0x85,0x25,0x76,0x5d,0x20,0xb1,0x5c,0xa5,0xa5,0x00,0x4a,0x8c,0x4e,0xa6,0x54,0x59,0xe6,0x27,0xc9,0x29,0xa4,0xf1,0x45,0xec,0xdf,0xa0,0xf2,0x24,0x68,0x95,0xd1,
+0x2a,0xe8,0x62,0x9d,0xab,0x74,0x8d,0xaf,0x94,0x57,0x24,0x11,0xcc,0x98,0x29,0x75,0x11,0x31,0x2e,0x41,0x37,0x19,0x89,0xee,0x93,0x25,0x0b,0xae,0xf3,0x6a,0xf3,0xa7,
+0x2e,0x11,0x25,0xda,0x37,0x9e,0x5b,0x99,0x28,0x41,0x09,0xd3,0x9c,0x79,0x82,0x57,0x48,0xa9,0x50,0x82,0x5b,0x70,0x60,0xf3,0xd2,0x5a,0x25,0x09,0x4f,0x31,0x14,0x10,
+0xaf,0xb8,0x23,0xda,0xd9,0xe5,0xe8,0x11,0x6d,0x69,0x17,0x46,0xab,0x49,0x67,0x3f,0xaf,0xe7,0x9a,0x7d,0xfe,0x83,0x98,0xcd,0x5f,0x73,0xa5,0x27,0x41,0x2b,0x77,0x41,
+0x17,0xac,0x05,0x5a,0xd4,0x6f,0xb0,0x22,0x03,0xce,0xc2,0xd5,0x87,0xce,0x3e,0x7f,0xe4,0x2c,0x95,0xeb,0xce,0x8e,0x48,0x0e,0xe4,0x06,0x48,0xe5,0xd0,0xe4,0xe6,0x23,
+0xa6,0x01,0xcd,0x11,0x85,0xcb,0xa2,0xb4,0xbd,0x69,0xc6,0xd3,0x14,0x06,0x06,0x8b,0x86,0x5d,0xe3,0x01,0xbf,0xae,0x9c,0x22,0xed,0x8a,0xef,0xc2,0xaf,0x99,0xc6,0xbf,
+0x59,0x92,0x40,0x81,0xb5,0xf7,0xe7,0x5c,0x3e,0x75,0x0f,0x7f,0x79,0x47,0x89,0x92,0xd8,0x3b,0x72,0x89,0x9a,0x4a,0xbe,0xea,0x8d,0x1f,0x3b,0x18,0xf3,0x84,0x76,0xe9,
+0xea,0x81,0xdf,0x69,0x55,0x98,0x6d,0x16,0xb0,0xc3,0xbc,0x5a,0xb3,0x82,0xf4,0x64,0x9a,0x3c,0xb6,0x0b,0x34,0x60,0xc2,0x00,0xdd,0x4f,0x78,0x63,0x82,0xf9,0xcd,0x8f,
+0xc9,0x05,0x9b,0x83,0xc0,0x2c,0xc2,0xa7,0xbf,0x57,0xca,0x0c,0x79,0x2c,0x2f,0x27,0x01,0xaa,0x1e,0x50,0x31,0xfc,0x0e,0xf6,0x99,0x54,0x4c,0xb8,0x9e,0x69,0x55,0x77,
+0x2c,0xbe,0xc8,0xb5,0xbe,0xdb,0xed,0x98,0xfb,0x9e,0xf3,0x0a,0x3b,0xed,0x6b,0xbb,0xfd,0x81,0xe9,0xd4,0x95,0x88,0x5c,0xbd,0xbc,0xe7,0x31,0xc3,0xcd,0xf9,0xd5,0x1d,
+0xfe,0xc8,0xee,0xd6,0xab,0x23,0xc1,0xb9,0xe9,0xf2,0xef,0xce,0x1e,0x74,0xdd,0x6e,0xa7,0xa1,0x1b,0x1c,0x66,0xa1,0xd5,0xf2,0x27,0x55,0x1f,0x70,0x71,0x52,0xd7,0x38,
+0x4e,0xec,0xbe,0x35,0x18,0xd3,0xa8,0xe3,0x0c,0xc0,0x1e,0xdb,0x72,0x28,0x9a,0x05,0x92,0x28,0xb1,0x3f,0x43,0x4a,0x72,0x76,0x3b,0xa5,0x51,0x18,0x3a,0x4e,0xbd,0xe1,
+0x4e,0x04,0x9d,0xf9,0xf5,0xad,0xdd,0x43,0xf0,0x2c,0x0a,0x66,0xe1,0xb7,0x47,0x98,0xf7,0x1c,0xaf,0xe4,0x42,0x1d,0x89,0xfc,0x0d,0xcb,0xf4,0xe6,0x43,0xc5,0xf2,0xae,
+0x17,0xfd,0x07,0x20,0x40,0x6b,0x17,0x65,0x0f,0xa0,0x55,0xed,0x25,0x38,0x67,0x41,0x0f,0xc9,0x70,0x53,0xa0,0x5a,0x92,0xdb,0x5c,0x48,0xb7,0x7b,0xad,0x2d,0x2e,0x83,
+0xa0,0xae,0x6b,0xbf,0x3e,0xf1,0x95,0x5e,0x06,0xa3,0x30,0x0c,0x03,0xd4,0xa0,0xa4,0x1d,0xcd,0x34,0x1e,0xe1,0x20,0x05,0xbe,0xcc,0x6c,0xfb,0xed,0x86,0xf8,0x73,0x85,
+0xe1,0x87,0x24,0x24,0xa3,0x18,0x7f,0x14,0x1b,0x55,0xe0,0xe8,0x95,0x4a,0xba,0x19,0x6a,0xb5,0x5a,0x61,0x96,0x92,0x52,0x6b,0x74,0xfd,0x42,0x09,0xa5,0x7b,0xa9,0xd7,
+0x61,0x8e,0x06,0x01,0x0e,0x6e,0x48,0x58,0xe1,0xa8,0x96,0x32,0xdd,0x13,0xdf,0x28,0x2e,0x07,0x79,0x1f,0x10,0xa4,0x6d,0x12,0x27,0x05,0xb3,0x19,0xc1,0x88,0xf3,0x51,
+0xe4,0x9f,0x9f,0x90,0x68,0xec,0x8d,0xbd,0x28,0x66,0x23,0x32,0x22,0x8e,0x58,0xe8,0x9d,0xf8,0xf1,0x98,0x84,0xc2,0x1b,0x93,0x28,0x7e,0x36,0x88,0x09,0x12,0x8e,0xb2,
+0xe8,0x6c,0xab,0x48,0x9c,0xbd,0x77,0xf2,0x2b,0x0d,0xb6,0xa0,0xaf,0xa3,0x11,0xb9,0xa8,0xe2,0x43,0x51,0x74,0x9e,0xf9,0x61,0xe4,0xa4,0x2e,0x43,0xfb,0x69,0xff,0x6f,
+0x7b,0xa3,0x19,0xe2,0x25,0xce,0x3f,0x63,0xfe,0xd7,0x75,0xc2,0x0d,0x01,0xf2,0xa0,0x52,0xaf,0x4f,0xfc,0xf1,0x29,0x19,0xfb,0x67,0x23,0x16,0x63,0x19,0x9a,0xd4,0x93,
+0xd8,0x3f,0x1f,0x7b,0xf8,0x38,0x27,0x5b,0xd9,0x99,0x7f,0x1e,0x37,0x95,0xda,0x55,0xea,0x1e,0x83,0x2c,0x6c,0xd5,0x06,0x41,0x07,0xb2,0xa7,0xe4,0xa1,0xca,0xe9,0x2e,
+0x92,0x77,0xcc,0x5d,0xe8,0xd4,0xce,0xf6,0xea,0x9f,0x5f,0x90,0xc8,0x35,0xc8,0x88,0xc4,0x5e,0x7c,0xa4,0xde,0x5d,0x09,0xbf,0x68,0x1e,0x6e,0x6b,0x7c,0x70,0xa8,0x97,
+0x45,0xca,0x2c,0x3c,0x77,0xc7,0x78,0x7f,0x1c,0x2b,0x9d,0x37,0xc7,0x7a,0xca,0x0d,0x9b,0x0b,0x48,0x9b,0xfd,0xef,0x4e,0x74,0x36,0xdc,0x29,0x54,0x85,0xeb,0x9d,0xa3,
+0x9d,0x1d,0x18,0x13,0x03,0x49,0x83,0xe1,0x5c,0xcc,0x59,0xb2,0xea,0xaf,0x43,0x7e,0x40,0x67,0xef,0x8b,0xcd,0xef,0xce,0x9a,0xdd,0xef,0x4e,0x1c,0x5d,0xef,0x2d,0xb3,
+0xe5,0x4e,0x70,0xa5,0x85,0x94,0xb4,0xd4,0x9b,0x92,0x92,0xe6,0x46,0xe5,0x6e,0x1f,0x7a,0xc9,0xb1,0xca,0xaa,0xb8,0x0c,0xb1,0xaa,0xa7,0x1a,0xf2,0xef,0x9a,0xcb,0x07,
+0x68,0x0b,0xfd,0x25,0x62,0x38,0xc3,0xc8,0x63,0x77,0xd4,0x3f,0xc1,0x10,0x8c,0x15,0xec,0xd3,0x6f,0xa8,0xf2,0x40,0x54,0x87,0xc3,0x2d,0xe8,0x6e,0x5b,0x41,0x7b,0x01,
+0xfd,0x07,0x92,0xbb,0x89,0xef,0x91,0x0a,0x00,0x00
+};
+const size_t WM_PK_OTA_HTML_GZ_LEN = 1066;
+#else
+const uint8_t WM_PK_OTA_HTML_GZ[] PROGMEM = { 0 };
+const size_t WM_PK_OTA_HTML_GZ_LEN = 0;
+#endif
+#endif
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_INFO_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x5d,0x53,0x4d,0x8f,0xda,0x30,0x10,0xbd,0xef,0xaf,0x48,0xa5,0x4a,0x06,0x29,0x24,0x1b,0x04,0xdd,0x2d,0x60,0x0e,
+0xdd,0x5d,0x09,0xa4,0x95,0x5a,0xb5,0xbd,0xf4,0xd4,0x35,0xf6,0x84,0xb8,0xeb,0xd8,0x59,0x7b,0x00,0xa1,0x28,0xff,0xbd,0x13,0x92,0xb4,0xb4,0xa7,0x71,0xde,0xcc,0x7b,
+0xf3,0x99,0xd5,0xbb,0xc7,0xcf,0x0f,0xdf,0x7f,0x7c,0x79,0x8a,0x0a,0x2c,0xcd,0xfa,0x66,0xd5,0x9a,0xc8,0x08,0xbb,0xe7,0x0c,0x2c,0x6b,0x01,0x10,0x8a,0x4c,0x09,0x28,
+0x22,0x59,0x08,0x1f,0x00,0x39,0x3b,0x60,0x3e,0xb9,0x67,0x03,0x6c,0x45,0x09,0x9c,0x1d,0x35,0x9c,0x2a,0xe7,0x91,0x45,0xd2,0x59,0x04,0x4b,0x61,0x27,0xad,0xb0,0xe0,
+0x0a,0x8e,0x5a,0xc2,0xe4,0xf2,0x11,0x6b,0xab,0x51,0x0b,0x33,0x09,0x52,0x18,0xe0,0x59,0xab,0x81,0x1a,0x0d,0xac,0x1f,0x2f,0x51,0xd1,0x37,0x14,0x78,0x08,0xab,0xb4,
+0x03,0x6f,0x56,0x46,0xdb,0xd7,0xc8,0x83,0xe1,0x2c,0xe0,0xd9,0x40,0x28,0x00,0x28,0x43,0xe1,0x21,0xef,0x91,0x44,0x7e,0x94,0xf3,0xd9,0x3d,0x7c,0x48,0x64,0x08,0xad,
+0x5c,0x90,0x5e,0x57,0x18,0x05,0x2f,0x39,0x2b,0x9d,0x3a,0x18,0xf8,0x59,0x39,0x73,0xce,0xb5,0x31,0xc9,0x3c,0x03,0x31,0x9d,0xdd,0xed,0x92,0x5f,0x14,0xba,0x4a,0xbb,
+0xd0,0xbf,0x1c,0x3c,0x57,0x30,0x90,0xd8,0x5a,0x97,0x6d,0x3b,0xf5,0x1e,0x76,0x3a,0xde,0x6e,0x62,0x35,0xc5,0x38,0xbc,0x35,0xb9,0x77,0x25,0x4b,0xd2,0x03,0x6a,0x13,
+0x92,0xfc,0xf6,0xee,0x56,0xcd,0x61,0xd6,0xea,0x2d,0x4f,0xda,0x2a,0x77,0x4a,0x9c,0x35,0x4e,0x28,0x2e,0xc2,0xd9,0xca,0xd1,0x98,0xaf,0x6b,0x1a,0x47,0xc0,0xc8,0x55,
+0xc8,0x6b,0x14,0x3b,0x03,0x0f,0x46,0x84,0xb0,0xa0,0xea,0x71,0x67,0x58,0x2c,0x9d,0xd9,0xd0,0x88,0x9f,0x1d,0x0d,0x24,0x2c,0xea,0xa6,0x59,0xa2,0x3f,0xf7,0x1c,0x52,
+0x39,0x09,0x4d,0xbd,0xbc,0x8d,0x58,0x41,0xf2,0xb9,0x63,0x31,0xcb,0xbb,0xc7,0x78,0x49,0x05,0x8d,0x54,0xd2,0xe1,0x31,0xc3,0x76,0xea,0x19,0x8b,0x29,0xcf,0xe0,0xca,
+0xaf,0x5d,0xd3,0xde,0xd5,0x48,0x81,0xb2,0x18,0x81,0xf7,0xce,0x8f,0xeb,0xed,0x66,0xf4,0x87,0xf9,0xf2,0xd4,0x62,0x8b,0xe8,0x7d,0x7d,0x71,0x26,0x25,0x84,0x20,0xf6,
+0xd0,0xbc,0x10,0xa9,0x59,0x5e,0x4d,0x2b,0xed,0x6f,0x62,0xe7,0xd4,0x99,0x8c,0xd2,0xc7,0x48,0xb6,0x3d,0x71,0xd6,0x2a,0x09,0x6d,0xc1,0x5f,0x2e,0x27,0x1b,0x96,0xba,
+0xa5,0x32,0x88,0x95,0xf5,0xc1,0x5a,0xf1,0x21,0x29,0x2d,0x81,0x90,0xff,0xf1,0xe9,0xbf,0x78,0x2f,0xee,0xdd,0x69,0x22,0xe9,0xae,0x48,0x3d,0xba,0xac,0x9e,0x56,0x25,
+0xfc,0x5e,0xdb,0x09,0xba,0x6a,0x91,0x25,0xd9,0x74,0xee,0xa1,0x5c,0xb6,0xa9,0xc5,0xc0,0x29,0xa9,0x9a,0x1d,0xda,0xe1,0x62,0xd2,0x70,0x39,0xaf,0xf4,0x50,0x29,0x81,
+0xb4,0xe2,0xaf,0x90,0x7b,0xba,0xa9,0x55,0x2a,0xae,0x49,0xb9,0xf3,0x25,0x91,0xa2,0x00,0xf2,0x9a,0xcb,0xd6,0x9f,0x84,0x7c,0xed,0x62,0xfb,0xea,0x06,0xd3,0x4f,0x22,
+0xed,0x7e,0xa2,0xdf,0x30,0x0d,0xa9,0x33,0x55,0x03,0x00,0x00
+};
+const size_t WM_PK_INFO_HTML_GZ_LEN = 524;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_INFO_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x5d,0x53,0xcd,0x8e,0xda,0x30,0x10,0xbe,0xef,0x53,0xb8,0x52,0x25,0x83,0x14,0x92,0x0d,0x82,0xee,0x16,0x08,0x97,
+0xed,0x4a,0x20,0x55,0xda,0x4a,0xdb,0x4b,0x4f,0xdd,0x89,0x3d,0x21,0x6e,0x1d,0x3b,0x6b,0x0f,0x20,0x8a,0x78,0x98,0x4a,0xed,0xb1,0x4f,0x81,0xfa,0x5e,0x75,0x20,0xd9,
+0xd2,0x9e,0xc6,0xf9,0x66,0xbe,0x6f,0x7e,0x33,0x7b,0xf5,0xee,0xe1,0xee,0xe3,0xa7,0x0f,0xf7,0xac,0xa4,0x4a,0xcf,0xaf,0x66,0x8d,0x61,0x1a,0xcc,0x2a,0xe3,0x68,0x78,
+0x03,0x20,0xc8,0x60,0x2a,0x24,0x60,0xa2,0x04,0xe7,0x91,0x32,0xbe,0xa6,0x62,0x70,0xcb,0x3b,0xd8,0x40,0x85,0x19,0xdf,0x28,0xdc,0xd6,0xd6,0x11,0x67,0xc2,0x1a,0x42,
+0x13,0xc2,0xb6,0x4a,0x52,0x99,0x49,0xdc,0x28,0x81,0x83,0xd3,0x47,0xa4,0x8c,0x22,0x05,0x7a,0xe0,0x05,0x68,0xcc,0xd2,0x46,0x83,0x14,0x69,0x9c,0x3f,0x12,0x6c,0xd8,
+0x37,0x70,0x0a,0x24,0x1a,0x05,0xb3,0xe4,0x0c,0x5f,0xcd,0xb4,0x32,0x5f,0x99,0x43,0x9d,0x71,0x4f,0x3b,0x8d,0xbe,0x44,0x0c,0x39,0x4a,0x87,0x45,0x8b,0xc4,0xe2,0xad,
+0x18,0x8f,0x6e,0xf1,0x4d,0x2c,0xbc,0x6f,0x04,0xbd,0x70,0xaa,0x26,0xe6,0x9d,0xc8,0x78,0x65,0xe5,0x5a,0xe3,0xe7,0xda,0xea,0x5d,0xa1,0xb4,0x8e,0xc7,0x29,0xc2,0x70,
+0x74,0x93,0xc7,0x5f,0x42,0xe8,0x2c,0x39,0x87,0xfe,0xe5,0xd0,0xae,0xc6,0x8e,0xc4,0xe7,0xaa,0x6a,0x1a,0xda,0xaf,0x30,0x57,0xd1,0x72,0x11,0xc9,0x21,0x45,0xfe,0xf9,
+0x50,0x38,0x5b,0xf1,0x38,0x59,0x93,0xd2,0x3e,0x2e,0xae,0x6f,0xae,0xe5,0x18,0x47,0x8d,0xde,0x74,0xab,0x8c,0xb4,0xdb,0xd8,0x1a,0x6d,0x41,0x66,0xe0,0x77,0x46,0xf4,
+0xfa,0xd9,0x7c,0x1f,0x06,0xe2,0x89,0xd9,0x9a,0xb2,0x3d,0x41,0xae,0xf1,0x4e,0x83,0xf7,0x93,0x50,0x3d,0xe5,0x9a,0x47,0xc2,0xea,0x45,0x18,0xf2,0x7b,0x1b,0x46,0xe2,
+0x27,0xfb,0xc3,0x61,0x4a,0x6e,0xd7,0x72,0x82,0xca,0x16,0x54,0xe8,0xe5,0xb9,0xc7,0xcb,0x20,0x5f,0x58,0x1e,0xf1,0xe2,0xfc,0xe8,0x4f,0x43,0x41,0x3d,0x19,0x9f,0xf1,
+0x88,0x53,0x33,0xf7,0x94,0x47,0x21,0x4f,0xe7,0x2a,0x2e,0x5d,0xc3,0xd6,0x75,0x10,0x40,0xa2,0xec,0xa1,0x73,0xd6,0xf5,0xf7,0xcb,0x45,0xef,0x85,0xf9,0x74,0xdf,0x60,
+0x13,0xf6,0x7a,0x7f,0x72,0xc6,0x15,0x7a,0x0f,0x2b,0x3c,0x3c,0x05,0xd2,0x61,0x7a,0x31,0xad,0xa4,0xbd,0x8a,0xdc,0xca,0x5d,0x30,0x52,0x6d,0x98,0x68,0x7a,0xca,0x78,
+0xa3,0x04,0xca,0xa0,0x3b,0xdd,0x4e,0x3a,0x5f,0x86,0xfc,0xae,0x3a,0x7e,0x17,0x0a,0x99,0x7d,0xd9,0xef,0xf1,0x57,0x90,0x48,0x5b,0xa6,0x92,0x59,0x57,0x41,0xd8,0x48,
+0x40,0xfe,0xc7,0x87,0xff,0xe2,0x6d,0x26,0x67,0xb7,0x03,0x11,0xce,0x2c,0xa4,0x62,0xa7,0x3b,0x08,0x7b,0x03,0xb7,0x52,0x66,0x40,0xb6,0x9e,0xa4,0x71,0x3a,0x1c,0x3b,
+0xac,0xa6,0x4d,0x1d,0xd0,0x71,0xaa,0x50,0x5a,0x4e,0xa6,0x3b,0x9f,0xc4,0x13,0xd0,0xda,0x27,0xeb,0x5a,0x02,0x85,0x7d,0x3f,0xe4,0xc6,0x6e,0xd4,0xef,0x9f,0xb3,0x04,
+0x2e,0x59,0x4d,0x07,0x81,0xc5,0x3c,0x8a,0x4b,0x32,0x9f,0x3f,0xd6,0xc7,0x1f,0x5d,0x74,0x5b,0x60,0x67,0xda,0xc9,0x24,0xe7,0xdf,0xea,0x0f,0x45,0x16,0xa8,0xa5,0x67,
+0x03,0x00,0x00
+};
+const size_t WM_PK_INFO_HTML_GZ_LEN = 547;
+#else
+const uint8_t WM_PK_INFO_HTML_GZ[] PROGMEM = { 0 };
+const size_t WM_PK_INFO_HTML_GZ_LEN = 0;
+#endif
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_WIFI_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xbd,0x56,0xdb,0x6e,0x1b,0x37,0x10,0x7d,0xf7,0x57,0xb0,0x4f,0x94,0x00,0xed,0xae,0xb5,0xb0,0x9b,0xb4,0x12,0x15,
+0x24,0xb6,0x03,0x18,0x70,0x6b,0x03,0x76,0x10,0xf4,0x29,0xa0,0x96,0x5c,0x69,0x6a,0xee,0xc5,0x24,0x57,0x8a,0x60,0xf8,0xa1,0x5f,0x10,0xa4,0xe8,0x7b,0x7e,0x23,0x7f,
+0x95,0x7c,0x42,0x87,0xe4,0xae,0xbc,0xb2,0x8d,0xa0,0x05,0x9a,0x02,0x86,0x97,0x97,0x99,0x33,0x33,0x67,0xce,0x10,0x9a,0xfe,0x70,0x7c,0x7e,0x74,0xf5,0xdb,0xc5,0x09,
+0x59,0xda,0x42,0xcd,0xf6,0xa6,0xee,0x43,0x14,0x2f,0x17,0x8c,0xca,0x92,0xba,0x03,0xc9,0x05,0x7e,0x0a,0x69,0x39,0xc9,0x96,0x5c,0x1b,0x69,0x19,0x7d,0x73,0xf5,0x3a,
+0x7a,0x4e,0xbb,0xe3,0x92,0x17,0x92,0xd1,0x15,0xc8,0x75,0x5d,0x69,0x4b,0x49,0x56,0x95,0x56,0x96,0x68,0xb6,0x06,0x61,0x97,0x4c,0xc8,0x15,0x64,0x32,0xf2,0x9b,0x11,
+0x81,0x12,0x2c,0x70,0x15,0x99,0x8c,0x2b,0xc9,0xc6,0xf1,0xbe,0x83,0xb1,0x60,0x95,0x9c,0xbd,0x85,0xd7,0x40,0x8e,0xaa,0x32,0x87,0x45,0xa3,0xb9,0x85,0xaa,0x9c,0x26,
+0xe1,0x66,0x6f,0xaa,0xa0,0xbc,0x26,0x5a,0x2a,0x46,0x8d,0xdd,0x28,0x69,0x96,0x52,0x62,0xa4,0xa5,0x96,0x79,0x7b,0x12,0x67,0x3f,0x65,0x87,0x07,0xcf,0xe5,0x8f,0x71,
+0x66,0x8c,0xc3,0x34,0x99,0x86,0xda,0x12,0xa3,0x33,0x46,0x8b,0x4a,0x34,0x4a,0xbe,0xab,0x2b,0xb5,0xc9,0x41,0xa9,0xf8,0x70,0x2c,0x79,0x7a,0xf0,0x6c,0x1e,0xff,0x8e,
+0xa6,0xd3,0x24,0x98,0xde,0xfb,0xd8,0x4d,0x2d,0x3b,0x27,0x3a,0x83,0xc2,0x95,0x75,0xbb,0x90,0x73,0x18,0xdd,0x18,0x3e,0x6a,0xd2,0xfc,0x2e,0xd7,0x55,0x41,0xe3,0xa4,
+0xb1,0xa0,0x4c,0x9c,0xef,0x3f,0xdb,0x17,0x87,0xf2,0xc0,0xa1,0x4d,0xb0,0x78,0x83,0x08,0xd5,0x62,0xa1,0xe4,0xab,0xc6,0x5a,0xdc,0x32,0xf4,0x1a,0xd0,0x38,0x9c,0x45,
+0x35,0x37,0x66,0x5d,0x69,0x41,0x87,0x13,0x51,0x65,0x4d,0x81,0x4c,0xc5,0x5c,0x88,0x93,0x15,0x2e,0xce,0xc0,0x20,0x73,0x52,0x0f,0xe8,0xf1,0xf9,0x2f,0x47,0x81,0xc6,
+0xb3,0x8a,0x0b,0x29,0xe8,0x68,0x30,0x64,0xb3,0xdb,0x1d,0xdc,0x38,0xaf,0xf4,0x09,0xcf,0x96,0x83,0xb9,0xdf,0xe3,0x75,0x58,0x3c,0x01,0x97,0x29,0xc8,0xae,0xe9,0x28,
+0x6f,0xca,0xcc,0xf1,0x3a,0x18,0xde,0xb6,0x79,0x72,0xbd,0x90,0xf6,0x54,0x30,0xbb,0x04,0x13,0xe3,0xf2,0xa5,0xb5,0x1a,0x10,0x46,0x0e,0xa8,0xe0,0x96,0x47,0xc1,0x00,
+0x73,0x0d,0xf6,0x5d,0xf2,0xa7,0x65,0xdd,0x58,0xe6,0x28,0x19,0x74,0x10,0xc3,0x09,0xe4,0x83,0x9d,0xfb,0x6d,0x10,0x47,0xe7,0xce,0xcd,0x83,0x48,0xce,0x80,0x0e,0x19,
+0x63,0x74,0x4b,0xce,0x0b,0x6a,0xe5,0x7b,0x4b,0x7f,0xbe,0x3f,0x99,0xec,0x22,0x98,0xc7,0x08,0x23,0xf7,0x7f,0x38,0xf1,0xa5,0x38,0xef,0x96,0x40,0xe6,0xe3,0xef,0x82,
+0x7f,0xfd,0xf4,0xf1,0x8f,0x2f,0x9f,0x3f,0x20,0xfe,0xd7,0x4f,0x7f,0xfd,0x49,0x27,0x77,0x77,0xc3,0x49,0xf8,0x5b,0x43,0x29,0xaa,0x75,0x5c,0x95,0x0a,0x79,0x67,0x9e,
+0x74,0x6c,0x38,0xb6,0x2f,0x31,0x37,0x2f,0xc4,0x7b,0xb6,0x86,0x1c,0x90,0x8e,0xbb,0x49,0x4f,0x36,0x49,0x3b,0x24,0xf3,0x4a,0x6c,0xf0,0x23,0x60,0x45,0x32,0x85,0xc1,
+0x18,0x75,0xa3,0xc0,0x01,0x5b,0xe0,0x47,0x69,0xfc,0xa4,0xc4,0xf1,0x78,0x6f,0x8a,0xad,0x2c,0x3a,0x27,0xb7,0x36,0x32,0xa3,0x04,0xa7,0x6b,0x59,0x09,0x46,0x2f,0xce,
+0x2f,0xaf,0x28,0xe1,0xbe,0x75,0x0c,0x33,0xf1,0x39,0x38,0xc0,0x74,0x76,0xa1,0xa1,0xe0,0x7a,0x43,0x7e,0x95,0x16,0x4b,0xbb,0x46,0xb4,0x34,0x64,0xe0,0x66,0x86,0xcf,
+0xa5,0xda,0x82,0xaa,0xb9,0xa2,0x04,0xa1,0x71,0x5e,0x0c,0x88,0x31,0x9d,0x5d,0x5e,0x9e,0x1e,0x93,0xf1,0x34,0xf1,0x66,0x68,0x0e,0x8e,0xd7,0xad,0x39,0xee,0x68,0x3b,
+0x08,0xbe,0x13,0x04,0x44,0xe7,0xd9,0x0e,0x7c,0xbb,0xd1,0xf2,0xa6,0x01,0x2d,0x05,0xe1,0x1a,0x78,0xe4,0xc1,0x18,0xf5,0x75,0xba,0x00,0x2e,0xcd,0x24,0xa4,0xf3,0xed,
+0xa4,0xea,0xb5,0xcb,0xe9,0xa2,0x6d,0x51,0x3f,0xaf,0x1e,0x9d,0x5d,0x07,0xa3,0xb5,0xe6,0x75,0x1d,0x58,0x7d,0x94,0xf6,0x56,0xa4,0x91,0xbf,0xea,0xaa,0xd8,0x76,0xdf,
+0x57,0xe2,0xc3,0xb5,0x85,0x84,0xf5,0xa3,0xf4,0xbb,0x5c,0x5c,0x90,0x30,0x58,0x2d,0x52,0xd8,0xd0,0x2e,0xe6,0xc3,0xb9,0xf6,0xf8,0xe1,0xf0,0x1d,0x72,0xd8,0x1b,0xa3,
+0xa7,0x42,0x5d,0x79,0xc3,0x6d,0xce,0x64,0x4c,0x56,0x60,0x60,0x0e,0x0a,0xec,0x86,0xce,0x5a,0x9d,0x4e,0x93,0x10,0xf3,0x9e,0xcc,0x7b,0x4e,0xbb,0x34,0x0a,0x1c,0x04,
+0xcc,0xf5,0x4c,0xf2,0x55,0x0f,0x4e,0x16,0xb5,0xdd,0x38,0x86,0x49,0x55,0xcb,0x92,0x94,0x41,0x26,0x26,0xee,0x00,0x96,0x3a,0xe8,0xe8,0xa5,0xb2,0x52,0x97,0xa8,0x48,
+0x74,0x6e,0xb5,0x44,0x06,0xe7,0xb5,0x53,0x1c,0x57,0xc3,0x7f,0x2c,0xab,0xb4,0x95,0x55,0xfa,0xaf,0x65,0x95,0xf6,0x65,0x95,0xfe,0x97,0xb2,0x4a,0x7b,0xb2,0x4a,0xbf,
+0xbf,0xac,0xd2,0x9e,0xac,0xd2,0xef,0x25,0x2b,0x2f,0xa3,0x87,0xca,0x4a,0xbf,0xad,0xac,0xf4,0xff,0x55,0x56,0x0f,0x40,0x57,0xeb,0x28,0xc3,0x97,0x38,0x30,0xdb,0x16,
+0xdd,0x7b,0xec,0xe6,0xb6,0xec,0xe8,0x34,0xcd,0xbc,0x00,0x8b,0x2a,0x72,0xb1,0x1c,0x5f,0xbd,0x04,0xf9,0x03,0x1f,0x82,0x8f,0xa4,0x77,0x0d,0x3f,0x03,0x12,0x3a,0x7b,
+0xc5,0x33,0x7c,0x02,0x79,0xaf,0x18,0x67,0xda,0xdb,0xb6,0x2f,0x74,0x12,0x7e,0xed,0xfc,0x0d,0xb4,0x38,0xa9,0x4b,0xfe,0x08,0x00,0x00
+};
+const size_t WM_PK_WIFI_HTML_GZ_LEN = 922;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_WIFI_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xc5,0x56,0xcd,0x6e,0x1b,0x37,0x10,0xbe,0xfb,0x29,0xd8,0x13,0x25,0x40,0x5a,0x59,0x0b,0xbb,0x49,0x2b,0x51,0x41,
+0x1a,0x3b,0xa8,0xd1,0x04,0x16,0x60,0x07,0x45,0x4f,0x01,0xb5,0x1c,0x49,0x93,0x70,0x97,0x6b,0x92,0x2b,0x45,0x35,0x7c,0xc8,0x13,0x14,0x2d,0x7a,0x0f,0x02,0xb4,0x87,
+0x1e,0x7a,0xef,0x29,0x17,0x35,0xcf,0xd3,0x3c,0x42,0x87,0xfb,0x23,0x4b,0xb6,0x11,0xb4,0x40,0x83,0x02,0x86,0x97,0x3f,0x33,0xdf,0xcc,0x7c,0xf3,0x0d,0xa1,0xe1,0x67,
+0x47,0xa7,0x8f,0xce,0xbf,0x1b,0x1f,0xb3,0xb9,0x4f,0xf5,0x68,0x6f,0x18,0x3e,0x4c,0xcb,0x6c,0x26,0x38,0x64,0x3c,0x1c,0x80,0x54,0xf4,0x49,0xc1,0x4b,0x96,0xcc,0xa5,
+0x75,0xe0,0x05,0x7f,0x76,0xfe,0xb8,0x7b,0x9f,0x37,0xc7,0x99,0x4c,0x41,0xf0,0x05,0xc2,0x32,0x37,0xd6,0x73,0x96,0x98,0xcc,0x43,0x46,0x66,0x4b,0x54,0x7e,0x2e,0x14,
+0x2c,0x30,0x81,0x6e,0xb9,0xe9,0x30,0xcc,0xd0,0xa3,0xd4,0x5d,0x97,0x48,0x0d,0xa2,0x1f,0xed,0x07,0x18,0x8f,0x5e,0xc3,0xe8,0x1b,0x93,0x4d,0x71,0x56,0xd8,0xf5,0xdb,
+0x04,0x25,0xfb,0x16,0x1f,0xe3,0xb0,0x57,0xdd,0xec,0x0d,0x35,0x66,0x2f,0x99,0x05,0x2d,0xb8,0xf3,0x2b,0x0d,0x6e,0x0e,0x40,0x91,0xe6,0x16,0xa6,0xf5,0x49,0x94,0x7c,
+0x91,0x1c,0x1e,0xdc,0x87,0xcf,0xa3,0xc4,0xb9,0x80,0xe9,0x12,0x8b,0xb9,0x67,0xce,0x26,0x82,0xa7,0x46,0x15,0x1a,0x9e,0xe7,0x46,0xaf,0xa6,0xa8,0x75,0x74,0xd8,0x07,
+0x19,0x1f,0xdc,0x9b,0x44,0x2f,0xc8,0x74,0xd8,0xab,0x4c,0xaf,0x7d,0xfc,0x2a,0x87,0xc6,0x89,0x8f,0x30,0x0d,0x65,0x5d,0xce,0x60,0x82,0x9d,0x0b,0x27,0x3b,0x45,0x3c,
+0xbd,0x9a,0x5a,0x93,0xf2,0xa8,0x57,0x78,0xd4,0x2e,0x9a,0xee,0xdf,0xdb,0x57,0x87,0x70,0x10,0xd0,0x06,0x54,0xbc,0x23,0x04,0x33,0x9b,0x69,0xf8,0xaa,0xf0,0x9e,0xb6,
+0x82,0xbc,0x5a,0x3c,0xaa,0xce,0xba,0xb9,0x74,0x6e,0x69,0xac,0xe2,0xed,0x81,0x32,0x49,0x91,0x12,0x53,0x91,0x54,0xea,0x78,0x41,0x8b,0x27,0xe8,0x88,0x39,0xb0,0x2d,
+0x7e,0x74,0xfa,0xf4,0x51,0x45,0xe3,0x13,0x23,0x15,0x28,0xde,0x69,0xb5,0xc5,0xe8,0x72,0x07,0x37,0x9a,0x1a,0x7b,0x2c,0x93,0x79,0x6b,0x52,0xee,0xe9,0xba,0x5a,0xdc,
+0x01,0x97,0x68,0x4c,0x5e,0xf2,0xce,0xb4,0xc8,0x12,0x8f,0x26,0x6b,0xb5,0x2f,0xeb,0x3c,0xa5,0x9d,0x81,0x3f,0x51,0xc2,0xcf,0xd1,0x45,0xb4,0x7c,0xe8,0xbd,0x45,0x82,
+0x81,0x16,0x57,0xd2,0xcb,0x6e,0x65,0x40,0xb9,0x56,0xf6,0x4d,0xf2,0x27,0x59,0x5e,0x78,0x11,0x28,0x69,0x35,0x10,0xed,0x01,0x4e,0x5b,0x3b,0xf7,0x9b,0x20,0x81,0xce,
+0x9d,0x9b,0x1b,0x91,0x82,0x01,0x6f,0x0b,0x21,0xf8,0x86,0x9c,0x07,0xdc,0xc3,0x2b,0xcf,0xbf,0xbc,0x3e,0x19,0xec,0x22,0xb8,0xdb,0x08,0x9d,0xf0,0xbf,0x3d,0x28,0x4b,
+0x09,0xde,0x35,0x81,0xa2,0x8c,0xbf,0x0b,0xfe,0xe1,0xcd,0x8f,0xaf,0xff,0xfa,0xe3,0x07,0xc2,0xff,0xf0,0xe6,0xe7,0x9f,0xf8,0xe0,0xea,0xaa,0x3d,0xa8,0xfe,0x96,0x98,
+0x29,0xb3,0x8c,0x4c,0xa6,0x89,0x77,0x51,0x92,0x4e,0x0d,0xa7,0xf6,0xf5,0xdc,0xc5,0x03,0xf5,0x4a,0x2c,0x71,0x8a,0x44,0xc7,0xd5,0x60,0x4b,0x36,0xbd,0x7a,0x48,0x26,
+0x46,0xad,0xe8,0xa3,0x70,0xc1,0x12,0x4d,0xc1,0x04,0x0f,0xa3,0x20,0x91,0x5a,0x50,0x8e,0x52,0xff,0x4e,0x89,0xd3,0xf1,0xde,0x90,0x5a,0x99,0x36,0x4e,0x61,0xed,0x20,
+0xe1,0x8c,0xa6,0x6b,0x6e,0x94,0xe0,0xe3,0xd3,0xb3,0x73,0xce,0x64,0xd9,0x3a,0x41,0x99,0x94,0x39,0x04,0xc0,0x78,0x34,0xb6,0x98,0xae,0xdf,0xda,0x4c,0x32,0x87,0xf0,
+0xfe,0x57,0x42,0x8b,0xab,0x0c,0xc2,0xcc,0xc8,0x09,0xe8,0x0d,0xa8,0x9e,0x68,0xce,0x08,0x9a,0xe6,0xc5,0xa1,0xea,0xf3,0xd1,0xd9,0xd9,0xc9,0x11,0xeb,0x0f,0x7b,0xa5,
+0x19,0x99,0x63,0xe0,0x75,0x63,0x4e,0x3b,0x5e,0x0f,0x42,0xd9,0x09,0x86,0xaa,0xf1,0xac,0x07,0xbe,0xde,0x58,0xb8,0x28,0xd0,0x82,0x62,0xd2,0xa2,0xec,0x96,0x60,0x82,
+0x87,0xca,0x58,0x08,0x10,0xd2,0xec,0x55,0xe9,0x7c,0x3c,0xa9,0x7c,0x19,0x72,0xfa,0x1a,0x9c,0x36,0xdb,0x49,0x6d,0x71,0xd9,0xb4,0xaf,0xbb,0xb4,0x32,0xcf,0x2b,0x4a,
+0x6f,0xe5,0xbc,0x51,0x68,0xb7,0xbc,0x6a,0x4a,0xd8,0xb4,0xbe,0x2c,0xa3,0x8c,0x55,0x57,0x51,0xad,0x6f,0xe5,0x3e,0x6e,0x1c,0x42,0x5b,0xcb,0xa9,0xaa,0x91,0xaa,0x0d,
+0x6f,0x62,0xde,0x1c,0xea,0x12,0xbf,0x3a,0x7c,0x4e,0x04,0x6e,0xcd,0xd0,0x5d,0xa1,0xce,0x4b,0xc3,0x4d,0xce,0xac,0xcf,0x16,0xe8,0x70,0x82,0x1a,0xfd,0x8a,0x8f,0x6a,
+0x91,0x0e,0x7b,0x55,0xcc,0x6b,0x26,0xaf,0x09,0x6d,0xd2,0x48,0x69,0x0a,0x28,0xd7,0xb1,0x05,0x66,0xfc,0xc2,0x58,0xc8,0xd6,0xbf,0x05,0x45,0x78,0x60,0x19,0xd0,0xb3,
+0xfd,0x82,0x16,0xf3,0x92,0xdb,0x9c,0xb4,0xf7,0xbd,0xca,0x20,0x6a,0x50,0xe6,0xb6,0x52,0xd2,0x43,0xed,0x81,0x74,0xe4,0xd7,0xbf,0x2f,0x1a,0x35,0xb1,0xd6,0xc2,0x50,
+0x2a,0xf0,0xe7,0x3b,0x82,0x6b,0xff,0x63,0x6d,0xc5,0xb5,0xb6,0xe2,0x7f,0xad,0xad,0x78,0x5b,0x5b,0xf1,0x7f,0xa9,0xad,0xb8,0xd1,0x56,0xfc,0xe9,0xb5,0x15,0x6f,0x69,
+0x2b,0xfe,0x54,0xda,0x2a,0xb5,0x74,0x53,0x5e,0xf1,0xc7,0xe5,0x15,0xff,0x0f,0xf2,0xda,0x42,0xb1,0x66,0xd9,0x4d,0xe8,0x41,0xae,0xe8,0xad,0x2b,0xdf,0x7a,0xf3,0x26,
+0x3e,0x6b,0x38,0x75,0xc5,0x24,0x45,0xcf,0x47,0xcf,0xb4,0x79,0xff,0x0e,0x49,0x89,0xd5,0x53,0xb9,0xc9,0x54,0xde,0xf0,0x63,0xf4,0x5e,0x96,0xee,0xd5,0x2f,0x82,0x1e,
+0x29,0x30,0x5f,0xff,0x12,0xde,0x43,0xb9,0x55,0x57,0x30,0xde,0xda,0xd6,0xcf,0x75,0xaf,0xfa,0xe9,0xf3,0x37,0xf9,0x6d,0x21,0xdc,0x0b,0x09,0x00,0x00
+};
+const size_t WM_PK_WIFI_HTML_GZ_LEN = 957;
+#else
+const uint8_t WM_PK_WIFI_HTML_GZ[] PROGMEM = { 0 };
+const size_t WM_PK_WIFI_HTML_GZ_LEN = 0;
+#endif
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_MQTT_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x55,0xdd,0x6e,0xdb,0x36,0x14,0xbe,0xef,0x53,0xb0,0x57,0xb4,0x01,0x5b,0xaa,0xdb,0x64,0xcd,0x6a,0xd3,0xc5,
+0x9a,0x66,0x58,0x80,0x14,0xc9,0x10,0xf7,0x62,0x57,0x05,0x25,0x1e,0x59,0x9c,0x29,0xd1,0x21,0x29,0xbb,0x46,0x90,0x8b,0x3d,0xc1,0xb0,0x61,0xf7,0x7d,0x8d,0xbd,0xd5,
+0xfa,0x08,0x3b,0x24,0x25,0xff,0x24,0x41,0x91,0x02,0x82,0x74,0x48,0x9e,0xf3,0x9d,0x8f,0x1f,0xcf,0xa1,0x26,0xcf,0xdf,0x5f,0x9e,0xce,0x7e,0xbb,0x3a,0x23,0xa5,0xab,
+0xd4,0xf4,0xd9,0xc4,0x7f,0x88,0xe2,0xf5,0x9c,0x51,0xa8,0xa9,0x9f,0x00,0x2e,0xf0,0x53,0x81,0xe3,0x24,0x2f,0xb9,0xb1,0xe0,0x18,0xfd,0x38,0xfb,0x79,0x78,0x42,0xbb,
+0xe9,0x9a,0x57,0xc0,0xe8,0x4a,0xc2,0x7a,0xa9,0x8d,0xa3,0x24,0xd7,0xb5,0x83,0x1a,0xdd,0xd6,0x52,0xb8,0x92,0x09,0x58,0xc9,0x1c,0x86,0x61,0x30,0x90,0xb5,0x74,0x92,
+0xab,0xa1,0xcd,0xb9,0x02,0x36,0xf2,0x18,0x4e,0x3a,0x05,0xd3,0x0f,0xbf,0xce,0x66,0xe4,0x54,0xd7,0x85,0x9c,0x37,0x86,0x3b,0xa9,0xeb,0x49,0x1a,0x57,0x9e,0x4d,0x94,
+0xac,0x17,0xc4,0x80,0x62,0xd4,0xba,0x8d,0x02,0x5b,0x02,0x60,0x9a,0xd2,0x40,0xd1,0xce,0x24,0xf9,0x8f,0xf9,0xf1,0xd1,0x09,0xfc,0x90,0xe4,0xd6,0x7a,0x4c,0x9b,0x1b,
+0xb9,0x74,0xc4,0x9a,0x9c,0xd1,0x4a,0x8b,0x46,0xc1,0xa7,0xa5,0x56,0x9b,0x42,0x2a,0x95,0x1c,0x8f,0x80,0xbf,0x3c,0x7a,0x9d,0x25,0xbf,0xa3,0xeb,0x24,0x8d,0xae,0xbb,
+0x18,0xb7,0x59,0x42,0x17,0x44,0xa7,0xb2,0xf2,0x7b,0xba,0x9d,0x43,0x26,0x07,0x37,0x96,0x0f,0x9a,0x97,0xc5,0x5d,0x61,0x74,0x45,0x93,0xb4,0x71,0x52,0xd9,0xa4,0x78,
+0xf1,0xfa,0x85,0x38,0x86,0x23,0x8f,0x36,0xc6,0x9d,0x5b,0x44,0xd0,0xf3,0xb9,0x82,0x77,0x8d,0x73,0x38,0x64,0x18,0xd5,0xa3,0x49,0x9c,0x1b,0x2e,0xb9,0xb5,0x6b,0x6d,
+0x04,0xed,0x8f,0xd7,0xb2,0x16,0x7a,0x9d,0xe8,0x5a,0x69,0x2e,0x58,0xaf,0xcf,0xa6,0xb7,0x08,0x8e,0xae,0xa9,0xbd,0x79,0x2b,0x3e,0xb3,0xea,0xc6,0x39,0x74,0xbb,0x1b,
+0x0b,0x9d,0x37,0x15,0xea,0x99,0x70,0x21,0xce,0x56,0x68,0x5c,0x48,0x8b,0xfa,0x82,0xe9,0xd1,0xf7,0x97,0x1f,0x4e,0xa3,0xd8,0x17,0x08,0x02,0x82,0x0e,0x02,0xce,0x01,
+0x81,0xa4,0xd0,0xe6,0x8c,0xe7,0x65,0x2f,0x0b,0x63,0x5c,0x8e,0xc6,0x23,0x70,0xb9,0x92,0xf9,0x82,0x0e,0x8a,0xa6,0xce,0xfd,0x01,0xf4,0xfa,0xb7,0xed,0x86,0xb8,0x99,
+0x83,0x3b,0x17,0xcc,0x95,0xd2,0x26,0x68,0xfe,0xe4,0x9c,0x91,0x08,0x03,0x3d,0x2a,0xb8,0xe3,0xc3,0xe8,0x80,0x6c,0xa3,0x7f,0xb7,0xcb,0xf3,0x7a,0xd9,0x38,0xe6,0xb5,
+0xeb,0x75,0x10,0xfd,0xb1,0x2c,0x7a,0x07,0xeb,0xdb,0x24,0x5e,0xf7,0x83,0x95,0x7b,0x99,0xbc,0x03,0xed,0x33,0xc6,0xe8,0x56,0xc5,0xb7,0xd4,0xc1,0x67,0x47,0xdf,0xec,
+0x66,0xc6,0x87,0x08,0xf6,0x21,0xc2,0xc0,0xbf,0xfb,0xe3,0xb0,0x15,0x1f,0xdd,0x0a,0xc8,0x42,0xfe,0x43,0xf0,0xaf,0x5f,0xfe,0xfa,0xe3,0xbf,0x7f,0xff,0x44,0xfc,0xaf,
+0x5f,0xfe,0xf9,0x9b,0x8e,0xef,0xee,0xf0,0x3c,0xc2,0xb3,0x57,0x36,0x69,0xdb,0x21,0x99,0x16,0x1b,0xfc,0x08,0xb9,0x22,0xb9,0x42,0x0c,0x46,0x7d,0x1f,0x70,0x89,0xca,
+0x86,0x3e,0x1a,0x75,0xd3,0xce,0x29,0xfa,0x68,0xb9,0x97,0x23,0xf4,0xc3,0xd3,0xaa,0x3a,0x4f,0x6f,0x5b,0xc8,0x29,0xc1,0x36,0x2b,0xb5,0x60,0xf4,0xea,0xf2,0x7a,0x46,
+0x09,0x0f,0xa7,0xc3,0x68,0x1a,0x4a,0x24,0xe6,0xf4,0x5d,0xc2,0x33,0x50,0xdb,0x50,0x95,0x29,0x4a,0x10,0x80,0xd1,0x52,0x5b,0xd7,0x26,0xfc,0x05,0xcd,0x49,0x1a,0x1c,
+0x31,0x40,0x7a,0x89,0xb6,0x01,0x38,0xa2,0x6d,0xf1,0x07,0x51,0x89,0x14,0x6d,0x6c,0xdb,0xe0,0xd1,0x36,0x70,0xd3,0x48,0x03,0x82,0x70,0x23,0xf9,0x30,0x40,0x31,0x1a,
+0xc0,0x63,0x1e,0x14,0x24,0xd2,0xf9,0x36,0xa9,0x70,0x53,0x4c,0xaf,0xf0,0xfd,0x04,0x3e,0x75,0x53,0x65,0xa8,0x62,0x60,0x14,0xaf,0x98,0xc8,0x28,0xda,0x2b,0xae,0x1a,
+0x1c,0x8c,0x4e,0x4e,0x5e,0x7d,0x8b,0x5e,0xcc,0xf8,0x44,0x7a,0x8d,0xf5,0xa7,0xf6,0x11,0xdf,0x3e,0xd3,0x77,0x49,0x16,0x42,0x5b,0x82,0xd1,0x7e,0x40,0xa5,0x69,0x71,
+0x9f,0xae,0xd6,0x5a,0xa0,0x58,0x6d,0x61,0xee,0xd8,0xec,0xd5,0x5a,0x57,0xb5,0xc3,0xb5,0xe1,0xcb,0x65,0x2c,0xb9,0x07,0x64,0xb7,0x8d,0x39,0x0c,0x4b,0x1d,0xf7,0x6d,
+0xc5,0x47,0x81,0x31,0x57,0xa7,0xaf,0x37,0x1f,0xb0,0xef,0x78,0xf8,0x14,0xf1,0x2a,0x69,0x71,0xe2,0x80,0x6e,0xeb,0xfc,0xde,0x95,0x17,0xd0,0xe3,0xe4,0xa7,0x80,0xbc,
+0x77,0x75,0x3c,0x92,0x6b,0x16,0x3c,0xb7,0x94,0xc9,0x4a,0x5a,0x99,0x49,0x25,0xdd,0x86,0x4e,0xdb,0xc6,0x9c,0xa4,0x31,0xe5,0x4e,0xc6,0x9d,0x9a,0x1d,0x8b,0x0a,0x3b,
+0x1f,0xa9,0x9e,0x17,0x64,0xa3,0x1b,0x43,0x32,0xa3,0x17,0x60,0xba,0x32,0xb1,0x64,0x76,0x71,0x4d,0xb4,0x21,0x7c,0x7b,0x26,0x69,0x97,0x70,0x40,0xfc,0xdf,0x82,0xb8,
+0x12,0xd0,0x00,0x25,0xec,0x98,0x68,0x1c,0x98,0xb5,0xb4,0x40,0x14,0xf0,0x15,0x90,0x0c,0x7f,0x94,0x8b,0xe4,0x91,0xa4,0x46,0xaf,0x87,0x39,0x5e,0x2a,0xf1,0x1c,0x5a,
+0x91,0xf6,0x9a,0x3a,0x73,0x75,0x27,0xbe,0x6d,0xb2,0x4a,0x62,0x61,0x5e,0x7b,0x40,0xaf,0xef,0xde,0xa6,0xf8,0xbd,0x18,0x82,0x97,0x41,0x08,0x8d,0xbf,0xbe,0x94,0x4e,
+0xdf,0xf1,0x7c,0x31,0x49,0xf9,0x9e,0x00,0xde,0x75,0x6f,0xd8,0xde,0x4a,0x69,0xfc,0xbd,0xff,0x0f,0xd1,0xc0,0x42,0xc2,0xef,0x07,0x00,0x00
+};
+const size_t WM_PK_MQTT_HTML_GZ_LEN = 923;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_MQTT_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x55,0x4d,0x6f,0x1b,0x37,0x10,0xbd,0xe7,0x57,0xb0,0x27,0x4a,0x80,0xb4,0x1b,0xa7,0x76,0xe3,0x56,0xa2,0x82,
+0x34,0x71,0x91,0xa0,0x0e,0xac,0xc2,0xca,0xa1,0xa7,0x80,0xbb,0xa4,0xb4,0xb4,0xb8,0xcb,0x35,0xc9,0x95,0xa2,0x1a,0x3e,0xe4,0x96,0x5b,0xd1,0xa2,0xf7,0x40,0x40,0x73,
+0xe8,0x21,0xf7,0x9e,0x7c,0x51,0xf5,0x7b,0x9a,0x9f,0xd0,0x21,0xb9,0x2b,0x4b,0xb6,0x11,0xb8,0x80,0xa0,0xe5,0xc7,0xcc,0x9b,0xc7,0xc7,0x99,0x61,0xff,0xab,0xe7,0x27,
+0xcf,0x46,0x3f,0x0f,0x8f,0x50,0x66,0x73,0x39,0x78,0xd0,0x77,0x1f,0x24,0x69,0x31,0x21,0x98,0x17,0xd8,0x2d,0x70,0xca,0xe0,0x93,0x73,0x4b,0x51,0x9a,0x51,0x6d,0xb8,
+0x25,0xf8,0xf5,0xe8,0x87,0xee,0x21,0x6e,0x96,0x0b,0x9a,0x73,0x82,0x67,0x82,0xcf,0x4b,0xa5,0x2d,0x46,0xa9,0x2a,0x2c,0x2f,0xc0,0x6c,0x2e,0x98,0xcd,0x08,0xe3,0x33,
+0x91,0xf2,0xae,0x9f,0x74,0x44,0x21,0xac,0xa0,0xb2,0x6b,0x52,0x2a,0x39,0xd9,0x73,0x18,0x56,0x58,0xc9,0x07,0x3f,0xaa,0x62,0x2c,0x26,0x95,0x5e,0x2d,0x53,0x41,0xd1,
+0xab,0x9f,0x46,0xa3,0x7e,0x1c,0x76,0x1e,0xf4,0xa5,0x28,0xa6,0x48,0x73,0x49,0xb0,0xb1,0x0b,0xc9,0x4d,0xc6,0x39,0x84,0xc9,0x34,0x1f,0xd7,0x2b,0x51,0xfa,0x6d,0x7a,
+0xb0,0x7f,0xc8,0xbf,0x89,0x52,0x63,0x1c,0xa6,0x49,0xb5,0x28,0x2d,0x32,0x3a,0x25,0x38,0x57,0xac,0x92,0xfc,0x4d,0xa9,0xe4,0x62,0x2c,0xa4,0x8c,0x0e,0xf6,0x38,0x7d,
+0xb4,0xff,0x38,0x89,0xce,0xc0,0xb4,0x1f,0x07,0xd3,0x6b,0x1f,0xbb,0x28,0x79,0xe3,0x84,0x07,0x22,0x77,0x67,0xba,0x98,0xf0,0x44,0x74,0xce,0x0d,0xed,0x54,0x8f,0xc6,
+0x97,0x63,0xad,0x72,0x1c,0xc5,0x95,0x15,0xd2,0x44,0xe3,0x87,0x8f,0x1f,0xb2,0x03,0xbe,0xef,0xd0,0x7a,0x70,0x72,0x03,0x08,0x6a,0x32,0x91,0xfc,0xfb,0xca,0x5a,0x98,
+0x12,0xf0,0x6a,0xe1,0x28,0xac,0x75,0x4b,0x6a,0xcc,0x5c,0x69,0x86,0xdb,0xbd,0xb9,0x28,0x98,0x9a,0x47,0xaa,0x90,0x8a,0x32,0xd2,0x6a,0x93,0xc1,0x05,0x80,0x83,0x69,
+0x6c,0xce,0x9f,0xb0,0xb7,0x24,0x3f,0xb7,0x16,0xcc,0x2e,0x7b,0x4c,0xa5,0x55,0x0e,0x7a,0x46,0x94,0xb1,0xa3,0x19,0x0c,0x8e,0x85,0x01,0x7d,0xb9,0x6e,0xe1,0xe7,0x27,
+0xaf,0x9e,0x05,0xb1,0x8f,0x01,0x84,0x33,0xdc,0xf1,0x38,0x3b,0x04,0xa2,0xb1,0xd2,0x47,0x34,0xcd,0x5a,0x89,0x9f,0xc3,0x76,0x18,0xdc,0x01,0x97,0x4a,0x91,0x4e,0x71,
+0x67,0x5c,0x15,0xa9,0x15,0xaa,0x68,0xb5,0x2f,0xea,0x03,0x51,0x3d,0xe1,0xf6,0x25,0x23,0x36,0x13,0x26,0x82,0xe1,0x53,0x6b,0xb5,0x00,0x18,0xde,0xc2,0x8c,0x5a,0xda,
+0x0d,0x06,0xc0,0x36,0xd8,0x37,0xa7,0x7c,0x59,0x94,0x95,0x25,0x4e,0xbb,0x56,0x03,0xd1,0xee,0x89,0x71,0x6b,0x67,0x7f,0x13,0xc4,0xe9,0xbe,0xb3,0x73,0x23,0x92,0x33,
+0xc0,0x6d,0x42,0x08,0xde,0xa8,0xf8,0x04,0x5b,0xfe,0xd6,0xe2,0xef,0xae,0x57,0x7a,0xbb,0x08,0xe6,0x36,0x42,0xc7,0xfd,0xb7,0x7b,0xfe,0x28,0xce,0xbb,0x16,0x90,0xf8,
+0xf8,0xbb,0xe0,0x9f,0x3f,0xfc,0xf6,0xee,0xdf,0xbf,0x7f,0x05,0xfc,0xcf,0x1f,0xfe,0xf8,0x1d,0xf7,0x2e,0x2f,0xe1,0x3e,0xfc,0x6f,0x2b,0x6d,0xe2,0xba,0x42,0x12,0xc5,
+0x16,0xf0,0x61,0x62,0x86,0x52,0x09,0x18,0x04,0xbb,0x3a,0xa0,0x02,0x94,0xf5,0x75,0xb4,0xd7,0x2c,0x5b,0x2b,0xf1,0x9d,0xe9,0x9e,0xed,0x81,0x1d,0xdc,0x56,0xde,0x58,
+0xba,0xb1,0xe1,0x29,0x46,0x50,0x66,0x99,0x62,0x04,0x0f,0x4f,0x4e,0x47,0x18,0x51,0x7f,0x3b,0x04,0xc7,0x3e,0x45,0x42,0x4c,0x57,0x25,0x34,0xe1,0x72,0xe3,0x2a,0x13,
+0x89,0x11,0x00,0x10,0x9c,0x29,0x03,0x56,0x2e,0x04,0x7a,0x01,0xc3,0x7e,0xec,0x0d,0xc1,0x41,0x38,0x89,0x36,0x0e,0x30,0xc3,0x75,0xf2,0x7b,0x51,0x91,0x60,0xb5,0x6f,
+0x5d,0xe0,0x61,0xac,0xf9,0x79,0x25,0x34,0x67,0x88,0x6a,0x41,0xbb,0x1e,0x8a,0x60,0x0f,0x1e,0xe2,0x80,0x20,0x81,0xce,0x97,0x49,0xf9,0x4e,0x31,0x18,0xc2,0xff,0x3d,
+0xf8,0x14,0x55,0x9e,0x80,0x8a,0x9e,0x51,0x68,0x31,0x81,0x51,0x18,0xcf,0xa8,0xac,0x60,0xb2,0x77,0x78,0xf8,0xf5,0x97,0xe8,0x85,0x88,0xf7,0xa4,0x57,0x19,0x77,0x6b,
+0x43,0x55,0xad,0xaf,0x56,0x9f,0x66,0xd4,0xf2,0x7f,0xae,0xcc,0x74,0xf5,0x17,0x5c,0x44,0xa1,0xfe,0x97,0x80,0x1e,0xa8,0xa6,0x1b,0xc6,0xb7,0x88,0xb9,0x65,0x67,0x70,
+0x7f,0xed,0xe6,0x0c,0x0f,0x5e,0x70,0x23,0xb7,0xa8,0x6c,0xa5,0x5d,0x93,0xc0,0xdd,0xb9,0xa6,0x65,0x19,0xb2,0xef,0x16,0xd3,0x4d,0x8d,0x76,0xfd,0x56,0x43,0x7c,0x93,
+0xfc,0x41,0x6b,0x08,0xd4,0x48,0xed,0x86,0xb7,0xa8,0x0f,0x1b,0x73,0x97,0xff,0xbe,0xab,0xd4,0x38,0x61,0x82,0x37,0x29,0x7f,0xa3,0xfb,0x79,0xf4,0xb0,0xf8,0xc6,0x23,
+0x6f,0x75,0x91,0x3b,0x62,0x8d,0xbc,0xe5,0x86,0x32,0x9a,0x09,0x23,0x12,0x21,0x85,0x5d,0xe0,0x41,0x5d,0xa3,0xfd,0x38,0x84,0xbc,0xd6,0xf0,0x5a,0xca,0x86,0x45,0x0e,
+0x4d,0x00,0xa8,0x3e,0x9d,0xa2,0xd9,0x6a,0xb9,0x5e,0xa2,0x44,0xab,0x29,0xd7,0x68,0xb6,0x58,0x5f,0x51,0x56,0x9d,0x71,0x34,0x3a,0x3e,0x45,0xf0,0x2c,0x25,0xca,0xdf,
+0x33,0x14,0x36,0x48,0xdc,0x81,0xfd,0x52,0xae,0xdf,0x5b,0x88,0xaf,0x57,0x9f,0x8c,0xac,0xd6,0xcb,0x02,0x32,0x01,0x9e,0x13,0x41,0x7b,0x48,0x14,0x74,0x8a,0x44,0x9a,
+0xa1,0x82,0xc3,0xeb,0x78,0x16,0xac,0x96,0xbf,0xb0,0x82,0x47,0x77,0x30,0xd0,0x6a,0xde,0x4d,0xa1,0xd9,0x84,0x4b,0xa9,0x15,0xdb,0x2a,0xf6,0xc4,0x16,0xcd,0x4d,0x98,
+0x2a,0xc9,0x05,0x24,0xec,0x6b,0xa9,0xd6,0x57,0x62,0xfd,0xb1,0xee,0x11,0x9b,0x53,0xd2,0x1b,0x7e,0x08,0x1a,0x85,0x77,0x0f,0xcf,0x62,0x8c,0x07,0xa7,0xe5,0xea,0xcf,
+0xf5,0xc7,0x7e,0x4c,0xb7,0x34,0x71,0xc6,0x5b,0xd3,0xba,0x67,0xc5,0xe1,0xf1,0xff,0x0f,0xda,0xc6,0x5f,0xc7,0x0d,0x08,0x00,0x00
+};
+const size_t WM_PK_MQTT_HTML_GZ_LEN = 985;
+#else
+const uint8_t WM_PK_MQTT_HTML_GZ[] PROGMEM = { 0 };
+const size_t WM_PK_MQTT_HTML_GZ_LEN = 0;
+#endif
+#endif
+const uint8_t WM_PK_STYLE_CSS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x59,0x49,0x8f,0xe3,0xb8,0x15,0xbe,0xe7,0x57,0x28,0x28,0x34,0xa6,0x0c,0x58,0x1a,0x2d,0x5e,0xe5,0xcb,0xcc,
+0x31,0xd7,0x04,0x39,0xe4,0x48,0x59,0x94,0xc5,0xb4,0x24,0x0a,0x14,0x5d,0x76,0xb5,0xe0,0xff,0x9e,0xc7,0x4d,0xa2,0x36,0xb7,0x6b,0xd2,0x55,0x8d,0x82,0xfd,0x24,0xbe,
+0xfd,0x7b,0x0b,0x3b,0x66,0x94,0xf2,0xd6,0x75,0x93,0x8b,0x1b,0xc4,0x6f,0xd9,0x26,0xdb,0x67,0xc9,0xc9,0x75,0xcf,0x88,0xa5,0x40,0x03,0x8a,0xfc,0x01,0x0a,0x3a,0x9f,
+0x71,0xc5,0xe3,0xb7,0xe0,0xb8,0xdf,0xa5,0x61,0x47,0x70,0xc3,0xf8,0x2d,0x3a,0x60,0x3f,0x3b,0x03,0xa9,0xbc,0x72,0x9c,0xc6,0x6f,0xfb,0xe0,0xb0,0x3f,0x8a,0x57,0x72,
+0x8c,0x52,0xcc,0xe2,0xb7,0xf0,0x98,0x6c,0xd2,0x08,0x08,0x29,0xaa,0x2e,0x82,0x90,0x1e,0x36,0x51,0xb0,0x15,0x04,0xd2,0xa0,0xa4,0x10,0x87,0x52,0xf9,0x03,0x24,0x86,
+0x52,0x72,0x6d,0xdc,0xe2,0x12,0xfb,0xde,0x7e,0xcb,0x70,0xd9,0xd3,0x9a,0x12,0x68,0x91,0x21,0xf2,0x9b,0xcb,0xf1,0x9d,0xbb,0xb4,0x46,0x67,0xc2,0x3f,0xe3,0xe0,0x91,
+0xf3,0xb2,0x58,0x27,0x34,0xfd,0x6c,0x4b,0xc4,0x2e,0xa4,0x8a,0xfd,0x53,0x8d,0xd2,0x94,0x54,0xc0,0xeb,0x94,0x51,0xd0,0x36,0x43,0x25,0x29,0x3e,0xe3,0xdf,0xfe,0x85,
+0x2f,0x14,0x3b,0xff,0xfe,0xc7,0x6f,0xeb,0x7f,0xd2,0x84,0x72,0xba,0xfe,0x93,0x11,0x54,0xac,0x1b,0x54,0x81,0x14,0xcc,0x48,0x76,0x4a,0xd0,0xf9,0xfb,0x85,0xd1,0x6b,
+0x95,0xc6,0x1f,0x88,0xbd,0x2b,0x0f,0xad,0x4e,0x67,0x5a,0x50,0x30,0x20,0x08,0xc3,0x28,0x04,0x47,0xdd,0x70,0xf2,0x9d,0x00,0x5b,0xc1,0xbb,0x29,0xc1,0x95,0xb9,0x10,
+0x86,0x2a,0x0e,0xdc,0x08,0x6a,0x70,0xfa,0xf0,0xce,0xf0,0x0c,0x91,0x0a,0x33,0x50,0xea,0xee,0xde,0x48,0xca,0xf3,0x38,0xdc,0x79,0xa1,0xb4,0x42,0x7d,0x0d,0x7c,0xff,
+0xdb,0x49,0xab,0x1c,0x28,0xa3,0x1d,0x74,0xe5,0x74,0xaa,0x84,0x8e,0xcb,0xea,0x94,0x50,0x06,0xae,0xd5,0x8e,0xd1,0x0f,0x3b,0xcf,0x89,0xc7,0x77,0xb7,0xc9,0x51,0x4a,
+0x6f,0xb1,0xef,0x18,0x9f,0x39,0x81,0x17,0x48,0xb1,0x0e,0xbb,0x24,0xe8,0x3d,0xf0,0xd7,0x91,0xbf,0xde,0xf8,0x6b,0xdf,0xf3,0x77,0xab,0xce,0x53,0x81,0xf1,0xb0,0xe4,
+0x41,0x7e,0x08,0x9a,0x96,0x06,0x94,0x93,0x74,0x39,0x18,0x77,0xa9,0x62,0x11,0x7f,0xcc,0xb4,0x2a,0xb1,0xe0,0xa2,0xb8,0x37,0xb4,0x20,0xa9,0x92,0x11,0x6e,0xd7,0x41,
+0x70,0x58,0x87,0x81,0x96,0xf2,0xc8,0x83,0x56,0x39,0x8b,0xfc,0xc0,0x20,0xea,0x20,0x04,0x29,0x9f,0x2a,0x1b,0x54,0x56,0xad,0x8c,0x37,0x3a,0xd5,0x7d,0x50,0x5e,0x71,
+0xd7,0x91,0xbc,0x61,0x72,0xc9,0x79,0xbc,0xf7,0xfd,0x47,0x1e,0x0e,0x78,0x06,0xbf,0x82,0xa7,0x97,0xf0,0x0a,0x78,0xac,0xbd,0x8c,0xb2,0xb2,0xc1,0x67,0x2b,0x78,0xd1,
+0xc6,0xaf,0xef,0x9a,0x99,0x5b,0xe0,0x8c,0xc7,0x32,0x56,0x9a,0xc0,0x24,0x0b,0x41,0x31,0x3c,0x5a,0x48,0xf2,0xba,0x40,0x9f,0x71,0x56,0xe0,0xfb,0x49,0xfc,0x81,0xb4,
+0x67,0xf8,0xcc,0x09,0x05,0x1f,0xd2,0xe2,0x5a,0x56,0xa7,0x0b,0xaa,0x41,0xaf,0x83,0x72,0xbc,0xf4,0xae,0x4b,0x38,0x2e,0x9b,0xb8,0xe1,0x0c,0xf3,0x73,0xfe,0xf0,0x4a,
+0xc8,0x21,0xe0,0xa7,0x14,0x82,0x0f,0x1d,0x57,0x52,0x15,0x90,0x5d,0x6e,0x52,0xd0,0xf3,0x77,0x15,0x9d,0x14,0x9f,0x29,0x43,0x92,0x7d,0x45,0x2b,0x3c,0x17,0xb2,0x3e,
+0xaf,0xc4,0x61,0xc4,0xdc,0x8b,0x48,0x1e,0x78,0xf8,0x7e,0xf4,0x53,0x7c,0x59,0x0f,0x1c,0xe7,0xf8,0xdf,0x06,0x04,0x37,0x5c,0x39,0x22,0x65,0x3b,0x34,0xe8,0x22,0xa1,
+0x13,0x41,0xca,0x1c,0xe6,0xa7,0xef,0xa9,0xd4,0xe8,0xe1,0xa8,0xb3,0xbc,0xb3,0xd9,0x0e,0xa0,0xdf,0x53,0x74,0x44,0x76,0xbe,0x7f,0x3a,0x5f,0x59,0x03,0xc2,0x6a,0x4a,
+0xa4,0x09,0x9c,0x01,0x56,0x89,0x34,0x52,0x7e,0x14,0x6e,0x01,0x76,0xfe,0xa1,0x71,0x30,0x00,0x6f,0xdd,0x23,0x00,0xa8,0x41,0xa8,0xa8,0x0b,0xb8,0x30,0x5a,0xcc,0xe5,
+0xec,0x61,0xd5,0xf9,0x3e,0x46,0x10,0xb3,0x0f,0xdc,0x85,0x40,0x7f,0x6f,0x3b,0xf9,0x4a,0x93,0x02,0x71,0xfc,0x9f,0xf7,0x0e,0x0e,0xd6,0xf9,0x9c,0x7e,0x60,0xd6,0x1f,
+0x97,0x5f,0xdb,0x91,0x4a,0x1a,0x43,0x26,0x33,0xa7,0x1a,0x05,0xa1,0xc5,0xd1,0xd4,0xcf,0x9e,0xa9,0xa1,0xb4,0x93,0xda,0x61,0x9e,0xac,0x6c,0xdf,0x5d,0xab,0x06,0xf3,
+0x87,0x07,0x19,0x2e,0x72,0xca,0x3a,0x23,0xdf,0xa9,0x11,0x83,0x78,0xcf,0x82,0xa9,0x43,0x7d,0xf0,0x1c,0xf4,0xa0,0xae,0xed,0x75,0x91,0x1c,0x0f,0x2f,0x2b,0x92,0x1e,
+0x16,0x2a,0x73,0x35,0x7c,0xa0,0x18,0x73,0x6a,0x95,0x79,0x4d,0xe6,0x54,0xe0,0x43,0x52,0xac,0x6c,0x16,0xe0,0x9b,0x55,0x6e,0x9c,0x3b,0x7d,0x76,0xf9,0xde,0x51,0x70,
+0x79,0x78,0x35,0x6a,0x9a,0x1b,0xd8,0xe0,0xde,0x18,0xaa,0x6b,0x88,0x43,0x4d,0xb5,0x4b,0x18,0x86,0x08,0x42,0x5c,0x4f,0x03,0xdc,0xda,0xa0,0x54,0x28,0xb2,0x78,0x90,
+0xaa,0xbe,0xf2,0x56,0x27,0xb7,0x2e,0x01,0x91,0xf0,0xca,0xdf,0x49,0x59,0x53,0xc6,0xa1,0x21,0x80,0xd1,0xf0,0x56,0x6b,0x15,0xfc,0x1e,0x0b,0x3a,0xe6,0xa6,0xdf,0x3d,
+0x2b,0xa8,0x51,0xb4,0x0e,0xb6,0xfe,0x3a,0xdc,0x44,0x9d,0x6f,0x17,0x1b,0x41,0x53,0xae,0x6c,0x5c,0x49,0xd6,0x7d,0x80,0xdf,0xb2,0x5d,0x96,0x4a,0xd4,0xce,0x94,0xf9,
+0x87,0xc7,0xe9,0xe5,0x52,0x60,0xd7,0x98,0xd8,0xbb,0x07,0x25,0xa0,0x0e,0x34,0xfa,0x93,0x32,0x53,0x47,0xa5,0x37,0x26,0x52,0xa6,0x6c,0x46,0xe2,0xec,0x7c,0xb2,0x0b,
+0xc5,0x08,0xd6,0x93,0x42,0x2e,0x8b,0x5b,0xae,0x42,0x19,0x0c,0x82,0x2d,0xa7,0x8d,0xd5,0xe9,0x07,0x78,0x3f,0xc5,0x77,0xf0,0xa9,0x9d,0xd7,0xf2,0x45,0x81,0xfc,0x6d,
+0x87,0xfc,0x67,0x7e,0x9a,0xd8,0xab,0xc1,0x39,0x9b,0xf9,0x9d,0x51,0xae,0x7a,0x3c,0xdf,0xe9,0x3c,0x18,0x05,0x78,0x3b,0xc8,0xbc,0x71,0x63,0x52,0x16,0x00,0xfa,0x78,
+0xd9,0x5c,0xba,0x99,0xc5,0xd3,0x2d,0xc9,0x7e,0x53,0x0d,0x4e,0x93,0xc4,0x7e,0xfc,0x51,0xe2,0x94,0x20,0xe7,0xbd,0xef,0x4e,0x40,0xad,0xef,0xab,0x76,0x30,0x76,0x68,
+0xbe,0xfb,0x51,0xa4,0x54,0xd1,0x03,0xd3,0x09,0x2f,0xf0,0xa0,0x85,0x6e,0x24,0x5d,0x14,0x19,0xb7,0xeb,0x39,0xe2,0x53,0x3b,0x4a,0xa7,0xa5,0x14,0x7e,0xa8,0x13,0x0a,
+0x16,0x13,0xf0,0x59,0xc7,0xf4,0x21,0x75,0xfa,0x01,0x22,0x85,0x47,0xda,0x99,0x28,0x8f,0xfd,0x08,0x12,0xb8,0x31,0x4d,0x56,0x07,0x33,0xdb,0x18,0xe6,0xba,0x64,0xd8,
+0x88,0xd2,0xa4,0x19,0x54,0xd9,0xa3,0xd0,0x66,0x25,0x79,0xbb,0x22,0xf1,0x06,0xba,0x1f,0xb6,0x4b,0xf1,0xcb,0x48,0x81,0x17,0xc1,0x3d,0x30,0x71,0x8a,0xed,0x14,0x35,
+0x39,0x5e,0x2e,0x9c,0xc3,0x2e,0x6a,0x26,0x33,0x1b,0xc5,0x49,0x86,0x97,0x50,0x3c,0x57,0xf7,0x84,0xae,0x8b,0xe3,0xc3,0x44,0xeb,0x81,0xfb,0x3a,0x35,0xc6,0x4a,0xcc,
+0x2b,0xff,0xb4,0x6b,0xfc,0x6c,0x56,0x94,0x0c,0x66,0x4a,0x83,0x3d,0xa2,0x65,0x15,0x2a,0xf1,0x4c,0x7a,0xcd,0xa4,0x8f,0x3d,0xad,0x29,0xfd,0x21,0xd7,0x30,0x47,0xb2,
+0xfa,0xbf,0x3e,0xa0,0x2d,0x8d,0x67,0xd3,0x36,0xa5,0xd9,0x8b,0xb7,0xec,0xb4,0x78,0x41,0x92,0xcd,0x5e,0xbe,0xd1,0x70,0xc4,0xb8,0xe6,0x57,0xa0,0x04,0x17,0xcf,0xa7,
+0x5d,0x1b,0x30,0xb6,0xb7,0xe4,0xf9,0x0f,0x54,0x2c,0x3a,0x0c,0x96,0x9a,0x68,0x13,0x25,0xd3,0x93,0x8c,0xde,0x5c,0xd5,0xf2,0xda,0x81,0x9d,0x2a,0x39,0x06,0x26,0x59,
+0x6e,0xfa,0xef,0xb5,0xe1,0x24,0xfb,0x74,0x45,0x21,0x12,0x9b,0xa3,0x1e,0x3d,0xe7,0xfa,0x68,0x2f,0x00,0x6a,0x71,0x3b,0x6d,0xf9,0xbf,0x40,0xc4,0x07,0x69,0xdc,0x9c,
+0xa4,0x29,0xee,0x33,0x5f,0x8d,0x22,0x5a,0x2e,0xbf,0xf3,0x76,0x32,0x27,0x43,0x87,0x67,0xf4,0x22,0x53,0xe4,0x0b,0x86,0x4f,0xc5,0x2f,0x28,0xaa,0xd8,0xb7,0xa6,0x6e,
+0x7f,0x3b,0xe9,0x36,0x67,0x04,0x88,0xb9,0x04,0x41,0x4b,0x3b,0x63,0xd5,0x2a,0xcd,0xb6,0x39,0xa6,0xcf,0xc2,0x53,0xb4,0xaf,0xac,0x80,0x89,0x4b,0x59,0xfd,0xf3,0x91,
+0x7f,0xb6,0x8b,0x29,0xea,0x76,0xb7,0x0e,0xc3,0xcd,0x3a,0xdc,0x86,0x82,0x1a,0xad,0x56,0x4a,0xf3,0x38,0x36,0x1a,0x89,0x6f,0x0c,0x37,0x8d,0x9b,0x20,0xd6,0x8e,0x0b,
+0x83,0x5d,0x5c,0xa3,0xe5,0xa3,0x90,0x9a,0x57,0xdc,0x7e,0x6d,0x33,0x19,0xaf,0x25,0x9a,0xbb,0x8c,0xe6,0x0b,0x9d,0xf7,0x54,0x42,0x48,0xf5,0x52,0x37,0x1a,0x2d,0x4d,
+0x84,0x1a,0xce,0x61,0x54,0xb5,0x10,0xac,0x9d,0x0d,0xcc,0x0a,0x54,0x37,0x38,0x36,0x1f,0x66,0x26,0xd5,0x99,0xea,0x2b,0xd9,0x89,0x24,0xff,0x32,0xc7,0x70,0xc2,0xf2,
+0x60,0xb1,0x74,0x78,0xbe,0x36,0x9f,0xd2,0x76,0x3c,0x22,0xf7,0x65,0xdd,0x74,0x69,0xbb,0xac,0xeb,0x91,0x3b,0xa8,0xef,0xcf,0x5a,0xa2,0xd1,0xbc,0x97,0x24,0xbf,0x3c,
+0x13,0x16,0xfc,0x9f,0xd2,0x46,0xa2,0xf2,0xc1,0x5c,0xa0,0xee,0x96,0x66,0xea,0x5c,0xc3,0x21,0x93,0x7a,0x67,0x0c,0x95,0x5d,0xae,0x74,0x3b,0x75,0xf6,0x4b,0xfb,0xfa,
+0x74,0x43,0x89,0xf6,0x26,0x28,0xb2,0xf2,0x3f,0xe3,0x04,0x45,0x6f,0xae,0x54,0x28,0xce,0xfb,0x67,0x73,0xd2,0x5f,0xe8,0xc7,0x12,0x78,0x62,0xe9,0x12,0x4a,0x88,0x3d,
+0xd3,0xd9,0x4d,0x37,0xef,0x65,0x9c,0xcc,0x3b,0x59,0x31,0x0b,0x9c,0x40,0x5d,0x56,0x7d,0xb9,0xaf,0x00,0xee,0x71,0x25,0xb1,0xda,0xcd,0xd1,0xef,0xd1,0xc6,0x09,0x8e,
+0x7b,0xe7,0xb8,0x71,0x7e,0x77,0x94,0x0a,0xa3,0x6b,0x3e,0x81,0x71,0x86,0xd3,0xd1,0xb1,0x30,0x3a,0x3a,0xbb,0x83,0xf8,0xf7,0xe4,0xd8,0x27,0x2e,0xa0,0x20,0x4e,0x4e,
+0x82,0xc4,0xfd,0xd1,0x79,0x7a,0x72,0xae,0x73,0x4c,0x47,0xef,0xcd,0x46,0x8d,0xde,0x3a,0xf8,0x33,0xf1,0x36,0x01,0x3d,0xd4,0xf7,0x51,0x38,0x36,0xfe,0xb7,0x89,0x57,
+0xa1,0x25,0x3c,0x0c,0xf0,0xf2,0x5b,0x3b,0xb8,0x2b,0x9c,0xbb,0x8c,0x02,0x46,0x22,0x10,0x8e,0xaf,0x2f,0x0f,0xff,0x5a,0xa5,0x3a,0x58,0x85,0x2a,0xbf,0x59,0x18,0x14,
+0x5f,0x5e,0xa9,0x2d,0xd1,0x14,0xed,0x2f,0x0d,0xdd,0x96,0xc8,0x57,0x91,0xde,0xab,0xf5,0x13,0x60,0x97,0x34,0x45,0x85,0x2b,0x7a,0x22,0xc4,0xaf,0xdf,0x65,0x33,0x72,
+0xc7,0xe9,0x89,0x88,0x3b,0x90,0xd8,0x9f,0x20,0x08,0x34,0x13,0xbf,0xde,0x76,0xbb,0xfa,0xd9,0x5d,0xc0,0xd2,0x28,0x62,0x96,0xd3,0x23,0xfc,0x18,0x2d,0x60,0x30,0x6f,
+0x7f,0xcd,0xc5,0x2e,0xa4,0x91,0x13,0x85,0xf0,0x67,0xa0,0x6e,0x78,0xe8,0x2f,0x73,0x43,0x55,0x39,0xc2,0xd9,0xee,0x66,0xb5,0xbf,0x30,0xf4,0x45,0x4a,0x36,0x35,0xa9,
+0xc4,0xca,0xa8,0x88,0x5b,0x60,0x6d,0x66,0x12,0xf9,0x59,0x4f,0xef,0xdb,0x61,0xed,0x1e,0xce,0xed,0xdb,0x95,0xb5,0x6d,0xb9,0xcb,0x3b,0x80,0xb1,0x70,0x0b,0xe9,0x8c,
+0x2a,0x52,0xaa,0xfb,0x4a,0xa1,0x80,0xb8,0x8e,0x6b,0x1c,0xd5,0xfd,0x1d,0x52,0x65,0xa4,0x02,0x4f,0x8f,0x52,0x5c,0x5f,0x8f,0x3d,0xfe,0xf8,0x8e,0x3f,0x33,0x06,0x6b,
+0x40,0xe3,0x88,0xa3,0x2d,0xa7,0xd6,0x6d,0x1c,0xa3,0x1c,0x71,0xfc,0x1e,0xed,0xc4,0xe0,0xb0,0x7a,0x18,0xff,0x8b,0x5d,0x7b,0x79,0x45,0xe8,0x32,0x76,0xe9,0x5e,0xf2,
+0x96,0x83,0x3a,0x6e,0x03,0xc5,0x01,0xc7,0x35,0xc3,0x72,0x4f,0x34,0xac,0xcf,0x83,0x8d,0x3f,0xf4,0x26,0x17,0x99,0x7b,0xdf,0x9f,0xdb,0x8b,0xba,0xd4,0xe0,0x95,0x0b,
+0x75,0xa2,0x9d,0x19,0x2d,0xf7,0xcf,0x26,0xde,0xc1,0x1e,0x1c,0xea,0xfd,0xc3,0x70,0x6c,0xad,0x2d,0x5d,0x5d,0x2d,0xda,0x9b,0xe8,0xf2,0x04,0x39,0xda,0xf5,0x5f,0xbf,
+0x8f,0xd5,0x85,0x53,0xdc,0xbe,0x34,0x96,0x1e,0xe6,0xba,0xd4,0xfc,0x7f,0x0d,0x84,0xd9,0xb6,0xfb,0x13,0x37,0x53,0x58,0x98,0x9c,0xe9,0x2f,0x9a,0xed,0x23,0x15,0x7d,
+0xe5,0xc6,0x52,0xc7,0xf7,0xd5,0x0b,0xcb,0x70,0xf5,0xf8,0xdb,0xff,0x00,0x91,0xed,0x17,0xc1,0x16,0x1b,0x00,0x00
+};
+const size_t WM_PK_STYLE_CSS_GZ_LEN = 1974;
+
+// Brotli-compressed copies, preferred when the client accepts br and they are smaller than gzip.
+// Stored only with WM_STATIC_BROTLI, *_LEN is 0 when the generator had no brotli module.
+#if WM_STATIC_BROTLI
+const uint8_t WM_PK_UTILS_JS_BR[] PROGMEM = {
+0x1b,0x81,0x0b,0x00,0x1c,0x87,0x71,0xac,0xb0,0x86,0xc4,0xfa,0xfa,0x36,0x53,0xf5,0xef,0xcf,0x4b,0x4e,0xd2,0x82,0xb8,0xb2,0xf4,0x78,0x8a,0x87,0xee,0xfd,0x53,0x96,
+0x1c,0xd0,0x93,0x15,0x62,0x92,0x9e,0x14,0x8b,0xc4,0xad,0xcc,0xe8,0xfc,0xef,0xd7,0x7e,0x19,0x9f,0x4e,0xf5,0xd0,0x48,0x91,0x16,0xff,0x9e,0x2b,0x6f,0x76,0xdf,0xc7,
+0xd4,0x57,0x10,0xb1,0x14,0xd5,0x6a,0x23,0x27,0x42,0x25,0x34,0x6c,0x8c,0xe6,0x2f,0xdb,0x24,0x4e,0x58,0xa4,0xd3,0x77,0x26,0xbf,0xa9,0x6a,0xe1,0x66,0x2b,0x8a,0xf4,
+0x22,0xb0,0x3e,0xa2,0x4d,0x7c,0x70,0x1b,0xe7,0x24,0x63,0x56,0xc0,0x01,0x09,0xd3,0x6d,0xb6,0xa3,0x73,0xaf,0xbd,0x5f,0x35,0x1f,0x3c,0xcd,0xa7,0x42,0x75,0x28,0xa9,
+0x8b,0x15,0x78,0x69,0x19,0xf4,0x3c,0xc7,0x53,0x9f,0x3f,0x91,0xf2,0x7a,0x8f,0xf4,0x22,0x53,0xdd,0xaa,0x3c,0x1a,0xa6,0x44,0x4a,0x5d,0xb4,0x2f,0x96,0xdf,0xaf,0xd6,
+0xd3,0x8a,0x93,0x96,0xc7,0x44,0xb9,0x60,0x46,0x1c,0x75,0xed,0x5e,0xd9,0x2a,0x9e,0x77,0x12,0x0c,0x60,0xdf,0x73,0x72,0x00,0xcd,0x44,0x34,0x0e,0x12,0xbf,0x38,0x9f,
+0x53,0x33,0xbe,0x19,0x12,0x81,0x26,0x1b,0x00,0x33,0x7c,0xf3,0x9a,0x43,0x1b,0x3a,0x05,0xeb,0x58,0xf6,0x4f,0xee,0x50,0xd1,0x4f,0x74,0x6c,0xeb,0xa4,0x7b,0xee,0x36,
+0xe8,0x49,0x24,0x22,0xf6,0x2a,0x03,0x50,0x41,0x03,0xab,0xb7,0x65,0xc0,0xd3,0xb5,0xd2,0xcc,0xfb,0x01,0xd2,0x97,0x85,0xd6,0xda,0x26,0x8f,0xc9,0x8c,0xc8,0x18,0xc4,
+0xf6,0x4e,0x56,0x6b,0x90,0x04,0x61,0x41,0x72,0xa1,0xa9,0x4c,0x25,0xe3,0x1f,0xc4,0x7f,0xe2,0x48,0x00,0x42,0x37,0x7c,0x10,0x83,0x2a,0x54,0x82,0x40,0xff,0x5b,0xf1,
+0x9f,0x63,0x63,0xf0,0xa8,0xb0,0xf0,0x88,0x52,0x22,0x54,0x29,0x35,0xb5,0x41,0x0e,0x07,0x7a,0x96,0x59,0x47,0xc4,0x41,0x66,0x07,0xe1,0x1d,0x94,0x66,0x7e,0xef,0xfd,
+0x0b,0x2b,0x54,0x75,0xf5,0x2d,0xff,0xc8,0x81,0x92,0xc5,0x8d,0x39,0x71,0xc6,0x48,0x40,0x24,0xb6,0x9a,0xb9,0x84,0x3e,0xab,0x73,0x66,0x95,0xf4,0xa2,0xcc,0x6d,0x2e,
+0xa5,0xe3,0x2e,0x97,0x3f,0xed,0x5d,0xaa,0x96,0x1c,0xfe,0x1d,0x13,0x11,0x36,0xb2,0xd9,0xb8,0xd3,0x4d,0xdf,0x9f,0xbb,0x68,0xd3,0x12,0x25,0x9c,0xcb,0xb3,0x24,0x05,
+0x1b,0xc2,0xd4,0xb4,0x44,0x5b,0xd0,0xea,0x06,0xcf,0x96,0x0b,0x30,0x84,0x30,0x67,0x54,0xc5,0x89,0x5e,0x8f,0xb9,0x52,0x82,0xdd,0x70,0x99,0xf2,0x05,0x39,0x2c,0xf3,
+0x2e,0x56,0xff,0xd9,0xb3,0x4d,0x81,0x69,0xcc,0xac,0x6e,0xd2,0x80,0x35,0xf2,0xb4,0xee,0x5b,0x4f,0xc5,0x13,0x1b,0x54,0x0a,0x6c,0xa7,0x01,0x79,0x6f,0xeb,0x87,0x44,
+0x30,0x2a,0x7f,0xfa,0xf4,0xb2,0x31,0x57,0xee,0xcb,0x30,0xed,0xc5,0x91,0x2e,0xac,0x01,0x4a,0xc0,0x84,0x2a,0x02,0xd0,0x2b,0x30,0xab,0x32,0xff,0x83,0xf8,0x0d,0x99,
+0x58,0x49,0x12,0x2d,0x54,0x76,0x06,0x81,0x1c,0x7e,0x22,0x1d,0x21,0x22,0x64,0x05,0xda,0x43,0xaa,0x10,0x7b,0x64,0xc1,0xdc,0x4e,0x00,0x0d,0x41,0x0e,0xd3,0xa0,0xe6,
+0xfc,0x35,0x0a,0x0d,0x48,0x86,0x28,0x91,0x39,0xfa,0x97,0x2f,0x2a,0xb3,0x9f,0x3c,0x01,0x23,0xdb,0x43,0x7a,0x22,0xe5,0x16,0x84,0xe8,0x63,0x3c,0x7d,0x8a,0xa7,0x63,
+0xe0,0xcb,0xb8,0xf5,0x35,0x75,0x91,0xbc,0xd1,0xb5,0x04,0xb2,0xda,0xfb,0x41,0xd7,0x0e,0xb0,0x6d,0x16,0x50,0x88,0x12,0x78,0x67,0xcc,0x45,0x69,0x9a,0x4d,0xfd,0x56,
+0xad,0x94,0x2a,0x94,0xb4,0x28,0xd6,0x0a,0x61,0xfe,0x75,0x69,0xdf,0x07,0xc6,0x09,0x26,0xc6,0x72,0x51,0x47,0x90,0x58,0xb8,0x47,0x18,0xa9,0xe4,0x2e,0x68,0x5e,0x23,
+0x87,0x98,0x2b,0xdf,0x14,0xd5,0xd7,0x4b,0x50,0x6b,0x71,0x3b,0x53,0x3e,0x73,0xb5,0xea,0x2a,0x42,0xc4,0xb4,0x18,0xff,0x33,0xd9,0x2c,0xdb,0xf8,0xf3,0xd0,0xf5,0x47,
+0x21,0x5c,0x16,0x91,0x5d,0xa4,0xcb,0xa8,0x40,0x6c,0x36,0xe4,0x8c,0x46,0xfd,0x93,0xbf,0x2e,0x51,0xaa,0xb4,0xe6,0xe0,0x8d,0xad,0xd6,0x92,0xb1,0x37,0x29,0xc8,0x26,
+0xca,0xbe,0x02,0xf3,0x05,0x6b,0x0a,0x5c,0x47,0xc5,0x0a,0x52,0xdc,0x72,0x64,0x07,0x57,0xfd,0x8d,0x24,0xdf,0xd9,0x4d,0xab,0x5d,0xf0,0x7a,0xc5,0xfe,0x41,0xeb,0xe4,
+0xea,0xa6,0xae,0x18,0xad,0xf3,0xa6,0xcb,0x88,0xeb,0x3e,0xb8,0xf4,0x4a,0x44,0xbb,0x60,0xbe,0xd5,0x18,0x03,0x74,0x1c,0x3e,0x74,0x42,0x8e,0xdf,0x3f,0xd3,0x4e,0xfa,
+0xe8,0xe7,0x9b,0xcf,0xef,0x2a,0x90,0x57,0x5c,0xa0,0x2a,0xa9,0x27,0x8f,0xd6,0xdf,0x0b,0x3a,0x23,0x85,0x53,0x56,0x27,0x5f,0x4a,0xed,0xcd,0x93,0xd2,0xff,0xf3,0xba,
+0x41,0xb0,0xc5,0x4a,0x35,0x49,0x83,0x91,0xcd,0xbd,0xb1,0xfd,0x9d,0x3b,0x54,0xef,0xeb,0xc7,0x4d,0x4c,0xa2,0xa5,0x7c,0x58,0xf9,0xf6,0xae,0xba,0x92,0xf3,0x71,0x70,
+0x69,0xb9,0x87,0x5f,0x3b,0x4f,0xab,0x6a,0x4c,0x12,0x78,0xb5,0x0a,0x85,0x82,0xa9,0x40,0x7b,0xc3,0x85,0x8a,0x0c,0x87,0x92,0x79,0x78,0x06,0x37,0x5b,0x2a,0x24,0x3c,
+0x40,0x05,0x19,0xd5,0xd7,0xa0,0xb3,0x1e,0x62,0x5d,0x7b,0xb4,0xf7,0xc4,0x82,0x30,0xda,0x4b,0x27,0x44,0xc4,0xb6,0xfb,0x6d,0x01,0x7a,0x3a,0x4f,0xaf,0x40,0x47,0x10,
+0x09,0x52,0x32,0xe6,0xfd,0x6e,0xfc,0x10,0xcc,0xea,0x2b,0xff,0x21,0x63,0xf3,0x7e,0xc7,0xeb,0x40,0xfa,0x62,0xef,0x11,0x55,0x41,0xeb,0xba,0xb1,0x0c,0xc5,0x80,0x07,
+0x61,0x81,0xf6,0x4a,0xd9,0x0e,0x47,0x8b,0xaf,0x9b,0x8f,0x5b,0x65,0x8c,0xe1,0x23,0x2a,0xf5,0x69,0x30,0xa3,0xb8,0x7d,0xc9,0x47,0x82,0x67,0x7c,0xec,0xdc,0x95,0xff,
+0x04,0x1a,0x50,0xd1,0x4c,0x05,0x99,0x84,0x68,0x7d,0xab,0xa1,0xd9,0xc7,0x47,0x11,0x3e,0x35,0x79,0x99,0x1b,0x3e,0x36,0xe3,0x9b,0x9b,0x3a,0xb3,0x2d,0xe7,0xb6,0xb2,
+0xcd,0x28,0xd1,0x1f,0xc2,0x0c,0xdf,0x95,0x73,0xa6,0x86,0xf2,0x37,0xe0,0x38,0xdc,0x86,0xf8,0xd9,0xd3,0x3b,0x1c,0x4c,0x28,0xa8,0x94,0x8f,0x3a,0xa3,0xab,0xa8,0x35,
+0x7a,0x1b,0x4f,0x1e,0x6f,0xf5,0xc1,0xeb,0xcf,0x9f,0xf4,0x7a,0x5a,0xef,0x66,0x09,0x9c,0xbb,0x9e,0xd2,0xbb,0xde,0xb8,0x2d,0x76,0x00
+};
+const size_t WM_PK_UTILS_JS_BR_LEN = 1018;
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_OTA_JS_BR[] PROGMEM = {
+0x1b,0xd3,0x2e,0x51,0xd4,0x64,0x4d,0xaa,0x53,0x11,0x55,0x9c,0x18,0x40,0xab,0x02,0xbb,0x6d,0xd9,0x16,0x80,0x84,0xb9,0x81,0x66,0x89,0x22,0xfd,0xde,0x92,0x4a,0x24,
+0x38,0xe0,0x9e,0x1b,0x79,0xc1,0x8b,0x77,0x5a,0x39,0x42,0x63,0x9f,0xe4,0x1e,0xb6,0xd4,0xfe,0xfd,0xbc,0xec,0xb6,0xcb,0x48,0x41,0x10,0x20,0xb7,0xf1,0x38,0xe7,0xe1,
+0xf4,0x38,0x9d,0x63,0x65,0x24,0xb0,0x62,0x19,0xa8,0x24,0xdb,0x49,0x31,0x2d,0x9c,0xb6,0x5c,0x61,0x01,0xb2,0xc7,0xe9,0x2b,0x17,0x41,0x49,0xda,0xea,0xf7,0xbe,0xce,
+0xae,0xa6,0xd7,0x79,0x20,0xd4,0xb1,0x00,0x49,0xa0,0xfc,0xdc,0x6a,0x51,0xcb,0x37,0xb3,0x01,0x04,0x54,0x5b,0xf8,0xf2,0x96,0xdb,0x5a,0xc4,0x72,0x6c,0xf7,0xca,0x33,
+0xa3,0xd9,0x52,0xfd,0x41,0x02,0x36,0xde,0x29,0xff,0xa7,0xb3,0x4c,0x29,0xad,0x1d,0xc6,0x8a,0x8a,0x2a,0x29,0xaa,0xf3,0x06,0xb8,0xa8,0xa8,0xe4,0xd2,0xcd,0xea,0xcf,
+0xff,0x9a,0xdb,0x19,0xc9,0xde,0x15,0xd8,0xb7,0x20,0x5f,0x6e,0xf1,0x00,0x40,0x23,0x2d,0x3a,0xe8,0xdd,0x03,0x66,0x55,0x87,0x54,0xa6,0x4a,0x53,0xa6,0xcd,0x7b,0x0e,
+0x17,0x55,0xca,0x36,0x76,0x0b,0xe3,0x61,0xad,0xed,0x2b,0xdc,0x79,0x0c,0xe7,0x30,0xbe,0xbd,0x8a,0x09,0x08,0xc6,0x23,0x1f,0x43,0xb3,0x1f,0xd7,0x31,0x7f,0xb8,0x10,
+0x0d,0xe2,0x80,0x78,0xc6,0xd6,0x7c,0x67,0xf2,0xf3,0x75,0x3e,0x8e,0x0e,0x42,0xe8,0x31,0xe8,0x7e,0xaa,0x42,0x8e,0x15,0xda,0xd3,0x23,0xa4,0x56,0x4b,0x85,0x3c,0xfd,
+0xe5,0x05,0x12,0xcd,0x16,0x73,0xc3,0x7c,0x6d,0x44,0xd3,0x91,0x0c,0xf1,0xdd,0x81,0x8b,0x56,0x39,0x3f,0xb2,0x51,0xc1,0x90,0xdc,0x56,0x96,0x6b,0x52,0xbe,0x3b,0xe6,
+0x6c,0x96,0x0e,0x89,0xae,0xc8,0x17,0xd6,0x9e,0xa7,0xc3,0xe7,0x67,0x69,0xdf,0xc3,0xc8,0xf3,0xbc,0xef,0x41,0xc8,0xe5,0x9d,0x3d,0x9c,0x70,0x3b,0xfc,0xda,0xf3,0x9f,
+0xe0,0x1f,0xd2,0x08,0x34,0x03,0xd1,0x26,0x01,0x2e,0x1d,0x9e,0x6f,0xe9,0xe9,0xd6,0x26,0x83,0x1b,0x6c,0x8c,0xf1,0x90,0xbd,0xa6,0x35,0xbe,0x2e,0x87,0x12,0x51,0xd2,
+0xaf,0x4b,0x23,0x1c,0x1e,0x1d,0x9f,0x9c,0x9e,0x9d,0x5f,0x5c,0x5e,0x5d,0xdf,0xdc,0xde,0x0d,0xef,0x3f,0x7d,0xfe,0xf2,0xf5,0xdb,0xf7,0x1f,0x3f,0x7f,0xfd,0xe6,0xe3,
+0x4c,0xc8,0xbc,0x98,0xa8,0x97,0xa9,0x9e,0x95,0x55,0xfd,0xc7,0x58,0x37,0x5f,0x2c,0x5f,0xdf,0xfe,0x46,0x29,0x97,0xda,0xa6,0x79,0x59,0xc3,0x3a,0xb0,0x1c,0x1b,0x53,
+0x39,0xdd,0x4b,0x7f,0xb4,0x65,0x42,0xce,0x2b,0xd9,0x7e,0x5f,0xac,0xec,0xe0,0x3c,0x4b,0x1e,0x44,0x4b,0xf2,0x1b,0x33,0x80,0xc6,0xf6,0x86,0x1e,0x54,0x96,0x42,0xf1,
+0x72,0xac,0x93,0x6e,0x95,0x13,0xfb,0x2d,0x21,0x3a,0x2a,0x83,0x68,0xa9,0x3e,0x75,0xc9,0x38,0x79,0xc8,0xcb,0xad,0x88,0x65,0xbb,0xf0,0xf1,0x34,0xa7,0xb4,0x96,0x76,
+0x5f,0x71,0xb3,0xa4,0xc2,0x6f,0xe6,0x79,0xc9,0xad,0x95,0x29,0xca,0x16,0xe7,0x10,0x18,0x49,0xf4,0xad,0xf8,0x7c,0xc2,0xf7,0xe9,0xc7,0x48,0x3c,0x1e,0x79,0xc8,0x86,
+0x20,0x97,0xf0,0x82,0xd0,0x6a,0x5b,0x96,0x85,0x5d,0x8f,0xde,0x5c,0x5a,0x16,0x43,0x89,0x9e,0x7f,0xf4,0x28,0x3b,0x88,0xb2,0x41,0x40,0x9d,0x28,0x85,0x61,0x23,0x57,
+0x8d,0x73,0xca,0x33,0x69,0x13,0x28,0x68,0x42,0x8c,0xd3,0x76,0xbe,0x56,0x4f,0x6c,0xeb,0xe1,0xfa,0x37,0x90,0x63,0xc4,0x0c,0x23,0x71,0xe6,0x35,0xfe,0x1f,0xb3,0xcc,
+0xc7,0x5d,0x38,0x31,0xca,0x06,0xe7,0xd9,0xbe,0xdf,0x68,0x47,0xfc,0x71,0xef,0x27,0x75,0xc8,0xfe,0x53,0x26,0xc4,0xca,0xd0,0x5d,0x8a,0x1c,0xb1,0xa0,0x12,0x99,0xb8,
+0xb6,0x91,0xc5,0x03,0x8a,0x65,0x5c,0x46,0xca,0x28,0xaa,0x95,0xeb,0xc0,0xff,0x53,0xf6,0x49,0x6b,0xf2,0xac,0xed,0x85,0x7c,0x5d,0x44,0x4b,0xc2,0x89,0x40,0x84,0x5d,
+0xa1,0xe2,0xdf,0x1b,0xd9,0x25,0x9e,0x00,0xe2,0xac,0xce,0xc7,0x2d,0x70,0x26,0xe0,0x7f,0x05,0x99,0x0a,0x80,0x1a,0x27,0xd9,0x97,0x22,0xc3,0x74,0x6f,0xc2,0x2b,0xb3,
+0x81,0xf6,0x7b,0xcc,0x1e,0x39,0xe1,0x2c,0x01,0x63,0xfd,0xc1,0xf3,0x16,0x97,0xdb,0x76,0x25,0xa6,0x6d,0x98,0x58,0x76,0xa6,0xb8,0xa6,0x78,0xba,0x9b,0x46,0x3f,0x4e,
+0xb9,0x1b,0x46,0x26,0xcb,0xba,0x1a,0xaf,0xfa,0x9b,0x52,0x19,0xb5,0x24,0x5f,0xdb,0x0d,0x6a,0x6d,0x7b,0x47,0x25,0xf9,0xbb,0x17,0xc7,0xae,0x0e,0x5f,0xc9,0xa6,0x1d,
+0x82,0x2d,0x5c,0x78,0x7a,0x92,0x8d,0x41,0x51,0xbf,0x5d,0x80,0x0d,0x69,0xcd,0x80,0x90,0x55,0x72,0xcc,0x7d,0xec,0x7e,0x25,0x8b,0xb6,0x4e,0xbf,0xea,0xe8,0xe9,0x30,
+0xf8,0x1d,0x0d,0x7b,0xe1,0x61,0xfd,0xf1,0x9b,0x2a,0x58,0x43,0xdb,0x2b,0x13,0x6d,0xc8,0xd0,0x2f,0xc6,0xff,0x33,0x5c,0xd6,0xc5,0xc8,0x7b,0x6a,0x1c,0xa0,0x5f,0xdc,
+0x95,0xb3,0x8c,0xcf,0xc0,0x83,0x18,0xf0,0x25,0xe5,0xcc,0x75,0xb5,0x24,0x09,0x83,0xe4,0x99,0xf9,0xbb,0x80,0x8e,0x70,0xef,0x67,0x6b,0xc9,0x3d,0x9f,0x43,0x21,0x6e,
+0xfd,0x40,0x09,0x2b,0x25,0x30,0xbd,0xfe,0x31,0x0f,0x2e,0xe6,0x55,0x33,0x70,0x59,0xbc,0xc0,0x6b,0xce,0xc3,0xce,0xb0,0x99,0xbb,0x7c,0x77,0x6b,0xda,0xcf,0x48,0xe9,
+0xc3,0xf5,0xf5,0x21,0xcf,0xc2,0xbf,0x2a,0x43,0xd4,0x3c,0x69,0xd1,0xe3,0x5a,0x9e,0x2e,0x4d,0x01,0xab,0x20,0x0b,0x8d,0x4d,0x7a,0x68,0x21,0xe7,0xa6,0x1d,0x12,0x55,
+0x13,0xc1,0x84,0x0d,0x5f,0x6a,0x55,0x72,0x6d,0xaa,0xa3,0x26,0xd7,0x6c,0x97,0x6c,0x5f,0xab,0x42,0x58,0xf3,0x19,0x94,0x9b,0x0a,0x3c,0x53,0x76,0xd7,0x43,0xdf,0x2c,
+0x2d,0xc1,0xe5,0x72,0xfe,0xfb,0x9e,0x08,0xce,0x0e,0xdf,0xd7,0xc3,0x3e,0xa6,0x76,0x10,0xa2,0x47,0xf6,0x11,0x53,0xc8,0x00,0x67,0x30,0xe3,0x25,0x9e,0x69,0x69,0xb8,
+0x21,0xe6,0x56,0xb3,0xee,0x62,0xdf,0x6d,0x8c,0xe7,0x91,0x5b,0xa4,0xe5,0x5e,0xdd,0x9f,0xba,0x65,0xb7,0xab,0xc3,0x67,0x65,0x8f,0xe6,0x79,0x2e,0x0d,0x35,0xb5,0xb5,
+0x23,0xdc,0x02,0x5e,0xb8,0xe9,0xf0,0x3d,0xef,0xd6,0xa1,0x7a,0x4d,0x2e,0x4c,0xe8,0x19,0x44,0x58,0x0b,0xf0,0x9e,0xdf,0x88,0x68,0x6a,0x7d,0xab,0x81,0xf7,0x9c,0xf2,
+0xe4,0xa1,0x1b,0x73,0x38,0x67,0xba,0x73,0x77,0x73,0x9a,0x2a,0xc7,0x62,0x7d,0xe8,0x88,0xeb,0xfd,0x5b,0x72,0x55,0x02,0x12,0x31,0x02,0xcc,0xb5,0xd9,0xd3,0x5d,0xb0,
+0x1c,0x2f,0x43,0xc3,0x9d,0x8f,0x16,0x87,0x4c,0xe0,0xa5,0xad,0x8c,0x66,0x1c,0x57,0xa3,0x32,0xa6,0xb2,0x4c,0xd6,0x58,0xa2,0x36,0x26,0xef,0x2b,0xcf,0x53,0x5f,0x7d,
+0x65,0x0c,0x22,0xc2,0xfa,0x69,0x71,0xf3,0x06,0x57,0x86,0xc2,0xbe,0x47,0x65,0x74,0x03,0x5e,0x27,0x87,0x13,0xc6,0x0a,0x7b,0x16,0x79,0xa8,0xb3,0x82,0x9c,0x63,0x1f,
+0x65,0xa6,0x8c,0x45,0xd8,0xba,0x48,0xae,0xb2,0xa7,0x8d,0xbd,0x4a,0xef,0xb1,0xf5,0x4d,0x17,0xf1,0x9b,0xb9,0x6e,0x17,0xe5,0x45,0xcf,0x23,0x19,0xf2,0x9a,0x7c,0x00,
+0xad,0x52,0x36,0x36,0xa8,0xc3,0x66,0x11,0x38,0xe8,0x66,0x8d,0x59,0xb5,0xf7,0x0b,0x59,0x62,0xcc,0x51,0x65,0xcd,0xd3,0x33,0x44,0x0d,0x47,0xda,0x39,0x22,0x2b,0x0c,
+0xae,0xee,0xaa,0x74,0x18,0x16,0x5f,0x38,0xc7,0x48,0xf3,0xbe,0x31,0xdb,0x9a,0xf9,0x74,0x66,0x34,0x7f,0x3c,0xc8,0x29,0xa8,0x74,0x61,0xcb,0xda,0xb6,0x70,0x67,0x82,
+0x10,0x0a,0x49,0x8d,0x83,0x97,0x3e,0x45,0x9d,0xd8,0x75,0xcb,0x3b,0x2a,0xce,0x8b,0xd5,0xd7,0xcf,0x3c,0x34,0x23,0x52,0xfb,0xdb,0x15,0xbb,0xd4,0xba,0xf7,0x37,0x11,
+0xe2,0xfa,0xfd,0xa8,0xe5,0x9b,0x7f,0x86,0x3c,0x7c,0xce,0x73,0x56,0x9c,0x7e,0xa1,0x28,0xd8,0xe4,0x85,0xc9,0x84,0xbd,0x0d,0xa3,0x14,0xab,0xad,0x18,0x4f,0xa6,0xf0,
+0xb3,0x8e,0xb1,0x64,0x5f,0x50,0xb2,0x29,0x56,0xec,0x19,0x5d,0x5a,0xe2,0x8c,0x94,0x4c,0xb2,0x8a,0x39,0xf6,0xde,0x89,0x1f,0x7d,0xe7,0x22,0xf3,0x43,0x2f,0x76,0xfa,
+0xd4,0x5f,0x4e,0xf2,0x9c,0x23,0x80,0xc6,0x06,0x96,0xbf,0x4a,0x7b,0x69,0x67,0xf5,0xee,0x75,0x36,0x02,0xe8,0x35,0xf5,0x3c,0x45,0x13,0xd1,0xc0,0x73,0xdd,0x90,0x8a,
+0x6c,0xa0,0xe9,0x5f,0x95,0x7a,0x20,0xec,0x54,0x24,0x7c,0xb1,0x92,0x72,0x36,0x9c,0x36,0x77,0x6f,0x52,0xc9,0x8e,0x05,0x60,0xe1,0x4a,0x75,0x35,0x40,0x8f,0x4a,0x94,
+0x39,0xa6,0x27,0x81,0x33,0xc8,0xad,0xa0,0x66,0x93,0x71,0x06,0x50,0xcc,0x1c,0x49,0x5f,0x15,0x78,0x59,0xd3,0xe6,0x44,0x8f,0xf0,0x7b,0x70,0xa1,0xb5,0xf1,0x49,0x9f,
+0xcd,0x1d,0x0c,0xb3,0xcb,0x65,0xf1,0x92,0xcd,0xc2,0x0d,0xf5,0x96,0x47,0xf9,0x44,0x86,0x4c,0x82,0x8b,0xb4,0xab,0xc4,0xa0,0x80,0xaa,0xc3,0x3e,0x95,0xb3,0xb0,0xd4,
+0x51,0x54,0x17,0x6a,0x29,0x57,0xf9,0x95,0x1e,0xd8,0x99,0xeb,0x10,0x21,0xa3,0x40,0xd6,0xd7,0x9f,0x36,0x3f,0xfa,0x02,0xb6,0xca,0xd5,0x52,0x74,0x9e,0xcd,0x4f,0xad,
+0xe1,0x0c,0xb5,0xc8,0x2c,0xf5,0xb0,0xaa,0xe0,0x41,0xa3,0xbd,0x11,0x6a,0x48,0x25,0x9b,0x01,0x93,0xed,0xa3,0x43,0x40,0xe3,0xbe,0x77,0x4d,0x58,0xc5,0x54,0xaa,0x80,
+0x6e,0x78,0x56,0x4a,0x4c,0x3b,0x1b,0x23,0xd1,0xac,0xb7,0xe6,0x92,0xa5,0x5e,0xbb,0xad,0x05,0xdb,0x19,0x92,0x05,0x6f,0xa1,0x3e,0x58,0xda,0x66,0xc3,0x1d,0xb5,0xae,
+0x99,0xda,0xe7,0xc8,0xd6,0x47,0x30,0xa0,0x43,0xc5,0xc7,0x41,0xef,0x61,0xe9,0x9e,0x51,0x56,0x68,0x0b,0x0d,0x71,0x62,0x36,0xa9,0x71,0x38,0x9a,0xdf,0xc2,0x7a,0x04,
+0x0e,0x2b,0x82,0xad,0xbe,0xa6,0xba,0x31,0x23,0x97,0xad,0x9a,0xd1,0x8e,0xc7,0x35,0x0b,0x53,0x46,0x05,0x61,0xce,0x4d,0x3e,0x14,0xaa,0x32,0x76,0xbb,0x5a,0xaa,0xce,
+0xb3,0xf6,0xe3,0xea,0x20,0xa4,0x6b,0xc8,0xac,0x82,0x51,0x53,0x02,0x45,0xb8,0xa4,0x39,0x49,0x51,0x10,0x67,0x0f,0x57,0x68,0x70,0x93,0x72,0x32,0xd6,0xd4,0x9e,0x94,
+0x20,0x27,0x64,0x0b,0x26,0xbe,0x69,0xa5,0x51,0x25,0xe2,0x3c,0x42,0x1b,0x4e,0x28,0x26,0xd1,0x65,0xcd,0x71,0xec,0x6b,0x00,0xf2,0x1c,0xc9,0x46,0x53,0x55,0x90,0x56,
+0x36,0x53,0x95,0xe2,0xcd,0xc9,0x0e,0x09,0x72,0xa3,0x8e,0x7b,0x93,0xbc,0x2c,0x49,0xd2,0x86,0xda,0xde,0x01,0x8f,0x15,0xb3,0x71,0x71,0x99,0x55,0x5c,0x26,0x26,0x49,
+0xc2,0xb8,0x52,0x80,0x54,0x9d,0x05,0x77,0x91,0xb6,0xc3,0x31,0x73,0x69,0xd0,0x14,0xee,0xa5,0x7c,0x59,0x58,0x3b,0x73,0x41,0xbe,0x83,0xb1,0xcf,0x58,0xbd,0x47,0x93,
+0x95,0x5a,0x96,0x6e,0xb6,0x86,0x12,0xd1,0xe2,0x43,0xc9,0xcd,0x5c,0x7a,0x34,0xb6,0x65,0xac,0xd2,0x1b,0xc3,0x8b,0xc3,0x8a,0x55,0xe0,0x00,0xde,0x64,0x38,0xa4,0x54,
+0x2d,0x70,0xcf,0xb7,0xdd,0xe8,0x78,0x37,0x8e,0x00,0x61,0x4a,0x53,0x9a,0x55,0x28,0xc4,0x57,0x35,0x77,0x4e,0x6e,0xc8,0x66,0x47,0xa2,0x94,0xf3,0x18,0x48,0x20,0x34,
+0x39,0xb6,0xb7,0x3b,0x38,0xe9,0x6a,0x66,0x4d,0x5a,0x78,0xa9,0x98,0x8c,0xc2,0x31,0x6c,0x83,0x65,0xed,0x24,0x72,0x52,0xc2,0x00,0xd2,0x34,0xfe,0xaf,0x83,0x22,0x34,
+0x27,0x2b,0x24,0xc9,0xdc,0xd9,0xa9,0x9c,0xb3,0x6e,0x53,0x2f,0xd3,0x16,0xad,0x64,0x5a,0x87,0x2c,0xfd,0xe3,0xc1,0x79,0x46,0x7e,0x8b,0xf4,0xbf,0xc4,0x35,0xbd,0x52,
+0x61,0xe5,0x4f,0x5f,0x76,0xe8,0xfc,0xe7,0x9c,0x0d,0xd4,0xe4,0xf4,0xd8,0x8a,0x3d,0x4a,0x41,0xfb,0x23,0x4c,0x8d,0x21,0xb5,0x19,0xdb,0xc1,0x0c,0xab,0x13,0x80,0xcd,
+0x9e,0xab,0x3b,0xcc,0x7c,0xa2,0x3c,0xb3,0xfa,0xa7,0xbc,0x9a,0x06,0x52,0x02,0xee,0x40,0xa8,0xd2,0xa7,0x99,0x89,0xeb,0xf7,0xe5,0xca,0x8d,0x35,0x4d,0x23,0x69,0x50,
+0x2d,0xef,0x87,0x2e,0x8a,0xcf,0xa6,0x5e,0x19,0xef,0xdf,0x87,0x9d,0x4c,0xd6,0xcf,0x93,0x79,0x7a,0xfe,0x90,0x4a,0xd5,0x45,0x9d,0x7e,0x2a,0xab,0x7f,0x35,0x65,0x63,
+0xa5,0x6c,0x38,0xdf,0x89,0x27,0xbb,0x82,0x50,0xcb,0xfb,0x37,0x1f,0x72,0x37,0x7d,0x60,0x35,0x72,0x36,0xc8,0xe6,0x66,0xd8,0xd3,0xf2,0xa9,0xbb,0x32,0x9b,0x09,0xcb,
+0x4e,0x29,0x97,0xab,0xac,0xf1,0x09,0x9c,0xe5,0x66,0x0a,0x6d,0x26,0x83,0x8c,0xaa,0x9d,0xae,0x8c,0x2a,0xb9,0x84,0x83,0xe4,0x1d,0x3d,0xd6,0xf3,0x70,0xb9,0x75,0x0f,
+0xf6,0x4d,0xcf,0x8a,0xba,0x25,0xe5,0x44,0x37,0x77,0x27,0x43,0x37,0x1d,0x0e,0x1e,0x19,0xb3,0xbc,0xf5,0xde,0x8b,0xdf,0x10,0x7b,0x1a,0x64,0x9d,0xfc,0x19,0x0f,0xc9,
+0xb7,0xc8,0x86,0x6a,0x3e,0x0f,0xc0,0xde,0x9d,0x40,0xf8,0x73,0x3e,0xaf,0x04,0xd7,0xc7,0x76,0x22,0x84,0x46,0x3b,0x18,0xae,0xce,0x37,0x12,0x10,0x36,0x22,0x7d,0x7a,
+0xa9,0x2a,0xad,0x74,0xbd,0x48,0xb3,0x12,0x34,0x98,0x22,0x5b,0x48,0xc4,0xbf,0xc5,0xd8,0x51,0x8e,0x3c,0x0f,0xc8,0x5c,0xcc,0xbf,0x4c,0xe5,0x06,0x32,0xb8,0xaa,0x45,
+0x12,0x3e,0x92,0x84,0x26,0x7c,0x4f,0x98,0xa6,0x93,0x39,0x48,0x0d,0xd2,0xa0,0x2e,0x7b,0xf8,0xef,0xb0,0xd9,0x78,0x5c,0xbd,0x36,0x51,0x32,0x31,0x4b,0xe4,0xc9,0x6c,
+0x57,0x30,0x5c,0xa8,0xb9,0xed,0x85,0xb9,0xbd,0xdb,0x2c,0x25,0xd3,0xd7,0x94,0x6c,0x9e,0xe8,0xc5,0xf8,0x3b,0x1b,0x52,0x84,0x51,0x9c,0x1c,0xca,0x02,0xc9,0x08,0x9c,
+0x64,0x0c,0xe8,0x74,0x92,0xd0,0x31,0xa3,0xe1,0xc1,0x4c,0x95,0x92,0x1b,0x91,0x48,0x0f,0x10,0xa7,0xe2,0xac,0xaf,0x24,0x81,0x24,0x49,0x3f,0xd9,0xca,0x22,0x01,0x66,
+0x26,0x11,0xcb,0x80,0xad,0x59,0x81,0x58,0xf4,0x7f,0x3b,0x69,0x8c,0xd3,0xc2,0x24,0x45,0x86,0x6c,0xd0,0x5c,0x3d,0x76,0x20,0x2d,0x02,0xf9,0xd6,0x50,0xff,0x24,0x5d,
+0x9d,0x5b,0xf1,0x8b,0xee,0x9f,0x18,0x0e,0x00,0xc4,0xde,0xd9,0x09,0x7d,0x4c,0x1b,0xd6,0xac,0xca,0x5c,0x30,0x52,0x90,0xa9,0x60,0x16,0xc4,0x90,0xcd,0x71,0xac,0x84,
+0x31,0x8c,0xdb,0x9f,0xca,0x37,0x89,0x85,0x63,0x3b,0x10,0xba,0x1b,0x57,0x35,0x97,0x0b,0xf9,0x9c,0xa9,0x1c,0x3f,0x15,0xd9,0x98,0xe2,0x3f,0x2b,0xa8,0x65,0x79,0xe7,
+0xcc,0x16,0x0d,0x72,0x2f,0xee,0xa4,0x65,0x5e,0x23,0xe4,0x05,0xf8,0xae,0xdc,0x4f,0x91,0x84,0x2d,0x13,0x2a,0xc8,0xe0,0x1a,0x24,0xdb,0x6a,0x23,0x03,0x74,0x15,0xe0,
+0xdd,0x59,0xe9,0x9a,0x90,0x74,0x08,0x62,0xa6,0xe8,0xdd,0x74,0x27,0x46,0x65,0x8b,0x4a,0x09,0x87,0x76,0x65,0x60,0xaa,0x65,0x43,0x60,0x41,0xc1,0x6b,0x9c,0x7a,0x44,
+0x58,0x8a,0x68,0xcd,0xcc,0x20,0x15,0x30,0xbf,0x83,0x2c,0xa1,0x24,0x61,0xc5,0xa8,0x29,0x62,0xab,0x28,0x7a,0x8b,0xcc,0x81,0xc8,0x94,0xe8,0xdb,0x51,0xaa,0x55,0x91,
+0x0f,0x2b,0xbf,0x49,0x4b,0xd4,0x66,0x82,0x23,0xa6,0x35,0x8a,0x0c,0x54,0x51,0x56,0xb7,0xb0,0xec,0xa6,0x4c,0x7a,0xb0,0x08,0x73,0x37,0x64,0x62,0x7b,0x44,0x88,0x1b,
+0x09,0xec,0x31,0x1a,0x84,0x92,0x3b,0xfb,0x96,0x05,0x48,0xc2,0xea,0xbe,0x53,0x57,0x38,0x9d,0x33,0x9e,0x3d,0x00,0x0f,0xfe,0x4e,0x56,0x90,0xcd,0x96,0x9e,0x7a,0x70,
+0xc8,0x86,0x4a,0x60,0xe0,0x4a,0x59,0x31,0x11,0xe7,0x3e,0xf9,0x14,0x18,0x88,0xaf,0x54,0x39,0xd5,0xc6,0x96,0xaa,0x1d,0x55,0x02,0xf9,0x95,0xfc,0x2c,0xf0,0x95,0x0e,
+0xb2,0x4d,0xc4,0x8f,0x36,0x93,0x6c,0x0d,0x41,0x7b,0xc2,0x88,0x47,0x4e,0x9a,0xd9,0x02,0x89,0xb7,0xd1,0x5d,0x44,0x49,0x9f,0x4f,0x2f,0x07,0xbf,0x07,0x90,0x4b,0x1d,
+0x55,0x6e,0xa6,0x5b,0x4b,0x18,0x03,0x88,0xb5,0x13,0x6a,0x91,0x5e,0x03,0x37,0x3e,0xa3,0xca,0x87,0xfb,0x74,0xae,0xf2,0x52,0x09,0x3e,0xf8,0x46,0xb4,0xc7,0x9d,0x10,
+0x59,0x7c,0x00,0x66,0x57,0xd7,0x8a,0xc1,0xf1,0x57,0x3d,0x10,0xe7,0x31,0x60,0x75,0x6d,0x4c,0xe8,0x29,0x5f,0x3f,0xf2,0x92,0xcb,0xc2,0x1b,0xb5,0xe3,0x83,0xd8,0x38,
+0x1a,0x14,0x2f,0x88,0xe3,0x1e,0xa0,0xa3,0xc4,0xb0,0xdd,0x1c,0x97,0x1e,0x8e,0xb2,0x10,0xc2,0x52,0x1c,0xa6,0xa9,0x4c,0x2a,0x51,0x54,0x8e,0x8b,0xc1,0xc1,0xac,0xf5,
+0x4b,0x84,0x61,0xa5,0x75,0x72,0x58,0x50,0xab,0x8c,0xd1,0xb5,0x94,0x41,0xe0,0x69,0xed,0xa4,0x46,0x0a,0x03,0xac,0x24,0x08,0xa8,0x77,0x95,0x9a,0xfe,0xd7,0xb4,0x22,
+0x4a,0xa7,0x43,0x96,0x7d,0x8c,0xd0,0x97,0x1e,0xb4,0xaa,0xa3,0xba,0x14,0x92,0xb3,0xac,0x43,0xda,0x1a,0xe3,0x18,0xa3,0xd8,0x9e,0x6a,0xc0,0x48,0xc2,0xa1,0x0a,0x31,
+0x2c,0xf9,0xac,0x69,0x16,0x66,0x97,0x17,0xed,0xf1,0x71,0x16,0xc9,0x5a,0x7c,0xb6,0x48,0xc7,0xd1,0x60,0xc0,0x3d,0x9d,0x6c,0xd4,0x59,0xa0,0x96,0x83,0x22,0x25,0xc0,
+0xd6,0xcd,0xa2,0xb4,0xd5,0x23,0xb0,0xd5,0x7b,0x01,0xd4,0x06,0x7a,0x23,0x17,0x6b,0xe2,0x42,0x3c,0x8f,0xb0,0x14,0x40,0x9d,0xb0,0x6a,0xdd,0x08,0x79,0x6b,0x5e,0x07,
+0x18,0xf1,0x74,0x4d,0xd2,0x18,0xbf,0xbc,0x38,0x9d,0x3f,0x57,0x82,0x8c,0xe7,0x39,0x73,0xbc,0xa0,0x1d,0x82,0x33,0xc6,0xa6,0x4d,0x68,0x08,0x12,0xfc,0xd8,0x14,0xba,
+0x74,0x9f,0xb0,0x90,0x2c,0x79,0x3a,0xb0,0x3f,0xc1,0x10,0x3a,0x9a,0x49,0x10,0x30,0x6c,0x00,0xaf,0x43,0x4b,0xd7,0x91,0xc7,0xf8,0x38,0x1e,0xa1,0x2b,0x04,0xce,0xc4,
+0x24,0x34,0xa2,0x7b,0x63,0x52,0x6d,0x81,0xf2,0x6a,0x1e,0x52,0x7f,0xf9,0xc9,0x4b,0xdf,0xbf,0xfe,0x02,0x3c,0xe9,0x9a,0xe3,0x91,0xf2,0x5f,0x1e,0x5f,0x11,0xdd,0x78,
+0xf4,0xf2,0x88,0x1e,0x1c,0x75,0x20,0x64,0x2a,0x42,0x07,0x16,0x61,0x70,0x99,0x1b,0xc6,0xe0,0xa8,0xb1,0xac,0x11,0x4c,0x1b,0x4d,0x51,0xf9,0x60,0xd9,0x5e,0x1d,0x14,
+0xa6,0x7d,0xcb,0x06,0xcf,0x13,0x31,0x05,0x3f,0x31,0x42,0x57,0xe3,0xc1,0x79,0xb0,0x9d,0x02,0x4d,0x7d,0x9f,0x82,0x72,0x9d,0x94,0x3f,0x72,0x22,0x1f,0x7c,0x64,0x54,
+0x7e,0x3d,0xa6,0xc6,0x34,0xdf,0x06,0x85,0x06,0x63,0x6b,0xda,0xba,0x0c,0x6c,0x39,0x89,0x8f,0x7d,0x48,0x68,0xcb,0xe9,0x31,0x08,0x4b,0xdf,0x29,0x91,0x36,0xf9,0xa6,
+0x10,0xa4,0x25,0x57,0x18,0x0c,0x96,0x0c,0xd4,0xc9,0x60,0x99,0x0e,0xb3,0x8b,0xb4,0x7c,0x96,0xfc,0x66,0xc9,0x8d,0x76,0x8f,0x89,0x17,0x33,0x26,0xf5,0x37,0x0f,0xa4,
+0xe0,0x18,0xd1,0xa8,0x3d,0x73,0xc4,0x5d,0x00,0xc2,0x4d,0x00,0xa2,0x43,0x7a,0xd0,0x99,0xd8,0x3a,0x3e,0x13,0xff,0x36,0xfd,0x35,0x7e,0xb2,0x54,0x02,0xe9,0x23,0xec,
+0x7e,0x53,0x06,0x07,0x6b,0xb7,0x87,0xe7,0x2a,0x5b,0x3b,0xe8,0x4d,0x96,0x3d,0xf8,0xbd,0xd6,0x0b,0x69,0x6e,0xef,0x58,0x48,0xd0,0xbd,0xe8,0xf1,0xcf,0x07,0x74,0x41,
+0x39,0x32,0x1d,0x69,0x66,0x62,0x8b,0xd8,0x34,0xb2,0x05,0x15,0xc2,0x8b,0xb6,0x50,0x50,0x16,0x90,0x7e,0x92,0x85,0xf9,0x66,0xba,0xc0,0xcf,0x95,0x0e,0xe7,0x15,0x45,
+0x23,0xc9,0xf7,0x24,0x88,0x01,0xc0,0xb1,0x49,0x61,0x24,0x1e,0x1a,0x7c,0x6c,0x13,0x72,0x71,0x91,0x60,0x60,0x05,0xdc,0xd3,0x4a,0xab,0x15,0x09,0x70,0x95,0x5c,0xba,
+0x6c,0x42,0x60,0xdd,0xfe,0xd9,0x17,0xaf,0xe8,0xe6,0x00,0x76,0x83,0xab,0xcd,0xe0,0xe0,0x7d,0x67,0xbe,0x5c,0x8a,0xbd,0xf1,0xda,0x9c,0xc4,0x41,0x8f,0x0b,0xbb,0x0b,
+0x5d,0x32,0x6d,0x91,0x15,0xd6,0x1d,0x2d,0xf8,0x1d,0x7d,0xb0,0x67,0xca,0x11,0x72,0x03,0x1e,0xe2,0x12,0xee,0x1c,0x5c,0x5d,0xad,0xfd,0x24,0xfe,0xaa,0xf9,0x23,0xf8,
+0x30,0x25,0x3e,0x06,0x11,0x8d,0xd3,0x51,0xd7,0x2c,0x08,0x68,0xa1,0x80,0x4a,0xc4,0x34,0x16,0xa0,0xcb,0x8b,0x99,0x58,0x2e,0xa6,0xd9,0xa1,0x5e,0x28,0x22,0xd8,0xa3,
+0x3f,0x68,0xbd,0x80,0x0b,0xfc,0x3f,0x2c,0x5c,0xe8,0x0c,0xd0,0x39,0x0a,0xcd,0xd2,0xca,0x90,0xa1,0x90,0xe3,0x67,0x0b,0x69,0x00,0x31,0xd3,0x0e,0xf0,0x93,0x80,0x25,
+0x62,0x21,0xf6,0x8d,0xa2,0x27,0xf0,0x34,0x28,0xa4,0x64,0xd2,0xf4,0xb9,0x5a,0xce,0x02,0x67,0xde,0x48,0xd3,0x17,0x57,0x09,0xa2,0xac,0x97,0x24,0x51,0x75,0x88,0x08,
+0xff,0xf8,0x9e,0x67,0x68,0x41,0xc4,0xc8,0x91,0x8d,0x21,0x3a,0xb1,0x7c,0x75,0x5a,0x23,0x45,0xe0,0x5e,0x9d,0xa3,0x67,0xd4,0x6d,0x99,0x7c,0xe4,0x1a,0x60,0x09,0x8c,
+0xc4,0x29,0x7a,0xc4,0x10,0xdb,0x01,0xd2,0x0b,0x37,0xc4,0x16,0x55,0x9d,0xe2,0xa2,0x26,0xee,0xdc,0xfb,0x4f,0x62,0x6c,0xa5,0x53,0x02,0xa7,0xf2,0xcc,0x70,0x79,0xd2,
+0xa9,0xec,0x8e,0x80,0x82,0x36,0x12,0x73,0x36,0x7a,0xa7,0xac,0x38,0xa2,0x30,0x9a,0xbe,0x78,0x2d,0x10,0x1b,0x03,0xd5,0x02,0x39,0x95,0xa7,0xe4,0x4c,0xc3,0xe9,0xff,
+0xd9,0xf1,0xe0,0x55,0xeb,0x74,0x30,0x13,0x5b,0x8f,0x1e,0xe1,0x32,0xe2,0xea,0x80,0x4d,0xb3,0xdc,0x13,0xdb,0xff,0xea,0x5b,0x32,0x64,0xeb,0x3a,0xbd,0x6b,0x2e,0x08,
+0xb4,0xf7,0xef,0xfe,0x65,0xa9,0xe4,0x0c,0x00,0xf9,0x9d,0xbf,0xc6,0x10,0x9e,0x8a,0x7d,0x14,0x4f,0x4e,0x4b,0x7c,0xaf,0x2a,0x4d,0xe9,0xec,0xe4,0x41,0xf2,0x5e,0x57,
+0x97,0xcb,0xdb,0x27,0x1b,0xe2,0x48,0xd3,0xaa,0x80,0xca,0x24,0x6a,0x5f,0xd3,0x55,0x16,0x0a,0x22,0x59,0x74,0xe8,0xcb,0xa6,0xaf,0x08,0xbe,0x95,0x82,0xf3,0x01,0x65,
+0x37,0xc6,0xa6,0x35,0xed,0x20,0x59,0xb4,0x45,0x94,0xe7,0x08,0x03,0x1d,0x47,0x55,0x13,0xfa,0xfa,0xf9,0x9d,0x21,0x0a,0x05,0x7c,0xce,0x42,0xfd,0x49,0x37,0xaa,0xb5,
+0x37,0x77,0x4e,0x68,0x3f,0x7d,0x13,0xbf,0xbe,0xdd,0xaa,0xe4,0xb5,0x74,0x4e,0x16,0x34,0x12,0x54,0x8e,0x5f,0xce,0xa0,0x11,0x7c,0x0d,0x13,0x95,0x8b,0xd4,0x4d,0x7c,
+0x25,0xe9,0x70,0xf3,0x74,0xf0,0x82,0x2b,0xb4,0xfe,0x07,0xa9,0xfa,0x14,0x24,0x73,0xa5,0xe1,0xeb,0xb0,0xc1,0xa3,0x65,0xce,0x3a,0x45,0x62,0x58,0x68,0xa0,0x94,0xc3,
+0xa8,0xa1,0x9c,0x83,0x1b,0xa2,0x70,0x96,0xc1,0x11,0xc7,0x88,0x7e,0x7f,0x4e,0xfe,0x3f,0x48,0x3b,0x8c,0x41,0xf1,0x78,0x54,0x5f,0x21,0x70,0x1b,0xa6,0xd7,0x41,0x3b,
+0x4e,0x88,0x3b,0xa7,0xad,0xbb,0x3f,0x87,0x3b,0xc9,0x8f,0x23,0x04,0x60,0x20,0x2a,0xbe,0x45,0xa0,0xe9,0xb0,0xad,0x48,0xc3,0x19,0x65,0x6a,0xe2,0xb5,0x0d,0x6f,0x42,
+0xa9,0x14,0x80,0x22,0xd5,0x44,0x77,0x33,0x26,0xc7,0x8d,0x70,0x56,0x66,0x10,0xb4,0xda,0x53,0x68,0x7f,0x28,0x4f,0xaa,0x82,0x04,0x28,0xd2,0x69,0x97,0x66,0x61,0x52,
+0x63,0xa6,0xf4,0xcd,0x30,0xb3,0x05,0xed,0xa7,0xff,0xed,0x13,0x1e,0x06,0x1d,0xc1,0x18,0x77,0x42,0x3e,0x96,0xf4,0xb1,0xae,0xe1,0xb1,0xb3,0x34,0xe1,0x37,0x11,0x26,
+0x10,0x59,0x8e,0x55,0x38,0x83,0x68,0x5d,0xb4,0xcb,0xfd,0x39,0x89,0xc0,0x1a,0x63,0xcb,0x17,0xc5,0x4a,0x1c,0x5e,0x2c,0x8f,0x16,0x9d,0x9a,0xe0,0x00,0xf8,0x54,0xb0,
+0x89,0xf7,0xd3,0x0d,0xeb,0xd3,0x19,0xfe,0x5f,0xaf,0x1c,0x5f,0x47,0x48,0xec,0x2b,0x51,0x4e,0x87,0x1f,0x9b,0xbc,0xf5,0xda,0xa4,0x0e,0x7e,0xac,0x03,0x1d,0xf3,0x0f,
+0x46,0xcf,0xd8,0x88,0xfc,0x45,0x43,0xa7,0xd9,0x15,0x61,0x35,0xa5,0xae,0x19,0x7c,0xb3,0xc4,0x46,0x46,0x41,0x03,0x0d,0x52,0x5d,0x54,0xb9,0xf5,0xa1,0x10,0x93,0x18,
+0xbd,0xe7,0xeb,0xd8,0x76,0x11,0x61,0x78,0x0d,0xb0,0x10,0xf7,0xbb,0xb9,0x14,0x15,0x47,0x40,0xa8,0xae,0x63,0x65,0xa2,0xae,0x0a,0x02,0xfa,0xb8,0xa5,0xe1,0xd7,0xc3,
+0xe9,0x19,0xba,0x7a,0xc0,0x78,0xba,0x9d,0x0c,0x63,0x00,0xb5,0x54,0x98,0x6e,0x8d,0xb5,0x42,0xa4,0xb2,0x8e,0x38,0x25,0xd9,0x49,0xd5,0x96,0xac,0x09,0x58,0xa1,0xbb,
+0xcb,0x20,0x7f,0x90,0x1f,0x40,0xe9,0xb1,0x42,0x63,0xf4,0x2c,0x33,0x39,0x20,0xbf,0x22,0xb0,0x19,0x68,0x99,0x63,0xe9,0xd5,0xa8,0x48,0x07,0x2d,0x62,0x8f,0x98,0x8d,
+0xaf,0x72,0xd7,0xcd,0xe2,0x51,0xe5,0x5a,0xc9,0x83,0x12,0x74,0x50,0xaa,0x96,0xdd,0x38,0x9e,0x42,0x55,0xc2,0x1d,0x84,0xb7,0x92,0xca,0x89,0xa4,0xdd,0x5c,0x81,0x17,
+0x10,0x60,0x9f,0xc6,0xb6,0x06,0x93,0x9a,0x91,0x2a,0xf4,0xc8,0x6e,0x03,0xd4,0xba,0x68,0xdb,0x10,0x37,0x71,0x44,0x33,0x54,0x05,0x5c,0xb1,0x15,0x52,0xce,0x57,0xfd,
+0xe9,0x9b,0xd8,0x80,0xae,0x40,0xb5,0x8c,0xda,0x72,0xe9,0x41,0x27,0xa2,0xe5,0xdc,0x65,0xd6,0x00,0x1d,0x60,0x68,0x9d,0x45,0x60,0x2c,0x98,0x53,0xcb,0x3c,0xe9,0x01,
+0xa3,0x82,0xb3,0x67,0x0a,0x20,0xea,0xbe,0x81,0x1f,0x98,0xb2,0x7e,0x34,0xd6,0x88,0x2e,0xb0,0x24,0x86,0x8b,0x8c,0x50,0x1b,0x0d,0x27,0x32,0x64,0xb0,0xa6,0xd7,0x2c,
+0x82,0xa2,0x91,0x10,0xc0,0xce,0xac,0xfb,0xa0,0x6b,0x80,0x0d,0xcd,0xa8,0xc2,0xee,0xfe,0x25,0x75,0x08,0x0e,0xe8,0xd8,0xdf,0x2d,0x2a,0xe1,0xb4,0x84,0x91,0x52,0xb1,
+0x4f,0x40,0xa4,0x6e,0xdd,0xf9,0x06,0x35,0x78,0x28,0x77,0xe8,0x4e,0x6d,0xcc,0xc1,0x3d,0x62,0x74,0xa6,0x36,0x93,0xfa,0x4a,0x4d,0x04,0x64,0x5a,0x00,0x92,0x4d,0x44,
+0xc8,0xeb,0x1f,0x01,0x55,0x0a,0xd5,0x61,0x4c,0x45,0x1d,0x74,0xab,0x03,0x3c,0x4f,0xad,0x4b,0x55,0x79,0x16,0xac,0x88,0x7f,0x47,0x20,0xe2,0x4a,0x40,0x70,0x32,0xbc,
+0x6d,0xc7,0xe1,0x37,0x76,0x5f,0x9e,0xe3,0xd9,0xde,0x1f,0xfc,0x6c,0xb6,0x52,0x03,0x0c,0x00,0x44,0xa5,0x3c,0x22,0x46,0x19,0xc1,0x99,0x6f,0x79,0x64,0xc6,0xc3,0xe9,
+0x0f,0x02,0x4c,0x07,0x3c,0x5c,0xf6,0x74,0x1d,0xa9,0x80,0xcd,0x63,0x96,0x61,0x88,0x29,0x84,0x1a,0x04,0xbb,0x87,0x70,0xb1,0x97,0xa8,0xcb,0xa1,0xbb,0x7c,0x85,0x03,
+0xa3,0x64,0x78,0x85,0xe7,0xfd,0x1c,0x26,0xcc,0xad,0xa7,0xcc,0xc4,0x16,0x7a,0xd4,0x6a,0xa3,0x2a,0xb6,0x62,0xe1,0xce,0x4a,0x6d,0x11,0x1d,0x4f,0x59,0x76,0x8b,0xb0,
+0x64,0x95,0x0a,0x91,0x87,0xc9,0x33,0x2d,0x59,0x36,0xdc,0xbb,0xea,0x2c,0x3b,0x00,0xc5,0xd7,0xee,0x44,0x7c,0x28,0x00,0xaa,0x06,0x12,0x69,0xbf,0xe3,0xd6,0x7a,0x50,
+0x60,0xb3,0x1e,0x06,0x64,0xd8,0x0c,0x36,0xac,0x8a,0x95,0xd6,0xd5,0x8b,0xba,0x97,0x3c
+};
+const size_t WM_PK_OTA_JS_BR_LEN = 4241;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_OTA_JS_BR[] PROGMEM = {
+0x1b,0xf5,0x2e,0x51,0xd4,0x82,0x4d,0x4a,0x1d,0x45,0xd9,0xe0,0x4c,0x01,0x68,0x75,0xc0,0x13,0x11,0x5d,0xf8,0x1d,0xa1,0xa2,0x11,0x6b,0xf0,0x35,0xd4,0xb1,0x91,0x6b,
+0x3c,0xde,0x75,0x36,0xe3,0xf2,0x6b,0xea,0x65,0xa9,0x23,0x24,0x99,0xfd,0xdf,0x96,0xda,0xbd,0x97,0x13,0xee,0xcc,0x20,0x29,0xc8,0x0a,0x90,0xdd,0xf8,0x3b,0xcb,0xde,
+0x75,0x73,0x96,0x91,0x91,0xc0,0xb2,0x65,0x41,0x25,0x19,0xc7,0x21,0xf4,0x7e,0xc9,0x2b,0x34,0xe3,0x84,0xf8,0x21,0x08,0xa2,0x8d,0x76,0xd7,0xec,0x71,0xfa,0xca,0x45,
+0x50,0x92,0xb6,0xfa,0xbd,0xaf,0xb3,0xab,0xe9,0x75,0x1e,0x08,0x75,0x2c,0x40,0x12,0x28,0x3f,0x10,0xb9,0xc5,0xb4,0x30,0xfc,0xbf,0x18,0x54,0x0a,0x37,0x5b,0x2d,0xff,
+0x76,0x01,0x04,0x54,0x5b,0xf8,0x3c,0x43,0xcb,0xfb,0x6b,0x6a,0xef,0x87,0x76,0x5a,0x47,0x15,0x35,0x80,0x02,0x58,0xeb,0x80,0x06,0x06,0x60,0xeb,0xed,0x7b,0xda,0xf3,
+0xae,0x64,0xdf,0x49,0xf6,0x75,0xf9,0x4a,0x6d,0xda,0x95,0xaf,0xb4,0x8a,0xfe,0xb1,0xdf,0x0a,0xaa,0x15,0x06,0x65,0x78,0x86,0x87,0xb6,0x02,0x50,0x20,0xcd,0x7e,0xe7,
+0xab,0x77,0x4d,0xfa,0xbc,0x36,0x1e,0xe0,0xc0,0x72,0xa2,0x03,0x1c,0x86,0x96,0x51,0x7f,0x3f,0x9a,0x15,0x74,0x36,0xad,0x0d,0xb4,0x38,0x2c,0x16,0x63,0x37,0x9b,0x6a,
+0x74,0x1b,0xa2,0xa9,0x46,0xfc,0x02,0xd6,0xe6,0x32,0xd6,0x3a,0x4b,0xaa,0x7b,0xbe,0x14,0x18,0x03,0xc6,0x40,0x86,0x46,0xdc,0x99,0x47,0x26,0xbf,0x5a,0xf0,0xef,0x22,
+0x3e,0x30,0x26,0xc7,0xa8,0x9f,0x9b,0x95,0x72,0xa2,0xc0,0xad,0xb4,0x0c,0x15,0x3a,0x22,0xc3,0xad,0xaf,0xaf,0x00,0x6b,0xda,0xd8,0x06,0x7b,0xa5,0x58,0x93,0xd1,0x19,
+0xc2,0xbb,0x1c,0x9a,0x4e,0x21,0x9f,0xd1,0xaa,0xa0,0x86,0xdc,0x4e,0x94,0x6b,0xba,0xfc,0x64,0xc2,0xd1,0x4c,0x1d,0x63,0xcd,0xc8,0xfb,0xeb,0x30,0xd4,0xec,0xfe,0x5e,
+0xba,0x63,0x18,0x25,0xc2,0x30,0x1c,0xe2,0xcc,0xbf,0x9d,0xd9,0x94,0xbb,0xf7,0x2b,0xd3,0xfe,0x09,0x46,0x48,0xc3,0xd3,0x14,0x79,0xad,0x01,0xe1,0xd2,0x6c,0xb9,0x60,
+0xa0,0x3b,0x9a,0xf4,0xde,0x40,0x4b,0x8c,0xc7,0x1d,0xb4,0x9d,0xf1,0xe1,0x75,0x21,0xe1,0x48,0xfa,0x69,0x69,0x40,0xc7,0x27,0xa7,0x67,0xe7,0x17,0x97,0x57,0xd7,0xaf,
+0x5e,0xbf,0x79,0xfb,0xee,0xfd,0x87,0x8f,0x9f,0x3e,0x7f,0xf9,0xfa,0xed,0xfb,0x8f,0x9f,0xbf,0xf8,0x24,0x17,0xb2,0x28,0xa7,0x6a,0x36,0xd7,0x0b,0x53,0xd5,0xbf,0xad,
+0xf3,0xcb,0x66,0xf5,0xb0,0x7e,0x4c,0xb0,0xe4,0xf4,0xec,0x69,0x32,0x6c,0x22,0x5a,0x40,0x6b,0x2b,0xaf,0x07,0xf0,0x8b,0x1c,0x15,0xfe,0xbc,0x95,0x1b,0x0e,0xc5,0x93,
+0x1b,0x9d,0x67,0xc9,0x83,0xe8,0x48,0xfe,0x78,0x16,0x8c,0xb1,0x6f,0x43,0x8f,0x29,0x8d,0x50,0xdc,0x5c,0x23,0x52,0xa5,0x0a,0xec,0x7a,0x09,0x51,0x5e,0x59,0x00,0x4a,
+0x4d,0x12,0x07,0xc6,0x29,0x18,0x2e,0x0f,0xc2,0x8e,0xee,0xc3,0x27,0xd3,0x9c,0xd2,0x5a,0xda,0xad,0x71,0xbf,0xb4,0xc2,0x6f,0xe7,0x79,0xc9,0xad,0x95,0x29,0x8a,0x16,
+0xbb,0x08,0x88,0x25,0x86,0x54,0x7c,0x35,0x11,0x45,0xe4,0x63,0x2c,0x6e,0x8f,0x82,0xa1,0x21,0xf0,0x1a,0x9e,0x10,0x0a,0x5d,0xc7,0xb4,0x70,0xf8,0x64,0xed,0xa5,0x43,
+0xd1,0x07,0xf4,0xea,0xe3,0x5b,0xb9,0x51,0x94,0xeb,0xf7,0x89,0x13,0xa9,0xd0,0x4f,0xe4,0x2a,0x71,0x36,0x3d,0xd3,0x36,0xc1,0x85,0x90,0x10,0x13,0xd8,0xce,0x97,0xaa,
+0x61,0x5b,0x9a,0xef,0x3f,0x83,0x1c,0x62,0xe6,0x10,0x8b,0x23,0x1f,0xe2,0xff,0x31,0xcd,0x23,0xd8,0x87,0x13,0xe3,0x7c,0x74,0x9e,0xed,0xfb,0x0d,0x6e,0xcc,0x6f,0xf7,
+0x61,0x5a,0x87,0xfc,0x3f,0x65,0x87,0x58,0x1a,0x3a,0xa2,0xf8,0x23,0x70,0x52,0x1d,0xa9,0xdf,0xd8,0xca,0xe2,0x33,0x7a,0xcb,0x28,0xe6,0x94,0xd1,0xfc,0x56,0xb9,0x0e,
+0xfc,0x3f,0x65,0x9f,0xb6,0xe6,0x9f,0xad,0x5e,0xc9,0x87,0x8b,0xde,0x27,0xdc,0x11,0x50,0xf0,0x95,0x5d,0x31,0x7a,0x23,0x87,0x92,0x09,0xa0,0x99,0x8d,0x7c,0xd2,0x66,
+0x8e,0x04,0x8c,0x2b,0x48,0x33,0x84,0x88,0x71,0x9a,0x23,0xe9,0x65,0xb8,0x3d,0x9d,0x72,0x66,0x36,0xd6,0xf5,0x63,0xf6,0xe4,0x31,0xa7,0x29,0x98,0xc4,0x1f,0xb4,0x5b,
+0x5c,0xb1,0xdd,0xea,0x58,0x68,0xcb,0x34,0x65,0xe7,0x11,0x97,0x97,0x4c,0xf7,0x25,0x2b,0x4a,0x52,0xee,0xcf,0x19,0xe9,0x70,0x58,0xd5,0xaa,0xe1,0xb6,0x54,0x40,0x0d,
+0xe5,0x1b,0xfb,0x41,0x6d,0xec,0xee,0x10,0x49,0xc9,0xfd,0x0b,0x63,0x57,0xb3,0x3d,0xd9,0x42,0xc7,0x40,0x0b,0xd7,0x9e,0x9e,0x78,0x6b,0x50,0xc4,0xef,0x16,0x60,0x33,
+0xb4,0x39,0x02,0x14,0x54,0x72,0x82,0x7d,0xe0,0xf7,0x1a,0x07,0x8e,0xa7,0xdf,0x76,0x7c,0x77,0xdc,0xff,0x15,0x0f,0x07,0xe1,0x66,0xf3,0xf6,0x9b,0x2a,0x69,0x46,0x3b,
+0x2c,0x12,0xcd,0xcc,0xc1,0xaf,0xc7,0xff,0x33,0x5c,0xde,0x83,0xd8,0x87,0xd1,0x38,0x46,0xef,0xdc,0x15,0x73,0x88,0xb7,0xe1,0xfd,0x04,0xf0,0x29,0xe5,0xd2,0x75,0xb5,
+0xc2,0x29,0xfb,0xe9,0x33,0x8f,0xf6,0x01,0x9d,0xe4,0x3e,0xcc,0x37,0xd2,0xdb,0x9e,0x43,0xe0,0xdd,0xe8,0x40,0xf1,0x47,0x8a,0x67,0x7a,0x18,0x98,0x07,0x17,0x0a,0xd6,
+0x0c,0x58,0xe6,0x5c,0x81,0xce,0x55,0xe8,0x05,0xb4,0x4b,0x5f,0xec,0x6f,0x6d,0xfe,0xa9,0xf5,0xbd,0x9f,0x5f,0x1f,0xf7,0x82,0x4d,0x94,0x61,0x46,0xe3,0x38,0x47,0x0f,
+0xca,0x79,0x2a,0x35,0x01,0xa8,0x82,0x28,0x34,0x10,0xf4,0xc2,0x42,0xda,0xa6,0x2f,0x74,0x54,0x05,0x82,0x80,0x0d,0x5f,0xb2,0x32,0x58,0x9b,0xd1,0xf1,0x58,0x11,0x72,
+0x95,0x72,0x43,0x1d,0x15,0xc2,0x91,0xcf,0xb8,0x82,0x54,0xa0,0xa5,0xec,0xe1,0x63,0x8f,0x1d,0x49,0xc1,0x13,0x15,0xf8,0x8f,0xbc,0x23,0x68,0x1d,0xfa,0xeb,0x61,0x9f,
+0xba,0x76,0x0c,0xac,0xc7,0xee,0x16,0x37,0x1f,0x01,0xb6,0x31,0xe3,0x35,0x5c,0xc4,0xd2,0x62,0xef,0x21,0xb4,0xf2,0x75,0x0f,0xca,0x6e,0x25,0x61,0x88,0xdf,0x22,0x05,
+0xf7,0xd3,0x87,0x7b,0x0f,0xec,0xf5,0x34,0xbb,0x57,0xee,0x64,0x59,0x14,0xd2,0x12,0x53,0x5e,0xfb,0xbe,0xb7,0x60,0xce,0x9f,0x75,0x24,0xc3,0x70,0xeb,0x50,0xd5,0x89,
+0x31,0x40,0xaf,0x02,0xa0,0x2d,0x20,0x1f,0x9e,0xf7,0x60,0x4d,0xac,0x6c,0x35,0xf6,0x03,0xa6,0x1c,0x3c,0x14,0x63,0x4e,0xe4,0x42,0x57,0xdc,0xbf,0x39,0x87,0xca,0x4d,
+0xb1,0x32,0xb4,0x46,0x3f,0xf9,0x16,0x6b,0x5d,0x04,0x8e,0x19,0x03,0xe6,0xf2,0xec,0x56,0x57,0xb4,0x80,0x6b,0x46,0xb8,0xbd,0xe8,0xe0,0x3d,0x15,0x70,0x4d,0x2b,0x45,
+0x94,0xc3,0x5b,0x6e,0x4e,0x55,0x4e,0x90,0x67,0x96,0x18,0x1b,0x8d,0x87,0x2a,0x0c,0x55,0xd7,0x57,0x4a,0x00,0x00,0x8d,0x5f,0x10,0xb7,0x6b,0x74,0xe5,0x20,0xe8,0x3b,
+0x37,0x27,0x1b,0xf0,0x11,0x05,0xdc,0x31,0x46,0x58,0x2b,0x72,0x5f,0x61,0x05,0x31,0xc7,0x32,0x4a,0xbb,0x9c,0xc6,0xd8,0x7a,0x86,0x5c,0xe5,0xee,0x1b,0x73,0xf3,0x7d,
+0x88,0x56,0x71,0x0f,0xe0,0xab,0xb9,0x7e,0xdf,0xc8,0x5b,0x61,0x88,0x73,0xe0,0x9c,0x7c,0x0c,0x61,0x29,0x7b,0x2d,0x68,0x96,0x2d,0x02,0x06,0x55,0xac,0x21,0x67,0x7b,
+0x3f,0x90,0x06,0x92,0xb9,0xe4,0xb6,0xd4,0xb4,0x16,0x4a,0xe8,0xa7,0x73,0x9a,0x4b,0x59,0xe6,0x95,0x15,0xf4,0xb5,0x2b,0x2b,0x3d,0xcc,0x83,0x17,0x2e,0x21,0xd6,0x72,
+0x68,0xc9,0xf6,0xb1,0x65,0x2b,0x3b,0x5e,0xde,0x1e,0xf8,0x1e,0x30,0x5d,0xf8,0x64,0x79,0x9b,0xbf,0x30,0x41,0x06,0xb2,0xd3,0xaa,0xc6,0x2f,0x65,0x8a,0x88,0xd8,0x75,
+0xce,0x9b,0x9b,0xe4,0xc5,0xa2,0xf5,0xee,0x41,0x3b,0xc6,0x75,0xb4,0x5b,0xb1,0x1b,0xad,0xfb,0x70,0x1b,0x21,0xa9,0xdf,0x8f,0xda,0x7f,0xbd,0x17,0xc0,0xd9,0x7d,0x51,
+0xd0,0xf2,0xfe,0x9b,0x65,0x49,0xa7,0x6f,0x4e,0xa7,0x74,0xbd,0x88,0x52,0xa8,0x16,0x42,0x32,0x91,0xc2,0xf7,0x3a,0x05,0x43,0x3f,0x83,0xa4,0x73,0xa8,0xe8,0x3d,0xf8,
+0xcc,0xc0,0x02,0x1b,0x2a,0x69,0x45,0x3d,0x3d,0x8f,0x12,0xc5,0xdf,0xb9,0xc6,0x7a,0xf4,0x62,0xa7,0x4f,0xfd,0xf1,0x93,0x12,0x9f,0x57,0x98,0x42,0xcc,0xb4,0xfc,0x3d,
+0xda,0x4b,0x3b,0x1b,0x7e,0x89,0xc7,0x2b,0x4c,0xe1,0x6a,0x3e,0x2f,0xd1,0x44,0x64,0xf2,0x3c,0x7c,0xd0,0x15,0x79,0xa7,0x90,0xfe,0xd5,0x51,0x0f,0xc2,0x4e,0x45,0xc2,
+0x47,0x54,0x42,0x60,0x0e,0xa7,0xcd,0xdd,0x1b,0x08,0xcf,0x02,0xb0,0x70,0x41,0x5b,0x40,0x8f,0x4a,0x94,0x79,0xc5,0x51,0x38,0x83,0xdc,0x6a,0x4a,0x56,0xe7,0x0c,0xa0,
+0x98,0x21,0x82,0x27,0xdb,0xe5,0x07,0x4c,0x9b,0xa3,0x26,0xe2,0xbc,0xe3,0x42,0xeb,0x63,0x26,0xcf,0x9c,0x3b,0x18,0x66,0xd7,0xc8,0xc2,0x85,0xb3,0x70,0x43,0xbd,0x35,
+0x51,0x67,0x95,0x21,0x93,0xe0,0x05,0x6d,0xc4,0xa0,0x80,0xaa,0xc3,0x37,0x24,0x62,0xa9,0xa3,0xa8,0x6e,0x0e,0xf8,0xf3,0x33,0x1e,0xec,0xcc,0x75,0x88,0x99,0x90,0xa0,
+0xcf,0xb7,0xbd,0xa3,0x2f,0x60,0xab,0x4e,0x01,0x9e,0x31,0xbf,0xb4,0x86,0x33,0xd4,0x85,0xca,0x61,0x26,0x78,0x68,0xb4,0x37,0x42,0xbd,0x40,0x38,0x03,0x26,0xdb,0xc7,
+0x81,0x98,0xfa,0xb9,0xb5,0x85,0x95,0x82,0x18,0xd0,0x0d,0xcf,0x4a,0x51,0x68,0x8e,0x91,0x68,0xd6,0x9b,0x9c,0x2e,0x7a,0xed,0xb6,0x76,0xaa,0x1d,0x20,0x0c,0xde,0x42,
+0x7d,0xa8,0xf4,0xc9,0xe1,0x8e,0x5a,0xd7,0x84,0x3d,0xc9,0xd6,0x15,0x06,0x1c,0x28,0x95,0x41,0xef,0x2c,0xdd,0x73,0x2d,0x6b,0x5e,0x42,0xc3,0x3b,0x2b,0x1f,0x30,0x83,
+0x13,0xf3,0x5f,0xd6,0xa3,0x69,0x60,0x29,0xa1,0xd5,0x8b,0xea,0xc6,0x8c,0xfc,0xb1,0x98,0x71,0x2b,0xd3,0xac,0xdc,0x48,0xe2,0x99,0xdf,0xf2,0x51,0xa8,0xca,0xd8,0x7d,
+0x0a,0xe4,0x19,0xed,0xe7,0xea,0x20,0xa4,0xeb,0x85,0x56,0x50,0x39,0x29,0x14,0xe1,0x92,0xc6,0x04,0x58,0xd0,0xcc,0xce,0x15,0x1a,0xd8,0x80,0x75,0xd6,0xd4,0x9e,0x94,
+0xb9,0x9c,0x99,0x0b,0x13,0xdf,0xb4,0x10,0x46,0xc4,0x79,0x84,0x36,0x4e,0x85,0x94,0x26,0x97,0x35,0xc7,0xf1,0x39,0x81,0xf8,0xe7,0xc8,0x46,0x53,0x55,0x13,0x8a,0x33,
+0x55,0x29,0xde,0x5c,0xd9,0xb3,0xa2,0x1a,0x75,0xdc,0xbb,0x95,0x17,0x24,0x9a,0x36,0xd4,0xf6,0xce,0x34,0xb1,0x14,0xc7,0xc5,0x65,0x56,0x19,0x19,0xa5,0x09,0x61,0x5c,
+0x29,0x4c,0x50,0x11,0xee,0x22,0x6d,0x87,0x57,0xba,0x83,0x4b,0xa9,0xa5,0x3c,0x0b,0x6b,0xd3,0x25,0xdc,0x85,0xd8,0x5f,0xab,0xf7,0x68,0xa2,0x12,0xd8,0xfb,0xf1,0x2e,
+0x29,0xe2,0xe9,0x43,0xca,0xa5,0xfb,0x38,0x2e,0x19,0x2b,0xf5,0xae,0xe0,0x32,0xb0,0x94,0x81,0x03,0x78,0x93,0xe1,0x0b,0xc8,0x0a,0xee,0xf9,0xb6,0x1b,0xad,0x52,0x1c,
+0x40,0x98,0xd2,0x0d,0x69,0x50,0x88,0xaf,0x6a,0xee,0x4e,0xe5,0xce,0x9c,0x1d,0x89,0x52,0x6e,0x62,0x26,0x85,0xd0,0xe4,0xd8,0xe7,0xba,0xe7,0x21,0xcd,0x66,0xb6,0xb4,
+0x38,0x97,0x52,0x3a,0x85,0x63,0xd8,0x9e,0x2a,0xc7,0x8e,0xca,0x49,0x09,0x83,0x09,0x79,0xff,0x6f,0x41,0x11,0x9a,0x2b,0x6b,0xd6,0x14,0x77,0x76,0x2a,0x77,0xaa,0xee,
+0x23,0x97,0xb9,0x75,0x33,0x52,0xc9,0x95,0x0d,0xdb,0x44,0xa7,0xa3,0xf3,0x8c,0x94,0x20,0xa3,0xcf,0x4b,0xef,0x56,0x50,0x45,0xf3,0x77,0x3c,0xf8,0xe8,0x3e,0x66,0x15,
+0x35,0x31,0x5d,0xb7,0x62,0x8f,0x7d,0x50,0x76,0x0b,0x53,0x61,0x48,0x2d,0xc6,0x96,0x53,0x4b,0x6b,0x0f,0x60,0xb1,0xe7,0xf6,0x1e,0xf2,0x08,0xab,0xd0,0x3e,0xfd,0x51,
+0x61,0x4d,0x02,0x36,0x80,0xcb,0x11,0xaa,0xec,0xda,0x1e,0xfb,0xe1,0x50,0x3e,0xf9,0xba,0xa6,0x16,0x92,0x04,0xd5,0xb1,0xbe,0x71,0x59,0x7e,0x37,0xf5,0x93,0x0d,0xff,
+0x7c,0xd3,0xe9,0x74,0x67,0xee,0xec,0xdd,0xed,0x1b,0x2a,0x15,0x89,0x88,0x7e,0x2b,0x4f,0x7f,0x6a,0xc2,0xea,0x4a,0x59,0x75,0xbe,0x93,0x4c,0xeb,0x3a,0x09,0x55,0x4a,
+0xe7,0x55,0xec,0xcd,0x36,0xb0,0xea,0x38,0xab,0x64,0x73,0x73,0xd8,0xd2,0xba,0x12,0x71,0x7e,0x6a,0xab,0x55,0x60,0xe4,0xaa,0x97,0x35,0xf9,0x18,0xbd,0xab,0x01,0xa8,
+0xf4,0xe6,0xb9,0x52,0xdb,0x46,0x14,0xe5,0x44,0x25,0x75,0xa5,0x5e,0xc9,0xc5,0x1c,0x28,0xdf,0xd4,0x63,0xdb,0x1e,0x2e,0x77,0xfa,0xde,0xa1,0x1d,0xac,0xa2,0x0d,0x93,
+0x89,0xc4,0x86,0xee,0x51,0x96,0x6c,0x9a,0x55,0x1f,0x19,0x6f,0x71,0xdb,0x7e,0xcf,0xf9,0x0a,0xf8,0x53,0x35,0x6b,0xe3,0x27,0x38,0xc6,0x5f,0x1d,0x5b,0xa8,0xfd,0x54,
+0x05,0xfb,0x64,0x0a,0xf6,0xaf,0x78,0xbf,0xa8,0x04,0xd7,0xa7,0xce,0x01,0x62,0x8b,0x76,0xbf,0xc2,0x3a,0xde,0xca,0x40,0x58,0x9d,0xf4,0x85,0x65,0xca,0x38,0xe9,0x07,
+0xb1,0x8e,0x4b,0x90,0x69,0xcb,0x2c,0xc0,0x31,0x7f,0x8a,0x71,0x53,0x59,0xbb,0x27,0x90,0xd9,0x9d,0x7f,0x99,0x49,0x0e,0x64,0xff,0x79,0x2d,0x92,0xf8,0x91,0x64,0x34,
+0xfe,0xc7,0xc2,0x34,0xb5,0xcc,0x6a,0x6a,0x90,0x07,0x55,0xda,0x23,0x7a,0x81,0xcd,0xde,0x49,0xf5,0xd0,0x3a,0xc9,0x04,0x2d,0xda,0xdd,0xd9,0x6e,0x61,0xb9,0x50,0x4b,
+0x37,0x60,0x7b,0xed,0x5d,0x2e,0x32,0x32,0xfd,0x55,0xc9,0x7a,0xc4,0x2f,0x5d,0x3f,0x04,0x5b,0x69,0xe3,0x47,0xb1,0x91,0xa5,0x0b,0x24,0x25,0x70,0xd2,0xd1,0xa2,0x13,
+0xa4,0xb6,0x03,0xea,0xc3,0xbd,0x85,0x32,0xb2,0x1b,0x91,0xca,0x0f,0x10,0xa7,0x1c,0x57,0x3f,0x97,0x04,0x92,0x25,0xcd,0xd9,0xc9,0x42,0x01,0xb6,0x4c,0x42,0x96,0x31,
+0x3b,0xc7,0x05,0x62,0xce,0xff,0xed,0xb4,0x31,0x49,0x0b,0xd3,0x14,0xc9,0x92,0x06,0x1d,0xad,0xc7,0xee,0xcb,0x8b,0x40,0xc2,0xb5,0xd0,0xbf,0xd4,0x5f,0x15,0x3b,0xf1,
+0x8b,0x1e,0xa1,0x18,0x22,0x00,0x5c,0xaf,0x08,0x58,0x7f,0x1c,0x38,0x2c,0x5f,0x99,0x42,0x34,0x92,0x2d,0x33,0xd1,0x2c,0x08,0x22,0xf3,0x13,0x96,0x7a,0x8c,0x61,0x5c,
+0x76,0x34,0x97,0x6b,0x99,0x85,0xe3,0x02,0x08,0x55,0xad,0xaf,0xda,0x27,0x0c,0xf9,0xba,0xad,0x3c,0x3f,0x1f,0xde,0x9a,0xe2,0x3f,0x59,0x12,0x0b,0xf2,0x8a,0x85,0x2b,
+0x5b,0xe4,0xde,0xda,0x4b,0xcb,0xbc,0x6a,0x24,0x06,0xf8,0xa1,0x3c,0x52,0x91,0x8c,0xd7,0x32,0xb1,0x82,0xec,0x3f,0x0b,0xc9,0xd2,0xda,0xca,0x3e,0xba,0x0a,0xf0,0xaa,
+0xdc,0xf8,0xd6,0x26,0x45,0x41,0xc0,0x41,0x7a,0xf7,0xef,0xc5,0xa8,0x60,0x51,0x29,0xe1,0xf8,0xde,0xf4,0x6d,0xb5,0x6a,0x09,0xcc,0x2b,0x79,0x8d,0x53,0x5a,0x84,0xa5,
+0x08,0xd7,0xcc,0x00,0x52,0x01,0xf3,0x87,0xc8,0x12,0xbb,0x24,0x61,0x25,0xa8,0x29,0x82,0x2b,0x1d,0xbd,0x69,0x43,0x40,0xeb,0x93,0xf0,0xae,0xae,0x71,0x95,0x56,0xad,
+0x5b,0x4b,0x47,0xd4,0xe4,0x61,0xcd,0x81,0x8d,0xb4,0x96,0xe6,0x99,0x6a,0xf6,0x4b,0x6f,0xc6,0x67,0x91,0x65,0x62,0xee,0xb2,0xc4,0xb3,0x69,0x11,0xe2,0x9e,0x14,0xf6,
+0xa8,0x0f,0x42,0xd9,0x9d,0xfd,0x96,0x05,0x48,0xcc,0xec,0xa6,0xd4,0x13,0x4f,0xc7,0xac,0xe1,0x04,0x02,0x17,0x9e,0x92,0x13,0x65,0xb3,0xce,0xa7,0x1e,0x1b,0x72,0x4c,
+0x09,0xb0,0x3c,0x5f,0x4e,0x50,0xc4,0xb9,0x4f,0x3c,0x03,0x06,0x02,0x2c,0x55,0x52,0xb5,0xd7,0x11,0x75,0xf5,0x4a,0x20,0xc1,0x92,0x9f,0x44,0xbe,0xd2,0x43,0xb6,0xb1,
+0x00,0xd2,0xa6,0xb2,0xad,0x05,0x48,0xf7,0x18,0xf1,0xc8,0x86,0x85,0x2b,0x01,0x1b,0x2b,0xea,0x01,0xc8,0xfa,0x92,0xe4,0xfa,0x9b,0x98,0x65,0xa0,0xe5,0xfc,0x45,0x5d,
+0x39,0xa8,0xad,0x9c,0x28,0x39,0xe5,0x8c,0x31,0x04,0x60,0x6b,0x42,0x35,0xbe,0x35,0x70,0xe3,0x33,0xba,0x38,0x1b,0xa7,0x73,0x95,0x93,0x4a,0x64,0x82,0x0f,0x44,0x7b,
+0xd0,0x0e,0x91,0x39,0x37,0x88,0xd5,0x45,0xae,0x62,0x14,0xfb,0xaa,0x01,0xe2,0x3b,0x06,0xac,0xf6,0x8d,0x09,0x0d,0xc5,0xeb,0x0b,0x4f,0xb7,0xcc,0xbe,0xd1,0x3b,0x11,
+0x12,0x1b,0xeb,0x41,0xf1,0x64,0x58,0x73,0x83,0x02,0x25,0x1e,0xcb,0xec,0xa9,0xf1,0xf6,0x28,0x00,0xc1,0x2e,0xb9,0x61,0x2e,0x4d,0x90,0x49,0x14,0x95,0x58,0x31,0x38,
+0x18,0xb0,0x49,0x03,0x30,0xd8,0x9a,0xb9,0x1e,0x04,0xb5,0x4a,0x1d,0x5d,0x81,0xe9,0xf7,0x0d,0x6d,0x4d,0x6a,0xa0,0x2f,0xc0,0x4a,0x22,0x01,0xf5,0x61,0xa9,0xc9,0x7f,
+0x4d,0x29,0xc2,0x68,0x1d,0xd7,0x0c,0x21,0x46,0xef,0x7a,0xd0,0x7a,0x4f,0xf4,0x54,0x48,0x2e,0xb3,0x89,0xb2,0xce,0x98,0xc4,0x18,0xc5,0xf6,0x94,0xff,0x69,0xc9,0x86,
+0xb2,0x43,0xbf,0xe4,0xf3,0xb1,0xb6,0x3f,0xbd,0xbe,0xea,0x8e,0x7f,0x17,0xb1,0x56,0x8b,0x4f,0x2b,0x9e,0x48,0xf4,0x60,0x40,0xff,0x89,0x74,0x4f,0xd0,0x80,0x96,0x83,
+0x22,0x25,0xc0,0xd0,0xcd,0xa2,0xb4,0x35,0x81,0xd1,0x50,0xef,0x79,0x50,0x67,0xe9,0xe3,0x5c,0x6d,0xc6,0x85,0xb8,0xbd,0x6f,0x55,0x8b,0x6a,0x5b,0x95,0xbd,0xd6,0xd5,
+0xc8,0x5b,0xe3,0xfa,0xed,0xfd,0xe7,0x9b,0x49,0x6b,0xcd,0xf2,0xc4,0x74,0xf5,0x42,0x09,0x3c,0x59,0x16,0xd4,0xf3,0x92,0x74,0x08,0xce,0x04,0x8a,0x36,0xbe,0x2a,0x48,
+0x30,0x63,0x13,0xe8,0xd2,0x7f,0x41,0x47,0xb2,0xe4,0x79,0xc5,0x7e,0x9d,0xc5,0x64,0x94,0x4b,0x02,0x83,0x61,0x15,0x78,0xe5,0x5a,0xfa,0x40,0x1e,0x93,0x84,0x49,0x0d,
+0x5d,0x76,0xdf,0x2f,0x31,0x09,0x8d,0xe8,0xc6,0x98,0x54,0x5b,0x80,0xbc,0x9a,0xdb,0x0c,0xcf,0xe6,0xcc,0x86,0xe6,0xc3,0x33,0xe0,0x48,0x77,0x9c,0x8c,0x55,0x34,0xbb,
+0x7d,0x05,0xf0,0x93,0xf1,0xec,0x16,0xdd,0x3a,0xb6,0x81,0x90,0x99,0x08,0x1d,0x18,0x84,0xc1,0x65,0x7a,0xe8,0x82,0xa3,0x26,0xb2,0x46,0x58,0xda,0x33,0x07,0x15,0x81,
+0x65,0xb2,0xfa,0x14,0x9e,0x0f,0x57,0x66,0x86,0xa1,0x88,0x39,0xf8,0xfa,0x18,0x5d,0x4d,0x2a,0xe7,0x61,0x6d,0x13,0x34,0x8f,0x22,0x0a,0x8a,0x05,0x3e,0x7f,0xe9,0x4c,
+0x3e,0x2f,0xa4,0x2e,0xbc,0x5e,0x51,0x13,0x12,0xef,0xac,0x42,0x81,0xb1,0x30,0xeb,0x5c,0x00,0x16,0x9c,0x25,0xc7,0x38,0x24,0x94,0x16,0xe4,0x18,0xd9,0xa5,0xff,0x94,
+0x48,0x1b,0xff,0x53,0x08,0x52,0x97,0x2b,0x0c,0x06,0xf3,0x06,0xb6,0xc9,0x60,0x81,0x0e,0x47,0x17,0x29,0xf8,0x24,0xf9,0x6c,0x49,0x8f,0x46,0x8f,0x89,0x27,0x33,0x26,
+0xf5,0x37,0x23,0x52,0x70,0x8c,0xa8,0xd6,0x9e,0x69,0xe2,0x28,0x00,0xe1,0x20,0x00,0x51,0x94,0x1e,0x73,0x21,0x76,0x8e,0x4f,0xd8,0xbc,0x4d,0x4e,0xb5,0xd3,0x95,0x12,
+0x40,0x1f,0x7e,0xfd,0xfb,0x52,0x74,0xb4,0xf1,0xf6,0xf8,0x52,0xe5,0x1b,0x47,0x83,0xe9,0x6a,0x80,0xce,0x5b,0x6e,0xa4,0x9d,0x3f,0xd7,0x48,0x68,0x7b,0x91,0xf6,0xf4,
+0x9c,0x2e,0x29,0x44,0x5a,0xe1,0x76,0x21,0x76,0x88,0x4d,0x16,0x6d,0xa8,0x60,0x5f,0x74,0x89,0x82,0x82,0x80,0xda,0x27,0x59,0x10,0x6e,0xa6,0x0e,0x4c,0x6b,0x8e,0xdd,
+0xb1,0x13,0x59,0xb8,0x98,0x93,0x20,0x06,0x00,0xc7,0x0e,0x0a,0x23,0x21,0x6a,0xf0,0x52,0x2a,0x64,0x73,0xe5,0x61,0x60,0x05,0xdc,0xd0,0x9a,0xa7,0x27,0x6c,0xe1,0x36,
+0x85,0xf4,0xf9,0x14,0xa3,0x4d,0xf7,0xfb,0x50,0x3c,0x80,0x9e,0x83,0x30,0x1a,0x5c,0xa5,0x16,0x46,0xef,0x23,0xf3,0xe5,0x12,0x8c,0x8d,0xd7,0x41,0x12,0x46,0xdd,0x2d,
+0xdc,0x5c,0xa8,0x94,0x59,0x87,0xa0,0xb0,0xde,0xd1,0x42,0x32,0xd0,0x91,0xdd,0xae,0x00,0x54,0x58,0x64,0x20,0xc8,0xe3,0xce,0xc1,0x9b,0xab,0x95,0x9d,0x25,0x5f,0x35,
+0x7f,0x04,0x13,0xa6,0xc4,0xc7,0x20,0xe2,0x62,0x2b,0xe2,0xda,0x06,0xa3,0x56,0x28,0xd0,0x24,0xe2,0x32,0x0e,0x41,0xd7,0x57,0x18,0x15,0xab,0xce,0x34,0x3b,0xd4,0x1d,
+0x45,0x84,0xf5,0x68,0x0e,0xca,0x2e,0xa0,0x03,0xf7,0xfd,0xc2,0x85,0x8a,0x80,0x82,0x13,0xdb,0xcc,0xaf,0x0c,0x19,0xb2,0x59,0xbb,0x68,0xa4,0x45,0x88,0x99,0xeb,0x00,
+0x3f,0x89,0xb0,0x44,0x2c,0xc4,0xe1,0xa2,0x18,0x08,0x3c,0x0d,0x0a,0x35,0x32,0xc9,0xfb,0x54,0xad,0xde,0x3c,0x6f,0xd7,0xa4,0x99,0x14,0xaf,0x3c,0x44,0x41,0x2f,0xb1,
+0xa7,0x22,0x88,0x60,0xdf,0xc9,0x30,0x5c,0x28,0x00,0x00,0xc7,0x91,0x8d,0x21,0x3a,0x81,0x7c,0xb5,0xa5,0x95,0xa2,0xef,0x1f,0xbc,0xa3,0x61,0x6c,0xdb,0xd2,0x78,0xe2,
+0x0d,0x42,0x17,0x18,0x89,0x53,0xa4,0xc5,0x10,0xcb,0x10,0xca,0xae,0xf4,0x10,0x5b,0x6c,0xea,0x14,0xe4,0x34,0x71,0xe7,0xe1,0x7f,0x11,0x63,0x13,0xe7,0x1b,0x86,0xaf,
+0x3f,0x4e,0x2b,0x11,0xe3,0x98,0xfe,0xf9,0xd7,0x67,0xac,0x07,0x75,0xa2,0xda,0x1d,0xf9,0x72,0xcd,0xb3,0x6d,0x60,0x94,0x0c,0x66,0xb2,0xd0,0x91,0x11,0x40,0x46,0xb6,
+0x7c,0xe4,0x56,0x71,0x21,0xe5,0x68,0x86,0x88,0x1a,0x14,0x55,0xce,0x12,0xb3,0x76,0x4e,0xff,0xe7,0x8e,0x0d,0xcf,0x66,0x5b,0xa1,0x85,0xd8,0x79,0x6c,0x44,0xcc,0x08,
+0xad,0x1c,0x6d,0x9a,0x86,0xa4,0xd8,0xee,0x45,0x3b,0x32,0x04,0xf1,0xb6,0x5e,0xf4,0x2b,0x62,0x1d,0xfe,0x47,0xf2,0xda,0x34,0x78,0x06,0x80,0xfc,0x81,0x60,0x03,0x88,
+0x50,0xc5,0x5e,0xc7,0x9f,0x9f,0x90,0xf8,0x96,0x6d,0x9a,0x92,0xda,0xc6,0x51,0xf2,0x61,0xaf,0x5d,0x57,0xe2,0x10,0x0f,0x8e,0xe3,0x8f,0xf8,0xf6,0x79,0xff,0xbe,0xf4,
+0x32,0x30,0x7c,0x6a,0xf9,0x5f,0x05,0x6a,0xc2,0x83,0x99,0x14,0xd2,0x04,0xee,0xf9,0x26,0x95,0x0d,0x30,0x9b,0x28,0x43,0x5e,0x0c,0xb7,0xfc,0x91,0x21,0xc2,0x5e,0x82,
+0x4d,0x8f,0xe3,0xef,0xfe,0xa2,0xf1,0xa2,0x34,0xc0,0xb6,0x63,0x5d,0xd5,0x98,0xbc,0xca,0x18,0xa7,0x80,0xdc,0xf0,0x9e,0x69,0x5e,0xe9,0xcb,0x5e,0x2b,0x13,0xf6,0x9c,
+0x5e,0x9c,0x91,0x1f,0x74,0x89,0x49,0xdf,0xa3,0x13,0xff,0xe4,0xdd,0xaa,0x30,0x36,0x75,0x89,0x1b,0x82,0xf1,0x2a,0xcf,0x9f,0xe1,0xa0,0x11,0xbc,0x5b,0x13,0xf3,0x9b,
+0x4c,0x4f,0x7c,0xa1,0x72,0x7f,0x89,0x75,0x7c,0xc3,0x28,0x0a,0xff,0x43,0x59,0x8b,0x2a,0x68,0x41,0xb6,0xe6,0xfd,0xd2,0x63,0x83,0x91,0x66,0x1e,0x88,0x8a,0x24,0xb3,
+0x50,0x66,0x99,0x08,0x9c,0x86,0xa4,0x0f,0x7a,0x88,0xc2,0x65,0x46,0x47,0x12,0x23,0xfa,0x87,0x4b,0x7c,0x7f,0x9c,0x06,0x1d,0x83,0xdc,0x49,0x10,0xfd,0xd1,0xc0,0x6d,
+0x74,0xc4,0x1d,0x5c,0xc7,0xe9,0xf1,0xe8,0xac,0x73,0x1f,0x2e,0xe1,0x36,0x44,0x49,0x84,0x00,0x8c,0x85,0xb6,0x70,0x1a,0x34,0x1d,0xba,0xe3,0xa8,0x3f,0xa0,0xcc,0xc6,
+0x79,0xa5,0xef,0x5f,0x63,0x42,0xac,0x00,0x14,0x89,0x47,0xbf,0xdd,0xd1,0x90,0x34,0xa2,0x0f,0x5b,0x0a,0x0f,0x08,0xf8,0xdc,0x2f,0xb9,0x56,0x8f,0xcf,0xe4,0x8a,0xa7,
+0xaa,0x7f,0xbc,0x64,0x37,0xe6,0x9d,0x6c,0xd6,0xf5,0x73,0x0c,0x9f,0x79,0xf9,0xa2,0xba,0x4d,0x3e,0xcc,0x5d,0xb8,0xf2,0x88,0xf3,0xbb,0x23,0xc3,0xd8,0x60,0xdb,0x30,
+0x40,0x9f,0xd0,0x0f,0x4c,0x03,0x98,0x01,0x71,0xd7,0x99,0xaf,0xf0,0x3f,0x0b,0x13,0x52,0x53,0x8c,0xe6,0x42,0xe3,0x48,0x06,0x75,0xe8,0xc3,0x25,0x8e,0xc1,0x2f,0x03,
+0x13,0x1a,0xb9,0x4a,0x6c,0x5f,0xac,0xe2,0x8b,0xf6,0x57,0x70,0x50,0x04,0x9f,0x52,0x38,0x65,0x08,0x34,0x63,0x26,0xdb,0xe6,0xff,0xcd,0xca,0xf3,0x4d,0x84,0xc4,0x61,
+0xcb,0xca,0x56,0xf0,0x6f,0x5b,0x74,0xbe,0x89,0xa9,0x03,0xff,0x66,0x8c,0x8e,0x79,0x65,0xdc,0x19,0x3f,0x91,0xbf,0xa8,0xe8,0x02,0x7b,0x82,0x55,0x73,0xe2,0xda,0x1a,
+0x39,0x4b,0x8c,0x6e,0x14,0x94,0xda,0xc0,0xd7,0x39,0xaa,0x58,0x7d,0x3c,0x80,0x34,0x46,0x1f,0x9a,0x3a,0xbd,0x3d,0x00,0xf4,0xfe,0x35,0x82,0x85,0xb8,0x3f,0xc9,0xa5,
+0xc8,0x4d,0x3c,0x4c,0xf4,0xe4,0x56,0xea,0x75,0x55,0x62,0xd4,0x48,0x37,0xf5,0xfe,0xcb,0xf1,0x31,0x1b,0x2a,0x07,0x88,0x72,0x7f,0x3b,0x39,0xb8,0x00,0x6d,0x55,0xe1,
+0x18,0x6c,0xac,0x68,0x22,0xd5,0x6a,0xcd,0x7e,0xca,0x4e,0xa6,0xc6,0x69,0x4d,0xa0,0x6e,0xbb,0xbb,0x44,0xe1,0x83,0xa3,0x3f,0x19,0x05,0x01,0x17,0xf5,0x87,0x9e,0x89,
+0xa1,0x3e,0xa0,0xc7,0x59,0x36,0xb4,0x6c,0x5c,0x26,0x6a,0x68,0x5d,0x07,0xc5,0xe4,0x04,0xb6,0xa3,0x61,0xe5,0x6e,0xda,0x1e,0xa5,0xca,0x8d,0xb4,0x07,0x69,0xe8,0x98,
+0x44,0x1d,0x7b,0x89,0x3b,0xd9,0x95,0x81,0x3b,0x0e,0xe6,0x94,0x2a,0xb0,0xf8,0xdd,0xec,0x96,0x17,0x10,0xe0,0x88,0xba,0x16,0xb5,0x1d,0xd0,0x4e,0xd5,0xa7,0xd8,0x34,
+0x46,0x75,0x96,0xb6,0x14,0x60,0x1b,0x31,0xfa,0x01,0x35,0x0f,0x2e,0xe1,0x0a,0xb5,0xd8,0x57,0xcd,0x85,0xb7,0xb1,0x54,0x3d,0x0f,0x54,0xdf,0x6a,0x27,0xc9,0xaa,0x72,
+0x89,0xff,0x42,0x6e,0x78,0xaf,0x47,0xbd,0x9e,0x72,0x5d,0xa1,0x80,0x02,0x14,0x59,0x92,0x85,0x11,0x30,0x0b,0x1d,0x6e,0x2b,0xda,0x8c,0xdc,0xda,0x2b,0x1d,0x38,0xcf,
+0x9b,0xaa,0x79,0x6e,0x30,0x7f,0x1e,0xe1,0x26,0x06,0x23,0xe9,0x8c,0x67,0xca,0xb7,0xb4,0x31,0x9f,0x74,0x11,0x93,0xa5,0x3f,0xfd,0x08,0x35,0x14,0x71,0x22,0xc7,0x09,
+0x4b,0x01,0x21,0x87,0x1c,0x84,0x6a,0x4a,0x00,0x49,0x33,0x47,0x84,0x8d,0x07,0x2c,0x8a,0xea,0x52,0xbe,0x7c,0x4c,0xef,0x96,0xab,0xf0,0xb1,0xbf,0xad,0x98,0x0f,0xd7,
+0x8e,0x18,0xc9,0x16,0xb7,0x1a,0x88,0xee,0xad,0x77,0xa6,0xa1,0xa1,0x3c,0x24,0x42,0xd4,0xa7,0x52,0xe8,0xf8,0xee,0x30,0x6a,0x53,0xa9,0x4a,0x7d,0xa3,0x82,0x03,0x72,
+0x30,0x00,0xc9,0x0e,0x55,0xc8,0xb3,0x23,0x81,0x72,0x18,0xca,0xd2,0x58,0x23,0x76,0x68,0x7d,0xed,0xc1,0x65,0xb6,0x3a,0x55,0x99,0x0b,0x6b,0x39,0xf0,0x58,0x47,0x11,
+0x94,0x1c,0xbc,0xb3,0xf7,0x6f,0x4b,0x7a,0xf8,0xaf,0xdf,0x17,0x67,0x7d,0x77,0xe2,0x37,0x7c,0xe5,0x3b,0xa9,0x01,0x7a,0x08,0x44,0x65,0x62,0x40,0x8c,0x02,0x82,0x73,
+0xe2,0x89,0x81,0x33,0x2f,0xa6,0xdf,0x08,0xb0,0x56,0xe2,0xfe,0x84,0x18,0xd6,0xda,0x26,0xda,0xdc,0x65,0xc9,0x6c,0x34,0x61,0x62,0x10,0xec,0x34,0xe1,0xe2,0x76,0x64,
+0x58,0x2e,0xdc,0xe5,0x1b,0x44,0x8c,0x12,0xe0,0xf3,0xc2,0x70,0x5a,0x84,0x15,0xab,0x9b,0x16,0x62,0x07,0xdd,0x69,0xb5,0xa8,0x15,0x98,0xcb,0x70,0x6d,0x25,0xeb,0xd0,
+0xbb,0x33,0x21,0x9d,0x35,0x2b,0x59,0x0e,0x43,0xe4,0x61,0x32,0x50,0x5b,0xa6,0x10,0x59,0xed,0x87,0x07,0xa0,0x78,0xef,0x9e,0x88,0x29,0x79,0x88,0xa8,0xd4,0x44,0xed,
+0xe3,0x71,0xf0,0x3d,0x4c,0xcb,0xae,0x5d,0x14,0x72,0x01,0x19,0x76,0x8c,0x1b,0x96,0xdf,0x4a,0xdb,0x18,0xd4,0x3d,0x8e,0x1e
+};
+const size_t WM_PK_OTA_JS_BR_LEN = 4312;
+#else
+const uint8_t WM_PK_OTA_JS_BR[] PROGMEM = { 0 };
+const size_t WM_PK_OTA_JS_BR_LEN = 0;
+#endif
+const uint8_t WM_PK_MODULE_POLYFILL_JS_BR[] PROGMEM = {
+0x1b,0xce,0x02,0x00,0x64,0xd3,0x9c,0xfb,0x2f,0x13,0x5d,0x12,0x45,0xc7,0xcc,0x9f,0x28,0x3b,0xc9,0xb0,0x74,0xb9,0x05,0x41,0xb7,0x9d,0xd2,0xa6,0xbf,0x77,0x77,0x1f,
+0x3f,0xa8,0xad,0xb5,0x2a,0x5a,0x9b,0xba,0xa8,0x7b,0x14,0x06,0x38,0x41,0xba,0xc0,0x53,0x88,0xb2,0xa9,0x6b,0xaa,0x91,0x38,0xca,0x23,0xf2,0x5c,0x47,0x62,0xdc,0xcb,
+0xf7,0xab,0xfc,0xe5,0x5c,0x6a,0x27,0x89,0x58,0x88,0xec,0x1b,0x20,0xce,0xf1,0xb8,0xb5,0x52,0x5b,0x4b,0x98,0x46,0xa3,0xc4,0xad,0xb3,0x77,0xe9,0x08,0x8e,0xf9,0x6b,
+0xea,0x0b,0x20,0x6a,0xb6,0x82,0x3c,0x5d,0x32,0x3a,0x1b,0x69,0xe7,0x92,0x3a,0x84,0x95,0x0b,0xaf,0x65,0x7f,0xc9,0x9b,0xe3,0x91,0x98,0x87,0x03,0x20,0x8f,0x0f,0x74,
+0x1e,0xe1,0x89,0x3e,0x06,0x54,0x6a,0xcf,0xf1,0xb3,0x73,0xf7,0x5e,0xdb,0x87,0x18,0x5a,0x75,0x23,0xa3,0xca,0xf2,0xd7,0x13,0xec,0x97,0x94,0x1a,0x4b,0xe8,0x19,0xd7,
+0x9e,0x08,0x94,0x0d,0x0d,0xe4,0x02,0xa8,0x51,0x87,0x4d,0xf3,0x9c,0xf4,0xe6,0xfe,0x12,0x62,0xb1,0x4c,0xb9,0xea,0x5b,0x43,0x42,0xe8,0xef,0x96,0x4f,0x47,0x23,0xe3,
+0x17,0x03,0x88,0x2c,0x44,0x38,0x1e,0xd0,0xe8,0x9f,0x18,0x3d,0x3b,0x05,0x93,0x7e,0x5d,0xbe,0x5b,0x74,0xe7,0xd3,0xf2,0xee,0x6a,0x8e,0xf1,0x36,0xfc,0xa7,0xb6,0x02,
+0x65,0xa7,0xa0,0x52,0xe9,0xe5,0xf7,0x1f,0xa4,0x67,0xca,0x9f,0x96,0x7a,0xcb,0xea,0xf7,0x68,0x84,0x9e,0x73,0x2c,0xd2,0x92,0xa6,0xca,0xed,0x82,0x4f,0x82,0x42,0xf5,
+0x0f,0xb1,0x4f,0x8a,0x1e,0x6a,0x89,0x61,0x0b,0x9f,0x5c,0x85,0x06,0xf5,0xcf,0xf7,0x12,0x67,0x3e,0xc7,0x10,0xcf,0xd5,0xf4,0x58,0x60,0xe5,0x99,0x65,0x08,0xe0,0x03,
+0x0c,0x0b,0x6b,0xaa,0xcd,0x0e,0xdb,0xc5,0x97,0x93,0xd5,0xf3,0x90,0x00,0xdd,0x6d,0xf8,0x19,0x62,0xae,0x60,0xea,0xff,0x81,0xc8,0x86,0x54,0x4c,0x5b,0x42,0xe5,0x78,
+0x6d,0x1b,0x94,0x51,0x4a,0x77,0xde,0xa6,0x88,0x2d,0xe5,0xff,0x59,0x8a,0xd5,0xef,0x50,0x79,0x97,0x63,0x9a,0x7a,0xfa,0x1f,0x90,0x01
+};
+const size_t WM_PK_MODULE_POLYFILL_JS_BR_LEN = 346;
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_RESTART_JS_BR[] PROGMEM = {
+0x1b,0x8f,0x09,0x00,0x8c,0xd4,0x58,0xcd,0xce,0xc1,0xce,0xe5,0xea,0xf5,0x3d,0xa7,0xe4,0x8a,0xae,0x33,0xcb,0xf9,0xd7,0x7f,0x26,0xb0,0x0d,0x2b,0x43,0x03,0x9c,0x36,
+0xed,0x13,0x85,0x9b,0xb5,0x47,0x63,0x33,0x23,0xa1,0x11,0x0a,0x25,0x13,0x0a,0x31,0x9f,0xfd,0xe3,0x33,0xd5,0xbb,0x89,0x7b,0xa4,0xb1,0xba,0xa5,0xe5,0x36,0x1d,0xd2,
+0x6c,0x7b,0x17,0x0e,0x69,0x43,0x60,0xa2,0x18,0xee,0xaf,0xaf,0x9b,0xe8,0xde,0xd7,0xe7,0x39,0x5b,0xc2,0xd7,0x59,0xe6,0x6b,0x51,0x07,0x7f,0x72,0xa7,0x10,0x04,0xcc,
+0xbe,0x18,0x09,0x2a,0xe6,0x98,0xd4,0x7c,0xbc,0x57,0xb2,0x7e,0x1b,0xe0,0xa3,0x11,0x05,0xb3,0x63,0xcc,0x62,0xed,0x7f,0x01,0x34,0x69,0x16,0x52,0xd6,0x54,0x1e,0x49,
+0xcf,0x2c,0x73,0xc1,0xfd,0xcb,0x79,0x88,0x54,0xd0,0xd1,0x93,0xc3,0xbc,0xa1,0x83,0xd8,0xa8,0x19,0xa2,0x1c,0xe3,0xb8,0xfe,0x62,0xe9,0xdd,0x85,0xaf,0x6c,0xf8,0x64,
+0x94,0xfc,0x06,0x84,0x85,0x50,0x66,0x1a,0xb9,0x35,0x6d,0x7f,0xb7,0x06,0xfa,0x87,0xe5,0x2e,0x56,0x73,0x3d,0xbd,0x73,0x00,0x29,0xd5,0x7c,0xc1,0xd2,0x2d,0xbd,0xf4,
+0x0a,0x43,0xd1,0xb0,0x09,0x98,0xb6,0x29,0x0d,0x1d,0xf6,0x69,0x62,0x6e,0x03,0xa2,0x4f,0x34,0x72,0x68,0xa4,0xf1,0x40,0xbf,0x4b,0x7e,0x6d,0x1a,0x1d,0x24,0x84,0xcc,
+0xff,0x5b,0x8f,0x6a,0xa5,0xa6,0xb5,0x56,0xb2,0xe6,0x6a,0x44,0xe1,0x80,0x1a,0x59,0x46,0x15,0x48,0x6e,0xc7,0x39,0x1d,0x57,0xc7,0x48,0xee,0xc3,0x89,0x53,0xe0,0x04,
+0xa0,0xf5,0x8e,0x2d,0x3e,0xcd,0x87,0x19,0x5b,0x1c,0x70,0x11,0x30,0x14,0x0f,0x59,0x89,0x2d,0x68,0xad,0xe2,0x3a,0x30,0xf2,0xb8,0xed,0xe4,0xfe,0x0f,0xae,0xa5,0x79,
+0x4b,0x43,0x57,0x57,0x62,0x87,0x95,0xa8,0x49,0xb1,0xbc,0x7f,0x57,0x0d,0xc6,0xd2,0xf9,0x86,0xf6,0x43,0xde,0xb1,0xc9,0x4d,0xe7,0x5c,0x74,0x6a,0x3a,0x99,0x19,0x60,
+0xe1,0x37,0x05,0xd2,0x32,0x2e,0xff,0x4a,0x88,0x4a,0x33,0x00,0xf6,0x9a,0x36,0x79,0xe6,0xae,0x52,0x7e,0xf9,0x13,0x4b,0x3a,0xf1,0x14,0x6c,0x01,0x86,0x7a,0x3a,0x91,
+0x12,0x86,0x45,0x23,0x21,0x7f,0x41,0x96,0xe2,0x4f,0x07,0xb0,0x86,0xe6,0xbd,0xf5,0x69,0x55,0xc0,0x52,0xbc,0xea,0x07,0x48,0x29,0xf6,0xec,0x58,0xca,0xc7,0x90,0xc8,
+0x28,0xd7,0x14,0x67,0x59,0x78,0x33,0x47,0xc0,0x8c,0x24,0x30,0xb6,0x36,0x57,0x9b,0xf7,0x57,0xfe,0x7c,0x06,0xb5,0x04,0x6c,0x1c,0xa6,0xc5,0x5c,0xe8,0x08,0xc6,0xbb,
+0xe5,0x89,0xbb,0x15,0x26,0xcb,0x79,0x5e,0xc6,0x55,0xb0,0xab,0x02,0xe2,0x90,0xa6,0x3d,0x01,0x56,0x60,0xda,0xce,0x5e,0x52,0x40,0x6d,0x45,0x3b,0x66,0x5e,0x55,0x67,
+0x92,0x4b,0xc2,0xe5,0x84,0x12,0xe7,0xae,0x72,0x17,0x43,0xbc,0x53,0x90,0x50,0xc8,0x3c,0x38,0xbb,0x30,0xfc,0x11,0x53,0x4e,0x78,0xad,0xc8,0xb2,0x4f,0x11,0x28,0x43,
+0xee,0xd2,0x24,0x95,0xca,0xc7,0x5e,0x2f,0x27,0x21,0xe3,0x5b,0x2f,0xe4,0x30,0x39,0x8e,0x36,0x32,0xd0,0x50,0x45,0xfc,0xd3,0x71,0xb4,0x8b,0x8c,0x4b,0x97,0xd0,0xda,
+0xea,0xbc,0xae,0x71,0xe1,0xfb,0x41,0x24,0x8b,0xf8,0xd5,0xad,0xab,0x59,0xb1,0x88,0x48,0xf9,0xeb,0x14,0x78,0xa5,0xfd,0xb6,0x54,0x3d,0xa1,0xae,0xda,0x27,0x72,0x34,
+0x9b,0xc7,0xcd,0xdb,0x7f,0x47,0x36,0xb9,0xa9,0x73,0x11,0xbb,0x0d,0xd9,0xc8,0x5a,0x96,0xfc,0x6e,0x35,0x5c,0x10,0x92,0xc7,0x82,0xd8,0x01,0x90,0x2a,0x65,0x47,0x27,
+0x86,0xb3,0x25,0x6d,0x84,0x2d,0xb7,0x75,0x0b,0x7f,0xbd,0x4f,0x64,0x2b,0x38,0x91,0xf6,0xb3,0x82,0xf7,0xbe,0xd4,0xdd,0xfb,0x6c,0x8c,0x95,0xac,0x8f,0xc2,0x23,0x18,
+0xef,0xc2,0x57,0xc7,0x5e,0xc5,0x3b,0x55,0xc2,0x8e,0x21,0x50,0xa1,0xd4,0x54,0xcb,0xd8,0x9e,0x8a,0x02,0x04,0xd9,0xed,0x06,0x42,0xf9,0x66,0x32,0x55,0x03,0x0d,0xd5,
+0x5c,0xe1,0x62,0x79,0x8c,0xbc,0xa1,0xa2,0xd0,0x1b,0x8a,0xcf,0xd5,0x29,0x7a,0x40,0x6b,0xe6,0x6e,0x7e,0x79,0x2d,0xcd,0x52,0xb6,0xae,0xc3,0xab,0xc1,0xec,0xc0,0x26,
+0x37,0xb6,0x12,0x6b,0xda,0xb6,0xb6,0x2f,0xa9,0xa0,0xc7,0xff,0xa8,0x30,0x44,0x73,0xe3,0x56,0xc0,0xab,0xfe,0xa8,0x8e,0x73,0xa2,0xe2,0x2e,0x2e,0x7c,0xc3,0x1d,0x7e,
+0x5a,0x25,0xd4,0x49,0x62,0x5d,0x60,0xae,0x5f,0xa4,0x54,0x56,0x3c,0x91,0x79,0x5f,0x7d,0x1e,0xc0,0xcf,0xab,0x83,0xb9,0x54,0x0e,0x07,0xb4,0xb6,0x74,0x8e,0xe5,0x4e,
+0x86,0x10,0x3f,0xbd,0x8d,0xb5,0x21,0x0c,0x64,0x78,0x68,0x2b,0xd0,0xea,0xa0,0xbf,0x1c,0x2e,0xb6,0xad,0x54,0xad,0x67,0x1d,0x32,0x26,0x74,0x2b,0xbf,0xb6,0x70,0x21,
+0xaf,0xd2,0xa4,0x9d,0xfe,0xea,0xd7,0xd4,0xaf,0xc9,0x2d,0x85,0xff,0xca,0x8b,0x73,0x2b,0x69,0x77,0x42,0xe9,0x57,0x0b,0x85,0x33,0x6e,0xfd,0x83,0x00,0x7d,0x5f,0x2b,
+0x29,0xe5,0x86,0x0c
+};
+const size_t WM_PK_RESTART_JS_BR_LEN = 804;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_RESTART_JS_BR[] PROGMEM = {
+0x1b,0x8d,0x09,0x00,0xac,0x8e,0xb7,0xa1,0x61,0xb6,0x88,0x9d,0x14,0xa1,0x72,0x69,0xa8,0x7a,0x63,0x3e,0x29,0x16,0x31,0x94,0xf6,0x52,0x97,0x55,0xad,0x82,0xb2,0x26,
+0xd6,0x1a,0x72,0xa8,0x8d,0x82,0x35,0x7e,0x07,0x64,0xd8,0x38,0x0a,0x48,0x16,0x04,0x3d,0xd7,0x57,0x3f,0x81,0x0d,0x38,0x86,0x8c,0x87,0x61,0x81,0x09,0x87,0x33,0x05,
+0x47,0xaf,0x4f,0x14,0x6e,0xd6,0xb6,0x1b,0x1b,0x19,0xdc,0xec,0x9b,0x8b,0x39,0x1a,0x73,0xdb,0x10,0x0d,0x8d,0x50,0x56,0x32,0xa1,0x10,0xf3,0xe9,0xa3,0x62,0xf7,0x88,
+0x7b,0x5c,0x1b,0x95,0x25,0x42,0x24,0x36,0x54,0xd4,0x39,0xc2,0xab,0x64,0x48,0x64,0x39,0xed,0xc6,0x2d,0x59,0x94,0x11,0xdd,0x8d,0xf9,0x37,0xae,0x6f,0x9e,0x2e,0x62,
+0xd4,0x1c,0xd6,0x05,0xd2,0xd6,0xa2,0x09,0xfe,0x64,0x4e,0x34,0x34,0x22,0x25,0x55,0xa2,0x88,0x39,0x2a,0x0c,0x6d,0x93,0x95,0xf9,0x6d,0x00,0xe6,0x73,0x81,0x6a,0xc7,
+0xa8,0xbb,0x27,0x7a,0x47,0xd0,0xe4,0x49,0x97,0x0a,0x54,0xe6,0x91,0xf0,0x2c,0x90,0x26,0xe8,0x20,0xb5,0x10,0xa9,0xa0,0x63,0xc3,0x0f,0xb2,0x86,0x5e,0x62,0x63,0x6a,
+0x88,0x62,0x8c,0xfd,0xfa,0x4d,0x86,0xa6,0x37,0x2f,0x51,0xc1,0x72,0x1e,0xe8,0x19,0x63,0x21,0x94,0x99,0xaa,0x64,0x8d,0xef,0xec,0xb0,0xc6,0x72,0x13,0xab,0xa1,0x5e,
+0xed,0x14,0x20,0xa5,0x35,0x4c,0x58,0xca,0xea,0xa9,0x57,0x28,0x8a,0x86,0x67,0x63,0xc3,0x36,0xb7,0x86,0x0e,0xdb,0x34,0x31,0x8e,0xc6,0x5a,0x0a,0x34,0x72,0x68,0x5e,
+0xe3,0x81,0xba,0x25,0xbe,0x36,0xcd,0x5f,0x12,0x42,0xea,0xff,0x5d,0xcf,0xf3,0xaa,0x5a,0xe5,0x75,0x55,0xe6,0x50,0xcd,0x05,0xbe,0x50,0xa3,0x40,0x52,0x05,0x92,0xdb,
+0x71,0x7d,0xed,0x57,0xc7,0xbc,0xdc,0xe3,0xc3,0x29,0xb0,0x02,0x50,0x7b,0x07,0x83,0xe2,0x6b,0xc6,0x16,0x1b,0x77,0xc6,0x9a,0x44,0x98,0x95,0x31,0x07,0xd5,0x56,0x50,
+0x3b,0x46,0x16,0xb7,0x9d,0x9e,0x3e,0xe0,0x5a,0x1a,0x99,0x84,0xae,0x29,0xb9,0x09,0x2b,0x61,0x15,0x5c,0x6a,0xbe,0xcb,0x0e,0x17,0x65,0x4f,0x83,0xd8,0x14,0x79,0xc7,
+0x73,0x1c,0x26,0xe3,0xc2,0xab,0x56,0xcb,0xb5,0x07,0x2c,0x7c,0x33,0x20,0x2d,0x83,0xb2,0x2f,0x21,0x2a,0x4f,0x02,0xb0,0x57,0x8d,0x81,0xa4,0xb9,0x46,0xf8,0xe5,0xce,
+0xa6,0x70,0xe2,0x2a,0xd8,0x82,0x0c,0xf5,0x74,0x59,0x96,0x58,0x2c,0x16,0x09,0x91,0x93,0x95,0xc1,0xbd,0x4d,0x00,0x6b,0x18,0x9a,0xd1,0xa6,0x55,0x01,0xcb,0xf0,0xaa,
+0x2b,0x20,0x23,0xd8,0xb1,0x63,0x29,0x2c,0x20,0x51,0x56,0x81,0x44,0xc3,0x59,0x3e,0xbc,0x79,0x4b,0xc0,0xeb,0x49,0xca,0xc2,0x37,0x5f,0xed,0xdd,0x5f,0xf9,0xa0,0x08,
+0x6a,0x71,0xd8,0xf3,0x9a,0x16,0xef,0x44,0x47,0xac,0xdb,0x2d,0x0f,0xdc,0xad,0x58,0x59,0x6a,0x79,0x19,0x54,0xce,0xae,0x0a,0x88,0x43,0xb5,0xd8,0x70,0x64,0x05,0xa6,
+0xed,0x82,0x4b,0x0a,0xa8,0xcd,0xc4,0xc4,0xcc,0xab,0x6a,0x99,0x14,0x86,0x91,0xcb,0x39,0xe2,0xdc,0x55,0x6c,0xc5,0x10,0xef,0x44,0xe5,0x70,0x30,0xd3,0x13,0xc3,0x89,
+0x21,0x27,0xbc,0x56,0xa4,0xd9,0xa7,0x08,0x85,0x21,0x77,0x59,0x92,0xca,0x8d,0xef,0x5e,0x2f,0x1f,0x21,0xe3,0x9a,0x5e,0xc8,0x61,0xf2,0x1e,0x6d,0xa4,0xa0,0x21,0x73,
+0x7a,0x1d,0x27,0x26,0xcf,0x38,0x75,0x09,0xad,0xad,0xce,0xea,0x9a,0xde,0xbc,0x4e,0xc6,0x2c,0x82,0xbf,0x5b,0xd7,0xb2,0x62,0x11,0x1f,0xcb,0xfd,0xa7,0xc0,0x2b,0x3d,
+0xb7,0xa5,0xea,0x17,0xea,0xaa,0xfd,0xc5,0x8f,0x6b,0xf3,0xb8,0xa3,0x0f,0xce,0x78,0x8e,0xc3,0xdf,0x5d,0xdc,0x77,0x94,0x88,0x05,0xfa,0x5a,0x6a,0x42,0x72,0xaf,0xcd,
+0xd7,0xd9,0x4d,0x30,0x4d,0x4f,0xd6,0xd0,0x49,0x86,0xf9,0x9f,0x04,0x19,0x2d,0x36,0x2c,0x54,0x13,0x27,0x8c,0x15,0xc6,0xdb,0xca,0xd0,0xd7,0xfb,0x8b,0x33,0x6f,0x94,
+0xf6,0xf3,0x64,0xbf,0x5b,0xd2,0xf6,0xbf,0xd6,0x69,0x63,0x29,0xeb,0x23,0xf1,0x88,0x75,0xbb,0xf4,0xab,0x6b,0xaf,0x8c,0x76,0x26,0x85,0x1d,0xc3,0x31,0x43,0x99,0xaa,
+0x96,0xb2,0x3d,0x95,0x40,0x08,0xb2,0xe1,0x0d,0x1c,0xcc,0x93,0x99,0x1c,0xe8,0x11,0xcd,0x19,0x2e,0x33,0x87,0x91,0x37,0x64,0x02,0x29,0xca,0x9a,0xab,0x53,0x40,0xb4,
+0x96,0x7d,0xa3,0x3c,0x1c,0x2f,0x8d,0xa5,0x82,0x3c,0x0f,0xaf,0x06,0xb3,0x03,0xcf,0x71,0xd0,0xd9,0x68,0x4d,0x5b,0x5a,0xb7,0x4b,0x2a,0xc4,0xc9,0x80,0x06,0xc5,0xbf,
+0xa1,0x27,0x36,0x1b,0x03,0xb5,0x86,0xee,0x1b,0x00,0xe0,0x02,0xee,0xd2,0x9b,0x57,0xb0,0x83,0x56,0x09,0x74,0x1a,0x63,0x5d,0x40,0x6e,0x2f,0x92,0x28,0x2b,0x7e,0xf1,
+0x5a,0x5f,0x7d,0x14,0x80,0x57,0x07,0x73,0xc9,0x1b,0x8a,0xb3,0xb6,0x70,0x61,0xd3,0x4e,0x0a,0x10,0xef,0x4e,0xc7,0xda,0xf0,0x05,0x0d,0x17,0x6c,0x85,0xd5,0x32,0xa8,
+0xcf,0xe1,0xa4,0x1b,0x95,0xa6,0xe1,0x59,0x47,0xca,0x91,0x6e,0x45,0x69,0xb0,0x90,0x55,0x79,0xbc,0x31,0xfd,0x95,0x12,0x14,0xb5,0xe5,0xda,0x41,0x11,0xed,0x91,0x2e,
+0xc5,0xf4,0x31,0xe9,0x57,0x93,0xc0,0xaf,0x6d,0xfd,0x43,0x01,0x6d,0xf2,0xca,0xb2,0x9c,0xc5,0x00
+};
+const size_t WM_PK_RESTART_JS_BR_LEN = 851;
+#else
+const uint8_t WM_PK_RESTART_JS_BR[] PROGMEM = { 0 };
+const size_t WM_PK_RESTART_JS_BR_LEN = 0;
+#endif
+const uint8_t WM_PK_HW_STATUS_JS_BR[] PROGMEM = {
+0x1b,0x9f,0x02,0x20,0x8c,0xd4,0x59,0x2d,0x39,0x37,0x23,0x24,0xe9,0xb4,0x68,0x5b,0x9d,0xd2,0x3e,0x0d,0x87,0x68,0x5c,0xc4,0x4a,0x14,0x91,0x17,0xaf,0xa6,0xa7,0xf9,
+0x3f,0x17,0x0d,0xcc,0x07,0x1a,0x9d,0x14,0x09,0xb2,0x3f,0x4a,0x1a,0xc6,0x85,0xf1,0xbd,0x8b,0x83,0x4e,0xdd,0xb3,0x8b,0xd7,0xa8,0x00,0x02,0xe5,0x99,0x53,0x43,0xdc,
+0xe2,0xcd,0x22,0x3f,0xc9,0x98,0xb5,0xe1,0x68,0x69,0xc4,0xae,0x9d,0x8d,0x97,0x90,0x13,0xff,0xb6,0xcd,0xad,0xea,0x79,0xa8,0xd7,0xc3,0xad,0x5f,0x76,0xff,0x14,0x94,
+0x82,0x71,0x8a,0x8b,0x26,0x22,0xc5,0xb3,0x20,0xb3,0x67,0xf7,0x3a,0xae,0x19,0xfd,0x09,0x35,0x04,0xd7,0xcd,0xde,0x0c,0x3c,0x64,0x17,0xc5,0x41,0xff,0x94,0xaf,0x37,
+0x99,0x38,0x24,0x30,0x77,0x61,0xe1,0x99,0x12,0x6c,0x1f,0xd6,0xb8,0x3d,0x6d,0xb8,0x6e,0xe2,0xb2,0xd5,0xdf,0x8f,0x88,0x12,0x3f,0xb2,0x6d,0x5b,0x63,0x5f,0x4e,0x49,
+0xe9,0x07,0x2e,0x89,0x49,0x6a,0x29,0x48,0x19,0xc3,0x8c,0x31,0x6b,0x72,0x63,0xc7,0xf0,0x12,0xf1,0x82,0x8f,0x5f,0x8f,0xe2,0xe4,0x65,0x79,0xb9,0xdf,0x9a,0x9a,0xc5,
+0x70,0x70,0x72,0xa7,0x1b,0x74,0x13,0x87,0x01,0x32,0x8e,0xfb,0x23,0xa1,0xe9,0x6d,0x80,0xa2,0x0b,0x3b,0xd8,0x1a,0x0d,0x16,0x47,0xe5,0xc1,0xea,0x45,0x7b,0x3c,0x07,
+0xe2,0x35,0xa0,0x95,0x04,0x8d,0xf0,0xf8,0xf7,0x03,0x98,0x08,0x0d,0xdf,0xe0,0x44,0xac,0x21,0x89,0x63,0x5c,0x6f,0xce,0x1c,0x83,0x8b,0x1c,0x58,0x98,0x41,0x06,0x50,
+0x26,0x8a,0x01,0x08,0x30,0xf9,0xf4,0xcf,0x79,0x87,0xeb,0x43,0x86,0x61,0x1e,0x48,0x14,0xf6,0x5f,0x0a,0xc9,0x50,0xcd,0x4f,0x7e,0x17,0x88,0xca,0x5a,0xfc,0x8f,0x9b,
+0x5a,0x4a,0xfc,0x54,0x26,0x2d,0x09,0xce,0x02,0x7f,0x40,0x94,0xf2,0x0f,0x4d,0x96,0x2d,0x7a,0xe0,0x05
+};
+const size_t WM_PK_HW_STATUS_JS_BR_LEN = 308;
+const uint8_t WM_PK_JSTZ_JS_BR[] PROGMEM = {
+0x1b,0xd8,0x14,0x20,0x9c,0x05,0x76,0x8b,0xdb,0x55,0x1e,0x57,0x97,0xa6,0x6f,0x13,0x31,0x2d,0x63,0x3c,0x22,0xf9,0x7e,0xd3,0x92,0x1f,0x41,0x41,0x2e,0x69,0xde,0xb4,
+0xce,0xc2,0xc2,0x82,0x62,0x30,0xef,0xaf,0xad,0xf5,0xc8,0x45,0xba,0x48,0x9a,0xed,0x67,0xe9,0x64,0xce,0xd1,0x2c,0xdc,0x92,0xbb,0x6b,0xff,0xfb,0x15,0xcb,0x14,0x4a,
+0x62,0x21,0x61,0x20,0x19,0x9c,0xd7,0xda,0x19,0xf2,0x8c,0x43,0xdd,0x15,0xf0,0xaf,0x6d,0xa8,0x34,0x66,0x6b,0xc3,0xe3,0xec,0x92,0x1e,0x65,0x4a,0x90,0x2f,0x10,0x4c,
+0x2d,0x41,0x1c,0x8e,0xf4,0xf8,0xb5,0x6f,0xf5,0xed,0x3f,0x45,0x2d,0x91,0x4c,0x42,0xfd,0xb7,0xe0,0xf1,0x42,0x25,0x44,0x12,0xf3,0x77,0xde,0x9c,0x8a,0xcd,0x1b,0x6c,
+0xf7,0x61,0x9e,0xdc,0xd2,0xa1,0x96,0x88,0xd1,0x2a,0x25,0xa0,0x31,0xda,0x8c,0x0f,0xab,0x38,0x22,0x37,0x0c,0xec,0x29,0x91,0x9f,0x46,0x71,0xe1,0x0b,0xab,0x3f,0x5c,
+0xff,0x06,0x3d,0xf3,0xdb,0x78,0x88,0xba,0x6b,0x78,0x09,0xca,0xfa,0x7a,0x23,0x69,0xb0,0xc7,0xab,0x67,0x9b,0xce,0x08,0x24,0x04,0xd2,0xfb,0x8b,0xc2,0x51,0x04,0xd5,
+0xc4,0x04,0x8e,0xac,0xf5,0xe4,0x5f,0x7f,0xec,0xfe,0x98,0x15,0x75,0x04,0x62,0x4d,0x81,0x65,0xc6,0xd0,0x33,0x87,0x28,0x3d,0x86,0x55,0xc5,0xa7,0xf9,0x19,0xbf,0xb7,
+0xf0,0x4d,0xc6,0x95,0x92,0xa3,0x06,0x66,0xf2,0x1b,0xb9,0x1c,0xf9,0x4e,0xe5,0x92,0xa3,0xbf,0xb4,0x60,0x8f,0xa2,0xad,0xff,0xa0,0x98,0x19,0xb1,0x83,0x37,0x2f,0x5c,
+0x53,0xf4,0x07,0x9b,0x06,0x16,0x3a,0x74,0xab,0x57,0xbb,0x7d,0xce,0xcb,0xd4,0xc8,0x6b,0xd7,0x6e,0x3d,0x78,0x5b,0x82,0xa5,0x25,0x14,0x23,0xd9,0xcb,0x3b,0x5e,0xc1,
+0x3f,0xc5,0x09,0xdd,0x75,0x67,0x6b,0x91,0xf4,0x33,0x29,0x76,0xf1,0xa4,0xe5,0x8a,0xc8,0x77,0xdb,0xba,0x3b,0xbf,0x73,0x89,0x37,0x2d,0x6c,0x5b,0x85,0x5e,0x2d,0x68,
+0xf7,0x67,0xa8,0xdf,0x73,0xd7,0x0a,0xd8,0x78,0x11,0x65,0xb1,0x01,0x62,0x38,0x27,0x5a,0x2a,0x39,0xff,0x3e,0xd3,0x44,0xd3,0xbf,0xab,0xbc,0x8e,0x64,0x7b,0x09,0xef,
+0x49,0x5e,0x1c,0x42,0x4d,0x69,0x93,0xd2,0xe0,0xec,0x48,0x24,0x14,0x10,0x78,0x04,0xde,0xcd,0xbf,0xd5,0x05,0x6d,0xba,0x8e,0x93,0x1c,0xc9,0xea,0x30,0x32,0x5f,0xf0,
+0xd2,0x8e,0x4e,0x8b,0x8a,0x80,0xeb,0xcb,0x0b,0x18,0x47,0x58,0x08,0x23,0x96,0xd2,0x43,0x61,0xbd,0x07,0x03,0x29,0xe9,0xb1,0x6e,0x87,0x60,0xf9,0x6c,0xc4,0x8b,0x0c,
+0xac,0xfe,0xd9,0x9b,0xb1,0x30,0xf5,0xc3,0x3e,0x85,0xb9,0x38,0x8d,0x3c,0xbc,0x35,0x2d,0x3d,0x51,0xa4,0x60,0xe8,0xda,0x16,0xa2,0x87,0x1c,0x96,0x4a,0x05,0xd4,0xb0,
+0x09,0x49,0xf6,0x53,0x8e,0xa6,0xc7,0x33,0x4a,0x9b,0x33,0x29,0x9d,0xa8,0xf7,0xea,0x09,0x4f,0xe5,0x48,0xb5,0x57,0xa8,0x5f,0x02,0xc9,0x38,0xf6,0xb4,0xae,0x6d,0x61,
+0xe8,0x99,0x34,0x8e,0x10,0x6c,0xc0,0x85,0xc4,0x09,0xd7,0x44,0x3a,0x25,0xee,0x93,0x4d,0x84,0xcd,0xbf,0xe0,0x8c,0x8e,0x12,0x5b,0x09,0xaf,0xaf,0xf4,0x84,0x3c,0x1c,
+0x7e,0xf9,0x4e,0xd3,0xea,0x2c,0x0b,0xaf,0x5c,0xc7,0x3e,0x19,0x0f,0xc8,0xbe,0xac,0x97,0x29,0x84,0x47,0x5e,0x82,0x63,0x83,0x0f,0xc5,0xe3,0x03,0x8c,0x70,0xdd,0x44,
+0x5a,0x62,0xef,0x92,0x97,0x51,0xb8,0x46,0x5b,0x1e,0x97,0x0f,0x2a,0x89,0xde,0xa7,0x1f,0xb2,0xd6,0x65,0xd9,0x54,0xbb,0xea,0x09,0x02,0x09,0xb3,0xa5,0x23,0x65,0x58,
+0x18,0xc2,0xe8,0x8b,0x67,0x2d,0x38,0x31,0xb1,0xbf,0x9c,0xe4,0x39,0xda,0x72,0x88,0xe5,0xf5,0x16,0xdc,0x13,0xfb,0xfe,0x2b,0x1f,0x70,0xce,0x4c,0xee,0xf9,0xf2,0x4a,
+0xd5,0x29,0x51,0x5c,0x8c,0x24,0x66,0xe8,0xa5,0x03,0xff,0x2f,0xb4,0xaa,0x74,0xb6,0x70,0xe1,0x11,0x8c,0x91,0xb1,0xcf,0x21,0xe3,0x83,0xfa,0xa0,0xa7,0x3a,0x22,0x01,
+0x7e,0x6d,0xa3,0x05,0x41,0xc6,0xb2,0x2f,0x36,0x49,0xae,0x48,0x9b,0x2f,0x0a,0xd3,0x39,0x83,0x8b,0x5e,0x60,0x9b,0xbb,0x8c,0x2d,0x25,0xf6,0x7b,0xda,0xf0,0x1b,0xf3,
+0x8a,0x91,0x8f,0xea,0xa1,0xd6,0xe5,0x60,0xab,0x41,0xe5,0x2c,0x18,0xc8,0x63,0xf9,0x2c,0x53,0x22,0xed,0xa7,0x76,0x99,0x2c,0x72,0xb8,0xb6,0x64,0x41,0x84,0x32,0x0b,
+0xea,0x2b,0x76,0xd2,0xe5,0xcc,0x5b,0x8d,0xf7,0xff,0xf8,0x0a,0xc6,0x23,0x28,0x3d,0x23,0xed,0x23,0xbe,0x2a,0xe3,0x88,0xf4,0xdd,0xb0,0x48,0xe7,0x65,0x5f,0x0f,0x55,
+0xd6,0x76,0x86,0x60,0x44,0x20,0x54,0x05,0x44,0xdc,0x0f,0xec,0x15,0x25,0xb4,0xb7,0x09,0xd3,0x83,0x7b,0xd5,0x03,0x80,0x72,0xab,0x20,0xd8,0xd2,0x2b,0x4b,0xb8,0x7e,
+0x20,0x70,0x7c,0x14,0xc2,0x5c,0x6b,0x2f,0x10,0xe1,0x36,0x48,0x98,0xe4,0xef,0x55,0x04,0x18,0x12,0xa0,0xc6,0x08,0x27,0x66,0xcc,0x60,0xc0,0x60,0x55,0x81,0xb6,0xf4,
+0xca,0xa6,0x82,0x7c,0x34,0x42,0x7e,0x7b,0x2f,0x39,0x10,0xd0,0xb7,0x0a,0xad,0x03,0x7b,0xb8,0x97,0xf4,0xd9,0x84,0x14,0xb6,0x1e,0x0e,0x04,0x9d,0x36,0x15,0x6b,0x4b,
+0x0f,0x0c,0x82,0x46,0x9d,0x32,0x2d,0xbc,0xec,0xc1,0x9d,0xa1,0xbc,0x93,0x8e,0x15,0x19,0x0b,0xa4,0xc2,0x4f,0xda,0x92,0x6d,0x97,0x6f,0xb1,0x44,0x2c,0x20,0x79,0xaf,
+0x21,0x43,0xa6,0xec,0x8a,0x80,0x0d,0x42,0xf1,0xd5,0x26,0x5b,0x46,0x5d,0x2e,0xba,0xe0,0xd0,0xe1,0xd3,0x6e,0x1c,0x35,0xf6,0x3d,0x84,0x34,0x12,0x9e,0xb0,0x5c,0xd0,
+0x1e,0xb5,0x6c,0xe4,0x39,0x0e,0x30,0x5c,0xe3,0xaa,0x11,0x86,0x13,0x47,0x9c,0x4c,0x31,0xc9,0x08,0xab,0x19,0x22,0xe4,0x61,0x47,0xbd,0x98,0xe7,0x4c,0x64,0x43,0x39,
+0xbe,0x07,0xa6,0x3c,0x62,0xec,0x39,0x66,0xbd,0x84,0x0a,0x4b,0x82,0xeb,0xa1,0xd5,0xb2,0x9b,0x44,0xe9,0x74,0x6b,0xcb,0x88,0x97,0x9e,0x3b,0xbc,0x93,0xae,0x80,0xfd,
+0xe8,0x70,0x59,0xf3,0xcd,0x57,0xee,0x3e,0x03,0x6d,0xcf,0xa0,0xfc,0x4e,0xfe,0x35,0xd1,0x10,0x0b,0x14,0xd8,0x74,0x7c,0xa3,0xee,0xfe,0x58,0x2a,0xd2,0x9d,0xfa,0x54,
+0x15,0x7a,0xea,0xf0,0x86,0x2e,0xf0,0xc2,0x29,0xd3,0xd1,0x36,0x9a,0xe0,0xb2,0xc5,0xad,0x7d,0xdd,0x6a,0xdd,0xcf,0x71,0x93,0x63,0xa3,0xaf,0x96,0xa4,0x98,0xed,0x58,
+0x5b,0xbe,0xf6,0x8f,0xdb,0x13,0x15,0xe7,0x9f,0xfe,0x71,0xab,0xf7,0x69,0x82,0x2d,0xea,0x47,0x0c,0x9d,0xfa,0x33,0xb6,0x72,0x43,0x30,0x2b,0x93,0x92,0xa3,0x25,0x63,
+0xd2,0x74,0x1a,0x91,0x2b,0x3a,0x22,0xb8,0xaa,0x18,0xb1,0x88,0x98,0xb9,0x11,0x5a,0x45,0xd7,0xb2,0x96,0xee,0x34,0x31,0xc5,0xa5,0x01,0xd6,0xda,0x3e,0x17,0xde,0xbb,
+0x8c,0x0c,0xf5,0x52,0x66,0xe9,0x36,0x70,0xe7,0xbc,0x27,0xc2,0x2d,0xc1,0x44,0xb3,0x59,0xa3,0x64,0x3c,0xc0,0x2d,0x0f,0x47,0x6f,0x8e,0x01,0x6c,0x22,0x8e,0xb6,0x5e,
+0x0d,0xcc,0x59,0x49,0xf8,0xbc,0x52,0x12,0x58,0xe1,0x32,0x7b,0x4f,0x73,0xe3,0x55,0x41,0xd0,0x86,0x15,0x72,0xdc,0x72,0x52,0x20,0xe9,0xc9,0xb8,0x7c,0x03,0x6d,0x65,
+0xd0,0x5a,0x17,0xb6,0x51,0x9d,0x34,0x16,0x2e,0xd4,0xd0,0x04,0xeb,0x74,0xc7,0x28,0xb9,0x57,0x07,0xc3,0xb0,0xf1,0x3b,0xd2,0x08,0x96,0xb4,0x34,0x9a,0x84,0x94,0x85,
+0x9a,0xde,0x3b,0xba,0xe7,0xd7,0x39,0x1e,0x02,0x3b,0x81,0x06,0x47,0x6c,0xc8,0x89,0xd4,0xe6,0x28,0xe4,0x73,0x55,0x1c,0xd3,0xf4,0x2a,0x9c,0xd4,0x08,0x2e,0xad,0x7b,
+0xda,0xf8,0xd4,0xd4,0x14,0x0e,0x35,0xa3,0x0f,0x24,0x22,0x03,0x2d,0xa6,0xec,0x9a,0x61,0x75,0x57,0x61,0x72,0xe8,0x36,0x60,0xfd,0x3b,0x72,0x55,0x23,0x17,0x26,0x20,
+0xb4,0x1f,0x6b,0x49,0x33,0xd9,0x98,0xa9,0xa6,0xb8,0x50,0x3c,0xfd,0x65,0x83,0xb7,0x40,0xb0,0xf0,0x6e,0xe1,0xd8,0x2f,0xf0,0x67,0xbf,0x8a,0x92,0xad,0xac,0xa8,0xa1,
+0xa7,0xc6,0x63,0x52,0x37,0x31,0xf5,0x49,0x04,0xed,0xd4,0x4a,0xb2,0x52,0x42,0xa2,0xe7,0x4d,0xe4,0x8b,0xe1,0x14,0x51,0x0e,0x34,0x44,0x17,0x03,0x34,0x94,0x28,0x99,
+0x18,0xe3,0x4a,0x6a,0xcb,0x95,0x75,0x46,0xca,0x06,0xa1,0xac,0x40,0x6c,0x13,0x51,0x67,0x1e,0x2a,0xc1,0x52,0x56,0x98,0xd3,0x10,0x83,0x3d,0xe6,0xa7,0xac,0x29,0xd0,
+0x0f,0xc8,0xb9,0xa1,0x16,0xc3,0x90,0x79,0xf4,0x75,0xc9,0x7a,0xba,0x2e,0x08,0xec,0x3a,0xa2,0x27,0x22,0x6f,0x90,0xd1,0x6d,0x2a,0x6c,0x44,0x78,0xa8,0xee,0x88,0x18,
+0x0d,0x56,0x6a,0xc5,0xb2,0xb5,0x87,0x4c,0x9a,0x4a,0x54,0x8c,0x05,0x7a,0xc3,0xc2,0xcf,0x79,0x12,0x24,0x61,0x45,0x0c,0x89,0xeb,0x18,0x11,0xe9,0xd5,0x53,0x87,0x3d,
+0x4f,0xdc,0xd7,0x26,0xca,0xb0,0x42,0x88,0x89,0x2e,0x6d,0x31,0x9a,0x19,0x37,0xa2,0x24,0x44,0xa2,0x59,0xd8,0xc4,0x4c,0xb2,0xa8,0x1f,0x87,0x9d,0x58,0xa4,0x46,0x57,
+0xe6,0x93,0x91,0x52,0x39,0x23,0x23,0x14,0x4b,0xbc,0x8c,0x72,0x25,0x81,0x7c,0x61,0x23,0xd8,0xdc,0x63,0xb8,0x8c,0x42,0x97,0xf9,0x56,0x3a,0x34,0x88,0xac,0x4d,0x5a,
+0x4f,0xeb,0xf0,0x24,0xba,0x46,0x99,0xa2,0x89,0xff,0x41,0xe6,0xba,0x6a,0xec,0xa0,0xab,0x5f,0xe6,0x4c,0x8b,0x75,0x44,0xe4,0x2c,0x53,0x4d,0x01,0x64,0xa7,0xcb,0x30,
+0x08,0x0d,0x3c,0x4b,0x32,0xb6,0xce,0xad,0x8a,0x54,0x26,0xf1,0x22,0x3c,0x16,0xb3,0x83,0x39,0x8f,0x6c,0x67,0x50,0x31,0xd3,0xe7,0x1d,0x1b,0x07,0x6f,0x08,0xae,0x0b,
+0x86,0xc6,0x9b,0x87,0xf9,0x32,0xfd,0xab,0x3e,0xfe,0xf5,0x3c,0xe2,0xfa,0x23,0x82,0xce,0xe7,0x97,0xdf,0x99,0x00,0x95,0x0b,0xcd,0xc3,0x29,0x3f,0xc4,0xf4,0xdd,0x1e,
+0x95,0xb4,0xfd,0x01
+};
+const size_t WM_PK_JSTZ_JS_BR_LEN = 1572;
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_INDEX_HTML_BR[] PROGMEM = {
+0x1b,0x27,0x06,0x00,0x1c,0x09,0x76,0x2c,0xcb,0x42,0xb6,0x38,0xb8,0x93,0x45,0x6b,0xea,0x63,0x54,0x79,0x42,0x08,0xf2,0x71,0x1f,0x28,0xc9,0x65,0x0b,0xe4,0x4d,0x95,
+0x6c,0x02,0x9a,0xa6,0xa6,0x8f,0x4b,0xca,0xdf,0xcf,0xed,0x88,0x50,0xd2,0x4a,0x24,0x26,0x4a,0xfe,0x93,0xb7,0x3f,0x43,0x5c,0x23,0x3e,0xd1,0x84,0x49,0x82,0x44,0xc8,
+0x1c,0x8d,0x4c,0x2d,0xa8,0x48,0xd7,0x03,0xac,0xd2,0x6e,0x07,0x6b,0xb8,0xa7,0x06,0x92,0x6c,0x83,0x02,0x30,0x3d,0x0d,0x19,0x5e,0x09,0xad,0x76,0x70,0x40,0xb9,0x9c,
+0x00,0xac,0x24,0x80,0xa1,0x45,0xcb,0x18,0x99,0xac,0x9e,0x43,0xe0,0x94,0xd1,0xec,0xb0,0x91,0x49,0xa6,0x51,0xeb,0x03,0x5d,0x52,0xad,0xab,0x5c,0x2e,0x0d,0x2c,0x7b,
+0x30,0x39,0xef,0xdb,0x8d,0x0c,0xf2,0xc7,0xa2,0x5b,0x6f,0x7b,0x9d,0x02,0x8f,0x94,0xa5,0xc1,0x76,0x3a,0xa9,0x55,0xb4,0x42,0xbe,0x4c,0x45,0xd0,0xed,0x87,0x9c,0xbc,
+0x04,0xb9,0x74,0xa4,0xcb,0xd9,0xfb,0xb4,0xaf,0xe9,0x64,0x21,0x43,0x4a,0x36,0x5f,0x52,0x9d,0x84,0x15,0x2a,0x65,0xdf,0xcb,0x59,0xef,0x09,0xb1,0x7d,0x3a,0x99,0x53,
+0xb5,0x02,0x55,0x72,0x95,0x6f,0xdc,0x52,0x2e,0x97,0x8f,0x28,0xc8,0x5f,0x5e,0x7e,0x2b,0x08,0xb5,0xb8,0x71,0xb4,0x95,0x91,0x06,0x03,0x10,0x85,0x12,0x42,0xae,0x2a,
+0xab,0x1e,0x46,0xfa,0x84,0x82,0x9e,0xab,0x19,0x41,0xbe,0xb8,0x69,0x42,0x28,0xcf,0x41,0x3e,0xf5,0x6e,0xee,0x28,0xb8,0x9d,0x45,0x3d,0x45,0xbf,0x44,0x63,0x16,0xaf,
+0xa8,0xea,0xe5,0x98,0x15,0x7a,0xe0,0x11,0xc0,0x83,0xc0,0xeb,0xfc,0x9d,0xad,0x8b,0x45,0x48,0xbc,0x54,0x80,0x90,0x7f,0xc3,0xb5,0xd5,0x24,0x91,0x23,0x47,0xc5,0xdc,
+0xa0,0x4d,0x29,0x3f,0xde,0x14,0x11,0x4e,0x24,0xfc,0x57,0x26,0x3d,0x82,0x66,0xc3,0xad,0xee,0xfd,0xab,0x7a,0x98,0x40,0xa8,0xc1,0xe7,0x18,0x29,0x32,0xe1,0x4d,0xa8,
+0x1c,0x68,0x67,0x6f,0x17,0x50,0x5e,0xa6,0xb0,0x41,0xbe,0xc5,0xda,0x83,0x90,0x82,0xdb,0x26,0xe0,0x14,0x7c,0x9e,0xd6,0xaf,0x11,0xef,0xb6,0x61,0x3f,0x9e,0xec,0xa1,
+0x5d,0xa3,0xbc,0xce,0x6f,0x13,0xfe,0x95,0xd9,0xa7,0x8b,0xcd,0x7e,0xdf,0x39,0xb3,0x02,0x15,0x29,0xd6,0xde,0x15,0x41,0xb5,0xe9,0xe8,0xbb,0x46,0x1f,0xa1,0x8a,0x59,
+0x71,0xe3,0x2e,0x07,0xb0,0x0d,0x83,0x01,0x3e,0xaa,0x82,0x1e,0xac,0x3f,0x06,0xee,0x53,0xf8,0x76,0x06,0xd0,0xb0,0xb3,0x89,0xc5,0x59,0x57,0xbc,0xf8,0x8b,0xf0,0x5b,
+0xf4,0x5c,0xf8,0xf5,0x28,0x75,0x9c,0x12,0xbf,0x3f,0x53,0xc9,0xe6,0xb2,0x9a,0x66,0x68,0x71,0x52,0x93,0x17,0x61,0xa9,0x72,0xae,0xf2,0x08,0x98,0x0e,0xd0,0x94,0x6a,
+0x88,0x7e,0x4a,0x91,0x6f,0x72,0x5f,0x3b,0x23,0x35,0xda,0x64,0x81,0xe1,0xaf,0x06,0xb1,0x66,0x85,0x91,0x12,0xa8,0x46,0xf2,0x97,0x70,0x26,0x1d,0x4f,0x45,0xe7,0xd2,
+0x76,0x10,0x62,0x1b,0xd2,0x64,0x29,0x75,0x18,0x75,0x37,0x9a,0xc2,0x96,0x1a,0x88,0xc2,0x36,0x2e,0x15,0xdd,0x54,0x11,0xa9,0xfd,0x6e,0xd7,0xf1,0x0a,0xe1,0x0a,0x44,
+0x1f,0x33,0x18,0x9d,0x01,0x61,0x81,0xf8,0x2d,0x21,0xe1,0x5f,0x1d,0xd0,0xfe,0x96,0x35,0xe8,0x62,0x17,0x5c,0x81,0xbf,0x0b,0x47,0x4c,0xce,0x14,0x8f,0x1c,0xe5,0x92,
+0x54,0x57,0x4d,0x84,0x8b,0x40,0x42,0x0c,0x9a,0xe1,0x16,0xa8,0x7e,0x45,0x1e,0x3e,0xd4,0x09,0x60,0xcc,0xe0,0xc5,0x78,0x3f,0x92,0x30,0xa2,0x9d,0xd5,0x3b,0xaa,0x20,
+0x2e,0xbc,0x01,0x6f,0x99,0x64,0x3a,0x99,0xfb,0x6d,0xdc,0x42,0x02,0x78,0x51,0x31,0x66,0x00
+};
+const size_t WM_PK_INDEX_HTML_BR_LEN = 594;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_INDEX_HTML_BR[] PROGMEM = {
+0x1b,0x3a,0x06,0x00,0x9c,0x07,0x76,0xb3,0xc5,0xa1,0xb6,0x8f,0x19,0x22,0x13,0x91,0x2e,0xd5,0xb9,0xb3,0x4c,0xe9,0x4f,0xab,0x65,0xf4,0xbd,0xe5,0x77,0x07,0x39,0x8a,
+0x80,0xd4,0x7d,0xa1,0x4c,0x4b,0xf2,0x24,0xc6,0x14,0x36,0xe0,0x80,0x35,0x90,0x05,0xc2,0xe0,0xf4,0x71,0x49,0x39,0x5a,0x5b,0x48,0x82,0x48,0x48,0x94,0xa8,0x2d,0x59,
+0xe9,0x67,0x83,0x8a,0xaf,0xf0,0xd6,0xc4,0xe3,0x77,0xb5,0xf6,0xa1,0xc4,0x57,0x21,0xaf,0x03,0x7f,0x03,0xcb,0x74,0x12,0x45,0x9a,0x3b,0x48,0xb2,0x65,0x3a,0x00,0xd3,
+0xa3,0xe8,0xe1,0x75,0x5a,0xb5,0xc3,0x11,0x30,0x2e,0xc7,0xcd,0x4a,0xdc,0x70,0xb4,0x68,0x05,0x23,0x43,0xe6,0x39,0x04,0x4e,0x05,0xcd,0x76,0x2a,0x45,0xe3,0x30,0xeb,
+0x03,0x3f,0x52,0xad,0x81,0x9e,0x57,0xf1,0x6c,0x82,0x01,0x5f,0xaf,0x1b,0x19,0xe4,0x6f,0x11,0xdd,0xf6,0xda,0xeb,0x30,0x3c,0x72,0x96,0x06,0xdf,0xf9,0x28,0x2b,0xb0,
+0x4c,0x3a,0x4f,0x59,0xa7,0x3b,0x1d,0xf4,0xc9,0x3b,0xc9,0xa5,0xae,0x78,0xdc,0xfd,0xb2,0xaf,0xf9,0x68,0x26,0x41,0x98,0x4c,0xe7,0x54,0x90,0x38,0xc8,0x2b,0x91,0xfa,
+0x92,0xe6,0x39,0x22,0xb6,0xdf,0x8e,0xa6,0x54,0x96,0xa1,0x42,0xaa,0x50,0xc7,0x4d,0xe8,0x79,0x95,0x60,0xe4,0x8f,0x8e,0xdf,0xf2,0x50,0x8b,0x0c,0xce,0x6d,0x26,0xa4,
+0x21,0x38,0x08,0x66,0x84,0x90,0xb8,0x20,0x55,0x17,0x4e,0xfa,0x04,0x46,0xcf,0x85,0x84,0xa0,0xbd,0xb8,0x79,0x42,0x38,0xe4,0x60,0x73,0x55,0xab,0x2b,0x3a,0x7c,0x73,
+0x51,0x8e,0xf1,0x85,0x26,0xfb,0x5c,0x3b,0x70,0x89,0x6f,0xc5,0x90,0x5c,0xce,0x9b,0xc9,0x90,0x0b,0xe0,0xc4,0x2e,0xdf,0xa9,0x07,0x4b,0x13,0x8e,0x3d,0x52,0x28,0x0d,
+0x7c,0x28,0x67,0x99,0xb9,0x26,0x22,0x45,0x14,0xc1,0xe8,0x60,0x7d,0x29,0xff,0xea,0x84,0xc2,0x1f,0x89,0xec,0x8f,0x92,0xb4,0x00,0x54,0xa7,0x78,0xdb,0xf5,0x12,0x4f,
+0xb8,0xff,0xe7,0x29,0x63,0xdc,0xbe,0x45,0xa0,0x5b,0x7c,0x06,0x11,0x63,0x9f,0x2a,0x0f,0x8c,0xbb,0x3f,0x37,0x16,0xe6,0xbc,0x84,0x2d,0x65,0xb6,0x0c,0x7b,0xcc,0xf1,
+0x8e,0x81,0x9d,0x6f,0x6c,0x5d,0x65,0x16,0xa1,0x1f,0x6d,0x6d,0xca,0xb3,0xa5,0x5b,0xc9,0x11,0x3f,0xac,0x72,0x83,0xfb,0xbe,0x21,0x3e,0xec,0xac,0xae,0x55,0xb7,0xde,
+0xfd,0xbb,0x94,0x26,0x4e,0x16,0xeb,0x75,0x94,0x4b,0x7c,0xe9,0x34,0x1c,0x79,0x44,0xd7,0xfa,0xe6,0xc0,0xeb,0x6e,0xa7,0x6b,0xe2,0xd8,0x84,0xc0,0x33,0xa8,0x25,0x27,
+0x3e,0x64,0xb3,0xc4,0xba,0x25,0xdd,0x95,0x28,0x64,0xbd,0x44,0x1c,0x00,0x87,0x08,0x02,0x44,0xb5,0xff,0xe0,0x03,0x2c,0xff,0xac,0x6f,0xc2,0x35,0x74,0xc3,0x05,0x03,
+0x4b,0x82,0x12,0xa9,0xfd,0x0f,0x64,0x8a,0x70,0x4c,0xfc,0x17,0xa3,0x85,0x64,0x2a,0xc9,0x98,0xce,0x42,0x27,0x15,0xb0,0x98,0xc9,0x3a,0xba,0x29,0x26,0xe0,0xd2,0x40,
+0xc3,0xcd,0x23,0x7d,0x2b,0x05,0x7e,0x08,0xd1,0x4e,0x0c,0x94,0x68,0x43,0x62,0x45,0xb7,0x4e,0x92,0x99,0x7e,0xb8,0xdf,0x08,0x95,0x48,0xfe,0xc3,0x9f,0x88,0x87,0x63,
+0xc1,0xb1,0xb2,0xec,0x44,0xdd,0xb2,0x32,0x98,0x2a,0xdb,0x4a,0xdd,0x08,0xc6,0x60,0x49,0xcb,0x48,0x31,0x2f,0x41,0x95,0x49,0x14,0x20,0x50,0xfa,0xfb,0x6e,0xbb,0x30,
+0x44,0x30,0x90,0x7d,0x50,0x97,0x0e,0xeb,0x16,0xa6,0x68,0x29,0x65,0x8f,0x40,0xae,0x0b,0x56,0x4d,0xb4,0xed,0xcd,0x16,0x54,0xce,0x83,0x4b,0x43,0x28,0xfa,0x47,0xe8,
+0x92,0x8d,0x5e,0xd7,0x3b,0xb1,0xbb,0xdc,0xc1,0x2d,0x82,0x60,0xb1,0x6e,0xee,0x62,0x2d,0x68,0x44,0x21,0x13,0x20,0xd8,0x41,0xbf,0x7e,0xde,0x92,0x00,0x13,0xbe,0x3e,
+0xf3,0x8c,0x82,0x8a,0x0f,0x54,0x41,0xa8,0xf8,0x06,0x38,0x25,0xa2,0xf1,0x68,0xaa,0xd9,0x96,0x75,0x14,0x40,0x41,0x6c,0x18,0x01
+};
+const size_t WM_PK_INDEX_HTML_BR_LEN = 633;
+#else
+const uint8_t WM_PK_INDEX_HTML_BR[] PROGMEM = { 0 };
+const size_t WM_PK_INDEX_HTML_BR_LEN = 0;
+#endif
+#ifdef WM_REMOTE_UPDATE
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_OTA_REMOTE_JS_BR[] PROGMEM = {
+0x1b,0x1c,0x38,0x51,0xd4,0xc4,0x4d,0xca,0x2d,0xa2,0x8a,0x94,0x02,0x68,0x7d,0x60,0x1b,0xd3,0x1a,0xeb,0x6f,0x01,0x58,0x98,0x55,0x74,0x29,0xe2,0xd8,0xa5,0x8e,0x38,
+0x3d,0x5d,0x6c,0x2d,0x8f,0xfa,0x8b,0xde,0x94,0x47,0x68,0xec,0x93,0xdc,0x1f,0x7f,0xcd,0xfa,0x9f,0x9f,0x2f,0x9c,0xd9,0xe5,0x25,0x25,0x50,0xa0,0xe7,0x8a,0xcf,0x1e,
+0x97,0xce,0xe5,0x1c,0xb7,0x3d,0x36,0x92,0x80,0xd1,0x08,0x4c,0x12,0xb5,0x1d,0xca,0x14,0x4e,0x5b,0xad,0x00,0x25,0x8b,0x89,0x8e,0x85,0x53,0xe5,0x22,0xa8,0x53,0xe9,
+0x45,0x6f,0x57,0xda,0xb6,0xcf,0x03,0xc0,0x02,0x34,0x26,0x20,0x09,0x54,0xde,0xd9,0x0f,0x7e,0x2d,0xff,0xbb,0x17,0x60,0xc0,0xb6,0xb5,0x60,0xb4,0x6a,0x31,0x8a,0xb2,
+0xb1,0x98,0x16,0x8e,0xa8,0x79,0x86,0x96,0xf7,0xff,0xaf,0xd9,0x5b,0x99,0xd9,0xa4,0x8c,0x8a,0x84,0xaa,0x70,0x3f,0x5b,0xa2,0xe3,0x49,0xb2,0x8c,0xd9,0xb9,0xef,0xde,
+0x79,0x3f,0xef,0xcd,0x24,0xbb,0x03,0x4b,0xd9,0x64,0xdb,0xc0,0x07,0xc0,0x79,0x6f,0x92,0xa5,0x62,0xf2,0x89,0xb6,0x5f,0x31,0x44,0x7d,0x24,0x59,0x55,0x23,0x6b,0x7b,
+0x0e,0x90,0x50,0x75,0xb2,0xb6,0xc6,0x56,0xb7,0x21,0x76,0xcd,0x88,0x5f,0x40,0xdd,0xfc,0x63,0x38,0x0d,0xb8,0x7b,0x15,0x53,0x50,0x8c,0x47,0x3e,0x86,0x66,0x2b,0xd7,
+0xfe,0xec,0x8a,0x03,0x17,0xa2,0x82,0x7a,0xc6,0xd6,0x7a,0x67,0xf2,0x33,0x79,0xff,0x8c,0x91,0x10,0xba,0x0d,0xbb,0x9f,0xa1,0x94,0x33,0x85,0xf6,0xa9,0x8a,0xa8,0xcf,
+0x52,0x12,0xcf,0x3a,0x1e,0x21,0xd1,0x6c,0x33,0x37,0xcc,0x57,0x24,0x9a,0x8e,0xc9,0x10,0xdf,0x65,0xdc,0x74,0xcc,0xf9,0xb1,0xed,0x12,0x8c,0xc8,0xeb,0xa8,0xb9,0x56,
+0xca,0xb7,0x26,0x9c,0xcd,0xc2,0x19,0xd1,0x0d,0xf9,0x92,0xda,0xf7,0x75,0xf4,0xf0,0x20,0xed,0x7b,0x18,0xf9,0xbe,0xff,0x3d,0x08,0xb9,0xbc,0xf3,0x46,0x73,0x6e,0x27,
+0xdb,0xea,0xf9,0x4f,0xf0,0x0f,0x69,0xe4,0x35,0x03,0xd1,0xa6,0x02,0x0e,0x1d,0x9d,0xcf,0xf5,0x75,0xa7,0x93,0xf9,0xb7,0xd8,0x2a,0xe3,0x7e,0xfb,0x6d,0xa7,0xf2,0xb8,
+0x6c,0x44,0x52,0x48,0x3f,0x2d,0x8d,0x70,0x76,0x7e,0x71,0x79,0x75,0x7d,0x33,0x1a,0xbf,0x7e,0xf3,0xf6,0xdd,0xfb,0xc9,0x87,0x8f,0x9f,0x3e,0x7f,0xf9,0xfa,0xed,0xfb,
+0x8f,0x9f,0xbf,0xf8,0x2c,0x17,0xb2,0x28,0xe7,0x6a,0xb1,0xd4,0xab,0xaa,0x6e,0x7e,0x1b,0xeb,0xd6,0x9b,0xed,0xe3,0xd3,0x9f,0x38,0x89,0x29,0x97,0xda,0xa6,0xd9,0xed,
+0x02,0x2b,0xb0,0x35,0xb5,0xd3,0xfd,0xf8,0xfb,0x2d,0x13,0x72,0x5e,0xcc,0x0e,0x06,0xe2,0xd9,0x0e,0xf7,0x3d,0xc5,0x41,0x74,0x42,0x7e,0x71,0x06,0xc8,0xd8,0xde,0x5c,
+0xfb,0x94,0x95,0x50,0xbc,0x0a,0x6d,0x32,0x5d,0x15,0xc4,0x46,0xcd,0x44,0xb9,0x36,0x88,0x9a,0x1a,0x50,0x13,0x8d,0x5b,0x44,0xbc,0x5c,0x8f,0x58,0x76,0x0c,0x1b,0xb3,
+0x87,0x3c,0xe5,0xff,0x8a,0x6b,0x95,0x3f,0xb9,0x66,0x2b,0x51,0x43,0x45,0xd4,0xc5,0xf9,0x04,0xc6,0x14,0x03,0x2d,0x3e,0x93,0x08,0x02,0x7a,0x9d,0x8a,0xbb,0xad,0x88,
+0xd8,0x10,0xe4,0x12,0x5e,0x11,0xfa,0x6c,0x27,0x75,0x61,0xfb,0xf3,0x27,0x27,0x2d,0x8b,0xa1,0x48,0xcf,0x3c,0xbd,0xa3,0x1d,0x7a,0xda,0x30,0xa4,0x46,0xd4,0xc2,0xb0,
+0x92,0xab,0xca,0x39,0xfd,0x9c,0x96,0x8a,0x14,0x62,0x42,0xcc,0xe2,0x76,0xbf,0xd4,0x4f,0x6c,0xab,0x72,0xfd,0x33,0x84,0x63,0x2c,0x39,0xc6,0xe4,0xcc,0xc7,0xf8,0x3f,
+0xcc,0xf2,0x00,0x8f,0x61,0xc4,0x34,0x1f,0xee,0x7b,0x79,0xbf,0xa1,0x9d,0xf2,0xbb,0x75,0x90,0xe6,0x21,0xff,0x57,0x31,0x21,0x56,0x87,0x6e,0x41,0x39,0xaa,0xb4,0x6a,
+0x22,0x53,0x76,0xf6,0x22,0x39,0xa0,0x58,0x66,0xb0,0xa4,0xcc,0xe4,0x97,0x8a,0x79,0xe0,0xff,0x2a,0xda,0xb4,0x14,0x79,0x36,0x76,0x24,0x1f,0x17,0x7a,0x49,0x78,0x22,
+0x80,0xb0,0xeb,0xcc,0xf8,0xf7,0x46,0xb6,0x4b,0x2a,0x20,0x34,0xeb,0xb3,0x49,0x01,0xce,0x04,0xfc,0xaf,0x20,0x33,0x00,0x50,0x95,0xb9,0x0f,0xa4,0xc8,0x30,0xdd,0x9e,
+0xf2,0xc6,0x6c,0xa8,0xfd,0x1e,0xb3,0x07,0x4f,0x38,0x4b,0x21,0x49,0xf9,0xc1,0xf3,0x16,0x57,0xdb,0xe1,0x7e,0x62,0xb1,0x3d,0x8b,0xca,0xc9,0x0b,0xae,0x27,0xa9,0xb7,
+0xa2,0x23,0x48,0x5c,0x1e,0xc3,0xd8,0x74,0xd8,0x50,0x93,0xd4,0x60,0x9f,0x2a,0xa3,0x96,0xe7,0x3b,0xc7,0x4e,0xed,0x1c,0xae,0x58,0x48,0xc1,0xf1,0xc1,0xb1,0xa7,0xa3,
+0x57,0xb2,0xc5,0xce,0x40,0x17,0xce,0x5e,0xcf,0x64,0x6f,0x50,0xd4,0x1e,0x26,0x60,0x21,0xda,0x30,0x20,0x64,0x95,0x9c,0x71,0x1f,0xb9,0x5f,0xcb,0xa2,0x6d,0xd3,0x2f,
+0x39,0xbd,0x3f,0x0b,0x7f,0xc5,0xc3,0x7f,0xee,0x76,0xf7,0xee,0x55,0x95,0xac,0xa3,0xad,0x49,0x45,0xaf,0x95,0x63,0x10,0xf0,0x7f,0x0d,0x93,0xf7,0x30,0xb6,0x7e,0x31,
+0x0e,0xd1,0x2f,0xee,0xca,0x58,0xc6,0x67,0xe3,0x61,0x02,0xd8,0x9a,0x72,0xf2,0xa6,0xde,0x92,0x54,0xc2,0xf4,0x9c,0x07,0xc7,0x80,0x0e,0x72,0x1d,0xe4,0x3b,0xe9,0x6d,
+0x3e,0x97,0x42,0xdc,0xf4,0x40,0x09,0x17,0x4a,0x45,0xf9,0x18,0xb5,0x80,0x1e,0x16,0x4d,0x33,0x70,0xd9,0x35,0xc2,0x6b,0xce,0xc0,0xae,0xb1,0x5d,0xbb,0xe2,0xb8,0xdf,
+0xf6,0x9f,0x5a,0xe9,0xc3,0xed,0xf5,0x7e,0xaf,0xa3,0x99,0xaa,0x22,0xd2,0x2c,0xe9,0xd1,0xa3,0x7a,0x9e,0xf1,0x9a,0x02,0x5a,0x81,0x1a,0x1a,0x19,0x75,0x63,0x21,0xe7,
+0xa6,0x1d,0x26,0xaa,0x46,0x82,0x11,0x9b,0xb6,0xb2,0xaa,0xe2,0x9a,0x2b,0x5c,0x4b,0x61,0xd8,0xc7,0xec,0x40,0x0b,0xab,0x3e,0xc3,0x0a,0x55,0x81,0x67,0xca,0x6e,0x7f,
+0xe6,0x88,0xa5,0x35,0x78,0xa4,0x82,0xff,0x81,0x4f,0x04,0x67,0x87,0xef,0xeb,0xe1,0x5c,0xa4,0xb6,0x0f,0xa2,0xa7,0xf6,0x0e,0x53,0x48,0x01,0x67,0x53,0x95,0x31,0x5e,
+0x97,0xd2,0x8a,0x26,0x98,0x5b,0xbd,0xba,0x87,0x63,0xb7,0xd3,0xf8,0x3e,0x79,0x47,0x34,0xbd,0x3d,0x7f,0x38,0x35,0x77,0xaf,0xa7,0xa3,0x07,0x65,0x7f,0xef,0xc6,0x74,
+0x69,0xa8,0xb2,0xaf,0x1d,0xe3,0x1d,0xd0,0x85,0xbb,0x8e,0xc0,0xf7,0x6f,0x1d,0xaa,0xd7,0x64,0xa2,0x88,0x1e,0x43,0x84,0x8d,0x00,0xeb,0xfb,0x51,0x44,0x53,0x1d,0x5b,
+0x0d,0xfd,0xc0,0x29,0x8f,0x1e,0x86,0x31,0x07,0x72,0xad,0x6b,0xee,0xde,0x5e,0xc5,0xca,0xa9,0xd8,0x18,0x5a,0x73,0x7d,0xf0,0x8e,0x5c,0xd5,0x04,0x89,0x25,0x06,0xd4,
+0xf4,0xd9,0xb3,0x8c,0x58,0x81,0xe3,0x48,0x71,0x17,0x61,0x16,0x27,0x4c,0xe0,0x58,0x57,0xfa,0x19,0xc7,0x55,0x77,0xce,0x94,0x8f,0x90,0x77,0x96,0x58,0x1a,0xd3,0x4e,
+0x94,0xef,0xab,0xaf,0xbe,0xf2,0x05,0x22,0xc2,0xf8,0x09,0x71,0xf3,0x04,0x47,0x8e,0x42,0xbf,0xbb,0x73,0xba,0x00,0x2f,0x50,0xc0,0x09,0x73,0x84,0x3d,0x8b,0x3c,0x34,
+0x58,0x41,0xce,0x71,0x8c,0x32,0x47,0xce,0x62,0x2c,0x3d,0x22,0x4f,0xd9,0xd3,0xe6,0x5c,0xbd,0xf5,0xd9,0x5a,0xac,0x87,0xf8,0x55,0x55,0xee,0x98,0xe4,0x69,0xdf,0x27,
+0x39,0xf2,0x96,0x7c,0x08,0x6d,0x52,0x46,0x1b,0xd4,0x51,0xb7,0x08,0x1c,0x8c,0x97,0x06,0xf3,0x66,0xef,0x47,0x4a,0x85,0x49,0x4b,0xb1,0x4c,0x39,0xcc,0x49,0x24,0x86,
+0x69,0x0b,0x2d,0xa5,0xa9,0xcd,0x52,0x63,0x78,0xf5,0xb8,0x2c,0x0e,0x61,0xd9,0x49,0xd6,0x18,0x73,0x3d,0x30,0x6a,0xdb,0xb2,0x9e,0xc5,0x4c,0xd7,0x77,0x1b,0x39,0x05,
+0x8d,0x2e,0x6c,0x59,0xdf,0x16,0x1e,0x4c,0x10,0x41,0x67,0x9a,0x71,0xf8,0x34,0xa6,0x68,0x13,0xa7,0xe9,0x79,0xbb,0x93,0x38,0x69,0xba,0x39,0x0b,0x89,0x99,0x92,0x26,
+0x38,0xcc,0xd8,0xf9,0xe6,0x75,0xb0,0x0f,0x97,0xe4,0xf7,0xad,0x91,0x6f,0xd1,0x15,0xf2,0xe8,0xa1,0x28,0x58,0x79,0xfa,0xa9,0xb2,0x64,0xf3,0xa7,0xe6,0x73,0xf6,0xb4,
+0x02,0xa5,0x58,0xed,0xc3,0xa4,0xaa,0xc2,0x0f,0xba,0xc0,0x8a,0x7d,0x46,0xc9,0x96,0x58,0xb3,0x07,0x74,0x59,0x85,0x2b,0x52,0x31,0xc9,0x6a,0xe6,0xd8,0xbd,0x99,0x60,
+0x8d,0xf8,0x32,0x4f,0x2f,0x76,0xfa,0xd4,0x1f,0x7f,0x24,0xdf,0x09,0x60,0x63,0x6c,0x67,0xd9,0xf3,0xb4,0x97,0x76,0xd6,0xf8,0xf5,0x6b,0x01,0xac,0x51,0x33,0xce,0x3b,
+0x34,0xb1,0xdb,0x79,0x66,0x7c,0x63,0x2a,0xf2,0xc7,0xc6,0xf4,0xb7,0x56,0x3d,0x84,0x9d,0x8a,0x84,0x0f,0x56,0xe2,0x4e,0x85,0xd3,0xe6,0xee,0x4d,0x3c,0xa9,0x55,0x00,
+0x16,0xae,0x78,0xff,0x12,0xe8,0x51,0x89,0x32,0x43,0x62,0x9a,0x70,0x06,0xb9,0x95,0x6d,0xd9,0xe6,0x9a,0x01,0x14,0x33,0x47,0x12,0x07,0xb7,0xcb,0x0f,0xc2,0xb4,0x39,
+0xe8,0x13,0x7e,0x27,0x2e,0xb4,0x36,0x01,0xe9,0x53,0xb9,0x83,0x61,0x76,0x79,0x2c,0x5e,0x52,0x59,0xb8,0xa1,0xde,0xf2,0x29,0xdf,0x94,0x21,0x93,0xe0,0x22,0xe1,0x5f,
+0x88,0x41,0x01,0x55,0x87,0x7d,0x3c,0xa7,0xa8,0xd4,0x51,0x54,0x07,0xad,0xb8,0xc4,0x97,0x3c,0xec,0xcc,0x75,0x08,0x48,0x02,0x59,0x9f,0x3e,0x5d,0x14,0x7d,0x01,0x5b,
+0xe5,0x5a,0x61,0xf0,0x54,0x7e,0x67,0x0d,0x67,0xa8,0x45,0xb2,0x34,0xf4,0x17,0xc1,0xa3,0xd1,0xde,0x08,0x65,0xe2,0x49,0x65,0xc0,0x64,0xfb,0xe8,0x12,0xb6,0x63,0x36,
+0x36,0x84,0x15,0xc6,0xf3,0x0b,0xe8,0x86,0x67,0xa5,0x60,0xc2,0xa9,0x18,0x89,0x66,0xbd,0x2d,0xd7,0xdc,0xf6,0xda,0x6d,0xad,0x75,0x9c,0x21,0x29,0xf0,0x16,0xea,0x83,
+0xad,0x6d,0x2a,0xdc,0x51,0xeb,0x9a,0xf1,0x7d,0x22,0xb6,0xde,0x85,0x01,0x5d,0x0a,0x1f,0x44,0xef,0x64,0xe9,0x9e,0x20,0x0b,0x8a,0xa1,0x21,0x4e,0xc4,0x26,0x3e,0x6e,
+0x53,0xf2,0x1b,0x5a,0x4f,0xb9,0xf8,0x2c,0x3c,0x05,0xaf,0xba,0x31,0x23,0x63,0xab,0xc5,0xfc,0xa0,0x66,0x61,0x4a,0x0a,0x84,0x29,0x92,0xcf,0x9d,0x4f,0x93,0x33,0x76,
+0xbb,0x56,0x32,0x78,0xca,0x7e,0xad,0x0e,0x42,0xba,0x4c,0x72,0x82,0x18,0x53,0x13,0x8a,0x70,0x49,0x73,0x12,0xa7,0x20,0xcd,0x4e,0xae,0xd0,0xe0,0x26,0xee,0xe6,0xaa,
+0xa9,0x3d,0x29,0x20,0x07,0x52,0xc5,0xc4,0x37,0xad,0x04,0x7e,0x21,0xe2,0x3c,0x42,0x1b,0x4e,0x08,0x9b,0xb9,0x65,0xcd,0x71,0xec,0x5b,0x00,0xf2,0x1c,0xcc,0x46,0x53,
+0x55,0x36,0xa1,0x54,0xa6,0x2a,0xc5,0x9b,0x93,0x0d,0x4d,0x7c,0xa3,0x8e,0x7b,0x93,0xbc,0x2c,0x69,0xa6,0x0d,0xb5,0xbd,0x63,0x7d,0x16,0xa6,0xe2,0xe2,0x32,0xab,0x78,
+0x0c,0x36,0xb3,0xc2,0xb8,0x52,0xb0,0xf1,0x3a,0x85,0xbb,0x48,0xdb,0x61,0x48,0x3e,0x86,0x58,0xc3,0xbd,0x94,0xcf,0x0a,0x6b,0x27,0x0f,0xf9,0x0e,0xca,0x3e,0x7b,0xf5,
+0x1e,0x4d,0x56,0x5a,0xd9,0x30,0x5b,0x43,0x8d,0xc8,0xf9,0x50,0x73,0x93,0x37,0x12,0x63,0x31,0x63,0xd5,0xde,0x08,0x5e,0x5c,0x16,0xfe,0x02,0x0d,0xe0,0x4d,0x86,0x26,
+0xae,0x5f,0x0a,0xf7,0x7c,0xdb,0x8d,0xc6,0x5b,0x71,0x10,0x08,0x53,0x9a,0x12,0xfc,0x05,0x0a,0xf1,0x55,0xcd,0x9d,0x93,0x0b,0xa9,0xec,0x48,0x94,0x72,0x3e,0x63,0x9b,
+0x10,0x9a,0x1c,0xdb,0x3b,0x0d,0x6e,0xba,0x99,0xd9,0x90,0x16,0x5e,0x0a,0x9b,0x4b,0x38,0x86,0x6d,0x6b,0xbb,0x74,0x9a,0x72,0x52,0xc2,0xc0,0x26,0x68,0x7e,0x9f,0x05,
+0x45,0x68,0x4e,0x16,0x34,0xf3,0xdc,0xd9,0xa9,0x9c,0xb3,0x6f,0x93,0x96,0xc6,0x16,0xb5,0x64,0x66,0xff,0xad,0x82,0x8b,0xe1,0xbe,0x7b,0x7e,0x4e,0x06,0x9f,0xc3,0x39,
+0x7b,0xae,0xc6,0x3a,0x58,0x3e,0xeb,0xd0,0x05,0x0f,0x19,0x65,0xd4,0x64,0x34,0x6f,0xc5,0x99,0x86,0xa0,0x74,0x07,0x65,0x65,0x48,0xad,0xc6,0x96,0x99,0x61,0x4d,0x00,
+0xb0,0xda,0x73,0x69,0x87,0x79,0x40,0x94,0x6f,0x9e,0xff,0x2a,0xbf,0xa1,0x8e,0x54,0x80,0xcb,0x70,0x75,0xf6,0x3a,0x27,0x71,0x83,0x81,0x7c,0x76,0xbc,0xa6,0x99,0x24,
+0x75,0xaa,0x93,0x78,0xcb,0x65,0xf9,0xe1,0x34,0xcf,0xc6,0xff,0xfb,0x56,0xe7,0xf3,0xcd,0x73,0x6f,0xee,0x7f,0xbd,0x45,0xa5,0xda,0x76,0xdb,0xfa,0x40,0x9e,0xff,0x36,
+0x94,0xf1,0x4a,0x19,0x3b,0xdf,0x4d,0xaa,0xda,0x3c,0x42,0x95,0xd2,0xba,0x5b,0xe6,0x6d,0x1b,0x58,0x75,0x9c,0x31,0xd9,0xbc,0x1c,0x5b,0x5a,0x01,0x35,0x57,0x66,0x33,
+0x79,0xeb,0x55,0x72,0xbb,0xca,0x9a,0x80,0xc0,0x28,0x37,0x4b,0x68,0x33,0x0d,0xe4,0x94,0xf5,0x74,0x85,0xab,0xe4,0x11,0x0e,0x92,0x37,0xf4,0x58,0xcb,0xc3,0xe3,0x56,
+0x3f,0x7f,0x62,0xfa,0x4a,0xd4,0x2c,0x19,0x49,0x34,0x73,0xb7,0x31,0x74,0xd1,0x11,0xf3,0xc8,0xec,0x65,0xb5,0xf5,0xde,0xf5,0x15,0x7d,0x4f,0x4c,0xd6,0x69,0x9f,0xf0,
+0x8c,0x7c,0x75,0xac,0x51,0xfb,0x89,0x01,0x7b,0x6b,0x0a,0xf6,0x4f,0xfb,0xb0,0x16,0x5c,0x5f,0x58,0x8b,0x10,0x9d,0x3a,0x21,0xbb,0x3a,0xdb,0x4a,0x40,0x18,0x47,0xfa,
+0xc4,0x32,0x55,0x59,0xe9,0xfa,0x31,0x67,0x25,0x68,0x37,0xa5,0xe7,0x48,0x2c,0x1f,0xc5,0xd8,0x50,0xd6,0x8e,0x03,0xb2,0x16,0xf3,0x2f,0x33,0xb9,0x81,0x0c,0xaf,0x6a,
+0x91,0x84,0x8f,0x24,0xa1,0x09,0xdf,0x13,0xa6,0xa5,0x65,0x31,0xa9,0x41,0x1a,0x54,0xd1,0x53,0xf0,0xc2,0x37,0x6c,0x96,0x25,0x85,0x49,0xcf,0xc4,0x2c,0xda,0xc1,0x6c,
+0x17,0x31,0x5c,0xa8,0xb5,0xed,0x47,0x47,0xe5,0x22,0x57,0x19,0x99,0xbe,0xa7,0x64,0x0b,0xc5,0x77,0x9a,0x47,0x6f,0x2f,0x4d,0xc2,0x5e,0x9c,0x16,0xa5,0x13,0x28,0x23,
+0x70,0xd3,0xd1,0xa2,0xeb,0xa5,0xb6,0x23,0xb8,0xe1,0xf9,0x95,0xaa,0x24,0x37,0x22,0x95,0x1e,0xa0,0x9f,0xba,0x6c,0x73,0x25,0x09,0x24,0x49,0xfa,0xce,0x41,0x14,0x09,
+0xb0,0x73,0x12,0xb1,0x0c,0x39,0x98,0x15,0x88,0x39,0xff,0xa7,0xd3,0x22,0x49,0x98,0x24,0x0d,0x5e,0xa2,0xa4,0x80,0x73,0xf5,0x38,0xa1,0xb4,0x08,0xe4,0x5b,0x8d,0xfe,
+0xd2,0x70,0x55,0x0e,0xfc,0x73,0x76,0xff,0xc4,0x90,0x00,0xe0,0x7a,0xc5,0x8b,0x5c,0xa7,0x0d,0xeb,0x55,0x55,0x21,0x18,0xe9,0x94,0x99,0x60,0x16,0xc4,0x90,0xbd,0x49,
+0x94,0x06,0x8c,0xf9,0xb8,0x74,0x29,0x9f,0x24,0x16,0xae,0xf5,0x20,0x8c,0x6f,0x5d,0xdd,0x5e,0x2e,0xe4,0x13,0xa6,0x76,0xfc,0x78,0x64,0xaf,0xfa,0x3f,0x59,0x52,0x8d,
+0xf2,0xca,0xca,0x96,0xad,0xe7,0x9e,0x3e,0x0a,0x53,0x9b,0x35,0xf2,0x02,0xfc,0xa7,0xdc,0x4f,0x91,0x8c,0x55,0x99,0x50,0x41,0x86,0xd7,0x20,0x59,0x6c,0x8c,0x0c,0xbd,
+0xab,0x00,0x1f,0x9f,0x57,0xae,0xb5,0x49,0x49,0x10,0x31,0x45,0xef,0xf7,0x8f,0xbc,0x67,0xb4,0xa8,0x98,0xb0,0x7f,0x57,0x85,0xa6,0xde,0xb6,0x08,0x96,0x2f,0x79,0xe3,
+0xa7,0xaa,0x10,0x4b,0x11,0xad,0xf1,0x08,0x52,0x00,0xf3,0x3b,0xc8,0x12,0x87,0x28,0x61,0x27,0x5e,0x53,0xc4,0x56,0x3a,0x7c,0xd3,0xc6,0x80,0x36,0x24,0xc6,0xa1,0xae,
+0x6b,0x95,0xf6,0xb6,0xee,0x93,0xb4,0x48,0x8d,0x01,0xd6,0x4c,0x6b,0xa4,0xb5,0x54,0x57,0xd5,0x47,0x58,0x76,0x33,0x42,0x96,0x58,0xe4,0x73,0x2f,0x4a,0x02,0x5b,0x15,
+0x22,0x8e,0x4a,0xa1,0x27,0x6e,0x10,0x4a,0xee,0x9c,0x77,0x24,0x40,0x12,0x52,0xf7,0x95,0x7a,0xc2,0xe9,0x8c,0x31,0xec,0x03,0x68,0xf0,0x57,0xb2,0x82,0x6c,0xb6,0xf4,
+0xd4,0x7d,0x83,0x36,0x52,0x02,0x2d,0xd7,0xd3,0x8a,0x89,0x38,0xf5,0xc9,0x66,0xc0,0x40,0x7c,0xa5,0xca,0xa9,0x46,0x5b,0xca,0x8e,0xab,0x04,0xf2,0x2b,0xf9,0x49,0xe0,
+0x2b,0x1d,0x64,0x87,0x88,0x1f,0x1d,0x26,0xd9,0x6a,0x44,0x7b,0xc0,0x90,0x46,0x4e,0x5d,0xd9,0x12,0x89,0xb1,0xfe,0x1e,0xa2,0xa4,0x2f,0xa0,0x87,0x46,0xd0,0x07,0xc8,
+0x05,0x4f,0x55,0x9b,0xe9,0x96,0x8b,0x22,0x00,0xb1,0x71,0x42,0x6d,0xc2,0x6b,0xe2,0xe6,0x6b,0x66,0xd9,0x68,0x9f,0xce,0x55,0x5a,0x2a,0xc1,0x04,0xdf,0x88,0xf6,0xa8,
+0x01,0x91,0x5d,0xb7,0x40,0xec,0xda,0x4a,0x31,0x4c,0x7f,0xd5,0x00,0x51,0x1e,0x13,0x56,0xd7,0xc6,0x84,0x86,0xb2,0xcd,0x0b,0xcf,0xb9,0xcc,0xbe,0x99,0xbb,0x01,0x88,
+0x8d,0xf5,0xa0,0x78,0x46,0x9c,0x78,0x0b,0x9e,0x12,0xcd,0x92,0xb9,0xa8,0x9c,0x3d,0x8a,0x42,0xb0,0xcb,0xdd,0xc0,0xb3,0x11,0x32,0x89,0xa2,0x92,0x2e,0x26,0x07,0xa3,
+0x36,0xa8,0x10,0x06,0x53,0xf9,0xae,0x43,0x41,0xad,0xc2,0xa3,0xcb,0x55,0x61,0x68,0x68,0xe3,0xa4,0x46,0x0c,0x03,0x5f,0x49,0x10,0x50,0x6f,0x2f,0x35,0xfd,0xd7,0xb8,
+0x22,0x2a,0xad,0xfd,0x56,0x03,0x8c,0xd1,0x97,0x1e,0xb4,0xae,0xa3,0xbc,0x14,0x92,0x59,0x77,0x21,0xeb,0x54,0x12,0xd1,0x7c,0x86,0x95,0xab,0x11,0x5b,0xc4,0xd1,0x15,
+0x88,0xb7,0xee,0x31,0x35,0x26,0xcf,0x9c,0xc0,0xc6,0xa3,0x6e,0x03,0xfd,0x38,0x53,0x16,0x9f,0x14,0x12,0x89,0x1e,0x20,0xe8,0x27,0xd2,0x51,0xde,0x06,0xb5,0x44,0x14,
+0x71,0x02,0x36,0x71,0x16,0xe5,0xae,0x3e,0x81,0x4d,0xdf,0xcb,0x83,0x9d,0xa5,0x17,0x33,0xda,0x10,0x17,0xe2,0xd7,0x18,0x5b,0x01,0x78,0x0a,0xeb,0xd7,0xd5,0x48,0x5e,
+0xb3,0xda,0xc2,0x98,0x57,0x1b,0x92,0xc6,0x98,0xe5,0x19,0xeb,0xcc,0x85,0x12,0x64,0xb6,0x2e,0x98,0xe3,0x25,0xed,0x10,0xdc,0x19,0x56,0x72,0x42,0xcc,0x48,0x30,0x63,
+0xc5,0x9a,0xed,0xde,0x60,0x4e,0x09,0x79,0xc5,0xe2,0x9f,0x6c,0x08,0x1d,0xe5,0x99,0x20,0x60,0x18,0x2b,0xaf,0xac,0xa5,0xf3,0x24,0x33,0x01,0xce,0x78,0x75,0x9d,0xa1,
+0x3b,0x63,0xb2,0x1a,0xd1,0x8d,0x31,0xf9,0xb6,0x40,0xc9,0x35,0xb7,0x69,0x2c,0xbe,0xb3,0x18,0x98,0x37,0x16,0x40,0x9d,0x2e,0x3b,0x9b,0xaa,0x60,0x71,0x77,0x8f,0xe8,
+0x66,0xd3,0xc5,0x1d,0xba,0x75,0xec,0x0d,0x21,0x33,0x61,0x3a,0x10,0x0b,0x93,0xcb,0xf4,0xd0,0x05,0x57,0xcd,0xa4,0x8e,0x70,0x36,0x6a,0x89,0x2a,0x00,0xcb,0x76,0xed,
+0xa0,0x73,0x39,0x50,0x6c,0xf7,0x7d,0x11,0x4b,0xf0,0x53,0x62,0x74,0x35,0x63,0xd3,0x83,0xea,0x74,0x70,0x19,0x04,0xb8,0x94,0xf1,0x42,0x7e,0xdf,0xa5,0xbc,0x5b,0x48,
+0x5d,0x7c,0x3d,0xa0,0x66,0x34,0xdb,0x59,0x85,0xaa,0x63,0x5f,0xd6,0x99,0x08,0xcc,0x5d,0x26,0xdb,0x8e,0x24,0x14,0x0b,0xba,0x0d,0xed,0xd2,0xcf,0x4c,0xa4,0x43,0x7e,
+0x3c,0x04,0x69,0xf1,0x15,0x26,0x83,0x05,0x03,0x7b,0x67,0xb0,0x48,0x87,0x79,0x46,0x72,0x9f,0x24,0x3f,0x6c,0xea,0xd1,0x3e,0x32,0xf1,0x0c,0xc7,0xe4,0xff,0x94,0x90,
+0x6c,0x3c,0x23,0xf1,0xef,0x99,0x26,0xee,0x07,0x10,0x6e,0x07,0x10,0x25,0xe9,0x3e,0x57,0xe2,0x00,0x3f,0x11,0xf3,0x0e,0x7d,0x9a,0x34,0xdf,0x2a,0x81,0xf8,0x11,0x7e,
+0xbf,0x26,0x83,0xd3,0x9d,0x77,0x67,0x37,0x2a,0xdf,0x39,0xed,0xcf,0xb7,0x7d,0x78,0xde,0xe8,0x8d,0x34,0xc7,0xab,0x36,0x12,0x7a,0x61,0x54,0xfd,0x78,0x97,0x2e,0x29,
+0x46,0x66,0x21,0xed,0x4a,0x1c,0x30,0xdf,0x74,0xb0,0x0d,0x15,0xec,0x8b,0x2e,0x53,0x50,0x14,0x50,0x4f,0x25,0x1b,0xe3,0xcd,0xd2,0x81,0xc7,0xb5,0xce,0xec,0x99,0x13,
+0x1d,0xa4,0x98,0x93,0x40,0x06,0x00,0xc7,0xa6,0x87,0x91,0x98,0x34,0xf8,0x52,0x14,0x72,0x33,0x0a,0x30,0x90,0x02,0x6e,0x68,0xad,0xe7,0x67,0x62,0xe1,0x12,0x85,0x74,
+0xf9,0x9c,0xc0,0xae,0xfd,0x7d,0x22,0x1e,0xf1,0xdd,0x05,0xec,0x0b,0x57,0xd1,0xe0,0xf0,0xb2,0x47,0x5f,0x1e,0xc5,0x2e,0x79,0x6d,0x4d,0xe2,0xb0,0xbb,0x85,0x0d,0x87,
+0x71,0x32,0xeb,0x10,0x15,0xf6,0x7b,0x5c,0x08,0x3c,0x9d,0xd8,0x73,0x14,0x08,0x85,0x01,0x03,0x51,0x01,0x77,0x37,0xde,0x71,0xad,0x74,0x99,0xbc,0x68,0x4a,0x09,0x26,
+0x2c,0xd9,0x8f,0x49,0xc4,0xd3,0x59,0xa8,0x69,0x37,0x04,0xfa,0xa3,0x40,0xe7,0x88,0x99,0x2c,0x80,0xe3,0x51,0x4f,0x6c,0x97,0xd5,0xec,0x8a,0x5e,0x32,0x22,0xa8,0xa3,
+0x39,0xa8,0xc7,0x80,0x0e,0x7c,0x1d,0x16,0x33,0x54,0x1c,0x78,0xe7,0xb6,0x59,0x58,0x99,0x67,0xc8,0xe6,0xa4,0xd5,0x46,0x1a,0xf0,0x98,0xa5,0x06,0xfe,0x93,0xe0,0x4b,
+0xf4,0x85,0x38,0x39,0x15,0x7d,0xd1,0xa7,0x49,0xa1,0xee,0x26,0x3d,0x9f,0xea,0x6d,0x2f,0xef,0xcc,0x13,0x6a,0x06,0xe2,0x75,0x80,0x28,0xea,0x25,0x09,0x54,0x1b,0x22,
+0xa2,0xf7,0xc0,0xf7,0x4f,0x72,0x88,0xe8,0x38,0x92,0x31,0xf4,0x4e,0x24,0x5d,0x9d,0xd9,0x48,0x11,0xba,0x47,0x67,0x68,0x18,0x7b,0xb9,0x4c,0x3b,0x77,0x15,0x60,0x31,
+0x8c,0x44,0x29,0xaa,0x22,0x88,0x25,0x80,0x6c,0xa4,0x87,0xbe,0xc5,0x4e,0x4f,0xd1,0x4e,0x23,0x75,0xae,0xfd,0x0d,0x09,0x5b,0xe1,0x8a,0xc0,0xa0,0x9e,0xd9,0xc6,0x97,
+0x5e,0x65,0xf7,0x06,0x14,0xfa,0x25,0x31,0x6d,0xb3,0x76,0xab,0x9a,0x22,0x0a,0xd3,0xe7,0x17,0xaf,0x0a,0x62,0x34,0x50,0x6e,0x3c,0xa7,0xd2,0x94,0x8c,0xf6,0x75,0xfa,
+0x6f,0x76,0x7f,0xf0,0x42,0x76,0x16,0x58,0x89,0x03,0x18,0x71,0x19,0x72,0x95,0x61,0xd1,0x2c,0xf6,0xc4,0xf2,0x55,0xba,0x23,0x43,0xb4,0x6e,0xd2,0x8b,0x76,0x84,0xa0,
+0xb5,0xff,0x0b,0xc6,0x55,0x77,0x67,0x00,0xc8,0xef,0x06,0x36,0x02,0xf1,0x54,0xdf,0xeb,0x68,0x72,0x82,0xe2,0x5b,0x51,0x69,0xc9,0x69,0xa7,0x0d,0x83,0xf5,0x7b,0xbd,
+0xba,0xfc,0x13,0xb2,0x35,0x8e,0x34,0xc1,0x0a,0x74,0x9e,0xc4,0x7e,0xd8,0x74,0xbd,0x85,0x82,0xc8,0x18,0x5d,0x7a,0xb7,0xfd,0x2b,0x82,0x6f,0xaa,0xe0,0x22,0x40,0xa5,
+0x97,0x60,0xd1,0x7d,0xee,0x20,0x58,0xb4,0x59,0x94,0xa7,0x89,0x80,0x8e,0x4d,0xdd,0x10,0x7a,0xff,0xf6,0x95,0xc1,0x09,0x05,0x7c,0xc6,0x42,0xfd,0x4e,0x2f,0x2e,0xb5,
+0xb7,0x76,0x43,0x68,0x1f,0xc8,0x89,0xdf,0xe9,0x6e,0x55,0x06,0x5b,0xb8,0x21,0x1b,0x1c,0xc9,0xd7,0x8e,0x5f,0xd8,0xa0,0xb9,0xf9,0x6a,0x26,0xea,0x37,0x99,0x9e,0xf8,
+0x82,0xd2,0xe1,0x8a,0xea,0xf0,0x0d,0x55,0xe8,0xfb,0x17,0xb2,0x8e,0x54,0x10,0xcc,0xfe,0xc9,0xda,0xf9,0xc6,0x1a,0xd0,0x3e,0xc7,0xe4,0x0d,0xa1,0x7d,0x54,0x37,0xc1,
+0x38,0xd7,0x57,0xd7,0xa7,0x25,0x45,0xe0,0x1a,0xe3,0x30,0x95,0xd5,0x1a,0x77,0xe9,0xb6,0xba,0xac,0xd1,0x10,0x52,0x8a,0x86,0x2f,0x86,0x50,0x31,0x1c,0x38,0xfc,0x2e,
+0x82,0xcf,0xb2,0xb2,0x25,0xed,0x57,0x5f,0x0e,0x0c,0x05,0x80,0x06,0x55,0x84,0x3e,0x79,0x3e,0x12,0x71,0x90,0x52,0x73,0xd7,0x59,0x98,0xf0,0x87,0xf1,0x12,0x92,0x28,
+0xc3,0xc8,0xf5,0x30,0x4a,0xc9,0xb7,0xfb,0x70,0x43,0x62,0x10,0x96,0x48,0xec,0x24,0x57,0x89,0x3e,0xe6,0xb6,0x04,0x40,0x43,0x9f,0x68,0x17,0xc0,0xa7,0x6c,0x41,0x94,
+0x93,0x0e,0x2c,0x8d,0x66,0xfb,0x7f,0xb7,0x76,0x7c,0xd7,0x43,0xe2,0xa4,0x33,0xe2,0x2c,0xf8,0x4f,0x5b,0x74,0xb6,0x57,0xa6,0x59,0xf5,0xac,0xc4,0x81,0x3f,0xb8,0x55,
+0x02,0xde,0x4a,0xdd,0x17,0x65,0xf3,0xee,0x00,0xa3,0x7a,0x49,0x4d,0xcb,0xc4,0xb2,0xc5,0x86,0x40,0x41,0xf5,0x06,0x42,0xdd,0xa5,0x0a,0xe5,0xfd,0x21,0xa6,0xde,0x5b,
+0xdf,0xd4,0xe1,0xed,0x21,0xc2,0xe4,0x0d,0xc0,0x42,0xbf,0xdf,0xca,0xa5,0x20,0xbb,0x79,0x42,0x79,0x3d,0x28,0x53,0x74,0x5d,0x12,0xe8,0xd7,0x5a,0x98,0x7c,0x39,0x9b,
+0xe6,0x60,0x5c,0x1f,0x18,0x0f,0xb7,0xcc,0xeb,0x3e,0xd0,0xbd,0x13,0xa6,0x2d,0x63,0x65,0xb8,0x54,0xca,0x9a,0xa1,0xbd,0x6e,0xa6,0xb6,0x36,0x4d,0xc0,0x4a,0xd7,0x3d,
+0x10,0x3f,0x98,0x9b,0x3a,0x00,0x04,0x3c,0xd5,0xcf,0xd6,0x92,0x01,0xf4,0xeb,0x02,0xa9,0x44,0xd9,0x26,0x2d,0xfd,0x06,0x3b,0xa4,0x41,0x7d,0xd2,0x27,0x66,0x03,0xa9,
+0xbc,0x5d,0xb3,0x08,0xd3,0x49,0x3b,0x89,0xf7,0x48,0xe7,0x58,0x23,0xba,0xfc,0x19,0x72,0xa7,0x4d,0x2c,0xb8,0xc3,0xf0,0x28,0xa8,0x82,0x48,0xac,0xad,0x95,0x6c,0x01,
+0x02,0x0e,0xa8,0x6b,0x69,0x3d,0x11,0x5d,0x3b,0x43,0x37,0xf6,0x38,0x44,0xad,0x2f,0xb6,0x88,0xb8,0x8f,0x14,0x4d,0x52,0x75,0x30,0xd9,0x56,0xb0,0x93,0xbb,0x6a,0xce,
+0xd8,0xc7,0xea,0x67,0x1d,0xaa,0xe5,0xc8,0x8e,0x98,0x25,0x3a,0x21,0x2d,0xe5,0xc8,0xa5,0xc0,0x81,0x07,0x0c,0xa5,0xf8,0x04,0xc6,0x86,0xb9,0xa9,0xac,0xc1,0x03,0xe8,
+0x14,0x8c,0x42,0xe9,0x04,0x4e,0x0f,0x0c,0xfc,0xbc,0x32,0x6f,0x8f,0x62,0x79,0xe2,0x81,0xe4,0xc4,0x70,0x96,0x11,0x6a,0xc3,0xde,0x44,0xee,0x19,0x2c,0x27,0x63,0x16,
+0x41,0x11,0x47,0x01,0x7c,0x67,0x95,0x1c,0x50,0xb1,0xc6,0x6a,0x9a,0x2e,0xb3,0x7b,0x7f,0x08,0x05,0x46,0xc6,0x88,0xf3,0x4d,0xa1,0x1e,0xa6,0xb7,0x2d,0x62,0x2a,0xd6,
+0xa8,0x09,0xd5,0xed,0xf7,0xa6,0xa1,0x3b,0x39,0xe4,0x3b,0xd4,0xa7,0x1a,0xda,0xf0,0xee,0x30,0x6a,0x53,0x8d,0x43,0xfd,0x43,0x05,0x2c,0x12,0x2d,0x00,0xc9,0x26,0xf4,
+0xe3,0xd4,0x5b,0x00,0x41,0xa6,0x12,0x80,0x75,0xf5,0x86,0x3e,0xca,0x79,0xbc,0xc9,0x94,0x0b,0x75,0x75,0x6d,0xad,0x0b,0xff,0xb4,0xe4,0xa3,0x72,0x40,0xfe,0x72,0xf2,
+0xae,0x16,0x84,0x3f,0x20,0x7d,0x59,0xe1,0x0b,0xfb,0xbf,0xf1,0xad,0xd7,0x4a,0x0d,0x30,0x0f,0x10,0xaf,0x8c,0x8c,0x1e,0xa3,0x88,0xe0,0xc4,0x77,0x64,0x24,0xc6,0x2b,
+0xe0,0x6f,0x0f,0xd0,0x88,0x80,0x50,0xde,0x33,0xb4,0xb6,0x23,0x33,0x77,0x59,0x46,0x36,0xa6,0x13,0xaa,0x20,0xec,0x2a,0xe1,0x62,0x1b,0xcb,0x90,0x8d,0xbb,0xfc,0x03,
+0x09,0xa3,0x44,0x78,0x9d,0xef,0x3f,0xae,0x20,0x2a,0x94,0xa7,0xaf,0xc4,0x01,0xed,0x4e,0xab,0x55,0x92,0xc8,0x82,0x85,0x6b,0x2b,0xa5,0x85,0xde,0x9d,0x11,0xd9,0xa1,
+0x51,0x64,0x85,0x0a,0xa1,0x87,0x45,0x33,0x6d,0x99,0x37,0xbc,0xf7,0xf5,0x68,0x35,0x00,0xc5,0xd7,0xc0,0x44,0x74,0x28,0x0f,0x94,0xd5,0x0b,0xea,0x45,0x8e,0x5b,0xd4,
+0x41,0x96,0xa9,0x1c,0x46,0x28,0xac,0x2b,0x38,0x2b,0x62,0xa1,0x71,0xc5,0xa5,0x06,0x74,0x68,0xb9,0x23,0xf8,0xab,0x6a,0x6e,0x88,0xca,0xae,0x03,0x2e,0x05,0xbe,0x41,
+0x39,0xcd,0xd0,0x8b,0x18,0x63,0xb5,0xf0,0xd4,0xc8,0x64,0xb5,0x7c,0x35,0x3a,0xa9,0x99,0xb7,0x36,0x88,0xac,0x33,0xe2,0x40,0x13,0x28,0x6b,0x30,0x86,0xde,0xdc,0x70,
+0x8f,0xd1,0xcb,0x99,0x6d,0x0f,0xae,0x26,0xcb,0xae,0xb7,0x37,0x03,0x28,0x42,0x6c,0xb6,0x1a,0x1f,0x29,0x9c,0x2b,0x47,0xc9,0x3a,0x03,0x37,0x02,0xc0,0x56,0xb5,0x29,
+0xe5,0x81,0x0a,0x99,0x5a,0x4c,0xba,0xc7,0x46,0x1d,0xb9,0xab,0x78,0x0f,0xc1,0x78,0x98,0x95,0xe4,0xa9,0xc6,0x1a,0xed,0x81,0xc5,0x5e,0xf8,0x30,0xa0,0x83,0xe9,0x67,
+0x22,0x54,0xb2,0x2d,0x3f,0x10,0x06,0xcd,0x48,0x34,0xbe,0x5d,0xb4,0xe2,0x0d,0xc9,0xdc,0x60,0x64,0x71,0x2b,0x35,0x12,0x8d,0x88,0xf6,0xc1,0x6c,0x3f,0x3d,0x00,0x85,
+0x2b,0xb0,0x00,0x60,0xdf,0x48,0x30,0x4a,0x79,0xd6,0x5b,0x80,0x40,0x07,0xf0,0x65,0x87,0x95,0x2e,0x87,0x4a,0xfc,0xe2,0x08,0x0a,0x59,0x87,0xde,0x92,0x9c,0xdd,0x8b,
+0xee,0xf0,0x81,0x0e,0x73,0x9d,0x10,0x78,0x2f,0xb7,0x73,0x23,0x70,0xbd,0x69,0x7d,0x0f,0xc0,0x05,0x14,0xc8,0xc0,0x22,0x19,0x04,0x57,0x48,0x13,0x86,0xbf,0x98,0x5c,
+0xfa,0xae,0x50,0x3a,0xde,0xcd,0xce,0xd5,0xca,0x74,0x21,0x30,0xd3,0xa2,0x35,0xae,0x2a,0x43,0x5c,0xd3,0xc2,0xfd,0x3f,0xa4,0x27,0xca,0x6c,0xc0,0xb8,0xf8,0xf0,0xa8,
+0xca,0x80,0x9c,0xf8,0x66,0xc1,0x64,0xa3,0x52,0x38,0xdc,0xcf,0x0b,0x3d,0xd3,0x17,0xa8,0x11,0x43,0x7e,0x18,0x0d,0xc5,0x0c,0x67,0xe0,0x72,0xf5,0x05,0xb8,0xc4,0x2c,
+0x22,0x0c,0x44,0x81,0xd0,0xdf,0xbc,0xaa,0x9a,0xcc,0xa3,0x3c,0x03,0x76,0x81,0x65,0xb4,0x11,0xca,0x44,0xff,0xc6,0x4c,0x8b,0x19,0x01,0x7d,0x8f,0xe7,0xec,0x0d,0x41,
+0x0d,0x0c,0xd8,0xef,0x54,0xf5,0x01,0x33,0xee,0xe2,0x0b,0x9c,0x99,0xe7,0xdf,0x49,0x10,0xd0,0xcf,0xd1,0x44,0x81,0x67,0xe7,0x2a,0xf9,0xf0,0x18,0xef,0x56,0x5d,0x83,
+0xa1,0x2b,0xbb,0xfb,0x17,0x4d,0x8e,0x17,0x53,0x38,0xab,0x7a,0x47,0x12,0x83,0xad,0x95,0x38,0xe0,0xe8,0x2f,0x3b,0x6c,0xb4,0x98,0x3f,0xae,0x62,0x8c,0x92,0x09,0xf6,
+0x51,0x18,0xde,0x5a,0xd8,0xf7,0xfa,0xd6,0xe4,0x3b,0xb9,0xe7,0x03,0x18,0x76,0x1d,0x77,0x89,0xf3,0x52,0xd0,0xb7,0x78,0x1f,0xe9,0x5a,0x5e,0x11,0xb6,0x58,0xb0,0x3e,
+0x09,0xd4,0xc0,0x91,0xfb,0xa9,0x26,0xb2,0xf2,0xb3,0xba,0xc4,0x41,0x34,0x18,0x44,0x5a,0x3d,0x70,0x75,0xb9,0xb0,0x13,0xf8,0xc8,0x86,0x95,0xa5,0x3f,0x05,0x55,0xcb,
+0x6a,0xa9,0x40,0xe9,0x06,0x2c,0x43,0xa2,0x29,0x31,0x54,0xf8,0x6a,0x34,0xa6,0xc0,0x5e,0x2a,0x62,0x1b,0x13,0x92,0x90,0x46,0x7d,0xd6,0x18,0x9f,0xd6,0x9c,0xe6,0x20,
+0x68,0x83,0x46,0x30,0x73,0xcc,0x31,0x35,0xe9,0x28,0xf4,0x61,0xc1,0xa8,0xe5,0x91,0xa1,0xad,0xb3,0x80,0x83,0x9c,0x59,0xf4,0x9e,0xbd,0xa8,0x41,0xd5,0x9c,0xce,0xac,
+0x09,0x02,0x09,0x4c,0xf6,0x9c,0x2c,0x54,0xab,0xd8,0x99,0x57,0x09,0x51,0x31,0x64,0x51,0xfc,0x74,0xf8,0x7e,0xa7,0x2f,0xe7,0x55,0x31,0xd1,0x80,0xf6,0x7a,0x11,0xe2,
+0x31,0xf1,0xdf,0xf8,0x92,0xa3,0x60,0x21,0xcf,0x34,0x52,0x10,0x7d,0x42,0xa5,0x8d,0x55,0x25,0xd4,0x96,0xd5,0x0d,0x16,0x94,0x1f,0x58,0x7b,0xdc,0x47,0xe3,0x31,0x55,
+0x02,0x75,0x77,0x37,0x0c
+};
+const size_t WM_PK_OTA_REMOTE_JS_BR_LEN = 4741;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_OTA_REMOTE_JS_BR[] PROGMEM = {
+0x1b,0x4f,0x38,0x23,0x11,0xc2,0xc6,0x41,0x78,0x18,0xef,0x6c,0x11,0x55,0xa4,0x3e,0x40,0x2d,0x0f,0xb8,0x21,0x03,0x6d,0xe0,0x73,0x84,0x82,0xca,0x70,0xd4,0xa0,0x19,
+0xe2,0x58,0x98,0x63,0x7c,0x9c,0x2d,0x16,0xcb,0x63,0xfe,0xc5,0xae,0xbb,0x9b,0xa3,0xdb,0xd0,0x2a,0x2f,0xbb,0x53,0x77,0x19,0x8f,0xd0,0xd8,0x27,0xb9,0xff,0x9b,0xce,
+0xba,0xef,0xe5,0x64,0xb6,0xf8,0x4b,0xb1,0x31,0x25,0x1d,0xf3,0x49,0x69,0xa4,0x32,0xa5,0x13,0x26,0x2b,0x2c,0x19,0x04,0xb2,0xec,0x91,0x84,0x09,0x10,0xcf,0xfd,0xc2,
+0x1b,0xd0,0x8d,0x95,0x94,0x07,0x7f,0x30,0x98,0x34,0x09,0xd7,0xc2,0xa9,0x72,0x11,0xd4,0x29,0xf7,0xa2,0xb3,0x2b,0xcf,0x38,0x3a,0x0f,0x00,0x0b,0xd0,0x98,0x80,0x24,
+0xf0,0xfd,0xaa,0x3f,0xf8,0xe6,0xf4,0x4f,0x9e,0x68,0xd7,0x76,0xdb,0x72,0x28,0x7b,0x12,0x0b,0x27,0x90,0xd4,0x0a,0x10,0xca,0xa6,0xe7,0x15,0x58,0x19,0x6a,0x9e,0xa1,
+0xe5,0xfd,0x9f,0x4d,0x33,0xa5,0xd6,0x52,0x18,0x2b,0x2a,0xaa,0xa4,0xa8,0x4e,0x0e,0xd1,0xeb,0xa9,0xe4,0x52,0x8d,0xf7,0xcf,0xff,0x3b,0xa7,0x99,0x5d,0xc9,0x5e,0xed,
+0x9a,0x57,0x4e,0x8c,0x07,0x28,0x3b,0xc0,0x3b,0xb3,0x92,0xe9,0x50,0xf2,0x01,0xb3,0xaa,0x00,0x50,0x95,0xd7,0xe7,0xf5,0x69,0xf3,0xde,0x1d,0x17,0x55,0xba,0x32,0x6d,
+0x9a,0x36,0xba,0x0d,0xb1,0x6b,0xc6,0xf9,0x05,0xd4,0xcd,0x1e,0xc3,0x39,0x8c,0xb9,0x57,0x31,0x01,0xc5,0xd8,0xa3,0x96,0xc3,0xb0,0xaf,0x7b,0xef,0xfe,0x16,0x11,0x44,
+0x90,0xd0,0xaa,0xcd,0x7a,0x67,0xf2,0x8f,0xf2,0xfe,0xcd,0x9a,0x2b,0x21,0x74,0xed,0x99,0x9d,0x61,0x22,0xc6,0x12,0xed,0x53,0x14,0x52,0xbb,0xa5,0x42,0x2e,0xbc,0xed,
+0x23,0x51,0x61,0x39,0x37,0xcc,0xd7,0x49,0x14,0x6d,0xc8,0x10,0xdf,0xdd,0x58,0x56,0x4a,0xf9,0xf1,0x9b,0x25,0x42,0xa4,0x5c,0x25,0xcd,0xb5,0x28,0x9f,0xdf,0xe2,0x6c,
+0xe6,0xcf,0x88,0xaa,0xc8,0xdf,0xae,0x7c,0x5f,0x45,0x2f,0x2f,0xc2,0xbe,0x87,0x91,0xe7,0xfb,0xdf,0x83,0x90,0xcb,0xfb,0xea,0x68,0xca,0xec,0x60,0xa9,0x9f,0xff,0x04,
+0xff,0x90,0x46,0xa0,0x42,0x10,0x6d,0x2a,0x60,0x57,0xd1,0xe5,0xb6,0x8e,0xaa,0x74,0x32,0x78,0xc0,0x8d,0x32,0xee,0xb5,0xb3,0xa9,0x9c,0xaf,0xab,0x4a,0x22,0x99,0xf4,
+0xd7,0x52,0x08,0x67,0xe7,0x17,0x97,0x57,0xd7,0x37,0xfd,0xdb,0xbb,0xfb,0x87,0xc7,0xa7,0xc1,0xbb,0xf7,0x1f,0x3e,0x7e,0xfa,0xfc,0xe5,0xeb,0xb7,0xef,0x3f,0xd8,0x38,
+0xe1,0x22,0x9d,0x4c,0xe5,0x6c,0xae,0x32,0x9d,0x17,0xbf,0x8c,0x75,0x8b,0x72,0xf9,0xba,0x5a,0x37,0xdb,0xae,0x1f,0xc6,0xe9,0x3c,0x5f,0x52,0x03,0xc2,0x14,0x37,0x26,
+0x77,0xaa,0x13,0x7f,0x87,0x0d,0xb9,0x9c,0x9f,0x67,0xbb,0x5d,0xfe,0x66,0x7b,0xdb,0xd6,0x77,0x35,0xaf,0x48,0xbe,0x67,0x06,0xd0,0xd8,0xc1,0x5c,0x7b,0x14,0x9a,0x4b,
+0xa6,0x43,0x9d,0x4c,0x97,0x29,0xb1,0x51,0x35,0xd1,0x9d,0x1b,0x44,0x4d,0xf5,0x69,0x88,0xc6,0x4d,0x23,0x5e,0xbe,0x8d,0xd8,0xf0,0x08,0x31,0xcc,0x1e,0xf2,0x94,0xff,
+0x37,0x7c,0x53,0xf9,0x13,0x5d,0xb3,0x95,0xa8,0xa1,0x4a,0xe9,0xe2,0x6b,0x38,0x36,0xc5,0xbb,0x5a,0xfc,0x51,0x3c,0x08,0xe8,0x6d,0xc8,0x47,0x6b,0x1a,0xb1,0x21,0xc8,
+0x35,0xbc,0x20,0xb4,0xdb,0x8a,0x65,0x61,0xeb,0xf3,0x95,0x13,0x96,0xc5,0x50,0xa4,0x1f,0x3d,0x1c,0xc9,0xf6,0xb2,0x6c,0xbd,0x4e,0x03,0x2f,0x85,0x61,0x25,0x57,0x95,
+0x73,0xfa,0xa9,0x3d,0x4e,0xa0,0x10,0xe3,0x62,0x1c,0xb7,0xfb,0x29,0x7f,0x62,0x5b,0x91,0x9b,0xbf,0x41,0x86,0x4d,0x26,0xd8,0x14,0x63,0x3e,0xc6,0xfe,0xe1,0x30,0x09,
+0xf0,0x08,0x81,0x0f,0x93,0xde,0xb6,0x8d,0xef,0x07,0xda,0x21,0x1b,0x2d,0xdd,0xf6,0x50,0x27,0xff,0xa9,0x23,0xc4,0xca,0xd0,0x79,0x20,0x47,0x09,0x10,0x26,0x32,0x65,
+0x67,0xb7,0x13,0x73,0x28,0x96,0x19,0x8c,0x94,0x99,0x1c,0xaf,0x6e,0xa8,0xd9,0x7f,0xea,0x62,0x7b,0x1c,0xe5,0x59,0xd1,0xbe,0x78,0x1d,0xf5,0x92,0x70,0x22,0xe0,0x61,
+0xdf,0x38,0xe0,0xdf,0x1b,0xd9,0xaa,0x35,0x01,0xc4,0x59,0x56,0x6c,0x8d,0x8e,0x33,0x01,0xff,0x2b,0xc8,0x0c,0x00,0xd4,0x39,0xf5,0xc1,0x14,0x19,0xa6,0x0b,0xdb,0xbc,
+0x32,0x1b,0x6e,0xbf,0xc7,0xec,0xfe,0x13,0x16,0xb6,0xc1,0x56,0xfe,0xc1,0xf3,0x16,0x17,0xd9,0xc1,0x40,0x2c,0xb6,0x6b,0x61,0x39,0x49,0xc6,0xb5,0xb4,0xa6,0xa3,0x68,
+0x08,0x5a,0x2e,0x8f,0xdc,0xf8,0xf6,0xb0,0x21,0x27,0xc9,0xee,0x9e,0x64,0x42,0xbd,0x97,0xed,0x1c,0x25,0xb9,0x73,0xb0,0x60,0x26,0xf9,0x47,0x3b,0xc7,0x39,0x15,0xbd,
+0x92,0x2d,0x76,0x06,0xba,0xf0,0xf1,0xd3,0x89,0xec,0xd6,0x92,0xc6,0x83,0x1e,0x28,0x48,0xcb,0x07,0x84,0xa4,0x92,0x63,0xee,0x23,0x0f,0x4b,0x58,0xb4,0x75,0xfa,0x17,
+0x0e,0x7f,0x9e,0xd5,0x7f,0x34,0xeb,0xe3,0xf4,0xdc,0x18,0xbd,0xca,0x49,0xd8,0xd0,0x96,0xa4,0xa2,0xf5,0x09,0xda,0x27,0xb1,0xff,0x8c,0x90,0xd4,0xb0,0x19,0xfd,0x6c,
+0x1c,0xa6,0x5e,0xdc,0x95,0xb1,0x8c,0xf7,0x63,0xf5,0x16,0x10,0x4b,0xca,0xfb,0x17,0xf9,0x92,0xb4,0x59,0x6f,0x9f,0x92,0xe0,0x08,0xd0,0x7e,0x2e,0xdd,0x64,0xa7,0x7d,
+0xcc,0xe7,0x52,0x88,0x9b,0xae,0x29,0xe1,0x4c,0xe9,0x71,0xbd,0x46,0x35,0x60,0x0e,0xd3,0xaa,0x19,0xb8,0x6c,0xea,0xe3,0x2d,0x1f,0x11,0x5e,0xe3,0x66,0xe1,0xd2,0xa3,
+0xb2,0x69,0x3f,0xb5,0xd2,0x87,0xeb,0xeb,0xbd,0x5e,0x47,0x63,0xa9,0x23,0xd4,0x2c,0x69,0xd1,0xa3,0x5a,0x9e,0x3e,0x45,0x01,0xad,0x40,0x0d,0x8d,0x8c,0xba,0x32,0x17,
+0x73,0xd3,0x1e,0x89,0xaa,0x91,0x60,0xc4,0xa6,0x2d,0xa8,0xd4,0x5c,0x73,0x85,0xab,0x49,0x0d,0x7b,0x83,0xed,0x2a,0x61,0xd5,0x67,0x44,0xaa,0x2a,0xf0,0x4c,0xd9,0xad,
+0xcf,0x1c,0xb1,0xb4,0x04,0x8f,0x96,0xf2,0x3f,0xf8,0x44,0x70,0x76,0xf8,0xbe,0x1e,0xce,0x05,0xb5,0x3d,0x10,0x35,0xb4,0x23,0x4c,0x21,0x05,0xec,0xe7,0xce,0x5b,0xbc,
+0xce,0xa5,0xb1,0x06,0x98,0x5a,0xad,0xaa,0x86,0x7d,0xb7,0x0f,0xf1,0x7d,0xf2,0x48,0x14,0x3d,0xde,0xde,0x9d,0xfb,0xd6,0x5a,0x4d,0x45,0x2f,0xd2,0x9e,0x2f,0xd2,0x54,
+0x18,0xea,0x6a,0x6b,0xc7,0x79,0x04,0xbc,0x70,0xd3,0xe1,0xfb,0xfe,0xd2,0xa1,0x7a,0x4b,0x26,0x8a,0xe8,0x06,0x44,0x58,0x01,0x88,0xbe,0x5d,0x83,0x28,0xea,0x7d,0xab,
+0xe1,0xef,0x38,0xe5,0xd1,0x43,0x37,0x66,0x5f,0xae,0x55,0xce,0xdc,0xc3,0x55,0xac,0x1c,0x8b,0xf5,0xa1,0x35,0xb7,0xfb,0x8f,0xe4,0xa6,0x2a,0x48,0x93,0x4d,0xc0,0x43,
+0x9b,0x5d,0xd0,0x0f,0x53,0xbc,0x8d,0x14,0xf7,0x4d,0xb4,0x38,0x08,0x39,0xde,0xea,0x4a,0x47,0xc8,0x70,0xdd,0x9c,0x84,0xd2,0x47,0x49,0x1a,0x4b,0xcc,0x8d,0x69,0x27,
+0xd2,0xf7,0xe5,0x57,0x5f,0x79,0x19,0x11,0x61,0xfc,0x98,0x98,0x59,0xc1,0x9e,0x20,0xd7,0xef,0xe6,0x84,0x16,0xe0,0x6e,0x52,0x38,0x63,0x8e,0xb0,0x67,0x91,0x87,0x3a,
+0x2b,0xc8,0x39,0xf6,0x51,0x06,0x24,0x61,0x13,0xa5,0x86,0x94,0x93,0xf6,0xbc,0x39,0x57,0x1e,0x7d,0xb6,0xde,0x52,0x43,0xfc,0x2c,0xb5,0x3b,0x42,0xb9,0xd5,0xf7,0x49,
+0x82,0xbc,0x26,0x1f,0x46,0xab,0x94,0x35,0x0d,0xaa,0xa8,0x59,0x04,0x0e,0xfa,0x58,0x60,0x52,0xed,0xfd,0x41,0x6a,0xdc,0xd7,0xa8,0xb2,0xe6,0xe9,0x09,0x54,0xc3,0x91,
+0x76,0xee,0xe5,0xe8,0xe6,0x5e,0x3f,0x87,0xee,0xdd,0xfb,0x16,0xf8,0xbe,0x16,0x5d,0xa3,0xb6,0x35,0x8b,0x02,0x33,0x5c,0x8c,0x90,0x9c,0x83,0x4a,0x17,0x76,0xac,0x6d,
+0x0b,0x77,0x26,0x08,0xa1,0xb1,0xec,0x47,0x6e,0x9f,0xa2,0x4e,0x9c,0xa2,0xe5,0x6d,0x6e,0xd5,0x6a,0xfa,0xe7,0xbc,0xe1,0x99,0x21,0xf9,0x09,0xd6,0xd8,0xa7,0xdd,0xaf,
+0xc5,0x1f,0xf4,0x37,0xd1,0x5a,0xc8,0xf7,0xe6,0x0c,0x59,0xf4,0x92,0xa6,0xe1,0xe4,0xfc,0x2d,0x93,0x49,0x38,0xbd,0x65,0x3a,0x0d,0x57,0x63,0x48,0xc9,0x6a,0x3b,0xb6,
+0x26,0x55,0xf8,0x5d,0x17,0xa8,0xc3,0x8f,0x28,0xc2,0x39,0xe6,0xe1,0x0b,0xba,0x58,0x63,0x46,0x74,0x28,0xc2,0x3c,0x74,0xe1,0xfb,0x7d,0x82,0xc6,0x88,0x6f,0xce,0xd3,
+0x8b,0x9d,0x3e,0xf5,0x87,0xff,0x48,0x9e,0x63,0x00,0x88,0xb1,0x9e,0x65,0x77,0xd2,0x5e,0xda,0x59,0xe3,0xaf,0x97,0x33,0x00,0x18,0x35,0xe3,0xbc,0x45,0x13,0xbb,0x9e,
+0x67,0xc6,0x6f,0xa4,0x22,0xff,0x40,0x4c,0xe7,0xb4,0xea,0x21,0xec,0x54,0x24,0x7c,0xc8,0x4a,0xdc,0xa9,0x70,0xda,0xdc,0xbd,0x89,0x27,0xb5,0x0a,0xc0,0xc2,0x15,0xef,
+0xe3,0x81,0x1e,0x95,0x28,0x33,0x24,0xa6,0x0a,0x67,0x90,0x5b,0x41,0xcd,0x56,0xd7,0x0c,0xa0,0x98,0x29,0x92,0x38,0x58,0x2e,0xdf,0x0f,0xd3,0xe6,0x78,0x8f,0xb0,0xdb,
+0x71,0xa1,0xb5,0xf5,0x49,0x9b,0xca,0x1d,0x0c,0xb3,0x2b,0xc7,0xe2,0x25,0x95,0x85,0x1b,0xea,0x2d,0x8f,0xb2,0x55,0x19,0x32,0x09,0x8e,0x09,0x1f,0x27,0x06,0x05,0x54,
+0x1d,0x0e,0xf1,0x7c,0x40,0xa5,0x8e,0xa2,0x3a,0x57,0x8b,0x2f,0xf8,0x66,0x1e,0x76,0xe6,0x3a,0x84,0x4b,0x02,0x49,0x9f,0x3e,0x7d,0x33,0xfa,0x02,0xb6,0xca,0xd4,0xc2,
+0xe0,0x07,0xf9,0xad,0x35,0x9c,0xa1,0xc6,0x64,0x69,0xe8,0x71,0xc1,0xa3,0xd1,0xde,0x08,0x35,0xc4,0x93,0xca,0x80,0xc9,0xf6,0xd1,0x25,0xa0,0xe1,0x6f,0x2c,0x0f,0x2b,
+0x1f,0xcf,0x71,0xd0,0x0d,0xcf,0x4a,0xf1,0x09,0xa7,0x62,0x24,0x9a,0xf5,0xd6,0x5c,0x75,0xd3,0x6b,0xb7,0xb5,0xe0,0x38,0x41,0x52,0xe0,0x2d,0xd4,0x07,0x5b,0xbb,0x54,
+0xb8,0xa3,0xd6,0x35,0xe3,0x7b,0x53,0x6c,0x3d,0x01,0x03,0xba,0x94,0xbf,0x1a,0xbd,0x9d,0xa5,0x7b,0x82,0x2c,0xd7,0x19,0x1a,0xe2,0x44,0x6c,0xe3,0xe3,0x36,0x39,0xbf,
+0x9e,0xf5,0x08,0x5c,0x96,0x07,0x5d,0xbd,0x4b,0x75,0x63,0x46,0x1e,0xb5,0x9c,0x89,0xf9,0x6a,0xcd,0xc2,0x94,0x14,0x08,0xd3,0x49,0x3e,0x77,0x3e,0x4d,0xce,0xd8,0x6d,
+0x6a,0xc9,0xe0,0x07,0xf6,0x6b,0x75,0x10,0xd2,0x35,0x24,0x27,0xe8,0x63,0xaa,0x42,0x11,0x2e,0x69,0x4e,0xe2,0x14,0xc4,0xd9,0xce,0x15,0x1a,0xdc,0xc4,0x5d,0x5d,0x35,
+0xb5,0x27,0xc5,0xc9,0x71,0xa9,0x62,0xe2,0x9b,0x56,0x02,0xc7,0x89,0x38,0x8f,0xd0,0x86,0x11,0xf2,0xd5,0xec,0xb2,0xe6,0x38,0xb6,0x35,0x00,0x79,0xf6,0x67,0xa3,0xa9,
+0x2a,0x48,0x28,0x95,0xa9,0x4a,0xf1,0xe6,0x64,0xbb,0x2a,0xae,0x51,0xc7,0xbd,0x49,0x5e,0x92,0x54,0xd3,0x86,0xda,0xde,0x01,0x8f,0xe5,0x53,0x71,0x71,0x99,0x55,0x72,
+0x8c,0xaf,0x66,0x84,0x71,0xa5,0x00,0xf1,0xfa,0x00,0x77,0x91,0xb6,0xc3,0x90,0x7c,0x0c,0xb1,0x86,0x7b,0x29,0x6f,0x17,0xd6,0x4e,0x1e,0xd2,0x1d,0x94,0xbd,0x7f,0xf5,
+0x1e,0x4d,0x56,0x6a,0xd9,0x30,0xdb,0x40,0x89,0x68,0xf3,0xa1,0xe4,0x26,0x6f,0x24,0xc6,0xce,0x8c,0x55,0x7a,0x23,0x78,0x71,0x59,0xfe,0x38,0x34,0x80,0x37,0x19,0x0e,
+0x71,0x1d,0x2f,0xdc,0xf3,0x6d,0x37,0xda,0x9f,0x8f,0xfd,0x40,0x98,0xd2,0x94,0xe0,0x71,0x28,0xc4,0x57,0x35,0x77,0x46,0xae,0x4b,0x65,0x47,0xa2,0x94,0xf3,0x18,0xa8,
+0x42,0x68,0x72,0x6c,0xeb,0xb4,0x73,0xd3,0xd5,0xcc,0xf2,0xb4,0xb0,0x52,0xbe,0xba,0x84,0x63,0xd8,0x06,0xdb,0xb9,0x53,0x95,0x93,0x12,0x06,0x90,0xa0,0xf9,0xbf,0x18,
+0x14,0xa1,0x39,0x59,0xae,0x9a,0xe3,0xce,0x4e,0xe5,0x8c,0x7d,0xdb,0xb4,0x34,0xb6,0xa8,0x25,0x1f,0xee,0x54,0xe8,0xe0,0xa2,0xb7,0x6d,0x99,0x02,0x45,0xf0,0xf1,0xd2,
+0x1d,0x39,0xe6,0xc1,0xfc,0x76,0x87,0x2e,0x78,0xc9,0xf8,0x1d,0x35,0x19,0x75,0xdf,0x8a,0x33,0x94,0xa0,0x6b,0x04,0x57,0x67,0x48,0xed,0xc6,0x76,0x87,0x26,0x2c,0x04,
+0xc0,0x6e,0xcf,0x17,0x3b,0x4c,0x02,0x22,0x7d,0xf3,0xf6,0x5b,0xfa,0x05,0x4d,0x44,0x47,0xdc,0x8d,0x94,0xc7,0x61,0x20,0x71,0xdd,0xae,0x78,0x73,0xf7,0x35,0xcd,0x24,
+0x68,0x92,0x15,0xe3,0x51,0x4f,0x26,0xcf,0x4c,0xf1,0x66,0xfc,0xdf,0x8f,0x76,0x3a,0x5d,0x35,0x3f,0xcd,0xcf,0xe9,0x51,0x4a,0x59,0xb7,0xeb,0xd6,0xd3,0xf2,0xf6,0xbb,
+0xa0,0xec,0xbe,0x52,0x76,0x77,0xbe,0xdb,0x9a,0xae,0x7b,0x15,0x97,0x13,0x61,0x9d,0xcf,0x3c,0x2c,0x03,0xab,0xc4,0x59,0x23,0x42,0xb6,0x5c,0x82,0x2d,0xad,0x0f,0xa3,
+0xc1,0x4d,0x4d,0xbe,0xf4,0xb4,0x58,0xce,0xb2,0xa6,0x95,0xc0,0x93,0x04,0xa0,0xd7,0xe9,0x6d,0xb4,0xb6,0xd3,0x40,0x42,0x55,0x53,0x57,0xe4,0x4a,0x39,0xc2,0x80,0xf2,
+0xa6,0x1e,0x6b,0x7b,0xe4,0x98,0x35,0x0f,0x4e,0x4c,0xe7,0x10,0x35,0x4c,0x46,0xe3,0x0d,0xdd,0x2d,0x0c,0x2d,0x2a,0x12,0x1f,0x99,0xbd,0xac,0xb7,0xdf,0x9b,0x3e,0x23,
+0xfe,0x24,0x66,0x9d,0xf6,0x01,0xcf,0xc8,0x67,0xcf,0x2a,0x6d,0x3e,0x88,0x60,0xcf,0x6f,0x83,0xfb,0x0f,0x7d,0xc9,0x72,0xce,0xd4,0x85,0xb5,0x08,0xd1,0xae,0x53,0x17,
+0x58,0x67,0x37,0x3a,0x10,0x26,0x93,0x3e,0xb6,0x58,0x6a,0x2b,0x5c,0xa7,0xa9,0xf3,0x12,0xd4,0x9b,0x89,0xb7,0x91,0x26,0xff,0x16,0x4d,0x53,0x59,0x3b,0x12,0xc8,0x9a,
+0xce,0xbf,0x8c,0x35,0x07,0xb2,0x7e,0x5f,0x8b,0xa4,0x7e,0x24,0x1d,0x4d,0xf8,0x5a,0x98,0x96,0x91,0x25,0xa6,0x06,0x7d,0x50,0x8f,0x57,0xc1,0x5f,0xd8,0xb0,0xf3,0x2c,
+0x29,0x62,0x7a,0xa6,0x68,0xd1,0x0e,0x67,0xfb,0x1c,0xc3,0xb8,0x5c,0xd8,0x4e,0x74,0x38,0x5e,0x45,0x16,0x93,0xe9,0xab,0x4a,0xf6,0x86,0xe6,0xdd,0x16,0xaf,0xde,0x6e,
+0x3b,0x09,0xa3,0x38,0x2d,0x6a,0xcf,0x90,0x96,0xc0,0x6d,0x37,0x0e,0x5d,0xaf,0xed,0x3a,0x42,0x1e,0x1e,0x64,0x52,0xeb,0x6e,0x44,0x5b,0x7f,0x80,0x38,0x35,0xd9,0xe2,
+0x5e,0x12,0x48,0x97,0x34,0xdf,0x7e,0xa7,0x14,0x60,0xfb,0xa4,0x64,0x19,0xb6,0x7f,0x5e,0x20,0xe6,0xfd,0x19,0xb7,0x47,0xb6,0xda,0x99,0xed,0x36,0x33,0x6a,0x8d,0xd0,
+0xd9,0x7a,0x9c,0xba,0xbe,0x08,0x34,0x5c,0x95,0xfe,0xda,0xe1,0xea,0xd9,0xcf,0xcf,0xba,0x42,0x31,0x24,0x00,0xf8,0xde,0xe3,0x45,0x7b,0x3b,0x71,0x58,0xab,0xd4,0xa9,
+0x6a,0xa4,0x51,0xc4,0xaa,0x59,0x50,0x44,0xb6,0xb6,0xa2,0x76,0xc0,0x18,0xc6,0x5d,0xe7,0x62,0xa5,0xb3,0x70,0xad,0x07,0xa1,0x6f,0xe3,0xf2,0xcd,0x0d,0x43,0xde,0x64,
+0x72,0xc7,0x8e,0x46,0x76,0xa7,0xfc,0x27,0x26,0xd4,0xa3,0xbc,0x27,0xb3,0x93,0x0d,0x72,0xb7,0x1e,0xb6,0xf3,0xf9,0xa2,0xd1,0x18,0xe0,0x4f,0xe5,0x4a,0x45,0xb2,0x79,
+0x94,0xa9,0x15,0x64,0xfd,0x2e,0x24,0x3b,0x0b,0x23,0xea,0xe8,0x2a,0xc0,0xfb,0x12,0xed,0x36,0x2e,0x29,0x09,0x22,0x4e,0xd2,0xbb,0xf6,0x61,0xce,0x8a,0x16,0x95,0x12,
+0xf6,0xee,0x74,0xdd,0xe4,0xcb,0x0d,0x81,0x05,0x13,0x56,0xe0,0x54,0x14,0x61,0x29,0xca,0x35,0x1e,0x41,0x0a,0x60,0x7e,0x89,0x2c,0x71,0x40,0x12,0x76,0x0b,0x35,0x45,
+0x71,0xa5,0xa3,0x37,0x6d,0x0c,0x68,0x43,0x62,0x1c,0xe8,0x3a,0x57,0x69,0x5f,0x96,0x5e,0x09,0x4b,0xd4,0x18,0x60,0xcd,0x89,0x8d,0xb4,0x8e,0xca,0x74,0xbe,0x85,0xb5,
+0x37,0xa3,0xc4,0x89,0x45,0x98,0xe7,0xa2,0x56,0x60,0x8b,0x22,0xc4,0x35,0xda,0xf0,0x4a,0x1e,0x84,0xba,0x3b,0xe7,0x91,0x05,0x48,0xc2,0xec,0x66,0xab,0xa6,0x9e,0xce,
+0x18,0xcb,0x1e,0x80,0x0b,0xcf,0x96,0x55,0x65,0xb3,0xc9,0xa7,0xee,0x19,0xb2,0x91,0xe4,0xe8,0xb8,0x5c,0x56,0x51,0xc4,0xb9,0x4f,0x36,0x06,0x06,0x0a,0x2c,0x55,0x53,
+0xb5,0xa6,0xa5,0xaa,0xe4,0x4a,0xa0,0xc1,0x92,0x1f,0x54,0xbe,0xd2,0x41,0x76,0x88,0x02,0xd2,0x09,0x75,0x5b,0x95,0xa8,0x05,0x0c,0x79,0xe4,0xd4,0xcc,0x4e,0x90,0x58,
+0xeb,0xa8,0x21,0xea,0xfa,0x7c,0xba,0x1b,0x14,0x74,0xe0,0x83,0xf8,0x03,0xe8,0x0f,0xf7,0x0a,0x23,0xc6,0x52,0x4c,0x59,0x14,0x45,0x00,0x60,0xc5,0xb8,0x2c,0x43,0x6b,
+0xe2,0xe6,0x67,0x66,0xd9,0x68,0x9d,0xce,0x55,0x4e,0x2a,0xc1,0x06,0x5f,0x88,0xf6,0xa8,0x01,0x91,0x4d,0xcf,0xc0,0xea,0x5a,0x9f,0xa1,0x97,0xfa,0xaa,0x05,0xe2,0x3b,
+0x26,0xac,0xce,0x8d,0x09,0x2d,0x65,0x8b,0x57,0x9e,0x6f,0x99,0x7b,0x33,0x77,0x03,0x50,0x1b,0xeb,0x41,0xf1,0x6c,0x38,0xf1,0x19,0x3c,0xc9,0x9b,0x5d,0xe6,0x42,0x3b,
+0x77,0x14,0x81,0xe0,0x96,0xfb,0x81,0x7b,0xa3,0xc4,0x1a,0x45,0x25,0x55,0x4c,0x0e,0x46,0xac,0xaf,0x11,0x06,0x3b,0x32,0xbf,0x43,0x45,0xad,0x22,0xa3,0x6b,0xd3,0xf5,
+0xba,0xa5,0x15,0x13,0x0a,0xe9,0x0b,0xb0,0x92,0xa0,0xa0,0xde,0x5a,0x28,0xfa,0xaf,0x28,0x45,0x68,0xa3,0xbd,0xea,0x2e,0x36,0x61,0x53,0x0f,0x5a,0xda,0x51,0xdd,0x0a,
+0x49,0x61,0x03,0xe2,0xca,0xd9,0x52,0xcd,0x67,0x54,0xb9,0x1a,0x75,0x43,0x36,0xba,0xe2,0xf0,0xfc,0x5d,0x76,0x8c,0xe9,0x33,0x27,0x84,0xb7,0xfd,0x6a,0x05,0xbd,0xa6,
+0x0e,0x8b,0x0f,0x07,0x12,0x2d,0x3d,0x40,0x30,0x4f,0xb4,0xd7,0xf0,0x4a,0x54,0x1a,0x51,0xa4,0x09,0x58,0xc4,0x59,0xd4,0xbb,0x7a,0x04,0x16,0x7d,0x2f,0x80,0x2a,0x47,
+0xf7,0xa4,0xbf,0x3c,0xc6,0xf9,0xfb,0x38,0xcb,0x49,0x50,0x98,0x7c,0x32,0x7f,0x5d,0x8d,0xe6,0x35,0xab,0x3e,0xc7,0xbd,0x5a,0x9e,0x30,0xc6,0x2e,0xcf,0x56,0x1f,0x9d,
+0x4a,0x4e,0xc6,0x8b,0x34,0x74,0x6c,0x42,0x0d,0x82,0x3b,0xc6,0x4a,0x4e,0x48,0x18,0x09,0x76,0xac,0x58,0x93,0xee,0x37,0x4c,0x29,0x4b,0x5e,0x89,0xf8,0x27,0x1b,0x42,
+0x1b,0xb1,0x27,0x08,0x18,0x26,0xca,0xeb,0x56,0xc2,0x79,0x9a,0x19,0x1f,0xc7,0xb2,0xba,0xc6,0xba,0xdb,0x63,0xba,0x1a,0x61,0xd6,0x98,0x7e,0x5b,0xa0,0xe6,0x9a,0xbb,
+0x34,0x66,0xf3,0xcd,0xba,0xf6,0x8d,0x19,0xf0,0xa6,0x2f,0x1d,0x0f,0x65,0x30,0x1b,0xdd,0x23,0xba,0xf1,0x70,0x36,0x82,0x39,0xc7,0xde,0x10,0x32,0x56,0xa6,0x03,0xab,
+0x30,0xb9,0xcc,0x0c,0x7d,0x70,0xe5,0x58,0xeb,0x08,0x7b,0x6b,0xcc,0x51,0x06,0x60,0xd9,0xaa,0x1d,0x34,0xce,0xbb,0x07,0xeb,0x7d,0x5f,0xd2,0xf3,0xeb,0x81,0xca,0x3c,
+0x39,0x16,0xd3,0xc3,0xd1,0xe9,0xd0,0x3c,0x08,0x68,0x29,0xe3,0x85,0xfc,0x8a,0x4b,0x71,0x29,0x17,0xba,0xf8,0xba,0x4a,0x8e,0x69,0xb6,0x72,0x0a,0x55,0xc7,0xf6,0xb8,
+0x0a,0x11,0xd8,0x76,0xd9,0x5a,0x57,0x24,0xa1,0x33,0xa5,0x6b,0xcf,0x2d,0x7d,0xcf,0x44,0x3a,0xa4,0x7b,0x88,0x13,0x4e,0xbe,0xc2,0x64,0xb0,0x60,0x60,0xef,0x0c,0x16,
+0xe9,0x70,0x9e,0x91,0xb6,0x0f,0x82,0x6d,0xb6,0xcc,0x68,0x1d,0x99,0x78,0x86,0x63,0xfa,0x7f,0x2b,0x21,0x05,0xc3,0x88,0xe4,0xf7,0xcc,0x10,0xd7,0x03,0x08,0x97,0x03,
+0x88,0x92,0x74,0x8f,0x19,0xdf,0x5f,0x3f,0x10,0xfb,0x0e,0x7d,0x9a,0x34,0x5d,0x4a,0x8e,0xf4,0x11,0xfe,0xf3,0x8d,0x21,0x9c,0xee,0x3c,0x9e,0xdd,0xc8,0x64,0xe7,0xb4,
+0x33,0x5d,0x76,0xe0,0x79,0x85,0x4b,0x61,0xb6,0x07,0x94,0x02,0x7a,0x61,0x14,0xfd,0x78,0x89,0x9a,0x50,0x8c,0x14,0x90,0x4d,0xc6,0xf7,0x89,0x4d,0x43,0x58,0x52,0xc1,
+0xbd,0xa8,0x32,0x05,0x45,0x01,0xf5,0x54,0xb2,0x31,0xde,0x2c,0x13,0x78,0x5c,0xe2,0xcc,0x9e,0x79,0xd1,0x40,0xd2,0x39,0x09,0x62,0x00,0x70,0xec,0xf4,0x30,0x12,0x93,
+0x06,0x5f,0x3b,0xb9,0x28,0xfb,0x01,0x06,0x56,0xc0,0x2d,0x2d,0xf1,0xf6,0x46,0x1c,0x7c,0x41,0x2a,0x5c,0x32,0x25,0xd0,0xb0,0xbf,0x4e,0xf8,0x2b,0xfe,0x71,0x01,0xeb,
+0xc2,0xd5,0x69,0xb0,0x77,0x5d,0xa3,0xaf,0x1c,0xc5,0x2a,0x79,0xad,0x4b,0x60,0xcf,0xfc,0xc2,0x86,0x43,0xaf,0x88,0x2b,0x44,0x85,0xfd,0x44,0x0b,0xbe,0xa7,0x12,0x7b,
+0x40,0x8a,0x90,0x1a,0xb0,0x10,0x15,0x70,0x77,0x65,0x1d,0xd7,0xba,0x2e,0x5b,0x2f,0x8a,0x53,0x82,0x0d,0x4b,0xf7,0x63,0x12,0x71,0xb7,0x80,0x86,0x4d,0x49,0xa0,0x3f,
+0x0a,0x74,0x8e,0x98,0xc9,0x02,0x74,0xdb,0xef,0x89,0xe5,0xb4,0x9a,0x5d,0xaa,0x29,0x23,0xc2,0x71,0xb4,0x07,0xb5,0x18,0x30,0x81,0xff,0x87,0xd5,0x0c,0x3d,0x09,0xbc,
+0x73,0xd7,0x2c,0xac,0x0c,0x19,0x72,0x39,0x29,0x2b,0x85,0x01,0xc4,0xac,0x63,0x80,0x9f,0x04,0x2c,0x11,0x0b,0x71,0xb2,0x2b,0x3a,0xaa,0x4f,0x93,0x42,0xdd,0x4d,0x5a,
+0x3e,0xe4,0xcb,0x5e,0x8f,0x33,0xab,0x4d,0x8c,0x3b,0x77,0x01,0xa2,0xa8,0x97,0x24,0x50,0x75,0x88,0x88,0xfe,0xf8,0xbe,0xbf,0xd3,0x86,0x88,0x9e,0x23,0x1b,0x43,0x74,
+0x22,0xf9,0xea,0xcc,0x46,0xf0,0xba,0x7b,0x75,0x86,0x96,0xb1,0x97,0xcb,0xb4,0x73,0xa7,0x01,0x93,0x61,0x24,0x4e,0x51,0x14,0x43,0xec,0x02,0x88,0xfb,0x66,0x88,0x2d,
+0x76,0x7a,0x8a,0xf6,0x1a,0xb9,0x73,0xe9,0xbf,0x91,0xb1,0x89,0xab,0x26,0xe2,0x4d,0xeb,0x69,0xce,0x33,0x9c,0xdd,0xbf,0xf5,0xf6,0x32,0x9a,0x4b,0x9d,0xc8,0x07,0x26,
+0x7f,0x50,0xb9,0x2d,0xe3,0x69,0x29,0xbc,0x99,0xa8,0x7e,0xb4,0x78,0x2e,0x07,0xcf,0x74,0xcd,0x8c,0x64,0x5c,0x68,0x29,0x22,0xa0,0x2a,0x51,0x54,0x39,0x4b,0xc6,0x7b,
+0x3c,0xfd,0x97,0x0d,0x1b,0x5e,0xe0,0x16,0x40,0xc6,0xf7,0xab,0x42,0xc4,0x8c,0xd0,0xba,0xa1,0xa8,0x30,0x26,0x45,0xf9,0x5f,0xba,0x22,0xc3,0x75,0xd5,0x17,0xd2,0xfa,
+0xc4,0x5a,0x6a,0xb0,0xfc,0x5b,0xdd,0xf5,0x19,0x00,0xf2,0x4b,0xc2,0x46,0x10,0xa1,0x8a,0xbd,0x8e,0x3f,0x27,0x24,0xbe,0x14,0x9b,0x96,0xce,0x76,0x5a,0xaf,0x8d,0x7e,
+0xad,0x87,0x97,0x77,0x42,0x96,0xc9,0xf1,0x4f,0x7c,0xdc,0xee,0x9f,0x17,0x4e,0x78,0x9a,0x4d,0x0d,0xfb,0x63,0x4f,0x8e,0x99,0x37,0x13,0x5c,0x68,0xcf,0x6e,0x6f,0x9c,
+0x1b,0x8f,0x44,0x63,0xa9,0xe9,0x9d,0x66,0x86,0xad,0x23,0xa0,0xac,0xb5,0x50,0xd4,0xb0,0xf9,0x1e,0x2e,0x5a,0x39,0x4a,0x13,0xec,0xdf,0x14,0x79,0x41,0xe8,0xbd,0xb6,
+0x71,0x36,0xc0,0x8f,0x60,0x4b,0xf9,0x41,0xbf,0x9d,0xd5,0x8b,0x05,0x7b,0xbe,0x5a,0xb3,0x20,0x5f,0xd7,0x0d,0xa1,0x36,0xb6,0x13,0xbf,0xf8,0xdd,0xaa,0x5a,0x36,0x7f,
+0x43,0x4a,0x82,0x09,0x72,0xc7,0xee,0x75,0xd0,0xdc,0x7c,0x82,0x13,0xe5,0x65,0x6c,0x26,0x3e,0x51,0x79,0xb8,0xee,0x3a,0xb2,0x64,0x14,0xed,0xff,0x41,0xdc,0xb7,0x0a,
+0xfa,0x92,0x75,0x0c,0x16,0x0e,0x1b,0x6b,0x8c,0xfb,0x80,0xc1,0x3d,0xa1,0xd6,0xaf,0xae,0x60,0xd4,0xeb,0xeb,0xef,0x53,0x5b,0x23,0xe1,0x5d,0x8d,0xfb,0x5b,0x3c,0x36,
+0x77,0x0b,0xa6,0xe4,0x7a,0x4b,0x22,0x19,0x4d,0x9e,0xb3,0x45,0xf4,0xac,0x9f,0x44,0xb9,0x2a,0xb6,0xad,0xd9,0xcc,0x89,0x87,0x70,0xf0,0xf0,0x4b,0x0b,0x5e,0x90,0xd9,
+0x09,0xb5,0xab,0xff,0x0e,0x0e,0x5b,0x80,0x36,0x56,0x84,0x39,0xa1,0x1f,0x49,0x41,0xc8,0xbe,0xb9,0xef,0x2c,0x54,0xf8,0x1d,0x7a,0x09,0xb4,0x98,0x09,0x79,0xf8,0x08,
+0xca,0xde,0xb7,0x7a,0x77,0x43,0x9a,0xe0,0x36,0x91,0x64,0x4a,0xbe,0x12,0xd3,0x6c,0x5e,0x12,0xb8,0x9a,0xfa,0xfd,0xbb,0x00,0x3e,0xe5,0x0f,0x62,0xa7,0xb4,0x61,0x11,
+0xd5,0xef,0xff,0x46,0xee,0x58,0x03,0x21,0x71,0xd2,0x43,0xb1,0x00,0xff,0xdd,0xa4,0x55,0xec,0xaa,0x69,0x56,0x2d,0x19,0xdf,0xf7,0xab,0x97,0x92,0xc3,0xef,0xae,0xea,
+0x8b,0xaa,0xc5,0xb7,0x8f,0x51,0x3e,0xa7,0x61,0x23,0xd9,0xb2,0xf9,0x2a,0x41,0x41,0x9d,0x07,0x42,0xdd,0x24,0xd3,0xc3,0x7b,0x43,0x6c,0xe7,0x1c,0x7d,0x5b,0x07,0xb7,
+0x86,0x08,0x83,0x7b,0x80,0x85,0xb8,0x9f,0xcf,0x24,0xe7,0xc5,0x01,0xa1,0xba,0x49,0x94,0x29,0x2a,0x9f,0x10,0xe8,0xec,0x9a,0x1f,0x7c,0x3a,0x3b,0xf7,0x41,0x6f,0x07,
+0x42,0x16,0x6e,0x99,0x54,0x88,0xa0,0xcf,0x27,0x9c,0xcb,0x8c,0x15,0xec,0x52,0x1e,0xd6,0x8c,0xf7,0x75,0x63,0xb9,0xde,0x69,0x02,0xa6,0xbf,0x9e,0x23,0xc4,0x0f,0xae,
+0xa2,0x64,0x1a,0x04,0xdc,0xd5,0x9f,0xc2,0x25,0x03,0x73,0x29,0xcf,0xb2,0x66,0x65,0x9b,0xb4,0xf4,0x0a,0xec,0xa5,0x06,0x95,0x4c,0x8f,0x98,0x55,0xa5,0xca,0x35,0xcc,
+0xcc,0x4c,0x27,0xed,0xb4,0x72,0x46,0x3a,0xc7,0x0a,0x51,0xe5,0xd0,0x90,0x3f,0x75,0x62,0xc1,0x1d,0x81,0x5b,0x5e,0xa6,0x44,0x8d,0x6d,0x4d,0x6f,0x0b,0x08,0x70,0x50,
+0x7d,0x4b,0xfb,0x89,0xe8,0xef,0x19,0x7a,0x61,0x8f,0xc3,0xe4,0xa4,0x63,0x3b,0x11,0xf7,0x90,0xa2,0x49,0xb2,0x0c,0x21,0xe3,0x0a,0xf5,0x7c,0x57,0xed,0x19,0x7b,0x58,
+0x27,0x2d,0x43,0x39,0x47,0xd9,0x59,0xc4,0x22,0x51,0xe2,0x5e,0x50,0x96,0x7c,0xdd,0x5a,0xad,0xa6,0x4c,0xe5,0x90,0xc0,0x03,0x86,0x16,0x00,0x04,0xcc,0x86,0xd3,0x56,
+0xa5,0xcb,0x91,0xcf,0x77,0x52,0x79,0xd6,0xb1,0x32,0x2f,0xb7,0xf1,0xe6,0xdb,0xe1,0x66,0x61,0x30,0x98,0xde,0x04,0xae,0xa4,0xc5,0x8a,0xa5,0x4c,0x0e,0x98,0x2d,0xc3,
+0xf9,0x47,0xc8,0x25,0x7d,0x13,0x09,0x4e,0x58,0x86,0xc6,0x2c,0x72,0x10,0x92,0x38,0x00,0x92,0x56,0x79,0x02,0x55,0x6f,0xac,0xc8,0xe9,0x72,0xbe,0x5c,0xe7,0x77,0xdb,
+0x0a,0x4e,0x9c,0x2f,0x07,0xca,0x11,0xfa,0xe3,0x22,0xd9,0x62,0x9d,0x9b,0xe8,0xde,0x7e,0xb2,0x0d,0x1d,0xce,0x21,0x13,0xa2,0x39,0xd5,0xe1,0x46,0x9a,0xc7,0x68,0x4c,
+0x75,0x12,0xf5,0x93,0x8a,0x5d,0xe4,0x60,0x00,0x92,0x9d,0xf2,0x8f,0x33,0x73,0x01,0xfc,0x99,0x0a,0x04,0xd6,0x19,0x1c,0x7a,0x31,0x07,0x78,0x13,0x1f,0xce,0xe7,0xfa,
+0xda,0x59,0x13,0xae,0xdb,0xfa,0x51,0xd9,0x21,0xb8,0x1c,0x3c,0xd6,0x93,0xf0,0x5b,0xa8,0x2f,0x4b,0xb9,0xb1,0xf7,0x0b,0x7f,0xb7,0x5a,0xa1,0x00,0x06,0x00,0xa2,0x32,
+0x3a,0x22,0x46,0x11,0xc1,0x39,0xf1,0xe8,0xc8,0x99,0xc7,0xd2,0x2f,0x04,0x58,0x6f,0xeb,0x70,0x46,0x34,0x94,0xb6,0xab,0x33,0xf7,0x59,0x46,0x2e,0xa6,0x13,0xea,0x10,
+0xec,0x22,0xe1,0x62,0x2b,0xcc,0x10,0x95,0x4d,0x7c,0x42,0xc2,0x28,0x11,0x5e,0xe6,0xfb,0x8f,0x63,0x44,0xe9,0xe1,0xe9,0x19,0xdf,0x87,0x79,0xad,0x56,0x54,0x22,0x4b,
+0x19,0x6e,0xac,0x14,0x1d,0x7a,0x7f,0x46,0x0d,0x37,0xcd,0x41,0x56,0xc2,0x10,0x79,0x58,0x0c,0xd4,0x11,0x39,0x44,0xe6,0xe3,0xd9,0x00,0x14,0x9f,0x25,0x13,0x31,0xa5,
+0x00,0xa8,0xea,0x1c,0xd4,0xcf,0x1c,0x17,0xb1,0xc3,0x72,0xec,0x9a,0xac,0x8a,0x88,0x50,0x58,0x67,0x71,0x56,0xde,0x42,0xf3,0x8b,0x6b,0x15,0x68,0xd3,0xca,0x4f,0xf0,
+0xbd,0x68,0x79,0x89,0x2a,0xce,0x03,0x39,0x06,0xfe,0x86,0x42,0x9b,0x91,0x17,0x89,0xce,0x4a,0x91,0xba,0x91,0xcd,0x62,0x25,0x6f,0xb4,0x53,0xb2,0xf4,0x6d,0x08,0x85,
+0x6b,0x24,0xa1,0x26,0x50,0xd6,0x70,0x0d,0xbd,0xbd,0x91,0x9e,0x20,0x98,0x8b,0xe3,0xae,0xce,0x06,0xf3,0xa6,0xb7,0xfb,0x21,0x16,0x21,0x41,0x5c,0x89,0x8f,0x14,0xce,
+0x05,0xa3,0x12,0xae,0x81,0x1f,0x3e,0x60,0x31,0xdb,0x94,0xc2,0x41,0x85,0x4c,0x6d,0x2a,0xdd,0x63,0xa5,0x4a,0xd2,0x57,0xbc,0x86,0x30,0x6e,0x66,0x25,0x59,0xaa,0xb1,
+0x66,0xbd,0x6f,0xb1,0x9f,0x3e,0x0c,0xf9,0x60,0xe6,0x99,0x88,0x94,0x6c,0x2b,0x31,0x84,0x61,0x35,0x12,0xad,0x6f,0x15,0x65,0xac,0x20,0x99,0x1b,0xac,0xbc,0xd5,0x0a,
+0x85,0x44,0x21,0xa2,0x7b,0xb0,0xdb,0x41,0x77,0x20,0xe1,0x1e,0x28,0x00,0xd4,0x37,0x1a,0x8c,0x63,0x2e,0x7c,0x06,0x08,0x54,0x00,0xff,0x6d,0xb0,0xc2,0x65,0xef,0x10,
+0xbf,0x7d,0x82,0x7c,0x5c,0xa1,0x3f,0x25,0x17,0x07,0xa3,0x3f,0x7c,0x28,0xc4,0x9b,0x4f,0x08,0x5c,0xe6,0xd6,0x2d,0x8a,0xf6,0x51,0x8b,0xce,0xcb,0xec,0x93,0x4a,0x61,
+0xd6,0x92,0x75,0x3c,0x00,0xf7,0x58,0x20,0x03,0x97,0x34,0xc8,0x02,0xbc,0x21,0x43,0xb8,0x43,0x86,0x19,0x02,0x38,0x9b,0xbb,0xc5,0xb4,0xab,0xf4,0x33,0x5a,0xa7,0xf1,
+0x19,0x3f,0x81,0x16,0x02,0x3f,0x32,0xa1,0x99,0x37,0x63,0xeb,0xd5,0x9c,0x79,0xc4,0x87,0x51,0x3d,0xa8,0xff,0x87,0xb4,0xa2,0xca,0x05,0x4c,0xc8,0x0f,0x8f,0xaa,0x8a,
+0xc8,0x69,0xbe,0x58,0x30,0xd9,0xb0,0x15,0x0e,0xf7,0xa5,0x54,0x8d,0xd5,0x0b,0xcc,0x88,0xd1,0x3e,0x0c,0x97,0x62,0x96,0x5d,0xb8,0x8b,0x1a,0xb7,0x03,0xde,0x30,0x57,
+0x08,0x80,0x18,0x13,0xff,0x11,0x48,0x5d,0x64,0x1c,0xe5,0x19,0x28,0x0b,0x1c,0xa3,0x8b,0x50,0x06,0xfa,0x37,0x66,0x58,0xcc,0x04,0x88,0xba,0x73,0xd6,0x68,0x11,0x79,
+0x53,0x8d,0x85,0x00,0x21,0x0e,0x0e,0xf4,0xf9,0x74,0xbe,0xc1,0x69,0x79,0xf1,0xb5,0xeb,0x63,0xb1,0x15,0xcc,0x7f,0x27,0x57,0xc0,0x80,0x44,0x73,0x06,0x9e,0xa7,0x8b,
+0x14,0xd7,0x63,0x02,0x58,0x15,0x0e,0x46,0xb4,0xec,0x2a,0x31,0x9a,0x6c,0x2f,0x86,0x70,0x16,0x76,0x24,0x3e,0x83,0xed,0x97,0x38,0xe0,0x20,0x31,0xbb,0xde,0x8c,0x31,
+0x2f,0x2e,0x62,0x28,0x93,0x09,0xb6,0x53,0x04,0x11,0x5c,0x18,0x7b,0x7d,0x0b,0xf3,0xf1,0xdd,0xcd,0x3e,0x82,0x5c,0x8f,0xfb,0xc5,0xc5,0x2d,0x88,0x2f,0x5e,0x4c,0x5d,
+0x2b,0x54,0xda,0xe3,0xc7,0x62,0x61,0x9d,0xa8,0xa2,0x02,0x5b,0x70,0xc4,0xea,0xab,0x89,0xb8,0x2c,0x2d,0x2e,0x8d,0x90,0x1e,0x86,0x90,0x6f,0x0f,0x5e,0xbd,0x2e,0xec,
+0x05,0x3e,0xb2,0x41,0x68,0xe9,0x0f,0x41,0x55,0xb4,0x52,0x2a,0x53,0xc3,0x3d,0x20,0x16,0x41,0x28,0xd1,0x94,0xff,0x6c,0x14,0xc1,0xc0,0xca,0x2b,0x62,0xe3,0x13,0x52,
+0x92,0xc6,0x88,0x96,0x18,0xa9,0xe9,0xfb,0xa2,0xd0,0xe4,0x6a,0x31,0x13,0x99,0x66,0x0e,0x1a,0xc8,0xcc,0x3f,0xc7,0x54,0xac,0xa3,0x08,0x89,0x85,0xa4,0x94,0x47,0x46,
+0xc0,0xce,0x0c,0x0e,0x8a,0x72,0x11,0x43,0x7b,0x56,0xa1,0x2a,0x39,0xbd,0xbb,0x2e,0xa6,0xab,0x31,0xdb,0x27,0x77,0x4e,0x1c,0xb0,0x85,0xac,0xc2,0x9b,0x84,0xd8,0x18,
+0x36,0x2b,0x8d,0x1a,0x7c,0xbf,0xd3,0x9e,0x30,0x7d,0xf5,0xfe,0x0a,0xd4,0xaa,0x49,0x3e,0x5c,0x93,0x2e,0x08,0xe9,0x1c,0x56,0xe4,0xf4,0xad,0x22,0xef,0x4b,0x81,0x95,
+0x9d,0x95,0x3b,0x54,0x3f,0xd4,0x16,0xdc,0x15,0x67,0x54,0x70,0x58,0x7a,0xe4,0x3b,0x8c,0x98,0x93,0x99,0x55,0x2b,0xd4,0x5d,0xa1,0x18
+};
+const size_t WM_PK_OTA_REMOTE_JS_BR_LEN = 4890;
+#else
+const uint8_t WM_PK_OTA_REMOTE_JS_BR[] PROGMEM = { 0 };
+const size_t WM_PK_OTA_REMOTE_JS_BR_LEN = 0;
+#endif
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_OTA_HTML_BR[] PROGMEM = {
+0x1b,0x25,0x0c,0x20,0x9c,0x07,0x76,0x63,0x47,0x04,0x6a,0xeb,0x3b,0x88,0x2a,0xc0,0xc7,0x4f,0xd7,0x72,0xf9,0xfa,0x6e,0x75,0x6b,0x10,0x53,0xae,0x62,0xf2,0x23,0x26,
+0x47,0x86,0xe8,0x14,0xf4,0xc4,0xf3,0xed,0x68,0xa0,0x4e,0x62,0x0a,0xc4,0xc7,0xa4,0x31,0x45,0x32,0x76,0xca,0xcf,0xaa,0x5e,0x92,0xcf,0x08,0x59,0x7d,0xfe,0xdb,0x11,
+0x29,0x40,0x39,0x5d,0xb5,0x39,0x56,0x13,0x56,0x4e,0x99,0x5a,0x88,0x67,0x3b,0x3a,0x78,0x45,0x37,0x29,0x89,0x03,0x7c,0x46,0xb2,0x53,0xe9,0x1a,0xe7,0xbc,0x24,0xce,
+0xef,0xa6,0x63,0x1c,0x32,0xe2,0xe2,0x55,0x39,0x4d,0x32,0x49,0x13,0x7e,0x58,0xb4,0x9c,0xc7,0x0c,0xcb,0xc6,0x23,0x3d,0x39,0x5d,0x87,0x59,0x54,0x7b,0xe0,0xf9,0xe3,
+0xf4,0xbd,0x09,0xab,0x75,0xfc,0x27,0xa8,0x0b,0xa8,0x81,0xcc,0x24,0x8e,0x7b,0x69,0xec,0xc5,0x96,0xe9,0xa6,0x76,0xb9,0x02,0x39,0xa9,0x37,0xa9,0xfc,0x36,0xd0,0xfd,
+0x28,0x3e,0x91,0xc2,0x84,0x18,0x38,0xc9,0x7e,0x7b,0x69,0xaa,0x5a,0xae,0x6b,0x46,0x51,0x85,0x70,0x9a,0xc8,0x87,0x62,0xdc,0xc5,0xbb,0x2e,0x44,0xc0,0x7a,0xf6,0xda,
+0xa9,0x66,0x46,0x2d,0x42,0x14,0xdc,0xf7,0xae,0x4a,0xd9,0xce,0x5c,0xa6,0xa0,0x57,0xc2,0xcb,0xc6,0xeb,0x89,0x86,0xf5,0x7c,0x4f,0x83,0xb8,0x2c,0x39,0x49,0xa3,0x3d,
+0x4c,0x27,0x9a,0x72,0x48,0xe9,0x48,0x9d,0xb0,0xb6,0x4c,0x98,0x3e,0x6d,0x3e,0x5c,0x2a,0xd7,0x23,0xe9,0x13,0xd1,0x1b,0x51,0x4f,0x0e,0xdc,0x81,0x61,0x30,0xc6,0x5e,
+0x5d,0xe1,0xdd,0x01,0xa5,0x4f,0x36,0x17,0x2b,0xa5,0xd3,0x96,0xad,0x1d,0xfa,0x3e,0x09,0xdc,0xca,0x39,0xd9,0x55,0x24,0x81,0x2b,0xc5,0x1a,0x64,0x52,0xc7,0x11,0x31,
+0xea,0x91,0x28,0x4e,0xd0,0x87,0x4c,0x25,0x79,0xa0,0x31,0x53,0xbc,0x01,0xff,0xb5,0x13,0x73,0x34,0x2a,0xd7,0x47,0x87,0x2f,0x69,0xfe,0x8f,0xf7,0x8e,0x99,0x22,0xd6,
+0x57,0xf1,0xeb,0xf7,0xca,0x52,0xc7,0x3e,0x9a,0x47,0x69,0xe3,0x96,0x8b,0xcd,0xbd,0xc0,0xc8,0x68,0xfa,0x6a,0x5e,0x1b,0x41,0x1e,0xb6,0x1b,0x9f,0x6e,0x67,0xca,0x9e,
+0x23,0x62,0x62,0xa1,0xc4,0x46,0xbd,0xa8,0x20,0xb5,0x61,0x39,0xf0,0x26,0x7a,0x4c,0xf5,0xe7,0x66,0xf0,0x0b,0x2c,0x5a,0x27,0x1e,0xcd,0x56,0x4f,0xfb,0xcb,0x54,0xf3,
+0x86,0x14,0xd2,0x08,0xf3,0xcc,0x6a,0xa7,0x54,0xce,0xdc,0x45,0x8a,0xd7,0xdf,0x5e,0x0c,0x33,0xab,0x98,0xcb,0x64,0xe4,0xea,0xa6,0x98,0x8a,0xa8,0x5e,0x52,0x5a,0xda,
+0x63,0xd1,0x82,0xa3,0x59,0x01,0x64,0xd3,0xeb,0xa4,0xc8,0xdf,0xc4,0x2c,0x11,0x3c,0x90,0x6b,0xb0,0x74,0xc8,0x08,0x31,0x46,0xc5,0xc0,0x5f,0xe6,0x47,0x30,0x6c,0x3d,
+0x7e,0x37,0x1a,0x5f,0xa9,0x08,0x2d,0x5f,0x18,0x4d,0x55,0xc5,0x72,0x71,0x55,0x09,0xa5,0x70,0xfb,0x63,0x19,0xe6,0xad,0x64,0x70,0xbb,0xa7,0xba,0x23,0xbc,0x8a,0x89,
+0x96,0x26,0xa6,0x7c,0xe7,0x67,0x57,0xa7,0x53,0x69,0x3c,0x0d,0xa5,0xd1,0x97,0x4a,0xa9,0xa6,0x5b,0x4d,0x48,0x31,0x93,0x86,0x49,0xad,0x81,0x02,0x7f,0x79,0xca,0x3f,
+0xf1,0x83,0x23,0xac,0x99,0x6e,0x9f,0x8d,0xa6,0x12,0x68,0xa9,0x56,0x09,0xd4,0x88,0xe0,0x66,0x8a,0xa9,0x23,0x1a,0xa0,0x93,0xa8,0xc3,0x3f,0x3b,0x13,0x0b,0xa3,0x02,
+0x50,0xe6,0x7e,0x1d,0x7e,0xf5,0x1e,0x68,0x70,0x7f,0x41,0xfd,0x20,0x45,0x9d,0x32,0x0d,0x0e,0xdd,0xf8,0xd4,0x79,0x34,0x12,0xb2,0xcd,0xba,0x1b,0x9a,0x9d,0xf9,0x98,
+0x77,0x4c,0x7b,0x6c,0x7d,0xd0,0xa2,0xb9,0xb1,0xea,0xd4,0x91,0x26,0x56,0xac,0x0b,0x91,0xee,0xc7,0x09,0xd3,0xea,0x1a,0x5d,0x03,0xe2,0x92,0xbd,0xaa,0x98,0x5c,0x87,
+0x12,0x76,0x90,0xa6,0xba,0x40,0xe3,0x53,0x04,0x95,0xa7,0x6f,0x81,0x50,0x5a,0xa1,0xd9,0xdc,0x11,0x24,0x5e,0x91,0xfe,0x43,0x85,0x6e,0xba,0x8f,0x9a,0x0e,0x3f,0x99,
+0xae,0x6b,0xe2,0x14,0x54,0xd5,0xe6,0x30,0x92,0xb5,0x7c,0x8a,0x05,0x52,0xc3,0x4b,0xcb,0xfa,0x7f,0x49,0x2a,0xc2,0x1c,0xa1,0xe9,0x1f,0x8f,0x06,0x3d,0x0b,0x8e,0x8e,
+0xce,0x4d,0x70,0xb5,0x3a,0x20,0x5d,0x97,0x1c,0x5e,0x72,0xc0,0xb9,0x68,0x70,0x2a,0x10,0x4e,0x86,0xda,0x37,0x30,0xd5,0x5e,0xe8,0xd8,0xbe,0x96,0x4c,0x6e,0x5a,0x40,
+0x1f,0xe5,0x58,0xc7,0xfa,0xa8,0x9d,0x05,0x7a,0x5b,0x0f,0xa6,0xd8,0x1b,0x96,0x98,0xe4,0xe1,0x54,0x4c,0x3d,0xd9,0x23,0xc9,0x1c,0x6a,0xbc,0x19,0x6b,0x0d,0x9f,0x0d,
+0xeb,0x29,0x70,0x58,0xae,0x83,0x68,0x52,0x01,0x74,0xc0,0x2e,0x52,0x30,0xad,0xf7,0x71,0x3c,0xde,0x26,0xe8,0xd3,0x38,0x1a,0xaa,0x3d,0xe0,0x37,0x07,0x86,0x66,0xa9,
+0x62,0x75,0xe6,0x64,0x40,0xa7,0xa9,0xb1,0xf8,0xa1,0x1e,0x3d,0xad,0x16,0xc6,0x21,0x4d,0x40,0x66,0x4a,0x4b,0xfa,0x8e,0x48,0x7c,0xcc,0x58,0xcb,0x7c,0xd9,0x92,0x69,
+0x1b,0x40,0x8b,0x2e,0x0e,0x2d,0x3c,0x83,0x86,0xba,0xbd,0xcd,0xfc,0x3e,0xf0,0x75,0x72,0xb9,0x54,0x48,0x17,0xad,0xca,0xda,0x0a,0x79,0xd8,0xa1,0xaf,0x6e,0xfa,0xab,
+0x80,0xa8,0x7a,0x9d,0xdc,0x11,0x93,0xda,0x12,0x35,0xc2,0x77,0x4d,0xd4,0xa0,0x4c,0x48,0x46,0x52,0x6a,0xfd,0x94,0xa1,0x99,0x1a,0x5f,0xed,0x35,0xf5,0xf9,0xf6,0xe0,
+0x63,0xfa,0x10,0x88,0xa9,0xcd,0x1c,0xdc,0x0a,0x20,0x38,0xd7,0x23,0xa6,0xf5,0x7f,0x3d,0xde,0xaa,0xab,0x9f,0x77,0x9d,0xe9,0xe0,0xeb,0x6c,0x6a,0x93,0x96,0xf0,0x39,
+0x54,0xd2,0xf4,0x4d,0x1a,0x9b,0xd1,0xb3,0x10,0x06,0x53,0xd9,0x26,0x97,0x0a,0x75,0x80,0x5b,0xbd,0x0a,0xfa,0xd8,0xd1,0x42,0xfe,0x4a,0xc5,0xb2,0x4b,0xb7,0x0a,0x9f,
+0x6b,0x00
+};
+const size_t WM_PK_OTA_HTML_BR_LEN = 930;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_OTA_HTML_BR[] PROGMEM = {
+0x1b,0x89,0x0c,0x20,0x9c,0x07,0xb6,0x8d,0x6c,0x3b,0x05,0xab,0x81,0x27,0x2f,0xcd,0x98,0x45,0x97,0x3a,0xab,0x6a,0xf7,0x9e,0xf6,0x49,0x32,0xf1,0x3d,0x10,0x74,0xeb,
+0x58,0x36,0x4b,0x1e,0x99,0x92,0xf4,0xad,0x73,0xd0,0x92,0x13,0xa0,0x04,0x6e,0x2b,0x08,0xf4,0xb7,0xbe,0x40,0x7c,0xf2,0x24,0x26,0xc8,0xc2,0xb5,0x44,0x32,0x0a,0x85,
+0x91,0x9d,0x4d,0x36,0x25,0x60,0x05,0x14,0xb8,0x2b,0x00,0x4b,0x72,0xaf,0x2a,0x59,0xa1,0xf4,0x65,0xeb,0xab,0xcc,0x2f,0xe2,0x79,0xab,0xc8,0x9a,0xf8,0x92,0x87,0x03,
+0x7c,0x46,0xb2,0x1d,0x42,0x62,0xc9,0xf3,0x70,0x7e,0x37,0x10,0xcb,0x5c,0xb2,0x10,0xaf,0xca,0x29,0x20,0x24,0x05,0xf8,0x61,0xd1,0x0a,0x19,0x33,0x3a,0x99,0xff,0x18,
+0x4f,0xc1,0xd7,0xc6,0x2c,0x44,0xfb,0xfd,0x2f,0x3f,0x47,0xdd,0xbc,0x50,0xdf,0x9c,0x77,0x0e,0x0d,0x11,0x49,0x7f,0x9e,0x3a,0x0b,0x36,0x90,0x29,0x99,0x38,0x9e,0x1f,
+0xa2,0x83,0xe7,0x86,0xc2,0x57,0x2f,0x40,0x95,0xe6,0x93,0xd4,0x38,0x0f,0x09,0x16,0xe2,0xf3,0x29,0xb4,0xa9,0x99,0x98,0x14,0x8e,0xe7,0xc2,0xf4,0xc2,0xd0,0xcd,0x73,
+0xbb,0xb0,0x9c,0x01,0x10,0xd5,0x38,0x8c,0xc6,0xb1,0x84,0x85,0x88,0xe6,0x95,0x54,0x85,0x68,0x1b,0x8b,0x5b,0xd4,0x16,0x56,0xb8,0x0a,0xaa,0x6f,0xdd,0xab,0x17,0xe9,
+0x36,0xea,0x57,0xe5,0xb3,0x9c,0x8f,0xeb,0x11,0xe9,0x86,0xd8,0x47,0x36,0xcb,0x0f,0xe0,0x9e,0x2d,0xe0,0xb1,0xf2,0x8f,0x6c,0x8a,0xcc,0x24,0xfa,0xcf,0x9a,0x8a,0xab,
+0x42,0x12,0x32,0xab,0xe7,0x23,0xbe,0xa2,0xf0,0x9f,0xf0,0xef,0x53,0xae,0xe9,0x26,0x30,0xed,0x97,0x2b,0x6d,0x3d,0xb4,0xbb,0xa4,0xd4,0x28,0x37,0x45,0x53,0xa0,0x4a,
+0x4a,0x99,0x30,0xe5,0xcd,0x1a,0x2a,0xe4,0xa9,0xea,0x78,0x90,0x8d,0x80,0x56,0xc0,0x0a,0xb0,0x41,0xee,0x33,0x35,0x96,0xab,0xcd,0xf2,0x88,0x31,0x37,0x02,0x9a,0x90,
+0x8b,0x1d,0xc1,0x09,0xfa,0x18,0xaa,0xa4,0x94,0x80,0x02,0x7d,0x1b,0x69,0x81,0xff,0xeb,0x89,0x1e,0x9e,0x37,0xf2,0xf1,0xe1,0x79,0x5e,0x9d,0xf1,0xfe,0x33,0x1d,0x94,
+0x7c,0x5d,0x3f,0xf7,0xbe,0xb6,0x95,0x3d,0x40,0x8a,0x29,0xd8,0xb8,0x6d,0x63,0xe1,0x84,0x00,0x44,0x51,0xbd,0xde,0xd7,0x02,0x68,0x0f,0x91,0x52,0x9c,0x2e,0xcd,0x68,
+0x27,0x03,0x31,0x6a,0x41,0xa7,0x9d,0x59,0xa4,0x6a,0x33,0xf1,0x6f,0x71,0xf9,0x4e,0x4d,0xa4,0xdc,0xb0,0xc4,0x96,0x92,0x5b,0x03,0x45,0xb4,0x8c,0x8a,0x57,0xaa,0x6f,
+0x5a,0xb2,0xd9,0xee,0xfa,0x3a,0x7d,0x16,0x1a,0xe7,0x22,0xb8,0x86,0x55,0xe8,0x19,0x5f,0xfa,0xb8,0xf9,0xbb,0x97,0x1d,0x0d,0xae,0x7a,0x6b,0x8a,0xd1,0x75,0xef,0xe9,
+0x7c,0xea,0xf0,0x83,0x19,0xf2,0xb5,0x34,0x8f,0x39,0x35,0x4a,0x09,0x04,0xc0,0x06,0x36,0x6a,0x55,0x7d,0x57,0x5b,0x73,0x90,0x01,0xd9,0xc1,0x92,0x23,0x28,0xd4,0x68,
+0x56,0x33,0x7d,0x9d,0x2f,0xc0,0xb2,0xb9,0xf8,0x1d,0x6a,0xdc,0x67,0x22,0x0c,0x74,0xcc,0x58,0xa6,0xd9,0x2c,0xae,0x2b,0xa0,0x1b,0x10,0x0e,0xfe,0x3c,0xce,0xf3,0x62,
+0x36,0xa7,0x1d,0xd5,0xbc,0xdb,0x78,0x6e,0x26,0x3c,0x92,0x0b,0xf9,0xa9,0x9f,0xa9,0xd6,0x3b,0x2b,0x0d,0xe2,0xb8,0x1c,0x0e,0xa5,0x46,0x68,0x8d,0x28,0xaf,0xda,0xb4,
+0xda,0x98,0x0b,0x53,0xf4,0x80,0x21,0x58,0xbf,0x56,0x9f,0x0d,0xc2,0x82,0xcc,0xa1,0x97,0x6e,0x8e,0x53,0x45,0x5c,0x95,0x6d,0x14,0xca,0xc7,0x30,0xa8,0x83,0x6b,0x63,
+0xdc,0x40,0x27,0x61,0xed,0xef,0x7a,0xae,0x8e,0x19,0x13,0x4c,0xb0,0xdd,0xfd,0x1c,0xfc,0x92,0x3e,0xe0,0x9a,0x9f,0x40,0xd3,0xac,0x55,0x27,0x32,0xae,0x89,0x6e,0xa6,
+0xca,0x19,0xf9,0x0c,0x6c,0xa1,0x9d,0x06,0x07,0xd5,0x7b,0xa0,0x31,0xe3,0xb9,0xcd,0x1c,0xf8,0x3e,0x1e,0x2b,0x9c,0xca,0x44,0x41,0xc7,0x9c,0x34,0x26,0xbe,0xbd,0xc8,
+0x0c,0xb6,0xc5,0x03,0x07,0xac,0x90,0xed,0xa5,0x5b,0x2e,0xd9,0x10,0x67,0x8e,0x62,0x0e,0x77,0x43,0x30,0xfb,0x9c,0x18,0x48,0x7e,0x76,0x13,0xb8,0x60,0x5b,0xb5,0xe5,
+0x53,0x22,0x40,0x5c,0x60,0xce,0x7f,0x06,0xdc,0x40,0x3f,0x59,0x36,0x44,0xab,0x9b,0x3a,0xc2,0x0a,0x6a,0x6e,0x5a,0x73,0x10,0xc9,0xa4,0xbc,0x5f,0x7d,0xe4,0xf2,0xd2,
+0x07,0xff,0x5f,0x58,0x45,0xd1,0x89,0x6d,0xfa,0xcc,0x27,0x87,0x87,0x1e,0x84,0xdc,0xb7,0xc9,0x05,0x77,0x35,0xdc,0x02,0x97,0x07,0x21,0x3b,0x5c,0x17,0x40,0x72,0x8c,
+0x8f,0x53,0x96,0x72,0x72,0xa8,0xfa,0x79,0xe6,0x54,0xf5,0x09,0x8e,0xad,0x9f,0xcd,0x26,0xfb,0x3d,0x30,0xfb,0xce,0x2e,0xe6,0x98,0xeb,0x85,0xbe,0x08,0x54,0x0f,0x11,
+0x4c,0xb1,0x77,0x84,0xcb,0x5c,0x96,0x33,0x17,0xfd,0xb3,0xdd,0xc1,0x66,0x9b,0x5f,0x17,0x51,0x59,0xe3,0xf3,0x59,0x4e,0x11,0xb1,0x85,0x73,0x30,0x07,0x13,0x40,0x4e,
+0xbd,0x90,0xc2,0x8a,0x62,0xb5,0x26,0xe9,0xde,0x7d,0x31,0xaa,0xdf,0x0a,0x93,0x38,0x80,0x41,0x57,0x10,0xf1,0x71,0xdc,0x34,0x8e,0x1b,0x78,0xfd,0x63,0xdc,0x0d,0x60,
+0x21,0x35,0x96,0xad,0x97,0x78,0x78,0x48,0x0d,0xbf,0xbe,0x65,0x16,0x05,0xb4,0x9e,0xb8,0x4a,0xdf,0x2b,0x89,0x1e,0x67,0x66,0x9b,0xf3,0x5e,0x4f,0x8b,0x21,0x89,0x3f,
+0x52,0x84,0x9e,0x85,0xe6,0xc6,0x4a,0xe0,0xbe,0xb7,0xff,0x3a,0x0f,0x80,0x60,0x9a,0x7b,0xba,0x68,0x16,0x80,0x98,0xb2,0x6f,0x25,0xb5,0x3e,0xfc,0x50,0xfb,0xfa,0xf7,
+0xb9,0x68,0xa8,0x17,0x72,0x27,0x50,0xdc,0xba,0xb6,0x63,0x29,0xa4,0x13,0x10,0x72,0x35,0x8a,0x38,0x8f,0xf4,0x79,0x8f,0x4a,0xa5,0x33,0x81,0x60,0xf1,0x2f,0x5d,0x1a,
+0x67,0xf9,0x18,0xf0,0x64,0xba,0x48,0xee,0xad,0x15,0xc4,0xd3,0x95,0x14,0x87,0xfd,0x96,0xb8,0x27,0xbb,0x4c,0xe0,0x15,0x22,0xeb,0x70,0x1d,0x2e,0x3b,0x8b,0x5c,0xbc,
+0xa9,0x58,0x2d,0x8d,0x23,0x6d,0x91,0xcb,0x44,0x37,0xa5,0x80,0x82,0xfe,0x9c,0xef,0x10,0x20,0x0a,0xbe,0x22,0xbc,0x09,0x3f,0x3a,0x25,0x67,0xad,0xfa,0xa1,0x49,0x94,
+0x82,0x45,0x26,0xac,0xac,0xe5,0xf6,0xcd,0xe1,0x36,0xe3,0x3f,0x15,0xd4,0x82,0x6a,0x92,0x48,0x06,0x47,0xbd,0x36,0xcd,0xe2,0xb2,0xec,0xe7,0x4c,0x00
+};
+const size_t WM_PK_OTA_HTML_BR_LEN = 1021;
+#else
+const uint8_t WM_PK_OTA_HTML_BR[] PROGMEM = { 0 };
+const size_t WM_PK_OTA_HTML_BR_LEN = 0;
+#endif
+#else
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_OTA_HTML_BR[] PROGMEM = {
+0x1b,0x51,0x0a,0x00,0x1c,0x07,0x6e,0xac,0xcc,0x6b,0xc1,0x21,0xe5,0x39,0x1d,0xcb,0xe9,0xeb,0x7b,0xd3,0x9b,0xa1,0xa1,0x75,0x3a,0x31,0xf9,0xb1,0x84,0x98,0x95,0x6a,
+0x9d,0xc4,0x14,0x88,0x8f,0xfd,0x37,0xd6,0xd4,0x4a,0xa5,0x12,0x42,0xbc,0xd9,0xbf,0xf3,0x31,0xf5,0xb4,0x72,0x9e,0xee,0x91,0x44,0x23,0xd4,0x4b,0x44,0x4f,0x84,0x1a,
+0x49,0xe5,0x16,0xf1,0xdc,0x4e,0x16,0x41,0x99,0x49,0x49,0x7c,0x63,0x26,0xc9,0xbe,0xb0,0x25,0xf6,0xdd,0x68,0xc3,0xe0,0x62,0xcc,0x5c,0x48,0xfa,0xd8,0x2c,0xa7,0x4f,
+0x28,0xe9,0xc3,0xb9,0x45,0x2b,0x81,0xcc,0xc3,0xd9,0x7b,0xc4,0xa8,0x78,0xec,0xbc,0x8e,0x7c,0xcf,0x3c,0x7f,0x9c,0x4e,0x9c,0xb0,0x3a,0x8f,0x3b,0x84,0xba,0x00,0x1f,
+0x08,0x4d,0x56,0xf5,0x2a,0xf5,0x07,0x7e,0x47,0xf5,0x6d,0x37,0x62,0x01,0x9e,0x4d,0x38,0x4d,0x04,0xee,0xc1,0x7c,0x2e,0x0e,0x49,0x61,0xa3,0x72,0x86,0xfa,0x16,0xda,
+0xdb,0x40,0x0d,0x14,0x4d,0x63,0x6d,0x4c,0x04,0x1c,0xc6,0x6f,0xf0,0xd4,0xcf,0xbd,0x8c,0x73,0x0c,0x89,0x49,0x5b,0x64,0x6f,0x16,0xa6,0xb5,0x40,0x72,0x42,0xcf,0xb7,
+0x38,0xf1,0xef,0xca,0xeb,0x8d,0x1c,0x8d,0x23,0xec,0x5e,0x32,0xb7,0x5a,0xcf,0xd8,0x3b,0x2d,0x20,0x46,0xe4,0xa3,0x49,0xa0,0x4d,0x6d,0x3e,0xdf,0xa8,0x58,0xc2,0x57,
+0x13,0xf6,0x7b,0x91,0x05,0x31,0x3d,0x82,0x25,0x5c,0x1c,0x9d,0x64,0xc0,0xe9,0xb6,0x64,0x4a,0xb8,0x88,0x31,0x0a,0x68,0x28,0x2c,0x55,0xa6,0x3e,0x55,0x22,0xa9,0x04,
+0x52,0xa6,0x11,0x81,0xe6,0x5d,0x3d,0xc2,0x1f,0x51,0xc2,0x4a,0x37,0x42,0xc5,0x3f,0x33,0xff,0xa8,0xac,0xf7,0xf6,0x86,0x9c,0xf7,0xe0,0x06,0x39,0xb1,0x45,0xff,0x93,
+0xf2,0xe8,0xc7,0x4b,0x1a,0xad,0xb1,0xc3,0x97,0x35,0x55,0x79,0x05,0xa0,0x7b,0x2f,0x9a,0x8c,0xec,0xa3,0xfb,0x28,0x70,0xb4,0x94,0xd8,0x3f,0xa5,0x18,0x61,0x48,0x47,
+0xd4,0xb5,0x17,0x08,0x12,0x87,0x13,0x85,0x61,0x2d,0x5a,0x11,0x8a,0x67,0x0d,0x91,0x31,0xaa,0x67,0xe2,0xc8,0x10,0x26,0x04,0xd3,0xc7,0xe3,0xa5,0x6c,0xbc,0x40,0x33,
+0x70,0x1b,0x9c,0x1b,0x7b,0x7e,0xca,0x93,0x66,0xac,0x0c,0x1c,0x36,0xfe,0x45,0xb0,0x97,0x56,0x31,0xb7,0xed,0x85,0x75,0x0b,0xaf,0xbf,0xbd,0xd8,0x97,0x56,0xbc,0x48,
+0x82,0x03,0x93,0x9d,0x18,0x8f,0x48,0x39,0x52,0xba,0xfb,0x3f,0xa3,0x31,0x47,0xc3,0x02,0xe0,0x72,0x94,0x66,0x6f,0xbf,0x55,0x0b,0x92,0x44,0x07,0xc1,0x06,0x77,0x0a,
+0x3d,0xb0,0xb2,0x58,0x39,0xf3,0x72,0xcd,0x41,0xc3,0xdd,0xb8,0xd8,0x33,0xbe,0xe2,0x08,0x85,0x59,0x6a,0x82,0x73,0xba,0x68,0x59,0xb9,0x50,0x10,0xb7,0x3f,0x96,0xee,
+0x3a,0x48,0x9c,0xe2,0x7d,0xf9,0x0e,0xf5,0xa4,0x13,0x99,0x48,0x8c,0xfb,0xd1,0xcf,0x3a,0xb9,0xc6,0xdc,0x21,0x4a,0x06,0xc8,0x94,0x6d,0x5b,0x3e,0xf9,0x58,0x69,0xab,
+0x05,0xc9,0x73,0xd4,0x39,0x10,0xe3,0x0b,0xe7,0xd1,0xcc,0x3c,0xc8,0xd1,0x39,0xf0,0xf0,0xc2,0xcb,0x05,0x21,0x08,0x75,0x32,0x53,0xbd,0x28,0xb7,0xac,0x51,0x12,0x33,
+0x7a,0xf3,0x1f,0xc9,0xf3,0x67,0x67,0xd5,0x52,0xe3,0xc0,0x41,0xaa,0xaf,0x2e,0x5c,0xaa,0x1e,0xc8,0x4b,0x7f,0x41,0x53,0xd7,0x56,0x99,0xd5,0xf2,0x12,0xd3,0x5e,0x29,
+0x75,0x7a,0x09,0xdc,0x7e,0xa9,0x88,0x1c,0x65,0xdb,0x37,0xb5,0x96,0xd5,0xfa,0x5a,0xc8,0xac,0xf4,0x48,0xa6,0x46,0x6c,0xe0,0x8c,0x5d,0x63,0x21,0xf6,0xe3,0x40,0x2b,
+0xa4,0xa0,0x3d,0x0f,0x44,0x9f,0x7c,0xb6,0x09,0x65,0x24,0x34,0xf0,0x0b,0xc4,0xa3,0xaa,0x0f,0x3c,0xd7,0xaa,0x83,0xd6,0xd3,0xf7,0x40,0x81,0x14,0xb1,0xe8,0x1a,0x55,
+0xc0,0x78,0x45,0xbc,0x3f,0x64,0x80,0x8b,0x7d,0x14,0x12,0x06,0x73,0xa5,0x7c,0x44,0xf4,0x62,0xca,0xc5,0x15,0xae,0xe4,0x3b,0x7d,0xaa,0x31,0x92,0x16,0x6c,0xa6,0xf9,
+0x7f,0xf1,0x2b,0x23,0x4e,0x84,0xce,0x7f,0x3c,0x7a,0xb4,0xdf,0x81,0x3e,0xed,0x4a,0xa3,0x40,0x3d,0x0e,0x0b,0x50,0xb4,0xd7,0x27,0x3f,0x0a,0x7a,0xa0,0x5e,0xd7,0xc5,
+0xdf,0x80,0x41,0xbb,0xd7,0xb2,0x87,0x9f,0xb5,0xb4,0x80,0xfc,0xb2,0x93,0x9c,0x6e,0x76,0x80,0x97,0x51,0x94,0x5d,0xfc,0x99,0xdb,0x0d,0x03,0x93,0xc5,0x00,0xce,0xf8,
+0x9c,0x57,0x44,0xf9,0x79,0xd8,0x1b,0x53,0xf7,0xf7,0x88,0x3f,0x87,0x72,0x6f,0x11,0xa3,0xe6,0xcf,0x5c,0x79,0x86,0x88,0x55,0x49,0xe9,0xcb,0xa6,0x00,0x23,0xb0,0x2b,
+0x2a,0x78,0xd9,0x77,0x3e,0x63,0x71,0x19,0xa6,0xd6,0xb7,0x0f,0xf0,0x10,0xcd,0x28,0xe7,0x6c,0x52,0x66,0x72,0xa6,0xe6,0xc9,0x93,0x5e,0x92,0x25,0x7d,0x71,0xd4,0xc3,
+0x89,0x62,0xe6,0x6c,0x00,0x44,0x1b,0xcf,0x34,0x8b,0x7f,0xc4,0x15,0x07,0x3b,0xf9,0x75,0xbf,0xd3,0xda,0x62,0x24,0x5b,0x8c,0x19,0xc8,0xe2,0x45,0x6a,0xe8,0xda,0x7b,
+0x6d,0xef,0x83,0x29,0x83,0x5a,0x4e,0x21,0x66,0x42,0x69,0x59,0x50,0xba,0x04
+};
+const size_t WM_PK_OTA_HTML_BR_LEN = 815;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_OTA_HTML_BR[] PROGMEM = {
+0x1b,0x90,0x0a,0x20,0xac,0x87,0x37,0x06,0xe8,0x61,0x44,0x14,0x21,0x27,0xd4,0x89,0x89,0x22,0x7c,0x58,0xc5,0x33,0x17,0xa3,0xd4,0xf8,0x56,0x35,0xc8,0x8b,0xd8,0x9a,
+0x4d,0x9d,0x4d,0xab,0x1e,0xf5,0x64,0x07,0xea,0x96,0xfd,0x40,0xb4,0xa9,0x89,0x0a,0xe4,0x9e,0x13,0xde,0xd7,0xb4,0x6e,0x63,0x73,0x8b,0x8e,0x73,0x3b,0x43,0xa8,0xd1,
+0xb8,0x81,0x75,0xd8,0x5c,0xdb,0xc9,0xf6,0x01,0x39,0x79,0x9a,0x30,0x44,0x54,0x79,0x12,0x13,0x94,0x74,0x72,0x6e,0xf6,0xfc,0xfd,0xbe,0x0a,0xf1,0xd2,0x05,0xc0,0x9d,
+0x73,0xdf,0x9c,0xad,0x68,0xec,0x1b,0x5b,0x4d,0x91,0x58,0xf6,0x69,0xb1,0x29,0x55,0x52,0x7d,0x49,0xfe,0x31,0x3a,0x67,0x55,0x7f,0x50,0x4d,0x5a,0xc2,0x01,0x3e,0x23,
+0xd9,0x4b,0x1c,0x52,0x6e,0xf0,0xba,0xe0,0x58,0x24,0x06,0xa2,0x85,0x57,0xe5,0x94,0x33,0x92,0x72,0xfc,0xb0,0x68,0x8d,0x8d,0x39,0x28,0xcb,0x8e,0xf8,0x34,0x7a,0xed,
+0xd0,0x21,0xdb,0x9f,0xff,0xa3,0x69,0x9c,0xd0,0x6c,0x5c,0x56,0x0e,0xc6,0x24,0x24,0xfb,0x79,0xea,0x3c,0xdc,0xc0,0xa6,0xa2,0xc4,0x99,0x32,0x68,0x07,0x75,0xd5,0xe2,
+0x86,0x7b,0x01,0x6a,0x14,0x3e,0xc5,0x8d,0x4b,0x89,0x60,0x3d,0x3e,0x9f,0xc2,0xa0,0x41,0x32,0x28,0x9f,0x9f,0x43,0xd5,0x56,0x72,0x12,0xba,0xdd,0x84,0x47,0x3c,0xee,
+0xd5,0x4f,0x15,0xa4,0x26,0x42,0xd9,0xc4,0xa3,0x17,0x57,0x2e,0x8d,0xa6,0xd5,0xda,0xc4,0x6e,0x9d,0xee,0x1f,0xef,0xc7,0x8b,0xc0,0xcc,0x30,0x76,0x4c,0xe2,0xc3,0x98,
+0xe5,0x43,0xb3,0x17,0xf1,0x86,0x6e,0x3d,0x7d,0x1c,0x6a,0x11,0xcf,0x3e,0x45,0x2a,0x76,0x0a,0x1d,0x17,0x74,0x5e,0x86,0x9c,0x98,0xc2,0x7f,0x42,0xdf,0x45,0xdf,0xd2,
+0x7a,0xa0,0xea,0x32,0x36,0x2e,0x58,0x77,0x36,0x69,0x36,0xc8,0x5c,0x48,0x41,0x15,0x0f,0x54,0x34,0x1f,0xad,0x33,0xa6,0x70,0x51,0x74,0x3a,0x13,0x16,0x63,0x86,0x09,
+0x43,0x0a,0xb0,0x7d,0x51,0x25,0x88,0x78,0xae,0x10,0x2b,0x65,0xa0,0x24,0x02,0x36,0x5e,0x82,0x48,0x70,0x42,0x3e,0x60,0xaa,0x48,0xff,0x90,0xc0,0x68,0x46,0x96,0xf1,
+0x1f,0x3b,0x31,0x2c,0x1b,0x2f,0x8e,0x0e,0x2f,0xcb,0x61,0x89,0xf7,0x8c,0xe9,0x67,0xba,0xee,0xbe,0x64,0xcf,0x8f,0x6a,0xf7,0x27,0x31,0x85,0x8d,0x5b,0x2d,0x56,0x44,
+0x0c,0xc0,0xc8,0xf4,0x95,0xbc,0x96,0x03,0x3d,0x22,0x4a,0x73,0xba,0x46,0xf3,0x3b,0x02,0x71,0xba,0x82,0xb7,0x06,0xb3,0xc4,0x89,0x16,0xa3,0x6f,0x5e,0xfd,0x26,0x12,
+0xe5,0xbe,0xa4,0x13,0x03,0x49,0x0d,0x5c,0xcc,0x33,0xaa,0x4a,0xa9,0xfb,0xa0,0xef,0xad,0x18,0xf6,0x3d,0xb6,0x34,0x9a,0xe0,0x22,0xbe,0xe6,0x29,0xdb,0x19,0x2f,0x57,
+0x3c,0xf8,0x2e,0xa4,0xf1,0x35,0xca,0xc6,0xe1,0xe8,0xb6,0x7b,0x2a,0x8b,0x29,0x7f,0x08,0x30,0xcb,0x59,0xfa,0x8f,0xf9,0x3d,0x4a,0x0d,0x02,0x60,0xf9,0xca,0x67,0x8f,
+0xbe,0x9b,0x8c,0x1c,0x93,0x01,0xdb,0xc1,0x92,0x6d,0x23,0x74,0xd1,0x65,0xd0,0xeb,0x7c,0x1d,0x96,0x2d,0xc1,0x6f,0x47,0xe3,0x31,0x17,0x39,0xe5,0x9a,0xe7,0xba,0x64,
+0xb1,0x5b,0x65,0x42,0x21,0x1c,0xfd,0xcc,0xe3,0x79,0x95,0x88,0xd3,0x4e,0xe2,0xee,0x10,0x4f,0x32,0x51,0xd7,0x84,0x98,0x9f,0xff,0x4c,0x23,0x5b,0x39,0xa5,0xb9,0x39,
+0x6e,0x45,0x42,0x69,0xe6,0x2d,0xa3,0x5c,0xf5,0x5a,0x93,0x89,0xca,0x49,0xe5,0x81,0x40,0xb0,0x37,0x1d,0x7e,0xea,0x07,0xeb,0x74,0x55,0x5d,0x93,0xd5,0xaa,0x4b,0xb4,
+0x98,0x8a,0x9c,0x42,0x65,0xd8,0xc0,0xe9,0xa7,0x7c,0x6c,0x11,0xc8,0x49,0xc4,0xf1,0x87,0xce,0x4d,0xae,0xb9,0xe0,0x82,0xaf,0xf6,0x8b,0xf1,0xeb,0xf7,0x40,0xa5,0xfb,
+0x02,0x56,0x6c,0xcd,0x94,0xb5,0x4a,0x47,0x6e,0x80,0xca,0x8c,0x32,0x01,0xb6,0xc2,0x4f,0x43,0xd5,0x33,0x12,0xd0,0x52,0xab,0x93,0xdd,0x1c,0xd4,0x6a,0x1c,0x2b,0x4f,
+0xb5,0x1c,0xca,0xb1,0xb8,0xd7,0xda,0xbd,0x3f,0xd4,0xe6,0xbe,0x27,0x9b,0x35,0xf0,0x5a,0x62,0x2f,0x0f,0x8a,0x7c,0xc8,0x72,0x3f,0x11,0x94,0xaa,0x05,0xee,0x4c,0xb4,
+0xc0,0x53,0x67,0x39,0x77,0x81,0x02,0xdf,0x1b,0x79,0x0d,0x4a,0x04,0x88,0x2b,0x82,0xff,0x84,0x1b,0xeb,0x93,0xe7,0x43,0x3b,0x55,0xa9,0xd3,0xbc,0xe6,0x48,0xba,0xde,
+0x1c,0x42,0x72,0x25,0xbf,0x5c,0x7f,0x64,0xf9,0xa8,0x76,0xfd,0xbf,0xa8,0x4a,0xda,0x1d,0xbe,0xe9,0x2b,0x4f,0x35,0xd9,0xaa,0x43,0x4b,0x36,0x7c,0x52,0xa0,0x56,0x53,
+0x3d,0x50,0xb2,0xd9,0x12,0x87,0x7b,0x9a,0x90,0x9c,0xd1,0xc0,0x29,0x4f,0xb9,0x68,0xa8,0xfd,0x52,0x77,0xaa,0x7d,0x81,0xe3,0xeb,0x17,0x89,0xc9,0xe1,0x3a,0xb8,0xfd,
+0x20,0xc6,0x62,0x77,0xbd,0xbe,0x61,0x02,0x4d,0xf3,0x36,0x4c,0xb1,0xd7,0xa1,0x84,0x54,0xee,0xd7,0xe2,0xf2,0xd5,0x1e,0x50,0xb3,0xaf,0x5e,0x37,0xed,0xad,0x8e,0xf3,
+0x78,0x31,0x45,0x5b,0x2c,0x99,0xcd,0x34,0x84,0x00,0xa9,0xd4,0x2b,0x34,0x2b,0xaa,0x4c,0x9a,0x64,0xd7,0xee,0x1b,0xe9,0xbe,0x07,0x22,0x0e,0xc0,0x00,0x0b,0xda,0x72,
+0x6c,0x11,0xcd,0x90,0xee,0xf8,0x63,0x59,0x35,0x80,0xf5,0x88,0x65,0xf4,0x32,0x0f,0xfc,0x68,0xf1,0x37,0x9a,0xc4,0x1c,0x02,0xf5,0xa2,0x55,0xf9,0xc6,0x48,0xec,0x16,
+0x64,0x91,0xf9,0x48,0xdd,0xf2,0xbc,0xdb,0xfe,0xc8,0x66,0x1b,0xb3,0x55,0x8d,0x55,0xc3,0x5e,0x6d,0xff,0x75,0xf6,0x03,0x51,0x3c,0xa3,0x55,0xc5,0x0c,0x8c,0x79,0xe2,
+0x9b,0xbf,0x81,0x0a
+};
+const size_t WM_PK_OTA_HTML_BR_LEN = 900;
+#else
+const uint8_t WM_PK_OTA_HTML_BR[] PROGMEM = { 0 };
+const size_t WM_PK_OTA_HTML_BR_LEN = 0;
+#endif
+#endif
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_INFO_HTML_BR[] PROGMEM = {
+0x1b,0x54,0x03,0x00,0x1c,0x05,0xee,0x9e,0x87,0x30,0x5d,0xfa,0x1b,0x2e,0x28,0x19,0xf9,0xff,0xbf,0xcd,0x54,0x69,0x17,0xf3,0xcd,0x33,0xab,0x0b,0x05,0x7d,0x98,0xbe,
+0xe9,0x3f,0x74,0x18,0x89,0x0d,0x4d,0x54,0xc7,0x9c,0xdd,0xa1,0x5c,0xc8,0x4c,0xcd,0xed,0x76,0x7d,0xab,0x7d,0xb5,0xba,0x24,0x11,0x41,0x4c,0x1a,0xa5,0x90,0x29,0x91,
+0x37,0xb7,0xf6,0xe9,0x17,0x11,0x55,0x32,0xc6,0xe6,0xdd,0x44,0x1c,0x06,0x76,0xc6,0x15,0x5b,0x24,0xd9,0x94,0x46,0x80,0xde,0x19,0x1d,0xde,0x5f,0xf0,0xe2,0xd2,0x38,
+0x62,0x2c,0x47,0x02,0x4a,0x24,0xac,0x16,0x2d,0x01,0xb2,0x03,0x9d,0xa2,0x6e,0x28,0x51,0xb1,0xde,0xcd,0x81,0xdd,0x44,0x12,0x04,0x31,0x31,0x11,0xed,0xa1,0xfd,0x8f,
+0xd4,0x1d,0x31,0x05,0x03,0x14,0xf9,0x76,0xd9,0xcc,0x4f,0x79,0xe0,0x1f,0xe9,0xdc,0xfa,0x0c,0x1d,0x76,0x01,0xe6,0x97,0xf1,0x3c,0xf5,0x3f,0x18,0x2d,0x9b,0x81,0x43,
+0x5c,0xff,0x90,0xc5,0x82,0x77,0x38,0x85,0x14,0x34,0x00,0x60,0x7f,0x45,0x45,0x59,0xa3,0x3f,0xa2,0x0a,0x97,0xf5,0x6d,0xd9,0x1d,0x0c,0xc6,0x5b,0x2f,0x6e,0xfa,0xcd,
+0x2c,0xed,0x83,0x5d,0x04,0xb4,0xa0,0x41,0x3a,0x9f,0x6c,0xd7,0x71,0xcc,0x01,0x65,0xe5,0x46,0xe4,0xd3,0xb8,0xb1,0x34,0xcd,0x7c,0x13,0xb5,0x80,0x73,0x1a,0x78,0xc6,
+0xc6,0x9c,0xf5,0x28,0x9f,0xfa,0x88,0x14,0x59,0x5b,0x9b,0xdb,0x59,0xec,0xfb,0x85,0xd7,0xdf,0x66,0x16,0xb7,0xb4,0xa9,0x1a,0xda,0x16,0x19,0xf5,0x07,0x37,0x31,0x42,
+0xf9,0xb0,0x76,0x97,0xc2,0x65,0xb9,0x30,0xcb,0x4c,0x1d,0xec,0xf9,0x29,0x07,0x4d,0x33,0x9f,0xa8,0x12,0x76,0xc9,0x56,0x09,0x87,0x47,0xa7,0x88,0x47,0x34,0x69,0x3e,
+0x49,0x19,0x8b,0xce,0x52,0xe2,0x10,0x4d,0xa0,0x68,0x7b,0x12,0x3f,0xee,0x2e,0x1e,0x3b,0x82,0xa3,0xc3,0x71,0x3a,0x19,0xf0,0xc2,0xd1,0x23,0x39,0x15,0x8b,0x91,0x8c,
+0x20,0xf4,0xf1,0xac,0x13,0x4a,0xf1,0x83,0xd0,0x43,0x97,0x21,0xee,0xa1,0x82,0x78,0x9d,0x3e,0x06,0x1b,0x79,0xfc,0xd7,0x8a,0x83,0x99,0x53,0x87,0x1d,0x37,0x58,0x69,
+0xb8,0xa8,0x97,0xc8,0x61,0x44,0x71,0x33,0x1e,0x51,0x23,0x58,0xb8,0x17,0x2c,0x1a,0x44,0xf0,0x24,0xf6,0x63,0x1c,0xdf,0xdf,0x31,0xba,0x40,0xdf,0xd2,0x46,0x79,0x26,
+0xaf,0xe1,0x9e,0x36,0x77,0xc0,0x6d,0xe2,0xf6,0x38,0xcb,0x00
+};
+const size_t WM_PK_INFO_HTML_BR_LEN = 396;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_INFO_HTML_BR[] PROGMEM = {
+0x1b,0x66,0x03,0x20,0xbc,0x0d,0x18,0xc7,0x02,0xc0,0x63,0xb8,0x16,0x64,0x15,0x8d,0x8d,0xb6,0x4b,0xc8,0xc2,0xda,0xc8,0x39,0x86,0xd4,0x9e,0xbc,0xdf,0xce,0x94,0x92,
+0x55,0x73,0x2a,0xfb,0x6e,0xc3,0x45,0xd0,0xad,0xc2,0xf1,0xc1,0x0b,0x00,0x78,0x95,0x69,0xf3,0x24,0x8d,0xf5,0xe9,0x50,0xd2,0xd2,0x56,0x49,0x12,0x53,0xd6,0x64,0x6f,
+0x73,0x7a,0x72,0x0f,0x6c,0xaa,0xe1,0xe8,0x70,0xdc,0xb6,0x0f,0x8b,0x4b,0xca,0x0e,0x7b,0xb1,0xa1,0x99,0x66,0x63,0x35,0x85,0x24,0x56,0x28,0x2c,0x03,0xe7,0x04,0xda,
+0xc0,0x67,0x38,0xd5,0x0e,0xca,0x78,0x45,0x8b,0x9c,0x2f,0xd8,0xc8,0x37,0xb7,0xf6,0xf1,0x2b,0x41,0x91,0x0c,0xdd,0x76,0x37,0x11,0xa5,0xc8,0xe6,0x38,0x21,0x7b,0x24,
+0x1b,0xd3,0x01,0x79,0x73,0x8c,0x77,0x1f,0x41,0x95,0x2d,0x0f,0x53,0x39,0x02,0x40,0x22,0x60,0xb3,0x68,0x31,0x8c,0x4d,0x54,0xc9,0x4b,0x7a,0x62,0x7e,0x75,0x6e,0x2b,
+0xa8,0xfd,0xab,0xf4,0x9a,0xad,0xe7,0x9e,0x6e,0x51,0xec,0xe9,0x26,0x1a,0x7f,0x4b,0xdd,0x14,0x5d,0x10,0x44,0xe1,0x37,0xbb,0x95,0x4f,0xe6,0x6e,0x7b,0xa4,0x93,0xeb,
+0x36,0x8c,0xd8,0x39,0xe8,0x9f,0x55,0x25,0x61,0x87,0xa3,0x6e,0xa5,0x15,0x59,0x6f,0x0f,0x46,0x30,0xd8,0x87,0x55,0x70,0x39,0x0d,0x10,0xf6,0x74,0x70,0xc8,0xf0,0xa4,
+0xa7,0xac,0x4b,0xa9,0xc8,0x26,0x0b,0xbf,0xc6,0xab,0xf2,0xc2,0x42,0xb1,0x3c,0x2c,0xad,0x1d,0x2d,0x6a,0xe0,0xd6,0xc7,0x3b,0x76,0x14,0x74,0x2f,0x39,0xfe,0x66,0x28,
+0x89,0x8b,0x92,0xa9,0xbc,0x0d,0x6e,0x40,0x49,0xfd,0xf2,0x8c,0xa2,0x2c,0x8d,0x10,0x99,0x49,0xf8,0x98,0xb5,0x6c,0x6b,0xb0,0x38,0x0f,0x4f,0x97,0x32,0xef,0x92,0xce,
+0x4d,0xef,0xab,0xaa,0xca,0x38,0xb8,0x0d,0x70,0x42,0x04,0xfb,0xba,0x6f,0x17,0x6b,0x5d,0x72,0x96,0x52,0xa4,0x4b,0x28,0x4d,0xdf,0xb4,0x42,0x89,0xf2,0x80,0x01,0xd6,
+0x78,0xb7,0x84,0xe2,0xa3,0xc4,0x13,0x61,0x56,0x5b,0x33,0x16,0x9c,0x19,0x99,0x57,0x90,0xa2,0x4c,0x07,0x90,0xb5,0x8b,0xc1,0xa6,0x00,0x69,0x72,0xa2,0x4e,0x04,0xbe,
+0x50,0xf8,0x5c,0xac,0xee,0x5f,0xba,0xd8,0x3a,0x93,0x47,0x4c,0x17,0x6b,0xf3,0xf4,0x9e,0xbe,0x06,0x85,0x68,0xc4,0x86,0x40,0x44,0x16,0x81,0xeb,0xc9,0xca,0xc2,0x3c,
+0x69,0x64,0x6e,0xb2,0xf8,0xcb,0x15,0x13,0xcf,0x51,0xad,0x6e,0xbd,0xcb,0x29,0xba,0x34,0x45,0x20,0x86,0xd0,0xc6,0x36,0xca,0x18,0x41,0xdc,0x82,0x05,0xdc,0x82,0x14,
+0xff,0xc1,0x6b,0x9c,0xd4,0xde,0x3f,0xd2,0x33,0x64,0x27,0x79,0x74,0xcf,0x22,0xd3,0x90,0x6f,0xc0,0xfd,0x67,0x56,0x60,0x32,0x6c,0x4d,0xa7,0x1d
+};
+const size_t WM_PK_INFO_HTML_BR_LEN = 444;
+#else
+const uint8_t WM_PK_INFO_HTML_BR[] PROGMEM = { 0 };
+const size_t WM_PK_INFO_HTML_BR_LEN = 0;
+#endif
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_WIFI_HTML_BR[] PROGMEM = {
+0x1b,0xfd,0x08,0x00,0x9c,0x07,0x76,0x4c,0xb2,0xc3,0x6d,0x5f,0x18,0xba,0x2c,0xcb,0x93,0x33,0x49,0xff,0x71,0x2e,0x95,0xad,0x7b,0xcd,0x41,0xd6,0xfe,0x03,0x4c,0x06,
+0x40,0xb2,0xc8,0x97,0xeb,0x08,0x84,0x54,0x5b,0xbd,0x3c,0x76,0x24,0xe5,0x27,0x2e,0x93,0xdf,0xeb,0x84,0xaa,0xf5,0xdd,0xd2,0x37,0xb9,0xe4,0x95,0xb5,0x77,0x12,0xe6,
+0x12,0x06,0x84,0xc4,0x58,0x50,0x28,0x84,0xb4,0x1f,0x1d,0xe2,0xbc,0x4b,0x1d,0x16,0x98,0xf9,0x05,0xbe,0x89,0x49,0x7b,0x04,0x82,0x12,0x12,0xbc,0xe7,0xd6,0x76,0x68,
+0x46,0xaf,0x1d,0xee,0x40,0xbd,0x9c,0x56,0xa0,0xa4,0x15,0x53,0x8b,0x16,0x20,0x73,0xed,0x1c,0x0a,0xa5,0xc8,0xb2,0x6b,0xc2,0xe4,0x06,0x48,0xff,0xfc,0x98,0x1c,0x24,
+0x6d,0x26,0x27,0x4e,0xd9,0x9e,0xd5,0x05,0x24,0x11,0xb0,0xc4,0xf4,0x30,0xf7,0x66,0xde,0x68,0x38,0x0d,0xc6,0x32,0xf6,0x3e,0x64,0x89,0x7b,0x33,0xd8,0xb0,0x68,0xd5,
+0x55,0xfe,0x0a,0xa7,0xc3,0x7c,0x64,0x06,0x0e,0x0d,0x27,0xae,0x4e,0x78,0x88,0x64,0x8e,0x78,0xec,0x86,0x04,0xda,0x37,0xef,0x05,0x6e,0xd2,0x6b,0x94,0xd3,0x6b,0x29,
+0xfc,0x64,0xf3,0xcf,0xe0,0xda,0x75,0x92,0x2b,0x1e,0x1a,0x13,0xc3,0x1f,0x05,0x43,0xd5,0xa1,0xdd,0x7a,0x47,0xfb,0x1c,0x40,0x5b,0x87,0x12,0xc7,0x61,0x1d,0x37,0x6f,
+0xed,0x67,0xbc,0x51,0xb0,0x05,0x34,0xe2,0x9a,0xc8,0x33,0xf6,0x2e,0xcf,0xb3,0x3e,0xba,0x5c,0xf5,0x35,0x7a,0x3a,0x13,0xf2,0x3d,0xec,0x49,0x1e,0x56,0xab,0xa9,0x3d,
+0x07,0xb8,0xd4,0x9c,0xe0,0xcf,0x39,0x41,0x8a,0xf2,0xbd,0xd9,0x53,0x36,0x48,0x2b,0xd0,0x31,0x78,0xec,0x0b,0x9c,0xb9,0x49,0xca,0xd1,0x44,0xc9,0xc1,0x51,0x0f,0x18,
+0x6d,0x4a,0x00,0x37,0x5e,0xd6,0x28,0xd8,0xd2,0xaa,0x07,0xc3,0x9a,0xc5,0xbb,0xd1,0x88,0x98,0xa5,0xde,0x36,0x8a,0x8d,0x1c,0xed,0x01,0x13,0x42,0x80,0x41,0x9d,0x9b,
+0xc0,0xeb,0x0b,0xcc,0x4d,0xef,0x58,0x84,0x52,0x42,0x35,0xf6,0x7e,0x75,0xb1,0x05,0x39,0x14,0x82,0x30,0xb1,0x51,0x58,0x45,0x11,0x1c,0xfc,0x8f,0xdf,0xbf,0x63,0xfe,
+0xef,0x98,0x5b,0x7c,0x7e,0xb2,0xc5,0x97,0x88,0x90,0x14,0x9d,0x31,0xe3,0x7f,0xd1,0x52,0xa8,0xe3,0x54,0xb3,0xe9,0xbf,0x88,0xe7,0x24,0x4c,0xe0,0xfa,0xc6,0x02,0x3a,
+0x81,0x60,0xf9,0x1a,0x97,0x6d,0x90,0x37,0x16,0xa7,0xfb,0x4d,0x98,0x77,0xc4,0xe6,0x85,0x44,0x54,0x3d,0xd2,0xff,0x69,0x15,0x78,0x58,0xe3,0x27,0x48,0x7b,0x37,0x63,
+0xb5,0x9d,0xe8,0xe4,0xd2,0xc1,0x81,0xf6,0x90,0x6c,0x50,0x48,0x54,0x11,0xab,0x57,0x7e,0xd4,0xde,0xac,0x30,0xd2,0xf1,0xaf,0xb9,0x9b,0x43,0x0b,0xab,0x95,0x80,0x52,
+0x89,0x6f,0x42,0xde,0xde,0x1e,0xef,0x69,0xa6,0x5a,0x0b,0xea,0x85,0x76,0x20,0x34,0xb9,0x85,0x16,0xa3,0x66,0xa1,0x25,0xbe,0x6f,0x08,0xbd,0x1a,0x68,0x31,0x86,0x99,
+0x24,0xbe,0x4c,0x2b,0x45,0xf2,0x2e,0x64,0x63,0x4b,0x17,0x4e,0x58,0x67,0xfd,0x7c,0xd0,0x2a,0x9b,0xfa,0xf6,0x2c,0x4d,0x59,0x31,0xb5,0xdb,0x75,0x2f,0x92,0xde,0xa6,
+0xb9,0x64,0x6b,0xa5,0x44,0x6d,0x40,0x0d,0x45,0x89,0x9b,0xfe,0x8f,0x49,0xd0,0xf4,0x50,0x44,0xbe,0x36,0x6b,0x33,0x0c,0x5a,0x11,0xaf,0xca,0xb6,0x8f,0x03,0x16,0x1f,
+0xad,0x1a,0x9a,0x28,0x9d,0x1b,0x1d,0x1a,0xfd,0x6a,0xab,0x89,0x37,0x75,0xa8,0x7b,0x20,0xb1,0x6a,0x72,0xff,0xe7,0xea,0x7d,0x3c,0xb7,0x16,0xed,0x3a,0xf0,0x21,0x2b,
+0x9a,0xa7,0x20,0xb9,0x47,0x56,0xa4,0xfa,0x75,0xea,0x15,0x69,0x20,0xdd,0xf1,0x0a,0x4b,0xb6,0x90,0x55,0x4a,0x6b,0x5b,0xf5,0xc6,0x73,0x9f,0x86,0x41,0x2b,0x47,0xd5,
+0xa5,0x02,0xca,0x0c,0x6d,0xf2,0x29,0xe3,0xb4,0xc9,0xa7,0x2c,0xd2,0x06,0xb7,0xf0,0x5d,0x01,0xfd,0x23,0xda,0xd8,0x40,0xa6,0x57,0xd5,0x73,0xbf,0x38,0xca,0x12,0x6e,
+0x15,0xde,0xa8,0xbb,0x2e,0x59,0x8a,0x02,0x9c,0x4e,0xc8,0x7a,0x28,0xc4,0x33,0x9b,0xc8,0xbb,0x1c,0x7f,0x13,0x9a,0x0a,0xbc,0x9f,0x5a,0x28,0x30,0xb8,0x01,0xd9,0x5c,
+0xb3,0x2b,0xf8,0xd2,0x62,0x6f,0x18,0xc5,0x85,0x43
+};
+const size_t WM_PK_WIFI_HTML_BR_LEN = 682;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_WIFI_HTML_BR[] PROGMEM = {
+0x1b,0x0a,0x09,0x00,0x1c,0x07,0x6e,0x2c,0xc7,0x68,0x25,0x3f,0x33,0x03,0xe7,0x4c,0xd9,0xb8,0x6b,0x07,0xf9,0x35,0x03,0x4c,0x1e,0x80,0x64,0x31,0xfd,0x65,0xd0,0x74,
+0x48,0xc2,0xbe,0xb4,0xfd,0x39,0xfd,0x73,0x1b,0x3b,0x63,0x46,0xd0,0x17,0x21,0x87,0xa3,0xdf,0x32,0x5e,0xfc,0x68,0xbf,0x16,0xd2,0x5d,0xcd,0xe7,0xb1,0xff,0x9d,0xb7,
+0x73,0x62,0x8a,0x59,0x12,0x5d,0x41,0x25,0x14,0x42,0x25,0xd2,0xc5,0x12,0x5e,0x1b,0x35,0x7f,0x74,0x88,0xf3,0x2e,0xd4,0x59,0x60,0xe6,0x3b,0xf8,0x16,0x4c,0x5a,0xc6,
+0x21,0x23,0x08,0xf0,0x5a,0x6b,0x3b,0xa4,0xd0,0x6b,0x87,0x23,0x50,0x2f,0x27,0x03,0x94,0x64,0x30,0xb5,0x68,0x01,0x32,0xad,0x9d,0x43,0x99,0x52,0x64,0xd9,0x05,0x6e,
+0xd1,0x1c,0x92,0xde,0xba,0xd7,0x51,0x9f,0x0d,0x9e,0x48,0xe8,0x2b,0x97,0x7c,0xab,0x2b,0xc5,0x29,0xb5,0x67,0x75,0x86,0x24,0x09,0x60,0x49,0xea,0x5a,0xea,0x57,0xfd,
+0x62,0xa1,0x22,0x4b,0x32,0x76,0x3d,0x44,0x89,0x7b,0x0a,0x6c,0x98,0xb6,0x63,0xdd,0x99,0xc1,0x69,0x2d,0x2d,0x5a,0xd2,0x65,0x85,0xb2,0xa7,0x13,0x4e,0x22,0x98,0x23,
+0x1d,0x96,0x20,0x80,0xf6,0xca,0xe2,0x47,0x7a,0x2a,0xd3,0x1b,0xb8,0x99,0x11,0x0b,0x57,0x6c,0x7e,0x1b,0x74,0x34,0x54,0x9d,0x01,0x0d,0x73,0xe5,0x5c,0x50,0x94,0x05,
+0xd5,0xc1,0xdd,0x7a,0x47,0xfb,0x1c,0x40,0x5b,0x7e,0xc0,0x8f,0x2d,0x03,0x94,0x9e,0xc9,0x66,0xbc,0x0e,0xcc,0x3a,0x34,0xcc,0x35,0x91,0xc7,0x70,0xf1,0xfc,0x98,0xf5,
+0xb1,0xe4,0x4a,0xdd,0x9a,0x31,0x4c,0x2e,0x16,0x7e,0x0f,0x68,0xa8,0xfb,0x53,0x7b,0x0e,0x70,0x71,0xac,0xe0,0x8f,0xc5,0x4b,0xa9,0x7c,0x0f,0x66,0x94,0x0d,0xe2,0x0a,
+0x74,0x34,0x6e,0x03,0x8e,0x33,0x6d,0x92,0x72,0x24,0xa1,0xe4,0x60,0xa9,0x0c,0x33,0x6d,0x9c,0x00,0x6a,0xbc,0x2c,0xc1,0xd9,0x92,0x31,0xbc,0x21,0xcd,0xa2,0xdb,0x41,
+0x40,0x92,0xa5,0xba,0xa9,0x29,0x34,0x61,0x69,0x19,0x4c,0xce,0x39,0x18,0x54,0x38,0x06,0x5e,0x2f,0xa0,0x46,0x3d,0xa2,0xee,0x4b,0x90,0x41,0x22,0xf3,0xab,0x68,0xd6,
+0x93,0x23,0x7c,0x90,0x4c,0x4c,0x70,0x23,0x53,0x00,0x4b,0x0f,0xe8,0xdd,0xff,0xd7,0xf5,0x9e,0x03,0xe6,0x17,0xf5,0xd5,0xca,0xac,0x7f,0x49,0x11,0x92,0x45,0x67,0xc4,
+0xf8,0x77,0x8c,0x58,0x68,0x80,0x0e,0x7a,0xc7,0xc1,0x94,0x4f,0x54,0xa8,0x60,0xfb,0x40,0x1d,0x3a,0x06,0xc1,0xd2,0x6b,0x5c,0x66,0x21,0x6f,0x24,0x4e,0xc7,0x5b,0x30,
+0xcf,0x37,0xad,0x8b,0x10,0x51,0x76,0x28,0xfe,0x8f,0x06,0xd2,0xc7,0x1a,0x3f,0x21,0xb4,0x77,0x0a,0xab,0xed,0x44,0x81,0xc6,0x83,0x3c,0x7d,0x9b,0x89,0x97,0xbe,0xea,
+0x26,0xec,0x47,0x2e,0x19,0x28,0xb9,0x97,0x7a,0xa5,0x87,0xf3,0x26,0x85,0x11,0x3d,0xfe,0xb6,0xe3,0x75,0x40,0x42,0xdd,0xe7,0x18,0x0c,0x54,0x60,0x41,0xbc,0xbf,0xdf,
+0x5e,0x10,0x4b,0xad,0x19,0xea,0x85,0xe6,0x11,0x52,0x0e,0xa1,0xc5,0xa8,0x71,0x10,0x15,0xb8,0x86,0xd0,0x33,0x81,0x8b,0x31,0x94,0x49,0xe2,0x2b,0x52,0x97,0x20,0x81,
+0x5c,0x0b,0xd1,0xd8,0xd2,0x8e,0x23,0x56,0x88,0x27,0x87,0x85,0x1b,0x39,0xe8,0xe8,0xad,0xce,0xcf,0x68,0x26,0x8c,0xb6,0xd8,0x75,0x2c,0xe2,0x9d,0x25,0x36,0xc9,0x98,
+0x93,0xc1,0x26,0x94,0x14,0x84,0x87,0x1b,0xfe,0x5b,0xe2,0x9f,0x79,0x71,0xe4,0xbc,0xf4,0x7a,0xac,0x29,0x10,0x32,0x08,0xd7,0x24,0xd8,0x08,0x03,0x06,0x37,0xed,0x18,
+0x44,0x8e,0xac,0xc1,0xa1,0xb9,0x2f,0xf6,0xe1,0x02,0xb1,0x6a,0x4f,0x97,0x21,0x80,0xaa,0xe4,0xfb,0xad,0x4a,0x1f,0x51,0xf9,0x54,0x77,0x34,0x94,0x01,0xc4,0x4b,0x5f,
+0x12,0x3d,0x1c,0xeb,0xbe,0x8c,0x12,0x57,0xd8,0x59,0x12,0x49,0xbf,0xe9,0xb6,0xfe,0x24,0x9b,0xfc,0xdd,0x1a,0xf7,0x13,0xce,0x83,0x48,0x52,0x9f,0x4a,0xcd,0x3e,0x9a,
+0xd4,0x9e,0x56,0x74,0x92,0x1b,0x23,0xea,0x8f,0x21,0xc6,0x58,0x77,0xd4,0x50,0xfe,0x25,0x4a,0x6c,0xe2,0xcb,0xc3,0x22,0xcb,0xfc,0x98,0x6b,0xd8,0xc6,0xcb,0x5c,0xce,
+0x36,0xbe,0xcc,0x8d,0x6c,0x83,0x87,0xf1,0x1d,0x06,0xfb,0x6f,0x6c,0xa3,0xfa,0x34,0xea,0xeb,0x49,0xb6,0x70,0x4a,0x4d,0xbd,0xaa,0xf7,0x3a,0xde,0x30,0xe2,0x2b,0xa6,
+0x73,0xd4,0x66,0xf1,0xd9,0xd1,0xfb,0xa8,0xbd,0xd4,0x65,0x34,0xb6,0x47,0xb9,0x6e,0xfb,0x64,0x20,0xfd,0x9f,0x5c,0x54,0x70,0xd7,0x11,0xc4,0x7b,0x9c,0xec,0x5e,0x45,
+0x62,0x5c,0x20,0x0e,0x92,0xb9,0xd8,0x08
+};
+const size_t WM_PK_WIFI_HTML_BR_LEN = 744;
+#else
+const uint8_t WM_PK_WIFI_HTML_BR[] PROGMEM = { 0 };
+const size_t WM_PK_WIFI_HTML_BR_LEN = 0;
+#endif
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_MQTT_HTML_BR[] PROGMEM = {
+0x1b,0xee,0x07,0x00,0x2c,0x0e,0xcc,0xb3,0x9d,0x38,0x72,0xe9,0x63,0x9d,0x14,0x39,0x5c,0xd0,0x3a,0x2a,0x4f,0xce,0x24,0x9b,0x29,0xf0,0xf1,0x5d,0x47,0x52,0x7e,0xe2,
+0x32,0x70,0x2e,0x95,0xad,0xbb,0xa6,0xc8,0xc9,0x80,0x15,0xfb,0x3e,0x71,0x78,0x63,0x21,0xfd,0x6a,0xa7,0xc9,0x97,0xf6,0xd3,0x1a,0x8b,0x52,0x55,0xf8,0x29,0xbd,0x26,
+0xef,0xf2,0x8b,0xf7,0x07,0xc0,0x6e,0x0a,0x30,0xc9,0x0d,0x41,0x03,0x39,0x45,0xc2,0xce,0x44,0xba,0xba,0x27,0xcb,0xa0,0xd3,0xac,0x7c,0x8c,0xbf,0xa4,0xa4,0x2d,0x14,
+0xcb,0x13,0x18,0x78,0x93,0x83,0x1d,0x3a,0x58,0xb4,0xc3,0x25,0x18,0x96,0x13,0x81,0x92,0x88,0xbd,0x45,0x0b,0x90,0x19,0x9a,0xdd,0x40,0x50,0x14,0xec,0x2c,0x4d,0x21,
+0xf7,0xfb,0xcf,0x6f,0x6f,0x93,0x25,0x67,0x6a,0xd2,0x4b,0xaa,0x73,0xe4,0x21,0x54,0x05,0xdf,0xdd,0xd1,0xbc,0x9d,0x97,0x45,0xb3,0xac,0x2a,0xd8,0xd3,0x60,0x5d,0xed,
+0x1d,0xe8,0x60,0x63,0x14,0xfc,0xf0,0x85,0xa5,0xdd,0x51,0x99,0x2e,0xa7,0x59,0x51,0xcf,0x0c,0xc2,0x75,0x18,0x32,0x25,0xe1,0x10,0x18,0xca,0xbe,0xf9,0x69,0x39,0xdb,
+0x06,0x52,0x4f,0x03,0x9b,0xad,0xfe,0x74,0xfc,0x33,0xa2,0xd8,0x9a,0xed,0x41,0x47,0xab,0xa4,0x4e,0x16,0xe5,0xb2,0xb0,0x1b,0x32,0xa3,0x77,0x4c,0xcc,0x01,0xa8,0xf5,
+0x6b,0xfa,0x34,0xe5,0x8a,0xfc,0x63,0x58,0x72,0xd3,0x20,0x7d,0x59,0x85,0xc3,0x00,0xfa,0x0f,0x42,0xd9,0x8f,0xcd,0x56,0xae,0x28,0xd6,0xf2,0x6c,0xf1,0x49,0x8f,0xd2,
+0x18,0x90,0xfe,0xaf,0x07,0x90,0x3f,0xa8,0x79,0xd9,0xf5,0x63,0x8c,0xe0,0xfc,0x96,0x6a,0x07,0x79,0x59,0x26,0x16,0xa2,0x15,0x57,0xfb,0x84,0x0e,0xa0,0xaa,0x47,0x81,
+0x23,0x95,0x25,0x83,0xfb,0x3e,0x02,0x93,0x04,0xa1,0x80,0xa1,0x89,0x87,0x05,0x45,0xa3,0xd9,0xf1,0x1c,0x6d,0xa6,0x10,0x91,0x86,0x41,0x94,0x20,0x92,0xf2,0x48,0x68,
+0x2d,0xaa,0xbf,0xe8,0x66,0xc3,0xf6,0xc7,0xc6,0x11,0x42,0xac,0x7b,0x1b,0xea,0x51,0xa3,0x48,0x5b,0x40,0x28,0xa5,0xd0,0xe4,0xc0,0x19,0x50,0x7d,0x0f,0x9d,0xef,0x25,
+0x7d,0x2e,0x35,0x74,0x2b,0xf8,0x6f,0x90,0x10,0x87,0x72,0x08,0x4a,0x6c,0xd1,0x20,0x8f,0xc0,0xe6,0xff,0xf0,0x7b,0xeb,0x75,0xed,0x73,0xfe,0xfe,0x48,0xff,0x47,0x41,
+0xc7,0xa9,0x55,0x76,0xa8,0x65,0x8e,0xca,0xc6,0x75,0x29,0xa6,0x41,0x9f,0x1b,0x73,0x00,0xe4,0xfb,0x37,0xe9,0x2b,0xd5,0x55,0x89,0x4d,0xee,0x25,0xbd,0x9c,0xe3,0xd2,
+0x9f,0x20,0x33,0xde,0xc1,0xf5,0x3b,0xd1,0x8e,0x61,0x02,0xba,0xf5,0xff,0xd8,0x3e,0x64,0xc9,0xff,0x38,0xcc,0x0e,0x70,0x56,0x5c,0x51,0x6c,0xb8,0x36,0x44,0x69,0xc4,
+0xc3,0xcc,0x8e,0x39,0x03,0x3f,0xfb,0xb1,0xf2,0xb9,0x80,0x29,0xa1,0x96,0xe1,0x6c,0x17,0xe9,0x51,0xc9,0xe1,0x96,0x2e,0x0a,0xb5,0x07,0x7c,0x99,0x00,0x68,0x25,0xc7,
+0x52,0x3a,0x36,0x63,0x45,0xc1,0xd5,0xb3,0x9f,0xb8,0xe2,0x09,0x96,0x0b,0x2f,0x55,0xc1,0x95,0xb8,0x79,0xc7,0xe6,0x7e,0x39,0x6d,0x9a,0x9c,0xc5,0x1e,0x12,0x5c,0x91,
+0x85,0x2d,0xd0,0x78,0x96,0x44,0xed,0xd4,0xd4,0x86,0xe4,0xb8,0x83,0x3b,0xc1,0x4e,0xd7,0xe6,0x7d,0x4a,0x1a,0xeb,0xff,0x58,0x3c,0x06,0x70,0x0a,0x47,0x16,0x6f,0x82,
+0xdc,0x6c,0xaa,0xb7,0x2b,0xc1,0x70,0xee,0xc4,0xe4,0x60,0xe1,0x5f,0x42,0x82,0x92,0x87,0x3f,0x16,0x8f,0x70,0xfa,0x12,0x08,0x2f,0x74,0x67,0x07,0x3f,0x77,0xe0,0x11,
+0xf1,0x65,0xcd,0x9e,0x50,0x40,0x40,0x7b,0xcc,0x5d,0x9b,0x8f,0x14,0x3d,0x8c,0x13,0x27,0x59,0xa8,0x01,0xf7,0xc3,0x60,0x95,0x53,0xb5,0x15,0x25,0x1b,0x87,0xe0,0x64,
+0xff,0xd1,0x9a,0xe5,0x02,0xec,0x61,0xd5,0x62,0x84,0xe5,0xfb,0x44,0xd5,0x21,0x7e,0xe4,0x8d,0x57,0x87,0x2b,0x67,0x5a,0x2e,0x31,0x9e,0xb8,0x9e,0x86,0x3c,0xa2,0xc1,
+0x9d,0xf7,0x5d,0xe5,0xdc,0x69,0xc2,0x33,0x4e,0x4e,0x11,0x5e,0x52,0xfc,0x23,0x6c,0x71,0xd0,0x8a,0xd2,0x15,0x7b,0x66,0x66,0x4e,0x05,0x80,0x26,0xfa,0x00,0xd8,0x40,
+0x03,0xd2,0xb1,0x16,0xec,0xb2,0x69,0xba,0x79,0x47,0x2f,0xe7,0xff,0x4a,0xe3,0x6f,0x22,0x06,0x1b,0x91,0xd7,0xb4,0x6d,0x48,0xcb,0x26,0xbc,0xfc,0xe6,0x3f
+};
+const size_t WM_PK_MQTT_HTML_BR_LEN = 702;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_MQTT_HTML_BR[] PROGMEM = {
+0x1b,0x0c,0x08,0x00,0x1c,0x07,0x76,0x0c,0xed,0xba,0x43,0xd0,0x1c,0xce,0xe7,0x9d,0x33,0x65,0xe3,0xfe,0x90,0xfb,0x92,0x63,0xd6,0x2b,0xa5,0xb0,0x85,0x4a,0x47,0x20,
+0xec,0x49,0xdb,0xab,0xd3,0xb7,0xea,0x7b,0x84,0x9a,0x1c,0xb8,0xa6,0x6d,0xf9,0xef,0xb6,0x82,0x20,0x8f,0xde,0xef,0xff,0xde,0x3c,0x67,0xc5,0x2a,0xe1,0x02,0x2d,0xf8,
+0x92,0xef,0xcc,0xfd,0xf3,0xb6,0xf7,0xb4,0x62,0x4b,0x29,0xf4,0x66,0x52,0x1b,0x87,0x12,0xb0,0x50,0xbc,0x36,0xd0,0x20,0xc7,0xc6,0x68,0x2e,0x1b,0x6d,0x3c,0xf9,0xca,
+0x6d,0xe2,0x9b,0x98,0xb4,0x82,0x82,0x2b,0x30,0xf0,0x6e,0xd8,0xd8,0xa1,0x80,0x41,0x3b,0xec,0x83,0x66,0x39,0x25,0xa0,0xa4,0x84,0xb9,0x45,0x0b,0x90,0x29,0x3f,0x8b,
+0xad,0x88,0x22,0x61,0x27,0x68,0x1f,0xf1,0x1e,0x9c,0x69,0x35,0x58,0x83,0x47,0x4a,0xbc,0xd8,0x21,0x17,0x37,0xf7,0xf7,0x6c,0xf2,0x87,0x54,0x67,0xc4,0x87,0x50,0x15,
+0xa8,0xae,0xef,0x78,0x73,0x6f,0x3c,0x9a,0xf1,0x49,0x06,0xbb,0x18,0xac,0xaa,0xbd,0x00,0x1e,0x2c,0x2f,0x8d,0x16,0x2f,0x58,0x5a,0xdf,0x19,0xf7,0xb9,0x33,0x18,0x4d,
+0x5d,0x81,0x70,0x18,0x86,0x4c,0xb1,0xd8,0x00,0x43,0xd9,0x0b,0x6f,0x21,0x77,0xe3,0x56,0x92,0x39,0xad,0x62,0x10,0x7c,0xf0,0xf8,0x75,0x74,0xba,0x45,0x1e,0x8b,0xac,
+0x13,0xf4,0xa6,0x3d,0x7f,0xcc,0x47,0x72,0x43,0x7a,0xf4,0x8e,0x8e,0x39,0x00,0xb5,0x6a,0x46,0x8f,0x83,0x1a,0x3a,0xea,0xa5,0x76,0xca,0x0d,0x50,0xb7,0x52,0x32,0x58,
+0x0b,0x40,0xc6,0xeb,0x94,0xbd,0x15,0x83,0xc0,0xf8,0x87,0xdd,0x2c,0xd9,0xf2,0x9f,0xa9,0x4c,0xf2,0x1c,0x75,0x8b,0x05,0x20,0xbb,0x51,0xf3,0x1c,0xf6,0xaf,0x2e,0x30,
+0x82,0xf5,0x5b,0x2a,0xdf,0x72,0x4b,0x07,0x62,0xba,0x13,0xe8,0x74,0x9e,0xd0,0x01,0x54,0x69,0x23,0x20,0x36,0x72,0x92,0xc1,0x7d,0x1a,0x2d,0x91,0x84,0x48,0x01,0x43,
+0xbd,0x13,0x9f,0xa2,0x51,0xcd,0x78,0x8e,0x3c,0x44,0x21,0x0c,0x35,0x51,0x67,0x82,0xc4,0x94,0x5b,0x42,0xcb,0x51,0xfe,0x95,0x6a,0xce,0xb0,0xfc,0xd1,0x66,0xc4,0x23,
+0xe6,0xbd,0xd6,0xb5,0x7c,0x23,0x43,0x2b,0x50,0xa7,0x94,0x82,0x93,0xb5,0x2d,0xa0,0xfa,0x14,0x16,0xaa,0xfb,0x58,0xae,0x24,0xc9,0x72,0xad,0x5f,0xf5,0xba,0x15,0x1d,
+0x72,0x21,0x60,0x62,0x8e,0x6a,0x59,0x1e,0x8c,0x6f,0x94,0x3f,0xff,0xff,0x7a,0xc7,0x46,0xf5,0x0b,0xcb,0x47,0xdd,0xfa,0xf2,0xa0,0x63,0xe4,0x2a,0xdd,0xd4,0xb2,0x8c,
+0xcc,0xc6,0x79,0xa9,0xd4,0xd7,0xba,0x3a,0xcf,0x05,0x20,0x5f,0x8d,0xfa,0x17,0xca,0xab,0x62,0x9a,0xe8,0xd9,0x8c,0x7b,0xf8,0xeb,0x4f,0x90,0x18,0x2f,0xe0,0xff,0x3b,
+0x91,0xef,0xc2,0x04,0xfe,0xa6,0x7f,0xb1,0x7c,0x70,0xd6,0x5f,0x14,0xae,0x00,0x09,0x74,0x4a,0x11,0xe9,0x2c,0x07,0xf3,0x86,0x86,0x3b,0xee,0xe4,0x98,0xd1,0xf0,0xb3,
+0x8a,0x40,0x65,0x0f,0xba,0x84,0x9a,0x03,0x89,0x7d,0xfb,0x9c,0xc9,0x85,0x16,0x91,0xe2,0x2d,0x00,0x0f,0xf6,0x00,0x7e,0x6d,0xd8,0x96,0xd2,0xa6,0x03,0x16,0x36,0x3a,
+0xbd,0xf4,0xb5,0x4e,0xc3,0x04,0xc9,0x85,0x73,0xdc,0xe8,0x54,0x68,0x9e,0xb1,0xb9,0xd7,0xee,0xcf,0x66,0xc3,0x20,0xa6,0xc8,0xe8,0x94,0x24,0x6c,0xe8,0x5f,0x55,0x54,
+0x2e,0xef,0xd1,0xc9,0xf9,0x9f,0xb3,0x75,0xb9,0x44,0x72,0xa5,0x99,0x08,0xc7,0xb0,0x15,0xda,0x0e,0x1c,0x69,0x91,0xa1,0x6d,0xe2,0x5f,0xe2,0x93,0x0f,0x76,0xcc,0x33,
+0xa1,0x35,0xf4,0x1c,0x88,0x5d,0x07,0x70,0x07,0x22,0xb4,0x65,0x62,0x92,0xb5,0x25,0xf0,0xa2,0x83,0x08,0x90,0x67,0xb8,0x81,0xb4,0x6f,0xd2,0x22,0x6a,0x48,0x37,0x89,
+0x2e,0xe0,0x59,0xc2,0x53,0x4b,0x40,0xf8,0x20,0x1a,0xf9,0xa5,0xeb,0xbe,0x24,0xd9,0xc8,0xbf,0xfc,0xbd,0x69,0x17,0x6c,0xaf,0x19,0x7e,0x13,0x2c,0x9f,0x7a,0x25,0x48,
+0x1b,0x16,0x19,0x11,0x92,0x37,0x65,0x91,0x73,0x1f,0x6c,0x67,0x4d,0x1e,0x4b,0x2a,0xc8,0xb0,0x7e,0x7e,0x97,0x92,0xc7,0x97,0xca,0x8e,0x5f,0xac,0x38,0xb9,0x3f,0xbf,
+0x23,0x8e,0xe0,0xae,0x4e,0xeb,0x5a,0x37,0x62,0x73,0xb6,0x65,0xe6,0x0f,0x8d,0xa8,0x22,0xe7,0xc4,0xa4,0xe5,0x65,0xa2,0xa8,0x50,0xe5,0x12,0xa3,0x45,0xec,0x58,0x24,
+0x56,0xce,0x9a,0xc4,0x5e,0x44,0x14,0xf7,0x22,0x67,0x65,0xf2,0x46,0xbc,0xfa,0x8a,0x77,0x42,0x31,0x9b,0xea,0xa7,0x76,0x09,0x85,0xcf,0x35,0x3f,0xc3,0x8f,0xdc,0x5c,
+0xa5,0x06,0x8a,0xf4,0xf7,0x80,0x3d,0x08,0x5d,0x39,0xae,0x46,0x4e,0xb8,0x98,0xee,0xe7,0xd8,0x9d,0x22,0x19,0xf7,0x7e,0x4a,0xa1,0xf1,0xb6,0x2e,0xd8,0x9d,0x29,0xbb,
+0x9a,0x72,0x11,0x29,0x15,0x85,0x92,0x5d,0x76,0x00
+};
+const size_t WM_PK_MQTT_HTML_BR_LEN = 778;
+#else
+const uint8_t WM_PK_MQTT_HTML_BR[] PROGMEM = { 0 };
+const size_t WM_PK_MQTT_HTML_BR_LEN = 0;
+#endif
+#endif
+const uint8_t WM_PK_STYLE_CSS_BR[] PROGMEM = {
+0x1b,0x15,0x1b,0x00,0x9c,0x85,0xb1,0x33,0xed,0x62,0xca,0x22,0xbb,0x74,0xfe,0xa3,0x84,0x83,0xed,0x43,0x32,0x46,0x48,0x32,0xab,0xb9,0x49,0xca,0x22,0x21,0xa1,0xc2,
+0x14,0xa7,0x60,0x3b,0x06,0xc9,0x1e,0x92,0x1f,0xae,0xb9,0xab,0x35,0x55,0x76,0x53,0xfe,0xff,0x64,0x81,0xaf,0xac,0x74,0x59,0x06,0x64,0xe7,0xf6,0xdd,0xcf,0x94,0x3d,
+0x37,0xa0,0xb4,0x9f,0x37,0x75,0xf2,0xf4,0xb1,0x2c,0x0f,0x0a,0x7b,0x49,0x06,0x94,0x2e,0x0a,0x68,0xf7,0xed,0xf7,0xbf,0x8a,0x7a,0x24,0x24,0x5e,0x69,0x88,0x9d,0x4e,
+0x89,0x44,0xbd,0x3b,0xbb,0xb3,0xdf,0x4c,0x13,0x36,0xb2,0xf7,0x7e,0x31,0x69,0x88,0x37,0xe2,0xe7,0x74,0x22,0x89,0x16,0x68,0xd4,0x48,0x8a,0xb8,0x9d,0x93,0xcf,0xc6,
+0x7e,0xab,0x88,0xcb,0x1e,0xda,0x1b,0x51,0x21,0x31,0xc9,0x34,0xce,0xa0,0x50,0x7e,0x43,0x8b,0x85,0x0e,0x10,0x8f,0xd7,0xbe,0xf6,0x9d,0xd7,0x65,0xb1,0x30,0x0a,0x6f,
+0xe8,0x40,0x5b,0x8f,0xae,0x05,0xca,0xd8,0xc3,0x33,0x1a,0x30,0x5e,0xfc,0x92,0x79,0x90,0x91,0x52,0xf5,0x37,0x78,0xd3,0x96,0x4e,0x6c,0x56,0x29,0x9d,0x74,0x0d,0xb5,
+0x46,0xf1,0x0c,0x29,0x72,0x7c,0xd4,0xb6,0xba,0x6a,0x55,0x7e,0x52,0x6c,0x5f,0x9b,0x04,0x92,0x1a,0x01,0x9e,0x45,0xf6,0x77,0xa8,0xec,0x3c,0x11,0x62,0x20,0x60,0xc5,
+0xd9,0xa5,0xf5,0x34,0xa5,0x1c,0x5b,0x2b,0xf8,0x02,0x96,0x8a,0x50,0xac,0xb0,0x82,0x62,0x5a,0x6d,0x46,0xe6,0x74,0x7c,0x31,0x3a,0x07,0x9e,0xf8,0xfd,0xd1,0xe8,0xd3,
+0xc2,0x76,0x6f,0xdf,0x1f,0xa3,0xfd,0x07,0x9a,0x7d,0x7e,0xcf,0xdf,0x71,0xa7,0xa2,0x45,0x8e,0x2a,0x62,0xea,0xe2,0x59,0x61,0x94,0x52,0xce,0x82,0x9e,0xe1,0x42,0xd5,
+0xf4,0x63,0x63,0xe4,0x99,0x18,0xbf,0x91,0xd2,0x2e,0x36,0xf9,0x13,0xaa,0x7c,0xa6,0x8a,0x53,0x91,0x59,0x47,0x89,0x37,0x2b,0xa9,0xab,0x37,0x68,0x94,0x89,0xca,0x09,
+0xc5,0xac,0x23,0x3b,0x4b,0x30,0x0e,0xef,0x9d,0x12,0x09,0x41,0xdd,0x64,0xa7,0x1c,0xc8,0x09,0xc7,0x1d,0x80,0xd2,0x83,0x87,0xec,0xab,0x7b,0xad,0x21,0x80,0xdc,0x3a,
+0x83,0x40,0xd1,0x37,0x7e,0x05,0x9f,0x56,0xc7,0x82,0xf7,0xc6,0x7b,0xe7,0x3d,0x23,0xe7,0x22,0xad,0x6c,0x71,0x86,0x1d,0xa7,0x60,0x77,0xdf,0xee,0x66,0x8c,0x4a,0xb1,
+0x23,0x47,0x4e,0x06,0x47,0xb2,0x33,0x00,0x3e,0xed,0x3c,0x2f,0xcb,0xd8,0x8b,0xf4,0x5e,0xe5,0x6a,0xcd,0x5c,0xc0,0xa3,0x00,0xfb,0x06,0xe4,0x0a,0x7c,0xa0,0x65,0xe5,
+0x24,0x89,0x78,0xf2,0xd3,0x21,0xec,0x32,0x07,0x9e,0x1c,0xdb,0x17,0x3b,0xe6,0xf9,0x27,0xc7,0xbd,0xe7,0xf2,0x3c,0x6a,0x5e,0xd7,0x8e,0x79,0x09,0xc0,0xd9,0x66,0x14,
+0x58,0x50,0xb9,0xd7,0x63,0xc8,0x02,0x7d,0x71,0x8c,0x99,0xad,0x38,0x4e,0xb6,0x90,0x38,0x80,0x3e,0xda,0xb5,0xbc,0x32,0x0a,0x0e,0xdf,0x02,0xf5,0x85,0x12,0xd4,0x91,
+0x80,0x2d,0x7c,0x90,0x70,0x26,0x1c,0xc1,0x01,0x24,0xfe,0x1b,0x5f,0xc3,0x11,0xf1,0x55,0xed,0x2c,0xa2,0xa2,0x65,0x62,0x01,0x58,0xc5,0xb5,0xa2,0x36,0x66,0x5b,0xee,
+0x1b,0x11,0x15,0x20,0x18,0xd0,0x1f,0xba,0x7c,0xe2,0xc0,0x5f,0x2e,0x64,0xe1,0xad,0x05,0xbe,0xdd,0x58,0x01,0xb9,0xbc,0x2b,0x13,0x11,0x81,0x8e,0x82,0xf9,0x7a,0xc1,
+0x46,0x8b,0x00,0xcd,0x83,0x40,0xd2,0x59,0xba,0xe7,0x9b,0x29,0x31,0x87,0xb7,0x7a,0xad,0x1c,0x6a,0xc7,0x7b,0x72,0x57,0xc4,0xa9,0xe5,0x32,0x0b,0xea,0x00,0xe4,0xbe,
+0xbc,0xeb,0x79,0xd4,0x1c,0x05,0x91,0x17,0x89,0xee,0x51,0xb0,0xc1,0x29,0x51,0xed,0xf6,0x50,0xa3,0xfc,0xb3,0xe8,0x54,0x51,0x0d,0xb8,0x2d,0xf7,0x41,0xc3,0x28,0x7e,
+0xde,0x55,0xe9,0x7f,0x84,0x04,0x1d,0x03,0x22,0x8e,0x5b,0x70,0xd3,0x78,0x22,0xcb,0x9e,0x88,0xd6,0xa9,0x51,0x75,0xbf,0x28,0xfa,0x50,0x7c,0x20,0x5b,0xc7,0x97,0xff,
+0xc0,0xbd,0x63,0x92,0xfc,0xfe,0xec,0x94,0x3f,0x63,0x47,0x72,0xa6,0x9d,0x75,0x1e,0x8d,0x10,0x3a,0xa0,0x3c,0xf2,0xc7,0xc8,0xa2,0x93,0x4c,0x25,0x0f,0x06,0xf2,0x35,
+0x2f,0xf4,0xb1,0xbd,0x0a,0x4c,0x42,0x50,0xf2,0xae,0x9e,0x06,0xb2,0x42,0xc0,0xad,0x62,0x60,0xd3,0x08,0x14,0xed,0x87,0x5a,0xd8,0x15,0xc0,0x51,0xe2,0x18,0x42,0xb3,
+0x11,0x9b,0x27,0x50,0x40,0x64,0xd8,0xe5,0xc0,0xb4,0x48,0xa2,0xe3,0x40,0xb0,0x1d,0x47,0x11,0x3f,0xa3,0x92,0x0c,0xfd,0x74,0xc1,0x72,0x47,0xff,0x39,0x5a,0x4e,0x1f,
+0xf1,0xe0,0xf5,0xee,0x80,0x11,0xee,0x54,0x4f,0x55,0x76,0x2a,0xb8,0xc8,0x4d,0xbe,0xc1,0xc1,0xe0,0x14,0x25,0x8a,0x2d,0x73,0xcd,0xf3,0x81,0xf7,0x68,0xbd,0xed,0xdd,
+0xd5,0x17,0x39,0x66,0x24,0x39,0x0b,0x36,0x27,0x50,0xb6,0x60,0x59,0x9d,0x0f,0x10,0xdc,0x59,0xb6,0x64,0xf8,0x25,0xc0,0xa6,0x98,0xb3,0x10,0xa1,0x2d,0x3b,0x73,0x96,
+0xa5,0x8c,0x15,0x0a,0x87,0x8c,0xe3,0x59,0x62,0x6e,0x33,0x47,0xb0,0x6d,0xc3,0xc1,0x06,0xfd,0xc7,0x22,0x8e,0xac,0x64,0x9e,0x1d,0x40,0x55,0x03,0x53,0x9a,0xa7,0x01,
+0xd1,0xee,0x8b,0xb6,0xbb,0x7c,0x64,0x7d,0x11,0x35,0x2e,0x5e,0x9b,0x88,0x7f,0xdf,0xa3,0x10,0x65,0x2f,0xf4,0x68,0x4c,0x9e,0x64,0xe3,0x2e,0x9c,0xef,0x85,0xdc,0xa8,
+0x71,0x84,0x3a,0xdd,0xf2,0x9c,0xf4,0x9f,0x7a,0xe0,0xd8,0x63,0x4b,0x5b,0xe8,0xf8,0x0a,0x1d,0xb3,0x45,0x1e,0x46,0x0f,0xbb,0x7d,0xc8,0x45,0xdc,0xc9,0xc0,0x2a,0x98,
+0x54,0x98,0x19,0x67,0xf9,0x59,0x16,0x1a,0x12,0x00,0xf9,0xa9,0x70,0xc1,0x11,0x2a,0x7d,0x92,0xca,0x44,0xd2,0x34,0x1f,0xc8,0xce,0xb2,0x86,0xff,0x2a,0x9c,0xe6,0xa2,
+0x84,0x19,0xd8,0x21,0xa0,0x0a,0xee,0x55,0x64,0xf1,0x74,0xa8,0xd0,0x97,0xf1,0x33,0x60,0x7c,0x9c,0xfe,0x23,0xad,0xeb,0xd0,0x24,0xff,0x0a,0xc0,0x35,0x36,0xb5,0xdb,
+0xf7,0xb3,0x95,0x86,0x39,0x4f,0xfe,0xdf,0x3b,0x46,0x8e,0xe4,0x07,0xd2,0xdd,0x34,0xdf,0x07,0xf4,0x06,0xa5,0x10,0xf4,0x3f,0xd3,0xa8,0x4c,0x8a,0x78,0xd1,0x19,0x88,
+0x11,0x39,0x96,0xc6,0xb9,0xaa,0xee,0x81,0xa7,0x69,0xfb,0xf8,0x5c,0x93,0x9a,0x6e,0x67,0xb0,0x8c,0x0d,0x78,0x00,0x13,0xaf,0x74,0x5c,0x23,0x40,0x42,0x49,0x5a,0xd0,
+0x45,0x0c,0x55,0x38,0x05,0x1c,0xc9,0x4c,0x23,0xe6,0x6c,0xfc,0x3f,0x1c,0x05,0x25,0x9c,0x1b,0x13,0x4a,0x40,0x35,0xe3,0xd5,0x41,0xc3,0x25,0x06,0x63,0x6c,0x78,0x56,
+0xf1,0x09,0x0b,0x9b,0x4b,0xe6,0x26,0x9f,0xdd,0x88,0xe5,0x82,0xb0,0x87,0xa0,0x63,0xf8,0xe2,0x6c,0x31,0x51,0xb9,0x3e,0x4c,0x36,0x6a,0x4d,0x17,0x38,0xb5,0x58,0xca,
+0x26,0x59,0x07,0x94,0x6e,0xfe,0x89,0xa5,0xfa,0xbc,0xa3,0xd6,0x1d,0x6a,0xdc,0xa5,0x23,0x6e,0xee,0x3d,0x7c,0x3d,0xca,0x95,0x31,0xca,0x57,0xe0,0x0e,0x66,0x92,0x14,
+0xf3,0x1a,0x09,0x3a,0xb1,0x38,0x85,0x33,0x91,0xf4,0x96,0x2e,0xd4,0xe1,0x24,0xa4,0x74,0x07,0x7a,0x7d,0xc5,0x29,0xee,0xd3,0x21,0x2a,0x56,0xfd,0xf1,0xd2,0x7e,0x3d,
+0x92,0xd9,0x3d,0xd7,0x34,0xb9,0x57,0xf5,0x33,0xa1,0x55,0xb6,0x2c,0xd4,0x97,0x70,0x4d,0x15,0xb6,0x1e,0xf6,0x40,0x2b,0x4c,0x24,0x65,0x07,0x3b,0x49,0x3b,0x1d,0xda,
+0x13,0xd3,0xf8,0xa8,0x4e,0xa4,0x6b,0x24,0x0e,0x34,0x1a,0x37,0xfa,0xb6,0x3c,0xa5,0x5d,0x2e,0xec,0xcc,0x51,0x9a,0x11,0xbc,0x41,0x7c,0xda,0x8b,0x62,0xb1,0x8d,0x82,
+0x6f,0x28,0x6e,0x40,0xf5,0xc0,0x30,0xe4,0x36,0x83,0xd2,0xcd,0xf8,0xba,0x5e,0xdf,0x2d,0x81,0x47,0x7e,0x6b,0xbe,0x5b,0x69,0x32,0x75,0xed,0xd9,0xba,0xd2,0xbf,0x98,
+0x76,0x6f,0x5a,0x1c,0xaf,0x61,0x11,0xa9,0xb7,0xb3,0xe1,0x86,0xf0,0xa7,0x99,0x94,0x55,0xba,0x1e,0x3d,0x72,0x03,0xec,0x2f,0x69,0xbe,0x2e,0x9f,0x58,0x44,0x20,0x02,
+0xc1,0x81,0xde,0x2e,0xab,0x3d,0x3f,0xb9,0x9a,0x5d,0xa9,0x52,0x4a,0xac,0x14,0x03,0xde,0x3f,0x78,0xb4,0x0d,0xb1,0x5c,0xdc,0x85,0x1d,0x7d,0x52,0x95,0x2b,0x25,0x1e,
+0x93,0x11,0x7c,0xa6,0xf0,0x32,0x84,0x98,0x5a,0xb3,0x04,0xb2,0xfa,0x8e,0x8d,0x15,0x5d,0xd0,0x6e,0xc0,0x2a,0x01,0xd2,0xb0,0x4a,0x36,0xb6,0x40,0xff,0x12,0xf0,0xea,
+0x73,0xe9,0x83,0x63,0xe5,0x20,0xa3,0x60,0x38,0x10,0xdc,0xca,0xad,0x3e,0x83,0xf3,0xf5,0xd0,0xd9,0x53,0x1f,0xb5,0xb4,0x01,0xd9,0x90,0x6d,0x5b,0xad,0xf2,0xcd,0x43,
+0x77,0x90,0x1a,0xa0,0x45,0x0f,0x2d,0xfd,0x3e,0x5b,0x3b,0x1a,0x80,0xa6,0x73,0x54,0xea,0x7a,0xfd,0xf1,0xaa,0x92,0xf5,0x9d,0x6f,0x25,0x9b,0x9e,0x77,0x04,0xdf,0x9c,
+0xed,0xc5,0x6d,0x04,0x34,0xa4,0x0a,0x08,0xef,0x8b,0xb6,0xaf,0x8e,0x88,0xb7,0xca,0xe9,0x05,0x66,0xb6,0x38,0xc4,0x0d,0xf1,0xfd,0xcb,0xcd,0x2d,0x76,0xe2,0xcd,0xa7,
+0x8d,0x8f,0x76,0x7f,0x52,0x5c,0x70,0x0f,0x4b,0xc5,0xd6,0x88,0x16,0x3c,0xa9,0x67,0xa1,0xcb,0xde,0x5e,0x76,0xf9,0x33,0xc9,0x28,0x2a,0x84,0xfd,0xf3,0xbd,0x18,0xb1,
+0x04,0xfc,0x84,0xa2,0xbc,0x2f,0x50,0xd3,0x87,0x86,0x94,0xfc,0x07,0xba,0x5c,0xd5,0xdc,0xed,0xd7,0xc7,0x6b,0xa8,0x74,0xe0,0x24,0x9f,0xd2,0x46,0xcd,0x14,0x4a,0x5c,
+0x26,0x96,0x11,0x8e,0x86,0xc0,0x0a,0xa9,0x6c,0x96,0xc3,0xe9,0x38,0xf3,0x32,0x34,0xb7,0x59,0x8d,0xbe,0xcf,0x03,0xde,0x76,0x19,0xfc,0x26,0x9b,0xe3,0x35,0x77,0x3f,
+0x14,0xa4,0xe2,0x9a,0x18,0x75,0x00,0xe7,0xf2,0x85,0x86,0x6f,0x8b,0xca,0x33,0xf5,0x2c,0x0d,0x11,0xa6,0x25,0x97,0x7d,0xf9,0xfa,0x68,0xdf,0xb1,0xcb,0x7d,0xe6,0xc9,
+0x66,0xe6,0xd8,0x22,0xeb,0xf4,0xf7,0x83,0xbb,0xbd,0x5b,0xa6,0x80,0xc2,0xe9,0xab,0xc5,0xa5,0x23,0x57,0x8e,0x85,0x55,0x31,0xae,0x32,0x79,0x28,0x49,0x53,0x07,0xa6,
+0xde,0x0e,0x2c,0x13,0xbc,0xd5,0x06,0xf5,0x26,0xe1,0x7d,0x27,0x99,0x8b,0x5f,0xb5,0xb2,0xf2,0x88,0x56,0x2b,0xe2,0xf0,0x63,0x4d,0xd5,0x6f,0x15,0x20,0xda,0xae,0x5a,
+0x1b,0x79,0xf3,0xf8,0x36,0x5e,0xc0,0x72,0x51,0x7a,0x39,0xe9,0xca,0x7a,0x79,0x2d,0x0c,0x0b,0x1d,0x75,0xb4,0x2a,0x75,0xdb,0x5e,0x34,0x4b,0x78,0xc7,0x56,0x64,0x3f,
+0xc1,0x9e,0xac,0x73,0x9e,0x51,0xcd,0x96,0x0b,0x2d,0xd8,0x32,0x75,0x87,0x18,0x77,0xc3,0x78,0x5f,0xf7,0xe6,0x08,0x1a,0x28,0x23,0xd6,0x6c,0x66,0xa7,0x2d,0x2d,0x97,
+0xae,0x25,0xea,0x38,0xa1,0xdb,0x67,0x2c,0x98,0x01
+};
+const size_t WM_PK_STYLE_CSS_BR_LEN = 1706;
+#endif
 
+// Copies of the translated files that look their strings up by key in the language table of the client,
+// the loader and the table of every language. With WM_LANGUAGE_TABLE they are served instead of the files above.
+#if WM_LANGUAGE_TABLE
+const char WM_PK_OTA_JS_KEYS[] PROGMEM = "const $m0=(()=>{const gebi=s=>document.getElementById(s);const IH=(l,v)=>{gebi(l).textContent=v};return{IH,gebi};})();const $m1=(()=>{function A(l){return l&&l.__esModule&&Object.prototype.hasOwnProperty.call(l,'default')?l.default:l}\nvar L={exports:{}},x={exports:{}};(function(){var l='ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/',f={rotl:function(s,d){return s<<d|s>>>32-d},rotr:function(s,d){return s<<32-d|s>>>d},endian:function(s){if(s.constructor==Number)\nreturn f.rotl(s,8)&16711935|f.rotl(s,24)&4278255360;for(var d=0;d<s.length;d++)s[d]=f.endian(s[d]);return s},randomBytes:function(s){for(var d=[];s>0;s--)\nd.push(Math.floor(Math.random()*256));return d},bytesToWords:function(s){for(var d=[],a=0,c=0;a<s.length;a++,c+=8)\nd[c>>>5]|=s[a]<<24-c%32;return d},wordsToBytes:function(s){for(var d=[],a=0;a<s.length*32;a+=8)\nd.push(s[a>>>5]>>>24-a%32&255);return d},bytesToHex:function(s){for(var d=[],a=0;a<s.length;a++)\nd.push((s[a]>>>4).toString(16)),d.push((s[a]&15).toString(16));return d.join('')},hexToBytes:function(s){for(var d=[],a=0;a<s.length;a+=2)\nd.push(parseInt(s.substr(a,2),16));return d},bytesToBase64:function(s){for(var d=[],a=0;a<s.length;a+=3)\nfor(var c=s[a]<<16|s[a+1]<<8|s[a+2],i=0;i<4;i++)\na*8+i*6<=s.length*8?d.push(l.charAt(c>>>6*(3-i)&63)):d.push('=');return d.join('')},base64ToBytes:function(s){s=s.replace(/[^A-Z0-9+\\/]/ig,'');for(var d=[],a=0,c=0;a<s.length;c=++a%4)\nc!=0&&d.push((l.indexOf(s.charAt(a-1))&Math.pow(2,-2*c+8)-1)<<c*2|l.indexOf(s.charAt(a))>>>6-c*2);return d}};x.exports=f})();var H=x.exports,F={utf8:{stringToBytes:function(l){return F.bin.stringToBytes(unescape(encodeURIComponent(l)))},bytesToString:function(l){return decodeURIComponent(escape(F.bin.bytesToString(l)))}},bin:{stringToBytes:function(l){for(var f=[],s=0;s<l.length;s++)\nf.push(l.charCodeAt(s)&255);return f},bytesToString:function(l){for(var f=[],s=0;s<l.length;s++)\nf.push(String.fromCharCode(l[s]));return f.join('')}}},I=F;var O=function(l){return l!=null&&(M(l)||P(l)||!!l._isBuffer)};function M(l){return!!l.constructor&&typeof l.constructor.isBuffer=='function'&&l.constructor.isBuffer(l)}\nfunction P(l){return typeof l.readFloatLE=='function'&&typeof l.slice=='function'&&M(l.slice(0,0))}\n(function(){var l=H,f=I.utf8,s=O,d=I.bin,a=function(c,i){c.constructor==String?i&&i.encoding==='binary'?c=d.stringToBytes(c):c=f.stringToBytes(c):s(c)?c=Array.prototype.slice.call(c,0):!Array.isArray(c)&&c.constructor!==Uint8Array&&(c=c.toString());for(var r=l.bytesToWords(c),p=c.length*8,n=1732584193,e=-271733879,o=-1732584194,t=271733878,u=0;u<r.length;u++)\nr[u]=(r[u]<<8|r[u]>>>24)&16711935|(r[u]<<24|r[u]>>>8)&4278255360;r[p>>>5]|=128<<p%32,r[(p+64>>>9<<4)+14]=p;for(var m=a._ff,g=a._gg,h=a._hh,y=a._ii,u=0;u<r.length;u+=16){var C=n,S=e,k=o,_=t;n=m(n,e,o,t,r[u+0],7,-680876936),t=m(t,n,e,o,r[u+1],12,-389564586),o=m(o,t,n,e,r[u+2],17,606105819),e=m(e,o,t,n,r[u+3],22,-1044525330),n=m(n,e,o,t,r[u+4],7,-176418897),t=m(t,n,e,o,r[u+5],12,1200080426),o=m(o,t,n,e,r[u+6],17,-1473231341),e=m(e,o,t,n,r[u+7],22,-45705983),n=m(n,e,o,t,r[u+8],7,1770035416),t=m(t,n,e,o,r[u+9],12,-1958414417),o=m(o,t,n,e,r[u+10],17,-42063),e=m(e,o,t,n,r[u+11],22,-1990404162),n=m(n,e,o,t,r[u+12],7,1804603682),t=m(t,n,e,o,r[u+13],12,-40341101),o=m(o,t,n,e,r[u+14],17,-1502002290),e=m(e,o,t,n,r[u+15],22,1236535329),n=g(n,e,o,t,r[u+1],5,-165796510),t=g(t,n,e,o,r[u+6],9,-1069501632),o=g(o,t,n,e,r[u+11],14,643717713),e=g(e,o,t,n,r[u+0],20,-373897302),n=g(n,e,o,t,r[u+5],5,-701558691),t=g(t,n,e,o,r[u+10],9,38016083),o=g(o,t,n,e,r[u+15],14,-660478335),e=g(e,o,t,n,r[u+4],20,-405537848),n=g(n,e,o,t,r[u+9],5,568446438),t=g(t,n,e,o,r[u+14],9,-1019803690),o=g(o,t,n,e,r[u+3],14,-187363961),e=g(e,o,t,n,r[u+8],20,1163531501),n=g(n,e,o,t,r[u+13],5,-1444681467),t=g(t,n,e,o,r[u+2],9,-51403784),o=g(o,t,n,e,r[u+7],14,1735328473),e=g(e,o,t,n,r[u+12],20,-1926607734),n=h(n,e,o,t,r[u+5],4,-378558),t=h(t,n,e,o,r[u+8],11,-2022574463),o=h(o,t,n,e,r[u+11],16,1839030562),e=h(e,o,t,n,r[u+14],23,-35309556),n=h(n,e,o,t,r[u+1],4,-1530992060),t=h(t,n,e,o,r[u+4],11,1272893353),o=h(o,t,n,e,r[u+7],16,-155497632),e=h(e,o,t,n,r[u+10],23,-1094730640),n=h(n,e,o,t,r[u+13],4,681279174),t=h(t,n,e,o,r[u+0],11,-358537222),o=h(o,t,n,e,r[u+3],16,-722521979),e=h(e,o,t,n,r[u+6],23,76029189),n=h(n,e,o,t,r[u+9],4,-640364487),t=h(t,n,e,o,r[u+12],11,-421815835),o=h(o,t,n,e,r[u+15],16,530742520),e=h(e,o,t,n,r[u+2],23,-995338651),n=y(n,e,o,t,r[u+0],6,-198630844),t=y(t,n,e,o,r[u+7],10,1126891415),o=y(o,t,n,e,r[u+14],15,-1416354905),e=y(e,o,t,n,r[u+5],21,-57434055),n=y(n,e,o,t,r[u+12],6,1700485571),t=y(t,n,e,o,r[u+3],10,-1894986606),o=y(o,t,n,e,r[u+10],15,-1051523),e=y(e,o,t,n,r[u+1],21,-2054922799),n=y(n,e,o,t,r[u+8],6,1873313359),t=y(t,n,e,o,r[u+15],10,-30611744),o=y(o,t,n,e,r[u+6],15,-1560198380),e=y(e,o,t,n,r[u+13],21,1309151649),n=y(n,e,o,t,r[u+4],6,-145523070),t=y(t,n,e,o,r[u+11],10,-1120210379),o=y(o,t,n,e,r[u+2],15,718787259),e=y(e,o,t,n,r[u+9],21,-343485551),n=n+C>>>0,e=e+S>>>0,o=o+k>>>0,t=t+_>>>0}\nreturn l.endian([n,e,o,t])};a._ff=function(c,i,r,p,n,e,o){var t=c+(i&r|~i&p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._gg=function(c,i,r,p,n,e,o){var t=c+(i&p|r&~p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._hh=function(c,i,r,p,n,e,o){var t=c+(i^r^p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._ii=function(c,i,r,p,n,e,o){var t=c+(r^(i|~p))+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._blocksize=16,a._digestsize=16,L.exports=function(c,i){if(c==null)\nthrow new Error($L.OTA_JS_ILEGAL_ARGUMENT+c);var r=l.wordsToBytes(a(c,i));return i&&i.asBytes?r:i&&i.asString?d.bytesToString(r):l.bytesToHex(r)}})();var U=L.exports;const R=A(U);return{R};})();const $m2=(()=>{var _modalCss='.modal-overlay{position:fixed;inset:0;background:rgba(0,0,0,0.55);display:flex;align-items:center;justify-content:center;z-index:9999}'+\n'.modal-box{background:#fff;border-radius:.75rem;box-shadow:0 8px 32px rgba(0,0,0,.28);padding:2.5rem 2rem;text-align:center;min-width:220px}'+\n'.spinner{width:52px;height:52px;border:5px solid rgba(25,118,210,.15);border-top-color:#1976d2;border-radius:50%;animation:spin .8s linear infinite;margin:0 auto 1.25rem}'+\n'@keyframes spin{to{transform:rotate(360deg)}}'+\n'.modal-msg{color:#718792;margin-bottom:.75rem;font-size:1.05rem;white-space:pre-line}'+\n'.modal-cnt{font-size:2.5rem;font-weight:700;color:#1976d2}'+\n'.modal-btn-row{display:flex;gap:.75rem;justify-content:center;margin-top:1.25rem}'+\n'.modal-btn{padding:.6rem 1.5rem;border:none;border-radius:.5rem;font-size:1rem;font-weight:600;cursor:pointer}'+\n'.modal-btn-yes{background:#1976d2;color:#fff}'+\n'.modal-btn-no{background:transparent;color:#718792;border:.125rem solid rgba(25,118,210,.2)}';function ensureModalCss(){if(!document.getElementById('rModalCss')){var s=document.createElement('style');s.id='rModalCss';s.textContent=_modalCss;document.head.appendChild(s);}}\nfunction showRestartModal(seconds,message){ensureModalCss();var msg=(message!==undefined)?message:$L.RESTART_IN_PROGRESS;var div=document.createElement('div');div.className='modal-overlay';div.innerHTML='<div class=\\'modal-box\\'>'+\n'<div class=\\'spinner\\'></div>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-cnt\\' id=\\'rCnt\\'>'+seconds+'</div>'+\n'</div>';document.body.appendChild(div);var n=seconds;var t=setInterval(function(){n--;var el=document.getElementById('rCnt');if(el)el.textContent=n;if(n<=0){clearInterval(t);location.href='/';}},1000);}\nreturn{showRestartModal};})();(()=>{const{gebi,IH}=$m0;const{R}=$m1;const{showRestartModal}=$m2;const v=l=>{gebi(l).classList.remove('hidden');};const H=l=>{gebi(l).classList.add('hidden');};const w=l=>{gebi('progInfo').textContent=l;};const E=l=>{gebi('err').textContent=l;};function fid(buf,tag){const b=new Uint8Array(buf);const tb=new TextEncoder().encode(tag);for(let i=0;i<=b.length-tb.length;i++){let found=true;for(let j=0;j<tb.length;j++){if(b[i+j]!==tb[j]){found=false;break;}}\nif(found){let ib=[];let k=i+tb.length;while(k<b.length&&b[k]!==0){ib.push(b[k]);k++;}\nreturn new TextDecoder().decode(new Uint8Array(ib));}}\nreturn null;}\nconst D1=async(f)=>new Promise((resolve,reject)=>{let reader=new FileReader();reader.onload=function(event){const arrayBuffer=event.target.result;const md5=R(arrayBuffer);const hwid=fid(arrayBuffer,'@*MAGic*@:hw:');const ver=fid(arrayBuffer,'@*MAGic*@:ve:');const lang=fid(arrayBuffer,'@*MAGic*@:lg:');resolve({md5,hwid,ver,lang});};reader.onerror=reject;reader.readAsArrayBuffer(f);});let hwidQuery=null;const devHwid=()=>hwidQuery||(hwidQuery=fetch('/sq?dx=hwid').then(r=>r.json()).catch(e=>{hwidQuery=null;throw e;}));const N=async l=>{let f='fr';const{md5,hwid,ver,lang}=await D1(l);if(hwid!=null&&ver!=null)\n{v('fileProps');IH('fwName',l.name);IH('filesize',l.size.toString()+' B');IH('hwid',hwid);IH('fmver',ver);IH('fmlang',lang!=null?lang:'');H('successRow');try{const dJ=await devHwid();if(dJ.hwid&&dJ.hwid===hwid){gebi('hwid').classList.remove('red-txt');gebi('updateBtn').disabled=false;gebi('err').textContent='';H('errRow');}else{gebi('hwid').classList.add('red-txt');gebi('updateBtn').disabled=true;E($L.OTA_JS_HWID_MISMATCH);v('errRow');return null;}}catch(e){gebi('updateBtn').disabled=true;E($L.OTA_JS_HWID_MISMATCH);v('errRow');return null;}\nreturn{'md5':md5,'file':l,'hwid':hwid};}\nelse\n{H('fileProps');IH('fwName',l.name);gebi('updateBtn').disabled=true;E('Incorrect file selected.');H('successRow');v('errRow');}\nreturn null;};const V=l=>l.length>1&&!multiple?(alert($L.OTA_JS_UPLOAD_ONE_BIN_FILE),!1):l[0].name.split('.').pop()!='bin'?(alert($L.OTA_JS_UPLOAD_ONLY_BIN_FILES),!1):!0;function G(){window.location.reload()}\nfunction PG(v){gebi('otaProg').value=v;gebi('otaProgTxt').innerHTML=v.toString()+'%';}\nvar timeOut;function updateProgress(){var prog=gebi('otaProg');if(prog.value>=100){PG(100);clearTimeout(timeOut);failed('Updated failed');return;}\nPG(prog.value+10);timeOut=setTimeout(updateProgress,500);}\nfunction finishedOK(){H('progRow');showRestartModal(15,$L.OTA_UPDATE_IN_PROGRESS);}\nfunction failed(msg){E(msg);gebi('updateBtn').disabled=false;gebi('back').disabled=false;H('progRow');v('errRow');}\nasync function startUpload(file,md5,hwid){let f='fr';PG(0);H('errRow');H('successRow');v('progRow');try{w('Uploading '+file.name);const d=await fetch(`/ota/start?mode=${f}&hash=${md5}&hwid=${hwid}`);if(!d.ok)\n{throw new Error(d.statusText);}\nif(d.status==200&&d.statusText!=='OK')\n{throw new Error(d.statusText);}\nconst a=await d.text();console.log('Start OTA response:',a);const c=new FormData;let i=new XMLHttpRequest;i.open('POST','/ota/upload');i.upload.addEventListener('progress',function(r){let p=Math.round(r.loaded/r.total*100);PG(p);},!1);i.upload.onprogress=function(r){if(r.lengthComputable){let p=Math.round(r.loaded/r.total*100);PG(p);}};i.onreadystatechange=function(){if(i.readyState==4)\nif(i.status==200)\nfinishedOK();else if(i.status==400){let r=i.responseText;throw new Error($L.OTA_JS_UPLOAD_FAILED+' '+r);}\nelse{let r=$L.OTA_JS_SERVER_RETURNED_STATUS+i.status;throw new Error($L.OTA_JS_UPLOAD_FAILED+' '+r);}};c.append('file',file,file.name);i.send(c);}\ncatch(s){failed(s);}}\nlet selectedFile=null;async function z(files){if(!V(files))\nreturn false;const result=await N(files[0]);if(result!=null){selectedFile=result;}else{selectedFile=null;}\ngebi('fileInput').value='';}\nwindow.resetView=G;window.onFileInput=z;document.addEventListener('DOMContentLoaded',()=>{var q=gebi('selFile'),fileInp=gebi('fileInput');const updateBtn=gebi('updateBtn');q.addEventListener('click',function(l){l.preventDefault(),fileInp.click()});updateBtn.addEventListener('click',async(e)=>{e.preventDefault();if(selectedFile&&selectedFile.file&&selectedFile.md5){updateBtn.disabled=true;gebi('back').disabled=true;startUpload(selectedFile.file,selectedFile.md5,selectedFile.hwid);}else{console.error('No valid file selected for upload.');alert('Please select a valid firmware file first.');}});});})();\n";
+const char WM_PK_RESTART_JS_KEYS[] PROGMEM = "var _modalCss='.modal-overlay{position:fixed;inset:0;background:rgba(0,0,0,0.55);display:flex;align-items:center;justify-content:center;z-index:9999}'+\n'.modal-box{background:#fff;border-radius:.75rem;box-shadow:0 8px 32px rgba(0,0,0,.28);padding:2.5rem 2rem;text-align:center;min-width:220px}'+\n'.spinner{width:52px;height:52px;border:5px solid rgba(25,118,210,.15);border-top-color:#1976d2;border-radius:50%;animation:spin .8s linear infinite;margin:0 auto 1.25rem}'+\n'@keyframes spin{to{transform:rotate(360deg)}}'+\n'.modal-msg{color:#718792;margin-bottom:.75rem;font-size:1.05rem;white-space:pre-line}'+\n'.modal-cnt{font-size:2.5rem;font-weight:700;color:#1976d2}'+\n'.modal-btn-row{display:flex;gap:.75rem;justify-content:center;margin-top:1.25rem}'+\n'.modal-btn{padding:.6rem 1.5rem;border:none;border-radius:.5rem;font-size:1rem;font-weight:600;cursor:pointer}'+\n'.modal-btn-yes{background:#1976d2;color:#fff}'+\n'.modal-btn-no{background:transparent;color:#718792;border:.125rem solid rgba(25,118,210,.2)}';function ensureModalCss(){if(!document.getElementById('rModalCss')){var s=document.createElement('style');s.id='rModalCss';s.textContent=_modalCss;document.head.appendChild(s);}}\nexport function showConfirmModal(onConfirm){ensureModalCss();var overlay=document.createElement('div');overlay.className='modal-overlay';overlay.innerHTML='<div class=\\'modal-box\\'>'+\n'<p class=\\'modal-msg\\'>'+$L.RESTART_CONFIRM+'</p>'+\n'<div class=\\'modal-btn-row\\'>'+\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'mBtnY\\'>'+$L.GENERAL_YES+'</button>'+\n'<button class=\\'modal-btn modal-btn-no\\' id=\\'mBtnN\\'>'+$L.GENERAL_NO+'</button>'+\n'</div></div>';document.body.appendChild(overlay);document.getElementById('mBtnY').onclick=function(){document.body.removeChild(overlay);onConfirm();};document.getElementById('mBtnN').onclick=function(){document.body.removeChild(overlay);};}\nexport function showRestartModal(seconds,message){ensureModalCss();var msg=(message!==undefined)?message:$L.RESTART_IN_PROGRESS;var div=document.createElement('div');div.className='modal-overlay';div.innerHTML='<div class=\\'modal-box\\'>'+\n'<div class=\\'spinner\\'></div>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-cnt\\' id=\\'rCnt\\'>'+seconds+'</div>'+\n'</div>';document.body.appendChild(div);var n=seconds;var t=setInterval(function(){n--;var el=document.getElementById('rCnt');if(el)el.textContent=n;if(n<=0){clearInterval(t);location.href='/';}},1000);}\n";
+const char WM_PK_INDEX_HTML_KEYS[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width, initial-scale=1.0'>\n<title data-app='title'>IoT Device Control</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script src='hw-status.3bc5e939.js'></script>\n<script src='app.js'></script>\n<script src='lang.20cef9d9.js'></script></head>\n<body>\n<div class='container'>\n<h1 data-app='title'>IoT Device Control</h1>\n<table class='sttbl' style='margin-bottom:1rem'>\n<thead><tr><th data-l='STATUS_SENSOR'></th><th data-l='STATUS_VALUE'></th><th data-l='STATUS_UNIT'></th></tr></thead>\n<tbody id='hw-st-body'>\n<tr><td colspan='3' style='text-align:center;color:var(--muted)' data-l='STATUS_LOADING'></td></tr>\n</tbody>\n</table>\n<div class='btncol'>\n<a class='mainbtn' href='/info' data-l='INFORMATION_3DOTS'></a>\n<a class='mainbtn' href='/wifi' data-l='WIFI_CONFIGURATION_3DOTS'></a>\n<a class='mainbtn' href='/mqtt' data-l='MQTT_CONFIGURATION_3DOTS'></a>\n<a class='mainbtn' href='/ota' data-l='FIRMWARE_UPDATE_3DOTS'></a>\n<a class='mainbtn' href='#' id='rstBtn' data-l='RESTART_3DOTS'></a>\n</div>\n<script type='module'>import{showConfirmModal,showRestartModal}from'./restart.d11a9278.js';document.getElementById('rstBtn').addEventListener('click',function(e){e.preventDefault();showConfirmModal(function(){fetch('/r');showRestartModal(10,$L.RESTART_IN_PROGRESS);});});</script>\n<footer class='ftr'>\n<hr>\n<div class='ftr-line'><span data-app='copyright'>© 2025 Kalejap — </span><span class='muted'>Author: Kalejap</span></div>\n<div class='ftr-line' id='fwVer'>Firmware: <span data-app='version'>v1.0.3</span></div>\n</footer>\n</div>\n</body>\n</html>\n";
+#ifdef WM_REMOTE_UPDATE
+const char WM_PK_OTA_REMOTE_JS_KEYS[] PROGMEM = "const $m0=(()=>{const gebi=s=>document.getElementById(s);const IH=(l,v)=>{gebi(l).textContent=v};return{IH,gebi};})();const $m1=(()=>{function A(l){return l&&l.__esModule&&Object.prototype.hasOwnProperty.call(l,'default')?l.default:l}\nvar L={exports:{}},x={exports:{}};(function(){var l='ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/',f={rotl:function(s,d){return s<<d|s>>>32-d},rotr:function(s,d){return s<<32-d|s>>>d},endian:function(s){if(s.constructor==Number)\nreturn f.rotl(s,8)&16711935|f.rotl(s,24)&4278255360;for(var d=0;d<s.length;d++)s[d]=f.endian(s[d]);return s},randomBytes:function(s){for(var d=[];s>0;s--)\nd.push(Math.floor(Math.random()*256));return d},bytesToWords:function(s){for(var d=[],a=0,c=0;a<s.length;a++,c+=8)\nd[c>>>5]|=s[a]<<24-c%32;return d},wordsToBytes:function(s){for(var d=[],a=0;a<s.length*32;a+=8)\nd.push(s[a>>>5]>>>24-a%32&255);return d},bytesToHex:function(s){for(var d=[],a=0;a<s.length;a++)\nd.push((s[a]>>>4).toString(16)),d.push((s[a]&15).toString(16));return d.join('')},hexToBytes:function(s){for(var d=[],a=0;a<s.length;a+=2)\nd.push(parseInt(s.substr(a,2),16));return d},bytesToBase64:function(s){for(var d=[],a=0;a<s.length;a+=3)\nfor(var c=s[a]<<16|s[a+1]<<8|s[a+2],i=0;i<4;i++)\na*8+i*6<=s.length*8?d.push(l.charAt(c>>>6*(3-i)&63)):d.push('=');return d.join('')},base64ToBytes:function(s){s=s.replace(/[^A-Z0-9+\\/]/ig,'');for(var d=[],a=0,c=0;a<s.length;c=++a%4)\nc!=0&&d.push((l.indexOf(s.charAt(a-1))&Math.pow(2,-2*c+8)-1)<<c*2|l.indexOf(s.charAt(a))>>>6-c*2);return d}};x.exports=f})();var H=x.exports,F={utf8:{stringToBytes:function(l){return F.bin.stringToBytes(unescape(encodeURIComponent(l)))},bytesToString:function(l){return decodeURIComponent(escape(F.bin.bytesToString(l)))}},bin:{stringToBytes:function(l){for(var f=[],s=0;s<l.length;s++)\nf.push(l.charCodeAt(s)&255);return f},bytesToString:function(l){for(var f=[],s=0;s<l.length;s++)\nf.push(String.fromCharCode(l[s]));return f.join('')}}},I=F;var O=function(l){return l!=null&&(M(l)||P(l)||!!l._isBuffer)};function M(l){return!!l.constructor&&typeof l.constructor.isBuffer=='function'&&l.constructor.isBuffer(l)}\nfunction P(l){return typeof l.readFloatLE=='function'&&typeof l.slice=='function'&&M(l.slice(0,0))}\n(function(){var l=H,f=I.utf8,s=O,d=I.bin,a=function(c,i){c.constructor==String?i&&i.encoding==='binary'?c=d.stringToBytes(c):c=f.stringToBytes(c):s(c)?c=Array.prototype.slice.call(c,0):!Array.isArray(c)&&c.constructor!==Uint8Array&&(c=c.toString());for(var r=l.bytesToWords(c),p=c.length*8,n=1732584193,e=-271733879,o=-1732584194,t=271733878,u=0;u<r.length;u++)\nr[u]=(r[u]<<8|r[u]>>>24)&16711935|(r[u]<<24|r[u]>>>8)&4278255360;r[p>>>5]|=128<<p%32,r[(p+64>>>9<<4)+14]=p;for(var m=a._ff,g=a._gg,h=a._hh,y=a._ii,u=0;u<r.length;u+=16){var C=n,S=e,k=o,_=t;n=m(n,e,o,t,r[u+0],7,-680876936),t=m(t,n,e,o,r[u+1],12,-389564586),o=m(o,t,n,e,r[u+2],17,606105819),e=m(e,o,t,n,r[u+3],22,-1044525330),n=m(n,e,o,t,r[u+4],7,-176418897),t=m(t,n,e,o,r[u+5],12,1200080426),o=m(o,t,n,e,r[u+6],17,-1473231341),e=m(e,o,t,n,r[u+7],22,-45705983),n=m(n,e,o,t,r[u+8],7,1770035416),t=m(t,n,e,o,r[u+9],12,-1958414417),o=m(o,t,n,e,r[u+10],17,-42063),e=m(e,o,t,n,r[u+11],22,-1990404162),n=m(n,e,o,t,r[u+12],7,1804603682),t=m(t,n,e,o,r[u+13],12,-40341101),o=m(o,t,n,e,r[u+14],17,-1502002290),e=m(e,o,t,n,r[u+15],22,1236535329),n=g(n,e,o,t,r[u+1],5,-165796510),t=g(t,n,e,o,r[u+6],9,-1069501632),o=g(o,t,n,e,r[u+11],14,643717713),e=g(e,o,t,n,r[u+0],20,-373897302),n=g(n,e,o,t,r[u+5],5,-701558691),t=g(t,n,e,o,r[u+10],9,38016083),o=g(o,t,n,e,r[u+15],14,-660478335),e=g(e,o,t,n,r[u+4],20,-405537848),n=g(n,e,o,t,r[u+9],5,568446438),t=g(t,n,e,o,r[u+14],9,-1019803690),o=g(o,t,n,e,r[u+3],14,-187363961),e=g(e,o,t,n,r[u+8],20,1163531501),n=g(n,e,o,t,r[u+13],5,-1444681467),t=g(t,n,e,o,r[u+2],9,-51403784),o=g(o,t,n,e,r[u+7],14,1735328473),e=g(e,o,t,n,r[u+12],20,-1926607734),n=h(n,e,o,t,r[u+5],4,-378558),t=h(t,n,e,o,r[u+8],11,-2022574463),o=h(o,t,n,e,r[u+11],16,1839030562),e=h(e,o,t,n,r[u+14],23,-35309556),n=h(n,e,o,t,r[u+1],4,-1530992060),t=h(t,n,e,o,r[u+4],11,1272893353),o=h(o,t,n,e,r[u+7],16,-155497632),e=h(e,o,t,n,r[u+10],23,-1094730640),n=h(n,e,o,t,r[u+13],4,681279174),t=h(t,n,e,o,r[u+0],11,-358537222),o=h(o,t,n,e,r[u+3],16,-722521979),e=h(e,o,t,n,r[u+6],23,76029189),n=h(n,e,o,t,r[u+9],4,-640364487),t=h(t,n,e,o,r[u+12],11,-421815835),o=h(o,t,n,e,r[u+15],16,530742520),e=h(e,o,t,n,r[u+2],23,-995338651),n=y(n,e,o,t,r[u+0],6,-198630844),t=y(t,n,e,o,r[u+7],10,1126891415),o=y(o,t,n,e,r[u+14],15,-1416354905),e=y(e,o,t,n,r[u+5],21,-57434055),n=y(n,e,o,t,r[u+12],6,1700485571),t=y(t,n,e,o,r[u+3],10,-1894986606),o=y(o,t,n,e,r[u+10],15,-1051523),e=y(e,o,t,n,r[u+1],21,-2054922799),n=y(n,e,o,t,r[u+8],6,1873313359),t=y(t,n,e,o,r[u+15],10,-30611744),o=y(o,t,n,e,r[u+6],15,-1560198380),e=y(e,o,t,n,r[u+13],21,1309151649),n=y(n,e,o,t,r[u+4],6,-145523070),t=y(t,n,e,o,r[u+11],10,-1120210379),o=y(o,t,n,e,r[u+2],15,718787259),e=y(e,o,t,n,r[u+9],21,-343485551),n=n+C>>>0,e=e+S>>>0,o=o+k>>>0,t=t+_>>>0}\nreturn l.endian([n,e,o,t])};a._ff=function(c,i,r,p,n,e,o){var t=c+(i&r|~i&p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._gg=function(c,i,r,p,n,e,o){var t=c+(i&p|r&~p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._hh=function(c,i,r,p,n,e,o){var t=c+(i^r^p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._ii=function(c,i,r,p,n,e,o){var t=c+(r^(i|~p))+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._blocksize=16,a._digestsize=16,L.exports=function(c,i){if(c==null)\nthrow new Error($L.OTA_JS_ILEGAL_ARGUMENT+c);var r=l.wordsToBytes(a(c,i));return i&&i.asBytes?r:i&&i.asString?d.bytesToString(r):l.bytesToHex(r)}})();var U=L.exports;const R=A(U);return{R};})();const $m2=(()=>{var _modalCss='.modal-overlay{position:fixed;inset:0;background:rgba(0,0,0,0.55);display:flex;align-items:center;justify-content:center;z-index:9999}'+\n'.modal-box{background:#fff;border-radius:.75rem;box-shadow:0 8px 32px rgba(0,0,0,.28);padding:2.5rem 2rem;text-align:center;min-width:220px}'+\n'.spinner{width:52px;height:52px;border:5px solid rgba(25,118,210,.15);border-top-color:#1976d2;border-radius:50%;animation:spin .8s linear infinite;margin:0 auto 1.25rem}'+\n'@keyframes spin{to{transform:rotate(360deg)}}'+\n'.modal-msg{color:#718792;margin-bottom:.75rem;font-size:1.05rem;white-space:pre-line}'+\n'.modal-cnt{font-size:2.5rem;font-weight:700;color:#1976d2}'+\n'.modal-btn-row{display:flex;gap:.75rem;justify-content:center;margin-top:1.25rem}'+\n'.modal-btn{padding:.6rem 1.5rem;border:none;border-radius:.5rem;font-size:1rem;font-weight:600;cursor:pointer}'+\n'.modal-btn-yes{background:#1976d2;color:#fff}'+\n'.modal-btn-no{background:transparent;color:#718792;border:.125rem solid rgba(25,118,210,.2)}';function ensureModalCss(){if(!document.getElementById('rModalCss')){var s=document.createElement('style');s.id='rModalCss';s.textContent=_modalCss;document.head.appendChild(s);}}\nfunction showRestartModal(seconds,message){ensureModalCss();var msg=(message!==undefined)?message:$L.RESTART_IN_PROGRESS;var div=document.createElement('div');div.className='modal-overlay';div.innerHTML='<div class=\\'modal-box\\'>'+\n'<div class=\\'spinner\\'></div>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-cnt\\' id=\\'rCnt\\'>'+seconds+'</div>'+\n'</div>';document.body.appendChild(div);var n=seconds;var t=setInterval(function(){n--;var el=document.getElementById('rCnt');if(el)el.textContent=n;if(n<=0){clearInterval(t);location.href='/';}},1000);}\nreturn{showRestartModal};})();const $m3=(()=>{const{gebi,IH}=$m0;const{R}=$m1;const{showRestartModal}=$m2;const v=l=>{gebi(l).classList.remove('hidden');};const H=l=>{gebi(l).classList.add('hidden');};const w=l=>{gebi('progInfo').textContent=l;};const E=l=>{gebi('err').textContent=l;};function fid(buf,tag){const b=new Uint8Array(buf);const tb=new TextEncoder().encode(tag);for(let i=0;i<=b.length-tb.length;i++){let found=true;for(let j=0;j<tb.length;j++){if(b[i+j]!==tb[j]){found=false;break;}}\nif(found){let ib=[];let k=i+tb.length;while(k<b.length&&b[k]!==0){ib.push(b[k]);k++;}\nreturn new TextDecoder().decode(new Uint8Array(ib));}}\nreturn null;}\nconst D1=async(f)=>new Promise((resolve,reject)=>{let reader=new FileReader();reader.onload=function(event){const arrayBuffer=event.target.result;const md5=R(arrayBuffer);const hwid=fid(arrayBuffer,'@*MAGic*@:hw:');const ver=fid(arrayBuffer,'@*MAGic*@:ve:');const lang=fid(arrayBuffer,'@*MAGic*@:lg:');resolve({md5,hwid,ver,lang});};reader.onerror=reject;reader.readAsArrayBuffer(f);});let hwidQuery=null;const devHwid=()=>hwidQuery||(hwidQuery=fetch('/sq?dx=hwid').then(r=>r.json()).catch(e=>{hwidQuery=null;throw e;}));const N=async l=>{let f='fr';const{md5,hwid,ver,lang}=await D1(l);if(hwid!=null&&ver!=null)\n{v('fileProps');IH('fwName',l.name);IH('filesize',l.size.toString()+' B');IH('hwid',hwid);IH('fmver',ver);IH('fmlang',lang!=null?lang:'');H('successRow');try{const dJ=await devHwid();if(dJ.hwid&&dJ.hwid===hwid){gebi('hwid').classList.remove('red-txt');gebi('updateBtn').disabled=false;gebi('err').textContent='';H('errRow');}else{gebi('hwid').classList.add('red-txt');gebi('updateBtn').disabled=true;E($L.OTA_JS_HWID_MISMATCH);v('errRow');return null;}}catch(e){gebi('updateBtn').disabled=true;E($L.OTA_JS_HWID_MISMATCH);v('errRow');return null;}\nreturn{'md5':md5,'file':l,'hwid':hwid};}\nelse\n{H('fileProps');IH('fwName',l.name);gebi('updateBtn').disabled=true;E('Incorrect file selected.');H('successRow');v('errRow');}\nreturn null;};const V=l=>l.length>1&&!multiple?(alert($L.OTA_JS_UPLOAD_ONE_BIN_FILE),!1):l[0].name.split('.').pop()!='bin'?(alert($L.OTA_JS_UPLOAD_ONLY_BIN_FILES),!1):!0;function G(){window.location.reload()}\nfunction PG(v){gebi('otaProg').value=v;gebi('otaProgTxt').innerHTML=v.toString()+'%';}\nvar timeOut;function finishedOK(){H('progRow');showRestartModal(15,$L.OTA_UPDATE_IN_PROGRESS);}\nfunction failed(msg){E(msg);gebi('updateBtn').disabled=false;gebi('back').disabled=false;H('progRow');v('errRow');}\nasync function startUpload(file,md5,hwid){let f='fr';PG(0);H('errRow');H('successRow');v('progRow');try{w('Uploading '+file.name);const d=await fetch(`/ota/start?mode=${f}&hash=${md5}&hwid=${hwid}`);if(!d.ok)\n{throw new Error(d.statusText);}\nif(d.status==200&&d.statusText!=='OK')\n{throw new Error(d.statusText);}\nconst a=await d.text();console.log('Start OTA response:',a);const c=new FormData;let i=new XMLHttpRequest;i.open('POST','/ota/upload');i.upload.addEventListener('progress',function(r){let p=Math.round(r.loaded/r.total*100);PG(p);},!1);i.upload.onprogress=function(r){if(r.lengthComputable){let p=Math.round(r.loaded/r.total*100);PG(p);}};i.onreadystatechange=function(){if(i.readyState==4)\nif(i.status==200)\nfinishedOK();else if(i.status==400){let r=i.responseText;throw new Error($L.OTA_JS_UPLOAD_FAILED+' '+r);}\nelse{let r=$L.OTA_JS_SERVER_RETURNED_STATUS+i.status;throw new Error($L.OTA_JS_UPLOAD_FAILED+' '+r);}};c.append('file',file,file.name);i.send(c);}\ncatch(s){failed(s);}}\nlet selectedFile=null;async function z(files){if(!V(files))\nreturn false;const result=await N(files[0]);if(result!=null){selectedFile=result;}else{selectedFile=null;}\ngebi('fileInput').value='';}\nwindow.resetView=G;window.onFileInput=z;document.addEventListener('DOMContentLoaded',()=>{var q=gebi('selFile'),fileInp=gebi('fileInput');const updateBtn=gebi('updateBtn');q.addEventListener('click',function(l){l.preventDefault(),fileInp.click()});updateBtn.addEventListener('click',async(e)=>{e.preventDefault();if(selectedFile&&selectedFile.file&&selectedFile.md5){updateBtn.disabled=true;gebi('back').disabled=true;startUpload(selectedFile.file,selectedFile.md5,selectedFile.hwid);}else{console.error('No valid file selected for upload.');alert('Please select a valid firmware file first.');}});});return{};})();(()=>{const{gebi}=$m0;const{showRestartModal}=$m2;function showInfoModal(msg){var overlay=document.createElement('div');overlay.className='modal-overlay';overlay.innerHTML='<div class=\\'modal-box\\'>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-btn-row\\'>'+\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'rmOk\\'>OK</button>'+\n'</div></div>';document.body.appendChild(overlay);document.getElementById('rmOk').onclick=function(){document.body.removeChild(overlay);};}\nfunction showUpdateModal(data){var langs=Object.keys(data.firmwares);var opts=langs.map(function(l){var sel=(l===data.lang)?' selected':'';return'<option value=\\''+l+'\\''+sel+'>'+l+'</option>';}).join('');var msg=data.available?($L.OTA_REMOTE_NEW_VERSION+'<strong>'+data.version+'</strong><br>'+$L.OTA_REMOTE_CURRENT+data.current):($L.OTA_REMOTE_SWITCH_LANG+data.version+')');var overlay=document.createElement('div');overlay.className='modal-overlay';overlay.innerHTML='<div class=\\'modal-box\\'>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div style=\\'margin-bottom:0.75rem;\\'>'+\n'<label class=\\'flbl\\' for=\\'rmLang\\'>'+$L.OTA_REMOTE_LANGUAGE_LABEL+'</label>'+\n'<select class=\\'finp\\' id=\\'rmLang\\'>'+opts+'</select>'+\n'</div>'+\n'<div class=\\'modal-btn-row\\'>'+\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'rmUpdate\\'>'+$L.OTA_REMOTE_UPDATE_BTN+'</button>'+\n'<button class=\\'modal-btn modal-btn-no\\' id=\\'rmBack\\'>'+$L.GENERAL_BACK+'</button>'+\n'</div></div>';document.body.appendChild(overlay);document.getElementById('rmUpdate').onclick=function(){var lang=document.getElementById('rmLang').value;var url=data.firmwares[lang];document.body.removeChild(overlay);fetch('/ota/remote-start?url='+encodeURIComponent(url))\n.then(function(){showRestartModal(30,$L.OTA_UPDATE_IN_PROGRESS);})\n.catch(function(e){gebi('remoteStatus').textContent=$L.OTA_REMOTE_START_FAILED+e.message;});};document.getElementById('rmBack').onclick=function(){document.body.removeChild(overlay);};}\ndocument.addEventListener('DOMContentLoaded',function(){gebi('checkRemoteBtn').addEventListener('click',async function(){var url=gebi('remoteUrl').value.trim();if(!url)return;gebi('remoteStatus').textContent=$L.OTA_REMOTE_CHECKING;try{var r=await fetch('/ota/remote-check?url='+encodeURIComponent(url));var j=await r.json();if(j.error){gebi('remoteStatus').textContent=$L.OTA_REMOTE_ERROR+j.error;return;}\ngebi('remoteStatus').textContent='';if(!j.available&&!j.canSwitch){showInfoModal($L.OTA_REMOTE_UP_TO_DATE+j.current);}else{showUpdateModal(j);}}catch(e){gebi('remoteStatus').textContent=$L.OTA_REMOTE_CHECK_FAILED+e.message;}});});})();\n";
+const char WM_PK_OTA_HTML_KEYS[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title data-l='OTA_TITLE'></title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script type='module' src='ota-remote.eea67e0f.js'></script>\n<script src='app.js'></script>\n<script src='lang.20cef9d9.js'></script></head>\n<body>\n<div class='container'>\n<h1 data-l='OTA_HEADING'></h1>\n<div class='btncol' aria-live='polite'>\n<button id='selFile' class='mainbtn' type='button' data-l='OTA_SELECT_FILE'></button>\n<span id='fwName' class='fname' data-l='OTA_NO_FILE_CHOSEN'></span>\n<input class='hidden' type='file' id='fileInput' name='firmware' accept='.bin,.bin.gz' onchange='onFileInput(files)'>\n<div id='fileProps' class='meta-wrap hidden' aria-hidden='false'>\n<div class='meta-item'>\n<div class='meta-label' data-l='OTA_FILESIZE_LABEL'></div>\n<div id='filesize' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label' data-l='OTA_FIRMWARE_VERSION_LABEL'></div>\n<div id='fmver' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label' data-l='OTA_HARDWARE_ID_LABEL'></div>\n<div id='hwid' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label' data-l='OTA_LANGUAGE_LABEL'></div>\n<div id='fmlang' class='meta-val'></div>\n</div>\n</div>\n</div>\n<div class='btncol hidden' id='progRow'>\n<div class='progwrap'>\n<progress id='otaProg' class='prog' value='0' max='100'></progress>\n<div id='otaProgTxt' class='prog-txt'>0%</div>\n</div>\n<div id='progInfo' class='meta-val' data-l='OTA_UPLOADING_FILE'></div>\n</div>\n<div id='errRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='red-txt'><path d='m21.73 18-8-14a2 2 0 0 0-3.48 0l-8 14A2 2 0 0 0 4 21h16a2 2 0 0 0 1.73-3Z'/><path d='M12 9v4'/><path d='M12 17h.01'/></svg>\n<div id='err' class='meta-val'></div>\n</div>\n<div id='successRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='green-txt'><path d='M3.85 8.62a4 4 0 0 1 4.78-4.77 4 4 0 0 1 6.74 0 4 4 0 0 1 4.78 4.78 4 4 0 0 1 0 6.74 4 4 0 0 1-4.77 4.78 4 4 0 0 1-6.75 0 4 4 0 0 1-4.78-4.77 4 4 0 0 1 0-6.76Z'/><path d='m9 12 2 2 4-4'/></svg>\n<div id='success' class='meta-val'></div>\n</div>\n<div class='row-center'>\n<button id='updateBtn' class='formbtn' disabled data-l='OTA_UPLOAD_UPDATE'></button>\n<a class='formbtn secbtn' id='back' href='./' data-l='GENERAL_BACK'></a>\n</div>\n<div id='otaStatus' class='muted center-txt' style='margin-top:0.625rem;' data-l='OTA_STATUS_HINT'></div>\n<hr>\n<h2 data-l='OTA_REMOTE_HEADING'></h2>\n<div class='btncol'>\n<div>\n<label class='flbl' for='remoteUrl' data-l='OTA_REMOTE_URL_LABEL'></label>\n<input class='finp' type='text' id='remoteUrl' value='' data-app='otaUrl'>\n</div>\n<button id='checkRemoteBtn' class='mainbtn' type='button' data-l='OTA_REMOTE_CHECK_BTN'></button>\n</div>\n<div id='remoteStatus' class='muted center-txt' style='margin-top:0.625rem;' data-l='OTA_REMOTE_STATUS_HINT'></div>\n</div>\n</body>\n</html>\n";
+#else
+const char WM_PK_OTA_HTML_KEYS[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title data-l='OTA_TITLE'></title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script type='module' src='ota.14cce972.js'></script>\n<script src='lang.20cef9d9.js'></script></head>\n<body>\n<div class='container'>\n<h1 data-l='OTA_HEADING'></h1>\n<div class='btncol' aria-live='polite'>\n<button id='selFile' class='mainbtn' type='button' data-l='OTA_SELECT_FILE'></button>\n<span id='fwName' class='fname' data-l='OTA_NO_FILE_CHOSEN'></span>\n<input class='hidden' type='file' id='fileInput' name='firmware' accept='.bin,.bin.gz' onchange='onFileInput(files)'>\n<div id='fileProps' class='meta-wrap hidden' aria-hidden='false'>\n<div class='meta-item'>\n<div class='meta-label' data-l='OTA_FILESIZE_LABEL'></div>\n<div id='filesize' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label' data-l='OTA_FIRMWARE_VERSION_LABEL'></div>\n<div id='fmver' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label' data-l='OTA_HARDWARE_ID_LABEL'></div>\n<div id='hwid' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label' data-l='OTA_LANGUAGE_LABEL'></div>\n<div id='fmlang' class='meta-val'></div>\n</div>\n</div>\n</div>\n<div class='btncol hidden' id='progRow'>\n<div class='progwrap'>\n<progress id='otaProg' class='prog' value='0' max='100'></progress>\n<div id='otaProgTxt' class='prog-txt'>0%</div>\n</div>\n<div id='progInfo' class='meta-val' data-l='OTA_UPLOADING_FILE'></div>\n</div>\n<div id='errRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='red-txt'><path d='m21.73 18-8-14a2 2 0 0 0-3.48 0l-8 14A2 2 0 0 0 4 21h16a2 2 0 0 0 1.73-3Z'/><path d='M12 9v4'/><path d='M12 17h.01'/></svg>\n<div id='err' class='meta-val'></div>\n</div>\n<div id='successRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='green-txt'><path d='M3.85 8.62a4 4 0 0 1 4.78-4.77 4 4 0 0 1 6.74 0 4 4 0 0 1 4.78 4.78 4 4 0 0 1 0 6.74 4 4 0 0 1-4.77 4.78 4 4 0 0 1-6.75 0 4 4 0 0 1-4.78-4.77 4 4 0 0 1 0-6.76Z'/><path d='m9 12 2 2 4-4'/></svg>\n<div id='success' class='meta-val'></div>\n</div>\n<div class='row-center'>\n<button id='updateBtn' class='formbtn' disabled data-l='OTA_UPLOAD_UPDATE'></button>\n<a class='formbtn secbtn' id='back' href='./' data-l='GENERAL_BACK'></a>\n</div>\n<div id='otaStatus' class='muted center-txt' style='margin-top:0.625rem;' data-l='OTA_STATUS_HINT'></div>\n</div>\n</body>\n</html>\n";
+#endif
+const char WM_PK_INFO_HTML_KEYS[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title data-l='DEVICE_STATUS'></title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script type='module'>import{gebi,IH,d2t,sq}from'./utils.f070d5e4.js';window.onload=async()=>{const opt={tableClass:'sttbl',colHeadLocals:{}};try{const d=await sq('hwinfo','fwinfo');d2t(d.hwinfo,'tcont1',opt);d2t(d.fwinfo,'tcont2',opt);}catch(error){IH('tcont1',`Error: ${error.message}`);}};</script>\n<script src='lang.20cef9d9.js'></script></head>\n<body>\n<div class='container'>\n<h1 data-l='DEVICE_INFO'></h1>\n<div id='tcont1'></div>\n<div id='tcont2'></div>\n<div class='row-center' style='margin-top:1.125rem;'>\n<a class='mainbtn' href='/status/update' data-l='GENERAL_REFRESH'></a>\n<a class='formbtn secbtn' href='/' data-l='GENERAL_BACK'></a>\n</div>\n</div>\n</body>\n</html>\n";
+const char WM_PK_WIFI_HTML_KEYS[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width, initial-scale=1.0'>\n<title data-l='WIFI_CONFIGURATION'></title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script type='module'>import{gebi,qsa,u2f}from'./utils.f070d5e4.js';const toggleButtons=qsa('.toggle-password');document.addEventListener('DOMContentLoaded',()=>{toggleButtons.forEach(button=>{button.addEventListener('click',function(){const targetId=this.getAttribute('data-target');const passwordInput=gebi(targetId);if(passwordInput){const type=passwordInput.getAttribute('type')==='password'?'text':'password';passwordInput.setAttribute('type',type);this.textContent=type==='password'?'👁️':'🔒';}});});});window.onload=()=>{u2f('./sq?dx=wifi');};</script>\n<script src='lang.20cef9d9.js'></script></head>\n<body>\n<div class='container'>\n<h1 data-l='WIFI_CONFIGURATION'></h1>\n<form class='formsec' method='POST' action='./wifi'>\n<h2 data-l='WIFI_PRIMARY_NETWORK'></h2>\n<div>\n<label class='flbl' for='ssid1' data-l='WIFI_SSID_1'></label>\n<input class='finp' type='text' id='ssid1' name='ssid1' required aria-label='WiFi SSID'>\n</div>\n<div>\n<label class='flbl' for='pwd1' data-l='WIFI_PASSWORD_1'></label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd1' name='pwd1' aria-label='WiFi Password'>\n<button type='button' class='toggle-password' id='toggle_p' data-target='pwd1' aria-label='Toggle password 1 visibility'>👁️</button>\n</div>\n</div>\n<div class='muted' data-l='WIFI_OPEN_NETWORK_HINT'></div>\n<hr>\n<h2 data-l='WIFI_ALT_NETWORK'></h2>\n<div>\n<label class='flbl' for='ssid2' data-l='WIFI_SSID_2'></label>\n<input class='finp' type='text' id='ssid2' name='ssid2' required aria-label='WiFi SSID'>\n</div>\n<div>\n<label class='flbl' for='pwd2' data-l='WIFI_PASSWORD_2'></label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd2' name='pwd2' aria-label='WiFi Password'>\n<button type='button' class='toggle-password' id='toggle_pwd1' data-target='pwd2' aria-label='Toggle password 2 visibility'>👁️</button>\n</div>\n</div>\n<div class='muted' data-l='WIFI_OPEN_NETWORK_HINT'></div>\n<div class='row-center'>\n<button class='formbtn' type='submit' data-l='WIFI_SAVE'></button>\n<a class='formbtn secbtn' href='/' data-l='GENERAL_BACK'></a>\n</div>\n</form>\n</div>\n</body>\n</html>\n";
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+const char WM_PK_MQTT_HTML_KEYS[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title data-l='MQTT_CONFIGURATION'></title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script type='module'>import{gebi,qsa,u2f}from'./utils.f070d5e4.js';const toggleButtons=qsa('.toggle-password');window.onload=()=>{u2f('./sq?dx=mqtt');};document.addEventListener('DOMContentLoaded',()=>{toggleButtons.forEach(button=>{button.addEventListener('click',function(){const targetId=this.getAttribute('data-target');const passwordInput=gebi(targetId);if(passwordInput){const type=passwordInput.getAttribute('type')==='password'?'text':'password';passwordInput.setAttribute('type',type);this.textContent=type==='password'?'👁️':'🔒';}});});});</script>\n<script src='lang.20cef9d9.js'></script></head>\n<body>\n<div class='container'>\n<h1 class='ttl' data-l='MQTT_CONFIGURATION'></h1>\n<form class='formsec' method='POST' action='/mqtt'>\n<div>\n<label class='flbl' for='host' data-l='MQTT_HOST'></label>\n<input class='finp' type='text' id='host' name='host' required aria-label='MQTT host'>\n</div>\n<div>\n<label class='flbl' for='port' data-l='MQTT_PORT'></label>\n<input class='finp' type='number' id='port' name='port' value='1883' required aria-label='MQTT port'>\n</div>\n<div>\n<label class='flbl' for='user' data-l='MQTT_USERNAME'></label>\n<input class='finp' type='text' id='user' name='user' aria-label='MQTT username'>\n</div>\n<div>\n<label class='flbl' for='pwd' data-l='MQTT_PASSWORD'></label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd' name='pwd' aria-label='MQTT Password'>\n<button type='button' class='toggle-password' id='toggle_pwd' data-target='pwd' aria-label='Toggle password visibility'>👁️</button>\n</div>\n</div>\n<div class='muted' data-l='MQTT_BROKER_HINT'></div>\n<div class='row-center'>\n<button class='formbtn' type='submit' data-l='MQTT_SAVE'></button>\n<a class='formbtn secbtn' href='/' data-l='GENERAL_BACK'></a>\n</div>\n</form>\n</div>\n</body>\n</html>\n";
+#endif
+const char WM_PK_LANG_JS[] PROGMEM = "var $L={};(function(){var paths={en:'/lang/en.ac201ea0.json',sk:'/lang/sk.21c914a1.json'};function selectLanguage(){var m=document.cookie.match(/(?:^|;\\s*)wm_lang=([^;]*)/);if(m&&paths[m[1]]){return m[1];}\nvar preferred=navigator.languages||[navigator.language];for(var i=0;i<preferred.length;i++){var code=(preferred[i]||'').split('-')[0].toLowerCase();if(paths[code]){return code;}}\nreturn'" L_HTML_LANGUAGE "';}\nvar code=selectLanguage();document.documentElement.lang=code;var table=fetch(paths[code]).then(function(r){return r.json();});function apply(){table.then(function(t){Object.assign($L,t);document.querySelectorAll('[data-l]').forEach(function(e){e.textContent=t[e.getAttribute('data-l')];});});}\nif(document.readyState=='loading'){document.addEventListener('DOMContentLoaded',apply);}else{apply();}})();\n";
+const char WM_PK_LANG_EN_JSON[] PROGMEM = "{\"OTA_JS_HWID_MISMATCH\":\"Hardware ID mismatch. This firmware is not for this device.\",\"OTA_JS_UPLOAD_ONE_BIN_FILE\":\"You can only upload one (.bin) file at a time.\",\"OTA_JS_UPLOAD_ONLY_BIN_FILES\":\"You can only upload (.bin) files.\",\"OTA_UPDATE_IN_PROGRESS\":\"Firmware update in progress.\\nDo not turn off the device.\",\"OTA_JS_UPLOAD_FAILED\":\"Upload failed\",\"OTA_JS_SERVER_RETURNED_STATUS\":\"Server returned status code \",\"OTA_JS_ILEGAL_ARGUMENT\":\"Illegal argument \",\"RESTART_CONFIRM\":\"Do you want to restart the device?\",\"GENERAL_YES\":\"Yes\",\"GENERAL_NO\":\"No\",\"RESTART_IN_PROGRESS\":\"Restart in progress...\",\"STATUS_SENSOR\":\"Sensor\",\"STATUS_VALUE\":\"Value\",\"STATUS_UNIT\":\"Unit\",\"STATUS_LOADING\":\"Loading…\",\"INFORMATION_3DOTS\":\"Information...\",\"WIFI_CONFIGURATION_3DOTS\":\"WiFi Configuration...\",\"MQTT_CONFIGURATION_3DOTS\":\"MQTT Configuration...\",\"FIRMWARE_UPDATE_3DOTS\":\"Firmware update...\",\"RESTART_3DOTS\":\"Restart...\",\"OTA_REMOTE_NEW_VERSION\":\"New version available: \",\"OTA_REMOTE_CURRENT\":\"Current: \",\"OTA_REMOTE_SWITCH_LANG\":\"Switch language (version \",\"OTA_REMOTE_LANGUAGE_LABEL\":\"Language:\",\"OTA_REMOTE_UPDATE_BTN\":\"Update\",\"GENERAL_BACK\":\"Back\",\"OTA_REMOTE_START_FAILED\":\"Start failed: \",\"OTA_REMOTE_CHECKING\":\"Checking...\",\"OTA_REMOTE_ERROR\":\"Error: \",\"OTA_REMOTE_UP_TO_DATE\":\"Firmware is up to date. Version: \",\"OTA_REMOTE_CHECK_FAILED\":\"Check failed: \",\"OTA_TITLE\":\"OTA Update\",\"OTA_HEADING\":\"Firmware OTA Update\",\"OTA_SELECT_FILE\":\"Select File\",\"OTA_NO_FILE_CHOSEN\":\"No file chosen\",\"OTA_FILESIZE_LABEL\":\"Filesize:\",\"OTA_FIRMWARE_VERSION_LABEL\":\"Firmware version:\",\"OTA_HARDWARE_ID_LABEL\":\"Hardware ID:\",\"OTA_LANGUAGE_LABEL\":\"Language:\",\"OTA_UPLOADING_FILE\":\"Uploading file.\",\"OTA_UPLOAD_UPDATE\":\"Upload & Update\",\"OTA_STATUS_HINT\":\"Select a firmware file (.bin) and press Upload & Update.\",\"OTA_REMOTE_HEADING\":\"Remote Update\",\"OTA_REMOTE_URL_LABEL\":\"Update server URL:\",\"OTA_REMOTE_CHECK_BTN\":\"Check for Update\",\"OTA_REMOTE_STATUS_HINT\":\"Enter the update server URL and press Check for Update.\",\"DEVICE_STATUS\":\"Device Status\",\"DEVICE_INFO\":\"Device Info\",\"GENERAL_REFRESH\":\"Refresh\",\"WIFI_CONFIGURATION\":\"WiFi Configuration\",\"WIFI_PRIMARY_NETWORK\":\"Primary Network\",\"WIFI_SSID_1\":\"SSID 1\",\"WIFI_PASSWORD_1\":\"Password 1\",\"WIFI_OPEN_NETWORK_HINT\":\"Leave password empty for open networks.\",\"WIFI_ALT_NETWORK\":\"Alternative Network (Optional)\",\"WIFI_SSID_2\":\"SSID 2\",\"WIFI_PASSWORD_2\":\"Password 2\",\"WIFI_SAVE\":\"Save WiFi\",\"MQTT_CONFIGURATION\":\"MQTT Configuration\",\"MQTT_HOST\":\"MQTT Host\",\"MQTT_PORT\":\"Port\",\"MQTT_USERNAME\":\"Username\",\"MQTT_PASSWORD\":\"Password\",\"MQTT_BROKER_HINT\":\"If your broker requires TLS or a username/password, fill the fields; otherwise leave blank.\",\"MQTT_SAVE\":\"Save MQTT\"}";
+const char WM_PK_LANG_SK_JSON[] PROGMEM = "{\"OTA_JS_HWID_MISMATCH\":\"Nezhodná Hardware ID. Tento firmvér nie je pre toto zariadenie.\",\"OTA_JS_UPLOAD_ONE_BIN_FILE\":\"Môžete nahrať iba jeden súbor (.bin) naraz.\",\"OTA_JS_UPLOAD_ONLY_BIN_FILES\":\"Môžete nahrávať iba súbory (.bin).\",\"OTA_UPDATE_IN_PROGRESS\":\"Prebieha aktualizácia firmvéru.\\nNevypínajte zariadenie.\",\"OTA_JS_UPLOAD_FAILED\":\"Nahrávanie zlyhalo\",\"OTA_JS_SERVER_RETURNED_STATUS\":\"Server vrátil stavový kód \",\"OTA_JS_ILEGAL_ARGUMENT\":\"Neplatný argument \",\"RESTART_CONFIRM\":\"Chcete reštartovať zariadenie?\",\"GENERAL_YES\":\"Áno\",\"GENERAL_NO\":\"Nie\",\"RESTART_IN_PROGRESS\":\"Reštart prebieha...\",\"STATUS_SENSOR\":\"Senzor\",\"STATUS_VALUE\":\"Hodnota\",\"STATUS_UNIT\":\"Jednotka\",\"STATUS_LOADING\":\"Načítavam…\",\"INFORMATION_3DOTS\":\"Informácie...\",\"WIFI_CONFIGURATION_3DOTS\":\"Konfigurácia WiFi...\",\"MQTT_CONFIGURATION_3DOTS\":\"Konfigurácia MQTT...\",\"FIRMWARE_UPDATE_3DOTS\":\"Aktualizácia firmvéru...\",\"RESTART_3DOTS\":\"Reštart...\",\"OTA_REMOTE_NEW_VERSION\":\"Dostupná nová verzia: \",\"OTA_REMOTE_CURRENT\":\"Aktuálna: \",\"OTA_REMOTE_SWITCH_LANG\":\"Zmena jazyka (verzia \",\"OTA_REMOTE_LANGUAGE_LABEL\":\"Jazyk:\",\"OTA_REMOTE_UPDATE_BTN\":\"Aktualizovať\",\"GENERAL_BACK\":\"Späť\",\"OTA_REMOTE_START_FAILED\":\"Spustenie zlyhalo: \",\"OTA_REMOTE_CHECKING\":\"Kontrolujem...\",\"OTA_REMOTE_ERROR\":\"Chyba: \",\"OTA_REMOTE_UP_TO_DATE\":\"Firmvér je aktuálny. Verzia: \",\"OTA_REMOTE_CHECK_FAILED\":\"Kontrola zlyhala: \",\"OTA_TITLE\":\"OTA aktualizácia\",\"OTA_HEADING\":\"OTA aktualizácia firmvéru\",\"OTA_SELECT_FILE\":\"Vybrať súbor\",\"OTA_NO_FILE_CHOSEN\":\"Žiadny súbor nie je vybraný\",\"OTA_FILESIZE_LABEL\":\"Veľkosť súboru:\",\"OTA_FIRMWARE_VERSION_LABEL\":\"Verzia firmvéru:\",\"OTA_HARDWARE_ID_LABEL\":\"Hardware ID:\",\"OTA_LANGUAGE_LABEL\":\"Jazyk:\",\"OTA_UPLOADING_FILE\":\"Nahrávam súbor.\",\"OTA_UPLOAD_UPDATE\":\"Nahrať a aktualizovať\",\"OTA_STATUS_HINT\":\"Vyberte súbor firmvéru (.bin) a stlačte Nahrať a aktualizovať.\",\"OTA_REMOTE_HEADING\":\"Vzdialená aktualizácia\",\"OTA_REMOTE_URL_LABEL\":\"URL aktualizačného servera:\",\"OTA_REMOTE_CHECK_BTN\":\"Skontrolovať aktualizáciu\",\"OTA_REMOTE_STATUS_HINT\":\"Zadajte URL servera a stlačte Skontrolovať aktualizáciu.\",\"DEVICE_STATUS\":\"Stav zariadenia\",\"DEVICE_INFO\":\"Informácie o zariadení\",\"GENERAL_REFRESH\":\"Obnoviť\",\"WIFI_CONFIGURATION\":\"Konfigurácia WiFi\",\"WIFI_PRIMARY_NETWORK\":\"Primárna sieť\",\"WIFI_SSID_1\":\"SSID 1\",\"WIFI_PASSWORD_1\":\"Heslo 1\",\"WIFI_OPEN_NETWORK_HINT\":\"Pre otvorené siete nechajte heslo prázdne.\",\"WIFI_ALT_NETWORK\":\"Alternatívna sieť (voliteľné)\",\"WIFI_SSID_2\":\"SSID 2\",\"WIFI_PASSWORD_2\":\"Heslo 2\",\"WIFI_SAVE\":\"Uložiť WiFi\",\"MQTT_CONFIGURATION\":\"Konfigurácia MQTT\",\"MQTT_HOST\":\"MQTT Host\",\"MQTT_PORT\":\"Port\",\"MQTT_USERNAME\":\"Používateľské meno\",\"MQTT_PASSWORD\":\"Heslo\",\"MQTT_BROKER_HINT\":\"Ak váš broker vyžaduje TLS alebo meno/heslo, vyplňte príslušné polia; inak ich nechajte prázdne.\",\"MQTT_SAVE\":\"Uložiť MQTT\"}";
 
+const uint8_t WM_PK_OTA_JS_KEYS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x5a,0x6b,0x77,0x9b,0x48,0xd2,0xfe,0xee,0x5f,0x21,0x9f,0xcd,0x08,0x88,0x10,0xe6,0x2e,0x90,0xd4,0xc9,0x38,
+0x89,0x13,0x7b,0xc6,0x8e,0xb3,0xbe,0xcc,0xec,0xae,0xc7,0xe3,0x45,0xd0,0x92,0x88,0x11,0x30,0x80,0x6c,0x6b,0x64,0xed,0x6f,0x7f,0xab,0xba,0x41,0x37,0xe4,0x4c,0xe6,
+0x9c,0x37,0x39,0xc7,0x40,0x77,0x75,0xf5,0x53,0x97,0xae,0xaa,0xee,0x96,0x9f,0xc4,0x79,0xd1,0x78,0x35,0x51,0x89,0x28,0x4a,0xe4,0xcd,0xdc,0x67,0xdf,0x23,0x3a,0x08,
+0x49,0x4e,0xde,0x04,0x89,0x3f,0x9d,0xd0,0xb8,0x50,0x46,0xb4,0x38,0x8a,0x28,0xbe,0xbe,0x9b,0x9d,0x04,0x62,0x2e,0xf5,0x38,0xe1,0xc9,0x31,0x11,0x23,0xf9,0x01,0x47,
+0xe2,0x18,0x31,0x92,0x94,0x82,0x3e,0x15,0xef,0x93,0xb8,0x00,0x5a,0xf2,0xb0,0xe8,0x65,0xb4,0x98,0x66,0xf1,0xfc,0xe4,0x58,0x46,0x82,0x45,0x6f,0x21,0x89,0xd5,0xe0,
+0x57,0x13,0xad,0x9c,0x75,0x38,0x8d,0xfd,0x22,0x4c,0xe2,0xc6,0x21,0x70,0x98,0xf3,0x21,0x8d,0xa8,0xd9,0x8c,0x94,0xbb,0x3b,0x9a,0x9f,0x25,0xc1,0x34,0xa2,0xcd,0xe6,
+0xf9,0xe0,0x2b,0xf5,0x0b,0x25,0xcd,0x92,0x22,0x29,0x66,0x29,0x55,0xc6,0x5e,0x7e,0xfe,0x18,0x7f,0xc9,0x92,0x94,0x66,0xc5,0x4c,0xf1,0xbd,0x28,0x02,0x34,0x42,0x40,
+0x87,0xde,0x34,0x2a,0x04,0xe9,0x6d,0xa4,0x94,0xef,0xdd,0x68,0xb1,0xf7,0xe0,0x65,0x8d,0x53,0x32,0xa7,0x4f,0x69,0x92,0x15,0x79,0x77,0xbe,0x58,0xc8,0x4f,0x1b,0x9f,
+0x3d,0xb1,0xc2,0x21,0x4a,0x73,0xa4,0x8e,0x88,0x70,0xf8,0xee,0xfd,0x87,0xa3,0x8f,0x9f,0x8e,0x4f,0x7e,0xfa,0xf9,0xf4,0xec,0xf3,0xf9,0x97,0x7f,0x5e,0x5c,0x5e,0x5d,
+0xff,0xf2,0xeb,0xbf,0xfe,0xfd,0x1f,0x6f,0xe0,0x03,0xf3,0xd1,0x38,0xfc,0x7a,0x1f,0x4d,0xe2,0x24,0xfd,0x23,0xcb,0x8b,0xe9,0xc3,0xe3,0xd3,0xec,0x4f,0x55,0xd3,0x0d,
+0xd3,0xb2,0x3b,0x8e,0xdb,0x3a,0x10,0xe4,0x21,0x99,0x03,0xe0,0xa8,0xbb,0xe4,0x9d,0xcb,0xc1,0x52,0xc6,0xbc,0xdf,0x0f,0x9e,0xf3,0x37,0x6f,0xde,0x18,0x7a,0x3b,0x58,
+0xc8,0x40,0x98,0xbd,0x48,0x88,0x24,0x8c,0x16,0x08,0x69,0x1c,0x84,0x5e,0xbc,0x46,0x2a,0xcd,0xc3,0xa1,0x98,0x2b,0x4c,0xb1,0xd9,0xd4,0x2f,0x92,0x8c,0x90,0xcf,0xd3,
+0xc9,0x80,0x66,0xd2,0x5e,0xc9,0x62,0xa8,0x20,0x0e,0xe0,0xea,0x48,0x4d,0xcd,0xee,0x68,0x9a,0x6b,0x58,0xcf,0xcb,0x46,0xdd,0x94,0x9a,0xa6,0xde,0x71,0x74,0xcb,0x32,
+0x6c,0xb5,0x37,0x4c,0x32,0x11,0x55,0x10,0x10,0xb5,0x17,0xf4,0x73,0x25,0xa2,0xf1,0xa8,0x18,0xf7,0x82,0x56,0x4b,0xca,0x6f,0x82,0x5b,0x32,0x54,0x38,0x04,0x11,0xbf,
+0xa4,0x5e,0x85,0x12,0x44,0xf0,0xe2,0x20,0x99,0xbc,0x9b,0x15,0x34,0xdf,0x80,0xb7,0x62,0x78,0x73,0xdb,0xcb,0xdf,0xa8,0xbd,0xbc,0xdd,0x96,0xf6,0x02,0x25,0x9d,0xe6,
+0x63,0xf1,0xcc,0x2b,0xc6,0xca,0x30,0x4a,0x80,0x86,0xbd,0x72,0x26,0xa2,0xf4,0x5a,0xb7,0x6c,0x69,0xc9,0x1d,0xe4,0x1e,0x20,0xdf,0xab,0xe4,0xd7,0x24,0x0b,0x5e,0x66,
+0x2f,0x7b,0x44,0x95,0x7d,0x00,0xee,0xad,0x80,0x7b,0xad,0x96,0xec,0xb7,0x88,0x03,0x53,0xde,0xf8,0xa0,0x43,0xeb,0xf6,0x99,0xe4,0x37,0xde,0x6d,0xbf,0xaf,0x9b,0x6d,
+0xff,0x07,0x43,0x5f,0x9b,0xe4,0x11,0xb9,0x5f,0x25,0xdf,0x96,0x01,0x27,0x59,0x9b,0xe0,0x35,0x70,0xf0,0x38,0x7f,0x2e,0x12,0x30,0x67,0xd3,0xc0,0x1f,0x98,0xc1,0x83,
+0x19,0x9a,0xa0,0xda,0x1d,0xb2,0x1c,0xd3,0xa7,0xef,0x9d,0x04,0xa5,0x58,0x4e,0x80,0x33,0x20,0x77,0x13,0x96,0x5c,0x72,0x59,0x64,0x61,0x3c,0x12,0x35,0xd0,0x96,0xbc,
+0xde,0xdf,0xd4,0xac,0xad,0xee,0x25,0x00,0xe5,0x6b,0x12,0xc6,0xa2,0x20,0x48,0x0b,0x79,0x4c,0x9f,0xfe,0xa6,0xb8,0x28,0xab,0xbe,0x84,0x92,0x7a,0x59,0x4e,0x4f,0xe2,
+0x02,0x1c,0x30,0x9f,0x0e,0xc0,0x01,0x45,0x4f,0xd6,0x25,0x59,0xdb,0x69,0xbb,0x77,0x5e,0x4e,0x6d,0xf3,0xef,0x4c,0x64,0x48,0x7b,0x15,0x85,0x5f,0x1a,0x4d,0xb3,0x9f,
+0xe1,0xa5,0xa5,0xc1,0xab,0xc3,0xde,0xf4,0x5b,0x39,0x84,0x81,0x61,0xdf,0xec,0x85,0xa8,0x24,0xef,0xb5,0xd3,0x0a,0x5f,0xdb,0x7d,0xb2,0x34,0x90,0xf3,0xb6,0x44,0x1b,
+0x29,0xfe,0xd8,0xcb,0x0e,0x0b,0x11,0xfd,0xc0,0x7e,0x2d,0x1a,0xed,0x50,0x6a,0xda,0x86,0x24,0x75,0x4b,0x02,0x81,0x08,0x3b,0xd5,0x34,0x60,0xc8,0x77,0x69,0x2a,0x87,
+0x69,0x32,0x9a,0x46,0x9e,0x4f,0xc5,0x83,0x9b,0xdf,0x0f,0xdb,0xff,0x51,0xdb,0x6e,0xeb,0xb7,0x83,0xdb,0x83,0x70,0x24,0xc3,0xd8,0xde,0x5f,0xb9,0xa7,0x4f,0x5a,0x2d,
+0xef,0x07,0x53,0xda,0xf3,0xf7,0x89,0xda,0x6c,0x56,0x26,0x8c,0x94,0x30,0x0e,0xe8,0xd3,0x39,0x5b,0xda,0x1c,0xb4,0xd7,0xd6,0x24,0xa9,0xc9,0x56,0x49,0x9a,0x3c,0x8a,
+0xba,0xdc,0xd6,0x5f,0xfb,0x2d,0x47,0x82,0xe6,0x7e,0xdf,0x7f,0xad,0x3f,0xef,0x1a,0x23,0x49,0x28,0x6a,0x1b,0xba,0xd7,0x0c,0xb2,0xe8,0x3d,0x29,0x65,0xf4,0x23,0x43,
+0x16,0x96,0x11,0xe1,0x31,0x59,0xb6,0xca,0x1f,0xc9,0x7c,0x5a,0x0c,0x9d,0xee,0x3c,0x67,0xfe,0x53,0x93,0x7c,0x15,0xab,0x3f,0x2a,0x83,0x30,0x56,0x36,0xc8,0xc4,0x69,
+0x4c,0x73,0xdf,0x4b,0xa9,0x48,0x63,0x3f,0x09,0xe8,0xf5,0xc5,0xc9,0xfb,0x64,0x92,0x26,0x31,0x24,0x06,0x18,0x29,0x49,0x4b,0x8f,0xe0,0xde,0xb9,0x8b,0x6d,0x40,0x6b,
+0x23,0x4b,0x9e,0x7c,0xc2,0x0d,0x06,0x9c,0x29,0x70,0x0d,0xe3,0x6f,0x21,0xae,0x4c,0x31,0x44,0x53,0xe4,0x60,0x86,0xbc,0x1f,0x55,0x66,0xc8,0xd1,0x75,0x86,0xeb,0x6e,
+0xf2,0x1e,0xe6,0x07,0x0d,0xe6,0xd2,0xc6,0xea,0x1d,0x7e,0x0b,0xfb,0xf7,0x4e,0xc0,0x87,0x2a,0xc3,0x2c,0x99,0xbc,0x2f,0x67,0x12,0xa3,0x9b,0xfc,0x76,0xb5,0x68,0x86,
+0x2b,0xe7,0x03,0xb9,0x4e,0xc8,0x47,0x66,0xa1,0x73,0xb2,0x43,0x53,0xd1,0x3e,0x89,0xa7,0x11,0xa4,0x4c,0xf1,0x0c,0x5a,0x9f,0x9f,0xbf,0xb0,0xbf,0xfb,0xfb,0x90,0x41,
+0xc3,0xfc,0xdd,0x74,0x38,0x84,0x44,0xb0,0xe8,0x2d,0xf3,0xec,0xd9,0x6a,0x28,0xd2,0xac,0xa5,0x8d,0x66,0x13,0x53,0x6b,0x32,0x6c,0x6c,0xb4,0x2a,0x15,0x13,0x42,0x84,
+0x8a,0x89,0x80,0xf9,0x79,0x17,0x0d,0xf0,0x5e,0xec,0x2d,0xa7,0xfa,0xb2,0x86,0x72,0xc9,0x3a,0xa3,0x5e,0xf0,0x31,0x4a,0xbc,0xe2,0xf4,0x68,0x93,0xe3,0x92,0x22,0x8f,
+0x42,0x9f,0x6e,0xf6,0x01,0x68,0xde,0x2c,0xaa,0xb2,0x0a,0xa6,0xde,0xab,0xe7,0xeb,0x63,0x48,0xb7,0x27,0x0a,0x3a,0x2d,0x68,0xfe,0x5c,0x0e,0xe0,0x03,0xdc,0x01,0x56,
+0xdc,0x92,0xd2,0x97,0x43,0x69,0xee,0x6f,0x26,0x4a,0x6e,0x89,0xb7,0x61,0xb3,0x19,0x2a,0xcc,0x59,0xe1,0x8b,0xc0,0xdc,0x30,0xd4,0xcb,0x66,0xc2,0x5b,0x9f,0x04,0x5b,
+0xbe,0xed,0x4b,0x5d,0x1f,0x72,0x60,0xad,0x11,0xff,0x00,0xf9,0x61,0x96,0x79,0xb3,0xb5,0x42,0x85,0xa1,0xe6,0xf5,0x89,0x0f,0xd0,0xbb,0xfb,0x9c,0x20,0xcc,0xd9,0x13,
+0xc6,0x34,0x9b,0x1b,0x90,0xf6,0x09,0xb9,0x0e,0xe3,0xc2,0x61,0xdd,0x60,0x53,0x9f,0xf8,0xab,0x28,0x2e,0xad,0xc2,0x49,0x46,0x22,0x65,0x3d,0x25,0x02,0x27,0x39,0x05,
+0xda,0x2a,0xe4,0xc9,0x31,0xd1,0x3a,0x86,0x6e,0x39,0x26,0x24,0x7b,0x99,0x92,0xb6,0xde,0x81,0x6f,0xc3,0xe9,0xb8,0x72,0x42,0xda,0xcb,0x2e,0x53,0x2e,0x48,0xd5,0xe3,
+0xc8,0x53,0x70,0xd9,0x69,0x3f,0xab,0x5c,0x76,0x8a,0x2e,0x9b,0xdd,0x4c,0x6f,0x89,0x88,0x7f,0x31,0xe0,0xe2,0x93,0xe5,0xb5,0xb5,0x42,0xa2,0xec,0xd4,0xcd,0xaa,0xd7,
+0xd9,0xa8,0x27,0xb2,0x9b,0xb4,0xcc,0xba,0x9a,0xee,0xf4,0xfb,0x29,0xe4,0x43,0x39,0xbb,0x11,0xd3,0x96,0x6d,0x42,0xbb,0xdb,0xef,0x9b,0x52,0x4b,0x33,0x6f,0x49,0xba,
+0x94,0x6d,0x42,0x3c,0xe5,0x6e,0x38,0x94,0x47,0xf8,0x1c,0x8d,0xe4,0x31,0x3e,0xc7,0x63,0x79,0x86,0xcf,0x30,0xac,0xc3,0x24,0x90,0x6f,0x98,0x1b,0xbc,0x27,0xb1,0x7c,
+0x49,0xa8,0x7c,0x4f,0x12,0xf9,0x8e,0x14,0xbd,0x98,0x4c,0xc4,0x58,0xa6,0x72,0x22,0x17,0x30,0xe7,0xb4,0xa5,0xde,0xca,0x1d,0xb9,0x6d,0x3b,0xaa,0xd3,0xb1,0x5d,0xc3,
+0x96,0x40,0xfa,0x89,0x58,0xc8,0x9c,0x04,0x09,0xb4,0x5b,0x59,0x83,0xc0,0x6a,0x38,0xae,0x65,0x9b,0x96,0x03,0x14,0x09,0x50,0xe0,0x70,0xa4,0x41,0x0a,0x48,0x37,0x5a,
+0x47,0xb6,0x55,0x5b,0x53,0x2d,0x47,0x73,0x25,0xd0,0xed,0x44,0xe4,0x33,0xc4,0x8c,0xc0,0xb8,0x95,0x75,0x60,0xa1,0xa9,0xa6,0x69,0xe9,0x96,0x61,0xa8,0x92,0xbc,0x0d,
+0xc3,0x64,0x30,0xb4,0x8e,0x6d,0x6a,0x8e,0xe3,0x76,0xea,0x30,0x2c,0x06,0x43,0xd3,0x55,0x55,0x75,0x54,0x53,0xdf,0x01,0xc3,0x66,0x30,0xda,0x9a,0x09,0x96,0x34,0x34,
+0xc3,0xd4,0xea,0x40,0x3a,0x1c,0x88,0x69,0x75,0x54,0xcb,0x75,0x8c,0x3a,0x0c,0x07,0x61,0x68,0x9d,0x8e,0xaa,0x1a,0x96,0xa9,0xed,0xd0,0x86,0xcb,0xb5,0xa1,0xb9,0xe8,
+0x2b,0xa6,0xa9,0x75,0xea,0x38,0x34,0x95,0x03,0x31,0x75,0x15,0x12,0x69,0x0d,0x83,0xa6,0x95,0xda,0x70,0x5d,0xd5,0x54,0x61,0x12,0xbd,0x0e,0x43,0xd3,0x19,0x0e,0x10,
+0xd4,0x56,0x0d,0xdb,0xd1,0x77,0x58,0xc5,0xe0,0x40,0x4c,0x15,0x04,0xd5,0x54,0x6d,0x07,0x0c,0xb3,0xd4,0x87,0xa5,0x82,0xd2,0x74,0xdd,0x55,0x77,0x60,0xb1,0x18,0x16,
+0x28,0xd1,0x6d,0xcb,0xb0,0x0c,0xdd,0x45,0x28,0xa3,0x4d,0x28,0xb7,0xb2,0x05,0x4c,0x6c,0xab,0xe3,0xda,0x96,0xa6,0x22,0x92,0xd1,0x06,0x12,0x50,0xbb,0x8b,0xb6,0xb5,
+0x5d,0x4b,0xd5,0x6c,0x43,0x47,0x24,0xa3,0x4d,0x24,0xe8,0x42,0xa6,0x6c,0x9b,0x06,0x2c,0xab,0x8e,0xc6,0x74,0x32,0xda,0xc0,0x01,0x1a,0xd3,0x55,0xf0,0xb1,0x0e,0x78,
+0x59,0xc7,0x50,0xf5,0x3a,0x0c,0x8b,0xc1,0xe8,0xa8,0x9a,0x05,0x2e,0xe8,0x6a,0x75,0x18,0xa8,0x75,0x57,0x36,0x1c,0xc0,0xa0,0xa2,0x65,0x6b,0x20,0x2c,0x06,0xa2,0x6d,
+0xdb,0xaa,0xd9,0x71,0x0c,0xc3,0xaa,0xa3,0x30,0x39,0x0a,0x53,0x85,0x55,0xda,0x71,0x4c,0xa7,0x8e,0xc2,0x45,0x14,0x96,0xed,0x98,0x26,0x08,0xe3,0xec,0x00,0x61,0x96,
+0xca,0xd0,0x5c,0x07,0x0c,0x87,0x2a,0xdf,0xc6,0x61,0x70,0x18,0x9a,0xd3,0x31,0x6c,0xc3,0xb5,0xb5,0x3a,0x0c,0x87,0xc1,0xd0,0x40,0x97,0x96,0x01,0xc6,0xd3,0x76,0xd8,
+0xc4,0xe0,0x46,0x31,0x01,0x87,0xa3,0x99,0x76,0xa7,0x8e,0x44,0x67,0x40,0x2c,0x0d,0xfc,0x03,0x44,0xa9,0xc3,0xe8,0x30,0x18,0x10,0xe5,0xc0,0xea,0x0e,0xac,0x98,0x3a,
+0x0c,0xf4,0x41,0x54,0x87,0xe6,0xea,0xa0,0xb3,0x4e,0xc7,0x30,0x11,0xc8,0x78,0xdb,0x2a,0x26,0x9a,0xcd,0x01,0xab,0x20,0x86,0xf1,0x06,0x06,0x10,0x44,0xd3,0xa0,0x24,
+0x03,0xe7,0xb3,0x3a,0x00,0x95,0x59,0x65,0x5c,0x77,0x0d,0x1b,0x3c,0xdd,0x70,0x55,0x43,0xb5,0x70,0x2d,0x50,0x20,0xd9,0xc0,0x81,0x66,0x31,0x60,0x16,0xcb,0x50,0x5d,
+0x0b,0xb6,0x40,0x35,0x14,0x1a,0x43,0xa1,0x61,0xbf,0x0b,0x6b,0x4e,0xad,0x23,0x31,0x19,0x12,0x4d,0xef,0xe8,0x8e,0x0b,0xa6,0xdf,0x01,0xa4,0xc3,0x70,0x00,0x13,0xcb,
+0x74,0x3b,0xcc,0x8b,0x6b,0x38,0x54,0x8e,0x43,0x53,0x5d,0xd0,0x97,0x6a,0x9b,0xea,0x0e,0x24,0x06,0x42,0x01,0x9b,0xe8,0x1d,0x57,0xeb,0x98,0x75,0x20,0x2a,0x57,0x89,
+0x61,0x39,0xe0,0x62,0xba,0xae,0xd7,0x81,0x18,0x1c,0x08,0x74,0x5a,0xba,0xe6,0x76,0xdc,0x3a,0x10,0x9b,0xe1,0xe8,0xd8,0xaa,0xee,0x6a,0x8e,0x5b,0x07,0xe1,0x32,0x75,
+0x00,0x3e,0xc3,0x36,0x4d,0xa7,0x53,0x07,0x81,0x96,0x45,0x14,0xa6,0xae,0x39,0x9a,0xe5,0xe0,0x52,0xa8,0xd9,0xc5,0x62,0x30,0x40,0xa5,0x1d,0x13,0x80,0xa8,0x75,0x14,
+0x3a,0xd7,0x86,0xeb,0x42,0x3c,0x77,0x20,0x32,0x20,0x8e,0xd9,0x76,0x66,0x41,0x8d,0xba,0x8e,0x6d,0xa8,0xb0,0x62,0x10,0xc7,0x6c,0x03,0x07,0xea,0x1c,0x1d,0x5d,0xb7,
+0x1d,0x57,0x33,0x35,0x06,0x63,0x56,0x8f,0x61,0xcc,0xd3,0x71,0x35,0x98,0xae,0xca,0x56,0xed,0x6c,0x03,0x08,0x86,0x30,0x10,0x06,0x3c,0xcc,0xc0,0x95,0x5b,0xc7,0x81,
+0xe2,0x82,0x8b,0x41,0x4c,0x37,0xc1,0x4f,0x3b,0x5a,0x1d,0x88,0xc1,0x80,0xc0,0x9a,0x74,0x4d,0x40,0x0b,0x89,0x6c,0x07,0x12,0xb5,0x44,0xa2,0x5a,0x9a,0xa5,0x1b,0x75,
+0x18,0x1a,0x87,0xa1,0xab,0x00,0x53,0x07,0xf3,0xbb,0x75,0x20,0x0e,0xc3,0x01,0x0b,0x1f,0xb2,0x93,0x61,0xb9,0x75,0x1c,0x4c,0xeb,0x18,0x07,0x21,0x95,0x82,0xfb,0x98,
+0x75,0x18,0x76,0x89,0xc2,0xb2,0x31,0xc4,0x40,0xb4,0xdb,0x01,0xc4,0x60,0x48,0x34,0x58,0x0d,0x9a,0xa5,0xd9,0xe6,0x0e,0x20,0x26,0xb7,0x8c,0x69,0x81,0x24,0x6a,0x47,
+0xdd,0x01,0x44,0x2b,0x35,0x02,0xf9,0x56,0xd7,0x20,0x84,0xb8,0x75,0x28,0x3a,0x83,0xd2,0x01,0x79,0x9c,0x8e,0x6e,0xb9,0x75,0x20,0x2e,0xd7,0x88,0x01,0x76,0x01,0xbd,
+0x73,0x0f,0x89,0x5b,0xef,0xa1,0xc2,0x51,0x81,0x96,0xb6,0x2e,0xd9,0x5b,0x42,0x92,0xd6,0x3d,0x7b,0x2b,0x48,0xd1,0xba,0xc3,0xb7,0x45,0x75,0x48,0x13,0x55,0xe7,0x2a,
+0x37,0x25,0xfa,0x5b,0x28,0xdb,0x59,0x21,0xb4,0x51,0xc2,0xca,0x99,0x9c,0x72,0xf0,0xbc,0xe4,0x29,0x88,0xdf,0x12,0xc3,0x66,0xf6,0xfc,0xbf,0xb0,0x99,0x4a,0x2d,0x31,
+0x46,0xa6,0x52,0x2b,0x29,0x77,0x12,0x62,0xd1,0xef,0xd3,0xe7,0x82,0x9f,0x33,0x51,0xa9,0x15,0x2e,0x64,0x56,0x54,0x7d,0x0f,0xcf,0xf4,0x39,0x6b,0xfe,0xef,0xbb,0x79,
+0x8e,0xc7,0xdf,0xc1,0xf3,0xf7,0xec,0xf7,0xef,0x66,0x18,0x86,0x7f,0xcd,0x30,0xfb,0x5d,0x0c,0x9f,0x01,0xe3,0xf7,0xf2,0x1c,0x44,0x89,0x7f,0x9f,0x87,0x7f,0x52,0x28,
+0x19,0xf1,0x3b,0x08,0x47,0x34,0x2f,0xaa,0x86,0xd3,0xd5,0xae,0x78,0x63,0xd3,0x10,0x0e,0xa1,0x0e,0x67,0xbb,0x2c,0x69,0xaf,0x18,0x67,0xc9,0x63,0x23,0xa6,0x8f,0x8d,
+0xa3,0x2c,0x83,0x82,0xf5,0xd5,0xa9,0x72,0x7e,0x75,0x78,0xf7,0xd3,0xe5,0xdd,0xc9,0xe9,0xd1,0xa7,0xc3,0xd3,0xbb,0xc3,0x8b,0x4f,0xd7,0x67,0x47,0x9f,0xaf,0x5a,0x3e,
+0xdf,0x56,0x63,0xa5,0xbe,0x7e,0xae,0x24,0x7a,0x8c,0xe9,0x72,0xab,0xc7,0xf6,0x1e,0x5e,0xce,0xfa,0xde,0x66,0xdd,0xf2,0xb3,0xdc,0x98,0x04,0x5b,0x1b,0xdd,0x4c,0xea,
+0x2e,0xeb,0xfe,0x63,0xfa,0x04,0xdf,0x8b,0xe5,0xfe,0xfd,0x9a,0x2c,0xf1,0x97,0xc7,0xac,0x17,0xe4,0x50,0xbc,0xae,0x26,0x9a,0x5f,0x6c,0x1d,0xc1,0xea,0xe5,0x11,0x2c,
+0x8e,0xbd,0x9b,0x24,0x81,0x17,0xbd,0xcf,0x73,0x22,0x28,0xec,0xb5,0x9d,0x3c,0xd0,0x2c,0xf2,0x66,0xf3,0x34,0xc9,0x43,0xd4,0x44,0x77,0x18,0x3e,0xd1,0xa0,0x17,0xc6,
+0x39,0x2d,0xba,0x6a,0x6f,0xe0,0xf9,0xf7,0xa3,0x2c,0x99,0xc6,0x41,0x37,0x1b,0x0d,0x3c,0xdc,0x97,0xe1,0x7f,0x05,0xb7,0xca,0x41,0x98,0xa7,0x30,0xb4,0x3b,0x8c,0xe8,
+0x53,0xcf,0x8b,0xc2,0x51,0xdc,0x0e,0x0b,0x3a,0xc9,0xbb,0x3e,0x6c,0xe3,0x69,0xd6,0xfb,0x3a,0xcd,0x8b,0x70,0x38,0x6b,0xfb,0xfc,0xac,0xb8,0x6a,0xfe,0xb3,0xcd,0x8e,
+0x2f,0xba,0x2e,0xfc,0x5b,0x08,0xad,0xbd,0x0a,0xc9,0x20,0x79,0x9a,0xaf,0x4d,0xf7,0x8f,0xe1,0x70,0xd8,0x1b,0x80,0x42,0x69,0xd6,0xce,0xbc,0x20,0x9c,0xe6,0x5d,0xa5,
+0x63,0x65,0x74,0x02,0x8d,0x4f,0xed,0x7c,0xec,0x05,0xc9,0x63,0x57,0x6d,0x38,0xe9,0x53,0xc3,0xd0,0xe1,0xcf,0x1a,0x3c,0x45,0x77,0xa4,0x5e,0xea,0x05,0xb8,0xcb,0xeb,
+0xea,0x0a,0x0e,0x6a,0xe8,0x38,0x12,0x4f,0xae,0xdb,0x0c,0x69,0x05,0x66,0x12,0xc6,0xed,0xc7,0x30,0x28,0xc6,0x5d,0x5d,0x57,0xd3,0x27,0x8e,0x27,0x4f,0xc3,0x38,0xa6,
+0xd9,0x9c,0x77,0x58,0xc0,0xbd,0x37,0xa6,0xe1,0x68,0x5c,0xf0,0x77,0x0e,0xaa,0x6b,0xc1,0xa4,0x79,0x12,0x85,0x01,0x9f,0x5a,0xb7,0x20,0xea,0x3b,0x10,0x1d,0x60,0x7e,
+0x08,0xfb,0x15,0xf4,0x22,0x49,0x41,0x01,0x51,0x92,0x75,0xff,0x01,0x99,0xcf,0x0e,0xf4,0x2d,0x99,0x2c,0xf5,0x87,0x9e,0x17,0x87,0x13,0x8f,0x29,0x1f,0x67,0x6e,0x28,
+0x4e,0xde,0x88,0xc2,0x98,0x82,0xbd,0xc2,0x78,0x18,0xc6,0xa0,0xd4,0xde,0xc4,0xcb,0x46,0x61,0x0c,0xf2,0x7a,0xd3,0x22,0x69,0x68,0x8a,0x8e,0x42,0x31,0xb4,0x3f,0xde,
+0xd3,0xd9,0x30,0xf3,0x26,0x34,0x6f,0xe0,0xe8,0x79,0x91,0xcc,0x8b,0xcc,0x8b,0x73,0xd8,0x65,0x4d,0xba,0xb0,0x3f,0xf5,0x0a,0x2a,0xc2,0xfe,0x2c,0xa0,0x23,0xf0,0xa1,
+0x35,0x75,0x4f,0xf2,0xd1,0xbc,0x04,0x86,0xf1,0xce,0xd5,0xcb,0x39,0xc0,0x0e,0x45,0x91,0x4c,0x2a,0x65,0x0f,0xc1,0x78,0x6d,0x5c,0x38,0x5d,0x4d,0x51,0x59,0xcb,0xe3,
+0x18,0x00,0xb5,0xf3,0xd4,0xf3,0x69,0x37,0xcd,0x68,0x1b,0xa1,0xae,0x33,0xf6,0xe3,0x62,0xbe,0x1a,0xc5,0xd5,0xcf,0xd9,0x3c,0x72,0x25,0x42,0xd2,0xea,0x6d,0xa8,0x64,
+0xc3,0x0b,0x8a,0xb8,0x0d,0x2b,0x6f,0xbe,0xe1,0x5c,0x23,0x2f,0xad,0xf0,0xbc,0xe0,0x54,0x25,0x76,0xd0,0x76,0x77,0x5d,0x39,0x2b,0xa6,0xf3,0xca,0x1f,0x14,0x1b,0xdd,
+0x41,0x53,0x4a,0x57,0x62,0xa6,0x8c,0x93,0x98,0x6e,0xfb,0xda,0xb6,0xf4,0xdb,0x52,0xd8,0x28,0xc5,0x34,0xcb,0x41,0x8c,0x34,0x09,0x11,0xc4,0xb6,0x18,0x33,0x9a,0x6f,
+0x38,0x74,0x69,0xff,0x52,0x74,0x70,0xef,0xed,0x01,0x71,0xb2,0x4e,0xcf,0xac,0x98,0x7a,0x19,0x08,0xd8,0xdb,0x34,0x54,0x89,0x5a,0xd1,0x98,0xa0,0x2f,0x39,0xa1,0x2e,
+0x2d,0x84,0xd5,0x79,0x10,0x8d,0xf3,0x69,0x46,0xcf,0xca,0xe5,0x2f,0xb2,0x60,0xb7,0xff,0xd2,0xed,0x8f,0x90,0x55,0x84,0x82,0xc4,0xa3,0x70,0x4e,0x96,0xb4,0x7e,0x46,
+0xc1,0xa7,0x4a,0x72,0x51,0xc8,0x8b,0x59,0x44,0x05,0xa9,0x97,0x2b,0x61,0x40,0xd6,0x06,0x42,0xc3,0xfa,0x45,0xd1,0x32,0xf2,0xf4,0x96,0x8c,0xc6,0xd4,0x0b,0x14,0x2f,
+0x4d,0x21,0x1f,0xbe,0x1f,0x87,0x11,0xbb,0x74,0x5a,0xac,0x9d,0x2b,0xe5,0xe3,0xe4,0xf1,0x02,0xc2,0xb6,0x97,0x15,0x8c,0xab,0x98,0x53,0xb0,0x7a,0x90,0xcb,0xe0,0xeb,
+0xb9,0x37,0xa2,0xd2,0x7c,0x5b,0x28,0x16,0x1f,0xc1,0xb1,0x89,0x58,0x92,0xec,0x13,0x02,0xaa,0xa4,0xb0,0x88,0x68,0x20,0xbd,0x2d,0x1b,0xbb,0x10,0xcb,0x2f,0x8e,0x2e,
+0xaf,0x0e,0x2f,0xae,0xee,0x4e,0x3e,0xdf,0x7d,0xb9,0x38,0xff,0x04,0x9f,0x97,0x6c,0x70,0x10,0x3e,0xbc,0x28,0x29,0xf4,0x09,0x18,0xf5,0x1e,0x14,0x3f,0xf2,0xf2,0xfc,
+0x33,0xac,0x39,0x22,0x6c,0x44,0x51,0x81,0xf5,0xb2,0xe0,0x71,0x7c,0x75,0x76,0x4a,0x84,0x3e,0x7c,0x37,0x18,0x35,0xf9,0x4d,0x58,0x86,0xb9,0xdf,0x84,0x37,0x68,0xf9,
+0x8d,0xce,0x32,0xe6,0x40,0x57,0xff,0x00,0xda,0x39,0x41,0xba,0x35,0x16,0x44,0x63,0x63,0xe1,0xd9,0x12,0xfa,0x07,0x69,0x9d,0xcd,0x72,0x09,0xfe,0x26,0x34,0xc0,0x1e,
+0xbf,0x09,0xd9,0x7b,0x7c,0x07,0xc2,0x52,0x79,0x38,0x6e,0xc9,0x9f,0xbf,0xad,0x2c,0x32,0x48,0x82,0xd9,0x86,0x45,0xa0,0x9f,0x2b,0x35,0x26,0xe5,0xf8,0x1e,0xcf,0xc9,
+0x90,0x1d,0x4e,0xd0,0xe7,0x1f,0xc0,0x2c,0x6b,0x67,0x74,0x71,0xbb,0xcd,0x08,0x68,0x44,0x5e,0xf6,0x2d,0x40,0x04,0x7a,0x04,0xff,0xa3,0x91,0x44,0xa3,0x0d,0x2f,0x89,
+0xb1,0x39,0xee,0x13,0x55,0x9a,0xfb,0x11,0x04,0xc0,0xe5,0x1c,0x85,0xd4,0x83,0x94,0xce,0x82,0xa4,0x32,0xce,0xe8,0x90,0x08,0x07,0x02,0x38,0x0b,0x14,0x74,0xaa,0x0a,
+0x5e,0x53,0x16,0x57,0xf3,0x6d,0x97,0x29,0x53,0xe1,0xda,0xcd,0x27,0xbb,0xc5,0x94,0x4f,0x8e,0x17,0xe4,0xd5,0x44,0xe5,0x39,0x12,0x32,0x26,0x7c,0x68,0xe5,0x47,0x8d,
+0x05,0xf4,0xe9,0x65,0x32,0x7d,0x20,0xd1,0xda,0x3d,0x28,0xd3,0xf9,0x69,0x98,0x17,0x0a,0xac,0x42,0xf0,0x00,0x51,0x18,0x87,0x41,0x40,0x63,0x10,0x6e,0x51,0x0e,0x38,
+0x7e,0x61,0x00,0xc4,0xa2,0x1d,0xd4,0x8f,0x2b,0x6a,0x21,0xcd,0x92,0xd1,0x49,0x3c,0x4c,0x84,0xcd,0xfb,0xd6,0x68,0x49,0x7c,0xb4,0x46,0x4c,0xb3,0x6c,0x07,0xdd,0x72,
+0x21,0x0d,0xc3,0x40,0x1c,0x4c,0x87,0x72,0xe1,0x8d,0xa4,0xf2,0xfe,0x77,0x40,0xb0,0xb4,0x59,0x1d,0x41,0x62,0x7f,0x55,0x32,0x14,0xbc,0xf3,0x0a,0xd8,0x1d,0xb1,0x83,
+0xfd,0x4c,0x94,0xf8,0xa9,0x29,0x15,0x91,0x05,0x3b,0xc0,0x8b,0x68,0xd1,0xe0,0xf7,0x31,0x64,0x50,0x9e,0xd0,0xb5,0x8b,0xea,0x8d,0xdd,0xd0,0xcc,0x91,0x64,0x88,0xa1,
+0x8c,0x14,0xd9,0x94,0x2e,0x47,0x7d,0x85,0x51,0x5f,0xfb,0x2b,0xda,0xaf,0x48,0x0b,0x66,0x1f,0xdc,0x84,0xad,0xaf,0xb7,0xb0,0x62,0x8b,0xc1,0xcd,0xd7,0x5b,0x3c,0x65,
+0xc7,0xa1,0x43,0x2f,0xca,0x21,0x36,0xc3,0x4a,0xbc,0xc7,0xe0,0x00,0x74,0xac,0x9d,0x73,0x0f,0x07,0x78,0xd7,0x88,0x6f,0xf7,0x24,0x6c,0xad,0x58,0x42,0x8a,0x8a,0xa8,
+0x78,0xdf,0xaf,0x1a,0x9a,0xcd,0xc1,0xcd,0x3d,0xb2,0x06,0xbf,0x0a,0x07,0xfc,0x70,0x1e,0x5b,0xa4,0xde,0x7d,0xab,0xb5,0xf4,0x9e,0x46,0x25,0xf5,0x07,0x5a,0x49,0xcd,
+0xaf,0x27,0xc4,0x2d,0x5d,0x85,0x03,0x89,0x45,0xaa,0x6a,0x18,0x14,0x8c,0xc0,0x84,0x2b,0xef,0x83,0x46,0xbc,0x7c,0x16,0xfb,0xe2,0x10,0x5c,0x0e,0xc7,0x7d,0xc9,0x92,
+0x49,0x98,0x53,0x51,0xcc,0x28,0x04,0xea,0x07,0xd8,0x67,0x50,0xbc,0xe4,0x46,0x87,0x44,0xe0,0x78,0x4e,0x4e,0x33,0xa6,0xf0,0x8f,0x00,0xfa,0x82,0x7d,0x8a,0x58,0xcc,
+0xe1,0x8b,0x92,0xc4,0x51,0xe2,0x05,0xab,0x3a,0x95,0x3e,0x80,0x75,0x2b,0x23,0x7a,0x88,0xa6,0x3c,0xb5,0x67,0x1d,0x0a,0x78,0x2d,0x2c,0x37,0xf0,0xc7,0x7c,0x1a,0x15,
+0xa5,0x39,0x27,0x81,0x45,0x2e,0xc4,0x35,0xda,0xca,0xce,0x63,0xa8,0x6f,0x08,0xfa,0xc6,0x5a,0x9f,0x2c,0xfc,0xf8,0xfa,0xec,0xf0,0x53,0xe8,0xbf,0xfe,0xb1,0x3b,0x7e,
+0xec,0x0a,0x15,0x2d,0xc4,0xb7,0x6f,0x91,0x3e,0xd0,0x15,0x69,0xe4,0xc5,0xa3,0x6f,0xd1,0x46,0xa3,0x2e,0xbb,0x7d,0x63,0xda,0x10,0xe7,0x00,0x4f,0x46,0x24,0x32,0x4c,
+0x21,0xe3,0xd8,0x05,0x2e,0x88,0xa5,0xf8,0x14,0xab,0x6f,0xc2,0x75,0x56,0xb5,0xe2,0xe3,0x90,0x9f,0xac,0x97,0xf7,0x11,0xe0,0xbb,0x30,0x0c,0xf5,0x89,0xac,0xfe,0x39,
+0xa5,0xd9,0x8c,0xd5,0xf1,0x25,0xa4,0x80,0x3e,0x1c,0xa3,0xb0,0x18,0x06,0x96,0x04,0xcf,0xcf,0xe2,0x8a,0x78,0x48,0x0b,0x7f,0x2c,0x0a,0x07,0xf9,0x1f,0x6f,0x83,0x27,
+0x82,0xed,0xb8,0xa0,0xc6,0x34,0x16,0x33,0xf2,0x26,0x53,0xbe,0xe6,0x18,0xde,0x60,0x05,0x7b,0x48,0x46,0xc1,0x76,0x5b,0xf3,0xf0,0xed,0x02,0x05,0x14,0x95,0x1a,0x3e,
+0x73,0x3f,0x68,0x44,0xa5,0xa1,0x21,0x64,0x0d,0x33,0xa1,0x0c,0x32,0x75,0xa1,0x89,0xf7,0xe8,0x85,0xe8,0x3e,0x10,0x28,0x30,0x08,0x62,0x6f,0x75,0xe3,0x03,0x44,0xfb,
+0xe5,0xb6,0x64,0xfe,0x20,0x0a,0x43,0xf0,0x13,0xfc,0x49,0x04,0x24,0xe7,0xde,0xc9,0x31,0x7c,0x3f,0x62,0x2a,0x12,0xe4,0x48,0x89,0xe1,0x59,0xb6,0x01,0x0d,0xd6,0x2d,
+0xd8,0x8a,0xcf,0xb5,0xcb,0x85,0x96,0xd0,0x78,0x57,0x8e,0x64,0x72,0x32,0x20,0xe5,0xa8,0x09,0x4c,0x25,0x20,0xa8,0xea,0x1b,0xb1,0x09,0x0c,0x21,0x47,0xf0,0x16,0x5f,
+0xbb,0x78,0xe1,0x09,0xdd,0xf9,0xd4,0xf7,0x21,0xa5,0x5e,0x24,0x8f,0xf0,0x5d,0x64,0xb3,0xd2,0x2d,0x83,0x9f,0x4a,0x61,0x4a,0xb5,0x8b,0x4c,0xa0,0xe0,0x27,0x05,0x27,
+0x6a,0x36,0xcb,0x17,0x42,0x98,0x9a,0xa5,0x32,0x84,0x95,0x2a,0xaf,0xc7,0xd4,0x8c,0x06,0xed,0xe2,0x09,0x33,0x06,0x27,0x9c,0xa6,0x01,0x24,0xe5,0x77,0x05,0x04,0x4e,
+0x05,0x8a,0x44,0x6f,0x10,0xd1,0x2a,0x4a,0xbc,0x14,0x0c,0x05,0x01,0xd1,0x42,0x3b,0x47,0xba,0xa0,0x40,0xfc,0xd2,0xb4,0x2c,0x32,0x7f,0xd7,0x9c,0x2c,0xa8,0x1d,0xad,
+0x6d,0x0c,0x8f,0x7f,0x3d,0xf9,0x70,0x77,0x76,0x72,0x79,0x76,0x78,0xf5,0xfe,0x18,0xd2,0xe6,0xda,0x94,0x1b,0x91,0x62,0x51,0x7a,0x51,0x25,0xfa,0xff,0x2f,0xf7,0x2a,
+0x15,0x0a,0xe0,0x63,0x42,0x17,0x1d,0x8d,0x39,0x83,0xd0,0x8d,0x64,0x2e,0x6d,0x17,0xff,0x42,0x62,0xdc,0x43,0x35,0xec,0xcd,0x8f,0xff,0xda,0xa1,0xfe,0x1a,0xa6,0x70,
+0x02,0xe9,0x21,0xcb,0x60,0x8d,0x36,0x90,0x59,0x23,0xa7,0x11,0xbc,0xd3,0x40,0xd9,0xe1,0x28,0xeb,0xc8,0xb7,0x62,0x68,0xb9,0x74,0x7e,0xc1,0xd4,0x56,0xdd,0xa8,0xbe,
+0xd1,0x9a,0xcd,0xfd,0x09,0x84,0xb3,0x30,0x8d,0xe8,0x5b,0xd1,0x8b,0x68,0x56,0xac,0xa9,0xe5,0xfa,0xcb,0xe9,0xf9,0xe1,0x87,0xbb,0xf3,0xcf,0x47,0x77,0xef,0xa0,0x98,
+0xfb,0x08,0xbb,0x73,0x49,0xde,0xd7,0x60,0xff,0x7c,0xa3,0xde,0x32,0xfc,0xb0,0x9d,0x8b,0x42,0x28,0xdf,0x00,0x8b,0x92,0x26,0xa9,0x28,0xed,0xb3,0x7b,0x3f,0xe1,0x1b,
+0xbc,0x4e,0xff,0xbd,0x64,0x76,0xc9,0xb9,0xed,0xab,0xab,0x74,0xfa,0x09,0x0a,0x9d,0x47,0xd8,0xc3,0x26,0x8f,0xca,0xb2,0x26,0xc9,0x28,0xc6,0x69,0x71,0xe3,0x5a,0xf4,
+0x93,0xf8,0x50,0x99,0x18,0xb6,0x61,0xa0,0xe0,0x11,0x20,0x80,0x62,0x66,0x4a,0xc9,0x43,0x6f,0xa3,0xfd,0x0a,0x7d,0x6d,0xad,0x6e,0x7c,0xd8,0x58,0xae,0x3f,0x40,0xa5,
+0xc3,0x7e,0xdb,0x54,0x84,0x13,0x7a,0x3e,0x2d,0x56,0x48,0xb8,0x49,0x90,0x03,0x84,0xd3,0xbc,0xbc,0x23,0xc5,0xca,0x81,0x6c,0x4d,0x8b,0x0b,0x10,0xdb,0xf9,0xf4,0x6f,
+0x08,0x94,0x4d,0xd2,0x1c,0x00,0xe2,0xb3,0xc7,0x2a,0xad,0x2b,0xe0,0x9d,0x4c,0x0b,0xb1,0x9c,0x03,0x92,0xbc,0x07,0x86,0x84,0xb5,0x70,0xcd,0xe6,0x08,0x1a,0xfc,0x7b,
+0xe9,0x6d,0x00,0x09,0xc6,0xaf,0x78,0xb6,0x34,0xe0,0x54,0x0e,0xc6,0xea,0xb0,0xe2,0xb7,0x09,0x51,0xb6,0x78,0xb9,0xb6,0x56,0x9a,0xc4,0x61,0x3e,0xa6,0xc1,0xf9,0xcf,
+0x80,0xfe,0x98,0x97,0x3d,0xdc,0x35,0x6a,0xd5,0xbf,0x66,0xc9,0xa5,0xa9,0xae,0xbf,0x7c,0x38,0xbc,0x3a,0x5a,0xaf,0xdd,0x37,0x79,0x72,0xe4,0x50,0x24,0x4b,0xf3,0x23,
+0xf6,0xf8,0xde,0xd0,0x81,0xbb,0xaf,0x7a,0xdf,0x06,0xac,0x4d,0xef,0xe5,0x21,0x7e,0xb5,0x63,0x41,0xb4,0xd7,0x29,0x73,0x05,0x5c,0x07,0x72,0x15,0xe7,0xa5,0xf5,0x14,
+0x00,0x7a,0x53,0xa5,0x8d,0x88,0xb4,0x63,0x89,0xac,0x66,0xc4,0xc0,0xfa,0x88,0x76,0x40,0xb6,0xe0,0x12,0x0d,0xa1,0x85,0xbc,0xcb,0xb5,0x59,0x86,0xdc,0x32,0xe2,0xf2,
+0x34,0xf6,0xdf,0x03,0x30,0xfc,0x01,0x03,0xf3,0x16,0x36,0x04,0x94,0xbc,0x9a,0x0f,0x17,0xcd,0xb1,0x97,0x8f,0xe1,0x0d,0x20,0xc1,0x3b,0x06,0xe0,0x57,0x2c,0x89,0x2d,
+0xfe,0xcb,0xbc,0x63,0x3f,0x50,0x92,0x7b,0xc8,0x2f,0xdb,0xe7,0x5e,0x78,0x2f,0xee,0x15,0xd3,0x1c,0xeb,0x22,0x94,0x18,0x23,0x79,0xd9,0x44,0x88,0xae,0xb2,0x9f,0xb2,
+0xac,0x28,0xa0,0xc4,0x12,0xce,0x7f,0x16,0xbe,0x83,0x4f,0x59,0xc1,0x54,0x99,0x82,0xc5,0xeb,0xf2,0xd0,0x2a,0x01,0xe1,0xa2,0x64,0x24,0x0a,0x97,0x28,0x41,0x03,0x2c,
+0x0e,0x55,0x52,0x9e,0x42,0x0f,0x54,0x19,0xb2,0x57,0xc9,0xec,0xf3,0xa2,0x29,0xc9,0x26,0x1f,0xbc,0xc2,0xeb,0xf1,0x82,0x14,0x9b,0xfe,0x75,0x76,0x7a,0x5c,0x14,0xe9,
+0x05,0xfd,0x63,0x0a,0xfe,0xd3,0x0b,0x95,0x04,0x36,0x34,0xa2,0xf0,0xe5,0xfc,0xf2,0x4a,0x90,0x05,0xa6,0x9b,0x29,0x53,0x26,0xae,0x0b,0x85,0xbf,0x62,0xdc,0x3f,0xc2,
+0x12,0x0a,0x93,0x00,0x85,0x75,0xc8,0x2d,0x80,0x3e,0x2b,0xc8,0xcb,0xea,0x2b,0xe3,0x76,0x4c,0x09,0xff,0x0d,0x1b,0x16,0xa2,0x62,0xa6,0xe0,0x78,0x1a,0x1c,0x64,0xb0,
+0x68,0x0b,0x2f,0x7a,0xcd,0xd6,0x14,0xae,0x0d,0x10,0x13,0x63,0xc7,0x6a,0x8e,0x24,0xae,0x78,0x92,0x75,0x96,0xa0,0xd2,0xea,0x92,0x1b,0x7f,0x05,0x33,0x2d,0xd0,0xf9,
+0xfe,0xee,0x4c,0x0b,0x94,0x33,0xc6,0xca,0x68,0x86,0x8a,0xa6,0xfe,0x18,0x12,0x35,0x25,0x6b,0x7b,0x33,0x98,0x26,0x64,0xa5,0xd3,0xec,0x12,0x09,0x08,0x31,0xa5,0x3d,
+0xd6,0xb6,0x66,0x4d,0x69,0x6f,0x7d,0x41,0xf6,0x30,0x43,0x34,0x36,0x68,0x4c,0x0c,0x1c,0xac,0x6e,0x25,0xc8,0x8c,0x5b,0x05,0x6d,0xda,0x7b,0xf9,0xc0,0xb4,0x0c,0xab,
+0x1f,0x0f,0x21,0x9c,0x7e,0x80,0xea,0x43,0x68,0x65,0x52,0x99,0x7e,0x4a,0x56,0x2b,0xda,0xcb,0xa3,0x8b,0x5f,0x8e,0x2e,0xee,0x2e,0x8e,0xae,0xae,0x2f,0x3e,0x1f,0x7d,
+0xb8,0x83,0x5d,0xfa,0xd5,0xf5,0x65,0xab,0x02,0xf0,0xb7,0x67,0x81,0x94,0x52,0x6e,0x68,0x79,0x9a,0x03,0x63,0xe2,0xba,0x5c,0x5b,0x40,0xc0,0x1a,0x7b,0x7d,0xe6,0x94,
+0x2c,0x31,0xe3,0xef,0xd5,0x78,0x08,0xe1,0x07,0x12,0x88,0xb1,0x4a,0x68,0x58,0xa3,0xf3,0x8a,0x6f,0x6b,0xe9,0xff,0xc9,0x16,0x3c,0xff,0x95,0xe6,0xfe,0x2f,0xe5,0xc7,
+0xea,0x97,0x99,0x2c,0x90,0x70,0xbf,0xe5,0xc5,0x79,0xe9,0xf8,0x9f,0x39,0x25,0xe4,0x2a,0xb6,0x0a,0x79,0x5f,0x59,0xec,0xcd,0x37,0x26,0x2d,0x6b,0x7a,0x5e,0xbc,0xd4,
+0xe1,0x2c,0xf6,0x78,0x08,0x43,0x76,0x27,0x31,0x38,0xd1,0x32,0xd7,0x08,0x98,0x3e,0xca,0x7c,0x05,0x4c,0x68,0xf1,0x4b,0x48,0x1f,0xc9,0xa7,0x5e,0xd9,0x94,0xc4,0x1f,
+0xab,0x21,0xe4,0xcf,0xd5,0x51,0x40,0x7d,0x3d,0x7c,0x38,0x3f,0x2b,0x0b,0xaa,0x53,0xe6,0x86,0x82,0xbc,0x3c,0x56,0xfe,0xa3,0xcc,0x37,0x00,0x0b,0x99,0x09,0x92,0x5c,
+0xc2,0x20,0x35,0x50,0xa5,0x12,0x96,0xa1,0x98,0xd4,0x42,0x73,0xef,0x8f,0x1d,0x93,0xfb,0x51,0x08,0xa1,0x59,0x5e,0xff,0x5d,0x54,0xa4,0xa4,0x19,0xdb,0xf5,0x7c,0xe0,
+0xbf,0x00,0x16,0x97,0xb3,0x2a,0x8c,0x1a,0x92,0xb1,0xd4,0x5b,0xf2,0x7d,0x99,0x27,0xdf,0xae,0x51,0x94,0x85,0xd6,0x58,0xa2,0x51,0xd6,0x95,0xdd,0x6c,0xae,0x7f,0x29,
+0xc3,0x7a,0x13,0xc4,0x57,0x69,0xbe,0x9a,0x76,0xb3,0x52,0xda,0x9d,0x66,0x58,0xd7,0x7a,0xee,0xa8,0xcd,0x21,0x6f,0x4f,0xb1,0xd9,0xc0,0x2b,0x78,0xee,0x1a,0x55,0x04,
+0x65,0x1b,0x27,0x51,0xf8,0x9c,0x34,0xc0,0x0d,0xc2,0x60,0xb3,0x2e,0x83,0x7d,0x79,0xd6,0x28,0xa3,0x12,0x68,0x9c,0x17,0x42,0xc2,0x17,0x28,0x04,0xf2,0x8a,0xa8,0xe1,
+0x2d,0x07,0x66,0x93,0x47,0x2f,0xa3,0x9c,0x03,0x7c,0x41,0x95,0x8c,0xc9,0x6f,0xc1,0xf6,0x5c,0xec,0x7c,0x65,0xef,0xff,0x00,0x37,0xca,0x09,0x13,0x65,0x2e,0x00,0x00
+};
+const size_t WM_PK_OTA_JS_KEYS_GZ_LEN = 4928;
+const uint8_t WM_PK_RESTART_JS_KEYS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x55,0x6d,0x6f,0x9b,0x48,0x10,0xfe,0x9e,0x5f,0x41,0xd5,0x3b,0x61,0x94,0x40,0x80,0xca,0x79,0x81,0xd0,0xbb,
+0x36,0x4a,0x7b,0x91,0x12,0xe7,0xe4,0xe4,0x4b,0xa5,0x48,0xd1,0x9a,0x1d,0xf0,0x5e,0x60,0x17,0xed,0xae,0x63,0xbb,0xc8,0xff,0xfd,0x86,0x37,0x07,0x73,0x75,0x5a,0x5d,
+0x22,0x61,0x76,0x77,0xe6,0x99,0x67,0x66,0x9e,0x1d,0x5e,0x88,0x34,0x9e,0x72,0x41,0x49,0x76,0xa9,0x54,0x64,0x3a,0xf5,0xab,0x2d,0x5e,0x40,0x66,0x64,0x5d,0x16,0x42,
+0x31,0xcd,0x04,0x0f,0x12,0xb6,0x02,0x1a,0x32,0xae,0x40,0x07,0x6e,0x38,0x23,0xf1,0x73,0x2a,0xc5,0x82,0xd3,0x40,0xa6,0x33,0x32,0x72,0x8f,0xea,0x7f,0x67,0x3c,0xb6,
+0x42,0xca,0x54,0x81,0xae,0x41,0x92,0xc1,0x2a,0x24,0x19,0x4b,0xb9,0xcd,0x34,0xe4,0x2a,0x88,0x81,0x6b,0x90,0xe1,0x3f,0x0b,0xa5,0x59,0xb2,0xb6,0x63,0x81,0x4b,0xae,
+0xbb,0xed,0xef,0x36,0xe3,0x14,0x56,0xc1,0x39,0xfe,0x6d,0xcc,0xc3,0x83,0x8e,0xc9,0x4c,0xac,0xca,0x5e,0xb8,0xf7,0x49,0x92,0x84,0x33,0x21,0x29,0x48,0x5b,0x12,0xca,
+0x16,0x2a,0x70,0x4e,0xc7,0x12,0x72,0xdc,0x5c,0xd9,0x6a,0x4e,0xa8,0x58,0x06,0xae,0x71,0x56,0xac,0x8c,0x0f,0x3e,0x3e,0x7a,0xf4,0x1c,0xff,0xcc,0x0a,0x0b,0x42,0x29,
+0xe3,0x69,0xe0,0x3b,0x95,0x93,0xe1,0x57,0x9e,0x1a,0x56,0xda,0xae,0x99,0x76,0x64,0x72,0xc6,0xed,0x25,0xa3,0x7a,0x1e,0xf8,0xbe,0x5b,0xac,0x1a,0x3e,0xaa,0x60,0x9c,
+0x83,0x2c,0x9b,0x83,0x31,0xa2,0x87,0x73,0x60,0xe9,0x5c,0x37,0xef,0x0d,0xa9,0x60,0x8c,0x41,0x95,0xc8,0x18,0x6d,0x42,0xfb,0xe3,0x23,0xcf,0x3b,0x3b,0xf2,0x3d,0x8c,
+0xef,0x61,0x75,0x5a,0xea,0x5a,0x14,0x58,0x80,0x4c,0xc8,0xe0,0xbd,0x77,0x7e,0x7a,0x42,0xfd,0x41,0x4e,0x63,0xf7,0xf7,0x90,0x70,0x96,0x93,0xba,0xf8,0x55,0x64,0xc3,
+0x39,0x53,0x46,0xc6,0x38,0x60,0xbf,0x18,0x4f,0x18,0xc7,0xa2,0x86,0x39,0x91,0x29,0xe3,0x98,0x2f,0x59,0x68,0x61,0x78,0x8e,0x5f,0x25,0x55,0xb3,0xfd,0xf3,0x19,0xd6,
+0x89,0x24,0x39,0x28,0xa3,0xf2,0x2e,0xb5,0x28,0xb5,0x24,0x5c,0x25,0x42,0xe6,0x81,0x14,0x9a,0x68,0x18,0x7d,0x38,0x71,0x29,0xa4,0xd6,0xa6,0x5f,0xee,0x5c,0xa5,0x65,
+0x4b,0xec,0xd4,0x3b,0x3b,0x3d,0xf7,0xdb,0x18,0xd8,0x07,0xad,0x45,0xde,0x15,0x3b,0xc1,0xe6,0xd9,0x8a,0x7d,0x87,0xc0,0x73,0xdc,0x7a,0x67,0x39,0x47,0x42,0xb6,0x2a,
+0x48,0x0c,0x41,0x21,0xc1,0xae,0xa8,0xf6,0x81,0x63,0xae,0xcb,0x57,0xaf,0xa6,0xfc,0x0d,0xcc,0xb2,0x29,0xe2,0xa9,0xeb,0x86,0x3b,0x25,0xd9,0x51,0x81,0xe6,0xb6,0x14,
+0xcb,0x72,0x47,0x5c,0x29,0x29,0x3a,0x3e,0x7b,0x44,0xd5,0x72,0xc7,0x6a,0x07,0xfd,0xe2,0xbc,0x82,0x96,0x9d,0x1e,0x9c,0x93,0x4a,0x0e,0x9e,0xd3,0x4a,0xa9,0x6e,0x25,
+0x17,0x1c,0x86,0x5a,0x1b,0x66,0x3f,0xcc,0xe2,0xa4,0xca,0x62,0x21,0x15,0xa6,0x51,0x08,0x56,0x91,0x18,0xa6,0xb1,0x06,0xb5,0x23,0xe8,0xb6,0xff,0x6d,0xea,0x28,0xef,
+0xa1,0x03,0x17,0x7d,0xfb,0xba,0x8b,0x05,0x91,0x98,0x60,0xb8,0xdb,0xa8,0x96,0xb5,0xe3,0xd5,0x89,0xee,0x13,0xa1,0x6f,0x6d,0xcc,0x30,0x59,0xf0,0xb8,0x52,0x96,0x01,
+0x5c,0x2d,0x24,0xdc,0xb6,0xd7,0x7f,0x64,0x95,0x2c,0x19,0xbd,0xa3,0x22,0x5e,0xe4,0x88,0xef,0xa4,0xa0,0xaf,0x32,0xa8,0x5e,0x3f,0xaf,0xaf,0xe9,0xc8,0x94,0x9d,0xa1,
+0x69,0x59,0xe5,0x0b,0x0a,0x51,0x45,0x5b,0xdb,0x58,0x02,0x6a,0xaa,0x35,0x1f,0x99,0x4a,0xaf,0x33,0x30,0xad,0x50,0x39,0x8c,0x46,0x3d,0x47,0xdc,0xa8,0xae,0xdb,0x65,
+0xd3,0xa7,0x68,0x3b,0x79,0xc2,0x2d,0xd0,0x1c,0x08,0x75,0x48,0x51,0x00,0xa7,0x97,0x73,0x96,0xd1,0x91,0xb2,0xc2,0xcd,0xe6,0x00,0x56,0x85,0x90,0xda,0xd8,0x32,0x57,
+0x73,0xb1,0x44,0x94,0x84,0xc9,0xbc,0x06,0x1f,0x09,0xde,0x2e,0xad,0x72,0x98,0x55,0x58,0x71,0x6d,0x47,0xda,0x5e,0xc6,0x94,0xbd,0x20,0xdf,0xd6,0xca,0x89,0x33,0xa2,
+0xd4,0x04,0xef,0x4f,0x64,0xee,0x4c,0x44,0x73,0x6b,0x51,0x0f,0x83,0xbf,0x1e,0x6e,0x6f,0x22,0xf3,0x02,0x7d,0x8d,0xda,0x23,0x7a,0x34,0xb7,0x63,0xeb,0xd1,0xfc,0x58,
+0x75,0xf2,0xa2,0x18,0x1c,0xe1,0x15,0xab,0x8f,0x7e,0xbb,0x71,0xa6,0x57,0xf7,0x0f,0x9f,0xa6,0x0f,0x4f,0x97,0x77,0x93,0x2f,0xd7,0xd3,0xdb,0x43,0xf3,0xe2,0xb8,0x68,
+0x9c,0x7e,0x80,0xd8,0x5c,0x81,0x0e,0x75,0xb6,0xc0,0xfb,0xc8,0xff,0x6b,0x63,0xec,0x28,0xed,0xd1,0x34,0xb0,0xfe,0x78,0xfc,0x59,0xf3,0x6f,0x5d,0xd4,0xaf,0x57,0x93,
+0xab,0xe9,0xa7,0x9b,0xa7,0x6f,0x57,0xf7,0x55,0xc4,0x06,0xe9,0x97,0x51,0xb9,0xe8,0x83,0x4e,0x86,0xa0,0x93,0xbb,0x21,0xe6,0x31,0xe6,0xf2,0xb1,0x79,0x9a,0xaf,0x6d,
+0x9e,0x09,0xba,0xde,0x69,0x73,0x5b,0x57,0x2b,0xdc,0x2b,0xbf,0x3a,0x09,0xd3,0x72,0x04,0x8f,0x33,0x16,0x3f,0x47,0x9d,0x16,0x50,0xb6,0xbb,0xb0,0x28,0x7f,0x44,0x1b,
+0xc0,0x6e,0xf5,0x81,0x7a,0xd8,0xbc,0x1d,0x64,0xf2,0xbf,0x83,0x6c,0xc2,0x1f,0x2b,0x75,0x0a,0x4a,0x13,0xa9,0x1b,0xa5,0x2a,0xc0,0x31,0x45,0xd5,0x11,0x0e,0x67,0x45,
+0x52,0xd8,0xa3,0x57,0x94,0x49,0x34,0x6a,0x4d,0xde,0x45,0x11,0xde,0x7d,0xc0,0xa9,0x0f,0xd4,0xfa,0xa3,0xdd,0x0c,0x7a,0x02,0xba,0x9e,0x3c,0xfd,0x3d,0xbd,0xfb,0x8a,
+0xcb,0xfb,0xda,0x19,0x8b,0xfd,0x13,0xa1,0xe3,0xf3,0x0d,0x91,0x57,0xa7,0xbf,0x2c,0xf0,0xfe,0x61,0xfb,0x91,0xc4,0xa3,0xb6,0xe3,0x6f,0xdd,0x00,0xfc,0x7d,0x53,0xf2,
+0xf8,0xcd,0xe8,0xb4,0x26,0x2f,0xab,0x77,0x34,0x6c,0x8b,0x77,0x68,0xf6,0xf0,0x7f,0xaa,0x2d,0x3c,0x6f,0x8a,0xca,0xa3,0xd6,0xbf,0x5e,0x69,0x5c,0xe9,0xeb,0x6a,0x48,
+0xbf,0x60,0x5b,0x7a,0x9d,0xe6,0xb6,0x5d,0x1b,0x40,0x16,0xed,0x1f,0x86,0xc8,0x08,0xeb,0x88,0x03,0x13,0x32,0x0b,0xb2,0x9d,0xb1,0xc6,0xab,0x6d,0x7e,0x11,0xb9,0x56,
+0x19,0x67,0xf8,0xc5,0xde,0xc6,0xd0,0x56,0x98,0x89,0xb8,0xfe,0xaa,0x3b,0x73,0x09,0x49,0x64,0x1e,0x9b,0x38,0xdd,0x8e,0x3c,0xd7,0x75,0x51,0x3d,0x07,0xff,0x02,0xbb,
+0x4c,0xbb,0x33,0x8e,0x09,0x00,0x00
+};
+const size_t WM_PK_RESTART_JS_KEYS_GZ_LEN = 1031;
+const uint8_t WM_PK_INDEX_HTML_KEYS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x55,0xff,0x6e,0xe2,0x46,0x10,0xfe,0xff,0x9e,0xc2,0xd5,0x55,0x5a,0x90,0x62,0x3b,0xc0,0xa5,0x17,0x12,0x8c,
+0xc4,0x05,0x88,0xac,0x26,0x90,0x1a,0x73,0xa7,0xfe,0x85,0x16,0x7b,0x8c,0xf7,0x6e,0xed,0x75,0xd7,0x03,0x14,0x45,0x27,0xf5,0x21,0xfa,0x12,0xf7,0x1a,0x7d,0x94,0x3e,
+0x49,0x67,0x0d,0x3e,0x12,0x74,0x8d,0xae,0x95,0x00,0xb3,0xb3,0xb3,0xdf,0x7c,0xfb,0xcd,0x0f,0xf7,0x7e,0x18,0x4e,0x6f,0xc2,0x5f,0x1f,0x46,0x56,0x8a,0x99,0xec,0xbf,
+0xea,0x99,0x87,0x25,0x79,0xbe,0xf2,0x18,0xe4,0xcc,0x18,0x80,0xc7,0xf4,0xc8,0x00,0xb9,0x15,0xa5,0x5c,0x97,0x80,0x1e,0x9b,0x87,0x63,0xfb,0x92,0xd5,0xe6,0x9c,0x67,
+0xe0,0xb1,0x8d,0x80,0x6d,0xa1,0x34,0x32,0x2b,0x52,0x39,0x42,0x4e,0x6e,0x5b,0x11,0x63,0xea,0xc5,0xb0,0x11,0x11,0xd8,0xd5,0xe2,0xcc,0x12,0xb9,0x40,0xc1,0xa5,0x5d,
+0x46,0x5c,0x82,0xd7,0x72,0xce,0x0d,0x0c,0x0a,0x94,0x60,0xc5,0x1c,0xb9,0xcd,0x8b,0xc2,0x63,0xd5,0x9a,0xf5,0x7d,0x15,0x5a,0xc3,0xea,0xb4,0x75,0x43,0x98,0x5a,0xc9,
+0x9e,0x5b,0x6d,0xd1,0x11,0x29,0xf2,0x4f,0x96,0x06,0xe9,0xb1,0x12,0x77,0x12,0xca,0x14,0x80,0x42,0xa7,0x1a,0x92,0x83,0xc5,0x89,0xba,0xd1,0xc5,0x9b,0x4b,0xf8,0xc9,
+0x89,0xca,0xd2,0x04,0x29,0x23,0x2d,0x0a,0xb4,0x4a,0x1d,0x79,0x2c,0x53,0xf1,0x5a,0xc2,0xa2,0x50,0x72,0x97,0x08,0x29,0x9d,0x8b,0x16,0xf0,0xf6,0x9b,0xb7,0x4b,0xe7,
+0x23,0xb9,0xf6,0xdc,0xbd,0xeb,0xc9,0x99,0x74,0x6b,0x97,0xc8,0x71,0x5d,0x3a,0x9d,0x65,0x74,0x01,0xdd,0x4e,0xf7,0x25,0x6f,0xba,0xc7,0x4b,0xdb,0x46,0x62,0xa7,0x7d,
+0x1e,0x41,0xd2,0x8d,0x4f,0x70,0x7a,0xee,0x41,0xf3,0xa5,0x8a,0x77,0xf4,0x88,0xc5,0xc6,0x8a,0x24,0x2f,0x4b,0x8f,0x19,0x65,0xb9,0xc8,0x41,0x57,0x99,0x69,0x7d,0x9f,
+0x62,0x69,0xcb,0x28,0xcc,0x97,0xa4,0xf0,0x01,0xa6,0x44,0x5c,0x4a,0x66,0x55,0x32,0x91,0x16,0x5c,0xaf,0x44,0x6e,0x2f,0x15,0xa2,0xca,0xae,0x5a,0x1a,0xb2,0x2a,0x25,
+0x15,0x89,0x1e,0x6a,0xfa,0xa6,0xfb,0x40,0xa4,0xf5,0x2c,0x1c,0x84,0xf3,0xd9,0x62,0x36,0x9a,0xcc,0xa6,0x81,0xe1,0x8c,0xe9,0xb7,0xf6,0xdf,0x0f,0xee,0xe6,0xa3,0x7f,
+0xdf,0x9e,0x4f,0xfc,0xb0,0xde,0x75,0x4d,0x04,0x17,0x0f,0x57,0x46,0x73,0x67,0x4b,0xc4,0x07,0xb5,0x6d,0xb3,0xac,0xd8,0x18,0x1a,0x31,0x55,0x96,0x2c,0x0b,0x9e,0x7b,
+0xac,0xf3,0x95,0x3d,0xc2,0xef,0x68,0x73,0x29,0x56,0xf9,0x55,0x44,0x45,0x07,0xfa,0x9a,0x9c,0x94,0xbe,0xda,0x70,0xdd,0xb0,0xed,0x6c,0x8d,0x10,0x37,0xd9,0x29,0x81,
+0xbb,0xe9,0x60,0xe8,0x4f,0x6e,0x2b,0x0e,0xf1,0x9e,0xc3,0x2b,0xfa,0x3d,0x08,0xee,0x56,0x62,0x3d,0x57,0x7e,0x89,0x39,0xe1,0x1a,0x2a,0xbc,0x36,0x65,0x94,0x09,0x32,
+0xd7,0x45,0xe7,0x8a,0x3c,0x51,0xc7,0x48,0xfe,0x64,0x3c,0x0d,0xee,0x07,0xa1,0x3f,0x9d,0x2c,0x3a,0xc3,0x69,0x38,0x33,0xc1,0xf8,0x4b,0xe7,0xb7,0x22,0x11,0xc7,0xf3,
+0x1f,0xfc,0xb1,0xbf,0xb8,0x99,0x4e,0xc6,0xfe,0xed,0x3c,0xf8,0x2f,0x30,0xd9,0x6f,0x88,0x47,0x98,0xfb,0x5f,0xc2,0xf0,0x7f,0xc1,0x28,0xe4,0x47,0x94,0xb1,0x1f,0xdc,
+0x7f,0x18,0x04,0xa3,0xc5,0xfc,0x61,0x38,0x08,0x47,0xdf,0x07,0xf1,0x9a,0x55,0x89,0xd4,0x25,0xbe,0x33,0xc6,0x1a,0x2b,0x18,0x51,0x12,0x82,0xf0,0x39,0x86,0x4b,0x52,
+0x1f,0x3b,0x04,0x77,0x05,0xd4,0x3d,0xca,0xfa,0x22,0x33,0x63,0xe5,0xb1,0x4c,0xd5,0x96,0x6a,0x3a,0x11,0x3a,0xbb,0x57,0x31,0x97,0x67,0xc6,0x10,0x00,0xb5,0xa4,0xc6,
+0xca,0xf0,0x39,0xd1,0x2a,0x63,0x8e,0xab,0xf7,0x36,0x27,0x6e,0xb5,0x78,0xb7,0xfd,0xf6,0xd2,0x74,0xd7,0x75,0xac,0xa2,0x75,0x46,0xf5,0xe1,0xac,0x00,0x47,0x12,0xcc,
+0xdf,0x77,0x3b,0x3f,0x6e,0xd4,0xf4,0x9a,0x0e,0x8f,0xe3,0xd1,0x86,0xcc,0x77,0xa2,0xa4,0xe9,0x05,0xba,0xc1,0x22,0x29,0xa2,0x4f,0xec,0x2c,0x59,0xe7,0x11,0x0a,0x95,
+0x37,0xa0,0xf9,0x08,0x4e,0xa1,0xc1,0x78,0x0d,0x21,0xe1,0x6b,0x89,0x8d,0xe6,0xf5,0x29,0xaf,0xc6,0x57,0xff,0xe6,0x63,0x02,0x18,0xa5,0x0d,0xe6,0x6a,0xb6,0xf7,0x7b,
+0x4a,0xb7,0xd1,0x3a,0x3f,0xfb,0xf1,0xce,0xa9,0xe5,0xf0,0x27,0x8b,0x87,0x60,0x7a,0x4b,0xcb,0x59,0xf3,0xfa,0x73,0xf5,0x79,0x32,0x3a,0x12,0xa5,0xa8,0xb4,0x6b,0xa1,
+0x13,0xdc,0x0f,0x00,0xfd,0xbc,0x46,0xc9,0x6c,0xd3,0x58,0x24,0xc9,0x7a,0xa6,0x4b,0x9e,0x4c,0x87,0x48,0x15,0x3b,0x2d,0x56,0x29,0xb2,0xfe,0x5f,0x5f,0xac,0xf6,0x79,
+0xfb,0xc2,0xfa,0x99,0xc6,0xef,0x47,0x5e,0x58,0x7f,0xff,0xf1,0xa7,0x45,0x81,0xc8,0xff,0x70,0xaa,0x4e,0xa6,0xe9,0x1c,0xd6,0x1f,0xac,0x31,0xa5,0x6e,0xaa,0xdd,0x6b,
+0xcf,0x43,0xbe,0xbe,0x15,0xbc,0x4a,0x7a,0xb2,0x7d,0x6f,0x86,0xd4,0x98,0x44,0xd9,0x72,0x0d,0x57,0xd6,0x29,0xa3,0x0d,0xe8,0x92,0x34,0x62,0xfd,0x0d,0xbd,0x02,0x9c,
+0xce,0x09,0xae,0xbb,0xbf,0xef,0xb1,0x30,0xdc,0xba,0x35,0xf7,0xaf,0xa9,0x7f,0x00,0xd1,0x1f,0xd1,0x90,0xb7,0x06,0x00,0x00
+};
+const size_t WM_PK_INDEX_HTML_KEYS_GZ_LEN = 856;
+#ifdef WM_REMOTE_UPDATE
+const uint8_t WM_PK_OTA_REMOTE_JS_KEYS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xd5,0x5a,0x6b,0x77,0x9b,0x48,0xd2,0xfe,0xee,0x5f,0x21,0x9f,0xcd,0x08,0x88,0x10,0xe1,0x2a,0xa1,0x0b,0xc9,0xda,
+0x8e,0x12,0x7b,0xe2,0x4b,0x56,0xb6,0x67,0x76,0xd7,0xe3,0xf1,0x22,0x68,0x49,0xd8,0x08,0x34,0x80,0x7c,0x19,0x59,0xfb,0xdb,0xb7,0xaa,0x1b,0x10,0x08,0x39,0x71,0xf6,
+0xec,0xfb,0xe1,0x4d,0xce,0xb1,0xa0,0xbb,0xba,0xfa,0xa9,0x4b,0x57,0x55,0x77,0xe3,0x84,0x41,0x9c,0xd4,0xde,0xcc,0x64,0x8b,0xe7,0x05,0xeb,0xfd,0xd2,0xa1,0xef,0x13,
+0x32,0xf2,0xac,0xd8,0x7a,0xef,0x86,0xce,0x62,0x46,0x82,0x44,0x9a,0x90,0x64,0xe0,0x13,0x7c,0xdc,0x7f,0x3a,0x72,0xf9,0x58,0xe8,0x31,0xc2,0xa3,0x43,0x8b,0xf7,0xc5,
+0x7b,0x1c,0x89,0x63,0x78,0x5f,0x90,0x12,0xf2,0x98,0x1c,0x84,0x41,0x02,0xb4,0xd6,0xfd,0xaa,0x17,0x91,0x64,0x11,0x05,0xcb,0xa3,0x43,0x11,0x09,0x56,0xbd,0x95,0xc0,
+0x67,0x83,0xdf,0xcc,0x94,0x74,0xd6,0xf1,0x22,0x70,0x12,0x2f,0x0c,0x6a,0x7b,0xc0,0x61,0xc9,0x86,0xd4,0xfc,0x7a,0xdd,0x97,0x6e,0x6e,0x48,0x7c,0x12,0xba,0x0b,0x9f,
+0xd4,0xeb,0x67,0xa3,0x5b,0xe2,0x24,0xd2,0x3c,0x0a,0x93,0x30,0x79,0x9a,0x13,0x69,0x6a,0xc7,0x67,0x0f,0xc1,0xd7,0x28,0x9c,0x93,0x28,0x79,0x92,0x1c,0xdb,0xf7,0x01,
+0x0d,0xe7,0x92,0xb1,0xbd,0xf0,0x13,0x4e,0xf8,0xe0,0x4b,0xe9,0x73,0xd7,0x5f,0xed,0xdc,0xdb,0x51,0xed,0xd8,0x5a,0x92,0xc7,0x79,0x18,0x25,0x71,0x77,0xb9,0x5a,0x89,
+0x8f,0xa5,0xd7,0x1e,0x9f,0xe1,0xe0,0x85,0x25,0x52,0xfb,0x16,0xb7,0xb7,0x7f,0xf0,0x71,0xf0,0xe9,0xf3,0xe1,0xd1,0xcf,0x5f,0x8e,0x4f,0x4e,0xcf,0xbe,0xfe,0x6d,0x78,
+0x7e,0x71,0xf9,0xcb,0xaf,0x7f,0xff,0xc7,0x3f,0xed,0x91,0x03,0xcc,0x27,0x53,0xef,0xf6,0xce,0x9f,0x05,0xe1,0xfc,0x8f,0x28,0x4e,0x16,0xf7,0x0f,0x8f,0x4f,0x7f,0xca,
+0x8a,0xaa,0xe9,0x46,0xab,0x6d,0x76,0x1a,0xef,0x38,0x71,0x6c,0x2d,0x01,0xb0,0xdf,0xcd,0x79,0xc7,0xa2,0x9b,0xcb,0x18,0xf7,0xfb,0xee,0x73,0xfc,0xfe,0xfd,0x7b,0x4d,
+0x6d,0xba,0x2b,0x11,0x08,0xa3,0x17,0x09,0x91,0x84,0xd2,0x02,0x21,0x09,0x5c,0xcf,0x0e,0x0a,0xa4,0xc2,0xd2,0x1b,0xf3,0xb1,0x44,0x15,0x1b,0x2d,0x9c,0x24,0x8c,0x2c,
+0xeb,0x74,0x31,0x1b,0x91,0x48,0xd8,0x49,0x59,0x8c,0x25,0xc4,0x01,0x5c,0x4d,0xa1,0xae,0xb4,0xda,0x8a,0xd2,0xd1,0x8c,0xe7,0xbc,0x51,0xd5,0x85,0xba,0xae,0xb6,0x4d,
+0xd5,0x30,0xb4,0x96,0xdc,0x1b,0x87,0x11,0x8f,0x2a,0x70,0x2d,0xb9,0xe7,0xf6,0x63,0xc9,0x27,0xc1,0x24,0x99,0xf6,0xdc,0x46,0x43,0x88,0xaf,0xdc,0x6b,0x6b,0x2c,0x31,
+0x08,0x3c,0xbe,0x09,0xbd,0x0c,0x25,0x88,0x60,0x07,0x6e,0x38,0xdb,0x7f,0x4a,0x48,0x5c,0x82,0xb7,0x66,0x78,0x75,0xdd,0x8b,0xdf,0xcb,0xbd,0xb8,0xd9,0x14,0x76,0x5c,
+0x69,0xbe,0x88,0xa7,0xfc,0x89,0x9d,0x4c,0xa5,0xb1,0x1f,0x02,0x0d,0x7d,0x64,0x4c,0x78,0xe1,0xad,0x6a,0xb4,0x84,0x9c,0x3b,0xc8,0x3d,0x42,0xbe,0x17,0xe1,0xaf,0x61,
+0xe4,0xbe,0xcc,0x5e,0xb4,0x2d,0x59,0x74,0x00,0xb8,0xbd,0x06,0x6e,0x37,0x1a,0xa2,0xd3,0xb0,0x4c,0x98,0xf2,0xca,0x01,0x1d,0x1a,0xd7,0xcf,0x56,0x7c,0x65,0x5f,0xf7,
+0xfb,0xaa,0xde,0x74,0x7e,0xd2,0xd4,0xc2,0x24,0x0f,0xc8,0xfd,0x22,0xfc,0xb6,0x0c,0x38,0x49,0x61,0x82,0xb7,0xc0,0xc1,0x66,0xfc,0x99,0x48,0xc0,0x9c,0x4e,0x03,0x7f,
+0x60,0x06,0x1b,0x66,0xa8,0x83,0x6a,0xb7,0xc8,0x72,0x48,0x1e,0x5f,0x3b,0x09,0x4a,0x91,0x4f,0x80,0x33,0x20,0x77,0x1d,0x96,0x5c,0x78,0x9e,0x44,0x5e,0x30,0xe1,0x15,
+0xd0,0x96,0x58,0xec,0xaf,0x2b,0xc6,0x46,0x77,0x0e,0x40,0xba,0x0d,0xbd,0x80,0xe7,0x38,0x61,0x25,0x4e,0xc9,0xe3,0x0f,0x8a,0x8b,0xb2,0xaa,0x39,0x94,0xb9,0x1d,0xc5,
+0xe4,0x28,0x48,0xc0,0x01,0xe3,0xc5,0x08,0x1c,0x90,0xb7,0x45,0x55,0x10,0x95,0xad,0xb6,0xdb,0xb7,0x63,0xd2,0xd2,0x7f,0x64,0x22,0x4d,0xd8,0xc9,0x28,0x9c,0xd4,0x68,
+0x4a,0xeb,0x19,0x1e,0x1a,0x0a,0x3c,0x9a,0xf4,0x49,0xbd,0x16,0x3d,0x18,0xe8,0xf5,0xf5,0x9e,0x87,0x4a,0xb2,0xdf,0x9a,0x0d,0xef,0x6d,0xab,0x6f,0xe5,0x06,0x32,0x3f,
+0xa4,0x68,0x7d,0xc9,0x99,0xda,0xd1,0x5e,0xc2,0xa3,0x1f,0xb4,0xde,0xf2,0x5a,0xd3,0x13,0xea,0x2d,0x4d,0x10,0xba,0x29,0x01,0x67,0x71,0x5b,0xd5,0x34,0xa2,0xc8,0xb7,
+0x69,0x2a,0x86,0x69,0x22,0x32,0xf7,0x6d,0x87,0xf0,0xef,0xae,0x7e,0xdf,0x6b,0xfe,0x53,0x6e,0x76,0x1a,0xbf,0xbd,0xbb,0x7e,0xe7,0x4d,0x44,0x18,0xdb,0xfb,0x9e,0x7b,
+0x3a,0x56,0xa3,0x61,0xff,0xa4,0x0b,0x3b,0xce,0xae,0x25,0xd7,0xeb,0x99,0x09,0x7d,0xc9,0x0b,0x5c,0xf2,0x78,0x46,0x97,0x36,0x03,0x6d,0x37,0x15,0x41,0xa8,0xd3,0x55,
+0x32,0x0f,0x1f,0x78,0x55,0x6c,0xaa,0x6f,0x9d,0x86,0x29,0x40,0x73,0xbf,0xef,0xbc,0x55,0x9f,0xb7,0x8d,0x11,0x04,0x14,0xb5,0x09,0xdd,0x05,0x83,0xac,0x7a,0x8f,0x52,
+0x1a,0xfd,0xac,0x31,0x0d,0xcb,0x88,0xf0,0xd0,0xca,0x5b,0xc5,0x4f,0xd6,0x72,0x91,0x8c,0xcd,0xee,0x32,0xa6,0xfe,0x53,0x91,0x7c,0x1d,0xab,0x3f,0x49,0x23,0x2f,0x90,
+0x4a,0x64,0xfc,0x22,0x20,0xb1,0x63,0xcf,0x09,0x4f,0x02,0x27,0x74,0xc9,0xe5,0xf0,0xe8,0x20,0x9c,0xcd,0xc3,0x00,0x12,0x03,0x8c,0x14,0x84,0xdc,0x23,0x98,0x77,0x6e,
+0x63,0xeb,0x92,0xca,0xc8,0x94,0x27,0x9b,0xb0,0xc4,0x80,0x31,0x05,0xae,0x5e,0xf0,0x2d,0xc4,0x99,0x29,0xc6,0x68,0x8a,0x18,0xcc,0x10,0xf7,0xfd,0xcc,0x0c,0x31,0xba,
+0xce,0xb8,0xe8,0x26,0x07,0x30,0x3f,0x68,0x30,0x16,0x4a,0xab,0x77,0xfc,0x2d,0xec,0xaf,0x9d,0x80,0x0d,0x95,0xc6,0x51,0x38,0x3b,0x48,0x67,0xe2,0xfd,0xab,0xf8,0x7a,
+0xbd,0x68,0xc6,0x6b,0xe7,0x03,0xb9,0x8e,0xac,0x4f,0xd4,0x42,0x67,0xd6,0x16,0x4d,0xf9,0xbb,0x56,0xb0,0xf0,0x21,0x65,0xf2,0x27,0xd0,0xfa,0xfc,0xfc,0x95,0xfe,0xdd,
+0xdd,0x85,0x0c,0xea,0xc5,0xfb,0x8b,0xf1,0x18,0x12,0xc1,0xaa,0x97,0xe7,0xd9,0x93,0xf5,0x50,0xa4,0x29,0xa4,0x8d,0x7a,0x1d,0x53,0x6b,0x38,0xae,0x95,0x5a,0xa5,0x8c,
+0x89,0x65,0x71,0x19,0x13,0x0e,0xf3,0xf3,0x36,0x1a,0xe0,0xbd,0xda,0xc9,0xa7,0xfa,0x5a,0x40,0x99,0xb3,0x8e,0x88,0xed,0x7e,0xf2,0x43,0x3b,0x39,0x1e,0x94,0x39,0xe6,
+0x14,0xb1,0xef,0x39,0xa4,0xdc,0x07,0xa0,0x59,0x33,0x2f,0x8b,0x32,0x98,0x7a,0xa7,0x9a,0xaf,0x0f,0x21,0xdd,0x1e,0x49,0xe8,0xb4,0xa0,0xf9,0x33,0xd1,0x85,0x17,0x70,
+0x07,0x58,0x71,0x39,0xa5,0x23,0x7a,0xc2,0xd2,0x29,0x27,0x4a,0x66,0x89,0x0f,0x5e,0xbd,0xee,0x49,0xd4,0x59,0xe1,0xcd,0x82,0xb9,0x61,0xa8,0x1d,0x3d,0x71,0x1f,0x1c,
+0xcb,0xdd,0xf0,0x6d,0x47,0xe8,0x3a,0x90,0x03,0x2b,0x8d,0xf8,0x07,0xc8,0xf7,0xa2,0xc8,0x7e,0x2a,0x14,0x2a,0x14,0x35,0xab,0x4f,0x1c,0x80,0xde,0xdd,0x65,0x04,0x5e,
+0x4c,0x7f,0x61,0x4c,0xbd,0x5e,0x82,0xb4,0x6b,0x59,0x97,0x5e,0x90,0x98,0xb4,0x1b,0x6c,0xea,0x58,0xce,0x3a,0x8a,0x0b,0xeb,0x70,0x12,0x59,0xbe,0x54,0x4c,0x89,0xc0,
+0x49,0x9c,0x03,0x6d,0x16,0xf2,0xc4,0xc0,0x52,0xda,0x9a,0x6a,0x98,0x3a,0x24,0x7b,0x91,0x58,0x4d,0xb5,0x0d,0xef,0x9a,0xd9,0xee,0x88,0xa1,0xd5,0xcc,0xbb,0x74,0x31,
+0xb1,0xb2,0x1e,0x53,0x5c,0x80,0xcb,0x2e,0xfa,0x51,0xe6,0xb2,0x0b,0x74,0xd9,0xe8,0x6a,0x71,0x6d,0xf1,0xf8,0x17,0x03,0x2e,0xfe,0xd2,0xbc,0x56,0x28,0x24,0xd2,0x4e,
+0x55,0xcf,0x7a,0xcd,0x52,0x3d,0x11,0x5d,0xcd,0xd3,0xac,0xab,0xa8,0x66,0xbf,0x3f,0x87,0x7c,0x28,0x46,0x57,0xfc,0xbc,0xd1,0xd2,0xa1,0xbd,0xd3,0xef,0xeb,0x42,0x43,
+0xd1,0xaf,0xad,0x79,0x2e,0xdb,0xcc,0xb2,0xa5,0x9b,0xf1,0x58,0x9c,0xe0,0xef,0x64,0x22,0x4e,0xf1,0x77,0x3a,0x15,0x9f,0xf0,0xd7,0xf3,0xaa,0x30,0x2d,0xc8,0x37,0xd4,
+0x0d,0x0e,0xac,0x40,0x3c,0xb7,0x88,0x78,0x67,0x85,0xe2,0x8d,0x95,0xf4,0x02,0x6b,0xc6,0x07,0x22,0x11,0x43,0x31,0x81,0x39,0x17,0x0d,0xf9,0x5a,0x6c,0x8b,0xcd,0x96,
+0x29,0x9b,0xed,0x56,0x47,0x6b,0x09,0x20,0xfd,0x8c,0x4f,0x44,0x46,0x82,0x04,0xca,0xb5,0xa8,0x40,0x60,0xd5,0xcc,0x8e,0xd1,0xd2,0x0d,0x13,0x28,0x42,0xa0,0xc0,0xe1,
+0x48,0x83,0x14,0x90,0x6e,0x94,0xb6,0xd8,0x92,0x5b,0x8a,0x6c,0x98,0x4a,0x47,0x00,0xdd,0xce,0x78,0x36,0x43,0x40,0x09,0xb4,0x6b,0x51,0x05,0x16,0x8a,0xac,0xeb,0x86,
+0x6a,0x68,0x9a,0x2c,0x88,0x9b,0x30,0x74,0x0a,0x43,0x69,0xb7,0x74,0xc5,0x34,0x3b,0xed,0x2a,0x0c,0x83,0xc2,0x50,0x54,0x59,0x96,0x4d,0x59,0x57,0xb7,0xc0,0x68,0x51,
+0x18,0x4d,0x45,0x07,0x4b,0x6a,0x8a,0xa6,0x2b,0x55,0x20,0x6d,0x06,0x44,0x37,0xda,0xb2,0xd1,0x31,0xb5,0x2a,0x0c,0x13,0x61,0x28,0xed,0xb6,0x2c,0x6b,0x86,0xae,0x6c,
+0xd1,0x46,0x87,0x69,0x43,0xe9,0xa0,0xaf,0xe8,0xba,0xd2,0xae,0xe2,0x50,0x64,0x06,0x44,0x57,0x65,0x48,0xa4,0x15,0x0c,0x8a,0x92,0x6a,0xa3,0xd3,0x91,0x75,0x19,0x26,
+0x51,0xab,0x30,0x14,0x95,0xe2,0x00,0x41,0x5b,0xb2,0xd6,0x32,0xd5,0x2d,0x56,0xd1,0x18,0x10,0x5d,0x06,0x41,0x15,0x59,0xd9,0x02,0x43,0x4f,0xf5,0x61,0xc8,0xa0,0x34,
+0x55,0xed,0xc8,0x5b,0xb0,0x18,0x14,0x0b,0x94,0xe8,0x2d,0x43,0x33,0x34,0xb5,0x83,0x50,0x26,0x65,0x28,0xd7,0xa2,0x01,0x4c,0x5a,0x46,0xbb,0xd3,0x32,0x14,0x19,0x91,
+0x4c,0x4a,0x48,0x40,0xed,0x1d,0xb4,0x6d,0xab,0x63,0xc8,0x4a,0x4b,0x53,0x11,0xc9,0xa4,0x8c,0x04,0x5d,0x48,0x17,0x5b,0xba,0x06,0xcb,0xaa,0xad,0x50,0x9d,0x4c,0x4a,
+0x38,0x40,0x63,0xaa,0x0c,0x3e,0xd6,0x06,0x2f,0x6b,0x6b,0xb2,0x5a,0x85,0x61,0x50,0x18,0x6d,0x59,0x31,0xc0,0x05,0x3b,0x4a,0x15,0x06,0x6a,0xbd,0x23,0x6a,0x26,0x60,
+0x90,0xd1,0xb2,0x15,0x10,0x06,0x05,0xd1,0x6c,0xb5,0x64,0xbd,0x6d,0x6a,0x9a,0x51,0x45,0xa1,0x33,0x14,0xba,0x0c,0xab,0xb4,0x6d,0xea,0x66,0x15,0x45,0x07,0x51,0x18,
+0x2d,0x53,0xd7,0x41,0x18,0x73,0x0b,0x08,0x3d,0x55,0x86,0xd2,0x31,0xc1,0x70,0xa8,0xf2,0x4d,0x1c,0x1a,0x83,0xa1,0x98,0x6d,0xad,0xa5,0x75,0x5a,0x4a,0x15,0x86,0x49,
+0x61,0x28,0xa0,0x4b,0x43,0x03,0xe3,0x29,0x5b,0x6c,0xa2,0x31,0xa3,0xe8,0x80,0xc3,0x54,0xf4,0x56,0xbb,0x8a,0x44,0xa5,0x40,0x0c,0x05,0xfc,0x03,0x44,0xa9,0xc2,0x68,
+0x53,0x18,0x10,0xe5,0xc0,0xea,0x26,0xac,0x98,0x2a,0x0c,0xf4,0x41,0x54,0x87,0xd2,0x51,0x41,0x67,0xed,0xb6,0xa6,0x23,0x90,0xe9,0xa6,0x55,0x74,0x34,0x9b,0x09,0x56,
+0x41,0x0c,0xd3,0x12,0x06,0x10,0x44,0x51,0xa0,0x24,0x03,0xe7,0x33,0xda,0x00,0x95,0x5a,0x65,0x5a,0x75,0x8d,0x16,0x78,0xba,0xd6,0x91,0x35,0xd9,0xc0,0xb5,0x40,0x80,
+0xa4,0x84,0x03,0xcd,0xa2,0xc1,0x2c,0x86,0x26,0x77,0x0c,0xd8,0x02,0x55,0x50,0x28,0x14,0x85,0x82,0xfd,0x1d,0x58,0x73,0x72,0x15,0x89,0x4e,0x91,0x28,0x6a,0x5b,0x35,
+0x3b,0x60,0xfa,0x2d,0x40,0xda,0x14,0x07,0x30,0x31,0xf4,0x4e,0x9b,0x7a,0x71,0x05,0x87,0xcc,0x70,0x28,0x72,0x07,0xf4,0x25,0xb7,0x74,0x79,0x0b,0x12,0x0d,0xa1,0x80,
+0x4d,0xd4,0x76,0x47,0x69,0xeb,0x55,0x20,0x32,0x53,0x89,0x66,0x98,0xe0,0x62,0xaa,0xaa,0x56,0x81,0x68,0x0c,0x08,0x74,0x1a,0xaa,0xd2,0x69,0x77,0xaa,0x40,0x5a,0x14,
+0x47,0xbb,0x25,0xab,0x1d,0xc5,0xec,0x54,0x41,0x74,0xa8,0x3a,0x00,0x9f,0xd6,0xd2,0x75,0xb3,0x5d,0x05,0x81,0x96,0x45,0x14,0xba,0xaa,0x98,0x8a,0x61,0xe2,0x52,0xa8,
+0xd8,0xc5,0xa0,0x30,0x40,0xa5,0x6d,0x1d,0x80,0xc8,0x55,0x14,0x2a,0xd3,0x46,0xa7,0x03,0xf1,0xdc,0x84,0xc8,0x80,0x38,0x9e,0x36,0x33,0x0b,0x6a,0xb4,0x63,0xb6,0x34,
+0x19,0x56,0x0c,0xe2,0x78,0x2a,0xe1,0x40,0x9d,0xa3,0xa3,0xab,0x2d,0xb3,0xa3,0xe8,0x0a,0x85,0xf1,0x54,0x8d,0x61,0xd4,0xd3,0x71,0x35,0xe8,0x1d,0x99,0xae,0xda,0xa7,
+0x12,0x10,0x0c,0x61,0x20,0x0c,0x78,0x98,0x86,0x2b,0xb7,0x8a,0x03,0xc5,0x05,0x17,0x83,0x98,0xae,0x83,0x9f,0xb6,0x95,0x2a,0x10,0x8d,0x02,0x81,0x35,0xd9,0xd1,0x01,
+0x2d,0x24,0xb2,0x2d,0x48,0xe4,0x14,0x89,0x6c,0x28,0x86,0xaa,0x55,0x61,0x28,0x0c,0x86,0x2a,0x03,0x4c,0x15,0xcc,0xdf,0xa9,0x02,0x31,0x29,0x0e,0x58,0xf8,0x90,0x9d,
+0x34,0xa3,0x53,0xc5,0x41,0xb5,0x8e,0x71,0x10,0x52,0x29,0xb8,0x8f,0x5e,0x85,0xd1,0x4a,0x51,0x18,0x2d,0x0c,0x31,0x10,0xed,0xb6,0x00,0xd1,0x28,0x12,0x05,0x56,0x83,
+0x62,0x28,0x2d,0x7d,0x0b,0x10,0x9d,0x59,0x46,0x37,0x40,0x12,0xb9,0x2d,0x6f,0x01,0xa2,0xa4,0x1a,0x81,0x7c,0xab,0x2a,0x10,0x42,0x3a,0x55,0x28,0x2a,0x85,0xd2,0x06,
+0x79,0xcc,0xb6,0x6a,0x74,0xaa,0x40,0x3a,0x4c,0x23,0x1a,0xd8,0x05,0xf4,0xce,0x3c,0x24,0x68,0x1c,0x40,0x85,0x23,0x03,0x2d,0x69,0x9c,0xd3,0xa7,0xd0,0x0a,0x1b,0x77,
+0xf4,0x29,0xb1,0x92,0xc6,0x0d,0x3e,0xad,0xb2,0x43,0x1a,0x3f,0x3b,0x57,0xb9,0x4a,0xd1,0x5f,0x43,0xd9,0x4e,0x0b,0xa1,0x52,0x09,0x2b,0x46,0xe2,0x9c,0x81,0x67,0x25,
+0x4f,0x62,0x39,0x0d,0xde,0xab,0x47,0xcf,0xff,0xf6,0xea,0x73,0xa1,0xc1,0x07,0xc8,0x54,0x68,0x84,0xe9,0x4e,0x82,0x4f,0xfa,0x7d,0xf2,0x9c,0xb0,0x73,0x26,0x22,0x34,
+0xbc,0x95,0x48,0x8b,0xaa,0xd7,0xf0,0x9c,0x3f,0x47,0xf5,0x7f,0xbf,0x9a,0xe7,0x74,0xfa,0x0a,0x9e,0xbf,0x47,0xbf,0xbf,0x9a,0xa1,0xe7,0x7d,0x9f,0x61,0xf4,0x3b,0xef,
+0x3d,0x03,0xc6,0xd7,0xf2,0x1c,0xf9,0xa1,0x73,0x17,0x7b,0x7f,0x12,0x28,0x19,0xf1,0xdd,0xf5,0x26,0x24,0x4e,0xb2,0x86,0xe3,0xf5,0xae,0xb8,0xb4,0x69,0xf0,0xc6,0x50,
+0x87,0xd3,0x5d,0x96,0xb0,0x93,0x4c,0xa3,0xf0,0xa1,0x16,0x90,0x87,0xda,0x20,0x8a,0xa0,0x60,0x7d,0x73,0x2c,0x9d,0x5d,0xec,0xdd,0xfc,0x7c,0x7e,0x73,0x74,0x3c,0xf8,
+0xbc,0x77,0x7c,0xb3,0x37,0xfc,0x7c,0x79,0x32,0x38,0xbd,0x68,0x38,0x6c,0x5b,0x8d,0x95,0x7a,0xf1,0x5c,0x89,0xb7,0x29,0xd3,0x7c,0xab,0x47,0xf7,0x1e,0x76,0x4c,0xfb,
+0x3e,0x44,0xdd,0xf4,0x35,0xdd,0x98,0xb8,0x1b,0x1b,0xdd,0x48,0xe8,0xe6,0x75,0xff,0x21,0x79,0x84,0xf7,0x55,0xbe,0x7f,0xbf,0xb4,0x72,0xfc,0xe9,0x31,0xeb,0xd0,0xda,
+0xe3,0x2f,0xb3,0x89,0x96,0xc3,0x8d,0x23,0x58,0x35,0x3d,0x82,0xc5,0xb1,0x37,0xb3,0xd0,0xb5,0xfd,0x83,0x38,0xb6,0x38,0x89,0x3e,0x36,0xc3,0x7b,0x12,0xf9,0xf6,0xd3,
+0x72,0x1e,0xc6,0x1e,0x6a,0xa2,0x3b,0xf6,0x1e,0x89,0xdb,0xf3,0x82,0x98,0x24,0x5d,0xb9,0x37,0xb2,0x9d,0xbb,0x49,0x14,0x2e,0x02,0xb7,0x1b,0x4d,0x46,0x36,0xee,0xcb,
+0xf0,0xbf,0x84,0x5b,0x65,0xd7,0x8b,0xe7,0x30,0xb4,0x3b,0xf6,0xc9,0x63,0xcf,0xf6,0xbd,0x49,0xd0,0xf4,0x12,0x32,0x8b,0xbb,0x0e,0x6c,0xe3,0x49,0xd4,0xbb,0x5d,0xc4,
+0x89,0x37,0x7e,0x6a,0x3a,0xec,0xac,0x38,0x6b,0xfe,0xb3,0x49,0x8f,0x2f,0xba,0x1d,0xf8,0xb7,0xe2,0x1a,0x3b,0x19,0x92,0x51,0xf8,0xb8,0x2c,0x4c,0xf7,0x97,0xf1,0x78,
+0xdc,0x1b,0x81,0x42,0x49,0xd4,0x8c,0x6c,0xd7,0x5b,0xc4,0x5d,0xa9,0x6d,0x44,0x64,0x06,0x8d,0x8f,0xcd,0x78,0x6a,0xbb,0xe1,0x43,0x57,0xae,0x99,0xf3,0xc7,0x9a,0xa6,
+0xc2,0x9f,0x02,0x3c,0x49,0x35,0x85,0xde,0xdc,0x76,0x71,0x97,0xd7,0x55,0x25,0x1c,0x54,0x53,0x71,0x24,0x9e,0x5c,0x37,0x29,0xd2,0x0c,0xcc,0xcc,0x0b,0x9a,0x0f,0x9e,
+0x9b,0x4c,0xbb,0xaa,0x2a,0xcf,0x1f,0x19,0x9e,0x78,0xee,0x05,0x01,0x89,0x96,0xac,0xc3,0x00,0xee,0xbd,0x29,0xf1,0x26,0xd3,0x84,0x3d,0x33,0x50,0x5d,0x03,0x26,0x8d,
+0x43,0xdf,0x73,0xd9,0xd4,0xaa,0x01,0x51,0xdf,0x84,0xe8,0x00,0xf3,0x43,0xd8,0xcf,0xa0,0x27,0xe1,0x1c,0x14,0xe0,0x87,0x51,0xf7,0x2f,0x90,0xf9,0x5a,0xae,0xba,0x21,
+0x93,0x21,0xff,0xd4,0xb3,0x03,0x6f,0x66,0x53,0xe5,0xe3,0xcc,0x35,0xc9,0x8c,0x6b,0xbe,0x17,0x10,0xb0,0x97,0x17,0x8c,0xbd,0x00,0x94,0xda,0x9b,0xd9,0xd1,0xc4,0x0b,
+0x40,0x5e,0x7b,0x91,0x84,0x35,0x45,0x52,0x51,0x28,0x8a,0xf6,0xaf,0x77,0xe4,0x69,0x1c,0xd9,0x33,0x12,0xd7,0x70,0xf4,0x32,0x09,0x97,0x49,0x64,0x07,0x31,0xec,0xb2,
+0x66,0x5d,0xd8,0x9f,0xda,0x09,0xe1,0x61,0x7f,0xe6,0x92,0x09,0xf8,0x50,0x41,0xdd,0xb3,0x78,0xb2,0x4c,0x81,0x61,0xbc,0xeb,0xa8,0xe9,0x1c,0x60,0x87,0x24,0x09,0x67,
+0x99,0xb2,0xc7,0x60,0xbc,0x26,0x2e,0x9c,0xae,0x22,0xc9,0xb4,0xe5,0x61,0x0a,0x80,0x9a,0xf1,0xdc,0x76,0x48,0x77,0x1e,0x91,0x26,0x42,0x2d,0x32,0x76,0x82,0x64,0xb9,
+0x1e,0xc5,0xd4,0xcf,0xd8,0x3c,0x30,0x25,0x42,0xd2,0xea,0x95,0x54,0x52,0xf2,0x82,0x24,0x68,0xc2,0xca,0x5b,0x96,0x9c,0x6b,0x62,0xcf,0x33,0x3c,0x2f,0x38,0x55,0x8a,
+0x1d,0xb4,0xdd,0x2d,0x2a,0x67,0xcd,0x74,0x99,0xf9,0x83,0xd4,0x42,0x77,0x50,0xa4,0xd4,0x95,0xa8,0x29,0x83,0x30,0x20,0x9b,0xbe,0xb6,0x29,0xfd,0xa6,0x14,0x2d,0x94,
+0x62,0x11,0xc5,0x20,0xc6,0x3c,0xf4,0x10,0xc4,0xa6,0x18,0x4f,0x24,0x2e,0x39,0x74,0x6a,0xff,0x54,0x74,0x70,0xef,0xcd,0x01,0x41,0x58,0xa4,0xa7,0x56,0x9c,0xdb,0x11,
+0x08,0xd8,0x2b,0x1b,0x2a,0x45,0x2d,0x29,0x54,0xd0,0x97,0x9c,0x50,0x15,0x56,0xdc,0xfa,0x3c,0x88,0x04,0xf1,0x22,0x22,0x27,0xe9,0xf2,0xe7,0x69,0xb0,0xdb,0x7d,0xe9,
+0xf6,0x87,0x8b,0x32,0x42,0x4e,0x60,0x51,0x38,0xb6,0x72,0x5a,0x27,0x22,0xe0,0x53,0x29,0x39,0xcf,0xc5,0xc9,0x93,0x4f,0x38,0xa1,0x17,0x4b,0x9e,0x6b,0x15,0x06,0x42,
+0x43,0xf1,0xa2,0x28,0x8f,0x3c,0xbd,0x9c,0xd1,0x94,0xd8,0xae,0x64,0xcf,0xe7,0x90,0x0f,0x0f,0xa6,0x9e,0x4f,0x2f,0x9d,0x56,0x85,0x73,0xa5,0x78,0x1a,0x3e,0x0c,0x21,
+0x6c,0xdb,0x51,0x42,0xb9,0xf2,0x31,0x01,0xab,0xbb,0xb1,0x08,0xbe,0x1e,0xdb,0x13,0x22,0x2c,0x37,0x85,0xa2,0xf1,0x11,0x1c,0xdb,0xe2,0x53,0x92,0x5d,0xcb,0x02,0x55,
+0x12,0x58,0x44,0xc4,0x15,0x3e,0xa4,0x8d,0x5d,0x88,0xe5,0xc3,0xc1,0xf9,0xc5,0xde,0xf0,0xe2,0xe6,0xe8,0xf4,0xe6,0xeb,0xf0,0xec,0x33,0xbc,0x9e,0xd3,0xc1,0xae,0x77,
+0xff,0xa2,0xa4,0xd0,0xc7,0x61,0xd4,0xbb,0x97,0x1c,0xdf,0x8e,0xe3,0x53,0x58,0x73,0x16,0x57,0x8a,0xa2,0x1c,0xed,0xa5,0xc1,0xe3,0xf0,0xe2,0xe4,0xd8,0xe2,0xfa,0xf0,
+0x5e,0xa3,0xd4,0xd6,0x6f,0x5c,0x1e,0xe6,0x7e,0xe3,0xde,0xa3,0xe5,0x4b,0x9d,0x69,0xcc,0x81,0xae,0xfe,0x3b,0x68,0x67,0x04,0xf3,0x8d,0xb1,0x20,0x1a,0x1d,0x0b,0xbf,
+0x0d,0xae,0xff,0x6e,0x5e,0x65,0x93,0x2f,0xc1,0xdf,0xb8,0x1a,0xd8,0xe3,0x37,0x2e,0x3a,0xc0,0x67,0x20,0x4c,0x95,0x87,0xe3,0x72,0xfe,0xec,0x69,0x6d,0x91,0x51,0xe8,
+0x3e,0x95,0x2c,0x02,0xfd,0x4c,0xa9,0x81,0x95,0x8e,0xef,0xb1,0x9c,0x0c,0xd9,0xe1,0x08,0x7d,0xfe,0x1e,0xcc,0x52,0x38,0xa3,0x0b,0x9a,0x4d,0x4a,0x40,0x7c,0xeb,0x65,
+0xdf,0x02,0x44,0xa0,0x47,0xf0,0x3f,0xe2,0x0b,0xc4,0x2f,0x79,0x49,0x80,0xcd,0x41,0xdf,0x92,0x85,0xa5,0xe3,0x43,0x00,0xcc,0xe7,0x48,0x84,0x1e,0xa4,0x74,0x1a,0x24,
+0xa5,0x69,0x44,0xc6,0x16,0xf7,0x8e,0x03,0x67,0x81,0x82,0x4e,0x96,0xc1,0x6b,0xd2,0xe2,0x6a,0xb9,0xe9,0x32,0x1b,0xa9,0x50,0x2b,0xde,0x81,0xd2,0xfb,0x4c,0xf1,0xe8,
+0x70,0x65,0xbd,0x99,0xc9,0x8c,0x04,0x72,0x27,0xbc,0x28,0xe9,0x4b,0x85,0x19,0xf4,0xa9,0x29,0xaf,0x7b,0xcb,0x2f,0xdc,0x88,0x52,0xed,0x1f,0x7b,0x71,0x22,0xc1,0x7a,
+0x04,0x5f,0xe0,0xb9,0xa9,0xe7,0xba,0x24,0x00,0x31,0x57,0xe9,0x80,0xc3,0x17,0x06,0x40,0x54,0xda,0x42,0xfd,0xb0,0xa6,0xe6,0xe6,0x51,0x38,0x39,0x0a,0xc6,0x21,0x57,
+0xbe,0x79,0xf5,0x73,0xe2,0x41,0x81,0x98,0x44,0xd1,0x16,0xba,0x7c,0x49,0x8d,0x3d,0x97,0x1f,0x2d,0xc6,0x62,0x62,0x4f,0x84,0xf4,0x26,0x78,0x64,0x61,0x91,0xb3,0x3e,
+0x8c,0xc4,0xfe,0x4c,0x63,0x09,0xeb,0xbc,0x00,0x76,0x03,0x7a,0xc4,0x1f,0xf1,0x02,0x3b,0x3f,0x25,0x3c,0xb2,0xa0,0x47,0x79,0x3e,0x49,0x6a,0xec,0x66,0xc6,0x1a,0xa5,
+0x67,0x75,0xcd,0x24,0x7b,0xa2,0x77,0x35,0x4b,0x24,0x19,0x63,0x50,0xb3,0x92,0x68,0x41,0xf2,0x51,0xb7,0x30,0xea,0xb6,0xbf,0xa6,0xbd,0x45,0x5a,0x70,0x80,0xd1,0x95,
+0xd7,0xb8,0xbd,0x86,0xb5,0x9b,0x8c,0xae,0x6e,0xaf,0xf1,0xbc,0x1d,0x87,0x8e,0x6d,0x3f,0x86,0x28,0x0d,0x6b,0xf2,0x0e,0xc3,0x04,0xd0,0xd1,0x76,0xc6,0xdd,0x1b,0xe1,
+0xad,0x23,0x3e,0xdd,0x59,0x5e,0x63,0xcd,0x12,0x92,0x95,0x4f,0xf8,0xbb,0x7e,0xd6,0x50,0xaf,0x8f,0xae,0xee,0x90,0x35,0x78,0x98,0x37,0x62,0xc7,0xf4,0xd8,0x22,0xf4,
+0xee,0x1a,0x8d,0xdc,0x8f,0x6a,0x99,0xd4,0x1f,0x49,0x26,0x35,0xbb,0xa8,0xe0,0x37,0x74,0xe5,0x8d,0x04,0x1a,0xb3,0xb2,0x61,0x50,0x3a,0x02,0x13,0xa6,0xbc,0x8f,0x8a,
+0x65,0xc7,0x4f,0x81,0xc3,0x8f,0xc1,0xe5,0x70,0xdc,0xd7,0x28,0x9c,0x79,0x31,0xe1,0xf9,0x88,0x40,0xc8,0xbe,0x87,0x1d,0x07,0xc1,0xeb,0x6e,0x74,0x48,0x04,0x8e,0x27,
+0xe6,0x24,0xa2,0x0a,0xff,0x04,0xa0,0x87,0xf4,0x95,0xc7,0xb2,0x0e,0x1f,0xa4,0x30,0xf0,0x43,0xdb,0x5d,0x57,0xac,0xe4,0x1e,0xac,0x9b,0x19,0xd1,0x46,0x34,0xe9,0xf9,
+0x3d,0xed,0x90,0xc0,0x6b,0x61,0xe1,0x81,0x3f,0xc6,0x0b,0x3f,0x49,0xcd,0x39,0x73,0x0d,0x6b,0xc8,0x17,0x68,0x33,0x3b,0x4f,0xa1,0xd2,0xb1,0xd0,0x37,0x0a,0x7d,0x22,
+0xf7,0xd7,0xb7,0x27,0x7b,0x9f,0x3d,0xe7,0xed,0x5f,0xbb,0xd3,0x87,0x2e,0x97,0xd1,0x42,0xa4,0xfb,0x16,0xe9,0x3d,0x59,0x93,0xfa,0x76,0x30,0xf9,0x16,0xad,0x3f,0xe9,
+0xd2,0x7b,0x38,0xaa,0x0d,0x7e,0x09,0xf0,0x44,0x44,0x22,0xc2,0x14,0x22,0x8e,0x5d,0xe1,0x82,0xc8,0xc5,0x27,0x58,0x87,0x5b,0x4c,0x67,0x59,0x2b,0xfe,0xec,0xb1,0x33,
+0xf6,0xf4,0x66,0x02,0x7c,0x17,0x86,0xa1,0x3e,0x91,0xd5,0xdf,0x16,0x24,0x7a,0xa2,0x15,0x7d,0x0a,0xc9,0x25,0xf7,0x87,0x28,0x2c,0x86,0x81,0x9c,0xe0,0xf9,0x99,0x5f,
+0x13,0x8f,0x49,0xe2,0x4c,0x79,0xee,0x5d,0xfc,0xc7,0x07,0xf7,0xd1,0xc2,0x76,0x5c,0x50,0x53,0x12,0xf0,0x91,0xf5,0x3e,0x92,0x6e,0x63,0x0c,0x74,0xb0,0x82,0x6d,0x24,
+0x23,0x60,0xbb,0x8d,0x79,0xd8,0xc6,0x81,0x00,0x8a,0x4c,0x0d,0xa7,0xcc,0x0f,0x6a,0x7e,0x6a,0x68,0x08,0x5e,0xe3,0x88,0x4b,0x83,0x4c,0x55,0x68,0xcb,0x7e,0xb0,0x3d,
+0x74,0x1f,0x08,0x14,0x18,0x0e,0xb1,0x37,0xbb,0xfb,0x01,0xa2,0xdd,0x74,0x83,0xb2,0xbc,0xe7,0xb9,0x31,0xf8,0x09,0x7e,0x1c,0x01,0x69,0xba,0x77,0x74,0x08,0xef,0x0f,
+0x98,0x94,0x38,0xd1,0x97,0x02,0xf8,0x4d,0xdb,0x80,0x06,0x2b,0x18,0x6c,0xc5,0xdf,0xc2,0x35,0x43,0x83,0xab,0xed,0xa7,0x23,0xa9,0x9c,0x14,0x48,0x3a,0x6a,0x06,0x53,
+0x71,0x08,0x2a,0x7b,0x47,0x6c,0x1c,0x45,0xc8,0x10,0x7c,0xc0,0xc7,0x2e,0x5e,0x7d,0x42,0x77,0xbc,0x70,0x1c,0x48,0xae,0xc3,0xf0,0x01,0xde,0x93,0xe8,0x29,0x75,0x4b,
+0xf7,0xe7,0x54,0x98,0x54,0xed,0x3c,0x15,0xc8,0xfd,0x59,0xc2,0x89,0xea,0xf5,0xf4,0xc1,0xb2,0xa8,0x9a,0x85,0x34,0x84,0xa5,0x2a,0xaf,0xc6,0xd4,0x88,0xb8,0xcd,0xe4,
+0x11,0x73,0x07,0x23,0x5c,0xcc,0x5d,0x48,0xcf,0xfb,0x09,0x04,0x4e,0x09,0xca,0x45,0x7b,0xe4,0x93,0x2c,0x4a,0xbc,0x14,0x0c,0x39,0x0e,0xd1,0x42,0x3b,0x43,0xba,0x22,
+0x40,0xfc,0xd2,0xb4,0x34,0x32,0xbf,0x6a,0x4e,0x1a,0xd4,0x06,0x85,0x2d,0xe2,0xe1,0xaf,0x47,0x1f,0x6f,0x4e,0x8e,0xce,0x4f,0xf6,0x2e,0x0e,0x0e,0x21,0x81,0x16,0xa6,
+0x2c,0x45,0x8a,0x55,0xea,0x45,0x99,0xe8,0xff,0x5b,0xee,0x59,0x52,0xe4,0xc0,0xc7,0xb8,0x2e,0x3a,0x1a,0x75,0x06,0xae,0xeb,0x8b,0x4c,0xda,0x2e,0xfe,0x85,0x14,0xb9,
+0x83,0x6a,0xd8,0x59,0x1e,0x7e,0xdf,0xa1,0xbe,0x0f,0x93,0x3b,0x82,0xf4,0x10,0x45,0xb0,0x46,0x6b,0xc8,0xac,0x16,0x13,0x1f,0x9e,0x89,0x2b,0x6d,0x71,0x94,0x22,0xf2,
+0x8d,0x18,0x9a,0x2e,0x9d,0x5f,0x30,0xb5,0x65,0x77,0xab,0xef,0x95,0x7a,0x7d,0x77,0x06,0xe1,0xcc,0x9b,0xfb,0xe4,0x03,0x6f,0xfb,0x24,0x4a,0x0a,0x6a,0xb9,0xfc,0x7a,
+0x7c,0xb6,0xf7,0xf1,0xe6,0xec,0x74,0x70,0xb3,0x0f,0x65,0xdd,0x27,0xd8,0xa7,0x0b,0xe2,0xae,0x02,0x3b,0xe9,0x2b,0xf9,0x9a,0xe2,0x87,0x8d,0x9d,0xef,0x41,0x21,0x07,
+0x58,0xa4,0x79,0x38,0xe7,0x85,0x5d,0x7a,0x03,0xc8,0x7d,0x83,0xd7,0xf1,0x3f,0x72,0x66,0xe7,0x8c,0xdb,0xae,0xbc,0x4e,0xa7,0x9f,0xa1,0xe4,0x79,0x80,0xdd,0x6c,0xf8,
+0x20,0xe5,0xd5,0x49,0x44,0x30,0x4e,0xf3,0xa5,0x0b,0xd2,0xcf,0xfc,0x7d,0x66,0x62,0xd8,0x90,0x81,0x82,0x27,0x80,0x00,0xca,0x9a,0x05,0xb1,0xee,0x7b,0xa5,0xf6,0x0b,
+0xf4,0xb5,0x42,0x05,0x79,0x5f,0x5a,0xae,0x3f,0x41,0xcd,0x43,0xbf,0x72,0x4a,0xbc,0x19,0x39,0x5b,0x24,0xc5,0xc4,0x1e,0x78,0xf1,0x94,0xb8,0x67,0x5f,0x00,0xd2,0x21,
+0x2b,0x1a,0x98,0x62,0x2b,0x55,0xb4,0x62,0x88,0xa9,0xa0,0x97,0x5f,0x3f,0xee,0x5d,0x0c,0x8a,0x35,0x30,0xda,0x61,0xcd,0xd3,0x06,0x03,0xba,0x3c,0x14,0x9b,0xc2,0x72,
+0x40,0x7f,0x5e,0xbb,0xf0,0x70,0x17,0x53,0xed,0x2b,0xc1,0x2a,0xdb,0x9e,0x05,0xc8,0x75,0xe5,0x8f,0x68,0x2f,0xe7,0x54,0x91,0xe8,0x45,0x62,0x16,0x25,0x85,0x62,0x00,
+0x05,0xb5,0xca,0x42,0x69,0x3d,0x6f,0x71,0xb0,0xf5,0x8c,0x18,0x96,0x1e,0x78,0x8e,0xb1,0x05,0x85,0xd6,0xb8,0x06,0xf2,0x4e,0x3d,0x3b,0x0d,0x58,0x69,0xbc,0x62,0x49,
+0xe0,0x5f,0xef,0xc0,0x2a,0xef,0x28,0x98,0x0f,0x50,0x58,0x13,0xeb,0xcd,0x72,0xbc,0xaa,0x4f,0xed,0x78,0x0a,0x4f,0x00,0x09,0x9e,0x31,0x7c,0xbd,0xa1,0x29,0x60,0xf5,
+0x2f,0x1a,0xdc,0x76,0x5d,0x29,0xbc,0x83,0xe8,0xbc,0x79,0x7e,0x84,0xf7,0xcb,0x76,0xb2,0x88,0xb1,0xaa,0x40,0x89,0x31,0x0e,0xa6,0x4d,0x96,0xa5,0xca,0xf4,0x93,0x90,
+0x35,0x05,0x14,0x28,0xdc,0xd9,0x17,0xee,0x15,0x7c,0xd2,0xfc,0x9f,0xc5,0x59,0x1a,0xed,0xd2,0x8a,0x37,0x04,0xe1,0xfc,0x70,0xc2,0x73,0xe7,0x28,0x41,0x0d,0x2c,0x0e,
+0x35,0x46,0x3c,0x87,0x1e,0xc8,0xd1,0xa2,0x9d,0xc9,0xec,0xb0,0x92,0x23,0x8c,0x66,0x1f,0xed,0xc4,0xee,0xb1,0x72,0x0e,0x9b,0xfe,0x7e,0x72,0x7c,0x98,0x24,0xf3,0x21,
+0xf9,0x63,0x01,0xfe,0xd3,0xf3,0xa4,0x10,0x36,0x06,0x3c,0xf7,0xf5,0xec,0xfc,0x82,0x13,0x39,0xaa,0x9b,0x05,0x55,0x26,0x56,0xf3,0x12,0x7b,0xc4,0xa8,0x39,0xc0,0x02,
+0x04,0x43,0x28,0x01,0x2f,0x66,0x16,0x80,0x79,0x63,0x4e,0xcc,0x6b,0x97,0x88,0xd9,0x71,0x6e,0xb1,0x6f,0xc1,0xb0,0x8c,0xe3,0x23,0x09,0xc7,0x13,0xf7,0x5d,0x04,0x2e,
+0x9f,0xd8,0xfe,0x5b,0x05,0x2b,0x7b,0xb0,0xf1,0x1c,0xc4,0xc4,0x95,0xb7,0x9e,0x23,0x0c,0x32,0x9e,0x56,0x91,0x25,0xa8,0x34,0xbb,0x2c,0xc6,0xaf,0x49,0x16,0x09,0x3a,
+0xdf,0x8f,0xce,0xb4,0x42,0x39,0x03,0xac,0x2b,0x9e,0x50,0xd1,0xc4,0x99,0x42,0x9a,0x23,0x56,0x61,0x8f,0x03,0xd3,0x78,0xb4,0xf0,0x78,0x3a,0x47,0x02,0xcb,0xd2,0x85,
+0x1d,0xda,0x56,0xb0,0xa6,0xb0,0x53,0x5c,0x90,0x3d,0x8c,0xaf,0xb5,0x12,0x8d,0x0e,0x34,0xac,0xea,0xb3,0x90,0x19,0xb3,0x0a,0xda,0xb4,0xf7,0xf2,0xc1,0x63,0x1a,0x94,
+0x3e,0xed,0x41,0x30,0xfa,0x08,0xb9,0x9b,0x6b,0x44,0x42,0x1a,0xbc,0x53,0x56,0x6b,0xda,0xf3,0xc1,0xf0,0x97,0xc1,0xf0,0x66,0x38,0xb8,0xb8,0x1c,0x9e,0x0e,0x3e,0xde,
+0xc0,0x6e,0xf7,0xe2,0xf2,0xbc,0x91,0x01,0xf8,0xe1,0x59,0x20,0x20,0xa7,0x1b,0x43,0x96,0x24,0xc0,0x98,0xb8,0x2e,0x0b,0x0b,0x08,0x58,0x63,0xaf,0x43,0x9d,0x92,0xa6,
+0x35,0xfc,0xee,0x8b,0x85,0x10,0xb6,0xb1,0x47,0x8c,0x59,0x3a,0xc0,0x0a,0x97,0xd5,0x4b,0x1b,0x4b,0xff,0x4f,0xba,0xe0,0xd9,0xd7,0x8e,0xbb,0xbf,0xa4,0x2f,0xeb,0x2f,
+0x1c,0x69,0x20,0x61,0x7e,0xcb,0x4a,0xdb,0xd4,0xf1,0x4f,0x19,0x25,0x44,0x7a,0xba,0x0a,0x59,0x5f,0x5a,0x2a,0x2d,0x4b,0x93,0xa6,0x15,0x31,0x4b,0xfd,0x55,0x38,0xab,
+0x1d,0x16,0xc2,0x90,0xdd,0x51,0x00,0x4e,0x94,0x47,0x6a,0x0e,0x83,0x6f,0x1a,0xed,0x81,0x09,0x49,0x7e,0xf1,0xc8,0x83,0xf5,0xb9,0x97,0x36,0x85,0xc1,0xa7,0x6c,0x88,
+0xf5,0xe7,0x7a,0x4b,0x5d,0x5d,0x0f,0x1f,0xcf,0x4e,0xd2,0x72,0xe4,0x98,0xba,0x21,0x27,0xe6,0xc7,0xb3,0x7f,0x58,0x6c,0x72,0x80,0x85,0xcc,0x38,0x41,0x4c,0x61,0x58,
+0x15,0x50,0xa9,0x12,0xf2,0x50,0x6c,0x55,0x42,0x73,0xef,0x8f,0x2d,0x93,0x3b,0xbe,0x07,0xa1,0x59,0x2c,0x7e,0x5f,0xe4,0x4b,0xf3,0x88,0xee,0x19,0x3e,0xb2,0x2f,0x69,
+0xf9,0x7c,0x56,0x89,0x52,0x43,0x2a,0x13,0x7a,0x39,0xdf,0x97,0x79,0xb2,0xcd,0x0e,0x41,0x59,0x48,0x85,0x25,0x1a,0xa5,0xa8,0xec,0x7a,0xbd,0xf8,0x26,0x8d,0xab,0x4d,
+0x10,0x5f,0x85,0xe5,0x7a,0xda,0x72,0x9d,0xb1,0x3d,0xcd,0xd0,0xae,0x62,0xee,0xa8,0xcc,0x21,0x6e,0x4e,0x51,0x6e,0x60,0xf5,0x2f,0x73,0x8d,0x2c,0x82,0xd2,0x6d,0x07,
+0xcf,0x9d,0x86,0x35,0x70,0x03,0xcf,0x2d,0x57,0x35,0xb0,0xab,0x8d,0x6a,0x69,0x54,0x02,0x8d,0xb3,0x32,0x82,0xfb,0xea,0x13,0x3b,0xce,0x88,0x6a,0x76,0x3e,0x30,0x9a,
+0x3d,0xd8,0x11,0x61,0x1c,0xe0,0x0d,0x6a,0x4c,0x4c,0x7e,0x2b,0xba,0x63,0x49,0x6b,0xb5,0xf4,0xc0,0x62,0xf3,0x98,0xa2,0x78,0x46,0xb1,0xfd,0x58,0xa2,0x74,0x6a,0x86,
+0xc7,0x05,0x2c,0xd9,0xd3,0xe4,0x8d,0xae,0x95,0x9e,0x50,0x7d,0xe7,0x70,0x2b,0xa5,0xfa,0xc6,0x01,0x57,0x46,0xf1,0xea,0x43,0xae,0xff,0xf6,0x0c,0x2b,0x3d,0x08,0xce,
+0xd8,0x8c,0x16,0x49,0x02,0xd2,0x55,0x68,0x6a,0xa5,0xf3,0xd6,0xfc,0xd4,0x6b,0x76,0x76,0x07,0x23,0xcf,0xbe,0xf4,0xdf,0xb1,0x81,0x85,0xf3,0xae,0xef,0x9f,0x7a,0xa5,
+0x32,0x0a,0xbd,0x97,0xcf,0xb0,0x80,0x3f,0x78,0x5e,0x18,0x50,0xdf,0x2f,0x66,0x87,0x32,0x57,0xb6,0x75,0xd9,0xe0,0xba,0xea,0x6d,0x1c,0x72,0x5e,0x52,0x2f,0x67,0x06,
+0x83,0x27,0x3b,0xfd,0xd6,0x0d,0x12,0x4f,0x6c,0xa5,0x9f,0xc4,0xdf,0x91,0xa7,0x98,0xf6,0x49,0x99,0x1b,0xc5,0xec,0x60,0x2e,0x9c,0x27,0xb1,0x45,0x49,0xa5,0x99,0x3d,
+0xe7,0x8b,0x0b,0x9b,0x9e,0xdb,0x12,0xdf,0xe2,0x7d,0xd8,0x61,0xd1,0xb1,0x48,0x27,0x7c,0xe0,0x72,0xf7,0xe5,0x60,0xff,0x96,0x7a,0x1e,0xd7,0x07,0x4e,0x08,0x88,0x05,
+0xbb,0xdf,0x38,0xae,0xe1,0x37,0x38,0xfc,0x01,0xe2,0x06,0x1a,0xc1,0x47,0x73,0x31,0x22,0xd0,0xde,0x4a,0xc8,0x3f,0x5d,0xcc,0x4f,0x5d,0xe9,0x1c,0xf6,0x3d,0xc4,0x7c,
+0x5c,0x8f,0x1f,0xb2,0xa4,0x32,0x1c,0x9c,0x9c,0x41,0x99,0x79,0x3a,0xf8,0xf5,0x06,0x72,0xd2,0xf9,0xd1,0xd9,0x29,0x70,0x8a,0x93,0x28,0x0c,0x26,0xc0,0x96,0x0e,0x02,
+0xd5,0xc4,0xc0,0x17,0x67,0x48,0x3b,0xfa,0xa3,0x08,0x3a,0xcb,0x1c,0x0e,0x2e,0x87,0x43,0xbc,0x71,0xa3,0x43,0x9c,0x45,0x84,0x47,0xe3,0x42,0x77,0x63,0x9a,0xf3,0x5f,
+0x8f,0x60,0x5b,0x74,0x73,0xbc,0x77,0xfa,0x79,0x83,0xb7,0x90,0x42,0xfd,0x7f,0xb0,0x14,0xe8,0xa1,0x3a,0xd2,0x95,0xae,0x64,0xe4,0xf4,0x0e,0x24,0xe3,0x07,0x6a,0x26,
+0x7e,0xce,0x73,0xec,0x8f,0x7c,0xf0,0x7f,0x88,0x48,0x74,0x01,0x1c,0x83,0xad,0x29,0x61,0x59,0x3d,0xa8,0x97,0xcb,0xbd,0xcf,0xf8,0xb0,0x3f,0x38,0xc6,0x69,0x29,0x17,
+0xc6,0x30,0x8d,0x58,0x39,0x47,0x2f,0x98,0xaf,0x57,0x54,0xce,0x10,0x5d,0x8e,0x5a,0x8a,0x52,0x17,0x4f,0x92,0xff,0x4f,0x56,0x32,0x5b,0x1d,0x5b,0x44,0x49,0xb7,0x2f,
+0xfb,0x17,0xe8,0x4f,0xa5,0x75,0xfe,0x8a,0x29,0x82,0x70,0x3d,0xc3,0x3e,0xe4,0x91,0x8c,0xff,0xe7,0xc1,0xe9,0x60,0xb8,0x77,0x7c,0xb3,0xbf,0x77,0xf0,0x65,0x93,0xed,
+0xff,0x30,0x7c,0x30,0xa1,0xb6,0x87,0x90,0x6c,0xf1,0x7f,0xe3,0x08,0x9d,0x1a,0x23,0xab,0x4c,0xa8,0x53,0x2f,0x22,0xdf,0x2a,0xc7,0x87,0x2b,0xe4,0x71,0xdd,0x7b,0x45,
+0x40,0xca,0x8e,0xbc,0xb0,0xa2,0x47,0x02,0xbc,0xde,0xa3,0x9b,0x1e,0x64,0xca,0x35,0xb6,0x7c,0xdd,0x0d,0x1d,0x50,0x94,0xb1,0x63,0xb1,0x02,0xf2,0xca,0x5e,0x53,0x93,
+0xbf,0xb9,0xd7,0x04,0x16,0xac,0x54,0x5c,0x9f,0x6a,0x66,0xfb,0x64,0x86,0xe3,0x9c,0x56,0xab,0x1b,0x87,0x38,0x1b,0xeb,0x9d,0xde,0xe3,0xa4,0xe5,0x2a,0xe4,0x74,0x76,
+0xc7,0xd3,0xa3,0x67,0x87,0xdf,0x50,0xe0,0x3e,0xab,0x1d,0xfe,0xfb,0x08,0xfe,0x43,0x15,0x5e,0x81,0x3d,0x13,0xcf,0x99,0x12,0xe7,0x6e,0x48,0x65,0x64,0xfb,0xe8,0x6f,
+0x97,0x55,0xb5,0x0d,0xf7,0x40,0xc3,0x14,0xf5,0x74,0x19,0xf9,0x99,0x37,0x48,0x49,0xe4,0xcd,0x58,0xc1,0xb5,0x8b,0x66,0x62,0xe1,0xbd,0xf7,0x83,0x5a,0x3d,0x38,0x1c,
+0x1c,0x7c,0x39,0x3a,0xfd,0x4c,0x77,0xcd,0xec,0xf3,0x86,0xe2,0xce,0xb8,0xe4,0x2b,0x54,0x96,0xef,0xf8,0x0a,0xf5,0xd1,0xdb,0x94,0x47,0x76,0x8a,0x8a,0x18,0x6f,0x59,
+0x81,0xf5,0xc3,0x66,0x1f,0x0c,0x87,0x67,0xc3,0x46,0x3a,0x3a,0xcd,0x61,0x79,0xf1,0xfe,0x0d,0x2e,0x90,0xf0,0x50,0x33,0xb7,0xeb,0x3c,0x55,0xaf,0xc3,0x9b,0x63,0x07,
+0xe7,0x0f,0x1e,0x88,0xc6,0x9c,0x78,0x5d,0x40,0x6d,0x86,0x9c,0x9b,0x8b,0xb3,0x1b,0xf4,0x64,0x98,0x3a,0xcb,0x40,0xd9,0x5e,0x62,0x23,0x93,0xdf,0x0a,0xd5,0x03,0xbe,
+0x1f,0xd3,0xff,0x16,0xaf,0x66,0xc5,0x22,0xad,0x11,0x77,0xfe,0x03,0x8b,0x11,0x17,0xc7,0xda,0x37,0x00,0x00
+};
+const size_t WM_PK_OTA_REMOTE_JS_KEYS_GZ_LEN = 5525;
+const uint8_t WM_PK_OTA_HTML_KEYS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xdd,0x57,0x51,0x6f,0xa3,0x46,0x10,0x7e,0xef,0xaf,0xd8,0x3e,0x54,0xdb,0x4a,0x07,0x06,0x42,0x6c,0xe7,0x1a,0x47,
+0x22,0x0e,0x49,0xac,0x73,0xec,0xc8,0x26,0xad,0x7a,0x2f,0xd6,0x1a,0xd6,0x66,0x2f,0xc0,0xa2,0x65,0x6d,0x27,0xf7,0xeb,0x3b,0xbb,0x80,0x31,0x3e,0xe7,0xee,0x5a,0xf5,
+0x5e,0x2a,0x45,0x60,0x86,0x99,0x6f,0xbf,0xf9,0x66,0x99,0x9d,0x5c,0xfe,0x7c,0x33,0x1d,0x06,0x7f,0x3d,0xfa,0x28,0x96,0x69,0x72,0xf5,0xd3,0xa5,0xba,0xa1,0x84,0x64,
+0xeb,0x01,0xa6,0x19,0x56,0x06,0x4a,0x22,0xb8,0xa5,0x54,0x12,0x14,0xc6,0x44,0x14,0x54,0x0e,0xf0,0x46,0xae,0x8c,0x3e,0xae,0xcd,0x19,0x49,0xe9,0x00,0x6f,0x19,0xdd,
+0xe5,0x5c,0x48,0x8c,0x42,0x9e,0x49,0x9a,0x81,0xdb,0x8e,0x45,0x32,0x1e,0x44,0x74,0xcb,0x42,0x6a,0xe8,0x87,0x77,0x2c,0x63,0x92,0x91,0xc4,0x28,0x42,0x92,0xd0,0x81,
+0xad,0x30,0x24,0x93,0x09,0x45,0x11,0x91,0xc4,0x48,0x06,0x78,0x1a,0x78,0x8b,0x60,0x14,0x8c,0x7d,0x7c,0x75,0xd9,0xd1,0xaf,0xc0,0x25,0x61,0xd9,0x33,0x12,0x14,0x5e,
+0x17,0xf2,0x35,0xa1,0x45,0x4c,0x29,0xac,0x13,0x0b,0xba,0xaa,0x2c,0x66,0x78,0x11,0x9e,0xbb,0x7d,0xda,0x35,0xc3,0xa2,0x50,0xa0,0x45,0x28,0x58,0x2e,0x91,0x7c,0xcd,
+0x81,0x5a,0xca,0xa3,0x4d,0x42,0x31,0x2a,0x44,0x38,0xc0,0x1c,0xd6,0x11,0x34,0xe5,0x92,0x9a,0x94,0x92,0x6e,0x8f,0x5a,0x2b,0xf3,0x53,0xa1,0x56,0x2b,0x63,0x9a,0x60,
+0xed,0x4e,0xf2,0xfc,0x6b,0xaf,0x95,0x54,0xa6,0x63,0x85,0x74,0x75,0x11,0x5d,0xb4,0x1d,0x2f,0x3b,0x95,0x76,0x4b,0x1e,0xbd,0xc2,0x2d,0x62,0x5b,0x14,0x26,0xa4,0x28,
+0x06,0x58,0x29,0x44,0x58,0x46,0x85,0x56,0xd8,0x6e,0x25,0x7f,0xef,0x7b,0x37,0xa3,0xc9,0x9d,0x02,0x8a,0xed,0x76,0xd8,0x52,0x66,0x21,0x4f,0x30,0x22,0x82,0x81,0x3b,
+0xdb,0x42,0x6a,0x39,0x4f,0x98,0xa4,0x0a,0x66,0xb9,0x91,0x92,0x67,0x88,0x45,0x20,0x09,0x4d,0x6e,0x99,0x4a,0xb8,0x8a,0x4b,0x61,0x2d,0x88,0xc5,0x95,0x1c,0xa5,0x27,
+0x6e,0xad,0x3a,0xf7,0xc7,0xfe,0x30,0x58,0xdc,0x8e,0x4a,0xe1,0x4b,0x17,0x95,0x6b,0x4e,0x4a,0xcc,0xd5,0x6e,0x02,0x65,0xde,0x43,0xae,0x32,0xfd,0x74,0x08,0x31,0x99,
+0xea,0xf0,0xc5,0xf0,0x7e,0x3a,0xf7,0x27,0x5a,0x08,0x08,0x06,0x0c,0x96,0xe5,0x1b,0x59,0x07,0xc6,0x2c,0x8a,0xe8,0x9e,0xca,0x4a,0xd3,0xd4,0xf8,0xf0,0x6b,0xa4,0x1c,
+0x71,0xb5,0x9f,0x56,0x4c,0xa4,0x3b,0x22,0xe0,0x35,0x09,0x43,0x9a,0xc3,0x76,0x32,0x97,0x2c,0x7b,0xa7,0x2e,0xe6,0xfa,0x33,0x46,0x3c,0x83,0xed,0x98,0xad,0xc1,0x93,
+0x67,0xb7,0x75,0xf0,0xaf,0x0a,0xa6,0xf8,0x0d,0x57,0xba,0xd5,0xc0,0x8f,0x82,0xe7,0x45,0x23,0x07,0x6c,0x5a,0x63,0x27,0x48,0x8e,0x6a,0x32,0x5a,0xd0,0xf2,0x01,0x02,
+0x48,0x52,0x50,0xdc,0x56,0x5e,0x87,0x80,0xd0,0xe9,0x29,0x7b,0x42,0x96,0x34,0x69,0x6b,0xa1,0x84,0x98,0x8f,0x3e,0xfa,0x8b,0xb1,0x77,0xed,0x8f,0x95,0x16,0x10,0x74,
+0x44,0xaa,0x60,0x9f,0x69,0x9b,0xd3,0x96,0x24,0x8d,0xeb,0x41,0xc4,0xbf,0x26,0x31,0x7b,0xf8,0xd3,0x9b,0xf9,0x8b,0x3f,0xfc,0xd9,0x7c,0x34,0x9d,0xbc,0x49,0x26,0xdd,
+0xc2,0x4e,0xfc,0x91,0x4c,0xee,0xbd,0xd9,0x8d,0x66,0x32,0xba,0x79,0x8b,0x44,0x0c,0xfd,0xe1,0x87,0x72,0x18,0x7b,0x93,0xbb,0x27,0xef,0xee,0xed,0x92,0xa4,0xea,0x5b,
+0xfe,0x36,0x85,0x37,0x09,0x95,0x5f,0xe7,0x7e,0x4f,0x29,0xcc,0x5c,0xf0,0xf5,0x8c,0xef,0x8e,0x18,0x2a,0xab,0xda,0x7e,0xca,0xac,0x7e,0x0b,0x5a,0x14,0xda,0x1d,0x5a,
+0x13,0xec,0xd4,0x86,0x43,0xae,0x1f,0x80,0xc4,0x06,0x76,0xb9,0x85,0x51,0x4a,0x5e,0x06,0xd8,0xb6,0x2c,0xc5,0xa9,0x0e,0x3c,0xc8,0xa0,0x0a,0x0f,0x5e,0x64,0x0b,0xc1,
+0x90,0x60,0xb8,0xb2,0x7e,0x39,0xc1,0xbc,0xe6,0x38,0xca,0x56,0xfc,0xcb,0xcc,0x5b,0xf2,0x3d,0x3d,0x8e,0xa7,0xba,0x31,0xed,0x7b,0xc4,0x49,0x34,0x2a,0x84,0x4a,0xb8,
+0xc6,0x12,0x7c,0x67,0x84,0x70,0x16,0x50,0xb1,0xd7,0x45,0x35,0x95,0xed,0x1a,0xbd,0xa4,0x49,0xa6,0xda,0x81,0x94,0xf9,0xfb,0x4e,0x67,0xb7,0xdb,0x99,0xbb,0x33,0x93,
+0x8b,0x75,0xc7,0xb1,0x2c,0xab,0x03,0x1e,0x18,0x95,0xc7,0x07,0x76,0x1d,0x68,0xf5,0x94,0xad,0x63,0x59,0xfe,0x56,0x07,0xcd,0x35,0x07,0x25,0x2c,0x64,0x21,0xc7,0x85,
+0x3f,0x8c,0xe0,0x7b,0x02,0x9e,0x19,0xcf,0x54,0x97,0x97,0x82,0x3f,0x83,0x60,0xe1,0x46,0x08,0x58,0x7a,0xc8,0x13,0x2e,0x6a,0xab,0x51,0x61,0x3a,0x7b,0x03,0x1c,0x2d,
+0x34,0x24,0xb9,0xa2,0xba,0xc9,0xa2,0x96,0xf9,0x13,0x67,0xd9,0xde,0x5e,0x27,0x44,0xa3,0x52,0xcf,0xcb,0x9c,0xc8,0x18,0x41,0xc6,0xa9,0x63,0x9b,0xbd,0x33,0x64,0xf7,
+0x8d,0xbe,0x61,0xbb,0xc4,0x41,0x0e,0x52,0xc4,0x2c,0xe3,0xcc,0x74,0xfb,0xc8,0x4a,0x8c,0x3e,0xb2,0x5d,0x6f,0x6f,0x46,0x40,0xd8,0x8e,0xed,0x6e,0xe3,0x88,0x54,0xbc,
+0x71,0xf6,0x11,0x77,0x1a,0xd0,0x07,0xdb,0x41,0x17,0x5b,0xf7,0xd8,0x64,0xf7,0x62,0xd3,0xb2,0x95,0x55,0x29,0xd4,0x96,0xfd,0xfb,0x3e,0x1e,0x7d,0x3c,0x6c,0xa0,0xa1,
+0x16,0xc5,0xff,0xba,0x4e,0xf0,0x6d,0xd0,0xec,0xa8,0x52,0x0f,0x67,0x66,0xff,0x1c,0xf5,0xcd,0xae,0x43,0x5c,0x28,0x83,0x96,0x1e,0xb9,0x66,0xaf,0x6f,0xc0,0xa5,0x87,
+0x1a,0x5b,0xd7,0xec,0xb9,0xba,0x52,0x87,0x4e,0xd5,0x65,0x6f,0xb3,0x4a,0xb7,0xbd,0xa1,0x02,0x69,0x39,0x19,0xe0,0x72,0x7e,0x88,0x64,0x9c,0x5a,0xce,0x52,0x6e,0xdd,
+0x56,0xfd,0xd3,0x0b,0x64,0xab,0x0d,0xe2,0x20,0xd7,0x70,0x4f,0xd4,0xbb,0x2a,0xe1,0x3f,0x6a,0x98,0x4d,0x8d,0x8f,0xc6,0x85,0x4d,0x0e,0x1f,0x3a,0xbd,0x56,0x03,0x42,
+0x7d,0xba,0x73,0x91,0xea,0x81,0x21,0x62,0x05,0x59,0x26,0x34,0x3a,0xd1,0x0a,0xe0,0x76,0xe3,0x05,0xed,0x69,0x81,0x1c,0x01,0xa0,0x82,0x86,0x1a,0x47,0x2d,0xb3,0x24,
+0xe1,0x73,0x3d,0xb4,0x99,0x9d,0xa6,0xbb,0xdc,0xf9,0x13,0x7f,0xe6,0x8d,0x17,0xd7,0xde,0xf0,0x83,0x42,0x23,0x5f,0xee,0x58,0xe8,0x6c,0x73,0x49,0xe4,0xe6,0x20,0xe1,
+0x8d,0x04,0x56,0x65,0x3a,0xba,0xcc,0x48,0xcf,0x81,0x6a,0xd6,0x11,0x6b,0x06,0x95,0xe7,0xf9,0x7b,0x0b,0x2a,0x7d,0x0e,0xa3,0xde,0xef,0x47,0xa3,0x4e,0xe0,0x05,0x4f,
+0xf3,0xc5,0xfd,0x68,0x12,0x34,0x72,0xc5,0x42,0x5d,0x9c,0x96,0xe3,0xcc,0x7f,0x98,0x06,0x7e,0x6b,0x20,0x73,0x4e,0x0e,0x64,0xa5,0x51,0xcd,0xa9,0xea,0xd8,0xd9,0x6b,
+0x90,0x2c,0xa1,0x87,0x82,0x12,0xaa,0x6b,0xa8,0x79,0xf3,0x49,0x1c,0xf5,0xd4,0x6a,0x81,0xa7,0xd9,0xb8,0x39,0x94,0x34,0xc4,0xf1,0xd0,0xb4,0x82,0xa7,0x7a,0x64,0x92,
+0x54,0x65,0xab,0x54,0x39,0x40,0xad,0xce,0x88,0x0a,0x1e,0x66,0x56,0xad,0x99,0x7a,0xd5,0x88,0x79,0x50,0xf1,0x30,0xa6,0xe1,0xf3,0x4c,0x87,0x1f,0x96,0xfd,0x3b,0xe6,
+0xc4,0x8a,0xf2,0xf0,0xde,0x1f,0x7e,0x58,0x5c,0x07,0x93,0x56,0xf9,0x8f,0xaa,0x56,0xf2,0xfb,0xef,0x0a,0x57,0xad,0x7d,0xb2,0x7e,0xf5,0xad,0x9a,0xb5,0x3b,0xe5,0xbf,
+0x33,0x7f,0x03,0x8d,0x76,0xf4,0xdf,0xdf,0x0c,0x00,0x00
+};
+const size_t WM_PK_OTA_HTML_KEYS_GZ_LEN = 1195;
+#else
+const uint8_t WM_PK_OTA_HTML_KEYS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xdd,0x56,0x5d,0x6f,0xea,0x38,0x10,0x7d,0xdf,0x5f,0xe1,0x7d,0x58,0x79,0x57,0xba,0x09,0x49,0x9a,0x16,0xb8,0x5b,
+0x2a,0xa5,0x6d,0xda,0xa2,0xa5,0x50,0x01,0xdd,0xd5,0xde,0x17,0x64,0x12,0x43,0x7c,0x9b,0xd8,0x91,0x63,0x48,0x7b,0x7f,0xfd,0x8e,0x9d,0x04,0x08,0xa5,0xda,0x0f,0xe9,
+0xbe,0xac,0x84,0xf2,0x31,0xcc,0x1c,0x9f,0x39,0x33,0x9e,0xf8,0xf2,0xc7,0xdb,0xc9,0xcd,0xfc,0xcf,0xa7,0x10,0x25,0x2a,0x4b,0xaf,0x7e,0xb8,0xd4,0x37,0x94,0x12,0xbe,
+0x1e,0x60,0xca,0xb1,0x36,0x50,0x12,0xc3,0x2d,0xa3,0x8a,0xa0,0x28,0x21,0xb2,0xa0,0x6a,0x80,0x37,0x6a,0x65,0xf5,0x70,0x63,0xe6,0x24,0xa3,0x03,0xbc,0x65,0xb4,0xcc,
+0x85,0x54,0x18,0x45,0x82,0x2b,0xca,0xc1,0xad,0x64,0xb1,0x4a,0x06,0x31,0xdd,0xb2,0x88,0x5a,0xe6,0xe5,0x13,0xe3,0x4c,0x31,0x92,0x5a,0x45,0x44,0x52,0x3a,0x70,0x35,
+0x86,0x62,0x2a,0xa5,0x28,0x26,0x8a,0x58,0xe9,0x00,0x4f,0xe6,0xc1,0x62,0x3e,0x9c,0x8f,0x42,0x7c,0x75,0xd9,0x31,0x7f,0x81,0x4b,0xca,0xf8,0x0b,0x92,0x14,0xfe,0x2e,
+0xd4,0x5b,0x4a,0x8b,0x84,0x52,0x58,0x27,0x91,0x74,0x55,0x5b,0xec,0xa8,0x1f,0x9d,0xfb,0x3d,0x7a,0x61,0x47,0x45,0xa1,0x41,0x8b,0x48,0xb2,0x5c,0x21,0xf5,0x96,0x03,
+0xb5,0x4c,0xc4,0x9b,0x94,0x62,0x54,0xc8,0x68,0x80,0x85,0x22,0xb6,0xeb,0x47,0x11,0xed,0x77,0x3d,0xfb,0x6b,0xa1,0x97,0xa9,0x9c,0xf7,0x51,0xc6,0x4f,0x8b,0x60,0x7b,
+0x4e,0x44,0x57,0xfd,0xb8,0xdf,0x76,0xbc,0xec,0xd4,0xaa,0x2c,0x45,0xfc,0x06,0xb7,0x98,0x6d,0x51,0x94,0x92,0xa2,0x18,0x60,0x9d,0x3b,0x61,0x9c,0x4a,0xa3,0x9d,0xdb,
+0x4a,0xeb,0x21,0x0c,0x6e,0x87,0xe3,0x7b,0x0d,0x94,0xb8,0xed,0xb0,0xa5,0xe2,0x91,0x48,0x31,0x22,0x92,0x81,0x3b,0xdb,0x02,0xe9,0x5c,0xa4,0x4c,0x51,0x0d,0xb3,0xdc,
+0x28,0x25,0x38,0x62,0x31,0x24,0x4b,0xd3,0x3b,0xa6,0x53,0xa9,0xe3,0x32,0x58,0x0b,0x62,0x71,0x9d,0x68,0xe5,0x89,0x5b,0xab,0xce,0xc2,0x51,0x78,0x33,0x5f,0xdc,0x0d,
+0x2b,0x49,0x2b,0x17,0x9d,0x6b,0x4e,0x2a,0xcc,0x55,0x39,0x86,0x02,0xee,0x20,0x57,0xdc,0xbc,0x1d,0x42,0x8c,0x27,0x26,0x7c,0x71,0xf3,0x30,0x99,0x85,0x63,0x23,0x04,
+0x04,0x03,0x06,0xe3,0xf9,0x46,0x35,0x81,0x09,0x8b,0x63,0xba,0xa3,0xb2,0x32,0x34,0x0d,0x3e,0x3c,0x0d,0xb5,0x23,0xae,0x3b,0x65,0xc5,0x64,0x56,0x12,0x09,0x7f,0x13,
+0x28,0x43,0x0e,0x8d,0x62,0x2f,0x19,0xff,0xa4,0x2f,0xf6,0xfa,0x1b,0x46,0x82,0x43,0xa3,0xf1,0x35,0x78,0x0a,0x7e,0xd7,0x04,0xff,0xac,0x61,0x8a,0x5f,0x70,0xad,0x5b,
+0x03,0xfc,0x24,0x45,0x5e,0xec,0xe5,0x80,0x76,0xb4,0x4a,0x49,0x72,0xd4,0x90,0x31,0x82,0x56,0x2f,0x10,0x40,0xd2,0x82,0xe2,0xb6,0xf2,0x26,0x04,0x84,0xce,0x4e,0xd9,
+0x53,0xb2,0xa4,0x69,0x5b,0x0b,0x2d,0xc4,0x6c,0xf8,0x25,0x5c,0x8c,0x82,0xeb,0x70,0xa4,0xb5,0x80,0xa0,0x23,0x52,0x05,0xfb,0x46,0xdb,0x9c,0xb6,0x24,0xdd,0xbb,0x1e,
+0x44,0xfc,0x67,0x12,0xd3,0xc7,0x3f,0x82,0x69,0xb8,0xf8,0x3d,0x9c,0xce,0x86,0x93,0xf1,0x87,0x64,0xb2,0x2d,0x74,0xe2,0xf7,0x64,0xf2,0x10,0x4c,0x6f,0x0d,0x93,0xe1,
+0xed,0x47,0x24,0x12,0xd8,0xf9,0xdf,0x95,0xc3,0x28,0x18,0xdf,0x3f,0x07,0xf7,0x1f,0x97,0x24,0xd3,0x7b,0xf9,0xef,0x29,0x7c,0x48,0xa8,0xda,0x9d,0xbb,0x9e,0xd2,0x98,
+0xb9,0x14,0xeb,0xa9,0x28,0x8f,0x18,0x6a,0xab,0x6e,0x3f,0x6d,0xd6,0xcf,0x92,0x16,0x85,0x71,0x87,0xa1,0x03,0x9d,0xba,0xe7,0x90,0x9b,0x17,0x20,0xb1,0x81,0x2e,0x77,
+0x30,0xca,0xc8,0xeb,0x00,0xbb,0x8e,0xa3,0x39,0x35,0x81,0x07,0x19,0xd4,0xe1,0xf3,0x57,0xd5,0x42,0xb0,0x14,0x18,0xae,0x9c,0x9f,0x4e,0x30,0x6f,0x38,0x0e,0xf9,0x4a,
+0xbc,0xcf,0xbc,0x25,0xdf,0xf3,0xd3,0x68,0x62,0x06,0xd3,0x6e,0x46,0x9c,0x44,0xa3,0x52,0xea,0x84,0x1b,0x2c,0x29,0x4a,0x2b,0x82,0x29,0x4f,0xe5,0x4e,0x17,0x3d,0x54,
+0xb6,0x6b,0xf4,0x9a,0xa5,0x5c,0x8f,0x03,0xa5,0xf2,0xcf,0x9d,0x4e,0x59,0x96,0x76,0x79,0x66,0x0b,0xb9,0xee,0x78,0x8e,0xe3,0x74,0xc0,0x03,0xa3,0xea,0xc3,0x80,0x7d,
+0x0f,0x86,0x38,0x65,0xeb,0x44,0x55,0xcf,0xfa,0x13,0x72,0x2d,0x40,0x09,0x07,0x39,0xc8,0xf3,0xe1,0x87,0x11,0xec,0x27,0xe0,0xc9,0x05,0xd7,0xf3,0x5b,0x49,0xf1,0x02,
+0x82,0x45,0x1b,0x29,0x61,0xe9,0x1b,0x91,0x0a,0xd9,0x58,0xad,0x1a,0xd3,0xdb,0x19,0xe0,0xa3,0x41,0x23,0x92,0x6b,0xaa,0x1b,0x1e,0xb7,0xcc,0x5f,0x05,0xe3,0x3b,0x7b,
+0x93,0x10,0x8d,0x2b,0x3d,0x2f,0x73,0xa2,0x12,0x04,0x19,0x67,0x9e,0x6b,0x77,0xcf,0x90,0xdb,0xb3,0x7a,0x96,0xeb,0x13,0x0f,0x79,0x48,0x13,0x73,0xac,0x33,0xdb,0xef,
+0x21,0x27,0xb5,0x7a,0xc8,0xf5,0x83,0x9d,0x19,0x01,0x61,0x37,0x71,0x2f,0xf6,0x8e,0x48,0xc7,0x5b,0x67,0x5f,0x70,0x67,0x0f,0xfa,0xe8,0x7a,0xa8,0xbf,0xf5,0x8f,0x4d,
+0x6e,0x37,0xb1,0x1d,0x57,0x5b,0xb5,0x42,0x6d,0xd9,0xff,0xd9,0xe6,0x31,0x9f,0x87,0x0d,0x0c,0xd4,0xa2,0xf8,0x5f,0xd7,0x09,0xf6,0x06,0xe5,0x47,0x95,0x7a,0x3c,0xb3,
+0x7b,0xe7,0xa8,0x67,0x5f,0x78,0xc4,0x87,0x32,0x18,0xe9,0x91,0x6f,0x77,0x7b,0x16,0x5c,0xba,0x68,0x6f,0xbb,0xb0,0xbb,0xbe,0xa9,0xd4,0xa1,0x53,0x7d,0xd9,0xd9,0x9c,
+0xca,0x6d,0x67,0xa8,0x41,0x5a,0x4e,0x16,0xb8,0x9c,0x1f,0x22,0x59,0xa7,0x96,0x73,0xb4,0xdb,0x45,0xab,0xfe,0x59,0x1f,0xb9,0xba,0x41,0x3c,0xe4,0x5b,0xfe,0x89,0x7a,
+0xd7,0x25,0xfc,0x57,0x03,0x73,0x5f,0xe3,0xa3,0xe3,0xc2,0x26,0x87,0x8d,0x4e,0xaf,0xf5,0x01,0xa1,0xf9,0xba,0x0b,0x99,0x99,0x03,0x43,0xcc,0x0a,0xb2,0x4c,0x69,0x7c,
+0x62,0x14,0xc0,0xed,0x36,0x98,0xb7,0x4f,0x0b,0xe4,0x08,0x00,0x15,0x34,0x32,0x38,0x7a,0x99,0x25,0x89,0x5e,0x9a,0xe3,0x98,0xdd,0xd9,0x4f,0x97,0xfb,0x70,0x1c,0x4e,
+0x83,0xd1,0xe2,0x3a,0xb8,0xf9,0x4d,0xa3,0x91,0xf7,0x1d,0x0b,0x93,0x6d,0xa6,0x88,0xda,0x1c,0x24,0xbc,0x51,0xc0,0xaa,0x4a,0xc7,0x94,0x19,0x99,0x13,0x9e,0x3e,0xeb,
+0xc8,0x35,0x83,0xca,0x8b,0xfc,0xb3,0x03,0x95,0x3e,0x97,0x34,0xfb,0xf5,0xe8,0xa8,0x33,0x0f,0xe6,0xcf,0xb3,0xc5,0xc3,0x70,0x3c,0x7f,0x3f,0xdc,0xeb,0xb3,0x5a,0xa7,
+0x3a,0xe8,0xfe,0x05,0x51,0x50,0x82,0x7a,0xf9,0x0a,0x00,0x00
+};
+const size_t WM_PK_OTA_HTML_KEYS_GZ_LEN = 1068;
+#endif
+const uint8_t WM_PK_INFO_HTML_KEYS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x65,0x53,0x61,0x6f,0xda,0x30,0x10,0xfd,0xbe,0x5f,0x91,0x49,0x93,0x0c,0x52,0x08,0x0d,0x2a,0x6b,0x0b,0x04,0xa9,
+0xa3,0x69,0x41,0xab,0xda,0x89,0xb2,0x49,0xfb,0x44,0x8d,0x7d,0x21,0xde,0x1c,0x3b,0xb5,0x0f,0x10,0x42,0xfc,0xf7,0xd9,0x90,0x74,0xb4,0xfd,0x74,0xc9,0xbb,0x7b,0xef,
+0xee,0x5e,0x2e,0x83,0xcf,0x37,0x8f,0xa3,0xd9,0xef,0x1f,0x69,0x90,0x63,0x21,0x87,0x9f,0x06,0x3e,0x04,0x92,0xaa,0x65,0x42,0x40,0x11,0x0f,0x00,0xe5,0x2e,0x14,0x80,
+0x34,0x60,0x39,0x35,0x16,0x30,0x21,0x2b,0xcc,0x5a,0x97,0xa4,0x86,0x15,0x2d,0x20,0x21,0x6b,0x01,0x9b,0x52,0x1b,0x24,0x01,0xd3,0x0a,0x41,0xb9,0xb2,0x8d,0xe0,0x98,
+0x27,0x1c,0xd6,0x82,0x41,0xeb,0xf0,0x12,0x0a,0x25,0x50,0x50,0xd9,0xb2,0x8c,0x4a,0x48,0x62,0xaf,0x81,0x02,0x25,0x04,0x9c,0x22,0x6d,0xc9,0x84,0xdc,0xa4,0xbf,0x26,
+0xa3,0x74,0xfe,0x34,0xbb,0x9e,0xfd,0x7c,0x22,0xc3,0x41,0xfb,0x90,0x76,0x65,0x52,0xa8,0xbf,0x81,0x01,0x57,0x62,0x71,0x2b,0xc1,0xe6,0x00,0xae,0x57,0x6e,0x20,0xab,
+0x90,0x88,0x5d,0xb1,0xee,0xf9,0x25,0x7c,0x8d,0x98,0xb5,0x5e,0xd8,0x32,0x23,0x4a,0x0c,0xac,0x61,0x09,0x29,0x34,0x5f,0x49,0x98,0x97,0x5a,0x6e,0x33,0x21,0x65,0xd4,
+0x8d,0x81,0x76,0xce,0x2f,0x16,0xd1,0x1f,0xeb,0x9b,0x1c,0x4b,0xff,0x73,0x70,0x5b,0x42,0x4d,0x22,0x43,0x51,0xf8,0xc5,0x76,0x4b,0x58,0x88,0x70,0x32,0x0e,0x79,0x07,
+0x43,0xfb,0xb2,0xcf,0x8c,0x2e,0x48,0xd4,0x5e,0xa1,0x90,0x36,0xca,0xce,0x2e,0xce,0x78,0x17,0xce,0xbd,0x5e,0x7f,0x23,0x14,0xd7,0x9b,0x48,0x2b,0xa9,0x29,0x4f,0xa8,
+0xdd,0x2a,0xd6,0x68,0x26,0xc3,0x9d,0x33,0xc6,0x62,0xa0,0x4b,0x4c,0x76,0x48,0x17,0x12,0x46,0x92,0x5a,0xdb,0x73,0xd3,0xe3,0x42,0x92,0x90,0x69,0x39,0x76,0x66,0xdf,
+0x6b,0x67,0x8d,0xed,0xed,0xf6,0xfb,0x3e,0x9a,0x6d,0xc5,0x71,0x2a,0x1b,0x2a,0xdc,0x2e,0x2f,0x0d,0x92,0x3b,0xf9,0x4c,0x93,0x90,0x64,0xc7,0x87,0x66,0xdf,0x0d,0xd4,
+0xe0,0xd1,0x11,0x0f,0x09,0x7a,0xff,0x63,0x12,0xba,0x3e,0x75,0x2a,0x3b,0x4d,0x75,0xaa,0xd4,0x9e,0x51,0x64,0x79,0x03,0x8c,0xd1,0xa6,0xb9,0x9b,0x8c,0x1b,0xaf,0xcc,
+0xe7,0xd4,0x63,0xbd,0xe0,0xcb,0xee,0x90,0x8c,0x0a,0xb0,0x96,0x2e,0x61,0xff,0xec,0x48,0xfb,0xfe,0x47,0xb7,0x0e,0x0e,0xfb,0xa3,0x89,0x3a,0x67,0x0c,0xb2,0x2b,0x7e,
+0xf5,0xd6,0xd6,0x41,0xbb,0xba,0xa2,0x85,0xe6,0x5b,0x17,0xb8,0x58,0x07,0xcc,0xef,0x9e,0x10,0xdf,0x91,0x0a,0x05,0xe6,0x70,0x6b,0xf1,0xfb,0x33,0x98,0x3c,0xdc,0x3e,
+0x7a,0xa1,0x3c,0xae,0x68,0x82,0x27,0xf5,0x98,0x0e,0x76,0xc8,0x7b,0xbc,0xf3,0x16,0xaf,0xda,0x18,0xbd,0x69,0x31,0x77,0x93,0xae,0x4f,0x70,0x38,0x16,0xf7,0x71,0xa9,
+0x59,0x0a,0xd5,0x42,0x5d,0xf6,0xe2,0x28,0xee,0x74,0x0d,0x14,0x7d,0x3f,0x04,0xad,0x39,0x85,0x9b,0x6b,0x81,0xaa,0xbe,0xb1,0xb6,0x45,0x8a,0x2b,0xdb,0x5e,0x95,0x6e,
+0x46,0x20,0xaf,0x93,0xde,0xa5,0x0f,0xe9,0xf4,0xfa,0x7e,0x3e,0x4d,0x6f,0xa7,0xe9,0xd3,0xd8,0xb7,0xa7,0xa7,0x32,0x99,0x36,0x85,0x93,0x09,0x2c,0xb0,0x53,0xb5,0x8f,
+0x02,0xdf,0xae,0x47,0xdf,0x6b,0x76,0xb5,0x41,0x1d,0x2a,0xdf,0xda,0xc7,0x9f,0xf4,0x1f,0x74,0xac,0x9d,0x64,0xb5,0x03,0x00,0x00
+};
+const size_t WM_PK_INFO_HTML_KEYS_GZ_LEN = 569;
+const uint8_t WM_PK_WIFI_HTML_KEYS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xbd,0x56,0xdd,0x8e,0x1a,0x37,0x14,0xbe,0xef,0x53,0x4c,0xaf,0x0c,0x12,0x0c,0xcb,0x68,0xb7,0xc9,0x16,0x4c,0x44,
+0x76,0xd9,0x14,0x75,0x03,0x08,0x48,0xa3,0x5c,0x21,0x33,0xf6,0x30,0x6e,0x3c,0x3f,0x3b,0x36,0x4c,0xd0,0x6a,0x2f,0xfa,0x04,0x55,0xa3,0xdc,0xe7,0x35,0xf2,0x56,0xc9,
+0x23,0xf4,0xd8,0x9e,0x19,0xfe,0xb6,0xa9,0x14,0xb5,0x91,0x10,0x63,0x7b,0xce,0xf9,0xce,0x39,0xdf,0xf9,0x8e,0xa1,0xfb,0xe3,0xf5,0xf8,0x6a,0xfe,0x66,0x32,0x70,0x42,
+0x15,0x89,0xde,0x0f,0x5d,0xfd,0x70,0x04,0x89,0x57,0x18,0xb1,0x18,0xe9,0x03,0x46,0x28,0x3c,0x22,0xa6,0x88,0xe3,0x87,0x24,0x93,0x4c,0x61,0xf4,0x6a,0x7e,0xd3,0x7c,
+0x8a,0xca,0xe3,0x98,0x44,0x0c,0xa3,0x0d,0x67,0x79,0x9a,0x64,0x0a,0x39,0x7e,0x12,0x2b,0x16,0x83,0x59,0xce,0xa9,0x0a,0x31,0x65,0x1b,0xee,0xb3,0xa6,0xd9,0x34,0x1c,
+0x1e,0x73,0xc5,0x89,0x68,0x4a,0x9f,0x08,0x86,0xdb,0xee,0x99,0x86,0x51,0x5c,0x09,0xe6,0x50,0xa2,0x48,0x53,0x60,0xf4,0x7a,0x78,0x33,0x5c,0x5c,0x8d,0x47,0x37,0xc3,
+0x17,0xaf,0xa6,0xfd,0xf9,0x70,0x3c,0x42,0xbd,0x6e,0xcb,0xd8,0x80,0xad,0xe0,0xf1,0x5b,0x27,0x63,0x60,0x27,0xd5,0x56,0x30,0x19,0x32,0x06,0x31,0xc3,0x8c,0x05,0xc5,
+0x89,0xeb,0x5f,0xfa,0x17,0xe7,0x4f,0xd9,0x4f,0xae,0x2f,0xa5,0x46,0x97,0x7e,0xc6,0x53,0xe5,0xc8,0xcc,0xc7,0x28,0x4a,0xe8,0x5a,0xb0,0x45,0x9a,0x88,0x6d,0xc0,0x85,
+0x70,0x2f,0xda,0x8c,0x78,0xe7,0x4f,0x96,0xee,0xef,0x52,0x07,0xb1,0xa6,0x3b,0x1f,0xb5,0x4d,0x59,0xe9,0x84,0x7a,0x3c,0xd2,0x05,0xde,0xaf,0xd8,0x92,0x37,0xee,0x24,
+0x69,0xac,0xbd,0xe0,0x21,0xc8,0x92,0x08,0xb9,0xad,0xb5,0xe2,0x42,0xba,0xc1,0xd9,0x93,0x33,0x7a,0xc1,0xce,0x35,0x5a,0x07,0x68,0x90,0x80,0x90,0xac,0x56,0x82,0x3d,
+0x5f,0x2b,0x05,0x5b,0x0c,0x5e,0x35,0xe4,0xda,0xb3,0x66,0x4a,0xa4,0xcc,0x93,0x8c,0xa2,0x7a,0x87,0x26,0xfe,0x3a,0x02,0xce,0x5c,0x42,0xe9,0x60,0x03,0x8b,0x5b,0x2e,
+0x81,0x43,0x96,0xd5,0xd0,0xf5,0xf8,0xe5,0x95,0x25,0xf4,0x36,0x21,0x94,0x51,0xd4,0xa8,0xd5,0x71,0xef,0xfe,0x00,0xd7,0x0d,0x92,0x6c,0x40,0xfc,0xb0,0xb6,0x34,0x7b,
+0x78,0x6d,0x17,0x8f,0xc0,0xf9,0x82,0xfb,0x6f,0x51,0x23,0x58,0xc7,0xbe,0xe2,0x49,0x5c,0xab,0xdf,0x17,0x79,0x92,0x6c,0xc5,0xd4,0x90,0x62,0x15,0x72,0xe9,0xc2,0xb2,
+0xaf,0x54,0xc6,0x01,0x86,0xd5,0x90,0x69,0x8c,0x35,0x80,0x5c,0xad,0x7d,0x99,0xfc,0x30,0x4e,0xd7,0x0a,0x6b,0x4a,0x6a,0x25,0x44,0xbd,0xc3,0x83,0xda,0xc1,0xfb,0x2a,
+0x88,0xa6,0xf3,0xe0,0xcd,0x51,0x24,0x6d,0x80,0xea,0x18,0x63,0x54,0x91,0xf3,0x0c,0x29,0xf6,0x4e,0xa1,0x9f,0x77,0x27,0x9d,0x43,0x04,0x79,0x8a,0xd0,0xd0,0xdf,0xf5,
+0x8e,0x29,0x45,0x7b,0x17,0x04,0x62,0x13,0xff,0x10,0xfc,0xcb,0xc7,0xbf,0xfe,0xf8,0xfc,0xe9,0x4f,0xc0,0xff,0xf2,0xf1,0xc3,0x7b,0xd4,0x79,0x78,0xa8,0x77,0xec,0x27,
+0xe7,0x31,0x4d,0x72,0x37,0x89,0x05,0xf0,0x8e,0x0d,0xe9,0xd0,0x70,0x68,0x5f,0x4b,0xde,0x3d,0xa3,0xef,0x70,0xce,0x03,0x0e,0x74,0x3c,0x74,0x4e,0x65,0x63,0xa4,0xa6,
+0xa7,0xc8,0xf5,0xce,0x7c,0x16,0x5c,0xd2,0xcb,0x43,0x7d,0x75,0x5b,0xc5,0x58,0x2d,0x13,0xba,0x85,0x07,0xe5,0x1b,0xc7,0x17,0x90,0x14,0x46,0x7a,0x78,0x08,0x87,0x56,
+0x99,0xe1,0x6b,0xff,0xcb,0x50,0x84,0x6d,0xb0,0x82,0xe6,0x47,0xa5,0xbb,0x5e,0x4b,0xe6,0x23,0x07,0x26,0x33,0x4c,0x28,0x46,0x93,0xf1,0x6c,0x8e,0x1c,0x62,0x9a,0x8d,
+0x21,0x77,0x93,0xb5,0x86,0xf6,0x0e,0xa1,0x27,0xd3,0xe1,0xcb,0xfe,0xf4,0xcd,0x62,0x34,0x98,0xbf,0x1e,0x4f,0x7f,0x35,0xe0,0x9e,0x4d,0x4d,0x0f,0x1d,0x59,0x32,0x51,
+0xc5,0x10,0x4b,0x81,0x1c,0x88,0x04,0x03,0x27,0x39,0x6d,0xa3,0x43,0xa4,0xd9,0x6c,0x78,0xbd,0x68,0x6b,0x00,0xe3,0x05,0xde,0x5c,0xf7,0xa9,0xf2,0x86,0x1d,0x2a,0x06,
+0xcb,0x74,0xd6,0xe1,0xb4,0x02,0xb2,0x57,0x49,0xb1,0xc9,0xd8,0xdd,0x9a,0x67,0x8c,0x3a,0x24,0xe3,0x00,0xaf,0xc1,0x20,0x04,0xbf,0xe1,0x8e,0x0e,0xa1,0x8b,0x68,0xd9,
+0xec,0xbe,0x9e,0x63,0x9a,0x9f,0xa4,0x38,0xe9,0xcf,0x66,0x50,0xe5,0x51,0x9a,0x7b,0x5d,0x28,0x05,0xd2,0xcc,0x33,0x92,0xa6,0xb6,0x19,0x27,0x55,0x54,0x33,0xd0,0x34,
+0xaf,0xca,0xa2,0x2a,0x71,0x99,0xc2,0x6c,0x74,0x5b,0x97,0x5d,0x9f,0x54,0x33,0x29,0x1d,0xb4,0x20,0xcc,0xdc,0x16,0x48,0x76,0x83,0xca,0x98,0xc7,0xd7,0x86,0xc1,0xb7,
+0x87,0x8b,0xb4,0xa8,0xd0,0xce,0xe0,0x63,0xa1,0xe6,0xc6,0xb0,0xca,0xd9,0x69,0x3b,0x1b,0x2e,0xf9,0x92,0x0b,0xae,0xb6,0xa8,0x57,0x8c,0x41,0xb7,0x65,0x63,0xee,0xb8,
+0xdd,0x51,0x5c,0xa6,0x11,0xc1,0x9c,0xd1,0x23,0x42,0xc7,0x93,0xc1,0xa8,0x94,0xce,0xe2,0x97,0xe1,0x68,0xae,0x79,0xb5,0x9e,0x61,0xf6,0x88,0xda,0xfa,0xb7,0xf3,0x6f,
+0x50,0x9a,0xf7,0x98,0xd2,0xbc,0x6f,0x50,0x9a,0xb7,0xaf,0x34,0xef,0xbf,0x54,0x9a,0xf7,0x4f,0x4a,0xf3,0xbe,0x87,0xd2,0xbc,0x3d,0xa5,0x79,0xff,0x97,0xd2,0x76,0xe3,
+0xb4,0x27,0x36,0xef,0xeb,0x62,0xf3,0xbe,0x93,0xd8,0xf6,0x3c,0xb3,0x24,0x6f,0xfa,0x70,0xe9,0x5b,0x4a,0x8b,0x6a,0xf7,0x6e,0xc9,0xa5,0x8a,0x4b,0x1e,0xe5,0x7a,0x19,
+0x71,0x75,0x2c,0xae,0xfe,0x6f,0x03,0x0d,0x5c,0xe5,0x48,0x8e,0xbc,0x1d,0xb8,0x67,0x0d,0x88,0xfd,0xef,0xd1,0xda,0xf9,0xbf,0x18,0x8c,0x06,0xd3,0xfe,0xed,0xe2,0x79,
+0xff,0xca,0xc8,0x9b,0xec,0x55,0xa8,0x9d,0xf7,0xb6,0xc5,0x0f,0x40,0xcb,0xfe,0xfd,0xfa,0x1b,0xfb,0xe6,0x27,0xe1,0x8f,0x09,0x00,0x00
+};
+const size_t WM_PK_WIFI_HTML_KEYS_GZ_LEN = 954;
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+const uint8_t WM_PK_MQTT_HTML_KEYS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x56,0xdb,0x6e,0xe3,0x36,0x10,0x7d,0xef,0x57,0xa8,0x4f,0xb4,0x01,0x5b,0x8a,0xd3,0xa4,0x9b,0xd4,0xa6,0x17,
+0x4e,0xe2,0xdd,0x35,0x36,0xb1,0x53,0xdb,0x69,0xd1,0x27,0x83,0x22,0x69,0x8b,0x5d,0x4a,0x72,0x44,0xca,0x5e,0x23,0xc8,0x43,0xbf,0xa0,0x68,0xd1,0xf7,0xfd,0x8d,0xfe,
+0x55,0xf7,0x13,0x3a,0x24,0x25,0xf9,0xb6,0xd8,0xa6,0x40,0x10,0xf1,0x32,0x73,0xe6,0xcc,0xe1,0xcc,0x24,0x9d,0x6f,0x6f,0x46,0xd7,0xd3,0x5f,0xee,0xfb,0x5e,0xa4,0x63,
+0xd9,0xfd,0xa6,0x63,0x3e,0x9e,0x24,0xc9,0x02,0x23,0x9e,0x20,0x73,0xc0,0x09,0x83,0x4f,0xcc,0x35,0xf1,0x68,0x44,0x32,0xc5,0x35,0x46,0x0f,0xd3,0x37,0xcd,0x0b,0x54,
+0x1e,0x27,0x24,0xe6,0x18,0xad,0x04,0x5f,0x2f,0xd3,0x4c,0x23,0x8f,0xa6,0x89,0xe6,0x09,0x98,0xad,0x05,0xd3,0x11,0x66,0x7c,0x25,0x28,0x6f,0xda,0x4d,0x43,0x24,0x42,
+0x0b,0x22,0x9b,0x8a,0x12,0xc9,0x71,0xcb,0x60,0x68,0xa1,0x25,0xf7,0x18,0xd1,0xa4,0x29,0x31,0xba,0xfb,0x71,0x3a,0x9d,0x5d,0x8f,0x86,0x6f,0x06,0x6f,0x1f,0xc6,0xbd,
+0xe9,0x60,0x34,0x44,0xdd,0x4e,0x60,0x6d,0xc0,0x56,0x8a,0xe4,0x83,0x97,0x71,0xb0,0x53,0x7a,0x23,0xb9,0x8a,0x38,0x87,0x80,0x51,0xc6,0xe7,0xc5,0x89,0x4f,0x2f,0xe9,
+0xf9,0xd9,0x05,0xff,0xde,0xa7,0x4a,0x19,0x74,0x45,0x33,0xb1,0xd4,0x9e,0xca,0x28,0x46,0x71,0xca,0x72,0xc9,0x67,0xcb,0x54,0x6e,0xe6,0x42,0x4a,0xff,0xbc,0xc5,0xc9,
+0xe9,0xd9,0xab,0xd0,0xff,0x55,0x99,0x20,0xce,0x74,0xeb,0xa3,0x37,0x4b,0x5e,0x3a,0xa1,0xae,0x88,0x4d,0x76,0x4f,0x0b,0x1e,0x8a,0xc6,0xa3,0x22,0x8d,0xfc,0x74,0xfe,
+0x3c,0xcf,0xd2,0x18,0xf9,0x41,0xae,0x85,0x54,0xfe,0xfc,0xe4,0xd5,0x09,0x3b,0xe7,0x67,0x06,0xad,0x0d,0x1a,0x28,0x40,0x48,0x17,0x0b,0xc9,0xaf,0x72,0xad,0x61,0x8b,
+0xc1,0xab,0x86,0x7c,0x77,0xd6,0x5c,0x12,0xa5,0xd6,0x69,0xc6,0x50,0xbd,0xbd,0x16,0x09,0x4b,0xd7,0x7e,0x9a,0xc8,0x94,0x30,0x5c,0xab,0xe3,0xee,0x13,0x80,0x83,0x69,
+0xa0,0x1e,0x5f,0xb3,0x8f,0x38,0x7e,0xd4,0x1a,0xcc,0x9e,0xdb,0x2c,0xa5,0x79,0x0c,0xca,0xfa,0x84,0xb1,0xfe,0x0a,0x16,0xb7,0x42,0x81,0xd2,0x3c,0xab,0xa1,0x9b,0xd1,
+0xdd,0xb5,0x93,0xfd,0x16,0x40,0x38,0x43,0x0d,0x8b,0xb3,0x47,0xc0,0x9f,0xa7,0x59,0x9f,0xd0,0xa8,0x16,0xda,0x3d,0x5c,0xbb,0xc5,0x17,0xe0,0xa8,0x14,0xf4,0x03,0x6a,
+0xcc,0xf3,0x84,0x6a,0x91,0x26,0xb5,0xfa,0x53,0x91,0x10,0xc9,0x16,0x5c,0x0f,0x18,0xd6,0x91,0x50,0x3e,0x2c,0x7b,0x5a,0x67,0x02,0x60,0x78,0x0d,0xd9,0x17,0x74,0x06,
+0xc0,0xd6,0xd9,0x97,0x59,0x0e,0x92,0x65,0xae,0xb1,0xd1,0xae,0x56,0x42,0xd4,0xdb,0x62,0x5e,0xdb,0xbb,0xaf,0x82,0x18,0xdd,0xf7,0x6e,0x0e,0x22,0x19,0x03,0x54,0xc7,
+0x18,0xa3,0x4a,0xc5,0xd7,0x48,0xf3,0x8f,0x1a,0xfd,0xb0,0x3d,0x69,0xef,0x23,0xa8,0x63,0x84,0x86,0xf9,0x5d,0x6f,0xdb,0x54,0x8c,0x77,0x21,0x20,0xb6,0xf1,0xf7,0xc1,
+0x3f,0x7f,0xfa,0xe3,0xb7,0x7f,0xfe,0xfe,0x1d,0xf0,0x3f,0x7f,0xfa,0xeb,0x4f,0xd4,0x7e,0x7e,0x86,0xf7,0xb0,0x3f,0xc7,0x65,0x63,0x4b,0xcd,0xb4,0x90,0x7f,0x7a,0x42,
+0xf9,0xfc,0x92,0x5d,0xee,0xd7,0x57,0x27,0x28,0x7a,0x2a,0x4c,0xd9,0x06,0x3e,0x4c,0xac,0x3c,0x2a,0x21,0x16,0x46,0xa6,0x73,0x88,0x80,0x17,0xb0,0x9d,0xd7,0x2a,0x8f,
+0xb5,0x96,0xe8,0x3f,0x1a,0x24,0x6a,0x81,0x07,0xbc,0x6f,0x5c,0xfa,0x98,0xb5,0xe2,0x14,0x79,0xd0,0xa2,0x51,0xca,0x30,0xba,0x1f,0x4d,0xa6,0xc8,0x23,0xf6,0x3d,0x31,
+0x0a,0x6c,0x51,0xb9,0xe8,0xa6,0xaf,0x48,0xc8,0x65,0xe5,0x2a,0x43,0x88,0x07,0x00,0x18,0x45,0xa9,0xd2,0x07,0xa1,0xdf,0x19,0x1c,0x88,0x68,0x5d,0xc0,0x55,0x18,0x79,
+0x2b,0x57,0xd8,0xa1,0xa2,0x71,0xec,0x83,0x78,0x82,0x95,0x28,0x6e,0x4c,0xb8,0x75,0xc6,0x1f,0x73,0x91,0x71,0xe6,0x91,0x4c,0x00,0xb4,0x81,0x72,0xf0,0x9e,0xbd,0x07,
+0xd8,0xc0,0x11,0xfb,0x3a,0x3d,0x37,0x6f,0xf6,0xe8,0xdd,0x8f,0xc6,0x2f,0xa3,0x97,0xe4,0x71,0x08,0x42,0x5b,0x82,0x0e,0xc7,0x11,0x74,0xeb,0x15,0x91,0x39,0x6c,0x5a,
+0x17,0x17,0xdf,0x7d,0x8d,0xad,0x35,0x7e,0x29,0xdb,0x5c,0x99,0x78,0x7b,0x6c,0x1f,0x26,0xfd,0xf1,0xb0,0x77,0xd7,0xff,0x9f,0x82,0x3a,0x24,0xc7,0xd7,0xad,0x8f,0x98,
+0x99,0x63,0x63,0xf0,0x72,0x2d,0xd7,0xec,0x50,0xca,0xde,0x64,0xf2,0xf3,0x68,0x7c,0xb3,0x4b,0x6e,0xa7,0x58,0xcb,0xf6,0x68,0xae,0x33,0xb2,0x5c,0xba,0x9a,0x3d,0xe2,
+0x5e,0x4d,0x80,0xa6,0xbd,0x2a,0x53,0xa9,0x5a,0xcb,0xc9,0x6f,0x42,0x17,0xea,0x9b,0xe5,0x51,0x32,0xf7,0xa5,0xb9,0xe9,0x1a,0x3b,0xb3,0x0a,0x1c,0xb7,0x41,0x55,0xa3,
+0x1c,0xcc,0x56,0x8b,0xee,0x0e,0x67,0xdb,0xfc,0xdc,0x04,0xfa,0x42,0xac,0xa9,0xb5,0xac,0x28,0x7b,0x2b,0xa1,0x44,0x28,0xa4,0xd0,0x1b,0xd4,0x2d,0x26,0x40,0x27,0x70,
+0x21,0xb7,0xaa,0x6e,0xc5,0x2d,0x59,0xc4,0x30,0x62,0x0e,0xb5,0xbc,0x1a,0x8f,0xde,0xf7,0xc7,0xb3,0x77,0x83,0xa1,0xad,0xce,0x23,0x9f,0x2c,0x5d,0x37,0x29,0x0c,0x1f,
+0x27,0x63,0x91,0xe3,0x4e,0x2b,0x87,0x3a,0x29,0xb5,0x53,0x79,0x18,0x8b,0xc3,0xb2,0x9f,0xf4,0x7e,0xb2,0x45,0x54,0xb1,0x23,0x07,0xde,0x1e,0x0c,0x03,0x0b,0xe2,0xfe,
+0x58,0x06,0x5b,0xff,0xb7,0xfd,0x61,0x7f,0xdc,0xbb,0x9d,0x5d,0xf5,0xae,0xdf,0x1b,0x08,0xb2,0x93,0x9b,0x71,0xde,0xd9,0x16,0x13,0x2b,0x70,0xff,0x2c,0xfc,0x0b,0x62,
+0xf5,0x9a,0x10,0x3d,0x08,0x00,0x00
+};
+const size_t WM_PK_MQTT_HTML_KEYS_GZ_LEN = 935;
+#endif
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_LANG_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x65,0x51,0xcf,0x6f,0xda,0x30,0x14,0xbe,0xf3,0x57,0x70,0xa8,0x6a,0xbb,0xa5,0x06,0xaa,0x5d,0x56,0xcf,0x9a,0xaa,
+0x8e,0x5b,0xa6,0x1e,0x7a,0xcc,0xd2,0xc9,0x24,0x8f,0xe0,0xe2,0xd8,0xcc,0x7e,0xa1,0x43,0x21,0xff,0xfb,0x9c,0x00,0xa1,0xea,0xa4,0x28,0xf2,0xf3,0xf3,0xf7,0xe3,0x7d,
+0x6f,0xa7,0xfc,0xf8,0x2a,0x91,0x4d,0x2b,0xe8,0xaa,0xb6,0x39,0x6a,0x67,0x29,0x6b,0x76,0xf1,0x76,0xab,0x70,0x1d,0x64,0x03,0xf6,0x81,0x4c,0x8d,0xb2,0xe5,0x14,0x2c,
+0x57,0xf9,0xfd,0x6c,0x0e,0x6a,0xc6,0xdf,0x82,0xb3,0x64,0x12,0x36,0xe7,0x5e,0xd8,0xf0,0xfb,0x79,0xfe,0x75,0xfe,0x45,0xcd,0x8f,0xbd,0x56,0x9c,0xe9,0xc6,0x01,0x0c,
+0xe4,0x98,0xc4,0x67,0xb5,0x2a,0xe1,0xc4,0x5e,0xc9,0xc2,0xe5,0x75,0x05,0x16,0x79,0xee,0xdc,0x46,0x03,0xaf,0x14,0xe6,0x6b,0x3a,0xa5,0xdf,0x1f,0x5e,0x0f,0xe2,0x57,
+0xb8,0x61,0xef,0xd5,0xef,0x8e,0x5b,0xd2,0xf4,0x55,0x64,0x37,0x6c,0xca,0x84,0x5e,0xd1,0xea,0xfa,0xba,0x37,0x96,0x56,0xe9,0x3c,0xcb,0x58,0xe3,0x01,0x6b,0x6f,0xc7,
+0x5d,0x25,0xda,0x51,0xef,0xdb,0xc3,0x0a,0xbc,0x87,0x42,0x5a,0xb5,0xd3,0xa5,0x42,0xe7,0xb9,0x39,0x89,0x87,0xc3,0x21,0xfd,0xff,0x36,0x13,0x2b,0xe7,0x69,0x87,0xd5,
+0x72,0x26,0xf4,0xb7,0x81,0x81,0x1b,0xb0,0x25,0xae,0x85,0xbe,0xbd,0x3d,0xba,0xce,0x5d,0x01,0x92,0x0e,0xfd,0x54,0x67,0x87,0x03,0x21,0x8c,0x87,0xad,0xd1,0x48,0xc9,
+0x1d,0x61,0xe9,0x2c,0xe3,0xe8,0x12,0xf7,0x0e,0xfe,0x49,0x85,0x38,0x6d,0x67,0xfa,0xe8,0xb8,0x03,0x5f,0x1c,0x77,0x95,0x68,0xdb,0xd1,0xb1,0x24,0x60,0xc9,0xc9,0x7f,
+0xaf,0xf1,0x39,0x33,0x31,0xa4,0x75,0x3e,0x2c,0x0c,0xf4,0x75,0x1f,0x51,0x4f,0xd6,0x81,0x51,0x2d,0x0d,0xc8,0x15,0x74,0x51,0x7e,0x54,0xe5,0xb8,0x06,0x7b,0xd9,0xb0,
+0x1f,0x6c,0xf8,0x7e,0x5d,0x51,0xa0,0x65,0x97,0x8d,0xa9,0xed,0xd6,0xec,0xe3,0xa2,0x7a,0xb6,0x4f,0x50,0x64,0xcd,0xf3,0xf2,0x2d,0x9a,0xe3,0x2a,0x04,0x5d,0x5a,0x7a,
+0x95,0x4c,0xf0,0x83,0xbf,0x3f,0x35,0xf8,0xfd,0x4b,0x6f,0xdf,0xf9,0x47,0x63,0x28,0x49,0x0b,0x85,0xea,0xce,0x64,0x31,0xa7,0x98,0xf3,0x42,0x45,0x6b,0x03,0x1b,0xb0,
+0x26,0x0a,0xc0,0x5f,0x7c,0x72,0x16,0x23,0x5c,0x62,0x0a,0xbc,0x04,0x7c,0x44,0xf4,0x7a,0x59,0x23,0x50,0x72,0x44,0x13,0x96,0x75,0x16,0xbb,0x6f,0x14,0x13,0x1d,0xe4,
+0x3c,0xa8,0x62,0xff,0x82,0x0a,0x41,0x4a,0x62,0x9c,0x2a,0xb4,0x2d,0x09,0x6b,0x86,0xbe,0x2a,0x8a,0xc5,0x2e,0x1e,0x12,0x1d,0x22,0x3f,0x78,0x4a,0x7e,0x3c,0xff,0x3c,
+0x89,0x25,0xf1,0x39,0x14,0x64,0xd2,0x8f,0x1b,0x89,0xc1,0x04,0x68,0x4e,0xb3,0xc7,0xd5,0xb0,0xf8,0x1f,0xfd,0x03,0xbe,0xee,0x9f,0xf7,0x20,0x03,0x00,0x00
+};
+const size_t WM_PK_LANG_JS_GZ_LEN = 478;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_LANG_JS_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x65,0x51,0xcf,0x6f,0xda,0x30,0x14,0xbe,0xf3,0x57,0x70,0xa8,0x6a,0xbb,0xa5,0x06,0xaa,0x5d,0x56,0xcf,0x9a,0xaa,
+0x8e,0x5b,0xa6,0x1e,0x7a,0xcc,0xd2,0xc9,0x24,0x8f,0xe0,0xe2,0xd8,0xcc,0x7e,0xa1,0x43,0x21,0xff,0xfb,0x9c,0x00,0xa1,0xea,0xa4,0x28,0xf2,0xf3,0xf3,0xf7,0xe3,0x7d,
+0x6f,0xa7,0xfc,0xf8,0x2a,0x91,0x4d,0x2b,0xe8,0xaa,0xb6,0x39,0x6a,0x67,0x29,0x6b,0x76,0xf1,0x76,0xab,0x70,0x1d,0x64,0x03,0xf6,0x81,0x4c,0x8d,0xb2,0xe5,0x14,0x2c,
+0x57,0xf9,0xfd,0x6c,0x0e,0x6a,0xc6,0xdf,0x82,0xb3,0x64,0x12,0x36,0xe7,0x5e,0xd8,0xf0,0xfb,0x79,0xfe,0x75,0xfe,0x45,0xcd,0x8f,0xbd,0x56,0x9c,0xe9,0xc6,0x01,0x0c,
+0xe4,0x98,0xc4,0x67,0xb5,0x2a,0xe1,0xc4,0x5e,0xc9,0xc2,0xe5,0x75,0x05,0x16,0x79,0xee,0xdc,0x46,0x03,0xaf,0x14,0xe6,0x6b,0x3a,0xa5,0xdf,0x1f,0x5e,0x0f,0xe2,0x57,
+0xb8,0x61,0xef,0xd5,0xef,0x8e,0x5b,0xd2,0xf4,0x55,0x64,0x37,0x6c,0xca,0x84,0x5e,0xd1,0xea,0xfa,0xba,0x37,0x96,0x56,0xe9,0x3c,0xcb,0x58,0xe3,0x01,0x6b,0x6f,0xc7,
+0x5d,0x25,0xda,0x51,0xef,0xdb,0xc3,0x0a,0xbc,0x87,0x42,0x5a,0xb5,0xd3,0xa5,0x42,0xe7,0xb9,0x39,0x89,0x87,0xc3,0x21,0xfd,0xff,0x36,0x13,0x2b,0xe7,0x69,0x87,0xd5,
+0x72,0x26,0xf4,0xb7,0x81,0x81,0x1b,0xb0,0x25,0xae,0x85,0xbe,0xbd,0x3d,0xba,0xce,0x5d,0x01,0x92,0x0e,0xfd,0x54,0x67,0x87,0x03,0x21,0x8c,0x87,0xad,0xd1,0x48,0xc9,
+0x1d,0x61,0xe9,0x2c,0xe3,0xe8,0x12,0xf7,0x0e,0xfe,0x49,0x85,0x38,0x6d,0x67,0xfa,0xe8,0xb8,0x03,0x5f,0x1c,0x77,0x95,0x68,0xdb,0xd1,0xb1,0x24,0x61,0x43,0x4e,0xfe,
+0x7b,0x8d,0xcf,0x99,0x89,0x21,0xad,0xf3,0x61,0x61,0xa0,0xaf,0xfb,0x88,0x7a,0xb2,0x0e,0x8c,0x6a,0x69,0x40,0xae,0xa0,0x8b,0xf2,0xa3,0x2a,0xc7,0x35,0xd8,0xcb,0x86,
+0xfd,0x60,0xc3,0xf7,0xeb,0x8a,0x02,0x2d,0xbb,0x6c,0x4c,0x6d,0xb7,0x66,0x1f,0x17,0xd5,0xb3,0x7d,0x82,0x22,0x6b,0x9e,0x97,0x6f,0xd1,0x1c,0x57,0x21,0xe8,0xd2,0xd2,
+0xab,0x64,0x82,0x1f,0xfc,0xfd,0xa9,0xc1,0xef,0x5f,0x7a,0xfb,0xce,0x3f,0x1a,0x43,0x49,0x5a,0x28,0x54,0x77,0x26,0x8b,0x39,0xc5,0x9c,0x17,0x2a,0x5a,0x1b,0xd8,0x80,
+0x35,0x51,0x00,0xfe,0xe2,0x93,0xb3,0x18,0xe1,0x12,0x53,0xe0,0x25,0xe0,0x23,0xa2,0xd7,0xcb,0x1a,0x81,0x92,0x23,0x9a,0xb0,0xac,0xb3,0xd8,0x7d,0xa3,0x98,0xe8,0x20,
+0xe7,0x41,0x15,0xfb,0x17,0x54,0x08,0x52,0x12,0xe3,0x54,0xa1,0x6d,0x49,0x58,0x33,0xf4,0x55,0x51,0x2c,0x76,0xf1,0x90,0xe8,0x10,0xf9,0xc1,0x53,0xf2,0xe3,0xf9,0xe7,
+0x49,0x2c,0x89,0xcf,0xa1,0x20,0x93,0x7e,0xdc,0x48,0x0c,0x26,0x40,0x73,0x9a,0x3d,0xae,0x86,0xc5,0xff,0xe8,0x1f,0x64,0xb4,0xc0,0xbb,0x20,0x03,0x00,0x00
+};
+const size_t WM_PK_LANG_JS_GZ_LEN = 478;
+#else
+const uint8_t WM_PK_LANG_JS_GZ[] PROGMEM = { 0 };
+const size_t WM_PK_LANG_JS_GZ_LEN = 0;
+#endif
+const uint8_t WM_PK_LANG_EN_JSON_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x85,0x56,0xd1,0x8e,0xea,0x36,0x10,0xfd,0x15,0x8b,0x87,0xea,0x5e,0xe9,0x8a,0xab,0xbb,0x7d,0xdb,0x3e,0x54,0x86,
+0x18,0x70,0x37,0x24,0xd4,0x76,0x40,0x5b,0x55,0x8a,0xbc,0x60,0xd8,0x68,0x43,0x4c,0x9d,0x64,0xd1,0xb6,0xaa,0xd4,0xaf,0xe9,0x87,0xf5,0x4b,0xee,0xd8,0x89,0x93,0xc0,
+0xb2,0xea,0x5b,0xf0,0xcc,0x1c,0xcf,0x1c,0x9f,0x99,0xe1,0xaf,0x51,0x2c,0x70,0xfa,0x0b,0x4f,0x17,0x1b,0x1a,0xa4,0x4b,0xca,0x97,0x58,0x4c,0x17,0xa3,0xfb,0xd1,0x42,
+0x9a,0xdd,0x59,0x1a,0x85,0x68,0x80,0x8e,0x59,0x79,0x94,0xd5,0xf6,0x79,0x8c,0xc4,0x73,0x56,0xa2,0x7d,0x66,0x8e,0xce,0x04,0xdf,0x85,0xae,0xd0,0x5e,0x1b,0x54,0x59,
+0xc3,0x4e,0xbd,0x66,0x5b,0x35,0x1e,0x7d,0xf1,0xa0,0xc9,0x2a,0x8c,0x71,0x90,0xc6,0x11,0x49,0x27,0x34,0x4a,0x67,0x34,0x24,0x00,0xfd,0xa8,0x6b,0xb4,0x95,0x05,0xd2,
+0x45,0xfe,0x86,0xea,0x53,0xae,0xe5,0x0e,0xbe,0x15,0xfa,0x34,0x7e,0xca,0x8a,0xcf,0x00,0x9f,0x2b,0x24,0x2b,0x24,0x51,0x95,0x1d,0x6f,0xa2,0x85,0x8f,0x1d,0x1c,0xff,
+0x00,0x6f,0x80,0x55,0x7a,0x88,0x64,0x15,0x60,0x41,0x52,0x88,0x5c,0xb1,0x78,0xce,0x08,0xb7,0xc1,0x33,0x5f,0x4c,0x7d,0xda,0xc9,0x0a,0x6a,0x2a,0xd0,0xc9,0xe8,0x83,
+0x51,0x65,0x39,0xfe,0xbd,0x08,0xb4,0xab,0xb0,0xaa,0x0d,0xc0,0xef,0xf7,0x50,0xa6,0xfa,0xb0,0xca,0x19,0x86,0x7c,0x02,0x80,0x4c,0x9a,0x14,0xf6,0x12,0x2e,0xdf,0xf5,
+0x6e,0x9c,0xb0,0x35,0x61,0x29,0x23,0x22,0x61,0x11,0x09,0x52,0x2e,0xb0,0x48,0x6c,0x0a,0x5c,0x99,0x57,0x65,0x90,0x51,0xf6,0x1a,0xb5,0x43,0x65,0x25,0xab,0xba,0x44,
+0x5b,0xbd,0x53,0xa8,0x0f,0x07,0xf0,0x39,0x0e,0x53,0xcc,0xe6,0xc9,0x92,0x44,0x02,0xe2,0x68,0x9e,0xab,0x83,0xcc,0x91,0x34,0x87,0xfa,0xa8,0x8a,0xca,0x3a,0x43,0x55,
+0x02,0x33,0x91,0x4e,0xe3,0x68,0x46,0xd9,0x12,0xbc,0xa0,0x84,0x37,0x20,0xe8,0x2c,0xc1,0xa1,0xd2,0x70,0x0b,0xc0,0x9b,0x6a,0x50,0xc9,0xcf,0x10,0x36,0x27,0x11,0x61,
+0x80,0xfe,0xd8,0x10,0xaa,0xca,0xc1,0x59,0x14,0xc3,0x51,0xa4,0x07,0xe0,0x97,0x0c,0xb2,0x16,0x71,0xc8,0xdc,0xd8,0xd2,0xd3,0x14,0x08,0x75,0x47,0x3c,0x66,0xae,0xce,
+0xa2,0xd4,0xa6,0x37,0xac,0x71,0x98,0x58,0x3d,0xac,0x65,0x5e,0xab,0xfe,0x38,0x89,0xa8,0xad,0x2e,0x29,0xb2,0xaa,0x3f,0xb4,0x0c,0xd3,0x68,0x0e,0xe7,0x21,0x70,0x9b,
+0x15,0x87,0xff,0xfe,0xf9,0x17,0xac,0x34,0x9a,0xc5,0x0c,0x24,0x4b,0xe3,0x28,0xfd,0x31,0x88,0x85,0xcd,0x87,0x16,0x20,0x48,0xd0,0x6b,0xa6,0x8b,0x26,0x8f,0x0d,0x9d,
+0xd1,0x86,0x90,0x79,0xc2,0x2e,0x7d,0x37,0xd9,0x2c,0x43,0x53,0x5d,0xec,0xb3,0x43,0x6d,0x06,0x21,0xcb,0x5f,0x85,0xf8,0x20,0xc4,0x9a,0x6e,0x85,0x58,0xba,0x37,0x98,
+0x11,0x2f,0x33,0xef,0x7f,0x25,0xb0,0xc6,0xd9,0x33,0xe9,0x9d,0x5a,0x0e,0x1b,0xa3,0x7d,0x70,0x46,0x96,0x31,0x80,0x44,0x64,0x93,0x82,0x68,0x38,0x24,0x60,0x1f,0x41,
+0x9d,0x11,0x28,0xa5,0x84,0x3b,0x91,0x7c,0x05,0x79,0xc9,0xa7,0x5c,0xdd,0xa3,0xcb,0x90,0x69,0xc2,0x58,0xa3,0x8f,0x69,0x6d,0x0c,0xc8,0xe2,0xda,0x81,0x6f,0x28,0xb4,
+0x78,0x1a,0x62,0x47,0x27,0x3f,0x67,0xd0,0xd9,0x28,0x97,0xc5,0xa1,0x96,0x07,0x68,0x42,0x7f,0xc1,0x65,0x90,0xf5,0x4e,0xf0,0xdc,0x7e,0x4c,0x48,0x68,0x9f,0xa1,0x0d,
+0xb8,0xbf,0xf4,0x6b,0x8b,0x9f,0x88,0xc8,0x35,0x82,0xad,0x78,0x20,0xa5,0x09,0x9e,0x3e,0xc0,0xf9,0x44,0x6e,0x5f,0xae,0x72,0x72,0x6c,0x74,0x1d,0xc4,0x9d,0xa0,0x9a,
+0x06,0x7a,0x57,0xdf,0x82,0x4c,0x1f,0x1a,0x29,0x4c,0x9f,0xd5,0xf6,0x05,0xb4,0xf0,0x8e,0x36,0xc2,0x98,0x53,0x1c,0x31,0x46,0x9b,0x6b,0x80,0x64,0x95,0x8a,0x38,0xb5,
+0x69,0x0e,0x5f,0x07,0xc6,0x57,0x7d,0xb2,0x0d,0xe2,0x1e,0x09,0xad,0x1b,0x16,0x6e,0x5e,0xde,0xe7,0xe9,0x12,0xb8,0xce,0x53,0x50,0xe1,0xc6,0x1c,0x7c,0xa3,0x8e,0x01,
+0x6b,0x58,0x10,0xaf,0xe1,0xee,0xd6,0x77,0x3e,0x9c,0x84,0x64,0x2a,0xfc,0xa4,0xe4,0x2a,0x57,0xdb,0x0a,0xcd,0x00,0xbf,0xb5,0x47,0xb1,0xb3,0x41,0x22,0x31,0xf4,0x95,
+0x6b,0xcc,0x66,0x60,0x6e,0x9f,0x75,0xa9,0x8a,0xd6,0xcb,0x4d,0x46,0xfa,0x5b,0xff,0x5a,0x16,0xa1,0xcc,0xfe,0xec,0x5e,0xab,0x13,0x6b,0x2b,0xae,0x81,0x63,0x9b,0x59,
+0x2b,0x03,0x1f,0xb0,0xc0,0x2c,0x70,0x01,0xb0,0x25,0xbc,0xef,0x60,0x45,0x78,0xb7,0xff,0x95,0x49,0x33,0x2b,0x81,0x05,0x5f,0x62,0x33,0x2c,0xe1,0x11,0x5d,0x19,0xe3,
+0x0b,0xb7,0x56,0x4d,0xfd,0x48,0xfd,0xe1,0x8a,0xac,0x66,0x36,0x2c,0xa8,0x93,0x7b,0x4b,0x96,0xec,0xf7,0x93,0x23,0xa6,0xdd,0x04,0xb2,0xd8,0xc1,0x78,0x82,0xd9,0x84,
+0xae,0xb0,0xae,0xa4,0xd3,0x3f,0x12,0x53,0x47,0x0d,0x0b,0xe1,0xe2,0x46,0x2f,0x21,0x16,0x76,0x15,0x36,0x76,0x54,0x36,0x43,0x1c,0x2c,0xf7,0xb7,0x24,0xd3,0x34,0x44,
+0xab,0x17,0xd8,0x97,0xb7,0x50,0x2f,0xcb,0x21,0x45,0xa5,0x8c,0x1b,0xd3,0xf5,0xf5,0x0d,0x83,0x62,0xae,0x11,0x6d,0x35,0x01,0x59,0xd3,0x29,0xe9,0xf7,0x4b,0xe0,0xc6,
+0x3c,0xe2,0x6e,0xad,0xf4,0x76,0x3b,0x3b,0x7b,0xab,0x9d,0x9a,0x83,0x4e,0x65,0x64,0x06,0x33,0x6a,0xe1,0x68,0xd8,0xc3,0x4d,0xcf,0x37,0xe7,0xe8,0xcd,0x09,0xea,0x3d,
+0x57,0x8c,0x2e,0x31,0x7b,0x84,0x19,0x26,0x36,0x31,0xb3,0x7d,0xbf,0x32,0xd9,0x51,0x9a,0x37,0x14,0xa9,0xea,0xac,0xcd,0x8b,0x77,0xe4,0x1c,0x44,0xf5,0xcd,0xbe,0x20,
+0x7c,0xa0,0x6f,0x5d,0x3c,0xe6,0x1c,0x02,0x1b,0xd3,0x4a,0x96,0x25,0xc4,0xec,0x7a,0x73,0xbc,0x22,0x91,0xc7,0xf6,0x9c,0x85,0x4a,0xbe,0x2a,0x74,0xf2,0xbe,0xea,0x78,
+0xaa,0xde,0x1c,0x39,0xfa,0xa4,0x0a,0x54,0x34,0xd7,0x96,0xdd,0x4e,0xc0,0xa1,0x18,0x64,0x87,0x73,0x20,0xbc,0x80,0x12,0x00,0xa2,0xcd,0x10,0x7d,0x8a,0x4f,0xb6,0x24,
+0x99,0x7f,0xbe,0x48,0xf6,0xce,0x27,0x7b,0xf7,0x2e,0xd9,0xbb,0x61,0xb2,0x9d,0x99,0xe3,0xb5,0xeb,0x67,0x9b,0x9e,0x65,0xec,0xe6,0x8a,0xb9,0xb9,0x5c,0xbc,0x27,0xf4,
+0xbb,0xf0,0x0e,0x0b,0x5d,0x56,0xfe,0x7c,0x15,0x33,0x7b,0xbe,0xd2,0xa6,0x3b,0x4a,0xe0,0x9f,0x46,0x84,0x97,0xae,0x6f,0x4a,0x5b,0xd2,0x51,0x75,0xde,0x6d,0x9a,0x83,
+0x24,0xbd,0x69,0xc2,0xe2,0x07,0xf8,0x7b,0xd2,0x32,0x49,0xf7,0xf6,0x5f,0x83,0x41,0x4f,0x46,0xbf,0xb8,0xff,0x26,0x7f,0xd4,0x19,0xc8,0x00,0x89,0x90,0x23,0xe0,0x53,
+0xa2,0xba,0x45,0xfe,0xea,0xd9,0xfe,0x62,0xdb,0x2d,0x77,0x82,0xdd,0x67,0x2a,0xdf,0x95,0x3f,0x21,0x0d,0x3f,0xcc,0x39,0x2b,0x15,0xca,0xdd,0xc3,0x3c,0xc1,0x96,0x79,
+0xe9,0xd6,0xeb,0x90,0x13,0x7b,0x30,0xfa,0xfb,0x3b,0xe3,0xdb,0x9a,0x77,0x8d,0x0a,0x00,0x00
+};
+const size_t WM_PK_LANG_EN_JSON_GZ_LEN = 1138;
+const uint8_t WM_PK_LANG_SK_JSON_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x8d,0x56,0xc1,0x6e,0xe3,0x36,0x10,0xfd,0x15,0x22,0xa7,0x5d,0x60,0xe1,0x62,0xd3,0x5b,0x7a,0x28,0x18,0x9b,0xb6,
+0xb5,0x91,0x25,0x97,0x92,0x6c,0x24,0x28,0x20,0xd0,0x31,0xb3,0x56,0x2c,0x8b,0x06,0x2d,0xb9,0xb0,0x8b,0x02,0xed,0xad,0x97,0x7e,0x84,0x81,0xb6,0x40,0x0e,0x3e,0xb5,
+0xa7,0x02,0x9b,0x8b,0xd6,0x3f,0xd2,0x2f,0xe9,0x90,0x12,0x25,0x39,0xf6,0x06,0xbd,0x09,0xe2,0x9b,0xe1,0xcc,0xe3,0xe3,0x1b,0xfe,0x78,0xe1,0xfa,0x38,0xfc,0xe0,0x85,
+0xfd,0xb1,0xd5,0x09,0x07,0x96,0x37,0xc0,0x7e,0xbb,0x7f,0x71,0x75,0xe1,0xf0,0xed,0x4c,0x4c,0x93,0x7c,0x87,0xfa,0x4c,0x4e,0x7f,0x60,0x92,0x23,0xab,0xd3,0x42,0x3e,
+0x4f,0x52,0x81,0x1e,0x22,0xb9,0x58,0xe7,0x4f,0x12,0x25,0x11,0x47,0x8f,0x1c,0x2d,0x61,0x35,0x15,0xb0,0xb0,0x65,0x32,0x62,0x53,0x0e,0xbf,0x5b,0x17,0xef,0x4c,0xea,
+0x60,0x68,0xbb,0xb8,0x13,0xba,0x0e,0x09,0xaf,0x2d,0x27,0xec,0x5a,0x36,0x81,0x0d,0x06,0xf9,0xdf,0x87,0x67,0x9e,0x72,0x94,0xb0,0x99,0x64,0x87,0x3f,0x50,0x34,0x61,
+0x90,0x0b,0x82,0xd1,0x2a,0xff,0x67,0x22,0x24,0x7a,0xd3,0x9a,0x44,0xc9,0x5b,0x58,0x97,0x6c,0x7b,0x2e,0x9d,0x7d,0x5b,0xe5,0xf3,0x5e,0x26,0xcc,0x77,0x6b,0x93,0xb3,
+0xc8,0xb6,0x29,0xd3,0x99,0x44,0xc1,0xb0,0x83,0x7d,0x12,0x42,0xfc,0x90,0xba,0x3d,0x4a,0x3c,0x95,0x62,0x28,0xf9,0x24,0xe2,0x33,0x86,0xd8,0x3c,0xcd,0x58,0x1c,0x6d,
+0xf3,0xdd,0x7d,0xc4,0xaa,0x76,0xb3,0xd6,0xf7,0x89,0xc3,0xd7,0x9b,0x65,0xbe,0x4f,0xd8,0x23,0xec,0xf4,0x5a,0xbb,0x5d,0x0c,0x75,0x75,0x14,0x93,0x65,0x39,0x8a,0xab,
+0x6d,0xbc,0x99,0xb1,0x58,0xd4,0x60,0x8f,0xd0,0x11,0xa1,0x21,0x25,0x7e,0x40,0x1d,0xd2,0x09,0x3d,0x1f,0xfb,0x81,0x2a,0xc5,0xe3,0x72,0xcd,0x25,0x5a,0x43,0x68,0x1a,
+0xc5,0x68,0x95,0xb2,0xb5,0x58,0xe7,0x9f,0xd0,0x3c,0xff,0x6b,0x8a,0xea,0x78,0xd8,0xa3,0x87,0xed,0x10,0xd3,0x5e,0x30,0x20,0x8e,0xaf,0x0f,0x6e,0x19,0xb3,0x34,0x01,
+0x28,0x93,0x1f,0xb3,0x05,0x9c,0x97,0x82,0x43,0x83,0x3e,0xa6,0x7e,0xd8,0x76,0x9d,0xae,0x45,0x07,0x80,0x6b,0xcf,0xee,0x15,0x59,0x92,0x1f,0x76,0x29,0x93,0xa9,0xd0,
+0x7c,0xd5,0x0d,0x7d,0x0b,0x41,0x3d,0xe2,0x10,0x0a,0xd9,0x6f,0x35,0xbf,0xf9,0x2f,0x89,0x68,0xfc,0x74,0x5c,0xb5,0x59,0xc4,0x1b,0xc9,0x8f,0xc9,0xa4,0x65,0x66,0xa5,
+0x0e,0xcd,0x6a,0xab,0xa5,0x58,0x2a,0x3a,0x84,0xc6,0x1d,0xcf,0xa5,0xba,0xd1,0x64,0x2b,0x64,0xbd,0x30,0xc2,0x76,0xa0,0xf4,0xd1,0x07,0xf5,0x89,0x94,0xd5,0x0b,0x81,
+0x63,0xa9,0xfe,0x3e,0x70,0xf5,0x7f,0xde,0x58,0x50,0x74,0x5b,0x4e,0x4f,0x53,0xfd,0xf9,0xb7,0x7c,0x0f,0x54,0xb1,0xc5,0xbf,0x3f,0xff,0x09,0x08,0xcb,0xe9,0xba,0x14,
+0x24,0x6d,0xb9,0x4e,0xf8,0x75,0xc7,0xf5,0x55,0x5d,0x56,0xf2,0x20,0xe4,0x42,0x9d,0x2c,0x2f,0x2a,0x1a,0x5b,0x5d,0xab,0x20,0xa6,0x17,0xd0,0x63,0xec,0x8d,0x48,0x1e,
+0xa2,0x8f,0x99,0x2c,0x74,0x30,0x8e,0xba,0x51,0x11,0x32,0xf8,0xce,0xf7,0xff,0x57,0x88,0x02,0x16,0x21,0x8a,0xf6,0x31,0xa6,0xc4,0x28,0xcf,0xe0,0xf1,0x17,0xa4,0xa6,
+0x83,0x0c,0xb3,0x06,0x6c,0x38,0x2d,0x56,0x95,0x06,0x28,0x19,0xb8,0x90,0xcd,0x21,0xe3,0x10,0x84,0xe4,0x41,0x25,0x00,0xeb,0x88,0x55,0x9a,0x2d,0xd5,0xe5,0x4d,0x40,
+0x34,0x3b,0x04,0x4a,0xda,0x46,0xec,0x0a,0x1d,0xc7,0xb4,0x03,0x4a,0x0b,0xcd,0xa8,0x1a,0xf2,0x5d,0x9c,0x9c,0x40,0xbc,0xb1,0x05,0x76,0x10,0xda,0x58,0xd3,0x7b,0x07,
+0x6a,0x82,0x3b,0xca,0xb6,0x9b,0x39,0x43,0x6f,0x8a,0xa4,0x2f,0x02,0x14,0x32,0xc0,0x3d,0xf5,0x71,0x4d,0x6c,0x75,0x5c,0x0a,0x7d,0x75,0x0c,0x2a,0x19,0xb8,0xf6,0x9d,
+0x46,0xff,0x5a,0x80,0x0d,0x7d,0x5d,0xe3,0xf6,0x8d,0x92,0xc7,0x32,0xff,0x5d,0xff,0x6f,0x56,0xa5,0x39,0xa9,0x2e,0x98,0xb7,0xcc,0x56,0x29,0x6f,0x5c,0xaf,0x93,0x46,
+0xfb,0xa4,0x7d,0x53,0x28,0x04,0x4e,0x27,0x95,0x22,0xce,0x1e,0xf9,0xe2,0x84,0x43,0x42,0xa9,0x56,0x64,0x7b,0xb6,0x99,0x9c,0x30,0x11,0x0c,0x43,0xdf,0x0d,0x55,0xdd,
+0x80,0xe8,0x1a,0xff,0x03,0xef,0x63,0x25,0x77,0x9b,0x16,0x1a,0x9d,0xa7,0x59,0xed,0x5e,0x57,0x5b,0x56,0xc0,0xca,0x62,0x6b,0xb8,0x6f,0xf9,0xda,0x18,0xe1,0xfb,0xd8,
+0x7f,0xca,0xf5,0x3e,0x31,0x32,0x3f,0x41,0xd4,0xb2,0x29,0xb1,0x1e,0xb1,0x49,0xdb,0x37,0x56,0x3b,0xda,0x4c,0xb4,0xc3,0x16,0x4e,0x58,0x42,0x1c,0x57,0x2f,0x43,0x79,
+0x2e,0xdc,0x45,0x40,0x1d,0x3e,0xc1,0xd5,0x4f,0x36,0xc6,0x7d,0x4b,0x6b,0x5f,0xab,0x58,0x70,0x93,0x32,0x4a,0x9b,0xad,0x75,0x57,0x9f,0xef,0x88,0x7f,0x7e,0x9e,0x8b,
+0x55,0x95,0x3d,0xbb,0xaa,0x90,0xa5,0xde,0x4b,0x59,0x36,0x22,0xb4,0x6e,0xaa,0x92,0x4d,0x40,0x1f,0xd3,0x8e,0x0e,0x80,0x41,0x64,0xb0,0x8d,0xd9,0x63,0x60,0xaf,0x2b,
+0xac,0x30,0x5f,0xa0,0xc9,0xf4,0x6e,0xdc,0x77,0x51,0xd6,0xd7,0x3a,0x02,0x96,0x52,0x2c,0x71,0x8a,0xa3,0xda,0xfb,0x8d,0x20,0x35,0x9f,0x85,0xd3,0xf4,0x2d,0x7d,0x5d,
+0x80,0x4f,0x2e,0xc1,0x3b,0x4b,0xa6,0xaa,0x4e,0xcc,0xc4,0x82,0x99,0x93,0xc6,0x60,0x45,0x00,0xf9,0x42,0xda,0x17,0xca,0xab,0x8f,0x76,0xb4,0x9d,0x46,0x2c,0xe6,0xea,
+0xea,0x9e,0xd3,0x80,0x11,0x23,0xb5,0xab,0xf6,0xe1,0xbb,0x82,0xc2,0x9e,0x49,0xfe,0x34,0x13,0x68,0xa5,0xa7,0x07,0xbb,0x3a,0xa7,0xc4,0xe2,0xda,0x79,0xf3,0x42,0x87,
+0x85,0xef,0x37,0xf7,0xca,0x4e,0x2e,0x5b,0xa3,0xf5,0x3b,0x36,0xd5,0x93,0x4f,0xed,0x5a,0x6e,0xd2,0x6c,0xf7,0x95,0xac,0xaa,0xe5,0x0e,0x19,0x59,0x6d,0xd2,0x18,0x72,
+0x60,0xd5,0xf5,0xcc,0x61,0x35,0x42,0xf9,0xf6,0xb1,0x55,0xa3,0xfa,0x71,0x91,0xef,0x1b,0x36,0x41,0x49,0x17,0x4c,0x52,0xbd,0x58,0xdc,0x09,0x98,0x5d,0xa4,0x8f,0xec,
+0xd4,0xd1,0xcf,0x7a,0xb9,0x41,0x0e,0xa9,0x35,0xc0,0xf4,0x16,0x4c,0xd4,0x1f,0xbb,0xf4,0x46,0x3f,0x04,0x22,0xd8,0x56,0x82,0xdb,0xad,0x22,0x5e,0xa7,0xf4,0x3c,0xd0,
+0xe6,0x7b,0x55,0x38,0x7c,0xa0,0xf7,0x55,0x3c,0xf6,0x3c,0x08,0x2c,0x96,0xfa,0x7c,0x15,0x8b,0x7a,0xcd,0x1d,0x12,0xc7,0x24,0x36,0x24,0xc2,0x33,0x03,0x89,0x74,0x2d,
+0x24,0xf4,0xf2,0xa4,0x76,0x50,0x8f,0x16,0x7e,0x3f,0xd3,0xcc,0xce,0x74,0xfc,0x12,0xca,0xdc,0x4e,0x13,0x5e,0xcd,0x27,0x6c,0xfb,0x8d,0xfa,0x70,0x9c,0x72,0xa8,0x2e,
+0xcd,0xf7,0x6b,0x53,0x23,0x18,0xb2,0x88,0xa3,0x14,0xae,0x23,0x24,0x7d,0x7b,0x54,0xf1,0xa5,0xa9,0xf8,0xf2,0xa4,0xe2,0xcb,0xaa,0xe2,0x6a,0xcd,0xc3,0x23,0x75,0x21,
+0x82,0x58,0x1c,0x9e,0x81,0x4e,0xc3,0xd4,0xe9,0xc8,0x3b,0x3b,0xec,0x0c,0x12,0x5c,0x45,0xb5,0xaa,0xbe,0x51,0x1f,0xc6,0x91,0xf9,0x3f,0x74,0xa9,0xa6,0x40,0xc8,0xea,
+0x57,0x00,0x8f,0x20,0x07,0x0f,0x88,0xfe,0x9d,0x1d,0x9e,0xa1,0x29,0xa6,0xfa,0x58,0xcd,0x81,0x1d,0x18,0x39,0xa2,0x8a,0x2d,0xab,0x36,0x35,0x9b,0xff,0xd7,0xd4,0xbd,
+0x81,0x47,0x54,0xc9,0x2e,0x9e,0x23,0x98,0x79,0x87,0x1d,0x9a,0x48,0x31,0x57,0x4f,0xa8,0xcd,0xe1,0x99,0x4d,0xc1,0xf1,0x91,0x6f,0x7b,0x08,0x2e,0xd7,0x44,0xe8,0xac,
+0x5f,0x69,0xa6,0xdf,0xc1,0xfa,0x32,0x3e,0xfc,0x9a,0xaa,0x57,0x6c,0xbe,0x5f,0xc5,0xd9,0x61,0xa7,0x4e,0x65,0x09,0x64,0xb2,0x6f,0x50,0x94,0xb0,0x39,0x8a,0xee,0x67,
+0xf5,0xf9,0x34,0x4f,0x46,0xef,0xfe,0x92,0x2f,0xcd,0xc2,0x4f,0xff,0x01,0xcb,0x98,0xb0,0xf3,0x59,0x0b,0x00,0x00
+};
+const size_t WM_PK_LANG_SK_JSON_GZ_LEN = 1270;
 
-const char WM_PK_HTTP_COMMON_SCRIPT[] PROGMEM = "<script>qs=s=>document.querySelector(s);\ngebi=s=>document.getElementById(s);\nwl=f=>window.addEventListener('load',f);\n</script>";
-const char WM_PK_HTTP_WM_SCRIPT[] PROGMEM = "<script>qs=s=>document.querySelector(s);\ngebi=s=>document.getElementById(s);\nwl=f=>window.addEventListener('load',f);\nfunction c(l){\ngebi('s').value=l.innerText||l.textContent;\ngebi('p').focus();\ngebi('s1').value=l.innerText||l.textContent;\ngebi('p1').focus();\ngebi('timezone').value=timezone.name();\n}\n</script>";
+#if WM_STATIC_BROTLI
+const uint8_t WM_PK_OTA_JS_KEYS_BR[] PROGMEM = {
+0x1b,0x64,0x2e,0x51,0x04,0x1b,0x07,0x01,0x31,0xfe,0xec,0x28,0x4a,0xf7,0x66,0x2e,0xa2,0x8a,0x53,0x06,0x68,0x71,0xc0,0x93,0x1d,0x8d,0x22,0x30,0x65,0x02,0xab,0xa9,
+0x22,0x65,0xb8,0x1d,0x05,0x8e,0xe3,0xd5,0xd2,0x2f,0x5f,0xc8,0x9a,0xd5,0x1e,0xa1,0xb1,0x4f,0x72,0x7f,0xfc,0x39,0xfb,0xbf,0x9f,0x2f,0xbd,0x41,0x92,0x12,0x52,0xa0,
+0x5b,0x7c,0x76,0x2c,0xbd,0xb9,0xec,0x8a,0x24,0x60,0x6a,0x18,0x4d,0x22,0xda,0x43,0xce,0xad,0x16,0xb5,0x7c,0x33,0x1b,0x40,0x40,0xb5,0x85,0x4f,0xed,0x2d,0xd9,0xd6,
+0x22,0x8f,0x68,0x15,0xb7,0x1b,0x34,0x12,0x21,0xa1,0xd2,0x34,0xf9,0x11,0xd4,0x79,0x5f,0x7d,0x94,0xd4,0x19,0x53,0x19,0x08,0x75,0x2c,0x40,0xbe,0xd0,0x31,0x88,0x6e,
+0x4a,0x55,0x51,0x7e,0x46,0x2e,0x05,0xd9,0xd4,0x31,0x98,0xfd,0xdf,0x5a,0xe5,0xc9,0x99,0x0d,0xa1,0xba,0x17,0x79,0x4a,0x06,0xc8,0xa8,0x18,0xbd,0xfd,0xa1,0xeb,0xb6,
+0xaa,0x61,0xb7,0x7b,0x60,0xa9,0x67,0x79,0x16,0xf8,0x08,0xab,0xaa,0x87,0x83,0x33,0x7b,0x04,0x93,0x53,0x37,0xee,0x08,0x54,0x88,0x85,0x8c,0x91,0xb1,0x80,0x42,0x46,
+0xca,0xfc,0xff,0xf7,0xaa,0xbe,0x95,0xe3,0xb1,0x9c,0x60,0x02,0x14,0xc0,0xf7,0xfc,0x03,0xc5,0x37,0xde,0xcc,0x9b,0xd9,0x66,0x4e,0x4a,0x73,0xbc,0x63,0x5b,0x4f,0x00,
+0x8b,0x0b,0xe4,0x63,0xf0,0x5a,0xc7,0xb2,0x62,0x8d,0xaf,0x55,0xb7,0x21,0x9a,0x6a,0x9c,0x17,0x60,0x6e,0x3e,0x86,0xd3,0x80,0xbb,0x57,0x31,0x05,0xc5,0x78,0xe4,0x63,
+0x4c,0xfc,0xc7,0x87,0xf8,0xd0,0x84,0xcc,0x6c,0xee,0x3b,0x93,0x7f,0x5e,0xef,0x75,0x11,0x02,0xc6,0x64,0x1b,0xb9,0xdf,0x90,0xcb,0x99,0x02,0xbb,0x2a,0x22,0x1a,0xb7,
+0x44,0xc4,0xbb,0x4e,0x12,0x13,0x6b,0xda,0xcc,0x0d,0xf3,0x4d,0x63,0x4d,0xaa,0x64,0x98,0xef,0x59,0x68,0x3a,0xe5,0xfc,0xce,0x56,0xa5,0x40,0x14,0x77,0xd2,0x5c,0x37,
+0xe5,0xc7,0x22,0xc1,0x66,0xe9,0x94,0x74,0x43,0x7e,0xa4,0xf6,0x3c,0xcd,0xee,0xef,0xa5,0x7d,0x0f,0xa3,0x9c,0xe7,0xe5,0x43,0xc8,0xe4,0xdd,0x97,0xcd,0xb9,0xfd,0xb4,
+0x2a,0x9f,0xff,0x04,0xff,0x90,0x46,0xa2,0x29,0x12,0x6d,0x15,0xe1,0xd0,0xec,0xfc,0xd8,0x40,0x77,0x3a,0x99,0xbc,0x87,0x56,0x19,0xaf,0x3b,0x68,0xbb,0xe0,0x7a,0xd9,
+0x49,0xb8,0x90,0x7e,0x59,0x1a,0xd0,0xe9,0x99,0x1f,0x84,0x51,0x9c,0xa4,0x59,0x5e,0x94,0x55,0xdd,0xb4,0x5d,0x3f,0x8c,0xd3,0xbc,0xac,0xdb,0x3d,0x4b,0x85,0xcc,0xf2,
+0xb9,0x7a,0x5c,0xe8,0xa2,0xac,0xea,0x27,0x63,0xdd,0xb2,0x59,0xad,0x9f,0xff,0x85,0x51,0xd3,0x76,0xfd,0x30,0x4e,0x73,0xb1,0x8d,0x68,0x06,0xad,0xa9,0x9c,0x1e,0xc4,
+0x3f,0x61,0xa9,0x90,0xf3,0x9b,0xec,0x70,0x28,0x36,0x76,0xb4,0xef,0x6d,0x53,0x8a,0x8e,0xe4,0xd7,0x67,0x80,0x0c,0xf7,0x8e,0x5e,0x53,0x96,0x42,0xf1,0x32,0xf4,0xcb,
+0xbc,0xca,0xb0,0xfd,0x96,0x10,0xb3,0x95,0x01,0xd0,0xd4,0x3c,0x49,0xd1,0x44,0x19,0xe3,0xe5,0xa7,0xb0,0xa5,0x87,0xc8,0x31,0x7b,0xc8,0x53,0xfe,0x57,0xfc,0xd8,0xf0,
+0x97,0x5d,0xb3,0x95,0xa8,0xa1,0x42,0xe9,0xe2,0x7e,0x02,0x42,0x89,0xa1,0x16,0x7f,0x9e,0xf0,0x7d,0xf2,0x3f,0x15,0xb7,0x5b,0xc6,0xd8,0x90,0xf8,0x12,0x51,0x11,0xc6,
+0x6d,0xc7,0xba,0xd0,0x7b,0xf6,0xec,0xa4,0x65,0x51,0x8b,0xf4,0xf3,0xa7,0xb7,0xb2,0x23,0x93,0x0d,0x02,0x92,0x44,0x2d,0xd4,0x95,0xdc,0x54,0xce,0xf5,0x6b,0xdc,0x0f,
+0x48,0x21,0x23,0xe4,0x2c,0xee,0xe8,0x7b,0xf5,0xc4,0xb6,0x0a,0xd7,0xbf,0x82,0x1c,0x42,0xa6,0x10,0x8a,0x33,0x9f,0xe1,0xff,0x31,0x4d,0x7d,0x38,0x44,0x12,0xd3,0x74,
+0xb4,0xef,0xfd,0xdb,0x09,0x76,0xca,0x6f,0xd7,0x61,0xdc,0x95,0xe9,0x1b,0x35,0x09,0x61,0x1d,0xda,0x66,0xc8,0x91,0x6a,0xcd,0x44,0x56,0xb6,0x76,0x1a,0x71,0x20,0xb1,
+0x9c,0x8b,0x49,0x39,0xc5,0x1f,0xd5,0x74,0x25,0x7f,0xa3,0x26,0xc7,0x7d,0x2f,0xcf,0x85,0x8e,0xe5,0x7a,0x61,0x97,0x44,0x24,0x02,0x08,0xbb,0x42,0x87,0x7f,0x6f,0xa4,
+0x27,0x1a,0x00,0xd2,0x9c,0x2b,0x47,0x3d,0x08,0x26,0xe0,0x7f,0x05,0xd9,0x80,0x10,0x09,0xce,0xb3,0x96,0x22,0xc3,0xf4,0x44,0x2c,0x1a,0xb3,0x46,0xfb,0x3d,0x66,0x6f,
+0x1e,0x73,0x1a,0x83,0x51,0xf9,0xc1,0xf3,0x16,0x4f,0xd9,0xfe,0x6e,0x62,0x99,0x1d,0x97,0xca,0x4f,0x0b,0x6e,0x24,0x1a,0xce,0xc7,0x90,0x1f,0xa5,0x3a,0x84,0x9d,0xf1,
+0x70,0x56,0x2d,0xa9,0xe1,0xae,0x54,0x46,0x1d,0xcf,0xb7,0x0e,0x0b,0xb5,0xb5,0xbf,0x42,0x21,0xe5,0x0f,0x0f,0x8e,0x63,0xcd,0x5e,0xc9,0x96,0x39,0x05,0x5d,0xf8,0xe2,
+0xe1,0x8a,0x77,0x4a,0x45,0xf2,0x7e,0x0b,0x2c,0x44,0xe7,0x47,0x80,0xb2,0x4a,0xcd,0xb8,0x4f,0xdd,0x9f,0x61,0xc1,0xb6,0xe9,0xdf,0x3a,0xbd,0x3b,0x0d,0xfe,0x2a,0xe5,
+0x51,0x71,0xb3,0x7d,0xfb,0xaa,0x72,0xda,0xd1,0x56,0xa5,0xa2,0x83,0x29,0xf8,0x97,0xf1,0x37,0x46,0x4a,0xfb,0x10,0x66,0xaf,0x18,0x1b,0xf4,0x8b,0xbb,0x02,0xcb,0xf8,
+0x6e,0x3c,0x88,0x80,0x5c,0x53,0x3e,0xb9,0xae,0x56,0x38,0x66,0x10,0x5f,0x53,0xff,0x10,0xd0,0x4d,0xae,0xc3,0x74,0x2b,0x3e,0xe7,0x8b,0x08,0xc4,0x1d,0x28,0x29,0x7a,
+0xa1,0xcc,0x85,0xd6,0xac,0x05,0x8c,0x21,0x6b,0x9a,0x81,0xcb,0xe2,0x18,0xae,0xf9,0x1c,0x7a,0x65,0xb6,0x4b,0x97,0x1d,0x0e,0xda,0xfe,0xd3,0x2a,0xbd,0xde,0x5e,0x5f,
+0xf7,0x8a,0x3d,0xaa,0x64,0xa4,0x21,0xee,0xd1,0xd3,0x7a,0x9e,0xb2,0x26,0x80,0x56,0xb0,0x86,0xa6,0x46,0xdd,0x59,0xc8,0xb9,0x79,0x47,0x89,0x9a,0x91,0x50,0xc4,0x8e,
+0x9f,0xb0,0x2a,0xb9,0x76,0x8b,0xa3,0x2f,0xcb,0xd8,0xb2,0xec,0x50,0x17,0x85,0xb4,0xea,0xd3,0x94,0xa9,0x0a,0x3c,0x53,0xb6,0xf7,0xd4,0x61,0x4b,0x6a,0x70,0xab,0x8c,
+0xff,0xda,0x27,0x42,0xb3,0xc3,0xf7,0xf5,0xf0,0xcf,0x53,0xbb,0x06,0xd6,0x53,0x7b,0x8b,0x49,0x53,0xc0,0xdd,0x22,0x38,0x81,0xab,0x52,0xda,0xea,0x93,0x99,0x5b,0xa3,
+0xba,0x0f,0x63,0xb7,0x29,0xcf,0xc3,0x1f,0x90,0xb1,0x73,0xf3,0xf9,0xd4,0xde,0xfd,0xbe,0x66,0xf7,0xca,0xfe,0xde,0x8d,0x75,0x69,0x48,0xa8,0xaf,0x7d,0xd9,0x07,0xa0,
+0xd3,0xbb,0x8e,0xbc,0xe7,0xdd,0x3a,0x34,0xaf,0x09,0x58,0x44,0xdb,0x01,0xd0,0x05,0xa0,0xec,0xf9,0x2e,0xac,0x49,0x8c,0xad,0x1a,0x3f,0x73,0x2a,0xa2,0x87,0x61,0xcc,
+0x8d,0x5c,0xe9,0x8a,0xbb,0xf7,0x97,0xb1,0x0a,0x2a,0x1c,0x43,0x5b,0xae,0xcf,0x7f,0xa0,0xab,0x1e,0x02,0x87,0x0c,0x81,0x48,0x7d,0xf6,0x2e,0x63,0x21,0x83,0x09,0x53,
+0xdc,0x43,0xa8,0x85,0x4f,0x54,0xc0,0x44,0x57,0x26,0x28,0x87,0xd5,0x70,0x4a,0x55,0xb6,0x48,0x3b,0x4b,0x2a,0x8d,0xb5,0x63,0xe5,0x79,0xea,0xab,0xaf,0x4c,0x01,0x00,
+0x1a,0x7f,0x20,0x6e,0x9e,0xd1,0x91,0x82,0xd0,0xef,0xe1,0x94,0x2c,0xc0,0x6b,0x64,0x70,0xc2,0x19,0xc1,0x67,0x91,0x6b,0x83,0x15,0xe2,0x9c,0xc6,0x28,0x7b,0xa4,0x34,
+0xc4,0xd2,0x27,0x8a,0x95,0x3d,0xed,0xcc,0xb5,0x67,0x8f,0xad,0xc9,0x3e,0xc0,0x0f,0x8b,0xdd,0x21,0xc9,0x0e,0xcf,0xc3,0x29,0x88,0x96,0xbc,0x81,0x34,0x29,0xdd,0x06,
+0x34,0xeb,0x16,0x81,0x83,0x79,0xd6,0x90,0x36,0x7b,0x3f,0x93,0x25,0xc4,0x8e,0x2a,0x6b,0x9e,0xde,0xde,0xa8,0xe1,0x48,0x3b,0xc7,0x62,0x05,0xc1,0xd5,0xe5,0x8e,0x0e,
+0xe0,0xd8,0x89,0x4b,0x08,0xb5,0x1c,0x1a,0xb5,0xed,0x5b,0xee,0x62,0xa6,0xcb,0xdb,0x0d,0x9f,0x82,0x46,0x17,0xb6,0xd8,0xb7,0xe9,0x83,0x09,0x26,0x28,0xc4,0x1d,0x36,
+0x4f,0x63,0x8a,0x70,0x49,0x3a,0x75,0xcf,0x3b,0x8f,0x9a,0xc9,0x0e,0xea,0x7d,0x83,0x66,0x8a,0x6b,0x7f,0xbf,0xc3,0x3e,0x9b,0xd7,0xe1,0x2e,0x8a,0xa8,0x7b,0xdb,0x6a,
+0xf9,0x6e,0x17,0xc0,0xd9,0x7d,0x96,0xd1,0xfc,0x74,0x38,0xcf,0xe9,0x3c,0x3c,0x9f,0xd3,0xe7,0x7b,0x94,0x62,0x75,0x0d,0xd1,0xa0,0x0a,0x7f,0x3a,0x87,0x92,0x7e,0x33,
+0x25,0x5d,0x40,0x45,0xef,0xc1,0x25,0x25,0x14,0xb8,0xa4,0x92,0x56,0xd4,0xd1,0xef,0x37,0xfe,0x65,0xe2,0xc7,0xf5,0xe8,0xc5,0x4e,0x9f,0xfa,0xe3,0x25,0x8d,0x2f,0x03,
+0x5a,0xc1,0xbe,0xe5,0x31,0xda,0x4b,0x3b,0x2b,0xcf,0xf8,0x30,0xa0,0x95,0x75,0x7c,0x5e,0xa0,0x89,0xe8,0xf3,0x5c,0xee,0x6a,0x2a,0xad,0xdf,0x0a,0xfd,0xeb,0xa8,0x07,
+0x61,0xa7,0x22,0xe1,0x23,0x2b,0xda,0x10,0x4e,0x9b,0xbb,0x37,0x3a,0x30,0x0b,0xc0,0xc2,0xa5,0x9b,0x03,0x7a,0x54,0xa2,0xcc,0x60,0x86,0xe0,0x0c,0x72,0x2b,0xab,0x96,
+0xe6,0x0c,0xa0,0x98,0x39,0x62,0x8e,0x81,0x97,0x35,0x6d,0x0e,0x8e,0x09,0xef,0xe3,0x42,0x6b,0x33,0x21,0x3d,0xe4,0x0e,0x86,0xd9,0x35,0x62,0xf1,0x02,0x59,0xb8,0xa1,
+0xde,0x1a,0x53,0x9e,0x64,0xc8,0x24,0xb8,0x30,0x66,0x62,0x50,0x40,0xd5,0x61,0xaf,0xf3,0x82,0xa5,0x8e,0xa2,0x3a,0x70,0xe4,0x0f,0x3f,0xce,0x07,0x3b,0x73,0x1d,0x02,
+0xac,0xc4,0xac,0x3f,0xf8,0xec,0x36,0xfa,0x02,0xb6,0xca,0x39,0x52,0xf2,0x25,0xbf,0xb0,0x86,0x33,0xd4,0xc2,0xce,0x03,0x18,0x0b,0x1e,0x1a,0xed,0x8d,0x50,0x46,0x07,
+0x32,0x60,0xb2,0x7d,0x1c,0x12,0x76,0xf0,0xec,0x7d,0x08,0x2b,0xd4,0x61,0xa0,0x1b,0x9e,0x95,0x82,0xc6,0x10,0x23,0xd1,0xac,0x57,0x1d,0x6d,0xf6,0xda,0x6d,0xad,0xed,
+0x38,0x43,0x00,0xbc,0x85,0xfa,0xd0,0xd6,0x16,0xc2,0x1d,0xb5,0xae,0xa9,0x37,0x24,0x5b,0x71,0x18,0x70,0x48,0x61,0x10,0xda,0x67,0xe9,0x9e,0xd0,0x2a,0xd8,0x84,0x86,
+0x38,0x3b,0x36,0x7a,0x86,0x4e,0xc9,0x3f,0xb4,0x9e,0x72,0x19,0xb3,0xf0,0x05,0x5e,0x75,0x63,0x46,0x46,0x67,0x89,0x37,0xa8,0x59,0x9c,0xac,0x42,0x61,0x5e,0x97,0x8f,
+0x42,0x55,0xc6,0x6e,0xe7,0x28,0xc9,0x17,0xfb,0xb9,0x3a,0x08,0xe9,0x32,0x76,0x1d,0x12,0x85,0x08,0x8a,0x70,0x49,0x73,0xa2,0x79,0x48,0x1a,0x9f,0x2b,0x34,0xb8,0xd1,
+0xa6,0x59,0x53,0x7b,0x52,0xa0,0x35,0x00,0x85,0x89,0x6f,0x5a,0x06,0x4c,0xc4,0x79,0x84,0x36,0xdc,0xa1,0x90,0x12,0xcb,0x9a,0xe3,0xd8,0x2b,0xa0,0x3c,0xfb,0x6c,0x34,
+0x55,0x65,0x8d,0x20,0x53,0x95,0xe2,0xcd,0xb5,0x1a,0x08,0xab,0x51,0xc7,0xbd,0xa9,0x75,0x59,0x42,0x69,0x43,0x6d,0xef,0xd8,0x31,0x0b,0x21,0x2e,0x2e,0xb3,0xca,0x88,
+0x41,0xca,0x14,0xc6,0x95,0x82,0xd5,0xf5,0x02,0x77,0x91,0xb6,0xc3,0x60,0xb7,0x80,0x08,0xbc,0x97,0x32,0x22,0xac,0x6d,0x37,0xe6,0xfb,0x6b,0x78,0xb2,0x7a,0x8f,0xa6,
+0x77,0xb4,0x74,0x45,0xdb,0xb1,0x46,0xac,0x7c,0xa8,0xb9,0x76,0xcb,0x08,0x6e,0x32,0x56,0xed,0xdd,0xc1,0xcb,0x90,0x85,0x0c,0x0e,0xe0,0x4d,0x86,0x46,0x8b,0x0b,0xee,
+0xf9,0xb6,0x1b,0x8d,0x01,0xec,0x81,0x30,0xa5,0xc9,0x90,0xa1,0x10,0x5f,0xd5,0xdc,0xb9,0xd6,0x02,0x64,0x47,0xa2,0x94,0x1b,0x33,0x96,0x20,0x34,0x39,0xb6,0xef,0x34,
+0x0c,0xd3,0xcd,0xcc,0x43,0x5a,0xf8,0x96,0x90,0xa6,0x70,0x0c,0xdb,0xb6,0xed,0xd2,0x21,0x39,0x29,0x61,0x60,0x0d,0xcb,0x27,0x1b,0x14,0xa1,0xb9,0x56,0x01,0x65,0x71,
+0x67,0xa7,0x72,0xae,0x7d,0x9b,0x03,0x99,0xd8,0xaa,0x96,0xbc,0xee,0x36,0x4b,0xff,0xdc,0xda,0x77,0xa3,0x04,0xe9,0x7f,0x3b,0x17,0xad,0xa0,0xf2,0x17,0x11,0x07,0xce,
+0xbf,0xef,0xc6,0x1d,0x35,0x5d,0x7d,0xdf,0x4a,0x67,0x2a,0xc1,0xd1,0x2d,0x42,0x83,0xa1,0xbb,0xc3,0xd8,0x2d,0x35,0xb4,0x16,0xa0,0x3a,0xec,0xf9,0xd9,0x41,0xea,0x63,
+0xe5,0x99,0xcd,0x7f,0xe5,0xd5,0xa4,0xc0,0x65,0xc4,0x5b,0x14,0x55,0x12,0xce,0x63,0x37,0x1c,0xca,0x8d,0xbb,0xaf,0xe9,0x84,0x24,0x85,0xea,0x78,0x3d,0xe7,0x79,0x62,
+0xea,0x8d,0xf1,0xfe,0x7b,0x9d,0xcf,0x9f,0xe7,0xce,0xdc,0x4d,0x1e,0x95,0x2a,0x45,0x49,0x3d,0xfb,0x8e,0x6c,0xfe,0xd7,0x04,0x67,0xf6,0x95,0x62,0x77,0x7e,0x14,0x0d,
+0x7a,0xfb,0x08,0x95,0x4b,0xeb,0x1e,0x83,0xf7,0xdb,0xc0,0xa6,0xe7,0xd8,0xc9,0x16,0xa7,0xb0,0xa5,0xf5,0x59,0x24,0xb9,0xb9,0xa9,0x56,0xbd,0x52,0xae,0x66,0x59,0xf3,
+0x99,0xf8,0xf5,0x7b,0xa9,0xfe,0xee,0xe2,0x6d,0x8f,0xc9,0xe9,0x5b,0x04,0x38,0x79,0x8b,0x32,0x9f,0x12,0xb5,0xd6,0x8d,0xbe,0xa5,0x18,0x73,0xc0,0x62,0x73,0x0f,0xb7,
+0x3f,0x62,0x6e,0xcd,0x93,0x63,0x33,0xd0,0xe2,0x8d,0x93,0x56,0x62,0x63,0xf7,0x2a,0x43,0x16,0xcd,0xba,0x90,0x9c,0x5e,0x18,0xdb,0xf0,0xdb,0x7f,0x98,0xef,0xb9,0xab,
+0x75,0xed,0x2b,0x9c,0xe2,0x1f,0x9e,0x75,0x6a,0xbf,0x76,0xc3,0x3e,0x16,0x83,0xfb,0xcf,0xbc,0x2f,0x2a,0xc1,0xf5,0xb9,0xb5,0x80,0x98,0xd2,0x0f,0x3a,0xad,0xc3,0x96,
+0x0f,0x82,0xfd,0xd2,0x0f,0x96,0xa8,0xd2,0x4a,0x37,0x08,0x35,0x36,0xc1,0xa0,0xc9,0x73,0x0c,0x87,0xfc,0x29,0xab,0xcd,0x65,0xeb,0xde,0x40,0xee,0x94,0xfe,0x55,0xc2,
+0x3d,0x50,0xc1,0xb9,0x2d,0x32,0x0b,0x92,0xf9,0x34,0xfa,0xf1,0x30,0x5d,0x23,0xb7,0xab,0x1a,0x78,0x42,0xe5,0xb8,0xf8,0x2f,0xb0,0xe9,0x9e,0x55,0xeb,0xd6,0x4b,0x64,
+0xb6,0x58,0x77,0x69,0xfb,0x06,0xc3,0x85,0x5a,0xda,0x01,0x3b,0xe8,0x6f,0xb2,0x48,0xc8,0x7c,0x65,0xc9,0x0e,0x0a,0xef,0xb6,0x5e,0xf7,0x76,0xe2,0x42,0x47,0x71,0x8d,
+0xc5,0x13,0xc4,0x29,0x88,0xe2,0xca,0x61,0xd4,0x8b,0x5d,0xa7,0xf4,0x89,0x27,0x85,0x2a,0xf9,0x37,0x32,0xe6,0x21,0x10,0x4e,0x45,0x5b,0x9f,0x4f,0x02,0xf3,0x93,0x3e,
+0xb2,0xd7,0x30,0x06,0x50,0xcd,0x8c,0x96,0x86,0xbd,0xb1,0x81,0xd0,0xfb,0x7f,0x1d,0xf7,0x8c,0xea,0x89,0x71,0x6d,0x64,0x51,0x0f,0x8d,0xd8,0xe3,0x07,0x3c,0x23,0xe0,
+0x72,0x75,0xfa,0x8d,0xc3,0x55,0xde,0xb3,0x67,0x1d,0xb3,0x16,0x13,0x00,0x7c,0x9f,0xeb,0xb1,0xfd,0x1f,0x3c,0x6c,0x54,0x95,0x19,0x7b,0xa4,0x20,0x13,0xf6,0x2c,0x30,
+0x23,0x47,0x23,0xa6,0x05,0x0c,0x31,0x9e,0x71,0x16,0xf2,0x99,0x6f,0x11,0xd9,0x1e,0x84,0xf9,0xd6,0x55,0xed,0x49,0x43,0xbe,0x64,0x2a,0xc7,0xef,0x87,0x77,0x06,0xfb,
+0x95,0x39,0x89,0x28,0x9f,0x2b,0x6c,0xde,0x22,0xb7,0xe3,0xa0,0x9e,0xc6,0xd9,0xc2,0x35,0xa0,0x0f,0xe3,0x68,0x45,0x4a,0xd1,0x45,0xd6,0x82,0x0a,0xce,0x44,0x72,0xba,
+0x36,0x32,0x40,0xd7,0x00,0x3e,0x9f,0x96,0xae,0x75,0xc9,0x49,0x90,0x32,0x50,0xef,0xc7,0x0f,0xcc,0x14,0x2d,0x66,0x4e,0xb8,0xbe,0x2b,0x03,0x53,0xad,0xda,0x0c,0x96,
+0xe4,0xbc,0xc6,0xa9,0xa2,0x8c,0x65,0x30,0xd8,0x28,0x82,0x6c,0x80,0xc5,0x61,0xb2,0xe4,0x7e,0x96,0xf0,0x22,0xd4,0x0c,0xe6,0x95,0x2d,0xbf,0x59,0x63,0xc0,0x1a,0x92,
+0xec,0xbe,0x4d,0xc0,0xca,0xfa,0x78,0xf6,0xb3,0xb4,0x99,0x9a,0x02,0x6c,0x19,0xdc,0xc8,0xea,0xa8,0xad,0xac,0x1e,0x74,0x0e,0x4e,0x8b,0x24,0xb1,0x18,0xf3,0x98,0x45,
+0x81,0xad,0x28,0x23,0x76,0xc5,0x88,0x4b,0x9f,0x10,0xf1,0xef,0xfc,0x0f,0x24,0x40,0x61,0x82,0xf7,0x9e,0xfa,0x2c,0xea,0xc0,0x58,0xce,0x21,0x50,0xe2,0xf7,0x64,0xd9,
+0xd9,0x38,0x01,0xd5,0x6b,0x43,0x96,0x29,0x01,0x8e,0xdb,0x65,0x99,0x45,0x82,0xfa,0x84,0x09,0x30,0x60,0x62,0x99,0xdc,0xaa,0x6e,0x4b,0xd4,0xf5,0x2d,0x01,0x17,0x4b,
+0x7d,0x65,0xfb,0x2a,0x07,0xd9,0xc7,0x4c,0x48,0x9f,0xf2,0xb7,0x3a,0x11,0x0f,0x18,0xd1,0xc8,0xd5,0xc2,0xe6,0x80,0xad,0x4d,0xf4,0x01,0xf8,0x7d,0x79,0x72,0x18,0xec,
+0x36,0x78,0xfd,0x5e,0xea,0x42,0xfe,0x6c,0x19,0x93,0x8f,0x38,0xab,0x16,0x04,0x70,0x61,0x42,0x35,0xa1,0x75,0x70,0xe7,0x77,0xaa,0x90,0xad,0xd5,0xb9,0x49,0x49,0x15,
+0xb2,0x21,0x16,0xa3,0x3d,0x6d,0xa7,0xc8,0xe2,0x0d,0x22,0x75,0xfd,0x4f,0x39,0x4a,0x7d,0xd3,0x02,0xd3,0x1d,0x07,0x36,0xe7,0xc7,0x44,0x96,0xc2,0xfa,0x49,0x94,0x5b,
+0x74,0xef,0xd4,0x91,0x8f,0x58,0xc7,0x76,0x50,0xa2,0x18,0xf6,0x9f,0x91,0x9e,0x12,0xcd,0x19,0x73,0x5e,0x3a,0x77,0x1c,0x81,0xe0,0x56,0xf8,0x41,0xaa,0x16,0x09,0x57,
+0xd1,0x48,0x15,0x87,0x43,0x11,0x9b,0x2f,0x01,0x06,0xea,0x7c,0xd4,0x01,0xb3,0xd6,0xe8,0xa7,0x1b,0x2b,0x83,0xc0,0xd2,0x85,0x49,0x0d,0xf9,0x0b,0xb0,0x52,0x88,0x49,
+0xdd,0x2b,0x35,0xf9,0xd3,0x39,0x45,0x96,0x46,0xd7,0x2d,0x87,0x10,0xc2,0xa7,0x1f,0x74,0xb6,0x23,0x3a,0x1d,0x92,0x4f,0xd9,0x46,0x49,0x17,0x8c,0xcc,0x8c,0x75,0xcf,
+0xf5,0x9f,0x35,0xdb,0x70,0x75,0xa8,0x73,0x3f,0xfb,0xda,0x23,0xe9,0x64,0xfc,0x6f,0xaf,0x8b,0x30,0xd1,0x96,0x5f,0x35,0x1e,0x8d,0xec,0x60,0xc0,0xfc,0xd1,0xb8,0xab,
+0xd7,0x80,0xe6,0x85,0x52,0x4e,0x80,0xe1,0x1b,0xf8,0x12,0x5c,0x7b,0x68,0xb9,0xf7,0x12,0xa8,0x73,0xf4,0x7a,0xc6,0xe7,0xe3,0x42,0xbc,0xbc,0x6c,0x15,0xa0,0x73,0xbd,
+0x80,0x99,0xeb,0x5a,0x78,0xae,0xa1,0x7e,0x7b,0xf9,0xe5,0xf9,0xa4,0x31,0x76,0x45,0x61,0xfa,0xfc,0x4c,0x09,0x3c,0x5b,0x66,0xd4,0xf1,0x9c,0x38,0x84,0x68,0x06,0xcd,
+0x1b,0xad,0x1b,0x12,0xec,0xf8,0x04,0xba,0x72,0x5f,0x30,0x99,0x2c,0x75,0xd9,0xb9,0xbf,0x6c,0x30,0xa9,0xa4,0x4a,0x62,0x30,0xd8,0x89,0x37,0xa8,0xe5,0x21,0x9e,0x4c,
+0x1e,0x66,0xbd,0x74,0x85,0xc0,0xa9,0x90,0x4b,0x23,0xdd,0x1a,0x72,0xb6,0x25,0xf0,0xac,0x85,0xcb,0xec,0xe3,0x47,0x1e,0x87,0xf6,0xb3,0x8f,0x40,0x91,0xbe,0x73,0x36,
+0x55,0xfe,0xe3,0xed,0x3d,0x80,0x9b,0x4d,0x1f,0x6f,0xe1,0xce,0x49,0x0e,0x42,0x25,0x6c,0x74,0x20,0x10,0x0e,0x17,0xcd,0xc8,0x87,0x48,0xcd,0xf8,0x8d,0xa0,0xea,0x5a,
+0x80,0xf2,0xc1,0xe2,0x7a,0x1d,0x14,0x16,0x43,0xcd,0x41,0xcf,0x13,0xb9,0x00,0xbf,0x12,0xc2,0xd5,0xac,0x83,0x1e,0x74,0xd7,0xa1,0x85,0xef,0xe7,0xa0,0xa0,0x17,0xf2,
+0xe7,0x2f,0xe4,0x33,0x42,0xda,0xe2,0xeb,0x45,0x35,0x23,0x61,0xe7,0x14,0x1a,0x8d,0xe3,0x49,0x97,0x22,0x70,0xec,0x22,0xda,0xd6,0x22,0x61,0x3a,0x23,0xdb,0xc8,0x2d,
+0xff,0xb7,0x44,0xfa,0xf8,0x1f,0x43,0x90,0xa7,0x5d,0xe1,0x30,0x30,0x18,0x24,0x97,0x81,0x91,0x0e,0x23,0x8c,0x8c,0x7d,0x95,0xfc,0xc1,0x93,0x19,0xaf,0x20,0x93,0x28,
+0x66,0xc8,0xf9,0x77,0x13,0x52,0x72,0x8c,0xb8,0xe7,0x1e,0x0d,0x69,0x25,0x80,0x68,0x21,0x80,0x38,0x49,0xaf,0x59,0x88,0x3d,0xf8,0x4a,0xf6,0x7d,0x72,0xb7,0x34,0x5f,
+0x29,0x01,0xf9,0x43,0x37,0xff,0x51,0x8a,0x4e,0xb6,0x3e,0xb8,0xf1,0x9b,0x6e,0x9d,0x0c,0xe6,0xab,0x01,0xba,0xbf,0xe0,0x46,0x9a,0x87,0xb7,0x35,0x12,0xe4,0x2f,0x2a,
+0xbe,0x7d,0x5a,0xe7,0x1c,0x23,0xbb,0xe0,0xb6,0x10,0x7b,0x14,0x9b,0x21,0xda,0x50,0xc1,0x7d,0xb9,0x83,0xba,0x28,0x60,0x19,0x25,0x0f,0xe2,0xcd,0x35,0x81,0xdb,0x33,
+0x4e,0xed,0xa9,0x17,0x43,0x38,0x9b,0x53,0xc8,0x0c,0x00,0x0e,0x07,0x86,0x51,0x90,0x34,0xf4,0x34,0x2d,0x64,0x33,0x0e,0x30,0x90,0x02,0x61,0xe9,0x8c,0xcd,0x06,0x3b,
+0xf8,0x96,0x4c,0xba,0x74,0x8e,0xd1,0xb6,0x7d,0x3a,0x16,0x6b,0x30,0x8b,0x10,0x56,0x84,0x6b,0xda,0xc0,0xe8,0xb6,0x3a,0x5f,0x31,0xc1,0xfa,0x78,0x5d,0x49,0xc2,0xc8,
+0xfd,0xa2,0x4d,0x86,0xb2,0x4c,0x3a,0x44,0x85,0xf7,0x31,0x2f,0xe4,0x7b,0x3a,0xb1,0xf7,0xc8,0x00,0x65,0x06,0x59,0x48,0x0b,0x78,0xb4,0x71,0x91,0xb5,0x99,0x8b,0xe8,
+0x45,0xd3,0x47,0xb0,0xe1,0x72,0x7d,0x1c,0x22,0x29,0x77,0x21,0xa9,0x6d,0x30,0x92,0x44,0x01,0xb1,0x88,0x4d,0x16,0x41,0x93,0x71,0x4f,0xae,0x26,0xd4,0x1c,0x51,0x4f,
+0x16,0x11,0xf4,0xc9,0x1e,0xb4,0x5d,0xc0,0x04,0xfe,0xd6,0x19,0x0c,0x73,0x05,0xea,0x9d,0xb9,0xc6,0xb0,0x22,0x32,0xec,0x72,0xa9,0x68,0xa4,0x41,0x88,0xb9,0x7a,0x80,
+0x9f,0x42,0x58,0x12,0x16,0xf2,0x58,0x29,0x07,0x4c,0x4f,0x87,0xc2,0x82,0x26,0x23,0x5f,0xab,0x55,0x2f,0x71,0xe6,0x39,0x6b,0xe6,0xc5,0xdb,0x00,0x71,0xd4,0x2b,0x1c,
+0xa8,0x7e,0x44,0xb2,0xef,0xbc,0xe7,0x29,0xc6,0x00,0xc0,0x73,0x22,0x63,0x84,0x4e,0x2a,0x5d,0xdd,0x6c,0xa4,0x08,0xdc,0xda,0x39,0x59,0x26,0xf9,0x96,0xb5,0x33,0x57,
+0x22,0x4c,0x83,0x91,0x29,0x45,0x45,0x04,0x71,0x06,0xa1,0x64,0x6c,0x46,0xd8,0x92,0xb8,0x53,0xba,0xd7,0x44,0x9d,0xab,0xff,0x22,0xc2,0xd6,0x78,0xb9,0x71,0xb8,0x3c,
+0x9e,0xd3,0x00,0x27,0xac,0x75,0xcd,0xc1,0x4f,0x58,0x35,0xde,0x9a,0xd4,0x22,0x08,0xf9,0xa5,0xff,0x9b,0xfb,0x20,0xaa,0xc3,0x5d,0x50,0x21,0xf6,0xd0,0x92,0xd9,0x30,
+0x43,0xcc,0xa2,0x45,0xd3,0x10,0xcb,0xe5,0xaf,0x81,0x8e,0x0c,0x47,0x3e,0x3f,0xc9,0x76,0x9c,0xa9,0xaa,0x44,0x35,0x41,0x93,0x52,0x38,0x19,0x00,0x8a,0x83,0xb6,0xa6,
+0x64,0x16,0x13,0x7b,0x1b,0x1d,0x7d,0x54,0xf2,0x67,0xf5,0xe6,0x72,0x55,0xd7,0x46,0x75,0xf6,0xfa,0x32,0x58,0xb9,0x63,0x2c,0xc8,0xa6,0x45,0x0d,0x5d,0x31,0x85,0x43,
+0xf1,0xe9,0x63,0x88,0xb3,0xb4,0xc2,0x59,0x5a,0xed,0xca,0xb2,0x1f,0x61,0xd1,0xe2,0x70,0x10,0x06,0x5e,0xc7,0xc9,0xcf,0x60,0x88,0x54,0x75,0x55,0x63,0x72,0xcf,0xfb,
+0x7b,0xaf,0x08,0x5e,0xb1,0x58,0x1f,0xbd,0xfe,0xf1,0x23,0xfd,0xb0,0x4a,0xbd,0xd2,0x35,0x26,0xbe,0x7f,0x25,0x5d,0x80,0x6e,0x93,0x35,0x5a,0xba,0xa6,0x26,0x99,0x93,
+0xca,0xf1,0xf3,0x0d,0x74,0x42,0x4c,0x32,0xa2,0xbd,0x49,0xcc,0xe4,0xf7,0xfc,0xa6,0xb7,0x1d,0x9b,0x9b,0x22,0x3b,0xfe,0x06,0x25,0xf2,0x4d,0x20,0xcf,0x75,0xc6,0xa7,
+0xa5,0xc3,0x86,0x92,0xc5,0x1d,0x16,0x8a,0xf9,0xa4,0xd0,0x7a,0x68,0x05,0x5e,0x43,0x21,0x04,0x33,0x42,0xe1,0x53,0x46,0x5b,0x64,0x06,0xff,0x1c,0xd3,0xdf,0x4d,0x5a,
+0x02,0x0c,0xf6,0x27,0x47,0x74,0x09,0xbf,0x7d,0x34,0xfe,0x0d,0xe9,0x89,0x1c,0x77,0x75,0xd2,0xa5,0xcf,0xd7,0x70,0x57,0xfd,0xc8,0x20,0x00,0x8d,0x20,0x99,0x66,0x41,
+0x33,0xa2,0x7b,0x9e,0xea,0x11,0xe5,0x8a,0xca,0x4d,0x7f,0x7a,0x47,0x24,0x3b,0x02,0x50,0xca,0x1e,0xf6,0x2d,0x80,0x24,0xea,0x99,0x5c,0x74,0x89,0x1b,0x8c,0xf6,0xbb,
+0x09,0x97,0xb1,0xdf,0xa5,0xb0,0x39,0xf1,0xcb,0x3f,0x6b,0x43,0x3e,0x60,0x0b,0x2c,0xc5,0x9c,0x51,0x4b,0xcd,0xc1,0x44,0xe6,0x85,0xef,0x88,0x31,0xfd,0x0f,0x5f,0x42,
+0x59,0x08,0x28,0xad,0x6f,0x22,0xd5,0x40,0xcf,0xe7,0x98,0x42,0x50,0xa5,0xd4,0x62,0xc2,0xbe,0x32,0x71,0x95,0xab,0xb4,0xe0,0x3d,0x03,0x22,0xc4,0xc3,0xe7,0xf2,0xc9,
+0x64,0x97,0x1f,0xa8,0x2a,0xdb,0xed,0x61,0xbb,0x72,0x7c,0x1b,0x21,0x79,0x2c,0xc3,0xb8,0x0b,0xbc,0x6e,0xb3,0x2e,0x0b,0x73,0x46,0xf0,0xba,0xfa,0x89,0xba,0xfc,0xe8,
+0xbc,0x91,0x1a,0xa8,0xcf,0x1c,0xf2,0x80,0x7d,0xc1,0xaa,0x05,0x49,0x6d,0xdf,0x97,0x27,0xd6,0x11,0x0a,0xda,0x46,0x10,0xea,0xa2,0xca,0xb4,0xaf,0x07,0x10,0x9b,0x65,
+0xcf,0xd6,0xed,0xed,0x03,0xa0,0x4f,0xef,0x18,0x58,0x84,0xfb,0x63,0x5c,0x09,0x9a,0x9d,0x60,0xa2,0xd3,0x48,0x59,0xd1,0x55,0x8e,0x91,0x38,0x6c,0xe9,0xd3,0xe0,0x8e,
+0x8e,0x50,0x1e,0x20,0xca,0xc3,0x1d,0xa5,0xe0,0x03,0x48,0x85,0xc2,0x68,0x67,0xd8,0x00,0x50,0x4a,0xdb,0xb2,0x47,0x70,0x94,0xa8,0x15,0x51,0x93,0x68,0x82,0xec,0x31,
+0x51,0xfc,0xd0,0x3a,0x4b,0x0e,0x80,0x40,0x4a,0xfb,0x20,0x2f,0x01,0x9a,0x6d,0x79,0xc8,0x16,0x98,0x67,0xd2,0x32,0x57,0x83,0x1c,0x1b,0x34,0x46,0x73,0xd8,0xac,0x3b,
+0x55,0xbc,0x6d,0xe6,0x6e,0xaa,0xb6,0xca,0x15,0x94,0x8f,0x6b,0x12,0x75,0xec,0x47,0xfe,0x14,0xaa,0x12,0x6e,0x13,0x3c,0x94,0x54,0x86,0x19,0xdd,0xee,0x04,0xb8,0x20,
+0x03,0xd6,0xd4,0xb7,0x81,0xd8,0x29,0x12,0xa1,0xda,0x23,0xde,0x36,0xa8,0x69,0xc9,0x4e,0x03,0xec,0x22,0x45,0x5f,0xa1,0xda,0x90,0x0a,0xa5,0x94,0x6c,0xbc,0x69,0x2f,
+0xbb,0x4b,0x6d,0xd7,0x36,0x50,0xb3,0x98,0x6d,0x99,0x24,0xba,0x9d,0xb4,0xd2,0x35,0xc1,0xd8,0x9b,0x47,0x3d,0xc4,0x1b,0x52,0x05,0x31,0x38,0xcd,0x3e,0x5d,0xe3,0x8a,
+0x00,0x27,0x21,0xe7,0xe1,0x2a,0x56,0x04,0x3c,0x12,0xb5,0xf5,0x29,0x09,0xa5,0x17,0xb3,0x9d,0xaa,0x42,0xc5,0xb2,0xa9,0x17,0x22,0xa9,0x56,0xfe,0x4d,0xa6,0x68,0x51,
+0xe5,0x9c,0xb1,0x44,0x46,0xb8,0x53,0x02,0xf0,0x74,0x2b,0x35,0x68,0xa7,0x53,0xab,0xcf,0x56,0xfc,0xd5,0xbf,0x42,0xef,0xd9,0xbe,0x15,0xff,0xa7,0x46,0x3b,0x92,0xd8,
+0x2e,0xe5,0x5d,0x6a,0xa0,0x73,0xe6,0xf7,0x3e,0xda,0x06,0xb9,0x74,0x28,0x89,0x64,0xce,0x0d,0xbe,0x66,0xf7,0x98,0x8c,0xb9,0x01,0x63,0xbe,0x71,0xdd,0x4f,0x64,0x0c,
+0x40,0xe2,0xc8,0x80,0xa2,0xbe,0x91,0xa8,0x0a,0xe1,0x3a,0x0b,0x65,0xc6,0x41,0xd8,0x39,0x81,0x6b,0x5d,0xbb,0x54,0x95,0x57,0xce,0x8a,0xf0,0xaf,0x3b,0x20,0xad,0x4c,
+0x24,0x17,0x75,0xd9,0xa8,0xa2,0xff,0xb4,0xbe,0x90,0x5d,0xcb,0xb9,0x27,0xf8,0x1a,0xb5,0x52,0x03,0x4c,0x10,0x88,0x4a,0x6b,0x40,0x8c,0x23,0x42,0x90,0xe3,0xd6,0x40,
+0x9e,0xb7,0xd2,0x13,0x02,0x28,0x94,0xad,0x97,0xc6,0xac,0xb6,0x4a,0x44,0x0b,0x9f,0x15,0x73,0xb1,0x8e,0x49,0x40,0xb0,0x2b,0x84,0x4b,0x9b,0x6c,0x59,0xd9,0xd9,0xe5,
+0x1b,0x24,0x8c,0x11,0xe1,0x6d,0x9e,0x77,0xbb,0x05,0xcb,0xb4,0xd7,0x0b,0xb1,0x47,0xdc,0x6b,0x5b,0x6b,0x29,0xbd,0xaa,0x21,0x63,0xa3,0xfe,0xb0,0xfb,0xd3,0x92,0x3e,
+0x58,0x34,0xb1,0x9a,0xe1,0xec,0xe1,0x52,0x51,0x25,0xcb,0xc8,0x18,0xfa,0xf8,0xed,0xf6,0x06,0xa0,0xc4,0x64,0x9a,0x98,0x32,0x8d,0x23,0xa2,0xd5,0x01,0x65,0x71,0x74,
+0x5a,0xeb,0x0e,0xd7,0xf1,0x92,0x29,0x56,0xdc,0x1c,0xff,0x16,0x8f,0x29,0x2f,0x51,0xe1,0xc0,0xed,0x2e,0xdb,0x61,0xeb,0x00
+};
+const size_t WM_PK_OTA_JS_KEYS_BR_LEN = 4216;
+const uint8_t WM_PK_RESTART_JS_KEYS_BR[] PROGMEM = {
+0x1b,0x8d,0x09,0x00,0x8c,0x94,0xee,0xb6,0x84,0x2e,0x75,0xba,0x77,0x99,0xc2,0xb2,0x2e,0x16,0x86,0xf5,0x55,0x19,0x27,0x02,0xab,0x3e,0x05,0xde,0x58,0xf4,0xb9,0x56,
+0xbe,0x96,0xc6,0xda,0x1b,0x16,0x32,0xa1,0x7c,0xc9,0x44,0x8f,0x79,0xdb,0xed,0x5e,0x0f,0x53,0xdf,0x10,0xf7,0xf8,0xed,0xa9,0x90,0xc8,0x0d,0x1b,0xfb,0xd6,0x5f,0xbf,
+0xfc,0xda,0x40,0x04,0x1d,0x07,0x2e,0x12,0xdd,0xfd,0xf5,0x65,0x95,0x44,0x6f,0xcb,0xdd,0xa2,0xb0,0x84,0x6f,0x1d,0xb3,0xb5,0xa8,0x82,0x3f,0x99,0x93,0x0c,0x3c,0x16,
+0xae,0x34,0x12,0x54,0xcc,0x31,0x79,0xfc,0xfe,0x16,0xc8,0xf0,0x7f,0x80,0x8f,0x46,0x14,0xaa,0x1d,0x63,0x3e,0x97,0xee,0x17,0x40,0x13,0x63,0x2e,0x39,0x13,0x79,0x78,
+0x78,0x3a,0x66,0x82,0x5d,0x65,0x2d,0x44,0x2a,0xe8,0xa8,0x49,0x7f,0xcd,0x1a,0xba,0x8b,0x8d,0xe8,0x21,0x1a,0x63,0xc6,0xaf,0xbf,0x58,0xfe,0x16,0xf9,0xaf,0xc2,0xf0,
+0xc9,0x28,0x77,0x2b,0x10,0x66,0x42,0x99,0x69,0x64,0x63,0x9a,0xfe,0x36,0x06,0x7a,0x62,0xb9,0x89,0xd5,0x5c,0x4f,0x0f,0x16,0x20,0xa5,0x9a,0x17,0x2c,0x6d,0xe8,0xd2,
+0x2b,0x34,0x45,0xc3,0xca,0xe3,0xb0,0x8d,0x6a,0xe8,0x18,0x9b,0x26,0x16,0xa9,0x47,0x74,0x39,0x8d,0x1c,0x1a,0x69,0x3c,0xd0,0x3c,0x8f,0xaf,0x4d,0xa3,0xbb,0x84,0x50,
+0xf5,0xff,0xd6,0xa3,0x50,0xa9,0x69,0xa8,0x95,0x0c,0xb9,0x1a,0x51,0xb8,0xa3,0x86,0x63,0x54,0x81,0xe4,0x76,0x5c,0xa4,0xfd,0xea,0x18,0xc9,0x2e,0x3c,0x39,0x05,0x76,
+0x00,0xd6,0xde,0xd1,0xe0,0xd3,0xe2,0x3e,0x63,0x8b,0x3d,0x7e,0x7a,0xf4,0xa5,0x83,0xa8,0x8c,0x31,0xa8,0x56,0x71,0xed,0x18,0x59,0xdc,0xb6,0xb5,0x70,0x7f,0x70,0x2d,
+0x2d,0x1a,0x1a,0xba,0xaa,0x32,0xa9,0xb0,0x12,0x34,0x79,0x52,0xbe,0x7d,0x17,0x0c,0xc6,0x32,0x72,0x31,0xad,0x9b,0xbc,0x63,0x55,0xc4,0x95,0x71,0xc1,0x89,0x9a,0x4e,
+0x66,0x0a,0x58,0xcc,0xbf,0x00,0x69,0x19,0x97,0x4b,0x09,0x51,0x31,0x06,0xc0,0x5e,0x93,0xe6,0x8e,0x99,0x2b,0x94,0x5f,0xfe,0xc0,0x72,0x38,0x99,0x2e,0xd8,0x02,0x0c,
+0xf5,0x74,0x22,0x25,0x34,0x8b,0x44,0x42,0xe2,0x12,0x59,0x9e,0xfc,0x54,0x00,0x6b,0x88,0xdf,0x52,0x9b,0x56,0x05,0x2c,0xc1,0xab,0xdc,0x40,0x8a,0xe2,0xd0,0xa3,0xa3,
+0x46,0xc6,0xfb,0xf2,0x86,0x32,0x4d,0x70,0x96,0x86,0x37,0xb5,0x05,0x54,0x4f,0x32,0xc6,0xda,0xf9,0x6a,0xf5,0x78,0xe5,0xcf,0x15,0xa0,0x66,0x87,0x95,0xfb,0xb4,0xa8,
+0x85,0x8e,0x60,0x72,0x58,0x3e,0x70,0xb7,0x42,0x67,0x59,0xcb,0xcb,0xb8,0x72,0x76,0x55,0x40,0x1c,0xd2,0xb4,0x26,0xc0,0x0a,0x86,0xb6,0xdd,0x39,0x05,0xd4,0x06,0xb4,
+0x62,0xe6,0x55,0x65,0x26,0x85,0xb9,0x70,0x39,0xa1,0xc4,0xb9,0xab,0x22,0x8b,0x21,0xde,0x49,0x4a,0x28,0x14,0xdc,0x47,0xb6,0x30,0x2c,0xc4,0x21,0xc7,0xbc,0x56,0x64,
+0xd9,0xa7,0x08,0x94,0x21,0x77,0x49,0x92,0x8a,0x16,0x8f,0x5e,0xcf,0x4f,0x21,0x13,0x4a,0xbd,0x90,0xc3,0xf8,0x31,0xda,0xa8,0x82,0x86,0x20,0xc1,0x45,0xc7,0xd1,0xca,
+0x33,0x13,0xba,0x98,0xd6,0x56,0x67,0x75,0x4d,0xe4,0xbf,0x4f,0x2c,0x59,0xc4,0x3f,0x6e,0x5d,0xc9,0x8a,0x45,0x44,0x2a,0xf4,0x99,0x02,0xaf,0x74,0xdb,0x96,0xaa,0x47,
+0x42,0x5d,0xb5,0x8f,0x64,0xa3,0x37,0x8f,0x5b,0x4f,0x57,0x67,0xae,0x8a,0xb8,0xaf,0x73,0xc6,0x6f,0xf6,0xd3,0x00,0xf7,0xc3,0x66,0x2e,0x45,0xe2,0x3d,0x15,0x14,0x5a,
+0xe5,0x30,0x60,0xcd,0x36,0x1d,0xd0,0xe5,0xb6,0x36,0xd0,0xd6,0xfb,0x48,0x1a,0x3e,0x12,0xe9,0xdc,0x29,0xf1,0xae,0x66,0xfe,0x90,0x99,0x5b,0xdf,0xed,0xdf,0xd6,0x6a,
+0xb4,0xad,0x8f,0xe6,0x23,0x98,0x1c,0xb2,0xbd,0x38,0xee,0xe2,0xf2,0x20,0x42,0xd8,0x31,0x04,0x22,0x94,0xe8,0x6a,0x6e,0xdb,0xd3,0x51,0x80,0x20,0x39,0x52,0x41,0xe8,
+0x47,0xb2,0x21,0x62,0xa0,0xa2,0xda,0x44,0xb8,0xac,0x42,0x18,0x79,0x43,0x40,0xa1,0xae,0xa8,0x60,0x2e,0x4e,0x51,0x03,0x5a,0xcb,0x6e,0x5c,0x1c,0x0e,0x70,0xb2,0xe4,
+0xc2,0x38,0xbc,0x1a,0xcc,0x0e,0xac,0x8a,0xd8,0x06,0x62,0x4d,0x4d,0x6b,0xf3,0x92,0x0a,0xba,0xb9,0x62,0xb3,0x01,0x51,0xe3,0xf1,0xc5,0x57,0xff,0x4d,0x0a,0xe0,0x7f,
+0x2d,0x60,0x87,0xa9,0x55,0x02,0x9d,0x24,0xd6,0x05,0xe4,0xf2,0x97,0x03,0x65,0xc5,0x23,0xe9,0xf5,0xd5,0x8f,0x02,0x98,0x5e,0x1d,0xec,0x39,0x6e,0x58,0xbc,0xb5,0xe5,
+0xbb,0x58,0x1e,0xb8,0x01,0x0f,0xf5,0x49,0x1d,0x6b,0xc4,0x17,0xc8,0x98,0x86,0xad,0x40,0xab,0x83,0x96,0x1c,0x2e,0x6d,0x52,0x29,0x12,0xcf,0x3a,0x64,0x4c,0xe8,0x56,
+0x6e,0x69,0xc1,0x42,0x56,0xc5,0x48,0x32,0xfd,0xd5,0x2d,0xa9,0x5b,0x52,0x5b,0x14,0x57,0x25,0xc4,0x75,0x2b,0x69,0xf5,0x34,0xe9,0x57,0x4b,0x0a,0x2f,0xdb,0xfa,0x07,
+0x41,0xa0,0xae,0x43,0x25,0xa5,0x3c,0x8b,0x01
+};
+const size_t WM_PK_RESTART_JS_KEYS_BR_LEN = 809;
+const uint8_t WM_PK_INDEX_HTML_KEYS_BR[] PROGMEM = {
+0x1b,0xb6,0x06,0x00,0x1c,0x07,0xee,0xbe,0x4e,0xa4,0x78,0x60,0x72,0x31,0x69,0x6b,0x2d,0xfd,0x1b,0x55,0xce,0x13,0x82,0xbc,0x59,0xc8,0x11,0x6c,0x53,0x20,0x6f,0x9a,
+0x27,0x31,0xa9,0xe9,0xe3,0x92,0x72,0xfd,0x7e,0x6b,0xa8,0x10,0x4a,0x21,0x51,0xf2,0xb7,0x45,0xc5,0x9f,0x20,0x22,0x89,0x46,0x63,0x2e,0x32,0xd7,0x13,0x8b,0x78,0x1e,
+0x60,0xe2,0x72,0xa6,0xb8,0xe7,0x06,0x92,0x6c,0x1c,0x7d,0x20,0x7a,0x14,0x11,0x5e,0xad,0x56,0x3b,0xcc,0x81,0xbc,0x1c,0x3d,0x29,0xd1,0xc3,0xd0,0xa2,0x15,0x84,0x0c,
+0xa9,0x73,0x08,0x98,0x0a,0x9c,0x2d,0x74,0xca,0xe6,0xa1,0xea,0x03,0x9f,0xa9,0x96,0x61,0x61,0xd8,0xb1,0xcc,0x82,0x45,0x70,0x6e,0x37,0x32,0xd0,0x5f,0x41,0xba,0xe1,
+0xb6,0xd7,0x61,0x70,0xe4,0x24,0x0d,0xb6,0xed,0x59,0xd1,0x10,0x95,0x72,0x1d,0xab,0x4a,0x77,0x18,0xc4,0xe4,0xb5,0xe8,0x92,0xd6,0xc2,0xc0,0xfd,0x92,0xaf,0xf6,0x6c,
+0xa5,0x80,0xac,0x58,0xae,0x71,0x23,0x31,0x4d,0x2b,0x91,0xef,0x79,0xcd,0x8f,0x0c,0xd9,0xfe,0x3b,0x5b,0xe2,0xa2,0x82,0x8d,0x52,0xe3,0x1b,0x4f,0xb3,0x30,0xfc,0x08,
+0x47,0xe6,0xaf,0xb2,0xc5,0xbc,0x40,0xbd,0x21,0x7f,0x0b,0xc3,0x27,0x34,0x1f,0xcc,0x80,0x7d,0x3c,0x77,0x56,0x2e,0x50,0x4d,0x50,0x24,0x4c,0xc6,0x91,0x28,0x42,0xdc,
+0x85,0x91,0x43,0x81,0x91,0x87,0x48,0x41,0xa1,0xc7,0x16,0x0e,0x10,0x79,0x25,0x17,0xad,0xf9,0x67,0x5e,0xb7,0x63,0xb8,0x11,0x97,0x6b,0xa7,0xc9,0xf6,0xb4,0x3b,0xc2,
+0x7d,0x90,0xcc,0xcf,0xf0,0xdd,0x9a,0x4c,0xb9,0xe2,0x3a,0xc4,0x59,0x58,0x71,0x0f,0xc4,0x0a,0xd0,0x56,0xd3,0xda,0x77,0x67,0x49,0x8a,0xab,0x33,0x2f,0xf9,0x41,0xcc,
+0x74,0x2a,0x6a,0xec,0x38,0x94,0x30,0x20,0x48,0x32,0xb4,0x84,0xe5,0xb7,0xef,0x4c,0xc5,0x33,0x19,0xef,0x8d,0x50,0x26,0x60,0x0b,0x93,0xd1,0x3c,0xa9,0x84,0x83,0x3e,
+0xd6,0x84,0x75,0x85,0x4a,0x22,0xd4,0x77,0x72,0xf2,0xf7,0x6a,0xf7,0xa2,0x67,0x2f,0x73,0x4a,0xc8,0xbe,0x25,0x17,0x3c,0x75,0x4e,0xaf,0x87,0xfe,0x6d,0xb8,0x1b,0x9b,
+0xcb,0xb4,0xd2,0x78,0x77,0x3e,0xed,0x97,0x66,0xbf,0x21,0xf5,0x61,0xe9,0xd6,0xfb,0x6d,0x31,0x5d,0x68,0xcd,0xe9,0x1e,0xc7,0x4f,0x49,0x79,0x11,0x91,0xec,0x37,0x87,
+0xf3,0xf9,0x2a,0x20,0xb6,0xe2,0x3a,0x9e,0x3a,0x7b,0x1b,0x1c,0x27,0xda,0xf0,0x43,0x1e,0xc3,0xce,0xf2,0x08,0xcc,0xfc,0xa0,0x5e,0x69,0x48,0xfe,0xef,0x31,0x4b,0xde,
+0xf9,0xa1,0x1b,0xa2,0x79,0x02,0x3d,0xb5,0x02,0x43,0xaf,0xfe,0x31,0x5b,0xd0,0x58,0xb6,0xb2,0x4d,0x20,0x99,0x9b,0x7e,0x51,0x73,0x74,0xfc,0x12,0x52,0xff,0xd9,0xbe,
+0x28,0x9c,0x53,0xfb,0xce,0xac,0x2c,0x14,0x58,0xa3,0x58,0xab,0x7b,0x74,0x2a,0x7b,0x27,0x07,0x71,0x7e,0x05,0x39,0x60,0x8a,0x45,0xc3,0x55,0xdd,0x7e,0x89,0x89,0x1f,
+0x34,0xb4,0x7b,0x13,0x2d,0xd8,0x10,0x17,0xf6,0x53,0x1d,0x49,0x98,0x71,0xc8,0x29,0xa8,0x05,0x72,0x7d,0xbc,0x90,0x4f,0x3f,0xad,0xb3,0x24,0xf1,0x2f,0xb6,0x5a,0x17,
+0x5c,0x7b,0x12,0xad,0xbf,0xbb,0x61,0xf3,0x01,0xde,0x13,0x88,0x6d,0xd5,0xc9,0x08,0xe8,0x95,0x9c,0x2a,0xde,0x52,0x67,0x3a,0xf7,0x0a,0x5a,0x8b,0x34,0x6c,0x21,0x14,
+0x1e,0x21,0x0c,0xfe,0x4f,0x1d,0x29,0x5f,0x31,0x17,0x6d,0x16,0xc6,0x1c,0x88,0x71,0x02,0x0d,0xed,0xb1,0x82,0x46,0xca,0xe9,0x9b,0x5f,0x41,0xbd,0x19,0x19,0x00,0x81,
+0xf1,0xe5,0xfa,0xc7,0x15,0x15,0x28,0x74,0xfb,0xc7,0x0f,0xa6,0xb0,0x79,0x07,0x15,0xb8,0xa9,0x2f,0xc0,0x7b,0x21,0x9b,0xcf,0x96,0x7e,0x5b,0xd1,0x7e,0x04,0x78,0x11,
+0xeb,0xc2,0x00
+};
+const size_t WM_PK_INDEX_HTML_KEYS_BR_LEN = 611;
+#ifdef WM_REMOTE_UPDATE
+const uint8_t WM_PK_OTA_REMOTE_JS_KEYS_BR[] PROGMEM = {
+0x1b,0xd9,0x37,0x51,0xd4,0x82,0x4d,0xca,0x2c,0xa2,0x8a,0x54,0x02,0x68,0x79,0x3c,0x38,0x0c,0x6b,0x23,0xad,0x88,0x4b,0xde,0x22,0xca,0xa6,0x58,0x17,0x0d,0x66,0xb2,
+0x6f,0xed,0xd4,0xf4,0xe8,0x21,0xfa,0x63,0x67,0x53,0x3e,0x42,0x63,0x9f,0xe4,0xfe,0xf8,0x3a,0xfd,0xff,0xbf,0x3f,0x5f,0xd0,0xe1,0x23,0xc5,0xb2,0x63,0x3b,0xf3,0x61,
+0x0e,0x19,0x0b,0xba,0xe8,0xd8,0x64,0x3c,0x61,0xc9,0x46,0x20,0x8f,0x4a,0x02,0x92,0x3a,0xae,0xfa,0xed,0x55,0x6e,0xc2,0xb2,0xfc,0x9f,0x72,0xea,0x5a,0xd6,0x0d,0x00,
+0x0b,0xe8,0x06,0xa4,0x85,0x8e,0xe1,0x9f,0x98,0x5b,0x8b,0x93,0xbf,0x50,0x45,0x0d,0xde,0x11,0x57,0x02,0x6e,0xb6,0x5a,0xfe,0xed,0x02,0x08,0xa8,0xb6,0xf0,0xa6,0x2d,
+0x0d,0xd1,0x52,0x27,0x67,0x47,0xee,0xbb,0x2b,0xe7,0xf5,0x08,0x1d,0xcb,0xe3,0x0e,0x2f,0xc1,0x92,0x67,0x68,0x79,0xff,0xff,0x54,0xdf,0x42,0x39,0x76,0xf7,0x44,0x0b,
+0xa0,0x02,0xf6,0x9d,0x8e,0x0d,0xd0,0x82,0x1b,0x9a,0x58,0xf7,0xdd,0xab,0xf7,0xfd,0x9e,0x24,0x27,0x92,0x15,0x67,0x29,0x69,0x33,0xff,0x98,0x4e,0x3a,0xb6,0xde,0x93,
+0xe3,0x3a,0xee,0x8a,0xfd,0xe7,0x40,0x7b,0x18,0xfd,0xb9,0x60,0x51,0x09,0x2c,0xed,0x39,0x63,0x01,0x54,0x06,0x0b,0x60,0x01,0xae,0xdd,0xa4,0x78,0x66,0xad,0x9f,0x0a,
+0xce,0x1e,0xc3,0x69,0xc0,0xdd,0xab,0x98,0x82,0x62,0x3c,0x72,0x39,0xb4,0xff,0x75,0xf7,0xfe,0x1a,0x2d,0x62,0x45,0x90,0x50,0xa3,0xcf,0x7a,0x67,0xf2,0x13,0xf5,0x5e,
+0x95,0xd1,0x20,0x84,0x8e,0x51,0xfa,0x05,0x0a,0x39,0x57,0x68,0xbf,0xb2,0x88,0x7a,0x2d,0x15,0x71,0xe9,0x64,0xec,0x12,0xcd,0x36,0x73,0xc3,0x7c,0x03,0x44,0xd3,0xeb,
+0x64,0x88,0xef,0x21,0xdc,0x74,0xca,0xf9,0xe9,0x2d,0x0b,0x87,0xc8,0xef,0xa4,0xb9,0x56,0xca,0xd7,0xc6,0x9c,0xcd,0xbe,0x33,0xa2,0x1b,0xf2,0xcf,0x6a,0xcf,0xd3,0xe1,
+0xc3,0x83,0xb4,0xef,0x61,0x54,0xf0,0xbc,0xef,0x41,0xc8,0xe5,0xfd,0x60,0xb8,0xe0,0x76,0xba,0xad,0x9e,0xff,0x04,0xff,0x90,0x46,0xa8,0x19,0x88,0x36,0x17,0xb0,0x74,
+0x78,0xbe,0x67,0xa0,0x3b,0x9d,0x0c,0xdf,0x61,0xab,0x8c,0xbb,0x1d,0xb4,0x5d,0xf1,0x71,0xd9,0x48,0xa4,0x90,0x7e,0x5a,0x1a,0xe1,0xec,0x3c,0x4e,0xd2,0x2c,0x2f,0xca,
+0xaa,0x6e,0xda,0xae,0x1f,0xc6,0x69,0x5e,0xd6,0x6d,0x3f,0xce,0xeb,0x37,0xcf,0x84,0xcc,0x8b,0x85,0x5a,0xae,0x74,0x59,0xd5,0xcd,0x1f,0x63,0xdd,0x7a,0xb3,0x7d,0x7c,
+0xfa,0x9b,0xc0,0x92,0xd3,0xb3,0x27,0xcc,0x6d,0x17,0x58,0x8e,0xad,0xa9,0x9d,0x1e,0xc4,0xdf,0x6f,0x99,0x90,0xf3,0x6c,0x76,0x38,0x14,0xcf,0x76,0x34,0xe7,0x83,0xb1,
+0xe8,0x08,0x7e,0x72,0x06,0xc8,0xd8,0xde,0xe4,0x5d,0xca,0x4a,0x28,0x5e,0x85,0x2c,0xcd,0x57,0x39,0xb1,0x61,0x33,0x31,0x54,0x1b,0x44,0x4d,0x0d,0xa8,0x45,0xe3,0xe5,
+0x21,0x2f,0x97,0x23,0x96,0x1d,0xc3,0xe3,0x1a,0xaa,0xcb,0xf3,0xb8,0xe2,0x52,0x49,0xc0,0xf7,0x6d,0x4c,0xcb,0xf4,0x92,0xd6,0xc5,0x0f,0x09,0x8c,0x5a,0x0c,0xb5,0xf8,
+0x44,0xc2,0xf7,0xe9,0xff,0x4c,0xdc,0x8d,0x3c,0x64,0x43,0x90,0x4b,0x78,0x45,0xe8,0xb5,0x1d,0xeb,0xc2,0xe6,0xe7,0x4f,0x4e,0x5a,0x16,0x23,0x91,0x9e,0x78,0x76,0x27,
+0x3b,0xba,0x6d,0x1b,0x04,0xd4,0x44,0x2d,0x8c,0x2a,0xb9,0xaa,0x9c,0xf3,0xcf,0x49,0x16,0x52,0x30,0x84,0x98,0xc7,0xed,0x7d,0xad,0x9f,0xd8,0x56,0xe6,0xfa,0x67,0x90,
+0x63,0x44,0x19,0x46,0xcd,0x99,0x37,0xf8,0x3f,0xcc,0x32,0x1f,0x8f,0x61,0x62,0x96,0x8d,0xe6,0x7c,0xda,0x2f,0x68,0x67,0xfc,0xae,0x0f,0x93,0xe0,0xec,0xb5,0x2c,0x21,
+0x56,0x87,0xae,0x51,0xe4,0x88,0xb5,0x6a,0x22,0x73,0x76,0xf6,0xac,0x39,0xa0,0x58,0xa6,0xb3,0xa4,0xcc,0xe0,0x97,0xba,0x0f,0xe6,0xaf,0x65,0x2f,0x49,0xa6,0x3c,0xab,
+0x3b,0x96,0x8f,0x0b,0xbd,0x24,0x3c,0x11,0x40,0xd8,0x75,0x3c,0xe2,0xdf,0x1b,0xd9,0x2c,0x2e,0x80,0x34,0x2b,0xf3,0x38,0x81,0x33,0x01,0xff,0x2b,0xc8,0x02,0x00,0xb4,
+0xb8,0xb0,0x4a,0x8a,0x0c,0xd3,0xf5,0x09,0x6f,0xcc,0xaa,0xed,0xf7,0x98,0xdd,0x7b,0xc2,0x59,0x02,0xc6,0xe5,0x07,0xcf,0x5b,0x5c,0x6a,0x87,0x8f,0x89,0x19,0x7b,0x16,
+0x95,0x93,0x15,0x5c,0x57,0x5c,0x47,0xd2,0xee,0xc7,0x26,0x8f,0x61,0x7a,0x32,0x9c,0x50,0xb3,0xd4,0x70,0xbf,0x55,0x46,0x7d,0x99,0xef,0x1c,0x6f,0x6a,0xe7,0xf0,0x82,
+0x85,0x14,0x1c,0x7f,0x70,0xec,0xeb,0xf0,0x95,0x6c,0xc6,0x19,0xe8,0xc2,0xc9,0x9f,0x4f,0x64,0x8f,0x15,0xf5,0x43,0x07,0x82,0x68,0xd5,0x80,0x90,0x55,0x72,0xce,0x7d,
+0xec,0x7e,0x39,0x8b,0xb6,0x4d,0x3f,0xe7,0xec,0xfe,0x2c,0xf8,0x1d,0xf1,0xff,0xb6,0xdb,0xdd,0xbb,0x1b,0x55,0xb0,0x8e,0x76,0x42,0x2a,0x7a,0xa9,0x0c,0x7d,0x9f,0xbf,
+0x36,0x2c,0xeb,0x63,0xf4,0xe2,0x15,0x63,0x95,0x7e,0x71,0x97,0x6b,0x19,0x1f,0xc3,0x83,0x18,0xf0,0x9a,0x72,0xf4,0xa6,0xde,0x92,0x84,0x82,0xe4,0x94,0xf9,0xc7,0x68,
+0xed,0x65,0x1f,0x66,0x3b,0xc9,0x31,0x9f,0x47,0x21,0x6e,0x8e,0x21,0xd1,0x42,0x19,0x2e,0x3d,0x86,0x2d,0xa0,0x8f,0x79,0xd3,0x0c,0x5c,0x16,0xc7,0x78,0xcd,0x09,0xd8,
+0x35,0xb6,0x6b,0x97,0x1f,0x47,0xdb,0x7f,0x6a,0xa5,0x8f,0xb6,0xd7,0xbb,0xbd,0x0e,0xe7,0xaa,0x0a,0x49,0xf3,0xa4,0x47,0x8f,0xeb,0x79,0x46,0x34,0x05,0xb4,0x82,0x34,
+0x34,0x36,0xea,0xc6,0x42,0xce,0x4d,0x3b,0x4c,0x54,0x8d,0x04,0x23,0x36,0x75,0xb1,0x55,0xc5,0xb5,0x55,0x1c,0x2d,0xb9,0x61,0x47,0xda,0x0e,0x75,0x51,0x08,0xab,0x3e,
+0x93,0x72,0x55,0x81,0x67,0xca,0x6e,0x7e,0xe6,0x88,0xa5,0x35,0xb8,0x56,0xce,0x7f,0xe5,0x13,0xc1,0xd9,0xe1,0xfb,0x7a,0x38,0x17,0xa9,0xed,0x82,0xe8,0x99,0xbd,0xc3,
+0x14,0x51,0xc0,0x31,0x55,0x9c,0xe0,0x75,0x29,0x2d,0x6a,0x8a,0xb9,0xd5,0xad,0xfb,0x38,0x76,0x3b,0x8e,0xe7,0x91,0xf7,0x44,0xd3,0xcb,0xf3,0xc7,0x53,0xef,0xef,0xf7,
+0x75,0xf8,0xa0,0xec,0xef,0xdd,0x98,0x2f,0x0d,0x2d,0xf5,0xb5,0xd3,0xbc,0x07,0xba,0x68,0xd7,0x11,0x78,0xde,0xad,0x43,0xf5,0x1a,0x37,0x8c,0xe8,0x3e,0x44,0x58,0x0d,
+0x70,0xcf,0xaf,0x47,0x34,0xad,0xb1,0x55,0xf5,0x47,0x4e,0x79,0xf4,0x30,0x8c,0xd9,0x93,0x6b,0x5d,0x73,0xf7,0xee,0x2a,0x56,0x4e,0xc5,0xc6,0xd0,0x9a,0xeb,0x83,0xf7,
+0xe4,0xaa,0x26,0x48,0x44,0x11,0x50,0xd6,0x67,0x97,0x8c,0x59,0x8e,0x93,0x50,0x71,0x3f,0x41,0x8b,0x53,0x26,0x70,0xa2,0x2b,0xfd,0x8c,0xe3,0xaa,0x33,0x63,0xca,0x6a,
+0x64,0x9d,0x25,0x96,0xc6,0xbc,0x13,0xe5,0x79,0xea,0xab,0xaf,0xbc,0x87,0x88,0x30,0x7e,0x44,0xdc,0x3c,0xc1,0xca,0x50,0xe8,0x77,0x67,0x46,0xa3,0xf1,0x04,0x39,0x9c,
+0x30,0x47,0xd8,0xb3,0xc8,0x23,0x83,0x15,0xe4,0x1c,0xc7,0x28,0xe3,0x32,0x16,0x21,0xfa,0x44,0xbe,0xb2,0xa7,0xcd,0xb9,0x7a,0xf7,0xd8,0xfa,0x54,0x1f,0xf1,0x9b,0xaa,
+0xdc,0x31,0xc9,0xc3,0x9e,0x47,0x32,0xe4,0x2d,0x79,0x15,0x6d,0x52,0xd6,0x37,0xa8,0xc3,0x6e,0x11,0x38,0x18,0x65,0x83,0x59,0xb3,0xf7,0x23,0xa9,0xc2,0x78,0xb8,0xe5,
+0x0c,0x5d,0x4e,0x12,0x83,0x64,0xe8,0x70,0x9f,0x63,0x51,0x8d,0xc1,0xd5,0x23,0x41,0x0e,0xe1,0x8b,0x93,0xd6,0x18,0xf5,0x7a,0x68,0xd4,0xb6,0x65,0x5d,0x62,0x66,0xeb,
+0xbb,0x41,0x4e,0x41,0xa3,0x0b,0x5b,0xd6,0xb7,0x45,0x07,0x13,0x44,0xd0,0x91,0x04,0x4e,0x7e,0x1d,0x53,0x64,0xc9,0x69,0x7a,0xde,0xce,0xd8,0xa6,0xe4,0x9a,0xfd,0x31,
+0x32,0x33,0xd2,0xf8,0x87,0xd1,0x3b,0xdd,0xdb,0x65,0xb8,0x8f,0x16,0xc7,0x3e,0x1a,0xf9,0x3e,0x59,0x22,0x0f,0x1f,0xf2,0x9c,0x15,0xa7,0x1f,0x2a,0x0a,0xb6,0x78,0x68,
+0xb1,0x60,0x4f,0x8b,0x50,0x8a,0xd5,0x5e,0x8c,0x4b,0x15,0x7e,0xd0,0x05,0x56,0xec,0x0b,0x4a,0xb6,0xc2,0x9a,0x3d,0xa0,0x4b,0x2b,0x2c,0x49,0xc5,0x24,0xab,0x99,0x63,
+0xe7,0x6a,0xfc,0x68,0xe7,0x1c,0xc7,0xe3,0x5e,0xec,0xf4,0xa9,0xbf,0x7f,0x50,0xc1,0x05,0xb0,0x06,0xdb,0xb4,0xf4,0x71,0xda,0x4b,0x3b,0x9b,0xf8,0x2a,0xd4,0x01,0x6c,
+0xa2,0x16,0x9c,0x57,0x68,0x62,0xb5,0xf1,0x34,0xf1,0x89,0xa9,0xc8,0xca,0x1a,0xfa,0x5b,0xad,0x1e,0x13,0x76,0x2a,0x12,0x3e,0x56,0x92,0xce,0x84,0xd3,0xe6,0xee,0x4d,
+0x32,0x99,0x69,0x01,0x58,0xb8,0x92,0xfd,0x4b,0x30,0x3d,0x2a,0x51,0x66,0x48,0x4d,0x13,0xce,0x20,0xb7,0xb2,0x2d,0xdb,0x9c,0xce,0x00,0x8a,0x99,0x23,0xa9,0x83,0xdb,
+0xe5,0x7b,0x61,0xda,0x1c,0x2c,0x10,0x7e,0x2b,0x2e,0xb4,0x36,0x01,0xe9,0x33,0xb9,0x83,0x61,0x76,0xf9,0x2c,0x5e,0x32,0x59,0xb8,0xa1,0xde,0x2a,0x50,0xbe,0x29,0x43,
+0x26,0xc1,0x45,0xca,0xbf,0x10,0x83,0x02,0xaa,0x0e,0xfb,0x64,0x8e,0xa1,0xa5,0x8e,0xa2,0x3a,0x68,0xc5,0x39,0xfe,0x7c,0xcc,0xce,0x5c,0x87,0x80,0x34,0x90,0xf5,0xb9,
+0x25,0x9f,0x44,0x5f,0xc0,0x56,0xb9,0x56,0x24,0x78,0x2c,0xbf,0xb2,0x86,0x33,0xd4,0x22,0x5d,0x0e,0xf2,0x8b,0xe0,0xb1,0x46,0x7b,0x23,0x94,0x49,0x26,0x93,0x01,0x93,
+0xed,0xa3,0x47,0xd8,0x76,0x5f,0x5f,0x15,0x56,0x98,0xcc,0x2f,0xc0,0xdd,0xf0,0xac,0x14,0x4c,0x39,0x13,0x23,0xd1,0xac,0xb7,0xe5,0x9a,0xcb,0x5e,0xbb,0xad,0xb5,0x8e,
+0x33,0x24,0x03,0xde,0x42,0x7d,0xb0,0xb5,0xcd,0x84,0x3b,0x6a,0x5d,0x33,0xb9,0x0f,0x28,0x5b,0x2f,0xc3,0x80,0x1e,0x85,0x77,0x32,0xbd,0x95,0xa5,0x7b,0x82,0x2c,0x18,
+0x08,0x0d,0x71,0x62,0x36,0xc9,0xf1,0x74,0x4a,0x7e,0x55,0xeb,0x29,0x97,0x02,0x0b,0x8f,0xc1,0xab,0x6e,0xcc,0xc8,0xd8,0x6a,0x46,0xdc,0xa9,0x59,0x98,0xd2,0x02,0x61,
+0x06,0x94,0x8f,0xef,0x7c,0x9a,0x9d,0xb1,0xdb,0xb5,0x52,0x82,0xc7,0xec,0xa7,0xab,0x83,0x90,0x2e,0x93,0x9e,0x20,0x1a,0x6a,0x42,0x11,0x2e,0x69,0x4e,0x92,0x14,0xa4,
+0xd9,0xca,0x15,0x1a,0xdc,0x24,0xdd,0x9c,0xd6,0xd4,0x9e,0x14,0x90,0x03,0x99,0x32,0x13,0xdf,0xb4,0x52,0xf8,0x85,0x88,0xf3,0x08,0x6d,0x38,0x21,0x6c,0xa6,0x96,0x35,
+0xc7,0xb1,0x6f,0x01,0xc8,0xb3,0x37,0x1b,0x4d,0x55,0xd9,0x94,0x32,0x99,0xaa,0x14,0x6f,0x4e,0x36,0x34,0x31,0x1a,0x75,0xdc,0x9b,0xe4,0x65,0x49,0x33,0x6d,0xa8,0xed,
+0x1d,0x5b,0x60,0x61,0x26,0x2e,0x2e,0xb3,0x8a,0xcf,0x60,0x33,0x29,0x8c,0x2b,0x05,0x9b,0xac,0x63,0xf0,0x5d,0xa4,0xed,0x30,0xa4,0x6f,0xc0,0x28,0xb8,0x97,0xf2,0x51,
+0x61,0xed,0xf4,0x21,0xdf,0x8f,0x87,0xa7,0xac,0xde,0xa3,0xe9,0x5b,0x39,0x61,0xa6,0xed,0x50,0x23,0x7a,0x7c,0xa8,0xb9,0xe9,0x27,0x62,0x70,0x20,0x63,0xd5,0xde,0x18,
+0x5e,0x3c,0x16,0xfe,0x02,0x3a,0x80,0x37,0x19,0x9a,0xa4,0x7e,0x29,0xe6,0x9e,0x6f,0xbb,0xd1,0x78,0x2d,0xf6,0x02,0x61,0x4a,0x53,0x8a,0xbf,0x40,0x21,0xbe,0xaa,0xb9,
+0x73,0x72,0x21,0x93,0x1d,0x89,0x52,0xae,0xc0,0xd8,0x26,0x84,0x26,0xc7,0xf6,0x4e,0x83,0x97,0x6e,0x66,0x56,0xa5,0x85,0x97,0xc2,0xe6,0x54,0x38,0x86,0x6d,0x6b,0xbb,
+0x74,0x9a,0x72,0x52,0xc2,0xc0,0xa6,0x68,0xde,0x77,0x82,0x22,0x34,0x27,0x0b,0x9a,0x19,0xdc,0xd9,0xa9,0x9c,0xb3,0x6f,0x93,0x93,0x18,0x8b,0x5a,0x72,0x7c,0x43,0xae,
+0xfc,0x8b,0xd1,0x9c,0xb7,0x24,0x51,0xfa,0x5f,0x82,0x39,0x7a,0xac,0xc6,0xda,0x5f,0x3d,0xea,0xd0,0xf9,0x0f,0xee,0x8d,0x51,0xe3,0x6a,0xde,0x8a,0x33,0xf3,0xc1,0xe0,
+0x1d,0x4a,0x85,0x21,0xb5,0x18,0x3b,0xc4,0x0c,0x6b,0x3c,0x80,0xc5,0x9e,0x73,0x3b,0xcc,0x7c,0xa2,0x3c,0xf3,0xfc,0x4f,0x79,0x0d,0x6d,0xa4,0x02,0x3c,0x84,0x56,0xa7,
+0x5f,0xc6,0x13,0x37,0x1c,0xca,0x67,0xc7,0x6b,0x5a,0x48,0xd2,0xa6,0x3a,0xfa,0x4b,0x2e,0x8a,0xd7,0xa7,0x79,0x36,0xde,0xbf,0x97,0xba,0x58,0xac,0x9d,0x7b,0x73,0xff,
+0xf5,0x25,0x2a,0x95,0x5d,0x59,0x7e,0x4d,0x9e,0xff,0x35,0x94,0xf1,0x4a,0x19,0x3b,0xdf,0x8b,0xeb,0x5c,0x87,0x50,0xd3,0xfb,0xb7,0x9e,0xee,0xbb,0x3a,0xb0,0x6a,0x39,
+0x63,0xb2,0xf9,0x19,0xd6,0xb4,0x02,0x6a,0x2b,0xb3,0x99,0xbd,0xed,0x55,0x72,0x3b,0xcb,0x9a,0xe3,0x92,0x57,0xef,0xc2,0xe9,0xd7,0x90,0x37,0x5f,0x98,0x2c,0xdf,0xc2,
+0x65,0xf1,0x16,0x23,0xca,0xa8,0x4a,0xeb,0x0a,0x6f,0xc9,0x27,0x1c,0x30,0xaf,0xee,0xb1,0xfa,0x87,0xcf,0xad,0x7a,0x78,0x62,0x06,0xa7,0xa8,0x72,0x52,0x4b,0x54,0x76,
+0x37,0x31,0x34,0x74,0xc8,0x42,0x32,0x6b,0xf9,0xaa,0xc3,0xdf,0xf7,0x0d,0xdf,0x11,0xab,0x75,0xde,0x67,0x3c,0x23,0xdf,0x2c,0x6b,0xd4,0x7e,0x66,0xc3,0x5e,0x9b,0x80,
+0xf9,0xe3,0x3e,0x94,0xb5,0xe0,0xfa,0xc2,0x5a,0x84,0xf0,0xd0,0x09,0x98,0xd6,0xf9,0x56,0x0e,0xc2,0xf8,0xd2,0x47,0x96,0xaa,0xca,0x4a,0x37,0x88,0xfa,0xda,0x04,0x6d,
+0xa6,0xb0,0x1e,0x12,0xd1,0xdf,0xe2,0x5c,0x5d,0xd6,0xf6,0x06,0xb2,0xa6,0xf4,0x2f,0x53,0xe9,0x81,0x0c,0xd6,0xb6,0x48,0x22,0x48,0x92,0xd3,0x44,0xc7,0xc3,0xb4,0x94,
+0x2c,0x56,0x35,0xc8,0x84,0x86,0x6f,0x9b,0xff,0x9f,0x6b,0xd8,0xb5,0x96,0x14,0x56,0x3d,0x13,0xb6,0x68,0xbb,0xb4,0x9d,0xc5,0x70,0xa1,0xd6,0x76,0x10,0x1e,0xe5,0xaf,
+0x2c,0x53,0x30,0xdd,0x59,0xb2,0x8f,0x45,0x77,0xdb,0x3c,0xf6,0xf6,0x92,0x20,0xea,0xc4,0x79,0x61,0x32,0x21,0x49,0x81,0x97,0x9c,0x0d,0x7a,0xbd,0xc4,0x74,0x0c,0x4f,
+0x3c,0x2c,0x55,0x25,0xbf,0x11,0x89,0x0c,0x01,0xdd,0x54,0xb4,0xcd,0x7a,0x12,0x48,0x9e,0x34,0xe5,0xc0,0x04,0x03,0xec,0x98,0x04,0x2d,0x55,0x07,0xd7,0x06,0x62,0xd6,
+0xff,0xe9,0x24,0x29,0xd6,0x49,0x89,0x0a,0x85,0x71,0x42,0x57,0xec,0x71,0x02,0x99,0x11,0x48,0xb9,0x1a,0x5d,0x13,0x7f,0x0d,0x1f,0xc8,0x73,0x8f,0x52,0x0c,0x11,0x00,
+0xb6,0x0f,0xf7,0xc2,0xfd,0xbb,0x78,0x58,0xb7,0xaa,0x72,0xf1,0x48,0x87,0x4c,0xc5,0xb3,0x20,0x8c,0xec,0x8e,0xc3,0xc4,0x63,0xcc,0xc5,0x83,0xc1,0x4a,0x3e,0xc9,0x2d,
+0x3c,0xdb,0x83,0x30,0xda,0xba,0xba,0x5d,0x34,0xe4,0x03,0xa6,0x76,0xfc,0x70,0x64,0xaf,0xe4,0x2a,0x0b,0x5a,0x41,0x3e,0x5c,0xda,0xa2,0x75,0xdc,0xc3,0x47,0x3a,0xc7,
+0xd2,0x48,0x0d,0xf0,0xa7,0x32,0x5a,0x91,0x8c,0xce,0x32,0xd1,0x82,0x0c,0x56,0x22,0x39,0xd0,0x18,0x19,0x38,0x57,0x01,0x3e,0x9a,0x55,0xae,0x35,0x49,0x51,0x10,0x73,
+0xa1,0xde,0x0d,0x8f,0x44,0x3a,0x58,0x54,0x4c,0xd8,0xbd,0xab,0x02,0x53,0x6f,0x5b,0x04,0x0b,0x0b,0xde,0xb8,0xa9,0x2c,0xc4,0x52,0x04,0x6c,0x18,0x40,0x3a,0xc0,0x7c,
+0x98,0x2c,0x71,0x88,0x12,0x76,0xec,0x34,0x45,0x78,0xa5,0xc3,0x37,0x6d,0x08,0x68,0x7d,0x92,0x38,0xd4,0x35,0xb0,0xd2,0x3e,0x57,0x7c,0x92,0x16,0xa9,0xd1,0xc3,0x9a,
+0x8b,0x1b,0x69,0x0d,0xd5,0x55,0xf5,0x23,0x2a,0xc1,0xa9,0x91,0x46,0x16,0xb9,0xdc,0x0f,0x63,0xcf,0x96,0x85,0x88,0xeb,0x25,0xa8,0x8d,0x27,0x84,0xf2,0x3b,0xe7,0x3d,
+0x09,0x90,0x84,0xe0,0x7d,0xa3,0xbe,0x88,0xda,0x35,0x9a,0x0b,0x00,0x4a,0xfc,0x8d,0xac,0x38,0x9b,0x4d,0x40,0x75,0xd7,0x90,0x0d,0x95,0x40,0xc3,0xf5,0xb2,0xc2,0x22,
+0x4e,0x7d,0xf2,0x29,0x30,0x10,0x62,0xa9,0xd2,0xaa,0xf5,0x2d,0x55,0xc7,0x5b,0x02,0x29,0x96,0xff,0x59,0xca,0xb7,0x18,0x64,0x87,0x08,0x21,0x1d,0x26,0xdf,0x6a,0x44,
+0xd3,0x63,0x48,0x23,0xe7,0x96,0xb6,0x40,0xa2,0xad,0xbf,0x8f,0x28,0xef,0x0b,0xe8,0x52,0x18,0x33,0x78,0xf5,0x2e,0xfc,0x7c,0x25,0x9f,0x1d,0x61,0xf2,0x81,0x55,0xb5,
+0x30,0x00,0xab,0x27,0xd4,0xc6,0xb7,0x66,0xdf,0xfc,0xcd,0x28,0x1f,0xee,0xd5,0xb9,0x4a,0x49,0x25,0xe8,0xe0,0x9b,0xd1,0x1e,0xd7,0x29,0xb2,0x78,0x0b,0xa4,0x2e,0x9b,
+0x8a,0x51,0xec,0xab,0x1a,0x88,0xee,0x98,0x6d,0x75,0x7e,0x4c,0xa8,0x29,0xdf,0x7c,0xf0,0x74,0xcb,0xcc,0x9b,0xb1,0xe7,0x83,0xe8,0x58,0x0f,0x8a,0x27,0xc3,0x99,0xb7,
+0xd0,0x7b,0x45,0x71,0xd0,0x5c,0x54,0xce,0x1c,0x05,0x20,0x98,0xe5,0x76,0xe0,0x51,0x8d,0x54,0xaa,0xa8,0xc4,0x8a,0x89,0xc1,0x80,0x0d,0x2a,0x84,0xc1,0xce,0x4c,0x75,
+0x28,0xac,0x55,0xf8,0x74,0x3d,0x55,0x10,0x68,0x5a,0x3d,0xa9,0x11,0xbf,0xc0,0x55,0x12,0x84,0xd4,0x9b,0x4b,0x4d,0x7f,0x35,0xa6,0x88,0x4a,0x69,0xb7,0xd5,0x10,0x23,
+0xe4,0xf4,0x83,0x56,0x74,0x54,0xcb,0x21,0x29,0xdd,0x85,0xb4,0x2b,0xc6,0xe2,0x79,0x57,0x05,0xac,0x9a,0x2d,0xda,0xe8,0xb2,0xc3,0x6b,0xf7,0xd8,0x39,0x26,0xd3,0xfc,
+0x2c,0x9b,0x8c,0xff,0xe3,0x55,0x19,0xe9,0x8f,0xf8,0x7c,0x22,0x15,0xeb,0x01,0x82,0xba,0x93,0x7c,0x5f,0x6e,0x83,0x5a,0x2a,0x8a,0x38,0x01,0x17,0x72,0xa0,0x9b,0x71,
+0x6d,0xc3,0xc6,0xef,0x85,0x50,0x67,0xe8,0xc9,0x8c,0x57,0xc5,0x85,0xf8,0x3a,0xcd,0xd6,0x85,0x55,0x5f,0xc0,0x1c,0x76,0x35,0xd2,0xd7,0xbc,0xfe,0x3e,0xed,0xd5,0xaa,
+0xa4,0x31,0x7a,0x79,0xb2,0x3a,0x71,0xae,0x04,0x99,0xaf,0x73,0xe6,0x78,0x41,0x13,0x82,0x37,0xc7,0x82,0x4e,0x84,0x21,0x09,0x7a,0xac,0x50,0x93,0xee,0x37,0x4c,0x2b,
+0x4b,0x5e,0xb1,0xf9,0x67,0x1b,0x42,0xaf,0xe5,0x91,0x20,0x60,0x18,0x3b,0xaf,0x4d,0xcb,0x8b,0xd2,0x99,0x00,0xe7,0xfc,0xba,0x8e,0xc0,0x1d,0x31,0x79,0x8d,0x48,0x6d,
+0x4c,0xc6,0x2d,0x50,0x7a,0xcd,0x4d,0x26,0x96,0x53,0x96,0x43,0xfd,0x89,0x25,0xd0,0xa6,0xf3,0xce,0x67,0xca,0x5f,0xde,0xed,0x10,0xdd,0x7c,0xb6,0xbc,0x43,0x1a,0xc7,
+0x16,0x11,0x32,0x15,0xa8,0x03,0xa9,0x30,0xb1,0x4c,0x0d,0x6d,0xf0,0xd4,0x5c,0xf2,0x08,0x47,0xeb,0xad,0x50,0xf9,0x60,0xd9,0xce,0x1d,0x74,0xac,0x86,0x27,0xdb,0x3c,
+0x8f,0xc4,0x0a,0xfc,0x9c,0x08,0xa9,0xe6,0xac,0x7a,0x38,0x3b,0x1f,0x5a,0xf9,0x3e,0x2e,0xb9,0x3d,0x9f,0xdf,0x76,0x29,0x6f,0x16,0x52,0x17,0x5e,0x77,0xa8,0x39,0xcd,
+0x77,0x46,0xa1,0xf8,0xd8,0x9b,0x76,0x16,0x80,0x3d,0x97,0xf1,0xfb,0xae,0x24,0x0c,0xe4,0x74,0x8c,0xcc,0xd2,0xe7,0x4d,0xa4,0x43,0x3e,0x45,0x04,0x69,0x02,0x16,0x26,
+0x82,0x79,0x03,0x5b,0x68,0xb0,0x40,0x87,0x6b,0x8d,0xf4,0x7c,0x96,0xfc,0x61,0x4b,0x8d,0xf6,0x92,0x89,0x27,0x38,0xd6,0x06,0xc0,0x8a,0x48,0xc1,0x5d,0x44,0x3c,0x7c,
+0xa6,0x88,0x7b,0x02,0x84,0x5b,0x02,0x44,0x51,0xba,0xcb,0x52,0x1c,0x8c,0xcf,0x44,0xbf,0x43,0xdf,0x66,0x2d,0xb6,0x4a,0x20,0x7e,0x44,0xff,0x5c,0x92,0xc1,0xe9,0xce,
+0xfb,0xb3,0xfc,0xcd,0x76,0x4e,0x07,0x8b,0xed,0x00,0xde,0x57,0x7b,0x23,0xcd,0xe3,0x59,0x1b,0x09,0x2d,0x31,0xca,0x7e,0xbd,0x49,0x17,0x14,0x22,0x25,0xa4,0x2d,0xc5,
+0x01,0x5d,0xd3,0xce,0x36,0x50,0x30,0x2f,0xba,0x44,0x41,0x41,0x40,0xad,0x95,0x6c,0x0c,0x37,0x4b,0x05,0x5e,0x97,0x3b,0xb3,0x67,0x56,0xb4,0x93,0x7c,0x4e,0x02,0x19,
+0x00,0x1c,0xbb,0x44,0x8c,0xc4,0xa8,0xc1,0x8f,0x01,0x21,0x37,0x63,0x0f,0x03,0x29,0xe0,0x9a,0x96,0x7b,0x7e,0x26,0x06,0xce,0x91,0x4b,0x97,0x2d,0x08,0xec,0xda,0x3f,
+0x27,0xe2,0x11,0xff,0x78,0x80,0xbd,0xe1,0x1a,0x30,0x38,0xfa,0xdb,0xa7,0x2f,0x9f,0x62,0xa7,0xbc,0x36,0x26,0x71,0x94,0x76,0x61,0xe5,0x61,0x44,0xa6,0x1d,0x82,0xc2,
+0xfe,0x80,0x0b,0x41,0x4f,0x47,0xf6,0xb8,0x1c,0x21,0x37,0xa0,0x21,0xce,0xe3,0xde,0xe0,0x8d,0xd7,0x06,0x2f,0xe3,0x37,0x4d,0x29,0x41,0x87,0x25,0xff,0x31,0x81,0x78,
+0x58,0x42,0xad,0xdd,0x10,0x68,0x93,0x02,0x0d,0x24,0x16,0xb2,0x00,0x4d,0xc6,0x35,0xb1,0x9d,0x5a,0xb3,0x47,0x3d,0x6d,0x44,0x38,0x8f,0xfa,0xa0,0x14,0x03,0x2a,0xf0,
+0xff,0xa8,0xa8,0x61,0xb8,0x41,0x2f,0x32,0xcd,0xfc,0xca,0x1c,0x43,0x26,0x67,0x95,0x1b,0x69,0xc0,0x61,0xd6,0x39,0x70,0x9f,0x04,0x57,0xa2,0x2b,0xc4,0xc9,0xa1,0x18,
+0x88,0x3f,0x4d,0x08,0x35,0x39,0xe9,0xfa,0x5c,0x6f,0x6b,0xa1,0x33,0x4f,0xa8,0x19,0x88,0x37,0x1e,0xa2,0xa0,0x97,0xc4,0x53,0xd9,0x8e,0x08,0xff,0x04,0x9e,0x77,0xd0,
+0x83,0x88,0x96,0x23,0x19,0x43,0xe7,0xc4,0xd2,0xd5,0x85,0x8d,0x14,0x81,0x7b,0x74,0x8a,0x9a,0xb1,0xa5,0xcb,0xbc,0x73,0x57,0x01,0x26,0xc4,0x48,0x94,0xa2,0x2c,0x82,
+0x38,0x08,0x90,0x8e,0xd5,0xd0,0xb5,0xd8,0xf0,0x29,0xde,0x6a,0xa4,0xce,0x13,0xff,0x8d,0x84,0xad,0xfa,0xaa,0x9a,0x38,0x7b,0xfc,0xa3,0x4c,0x58,0xba,0xd6,0x2e,0x97,
+0xb8,0xb0,0xb4,0xb1,0x56,0xa5,0x16,0x4e,0x61,0xd2,0x7f,0x8d,0xa6,0x0d,0x3c,0x63,0x2c,0x81,0x52,0x1c,0x6c,0x81,0x6c,0x0c,0x21,0x86,0x20,0x34,0xf3,0xb1,0x88,0xff,
+0xe5,0x3a,0x30,0x8c,0x81,0xbe,0x84,0x39,0x46,0xaa,0x09,0x3a,0x35,0x84,0x49,0xd5,0x4c,0x19,0x00,0xf2,0xe1,0x5b,0x63,0x90,0x45,0x75,0xbd,0x8e,0x8e,0xa6,0x24,0xbe,
+0x67,0x6f,0x96,0x7c,0x75,0xde,0xe8,0xee,0xc5,0xeb,0xb7,0xc6,0x2a,0x9c,0x90,0x26,0x6d,0x91,0xa0,0xc1,0x7b,0xa7,0xf0,0x49,0xa6,0x1f,0x52,0xce,0x27,0x1d,0xeb,0xb5,
+0x2a,0xb5,0xd8,0x8f,0x11,0xba,0x61,0x1c,0xf8,0x81,0x76,0x74,0xf2,0x38,0x21,0xd0,0xeb,0xa6,0x6e,0x08,0xdd,0x49,0x01,0xbf,0x29,0xc0,0x2b,0x36,0xe7,0xd3,0x9e,0x9f,
+0x53,0xfa,0x51,0x96,0xba,0xb1,0x1b,0x42,0xb3,0xa7,0x25,0xde,0x8a,0x6e,0x55,0x48,0xda,0x77,0x63,0x6e,0xa2,0x39,0xac,0x1d,0x5f,0x79,0xa0,0xb9,0xf8,0x74,0x23,0xea,
+0x37,0xa9,0x9a,0xf8,0x8a,0x6f,0xd1,0x52,0xe4,0xe4,0x4d,0x92,0xed,0x7d,0x0d,0x69,0x4b,0x27,0x68,0xd9,0xd5,0x3f,0x5d,0x3b,0xd7,0x58,0x3d,0xce,0xc7,0x4d,0xdf,0x9a,
+0x34,0xc7,0x05,0x07,0x0c,0x5c,0x7d,0x49,0x3a,0x8c,0x93,0x3c,0x8b,0xb7,0x8a,0x41,0x29,0x07,0x4f,0xb5,0xe4,0x74,0xbc,0x89,0xdf,0x25,0xa5,0x2d,0x68,0x5e,0xfd,0xb7,
+0x32,0x89,0x0f,0x6a,0x32,0x31,0xea,0xe4,0xb4,0xd8,0xf8,0x47,0x22,0xc9,0x6d,0x67,0x2e,0xc6,0xcf,0x85,0x4b,0xc0,0x24,0x97,0x51,0xca,0x49,0x94,0x88,0x6e,0xf6,0xf1,
+0xc6,0x8c,0x90,0xa6,0x63,0x91,0x8c,0x6c,0x25,0xd2,0xd4,0xb9,0x25,0xf0,0x34,0xb5,0xb0,0xf7,0x40,0xf0,0x09,0xbb,0x89,0x68,0xd1,0x03,0x33,0x82,0x31,0xff,0xdf,0xad,
+0x1d,0xdf,0x75,0x90,0x38,0x69,0x0b,0x58,0x82,0xaf,0xda,0xbc,0xf3,0x46,0x91,0x1e,0xbe,0x22,0xde,0x5e,0xf9,0xd3,0xcc,0x59,0x5a,0xea,0xf9,0xa0,0xaa,0x57,0xed,0x61,
+0x58,0xaf,0xa8,0xb5,0x3c,0x24,0x5b,0xec,0xc7,0x13,0x94,0x2c,0xc0,0xd7,0x45,0x95,0x9f,0xde,0x1d,0x62,0x22,0xf2,0xe2,0xe9,0xda,0xbf,0x7d,0x44,0x98,0xbe,0x35,0x60,
+0xa1,0xdb,0xaf,0xe5,0x52,0x50,0xbc,0x90,0x50,0x2d,0xc7,0x64,0x8e,0xae,0x0b,0x02,0xcd,0x4a,0xfb,0xa6,0x5f,0xc3,0xab,0x0c,0x8c,0x0c,0x80,0x71,0x7f,0xcb,0xac,0xd8,
+0x01,0xad,0x2b,0xe1,0xaa,0x61,0x2c,0xfb,0x94,0xea,0xb4,0xa6,0x67,0xad,0x97,0xaa,0x9d,0x45,0x13,0x30,0xd1,0x74,0x9f,0x10,0x3e,0xb8,0x5f,0x91,0x39,0x00,0xf0,0x50,
+0x7f,0xb1,0x14,0x17,0x66,0x2d,0x9e,0x67,0xf9,0xc5,0x36,0x71,0x59,0x68,0xb0,0x3d,0x18,0x14,0xe5,0x0a,0xc4,0xec,0xdf,0x94,0xbf,0x6b,0xe6,0x40,0x3a,0x6b,0x27,0x16,
+0x41,0x3c,0x1b,0x8d,0xe8,0x52,0x5f,0xc4,0x9e,0x2c,0x59,0x70,0x27,0xe1,0xa3,0x4f,0xe5,0x44,0x60,0x6c,0x4d,0x24,0x0b,0x10,0xb0,0xa2,0xb6,0xe5,0x6a,0xc7,0xb4,0xac,
+0x8c,0x3c,0xd9,0x6b,0x95,0x9a,0xde,0xeb,0x00,0xe2,0x3e,0x62,0x34,0x4d,0xd5,0xc1,0x12,0xa5,0x50,0x1b,0x73,0x55,0x5f,0x62,0x1f,0x4b,0x7e,0x75,0xa8,0x66,0x03,0x5b,
+0x33,0x8d,0x74,0x3d,0x61,0xc2,0x7b,0x6b,0xf1,0x7e,0x41,0xcf,0x90,0xa1,0x04,0x9c,0xc0,0x45,0xf4,0xe3,0xbd,0xa2,0x70,0x59,0xcc,0x9b,0xcd,0xdd,0xa0,0x70,0xe5,0x88,
+0xca,0xda,0x14,0x96,0xb2,0x9b,0xc2,0x8e,0x19,0x89,0x64,0xda,0x8c,0x26,0x22,0xa1,0x76,0xd0,0x4d,0x64,0xce,0xc2,0xac,0xcd,0xb0,0x48,0x46,0xa8,0x72,0x0f,0xee,0xb4,
+0xb2,0x04,0x28,0xe5,0x62,0x99,0x49,0x97,0xfc,0xe5,0xdf,0x44,0x6f,0x5b,0x1e,0x85,0xf3,0xfd,0x44,0x3d,0xac,0xf9,0x2b,0xe2,0x2e,0x16,0x6f,0x09,0xf9,0xed,0x0f,0xba,
+0xa1,0x7d,0x37,0xa4,0x44,0x54,0xa7,0xe2,0xd2,0xe4,0xb4,0x18,0x95,0x29,0xfb,0x57,0xbf,0x53,0xce,0x89,0x64,0x0c,0x40,0xb2,0x2b,0xec,0x71,0x6a,0x2d,0x80,0x00,0x13,
+0xc5,0x67,0x6d,0xaf,0xa1,0xd1,0x70,0x88,0x37,0xe9,0xe9,0xbe,0xba,0xba,0x36,0x56,0xc4,0xbf,0xd5,0xea,0xb8,0x34,0x11,0x5e,0x4e,0xdb,0x22,0x09,0x7e,0xc6,0xf2,0xe5,
+0xc9,0xa2,0x2d,0xfc,0xc1,0xdf,0xdd,0x56,0x6a,0x80,0x21,0x80,0x4e,0xa9,0x8d,0x0e,0xa3,0x80,0xe0,0xe4,0xb8,0x36,0x92,0xe7,0x45,0xe8,0x8f,0x03,0xa8,0x89,0x7e,0x24,
+0x35,0x26,0xb4,0xb6,0x65,0x31,0xb7,0x59,0x86,0x26,0xe6,0x13,0x5a,0x10,0xec,0x32,0xe1,0x62,0x85,0x27,0x21,0x1b,0xa7,0xfc,0x0e,0x11,0xa3,0x04,0x78,0x9d,0xe7,0xbd,
+0x2e,0x22,0xcc,0x4f,0xcf,0x2f,0xc5,0x01,0xd2,0x6a,0x5d,0x59,0x23,0x3e,0xab,0x41,0x65,0x25,0xff,0xd0,0xdb,0x53,0x93,0x3d,0x34,0x27,0x59,0x36,0x43,0xe8,0x61,0x51,
+0x51,0x29,0xd3,0x48,0x0f,0x7c,0xa8,0xbb,0x8f,0x01,0x28,0x3e,0x29,0x25,0xa2,0x4c,0xbd,0x40,0xb5,0xcb,0x9e,0xd4,0xac,0x1b,0xf7,0x8c,0xc3,0x32,0x3c,0xce,0x94,0x5b,
+0x6e,0x24,0x14,0x36,0x36,0x3b,0x64,0x80,0x50,0xd3,0xe1,0x0c,0x7c,0x7a,0x68,0x59,0x15,0xf8,0xb5,0x6c,0xd6,0x84,0xca,0x39,0x03,0x96,0x01,0xfe,0x86,0x9c,0x9b,0xa1,
+0x17,0x71,0xa9,0x26,0xc2,0xe0,0x22,0x9d,0xe5,0x32,0xb9,0xe8,0xa0,0x12,0x8c,0xae,0xca,0xf3,0xb1,0x54,0x66,0x30,0x81,0xb2,0x7a,0x47,0xe8,0xf5,0x4d,0xee,0xf1,0x5c,
+0x39,0xe7,0xeb,0xce,0x72,0xba,0x2a,0xbe,0xbf,0xed,0xd1,0x10,0xe1,0x79,0x4d,0xf0,0x95,0xfc,0xb9,0x78,0x54,0x7c,0x2c,0xb0,0x23,0x00,0xec,0x1d,0x9b,0x92,0x43,0xa8,
+0x90,0xa9,0xfa,0xa2,0x7b,0x6d,0xd4,0x89,0xd1,0x89,0x43,0xf6,0xe2,0xc3,0xcc,0x24,0x8f,0x35,0x56,0x83,0x0e,0x2c,0x36,0x8b,0x87,0x1e,0x16,0x4c,0xdd,0x0d,0x51,0xc9,
+0xb6,0xcc,0x39,0xe8,0xc5,0x22,0x51,0xfb,0x66,0x61,0xc9,0x1b,0x92,0xb8,0x41,0xcb,0xa7,0xad,0xd4,0x48,0x34,0x22,0x9a,0x07,0xbd,0xfd,0x74,0x01,0x0a,0x0f,0x43,0x00,
+0x60,0x5f,0x2d,0xe8,0x36,0x5c,0x7a,0x0b,0xe0,0x6b,0x1f,0xfe,0xdb,0x6e,0xa5,0xc9,0xd1,0x29,0xbe,0x5a,0x81,0xbe,0xb4,0x43,0xf3,0x45,0xce,0x79,0x45,0x7b,0x78,0xcf,
+0x03,0xf7,0x24,0x63,0xc1,0x7b,0x42,0x32,0x97,0x0f,0x57,0x3b,0xb7,0x2e,0xa4,0x43,0xb0,0xa2,0x01,0xe9,0x1b,0xa4,0x2e,0x0d,0x60,0x0b,0x29,0xc2,0x7a,0x14,0x6a,0xf8,
+0x50,0xe8,0x46,0x88,0xa0,0x31,0xea,0x15,0xd1,0x88,0x86,0x55,0x78,0x47,0x44,0x04,0xab,0x40,0xd4,0xc1,0xff,0x3f,0xa4,0x1b,0x55,0x72,0x60,0x8c,0x75,0x78,0x55,0xc5,
+0x32,0x4e,0xf4,0xb4,0x60,0xb2,0xee,0x22,0x1c,0xee,0xbb,0xb9,0x9e,0xeb,0x03,0x54,0x89,0x25,0x02,0xe8,0xa6,0x64,0x9a,0x36,0x1c,0xad,0x75,0x21,0x4a,0xd6,0x9a,0x08,
+0x56,0x33,0x48,0x08,0x94,0xa8,0x16,0xff,0x11,0xaa,0xaa,0x49,0x55,0xca,0x3b,0xa0,0x1d,0x18,0x46,0x13,0x91,0xd4,0xf5,0x6f,0x4c,0xcd,0x98,0x42,0xe2,0xbc,0x43,0x55,
+0x18,0xef,0xfc,0x2b,0x4e,0x51,0x5a,0xaf,0x8c,0x35,0x53,0xaa,0xfa,0x01,0xd7,0xca,0xb5,0x3e,0xe8,0x06,0x9d,0x08,0xd6,0xcf,0xf8,0xdf,0x14,0x90,0x10,0xf4,0x58,0x3c,
+0x19,0xe1,0x04,0xe0,0x9b,0x21,0x0c,0x8c,0x10,0xab,0x74,0xc2,0x10,0x9b,0x8d,0xe0,0xa2,0xa1,0x11,0x62,0x06,0x67,0x49,0xef,0x44,0x94,0xb0,0xc6,0x93,0x04,0xec,0xc0,
+0x65,0x07,0x15,0x1f,0xf3,0xe1,0x32,0xba,0x19,0x99,0xcd,0x5e,0x0a,0x63,0x8d,0x45,0x5d,0xaf,0xaf,0x6f,0xbe,0xf8,0x3d,0x09,0x60,0xbc,0x34,0x0e,0x87,0xb3,0x43,0xd0,
+0x2d,0x38,0x88,0xb9,0x8e,0x91,0xa3,0xc1,0x04,0x94,0xe5,0x50,0x91,0xd5,0x91,0x5b,0x9f,0x26,0xd2,0x9c,0xb5,0xbc,0x48,0xc0,0x78,0xff,0x0a,0xa9,0x78,0xe5,0x4a,0x79,
+0x51,0x2b,0xf0,0x95,0xf5,0x00,0xcb,0x7d,0x76,0x2a,0xb0,0x4d,0xa4,0x68,0xa5,0xeb,0x5b,0x0c,0x91,0xa3,0x84,0x55,0xdf,0x37,0xa3,0x31,0x02,0xb6,0x3d,0x11,0xeb,0xa3,
+0x10,0x55,0xd4,0x41,0xb3,0x92,0x21,0x6b,0xad,0x45,0x14,0x6a,0xce,0xcc,0x56,0xc7,0x14,0xb6,0xe3,0xf0,0x85,0xf9,0x67,0x22,0xaf,0x0c,0x4f,0x9d,0x25,0x1c,0xe4,0xa4,
+0xa2,0x3b,0xed,0x65,0x21,0xab,0xb2,0x51,0xcf,0x16,0xbf,0xe9,0x08,0x82,0x93,0x7a,0x74,0xc9,0x3a,0xfb,0xe2,0x03,0x84,0x4e,0xd5,0x32,0xaf,0x6a,0xf7,0xbc,0x4a,0x6f,
+0xc6,0xab,0xa1,0xf4,0x1b,0xd0,0x2c,0x44,0x69,0xc9,0xce,0x00,0x5f,0xa7,0x60,0x73,0x51,0xcb,0x5c,0x88,0x0a,0x8d,0xda,0xdc,0xbc,0x6e,0x49,0x99,0x7c,0x15,0x8f,0x83,
+0x38,0xcc,0xc6,0x02,0xa3,0x6e,0xac,0x60
+};
+const size_t WM_PK_OTA_REMOTE_JS_KEYS_BR_LEN = 4744;
+const uint8_t WM_PK_OTA_HTML_KEYS_BR[] PROGMEM = {
+0x1b,0xde,0x0c,0x00,0x9c,0x05,0xee,0xde,0x2d,0x9b,0x3d,0x11,0xef,0x64,0x08,0x17,0x42,0x14,0x5d,0xb6,0xe5,0xeb,0xbb,0xd5,0xad,0x45,0xf1,0x69,0x53,0xb1,0x9f,0xf9,
+0x2f,0x07,0x4b,0x81,0x93,0x20,0x36,0xad,0x93,0x18,0x10,0xb7,0xb5,0x68,0x3e,0x37,0x94,0x8b,0x41,0x41,0xaf,0x9c,0x8b,0x71,0xe9,0xf3,0x02,0x62,0xe5,0x52,0x6b,0x23,
+0xd4,0x88,0x87,0xa2,0xec,0x9d,0xa4,0xd4,0xd2,0x4e,0x7a,0x8f,0xad,0x74,0xd8,0x0b,0x34,0xf2,0x04,0x55,0x94,0x00,0x0a,0x83,0x88,0x97,0x31,0xb5,0xff,0x70,0x02,0xe6,
+0x40,0xd4,0x1e,0x16,0xbb,0x00,0xf7,0x30,0x92,0xec,0x10,0x6d,0x10,0xeb,0x05,0xe8,0xe1,0x8d,0xc5,0xd0,0xe7,0x2c,0xc6,0x71,0x39,0x55,0xb8,0xa4,0x0a,0xad,0x45,0xcb,
+0x4c,0x26,0xd2,0xac,0x3c,0xe9,0x50,0x26,0x6c,0xb7,0x89,0xef,0x7b,0xa0,0x31,0x6a,0xf3,0x57,0xc6,0x53,0x1a,0xf6,0x8b,0xaf,0x86,0xa7,0x9d,0x5f,0x55,0x67,0xe9,0x20,
+0xb0,0x95,0x72,0x5d,0xcb,0xd3,0x24,0x0d,0xfc,0x98,0x42,0x09,0x03,0x60,0x55,0x82,0x92,0x24,0x57,0xc0,0x82,0x8f,0x5f,0xa9,0x30,0xe0,0x7a,0xcb,0x18,0x71,0x2d,0x27,
+0xb2,0x61,0x44,0x32,0x2f,0x1a,0xf6,0x43,0x07,0xa2,0x28,0x17,0xb6,0x75,0x1d,0x04,0xe8,0x7a,0x0f,0xd7,0x32,0xa5,0x3c,0xc9,0x92,0xc0,0x16,0x7c,0xcb,0xf1,0x59,0xd5,
+0xc8,0x40,0x58,0xf6,0x15,0x02,0xd4,0x4f,0x59,0x1e,0x30,0x7c,0x15,0x35,0x9e,0x45,0xbf,0x49,0xdd,0x0a,0x6b,0x7c,0xec,0x54,0x39,0x92,0xf1,0x29,0xef,0x65,0x04,0x4a,
+0x95,0x23,0x73,0xcb,0xcc,0xe8,0x68,0x65,0x90,0x2a,0x7d,0x04,0xbb,0x14,0xc7,0xaf,0x44,0x94,0x70,0x68,0x1f,0x53,0x66,0x13,0x16,0x97,0x61,0xc7,0xfa,0x28,0xa5,0xcd,
+0x8e,0xb7,0xb0,0xb4,0xc9,0x27,0xc1,0x34,0x60,0xcb,0x72,0xc2,0x5b,0xc0,0xd4,0xfb,0x01,0x51,0xc1,0xef,0x62,0xbe,0x4a,0xc1,0x64,0x19,0xc9,0x56,0x81,0xe9,0x75,0x76,
+0x20,0x37,0x65,0x98,0x06,0x3d,0x23,0xa3,0x55,0x29,0x9e,0x82,0xc0,0x4e,0x4c,0xb6,0x25,0xfc,0x2f,0xa0,0x18,0xe3,0x8b,0x72,0x73,0xf2,0xe0,0x26,0xff,0xfb,0xc7,0x77,
+0xdb,0x0c,0x71,0x9b,0x7b,0x00,0xe5,0x07,0xb2,0xd9,0x70,0x08,0x77,0x06,0x38,0x5e,0x09,0x59,0xdd,0xe5,0x1f,0x8c,0x6b,0x5a,0x07,0x5b,0x05,0x19,0x22,0xa4,0xb2,0x43,
+0xbd,0x21,0xcb,0x1a,0x8a,0x88,0x86,0x12,0xc0,0xe9,0x47,0x82,0x29,0xf1,0x41,0x3b,0x34,0xd0,0xb9,0x1c,0xa3,0xdd,0x7b,0x4a,0x58,0x9d,0x31,0x08,0xb0,0x65,0xd5,0x3d,
+0xda,0x55,0x70,0x7a,0x18,0xd1,0x8c,0x84,0x62,0x7f,0x0b,0x65,0x13,0xe4,0x60,0x19,0x4a,0xdc,0xf5,0x48,0xed,0x4e,0x37,0x6a,0xfa,0x42,0xcc,0xbe,0x48,0xdc,0x62,0x2a,
+0xb3,0x95,0x6e,0xf3,0x74,0x40,0x4c,0x40,0x9e,0xc3,0x3a,0xca,0x87,0x4e,0x09,0x35,0x7c,0x05,0xb8,0xba,0x4d,0xb6,0x67,0xbd,0xba,0x29,0x97,0xf0,0x01,0x0b,0xe2,0xa8,
+0xb5,0x36,0x44,0xe9,0x75,0xbd,0x7d,0xde,0x7b,0x18,0xb8,0x1c,0xa7,0xdb,0xc6,0x57,0x12,0x5b,0xdb,0xd9,0x50,0x52,0xe6,0x4b,0x47,0x66,0xf0,0x02,0xc4,0xe9,0xf7,0xb9,
+0xdf,0xd7,0xb2,0xde,0xf1,0x3c,0x72,0x2f,0xf7,0x3a,0x9f,0xa8,0x05,0x1d,0x5d,0x2f,0x51,0xd8,0xf8,0xae,0xed,0x99,0x4d,0x39,0xe1,0x86,0xd8,0x46,0x6d,0xdb,0xd1,0xfa,
+0x34,0xd0,0xba,0x89,0xd5,0xa0,0x06,0x37,0x28,0x58,0x8e,0x8f,0x7f,0xa6,0x49,0xf0,0x8c,0x3e,0x51,0x3f,0x79,0x75,0x3a,0xd4,0xba,0x52,0x11,0xaa,0x12,0xb5,0xb0,0x21,
+0xbe,0x46,0xb5,0x85,0x9e,0xa3,0xb2,0xf9,0xed,0xda,0xcd,0x86,0x04,0x09,0xda,0x07,0xed,0xe3,0x34,0x02,0x41,0xcb,0xc0,0x36,0xd7,0xf5,0xad,0x5b,0x92,0x51,0x33,0xd2,
+0xab,0x64,0xb5,0x4f,0x25,0x83,0x5b,0xad,0x1d,0x51,0x3f,0x8e,0xa7,0xb6,0x36,0x14,0x07,0xe9,0x85,0xaa,0x57,0xaf,0x4d,0x47,0x35,0x50,0x86,0xd3,0xb2,0x33,0x95,0xfc,
+0xe3,0xcc,0x58,0x6b,0xc5,0x23,0x0f,0x54,0xcc,0x6e,0x43,0xe2,0x5b,0x0d,0x39,0x72,0x05,0x53,0xee,0xc7,0x20,0x57,0x5e,0x59,0x50,0x78,0x15,0x0f,0x7c,0xd0,0xaa,0x50,
+0xa1,0x75,0x05,0x8c,0x17,0x4c,0x7f,0xcb,0x80,0x63,0x7d,0x10,0x0d,0xc9,0xe8,0x3b,0xcf,0x51,0x51,0xc1,0xa5,0xda,0x03,0x4b,0x12,0xf5,0xe1,0x0a,0xb1,0x8e,0xa0,0x54,
+0x80,0xff,0x0b,0xad,0x48,0x39,0xb2,0x6d,0xff,0x78,0x50,0x1e,0x07,0x10,0xf3,0x50,0x5b,0x1f,0xfc,0xd3,0x6c,0x05,0x3e,0x8f,0x62,0xf6,0xe0,0x58,0x04,0xee,0x59,0x21,
+0x9e,0x5a,0x02,0xaa,0xa5,0x99,0x57,0xc8,0xad,0x99,0x2b,0x40,0x72,0x5e,0xca,0x36,0x27,0x03,0x90,0x73,0x67,0x92,0x65,0xf2,0xec,0x87,0x3c,0xd0,0xba,0x4e,0x60,0x8b,
+0xdb,0x6e,0x9f,0x55,0x9a,0xdb,0xc9,0x18,0x3e,0xdd,0x1d,0x74,0xb6,0xa9,0x0c,0xac,0x14,0x76,0x5f,0xf7,0x9b,0x2d,0x14,0xc6,0x54,0xad,0x4b,0xba,0x8a,0x83,0x0a,0x6c,
+0x49,0x2d,0x2f,0xbb,0x59,0x20,0xfd,0xd0,0x51,0x0a,0x0b,0x49,0x41,0xe9,0xd4,0x8a,0x5b,0x37,0x17,0xc0,0x2a,0xab,0x57,0x97,0x31,0x51,0x0a,0x3c,0xba,0xb3,0x28,0xdd,
+0xf8,0x13,0x2b,0xcd,0x6a,0x72,0x3d,0xf4,0x94,0xf5,0x31,0x13,0xa9,0x69,0x52,0x97,0xec,0x54,0x7d,0x4b,0xe5,0xfe,0x8d,0xa0,0xa5,0xf5,0x69,0x69,0xc6,0xb6,0xaf,0xae,
+0x61,0x6c,0xa3,0xf2,0x52,0x57,0xb4,0x0f,0x7c,0x1d,0x98,0xcd,0x95,0x2d,0x95,0xb2,0xa2,0x35,0x79,0x00,0x12,0x55,0x3d,0x06,0x0f,0x3f,0xac,0x16,0x2b,0x2c,0x77,0xad,
+0xa1,0x73,0xde,0xfb,0xd1,0xae,0x30,0x91,0x13,0x2f,0x56,0xc5,0x44,0x60,0xac,0x8a,0x53,0x69,0xee,0xe2,0xe1,0xdb,0x94,0x71,0x12,0x90,0x75,0x3d,0xa1,0x92,0x68,0xb7,
+0x75,0x8d,0x37,0x78,0x6b,0x84,0x4a,0xaa,0x53,0x2f,0x46,0xd9,0x2b,0x08,0x43,0xfa,0xf0,0x75,0x45,0x93,0x6d,0x6a,0xa3,0xfc,0x6d,0x5a,0x3a,0x0b,0x48,0xca,0xe9,0x3c,
+0x46,0xfc,0x2a,0xd3,0x77,0xd3,0x90,0x1e,0xda,0xfb,0x77,0x00
+};
+const size_t WM_PK_OTA_HTML_KEYS_BR_LEN = 972;
+#else
+const uint8_t WM_PK_OTA_HTML_KEYS_BR[] PROGMEM = {
+0x1b,0xf8,0x0a,0x00,0x9c,0x05,0x76,0x2c,0x9b,0x56,0x73,0x24,0x2e,0x65,0xa5,0x87,0x55,0x97,0x6d,0xf6,0xfa,0x6e,0xcf,0xf6,0x2c,0x4a,0xb0,0x39,0x71,0x4d,0x21,0xb4,
+0x8e,0x49,0x9d,0xc4,0xa4,0xcf,0x0b,0x48,0x49,0x7d,0xf9,0xe5,0xde,0x56,0xab,0x91,0x27,0x8c,0xe5,0x6d,0xb2,0xa1,0x96,0xb6,0xc9,0xb5,0x7c,0x4a,0x29,0x8a,0x41,0x9e,
+0x42,0x32,0x27,0x41,0x58,0x89,0x32,0xb7,0x48,0x67,0x33,0x8a,0xb0,0xc8,0xa0,0xdc,0x7f,0x18,0xe7,0x70,0x92,0xec,0x1b,0x33,0x47,0xda,0x75,0x3e,0x18,0x9c,0x88,0xb2,
+0x88,0x88,0x87,0x8f,0xe5,0xd4,0x29,0x25,0x75,0xe8,0x2d,0x5a,0x55,0xc8,0x04,0xce,0xda,0x4d,0x46,0x95,0x62,0xfb,0x77,0xe2,0xeb,0x1e,0xe8,0x11,0xb5,0xe5,0xd3,0x1d,
+0x77,0xcf,0x07,0xfd,0x17,0x5f,0x4f,0x4e,0x07,0x3f,0xaa,0xce,0xc2,0x10,0x8a,0x95,0x0e,0xdd,0x4a,0x03,0x3f,0xb0,0x95,0x67,0x9c,0x1a,0x06,0xc0,0xba,0x05,0xa5,0x9a,
+0x5c,0x43,0x0a,0x3e,0x7e,0xa4,0x42,0xd2,0xb8,0xd0,0x54,0xa8,0x20,0x30,0xbe,0x2b,0xdb,0x84,0xa3,0x30,0x7e,0x28,0x2d,0xde,0x29,0xb2,0x4c,0xf2,0x0f,0x22,0x3f,0xf4,
+0xe7,0x16,0x49,0xca,0x47,0xaa,0xea,0x09,0x98,0xe4,0xe7,0x0b,0xd6,0xf4,0x1f,0xa9,0x3c,0x60,0x04,0x88,0xac,0xc9,0xfb,0xc5,0x3c,0x88,0xa7,0x98,0xce,0x46,0x9a,0x78,
+0x6c,0x96,0xdf,0xbf,0xbd,0xd2,0x80,0xe2,0xba,0x5f,0x36,0x0a,0xbb,0x72,0x33,0x75,0x35,0x15,0x6f,0x51,0x10,0xca,0xf3,0xd7,0x22,0xb3,0x2a,0xb5,0x8f,0x98,0x95,0x73,
+0x8a,0xab,0xfe,0x3c,0x54,0x1f,0xa7,0x1d,0x39,0xf0,0xe2,0x94,0x2e,0x51,0x5d,0xe5,0x0c,0xd8,0xaa,0x48,0xa5,0x16,0x30,0xcd,0xb7,0x77,0x20,0x6a,0xfe,0xc5,0xcb,0xd7,
+0x69,0x72,0x2c,0x0f,0x9f,0xd5,0x28,0xce,0x4c,0x0e,0x6a,0x44,0x15,0xe2,0xa0,0x6b,0xe4,0x8e,0x2a,0x5d,0x5a,0x50,0x15,0x67,0x6a,0x9d,0x19,0xfc,0xff,0x9e,0x98,0xa2,
+0xfd,0xd1,0x7c,0xf3,0xc2,0x5b,0x3a,0xe8,0xf0,0x75,0x34,0x63,0xe2,0xf9,0x29,0x80,0xea,0xd5,0x5a,0xd7,0xba,0x46,0x76,0x0c,0x1c,0xcf,0x71,0xac,0xcf,0xe9,0x47,0x91,
+0x34,0xdf,0xfb,0xb5,0x0e,0x08,0x22,0xa1,0xaa,0x80,0xe6,0x1d,0xb5,0x94,0xa1,0x88,0x6c,0xa8,0xdb,0xce,0x38,0xaa,0x72,0x52,0x1e,0xb4,0xc2,0x57,0x6f,0xae,0xee,0x8e,
+0x7b,0x4f,0xdb,0xc9,0x84,0xa1,0x6a,0x5a,0x66,0xfd,0x95,0x9e,0x26,0xa7,0x8b,0x31,0x25,0x24,0xe4,0xe6,0xed,0x80,0xf6,0xf6,0x71,0x78,0x04,0xa5,0xee,0xac,0x32,0xd9,
+0x0a,0xdf,0x6f,0x3a,0xf3,0x4a,0x17,0xc7,0x93,0xd4,0x1d,0xd6,0xa3,0x70,0xc6,0xdf,0x66,0x3a,0x4c,0x49,0xa0,0x3e,0x47,0xb4,0x95,0x17,0x9d,0x35,0xd4,0x94,0x2b,0xc0,
+0xe5,0x6f,0x5b,0xfb,0xd0,0x63,0x5c,0x53,0x89,0x18,0x14,0x41,0x6c,0xd9,0x1e,0x43,0x96,0xc1,0xb8,0xd0,0xf7,0x6b,0x0f,0x13,0x57,0xe3,0x10,0xd9,0x48,0xc6,0xb1,0x99,
+0x6e,0x76,0x08,0xce,0xe9,0xe2,0xcc,0x0a,0xbc,0x00,0x71,0xff,0xb9,0x29,0xd6,0x8d,0xa4,0x08,0x7c,0x0c,0x5f,0xa6,0x9e,0xe9,0x44,0xff,0xe6,0xe0,0x5e,0x8a,0xb0,0xf5,
+0xe5,0xde,0xab,0xcc,0xa6,0x9d,0x70,0x43,0xec,0x32,0x59,0xc6,0x34,0xef,0x46,0xb2,0xb8,0x26,0x7d,0xa3,0x91,0x0d,0x1a,0x96,0xb3,0xd5,0xc0,0xe9,0x08,0xde,0x8e,0xa5,
+0xd0,0x5c,0x5b,0xbd,0x35,0x0c,0xb6,0x4a,0x96,0xaa,0x16,0xed,0xab,0x31,0x4a,0xa2,0x41,0x42,0xd7,0xd1,0x8d,0xfc,0x76,0x18,0x37,0x3b,0x38,0x70,0x90,0x0a,0xa4,0xc2,
+0xa1,0xff,0x81,0xef,0xfc,0xb5,0xbb,0xbc,0xc8,0xe2,0x89,0xd9,0xd1,0xe7,0xd1,0xf3,0x5f,0x39,0xa6,0x96,0xc0,0xad,0x97,0x81,0xe8,0xf9,0xa6,0x03,0x9d,0xec,0x30,0x09,
+0x64,0x14,0x3a,0x55,0x9e,0x1b,0xa6,0x5a,0x4c,0x28,0xd3,0xaa,0x6d,0x63,0xfb,0xe7,0x70,0xc7,0x4c,0x0a,0xea,0x5a,0x20,0x3c,0x72,0x1a,0x12,0x4a,0x4b,0x28,0xe0,0x1b,
+0x88,0x45,0x95,0x07,0x7c,0x1a,0x95,0x07,0xa5,0x07,0xdf,0x81,0x02,0x29,0x86,0xc2,0xd1,0xa1,0x80,0xf1,0x89,0x58,0x9f,0x38,0xe0,0x44,0x6f,0x84,0x04,0xbf,0x52,0xc1,
+0x4b,0x84,0x3b,0xa4,0x5c,0xac,0x21,0x25,0x29,0xfa,0x48,0x2b,0x31,0x67,0xd0,0x9d,0xfb,0xff,0x45,0x57,0x64,0xf6,0xd8,0x96,0x7f,0xdc,0x58,0xd4,0xb3,0xc1,0xa3,0x8e,
+0xd4,0x0a,0xd4,0x6e,0xb1,0x00,0x45,0x5d,0x8f,0x5c,0x38,0xe3,0x42,0x78,0x9e,0x83,0xab,0x96,0x84,0x7a,0x6a,0xc6,0x35,0x7c,0x69,0xc6,0x1a,0x90,0x1c,0x57,0x92,0xc5,
+0x5d,0x1b,0xf8,0xd8,0x89,0xb2,0x8a,0xef,0x7d,0xa7,0x0c,0x74,0xce,0x7c,0x58,0xe2,0xb4,0x5f,0x11,0xa5,0x73,0xbb,0x1a,0x23,0xd7,0xbb,0x43,0xcf,0x36,0x93,0x41,0x99,
+0x7b,0xfd,0x87,0xc5,0x7c,0x09,0x53,0x30,0x93,0xad,0x44,0x57,0x73,0x50,0xf3,0xe7,0x25,0x6a,0x79,0x08,0xd2,0x40,0x06,0x21,0x37,0xc1,0x45,0xd5,0x20,0xc2,0x9c,0x64,
+0x93,0xac,0x9f,0x32,0x60,0xb5,0x3f,0xab,0xab,0xfe,0x06,0x37,0x81,0xc7,0x2a,0x16,0xad,0x9b,0x7a,0x2f,0xca,0x03,0x4c,0xcf,0x94,0x85,0x09,0x81,0x25,0x52,0x35,0x0d,
+0xc4,0x92,0x83,0x46,0x6d,0x25,0x5f,0x7f,0x61,0x67,0x66,0xb6,0xd5,0x9a,0x29,0xaf,0x56,0x37,0xfc,0x9d,0x2f,0x03,0x9f,0x0f,0x56,0x23,0x18
+};
+const size_t WM_PK_OTA_HTML_KEYS_BR_LEN = 859;
+#endif
+const uint8_t WM_PK_INFO_HTML_KEYS_BR[] PROGMEM = {
+0x1b,0xb4,0x03,0x20,0x1c,0x87,0xb1,0x7b,0x64,0x23,0x8a,0xfa,0xc9,0x81,0x38,0xca,0xaa,0xb9,0x52,0x36,0xae,0xc3,0x28,0x8f,0x8c,0x0a,0xd3,0x1c,0xfc,0x6f,0xa5,0x48,
+0xa4,0xda,0x87,0xc5,0x25,0xe5,0xdf,0x9f,0x7a,0x39,0x4f,0xd4,0xa3,0xfa,0x46,0x76,0xbb,0x69,0x8e,0x0d,0x54,0xd0,0x62,0x01,0xfb,0x4d,0xcc,0x9b,0xbf,0x05,0x87,0xf4,
+0x32,0x79,0x03,0x0d,0xde,0x91,0x6c,0xae,0x5e,0x00,0x79,0x1b,0x2c,0xef,0x7e,0x83,0x37,0x35,0x8a,0x8f,0x4d,0x39,0x6e,0x80,0xc4,0x8d,0x97,0x45,0x4b,0x18,0x5b,0xea,
+0xa4,0x4b,0x1e,0x4e,0x4a,0xd7,0x78,0x62,0xe0,0xb0,0x07,0xdc,0xa0,0x16,0x99,0x12,0xbc,0x0b,0x61,0x27,0xfd,0x3f,0xe1,0x3d,0x48,0xb5,0x78,0xb5,0xba,0x15,0xc3,0x04,
+0xc8,0x62,0xc7,0x51,0xb5,0x0c,0x4a,0xc7,0xf6,0x6b,0x97,0xc9,0xde,0xc3,0x92,0xbb,0x03,0x3a,0x94,0xd2,0x6d,0x9d,0xfe,0xf0,0x34,0xaa,0x3a,0x46,0x9d,0x9b,0xb6,0x57,
+0x8c,0x14,0x2e,0x41,0x1d,0x8e,0x17,0x04,0xa4,0xfd,0x65,0x6d,0x5d,0xf4,0xf2,0xeb,0x29,0x57,0x26,0xc9,0xe7,0x7e,0x51,0x5a,0x8c,0x6b,0x6f,0xea,0xa7,0x53,0x6d,0x74,
+0x4f,0xaf,0x9c,0xda,0x1e,0x7b,0x70,0x2a,0xf0,0x04,0x1e,0xc1,0x27,0xe4,0x85,0x04,0x2b,0xd7,0xe5,0x24,0x6e,0xdd,0x28,0x61,0xc9,0x81,0xcc,0x2d,0x0c,0x71,0x12,0x15,
+0x13,0x2a,0xd7,0xe9,0x59,0xe7,0xd5,0xee,0x5b,0xd3,0x67,0xc8,0xae,0x2b,0xa2,0xe3,0xaf,0x0a,0x55,0x49,0x3e,0xcd,0x6a,0x39,0x77,0x1e,0xdd,0x17,0x40,0x19,0x84,0xc6,
+0x3c,0xb1,0xa8,0x32,0x89,0xaf,0x54,0xaf,0x90,0x0c,0x4a,0x82,0x1e,0x03,0xad,0x1b,0x09,0x55,0x23,0x9b,0x3c,0x79,0x42,0x9c,0xd4,0x05,0xf6,0x7a,0xf2,0x91,0xfd,0xd9,
+0xcd,0x39,0x1d,0x72,0x98,0xbf,0x4b,0x45,0x8c,0xff,0xca,0x46,0x24,0x9e,0x88,0x60,0x2b,0x88,0x0c,0xb8,0xf9,0x45,0x35,0xf5,0xb2,0x6e,0x82,0x2a,0xa0,0xec,0x0a,0xe0,
+0x2d,0x6f,0xd8,0xf3,0x00,0x8f,0x08,0xb7,0x93,0x06,0x12,0xe0,0x56,0x99,0xa1,0x79,0xec,0x8c,0xe3,0x9e,0xb4,0x3e,0x3d,0x32,0xd6,0xd2,0xbd,0x14,0x73,0xb9,0x4b,0x99,
+0x63,0xfd,0x2a,0x8c,0x6c,0xe3,0x93,0x58,0x2c,0x9d,0x74,0x75,0xc8,0x30,0x9d,0xa3,0x9e,0x23,0x54,0xee,0x3c,0x1a,0xf0,0x58,0xac,0xa0,0x05,0x66,0x8e,0xc6,0x32,0x8e,
+0xc6,0x41,0x1e,0xf4,0x2c,0xbf,0xb3,0xe3,0x70,0xfa,0x76,0x23,0xd1,0xd0,0x07,0x47,0x79,0x9b,0x80,0xf7,0xa4,0x0f,0xee,0xac,0xcb,0x16,0x7a,0x30,0xb4,0xfc,0xd2,0x8f,
+0xad,0xf4,0x9e,0x9c,0xb9,0x05,0xcb,0x23,0xc1,0xd5,0x4c,0x0c
+};
+const size_t WM_PK_INFO_HTML_KEYS_BR_LEN = 428;
+const uint8_t WM_PK_WIFI_HTML_KEYS_BR[] PROGMEM = {
+0x1b,0x8e,0x09,0x00,0xac,0x0e,0x78,0xd3,0xe8,0x25,0xa1,0x75,0x17,0x14,0x5f,0xe1,0x9f,0xc9,0xf2,0xe4,0x4c,0x32,0x03,0x1f,0xdf,0x3b,0x92,0xf2,0x13,0x97,0xff,0x4d,
+0x57,0x55,0x4b,0xf7,0xc2,0x0a,0x1b,0xfe,0x8a,0xc2,0x89,0x58,0x49,0x0c,0x66,0x59,0x31,0x92,0x3b,0x2f,0xca,0xfe,0xc2,0x27,0x5e,0x7c,0x63,0xaf,0x53,0xbe,0x4e,0x75,
+0x4b,0xdd,0x26,0x2f,0xe9,0xdc,0x8c,0xbd,0x13,0xe6,0xf2,0x1c,0x1a,0x87,0x04,0x21,0x41,0x61,0x2d,0x5a,0x7d,0x93,0xe1,0x6c,0xaf,0x0e,0x34,0xd6,0x4b,0x9e,0xd5,0xe4,
+0x0c,0x3f,0x69,0x23,0xc9,0x4e,0xdb,0x15,0x34,0x78,0x4f,0xed,0xed,0x50,0xc4,0xac,0x1d,0x6e,0x40,0xbf,0x9c,0x32,0x50,0x52,0xc6,0xd6,0xa2,0x05,0xc8,0xcc,0x38,0x87,
+0xa2,0x29,0xda,0xec,0xb2,0x92,0x22,0xc6,0xa8,0x0f,0xdc,0x53,0xed,0xcb,0x85,0xc2,0xdb,0xc5,0xe9,0x85,0x59,0x44,0xf9,0x8a,0xcd,0x4e,0xce,0xb6,0xce,0x51,0x8e,0x20,
+0x26,0xa9,0x7b,0x45,0x3e,0xcc,0xbb,0x9d,0x81,0xed,0x79,0xdb,0xeb,0xd0,0x57,0xe1,0x8b,0x30,0xc8,0x9c,0xd9,0xac,0x17,0x5f,0xc0,0xda,0x2b,0xba,0xd2,0xa6,0xd4,0xe9,
+0x67,0xd1,0xe1,0x2e,0x1a,0xa6,0xda,0x60,0x13,0x1a,0x72,0x3f,0xfc,0x64,0x33,0xdf,0xd8,0x86,0xb4,0x51,0x91,0xfb,0x33,0xf8,0xef,0x10,0x55,0xe9,0x17,0x41,0xb8,0xb8,
+0x1f,0x17,0x5d,0xdb,0x09,0x22,0x3a,0xd5,0x77,0x8c,0xd9,0x01,0xdc,0xd5,0x82,0x7a,0x18,0x88,0x88,0xf4,0x72,0xb3,0x35,0x0e,0x81,0x8f,0x41,0xe2,0xf7,0x4e,0x9e,0x74,
+0x7c,0x77,0x83,0x03,0x4c,0xc3,0xea,0x73,0x34,0x22,0xae,0xf4,0x0f,0xed,0x31,0xe1,0xd6,0xbb,0xed,0x3e,0x07,0xe0,0xa4,0x8b,0xe0,0x8f,0x53,0x48,0x4a,0x18,0xbe,0xda,
+0x08,0x3b,0x90,0x15,0x38,0xe9,0xbb,0x28,0x14,0xe2,0xcc,0xc6,0xe5,0x28,0x68,0x39,0x28,0xd4,0x02,0xd7,0x4d,0x15,0xe0,0x01,0xcd,0xf2,0xca,0x2c,0xe5,0x88,0x0c,0xc7,
+0x18,0x5b,0x06,0x8c,0xc4,0xa4,0x36,0xd7,0xe3,0x46,0x85,0xb6,0x81,0x2b,0xa5,0x60,0xa0,0xfa,0x1e,0x90,0xfb,0x04,0xa3,0xd4,0x1b,0xc6,0x54,0x62,0x84,0x7c,0xe3,0xb7,
+0x06,0x1f,0xab,0x43,0x14,0xc4,0x88,0x79,0x95,0xe5,0x31,0x58,0xfd,0x1f,0xbe,0x97,0xd4,0x5f,0x07,0xdc,0xf8,0xef,0x8f,0x8f,0x7f,0x88,0x33,0x49,0x3d,0x8d,0x0d,0xff,
+0x87,0x8a,0x5c,0x44,0x84,0xed,0x5e,0xf1,0xa9,0x3e,0xbc,0xf3,0x28,0x7d,0x72,0x0c,0x25,0x07,0x6e,0xe4,0x49,0xdf,0x11,0x14,0xe7,0xd6,0x0d,0x8b,0x21,0xc6,0x1c,0x57,
+0xb4,0xbd,0x3a,0x2b,0xf0,0x50,0x76,0xc0,0xfb,0x48,0xc7,0xa8,0x4d,0xe5,0x33,0xb9,0xb7,0x92,0xa0,0xbf,0x27,0x82,0xcd,0x71,0xb6,0x50,0x50,0xe4,0x2f,0x61,0x94,0xd0,
+0x3e,0x08,0xc9,0x99,0x7c,0x14,0x92,0x2d,0x8e,0x5c,0x32,0xdb,0x0b,0x99,0x9f,0x8a,0x24,0x5e,0xfa,0x37,0xae,0x7b,0x28,0x9f,0x7f,0x59,0x64,0x0b,0x30,0xb7,0xde,0x29,
+0x84,0xe0,0x0b,0x09,0x6a,0xc7,0x9e,0x9e,0x2e,0x8e,0x8d,0x44,0xc0,0x74,0xfa,0xb2,0xd6,0xe0,0x52,0xae,0x61,0x94,0xab,0x69,0x30,0x5f,0xbc,0x22,0x9c,0x48,0x82,0xd6,
+0x5e,0x4e,0x8c,0x6c,0x47,0x6c,0x42,0xfe,0xd4,0xb3,0x57,0x31,0x40,0xd4,0x99,0xe5,0x7c,0x79,0xf3,0x71,0xaf,0x0b,0x50,0x6d,0xbe,0x6c,0x9b,0x50,0x90,0x64,0x46,0x22,
+0xbb,0x15,0x9a,0x54,0x58,0x49,0xce,0x56,0xc5,0x34,0x07,0xca,0x41,0x02,0xbc,0xe2,0x6f,0x5f,0x23,0x1d,0x9c,0x93,0x18,0xd9,0xfe,0xb9,0x45,0x24,0x94,0xc1,0xd7,0x86,
+0x0e,0xf0,0xd0,0x8c,0xf7,0x66,0x03,0xe6,0xa9,0xa7,0xb2,0xc3,0x30,0x66,0x4a,0xe1,0x09,0x93,0xbd,0xc2,0x5b,0xd0,0xae,0x70,0xa2,0x9e,0x61,0xff,0x11,0x5b,0xfb,0x7c,
+0xb4,0xac,0x4a,0x5b,0x18,0x95,0x96,0x2b,0x5b,0xe1,0xb3,0xd5,0x9c,0x5f,0xdc,0x3e,0xa3,0xe9,0xd7,0xa6,0x3b,0xc4,0xbd,0xf5,0xc1,0xf5,0x33,0xda,0x62,0x52,0xb2,0x29,
+0x82,0x02,0x43,0x97,0xb8,0x28,0xf0,0x74,0x09,0xa7,0x20,0xd2,0x05,0xe8,0x72,0xbf,0x12,0xa0,0xe0,0xd3,0xc5,0x36,0x3d,0xb1,0x5b,0x7f,0x34,0x2b,0x6f,0x27,0x34,0x36,
+0x91,0x72,0x28,0x2b,0x57,0xb6,0x44,0xad,0xca,0xe3,0x44,0x7b,0x71,0xe0,0xaa,0x9c,0x37,0xa5,0x14,0x46,0x59,0xb0,0xf9,0xaf,0x5a,0xff,0xb8,0xd2,0xa2,0x21,0xdb,0x71,
+0x3a,0x6f,0x76,0xb3,0xc0,0xb5,0xda,0xa0,0x5e,0x19,0x40,0x92,0x5f,0x3f,0x03
+};
+const size_t WM_PK_WIFI_HTML_KEYS_BR_LEN = 719;
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+const uint8_t WM_PK_MQTT_HTML_KEYS_BR[] PROGMEM = {
+0x1b,0x3c,0x08,0x00,0xbc,0x0e,0x70,0x43,0x36,0x23,0x78,0x76,0x5f,0xe8,0x36,0xaa,0x59,0xe1,0x69,0xc7,0xaf,0x2e,0xf6,0x30,0x98,0xc5,0x26,0x1c,0x42,0xf3,0x31,0xae,
+0x1a,0x54,0xf4,0x9f,0xb4,0x4a,0x79,0x72,0x26,0x99,0x73,0x81,0xef,0xd9,0xc7,0xf3,0xd8,0x91,0x94,0x9f,0xb8,0x6a,0x27,0x2d,0xc9,0xd8,0xe0,0xfc,0xc7,0xb5,0xa5,0x7a,
+0xed,0x9d,0x2a,0xf0,0x87,0x79,0xc8,0xa7,0x1b,0xee,0x21,0x76,0xd4,0x6d,0xa9,0xda,0x56,0xb5,0x99,0x05,0xe1,0x22,0x3a,0x1d,0xeb,0x4f,0x9f,0x9e,0x93,0x0c,0xb3,0xa1,
+0xc9,0xba,0xb8,0x94,0x7c,0x29,0x7b,0xcb,0x93,0x98,0xb6,0x94,0x71,0xa3,0xf3,0xeb,0x0f,0x6d,0x26,0xe2,0x31,0x89,0x06,0xac,0x12,0x27,0xfb,0xdf,0xdf,0x94,0x5e,0x2c,
+0x54,0xfa,0xee,0xd5,0x06,0x76,0x13,0x91,0x3b,0xc0,0xaa,0x72,0x2a,0xc3,0x79,0x75,0xc4,0x4a,0xda,0x09,0xb0,0xfb,0x39,0xee,0x89,0x48,0x0b,0x84,0x07,0x06,0xde,0x33,
+0x8b,0x1d,0x12,0x9e,0xda,0xe1,0x16,0x94,0xe5,0xa4,0xa0,0x24,0x85,0x4f,0x8b,0x16,0x20,0x13,0x61,0x26,0xf5,0x84,0x22,0x63,0xdb,0x14,0xda,0x3d,0x98,0x12,0xb5,0x0f,
+0x23,0xf3,0x6f,0xe7,0xeb,0x93,0x4f,0x23,0xd8,0xf1,0x73,0xd6,0x29,0x29,0x23,0x7c,0x59,0xdd,0x75,0xb3,0x4c,0xca,0xc0,0x8f,0xf9,0xac,0xf6,0x36,0xd8,0xf0,0x7b,0x02,
+0x35,0x66,0xe9,0x87,0xed,0x0b,0x55,0xeb,0x66,0xd0,0x38,0xd7,0x8f,0x0a,0xd1,0x70,0x1f,0x46,0x23,0xeb,0xb0,0x00,0x86,0xb7,0x2f,0x3e,0xf1,0x62,0xa5,0x7f,0xc9,0x75,
+0xc4,0x8f,0xda,0xdf,0xc3,0x74,0x7b,0xb5,0xbd,0x98,0xc2,0x8e,0xec,0x2a,0xe0,0x49,0x10,0x9e,0xe4,0x3b,0x9a,0x75,0x00,0x74,0xd9,0x0b,0xad,0x1b,0x32,0x53,0x3f,0x65,
+0xe4,0x61,0x13,0x4a,0x3d,0xd7,0xec,0x17,0x02,0x3a,0x1f,0xf9,0x20,0xac,0xff,0xe9,0x72,0x6a,0x7a,0xd2,0xa7,0xeb,0x15,0x4a,0x5d,0x1d,0x4a,0x7a,0xa1,0xf3,0x50,0x8f,
+0x07,0x2d,0xf8,0xa5,0x4b,0xc5,0x75,0xbf,0x64,0x24,0x7a,0xa6,0x38,0x9c,0x3f,0x1d,0x3a,0xc0,0x2b,0x64,0x05,0x8a,0x33,0xbc,0xb4,0xc2,0xfa,0xba,0x2e,0x9c,0x90,0x28,
+0xa0,0xa9,0x36,0x46,0xb8,0x14,0x1f,0x41,0x47,0x5c,0x2e,0xc2,0x52,0x11,0x0a,0x11,0x38,0xa5,0xa6,0x3a,0x5a,0x8c,0xe8,0x97,0x92,0xbd,0x31,0x92,0x48,0xda,0x41,0x40,
+0x96,0xf6,0xd2,0x54,0x0b,0x8d,0x2c,0x2d,0x40,0xa1,0x8f,0x92,0xb9,0x26,0xf0,0xfd,0x0c,0x35,0xdd,0x5b,0xea,0xbe,0xb8,0xb9,0xc4,0xf4,0x47,0x79,0x45,0x72,0xc8,0x07,
+0x4b,0xc4,0x18,0x19,0x69,0x01,0xcc,0xff,0xa3,0x7f,0x1f,0x54,0x6d,0x39,0x7e,0x4a,0xfd,0x4e,0x87,0x0e,0xe0,0x46,0x6c,0xf4,0x19,0xd3,0xad,0x25,0x17,0x49,0x95,0x60,
+0x4c,0xe1,0x43,0x59,0xce,0x99,0xc6,0x9e,0x86,0xfb,0x52,0x8e,0xd1,0xe9,0xd7,0xeb,0x16,0x4c,0x02,0x69,0x19,0x8b,0xcf,0xd9,0x1d,0xa9,0x07,0x17,0x5e,0xe2,0x6f,0x43,
+0x41,0x2f,0x01,0x0b,0xff,0xfd,0x89,0xb8,0x05,0x2c,0xc4,0x20,0xf4,0xc8,0xc8,0x96,0xb0,0xf3,0xfe,0xb6,0xd8,0xa2,0x15,0x5a,0x8e,0x48,0x2a,0x2d,0xf8,0x58,0xf8,0x95,
+0x26,0x0d,0x95,0x22,0xd4,0x2c,0xa1,0x73,0x03,0xed,0xa9,0x46,0x90,0x3a,0x41,0x54,0x40,0xcd,0x82,0xe9,0xa8,0x18,0x1d,0x41,0xc4,0x8b,0x9d,0x3b,0x59,0x5d,0xa7,0x73,
+0x47,0xd1,0xe3,0xf1,0x70,0x0e,0xc0,0xa3,0x20,0x0e,0xb1,0x75,0x1e,0x0f,0x67,0x56,0x9b,0x4f,0x4b,0xf7,0x64,0xa7,0xc7,0x5e,0x8c,0x03,0xf4,0x67,0x12,0xdb,0xae,0xe8,
+0x95,0x5c,0xd3,0xab,0xb8,0xbe,0x4c,0xa2,0xc2,0x37,0xcc,0xa1,0xd6,0x63,0x47,0x46,0x64,0xe9,0x92,0xe8,0xf9,0xda,0xa3,0x5a,0xf1,0xc7,0xcc,0xcf,0x57,0x05,0xb0,0xcc,
+0x22,0xe1,0x86,0x76,0x77,0x22,0xfe,0x69,0xc9,0xa6,0x31,0xe6,0xe4,0xb0,0x89,0xcd,0x82,0xe2,0xa3,0x5a,0x41,0xa9,0x27,0x88,0x2b,0xbc,0x3a,0x64,0x89,0x77,0xc2,0x39,
+0x85,0x33,0xcb,0x57,0x19,0x02,0x0c,0x52,0x69,0x1a,0x59,0x4e,0x9d,0x15,0x1e,0xaa,0xe1,0xb1,0x17,0x47,0x75,0x05,0x8a,0x60,0x52,0xe0,0xa8,0x47,0xec,0xcc,0x2e,0x30,
+0x62,0xf2,0xee,0xee,0x76,0xe5,0xf4,0xfc,0xbf,0x21,0xee,0xa9,0x8c,0x75,0x0d,0xee,0x06,0xe7,0xc3,0xc3,0xe8,0xd5,0x38,0x4a,0xa7,0x60,0xe7,0x56,0x71,0xdd,0xd3,0x0f,
+0xfd,0x00,0x5a,0x18,0xf4,0x9d,0x03,0x5c,0x17,0xc3,0xdb,0xf8,0xd0,0x95,0x54,0x3e,0xe4,0x0e,0xe6,0x35,0xcb,0x0f,0xfb,0xa9,0x43,0xc7,0xf2,0x4b,0x01,0xb8,0xa1,0xdf,
+0x85,0x7b,0x5d,0xa1,0xa5,0xf7,0x4d,0x00
+};
+const size_t WM_PK_MQTT_HTML_KEYS_BR_LEN = 744;
+#endif
+#if (LANGUAGE_LCID == 2057)
+const uint8_t WM_PK_LANG_JS_BR[] PROGMEM = {
+0x1b,0x1f,0x03,0x00,0x64,0x4b,0xb7,0x9d,0x65,0xee,0x35,0x49,0x4d,0xb0,0x10,0x7c,0xb4,0xdb,0x1f,0xb1,0x2f,0xee,0x07,0x97,0xd3,0x07,0x7b,0x30,0xbd,0xdb,0x3f,0x1a,
+0x6b,0x01,0xad,0x49,0x71,0x1a,0x65,0xaf,0x05,0x18,0xb6,0x80,0xb7,0xc3,0x49,0x03,0x93,0x88,0xdd,0xef,0x8c,0x8e,0x7c,0xff,0x8c,0x14,0x12,0xc6,0xbd,0xab,0x7c,0xf5,
+0xa1,0x0c,0xbe,0xd0,0x7e,0xfb,0xfa,0xe0,0x4d,0xe7,0x51,0x10,0xea,0x69,0xe0,0x19,0xe4,0x02,0x9c,0xeb,0xf6,0x70,0xd8,0x75,0xec,0x45,0xe1,0xbc,0x14,0x26,0xd3,0xb0,
+0x6c,0xfe,0x19,0xb5,0x08,0xc7,0xc8,0x55,0x0c,0xcf,0xf6,0x42,0x9f,0xba,0xcb,0x1f,0x1f,0x6b,0xe5,0xd1,0x8f,0x07,0x57,0x8b,0x9e,0xfb,0x71,0x77,0x28,0xa8,0x46,0x3c,
+0xb4,0xc8,0xb7,0xdc,0xee,0xde,0x34,0x89,0x5b,0x53,0x7b,0x15,0x0e,0x87,0x41,0x9f,0xf6,0xa9,0xf2,0xdf,0xec,0x5c,0x86,0x0f,0x22,0x07,0x97,0xc8,0x8b,0xdf,0x4f,0x1d,
+0xd2,0x18,0xb2,0xe4,0x37,0xd6,0x12,0xf0,0xba,0x02,0xc5,0x1f,0xad,0xc3,0xfe,0x4b,0xc7,0x21,0xb9,0x85,0x82,0x27,0x6a,0x3d,0xfc,0xfd,0x00,0x28,0x17,0x54,0xc1,0x75,
+0xf5,0x5b,0x25,0x30,0xe1,0x32,0x10,0x00,0x2f,0x19,0x1c,0x94,0xd0,0xca,0x5e,0x2b,0xd0,0x07,0xe0,0xce,0xf1,0xdc,0x95,0x5b,0x91,0x25,0x66,0x2b,0x8d,0x4b,0xa9,0x27,
+0x26,0x06,0x48,0x00,0x58,0xcb,0x1f,0x25,0xd3,0xb7,0xf9,0x0a,0x33,0x7d,0x7d,0x1d,0xae,0xe5,0xe2,0x85,0x94,0xf4,0xa2,0xb2,0x0c,0x12,0xff,0x69,0x64,0x8b,0xed,0x22,
+0x7d,0x21,0xde,0x3b,0x79,0x70,0x13,0x7b,0x2c,0x78,0xaf,0x33,0x98,0x45,0xa3,0xe3,0xdc,0x68,0x64,0xb7,0x13,0x9f,0x3c,0x38,0x5e,0x1a,0xbb,0x1d,0x82,0x0a,0x96,0x7b,
+0xbb,0x21,0x90,0x97,0x1d,0x2f,0xf7,0x4e,0xbb,0xaa,0x02,0x5d,0xd1,0x9e,0x61,0xaa,0xa5,0xbf,0xc9,0x4d,0xe9,0x2f,0xb6,0x23,0x07,0x10,0xa0,0x99,0x0e,0xf9,0x4f,0x1b,
+0xcb,0xdc,0x3a,0x43,0x94,0x57,0x91,0xb4,0x2f,0x02,0xce,0x31,0x00,0xfa,0x1e,0xe7,0xfe,0xad,0xf3,0x73,0x68,0xf7,0xbb,0x73,0xf9,0x4b,0x50,0xa5,0x0e,0xcb,0x35,0xe2,
+0x38,0xa7,0xfc,0x43,0x75,0xef,0x19,0x37,0x00
+};
+const size_t WM_PK_LANG_JS_BR_LEN = 361;
+#elif (LANGUAGE_LCID == 1051)
+const uint8_t WM_PK_LANG_JS_BR[] PROGMEM = {
+0x1b,0x1f,0x03,0x00,0x64,0x4b,0xb7,0x9d,0x65,0xee,0x35,0x49,0x4d,0xb0,0x10,0x7c,0xb4,0xdb,0x1f,0xb1,0x2f,0xee,0x07,0x97,0xd3,0x07,0x7b,0x30,0xbd,0xdb,0x3f,0x1a,
+0x6b,0x01,0xad,0x49,0x71,0x1a,0x65,0xaf,0x05,0x18,0xb6,0x80,0xb7,0xc3,0x49,0x03,0x93,0x88,0xdd,0xef,0x8c,0x8e,0x7c,0xff,0x8c,0x14,0x12,0xc6,0xbd,0xab,0x7c,0xf5,
+0xa1,0x0c,0xbe,0xd0,0x7e,0xfb,0xfa,0xe0,0x4d,0xe7,0x51,0x10,0xea,0x69,0xe0,0x19,0xe4,0x02,0x9c,0xeb,0xf6,0x70,0xd8,0x75,0xec,0x45,0xe1,0xbc,0x14,0x26,0xd3,0xb0,
+0x6c,0xfe,0x19,0xb5,0x08,0xc7,0xc8,0x55,0x0c,0xcf,0xf6,0x42,0x9f,0xba,0xcb,0x1f,0x1f,0x6b,0xe5,0xd1,0x8f,0x07,0x57,0x8b,0x9e,0xfb,0x71,0x77,0x28,0xa8,0x46,0x3c,
+0xb4,0xc8,0xb7,0xdc,0xee,0xde,0x34,0x89,0x5b,0x53,0x7b,0x15,0x0e,0x87,0x41,0x9f,0xf6,0xa9,0xf2,0xdf,0xec,0x5c,0x86,0x0f,0x22,0x07,0x97,0xc8,0x8b,0xdf,0x4f,0x1d,
+0xd2,0x18,0xb2,0xe4,0x37,0xd6,0x12,0xf0,0xba,0x02,0xc5,0x1f,0xad,0xc3,0xfe,0x4b,0xc7,0x21,0xb9,0x85,0x82,0x27,0x6a,0x3d,0xfc,0xfd,0x00,0x28,0x17,0x54,0xc1,0x75,
+0xf5,0x5b,0x25,0x30,0xe1,0x32,0x10,0x00,0x2f,0x19,0x1c,0x94,0xd0,0xca,0x5e,0x2b,0xb8,0x6e,0x81,0x3b,0xc7,0x73,0x57,0x6e,0x45,0x96,0x98,0xad,0x34,0x2e,0xa5,0x9e,
+0x98,0x18,0x20,0x01,0x60,0x2d,0x7f,0x94,0x4c,0xdf,0xe6,0x2b,0xcc,0xf4,0xf5,0x75,0xb8,0x96,0x8b,0x17,0x52,0xd2,0x8b,0xca,0x32,0x48,0xfc,0xa7,0x91,0x2d,0xb6,0x8b,
+0xf4,0x85,0x78,0xef,0xe4,0xc1,0x4d,0xec,0xb1,0xe0,0xbd,0xce,0x60,0x16,0x8d,0x8e,0x73,0xa3,0x91,0xdd,0x4e,0x7c,0xf2,0xe0,0x78,0x69,0xec,0x76,0x08,0x2a,0x58,0xee,
+0xed,0x86,0x40,0x5e,0x76,0xbc,0xdc,0x3b,0xed,0xaa,0x0a,0x74,0x45,0x7b,0x86,0xa9,0x96,0xfe,0x26,0x37,0xa5,0xbf,0xd8,0x8e,0x1c,0x40,0x80,0x66,0x3a,0xe4,0x3f,0x6d,
+0x2c,0x73,0xeb,0x0c,0x51,0x5e,0x45,0xd2,0xbe,0x08,0x38,0xc7,0x00,0xe8,0x7b,0x9c,0xfb,0xb7,0xce,0xcf,0xa1,0xdd,0xef,0xce,0xe5,0x2f,0x41,0x95,0x3a,0x2c,0xd7,0x88,
+0xe3,0x9c,0xf2,0x0f,0xd5,0xbd,0x67,0xdc,0x00
+};
+const size_t WM_PK_LANG_JS_BR_LEN = 361;
+#else
+const uint8_t WM_PK_LANG_JS_BR[] PROGMEM = { 0 };
+const size_t WM_PK_LANG_JS_BR_LEN = 0;
+#endif
+const uint8_t WM_PK_LANG_EN_JSON_BR[] PROGMEM = {
+0x1b,0x8c,0x0a,0x00,0x9c,0x05,0xee,0xde,0x35,0xbe,0xb4,0xe2,0xa2,0xdc,0x6d,0x88,0x84,0xe8,0xe0,0x9a,0xa4,0xf7,0x99,0xd8,0x81,0x8f,0xb9,0xc8,0x30,0x1a,0xc3,0x7c,
+0xbf,0x39,0x95,0xbd,0x37,0x0d,0xe4,0xe6,0x0a,0xe9,0x6b,0xda,0x2e,0xb9,0x1c,0x0c,0xe8,0xab,0x91,0xc2,0xd4,0x21,0xea,0x0b,0x11,0xfb,0x6f,0xbf,0x5f,0xc5,0x4f,0x27,
+0x36,0x28,0x99,0x54,0xfe,0xdd,0xd9,0xf9,0xe2,0x86,0x79,0xba,0x6f,0x1f,0x6e,0x11,0x22,0x29,0x90,0xb0,0x25,0x13,0xdc,0xa3,0x0d,0x41,0x20,0x53,0xc5,0xf5,0x97,0xff,
+0x1f,0xa8,0xa6,0x02,0x5d,0x44,0xbb,0xe3,0x1a,0x1b,0x8e,0xb0,0xe5,0x16,0x2c,0x86,0xd8,0x93,0xe6,0x56,0xb3,0x03,0x9a,0x59,0x62,0x49,0x13,0x1c,0xf8,0x77,0x75,0xbd,
+0x39,0x66,0x57,0xa9,0xa6,0xa0,0x47,0x43,0x44,0xc7,0x8c,0x01,0x58,0xf0,0x69,0xa8,0x10,0x4a,0x16,0x80,0xa4,0x9b,0xe7,0xac,0x20,0x15,0x11,0x74,0x0a,0xdc,0x9e,0x1e,
+0x01,0x2d,0xf6,0x5f,0x6b,0x06,0x2e,0xa5,0x58,0x5f,0xcb,0xa2,0x3f,0xc7,0xe2,0x70,0x78,0xbc,0x4b,0x7c,0xd4,0x5f,0x89,0x03,0x1b,0x60,0x1f,0x3c,0x00,0x0b,0xa0,0xd2,
+0x6d,0x68,0x14,0xc2,0x99,0x11,0xd0,0x90,0x53,0xb1,0x5a,0xd7,0x1b,0x2d,0xa5,0xb2,0xb7,0x85,0xe9,0x6c,0x9a,0x62,0x54,0xeb,0xe6,0xb8,0x69,0x20,0x97,0x2b,0x52,0x00,
+0x34,0x9c,0xc0,0x19,0x34,0xc7,0x30,0x04,0x73,0x73,0x3c,0x37,0xd8,0xb4,0x22,0x6d,0xa4,0x8f,0xa6,0x58,0x44,0xf9,0xbc,0x90,0x13,0x40,0x85,0x37,0xcf,0xb3,0x86,0x19,
+0x45,0x22,0x64,0x03,0xd5,0x2c,0x71,0x8c,0x5f,0xdd,0xae,0xfa,0x5d,0xa9,0xd9,0x9e,0x71,0x76,0x3f,0xca,0x12,0x5a,0x9b,0x59,0xdb,0x02,0x4f,0x9c,0xc3,0xc1,0xa8,0x4f,
+0x6f,0x87,0xff,0x4f,0x8b,0x3e,0x3c,0x91,0xf7,0x04,0x5c,0x56,0x8c,0x07,0xae,0x1e,0xeb,0x45,0x44,0x13,0x41,0xc9,0xbd,0x88,0x24,0x51,0x83,0xae,0xdf,0xd6,0x87,0xcd,
+0x3e,0xd0,0x00,0xd2,0x9b,0x55,0x51,0xa8,0x27,0x41,0xe9,0x37,0xc3,0x59,0x4f,0x3d,0xd9,0x71,0xaf,0x9b,0xb7,0x07,0xac,0xf2,0xff,0xfb,0xa3,0xd0,0x27,0xb2,0x3c,0xc1,
+0x2a,0xd0,0x24,0x93,0x2e,0x91,0x90,0xe5,0xf7,0x8e,0x1b,0xc6,0x1e,0xaf,0x83,0xf4,0x3f,0x77,0xaf,0x68,0xb6,0x2d,0x3c,0xa2,0xad,0x65,0x63,0x29,0x49,0xb0,0xef,0xad,
+0x98,0x7c,0xb0,0x2b,0x02,0x65,0x35,0xc4,0x71,0x67,0x32,0x7c,0x59,0x6b,0x92,0x90,0x76,0x14,0x02,0x24,0x3a,0x90,0x52,0xde,0x80,0xd0,0x0e,0x03,0x7a,0x77,0x83,0xdc,
+0x2e,0x4b,0xf7,0x82,0x45,0xf8,0x05,0x0d,0xa2,0xd9,0xf1,0xc0,0x9b,0x57,0x89,0x39,0x89,0x00,0x0a,0x72,0x15,0x43,0x61,0x52,0xb8,0x08,0xb1,0x43,0x90,0xa0,0x27,0xe2,
+0x88,0xc8,0x13,0x86,0x8e,0x02,0x84,0xe0,0x82,0xea,0xe7,0xba,0x46,0x4b,0x03,0x54,0xcb,0x24,0x85,0x41,0xb4,0xd6,0xd9,0x49,0x60,0x07,0xce,0xf0,0x3e,0x74,0x44,0x85,
+0x45,0x82,0xa5,0x08,0x2d,0x1d,0x1e,0x9c,0x2a,0x10,0x07,0xe3,0x02,0x97,0x58,0xb7,0xe9,0xaa,0x14,0x42,0xae,0x33,0x3e,0x90,0x4e,0x26,0xbb,0xb2,0x47,0x52,0x88,0x6a,
+0x53,0x88,0xf5,0x59,0xf0,0x80,0x0f,0x26,0xa1,0xec,0x66,0x5a,0xfe,0x02,0x58,0x59,0x29,0x84,0xf3,0xd6,0x80,0x2f,0x1c,0xf1,0xef,0xb8,0xb3,0x02,0x02,0x2d,0x46,0xcd,
+0x9e,0x29,0xbb,0xe9,0x80,0x24,0x33,0x6b,0x4b,0xcc,0xdb,0x8a,0x73,0xa9,0xa5,0xc9,0x8a,0x86,0xc7,0x80,0x3d,0xb3,0x29,0x9c,0xa8,0x34,0xd1,0x18,0x81,0xd2,0xbc,0x7c,
+0x89,0x7c,0x4c,0x31,0xe1,0x22,0xed,0x05,0x6f,0x99,0x61,0x99,0xc1,0x48,0x1c,0x94,0x8e,0x79,0x8d,0x91,0x78,0x56,0xda,0x4d,0x70,0x4d,0xaf,0x9b,0x09,0x92,0x9e,0x2f,
+0xab,0xe4,0xb3,0x2f,0xcd,0x54,0x33,0x9f,0x3f,0x4d,0x9a,0x20,0x68,0xe4,0x25,0x45,0x8e,0x52,0x6f,0x2f,0x01,0x69,0x30,0xd4,0x0f,0xdf,0x5a,0x96,0x74,0x9b,0xec,0xb5,
+0x51,0x86,0x2b,0x5b,0x83,0x6a,0x6f,0x3d,0x9c,0x83,0x76,0xf1,0x73,0x64,0x1f,0x9d,0x50,0x70,0x56,0x04,0xa5,0xe3,0xa1,0x99,0xc3,0xa0,0x25,0x68,0xb0,0xf4,0x3d,0x10,
+0x7a,0xdb,0x3a,0xdb,0xa0,0x50,0xf0,0xeb,0xd5,0xcd,0x9e,0xb3,0x4b,0xa5,0xe0,0xca,0xa4,0x1b,0x4f,0x53,0xd1,0x1f,0x1e,0xae,0x7c,0x07,0x9c,0xd0,0xaa,0x8d,0x81,0x7b,
+0x21,0x76,0xf9,0xa7,0x68,0xa4,0xfe,0x54,0x1f,0x52,0x73,0xea,0xd2,0x9a,0x0d,0x04,0x8b,0xb2,0x98,0xc2,0x74,0x90,0xfc,0xeb,0x52,0xff,0x5a,0x94,0xd4,0x16,0xc2,0xe8,
+0x38,0x06,0x20,0x70,0x9e,0x53,0xa3,0xed,0x36,0xf1,0xe1,0x74,0x8c,0x5c,0x63,0x81,0xfa,0xc7,0x8c,0xb3,0x41,0x3c,0xc9,0x71,0x13,0xcc,0x35,0x1e,0x41,0x92,0x81,0x7a,
+0x12,0xfe,0xb4,0x9b,0x59,0x61,0xc4,0xb9,0x23,0x73,0x10,0x37,0xe9,0xf6,0x10,0xb9,0x25,0xb2,0xf9,0x5a,0x0c,0x49,0x42,0xdd,0x69,0xa3,0x94,0x05,0xa0,0x1d,0xd4,0xaf,
+0x33,0x02,0x2f,0x2d,0x57,0x57,0x57,0x2c,0x83,0x24,0x72,0x46,0xe8,0x12,0x4f,0x44,0x14,0xab,0xf9,0x37,0x33,0xfe,0x0d,0x0c,0xa9,0x07,0xad,0xc6,0x44,0x24,0xee,0xe3,
+0x0c,0x5b,0xf6,0x1a,0xc4,0x75,0x9d,0xff,0xbd,0x37,0x47,0x0a,0x52,0x6c,0xca,0x4e,0xe4,0xaf,0x56,0x61,0x35,0x0a,0xa6,0xa8,0xfa,0x89,0x77,0x87,0xca,0xa0,0x3d,0x05,
+0x6b,0xe6,0xf8,0x3e,0x1f,0x81,0xc3,0x61,0x25,0xf6,0xcb,0xad,0xfe,0x28,0x8b,0xe8,0x36,0x7b,0xe8,0xc1,0x89,0x7b,0x42,0xda,0x17,0x85,0xac,0xa8,0x47,0x3f,0x37,0xa9,
+0x2f,0xc4,0x32,0x3d,0x79,0x03,0x33,0x14,0x27,0xea,0xb1,0x8b,0xfc,0x67,0x66,0x34
+};
+const size_t WM_PK_LANG_EN_JSON_BR_LEN = 912;
+const uint8_t WM_PK_LANG_SK_JSON_BR[] PROGMEM = {
+0x1b,0x58,0x0b,0x00,0x2c,0x0a,0xec,0x06,0x79,0x23,0x91,0xe6,0x97,0x56,0xbc,0xf0,0x2b,0x11,0x14,0xf9,0xfa,0xd3,0x7f,0x11,0xb5,0x3e,0x1a,0x6d,0xff,0x82,0x9d,0x68,
+0x0f,0x7c,0xf2,0x62,0x29,0x4e,0xee,0xb3,0x23,0xdf,0x21,0x25,0xe5,0xd0,0xb9,0x88,0x14,0xb2,0x39,0x85,0xb6,0xad,0xab,0x79,0x23,0x0e,0xfa,0x83,0x88,0xa8,0x4d,0x0d,
+0x3e,0xf0,0xbc,0x2e,0xa7,0x6c,0x83,0x1e,0x4b,0xa8,0xae,0xbb,0xfd,0x3b,0x19,0xf3,0x25,0x58,0x10,0xc6,0x11,0x4a,0xa7,0x2f,0x44,0xfc,0xa7,0xfd,0x7e,0x11,0x4d,0x22,
+0x5d,0x3b,0xa5,0x40,0xe9,0x84,0x4e,0xfd,0x77,0xee,0x9c,0xf9,0xf6,0x30,0xd5,0x79,0x82,0xb8,0x35,0xf2,0x56,0xd1,0xb4,0x1e,0x83,0x5a,0xa8,0x6b,0x4b,0x72,0xf9,0xbd,
+0x04,0x38,0xb2,0x41,0xa2,0x1d,0x77,0x7c,0xfe,0xbf,0x8b,0x50,0x35,0xc3,0x4f,0xba,0xbf,0xbd,0x63,0x7e,0x5f,0x68,0xcb,0x7d,0x14,0xe1,0x7d,0xb2,0x51,0x83,0xe3,0x23,
+0x17,0xbf,0x77,0xeb,0x73,0x7f,0xce,0x36,0xc2,0xf2,0x05,0x5a,0xc8,0x49,0x85,0x69,0x66,0x5a,0x9d,0xa9,0x58,0xe3,0xa3,0x77,0xb8,0x60,0x64,0x15,0xbe,0x59,0x2c,0xcd,
+0x33,0x6d,0xc1,0xc3,0x09,0xe2,0x31,0xef,0x05,0xaa,0x74,0xff,0xbb,0xe6,0xf8,0x7a,0xb8,0x30,0x29,0x26,0x47,0x6f,0x92,0x01,0x34,0xf3,0xc8,0x4a,0x39,0xfe,0xc1,0x9c,
+0x2e,0x6f,0x06,0xd1,0x2b,0x52,0x38,0x76,0x93,0x05,0xd3,0xf5,0x61,0xce,0xf2,0x50,0x1e,0xb4,0x17,0xfe,0x34,0xb6,0x07,0x18,0x63,0x22,0x84,0xeb,0xe9,0x05,0xde,0x74,
+0xdf,0x59,0x74,0x1e,0x84,0x27,0x10,0x96,0x52,0x91,0x64,0x0f,0x4e,0x82,0x2e,0xff,0xf0,0xf5,0xe6,0xa1,0x5f,0xb8,0x6d,0x6b,0x58,0x31,0x17,0x5e,0x31,0xc9,0xc5,0x84,
+0xa6,0x74,0x89,0xf0,0xba,0x6b,0x4f,0xdb,0x84,0x64,0x0a,0xcc,0xda,0x70,0x3a,0x65,0x35,0xfb,0xe1,0x65,0xd8,0xa5,0xc9,0x07,0xe7,0xf8,0x43,0xcd,0x83,0x22,0x89,0x72,
+0x41,0xb3,0x16,0x43,0x4b,0xbc,0x23,0xd9,0xf0,0xf5,0xd5,0x22,0xa7,0xc3,0x15,0x2f,0x0d,0x9e,0x38,0x52,0x91,0x47,0xc5,0x11,0x40,0xa4,0x92,0x93,0x5f,0x67,0x1c,0x83,
+0xeb,0xb5,0x6e,0x33,0x3b,0x9d,0x00,0x1b,0xee,0xdc,0x29,0xf0,0x62,0x2f,0x7a,0xa7,0x82,0x5e,0x49,0x3a,0x8a,0x73,0xb8,0x62,0x7c,0xf2,0xb7,0xd5,0x1a,0xb2,0xe4,0xeb,
+0xfd,0x0e,0x11,0x5e,0x80,0x15,0xa0,0x46,0xfe,0xcc,0xa3,0x15,0xd9,0xec,0x9b,0x35,0x52,0xa2,0x97,0xd4,0xf9,0x1a,0x29,0x21,0x77,0xf6,0x84,0xee,0xe6,0x8d,0x82,0xa6,
+0xde,0xb4,0x74,0x36,0xaa,0x15,0x50,0xf5,0xce,0xae,0xfb,0xe8,0x81,0x67,0x2e,0x37,0x92,0x13,0x63,0x01,0xf7,0x97,0x1e,0x15,0x2e,0x68,0x38,0xff,0x5f,0xcf,0xc5,0xb2,
+0xd0,0xe5,0x66,0x0e,0x2e,0x54,0xdf,0x4c,0x17,0xbe,0x91,0x46,0xd7,0xcf,0x5e,0xdd,0x3e,0xbf,0x6f,0x7a,0x4e,0x11,0x5b,0xc9,0x97,0x8e,0xa6,0xe7,0xb5,0xc1,0xb1,0x50,
+0xfb,0x57,0xde,0x88,0x5a,0xea,0xe7,0xef,0xb5,0x92,0x30,0xdf,0x10,0xf4,0xf5,0x67,0x9d,0x7d,0xf4,0x41,0x67,0x01,0x3a,0xdc,0x58,0x11,0xe8,0x42,0x01,0xb8,0x92,0x04,
+0xc7,0x01,0x53,0xaa,0xdc,0x86,0xbc,0x3e,0x73,0xcd,0xdf,0x0d,0xf8,0x67,0x9c,0xe5,0x52,0x57,0x0d,0x48,0xad,0x05,0xd4,0xd8,0x77,0xc1,0x53,0xd2,0x93,0xcc,0x21,0x4b,
+0x3f,0xce,0x0e,0x92,0x8a,0x31,0x81,0xc8,0x5e,0x48,0x13,0x4e,0x70,0x3b,0xf3,0x68,0x9a,0xb1,0x6f,0x0b,0xe8,0xd2,0xb0,0xd5,0x3d,0x0a,0x8b,0xf6,0x51,0xac,0x34,0x0d,
+0x19,0x69,0xcc,0x7e,0x2a,0x08,0x14,0x76,0x9a,0x5f,0xf2,0x28,0x82,0x50,0x8f,0x31,0xa2,0x28,0xb8,0x87,0xb2,0xc6,0x6d,0xd3,0x6d,0x30,0x2e,0x72,0x4d,0x46,0x62,0xe2,
+0xc8,0x82,0xfa,0xbb,0x65,0x4f,0x50,0x3a,0x37,0x8f,0xd0,0x3d,0x17,0xb7,0x54,0x67,0x3e,0xe3,0x28,0x18,0x13,0xa6,0x75,0xc7,0xca,0x6d,0x40,0x03,0x7e,0x57,0x51,0xbf,
+0xe2,0x3b,0xc5,0xa7,0xd1,0x8c,0x14,0xe5,0x3f,0x03,0xf8,0x9d,0xb3,0xdd,0xa8,0x3f,0x50,0xc3,0x03,0x78,0xac,0xbc,0x30,0xf0,0x1a,0x01,0x41,0xda,0xb0,0xd7,0xdf,0x16,
+0x39,0x48,0xca,0x48,0x8a,0x9b,0xd5,0x93,0x7d,0xe8,0x48,0x79,0x26,0xa4,0x19,0xe9,0xb6,0xe4,0xb4,0x0d,0x59,0x96,0xb3,0xa1,0x14,0xcb,0x91,0xaf,0x22,0x7e,0x58,0x6c,
+0x76,0x49,0x26,0xfd,0x8f,0x60,0xd4,0x4d,0xa5,0x77,0x6f,0xd3,0x2f,0xd3,0x18,0x4d,0x7a,0xde,0x51,0xfa,0xdb,0x18,0x0f,0x3c,0xf1,0x91,0xc5,0xf2,0x12,0xf2,0xea,0xd3,
+0x27,0xc4,0x3c,0x42,0x53,0x69,0x31,0x52,0x70,0x5b,0x53,0x42,0xe1,0xdb,0x15,0xf4,0x4e,0x5e,0x9f,0x7f,0x20,0xea,0x3c,0xca,0x38,0x01,0x13,0x54,0xe8,0x3f,0x32,0xb0,
+0x71,0xfe,0x98,0x7d,0x23,0xcc,0xe1,0x88,0x57,0xc2,0x09,0xf9,0x1f,0x41,0xc9,0x1a,0x32,0xdb,0xd4,0x76,0xef,0xa5,0x62,0x1a,0xcb,0x5e,0x58,0xeb,0x0d,0x66,0xad,0x21,
+0xa0,0x5c,0x12,0x8e,0x12,0x73,0x62,0xda,0x22,0xfa,0xf4,0xe1,0xcd,0x3b,0xed,0x97,0x57,0x71,0x7f,0x0d,0xe2,0x00,0x01,0x59,0x90,0x27,0x08,0x5c,0x7f,0x2b,0xf1,0x51,
+0x38,0x4a,0x43,0x93,0x1d,0x17,0x70,0x5d,0x3c,0x8d,0x46,0x5e,0xeb,0xe5,0x96,0xe5,0x5d,0xdc,0x98,0x97,0x97,0xbc,0x5a,0x75,0x3f,0xf1,0x86,0x11,0x33,0x2d,0x59,0x2e,
+0xc8,0xd4,0x65,0xa7,0x96,0xa9,0xdb,0x4c,0x74,0xb4,0x3e,0xd1,0xed,0x28,0x68,0xf3,0xce,0x0c,0x48,0x51,0xee,0xb6,0x48,0xd7,0x05,0x64,0xc2,0x2b,0xc3,0xa9,0x22,0x27,
+0xbf,0xe6,0x6f,0xf9,0x3d,0x0b,0x6f,0xb5,0x26,0xbd,0xb3,0xba,0x7d,0x3e,0x87,0xb4,0x24,0x5b,0xda,0x80,0x2a,0x69,0xb1,0x61,0x40,0x51,0x10,0x71,0x97,0x2b,0x28,0x0b,
+0x9b,0xed,0x52,0x7e,0xf6,0x8e,0x9d,0x0c,0xfd,0x11,0xa8,0x64,0x13,0xca,0x31,0x17,0xcd,0x37,0x3a,0xce,0xc9,0x1e,0xa8,0xe0,0x72,0x18,0x07,0x90,0xf7,0x8f,0xce,0x64,
+0xa5,0x99,0xb3,0x86,0x76,0x7e,0xad,0x51,0x3e,0x4d,0xe8,0xfa,0x26,0x1b,0x13,0x56,0x0f,0xf6,0x51,0x79,0x8e,0xda,0xa9,0xa7,0xea,0xa3,0x7e,0x06,0x33,0xe5,0xe1,0xe6,
+0xe7,0x57,0xd2,0x65,0xb3,0x24,0x85,0x8f,0x68,0xe8,0xca,0xeb,0xf0,0x7d,0xca,0x0f,0x11,0x7b,0xd5,0x4e,0xd5,0xab,0x53,0x6c,0xf5,0xfc,0x5a,0x8f,0xf4,0x46,0xcb,0x7e,
+0xda,0xb3,0x9f,0xf0,0x20,0x4d,0x14,0x37,0xfb,0xfc,0x4d,0xd5,0x2e,0xa0,0x2d,0x26,0x7e,0xcd,0x15,0xd1,0xfc,0xdf,0x54,0xcd,0x3a,0x55,0xb2,0x2e,0x5e,0xbb,0xd7,0x9e,
+0x70,0x43,0x5f,0x5a,0xf2,0x12,0xa2,0x63,0x6f,0x43,0x18,0x9e,0xe3,0x11,0x6d,0xfd,0xcc,0x8f,0x30,0xfa,0x8c,0xf0,0x68,0xfd,0xa1,0x16,0x74,0xe8,0xac,0xbc,0x5e,0xcd,
+0xa9,0x6d,0x3d,0x18,0xeb,0xcc,0xf4,0xeb,0x53,0x51,0x48,0x3c,0x98,0x65,0xdf,0x2d,0xda,0x9e,0xc7,0x32,0xdd,0xd6,0xd4,0x4f,0x61,0xdc,0xbb,0x39,0xa7,0xda,0x19,0x99,
+0x2f,0x59,0x2d,0x09,0x9e,0x91,0x28,0x16,0x92,0xd3,0x34,0x46,0x6a,0x74,0xe0,0x81,0x15,0x66,0x8c,0x84,0x37
+};
+const size_t WM_PK_LANG_SK_JSON_BR_LEN = 1141;
+#endif
+
+const char WM_PK_OTA_JS_KEYS_ETAG[] PROGMEM = "1297275a9dd16e2b";
+const char WM_PK_RESTART_JS_KEYS_ETAG[] PROGMEM = "ca383b217966233b";
+const char WM_PK_INDEX_HTML_KEYS_ETAG[] PROGMEM = "1d3a5053221281fb";
+#ifdef WM_REMOTE_UPDATE
+const char WM_PK_OTA_REMOTE_JS_KEYS_ETAG[] PROGMEM = "4073f546f1145646";
+const char WM_PK_OTA_HTML_KEYS_ETAG[] PROGMEM = "d697dc006879500f";
+#else
+const char WM_PK_OTA_HTML_KEYS_ETAG[] PROGMEM = "bfc6335bdc94f241";
+#endif
+const char WM_PK_INFO_HTML_KEYS_ETAG[] PROGMEM = "28799947f815b1b7";
+const char WM_PK_WIFI_HTML_KEYS_ETAG[] PROGMEM = "4957f5113c980f13";
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+const char WM_PK_MQTT_HTML_KEYS_ETAG[] PROGMEM = "2600a84ad532c78b";
+#endif
+#if (LANGUAGE_LCID == 2057)
+const char WM_PK_LANG_JS_ETAG[] PROGMEM = "2e826264d4361d5b";
+#elif (LANGUAGE_LCID == 1051)
+const char WM_PK_LANG_JS_ETAG[] PROGMEM = "0bc5cc2c709f4912";
+#else
+constexpr decltype(WM_PK_EMPTY_STR)& WM_PK_LANG_JS_ETAG = WM_PK_EMPTY_STR;
+#endif
+const char WM_PK_LANG_EN_JSON_ETAG[] PROGMEM = "dfa33af2218c9c6b";
+const char WM_PK_LANG_SK_JSON_ETAG[] PROGMEM = "0a3c30b648142384";
+#endif
+
+// Language neutral copies of the translated files, split at their strings, and the string tables of all
+// languages. With WM_RUNTIME_LANGUAGE they are served in the language of the request instead of the files above.
+#if WM_RUNTIME_LANGUAGE
+enum WMString : uint8_t
+{
+    WM_STR_OTA_JS_ILEGAL_ARGUMENT,
+    WM_STR_RESTART_IN_PROGRESS,
+    WM_STR_OTA_JS_HWID_MISMATCH,
+    WM_STR_OTA_JS_UPLOAD_ONE_BIN_FILE,
+    WM_STR_OTA_JS_UPLOAD_ONLY_BIN_FILES,
+    WM_STR_OTA_UPDATE_IN_PROGRESS,
+    WM_STR_OTA_JS_UPLOAD_FAILED,
+    WM_STR_OTA_JS_SERVER_RETURNED_STATUS,
+    WM_STR_RESTART_CONFIRM,
+    WM_STR_GENERAL_YES,
+    WM_STR_GENERAL_NO,
+    WM_STR_STATUS_SENSOR,
+    WM_STR_STATUS_VALUE,
+    WM_STR_STATUS_UNIT,
+    WM_STR_STATUS_LOADING,
+    WM_STR_INFORMATION_3DOTS,
+    WM_STR_WIFI_CONFIGURATION_3DOTS,
+    WM_STR_MQTT_CONFIGURATION_3DOTS,
+    WM_STR_FIRMWARE_UPDATE_3DOTS,
+    WM_STR_RESTART_3DOTS,
+    WM_STR_OTA_REMOTE_NEW_VERSION,
+    WM_STR_OTA_REMOTE_CURRENT,
+    WM_STR_OTA_REMOTE_SWITCH_LANG,
+    WM_STR_OTA_REMOTE_LANGUAGE_LABEL,
+    WM_STR_OTA_REMOTE_UPDATE_BTN,
+    WM_STR_GENERAL_BACK,
+    WM_STR_OTA_REMOTE_START_FAILED,
+    WM_STR_OTA_REMOTE_CHECKING,
+    WM_STR_OTA_REMOTE_ERROR,
+    WM_STR_OTA_REMOTE_UP_TO_DATE,
+    WM_STR_OTA_REMOTE_CHECK_FAILED,
+    WM_STR_OTA_TITLE,
+    WM_STR_OTA_HEADING,
+    WM_STR_OTA_SELECT_FILE,
+    WM_STR_OTA_NO_FILE_CHOSEN,
+    WM_STR_OTA_FILESIZE_LABEL,
+    WM_STR_OTA_FIRMWARE_VERSION_LABEL,
+    WM_STR_OTA_HARDWARE_ID_LABEL,
+    WM_STR_OTA_LANGUAGE_LABEL,
+    WM_STR_OTA_UPLOADING_FILE,
+    WM_STR_OTA_UPLOAD_UPDATE,
+    WM_STR_OTA_STATUS_HINT,
+    WM_STR_OTA_REMOTE_HEADING,
+    WM_STR_OTA_REMOTE_URL_LABEL,
+    WM_STR_OTA_REMOTE_CHECK_BTN,
+    WM_STR_OTA_REMOTE_STATUS_HINT,
+    WM_STR_DEVICE_STATUS,
+    WM_STR_DEVICE_INFO,
+    WM_STR_GENERAL_REFRESH,
+    WM_STR_WIFI_CONFIGURATION,
+    WM_STR_WIFI_PRIMARY_NETWORK,
+    WM_STR_WIFI_SSID_1,
+    WM_STR_WIFI_PASSWORD_1,
+    WM_STR_WIFI_OPEN_NETWORK_HINT,
+    WM_STR_WIFI_ALT_NETWORK,
+    WM_STR_WIFI_SSID_2,
+    WM_STR_WIFI_PASSWORD_2,
+    WM_STR_WIFI_SAVE,
+    WM_STR_MQTT_CONFIGURATION,
+    WM_STR_MQTT_HOST,
+    WM_STR_MQTT_PORT,
+    WM_STR_MQTT_USERNAME,
+    WM_STR_MQTT_PASSWORD,
+    WM_STR_MQTT_BROKER_HINT,
+    WM_STR_MQTT_SAVE,
+    WM_STR_COUNT
+};
+
+const char WM_LANGUAGES_CODE_2057[] PROGMEM = "en";
+const char WM_LANGUAGES_STRINGS_2057[] PROGMEM = "Illegal argument " "\0" "Restart in progress..." "\0" "Hardware ID mismatch. This firmware is not for this device." "\0" "You can only upload one (.bin) file at a time." "\0" "You can only upload (.bin) files." "\0" "Firmware update in progress.\\nDo not turn off the device." "\0" "Upload failed" "\0" "Server returned status code " "\0" "Do you want to restart the device?" "\0" "Yes" "\0" "No" "\0" "Sensor" "\0" "Value" "\0" "Unit" "\0" "Loading…" "\0" "Information..." "\0" "WiFi Configuration..." "\0" "MQTT Configuration..." "\0" "Firmware update..." "\0" "Restart..." "\0" "New version available: " "\0" "Current: " "\0" "Switch language (version " "\0" "Language:" "\0" "Update" "\0" "Back" "\0" "Start failed: " "\0" "Checking..." "\0" "Error: " "\0" "Firmware is up to date. Version: " "\0" "Check failed: " "\0" "OTA Update" "\0" "Firmware OTA Update" "\0" "Select File" "\0" "No file chosen" "\0" "Filesize:" "\0" "Firmware version:" "\0" "Hardware ID:" "\0" "Language:" "\0" "Uploading file." "\0" "Upload & Update" "\0" "Select a firmware file (.bin) and press Upload & Update." "\0" "Remote Update" "\0" "Update server URL:" "\0" "Check for Update" "\0" "Enter the update server URL and press Check for Update." "\0" "Device Status" "\0" "Device Info" "\0" "Refresh" "\0" "WiFi Configuration" "\0" "Primary Network" "\0" "SSID 1" "\0" "Password 1" "\0" "Leave password empty for open networks." "\0" "Alternative Network (Optional)" "\0" "SSID 2" "\0" "Password 2" "\0" "Save WiFi" "\0" "MQTT Configuration" "\0" "MQTT Host" "\0" "Port" "\0" "Username" "\0" "Password" "\0" "If your broker requires TLS or a username/password, fill the fields; otherwise leave blank." "\0" "Save MQTT";
+const uint16_t WM_LANGUAGES_OFFSETS_2057[] PROGMEM = { 0, 18, 41, 101, 148, 182, 240, 254, 283, 318, 322, 325, 332, 338, 343, 354, 369, 391, 413, 432, 443, 467, 477, 503, 513, 520, 525, 540, 552, 560, 594, 609, 620, 640, 652, 667, 677, 695, 708, 718, 734, 750, 807, 821, 840, 857, 913, 927, 939, 947, 966, 982, 989, 1000, 1040, 1071, 1078, 1089, 1099, 1118, 1128, 1133, 1142, 1151, 1243 };
+
+const char WM_LANGUAGES_CODE_1051[] PROGMEM = "sk";
+const char WM_LANGUAGES_STRINGS_1051[] PROGMEM = "Neplatný argument " "\0" "Reštart prebieha..." "\0" "Nezhodná Hardware ID. Tento firmvér nie je pre toto zariadenie." "\0" "Môžete nahrať iba jeden súbor (.bin) naraz." "\0" "Môžete nahrávať iba súbory (.bin)." "\0" "Prebieha aktualizácia firmvéru.\\nNevypínajte zariadenie." "\0" "Nahrávanie zlyhalo" "\0" "Server vrátil stavový kód " "\0" "Chcete reštartovať zariadenie?" "\0" "Áno" "\0" "Nie" "\0" "Senzor" "\0" "Hodnota" "\0" "Jednotka" "\0" "Načítavam…" "\0" "Informácie..." "\0" "Konfigurácia WiFi..." "\0" "Konfigurácia MQTT..." "\0" "Aktualizácia firmvéru..." "\0" "Reštart..." "\0" "Dostupná nová verzia: " "\0" "Aktuálna: " "\0" "Zmena jazyka (verzia " "\0" "Jazyk:" "\0" "Aktualizovať" "\0" "Späť" "\0" "Spustenie zlyhalo: " "\0" "Kontrolujem..." "\0" "Chyba: " "\0" "Firmvér je aktuálny. Verzia: " "\0" "Kontrola zlyhala: " "\0" "OTA aktualizácia" "\0" "OTA aktualizácia firmvéru" "\0" "Vybrať súbor" "\0" "Žiadny súbor nie je vybraný" "\0" "Veľkosť súboru:" "\0" "Verzia firmvéru:" "\0" "Hardware ID:" "\0" "Jazyk:" "\0" "Nahrávam súbor." "\0" "Nahrať a aktualizovať" "\0" "Vyberte súbor firmvéru (.bin) a stlačte Nahrať a aktualizovať." "\0" "Vzdialená aktualizácia" "\0" "URL aktualizačného servera:" "\0" "Skontrolovať aktualizáciu" "\0" "Zadajte URL servera a stlačte Skontrolovať aktualizáciu." "\0" "Stav zariadenia" "\0" "Informácie o zariadení" "\0" "Obnoviť" "\0" "Konfigurácia WiFi" "\0" "Primárna sieť" "\0" "SSID 1" "\0" "Heslo 1" "\0" "Pre otvorené siete nechajte heslo prázdne." "\0" "Alternatívna sieť (voliteľné)" "\0" "SSID 2" "\0" "Heslo 2" "\0" "Uložiť WiFi" "\0" "Konfigurácia MQTT" "\0" "MQTT Host" "\0" "Port" "\0" "Používateľské meno" "\0" "Heslo" "\0" "Ak váš broker vyžaduje TLS alebo meno/heslo, vyplňte príslušné polia; inak ich nechajte prázdne." "\0" "Uložiť MQTT";
+const uint16_t WM_LANGUAGES_OFFSETS_1051[] PROGMEM = { 0, 20, 41, 107, 155, 195, 255, 275, 305, 338, 343, 347, 354, 362, 371, 386, 401, 423, 445, 472, 484, 509, 521, 543, 550, 564, 571, 591, 606, 614, 646, 665, 683, 711, 726, 757, 776, 794, 807, 814, 832, 856, 924, 949, 979, 1007, 1067, 1083, 1108, 1117, 1136, 1152, 1159, 1167, 1212, 1246, 1253, 1261, 1275, 1294, 1304, 1309, 1332, 1338, 1443 };
+
+const HTTPLanguage WM_LANGUAGES[] PROGMEM = {
+    { WM_LANGUAGES_CODE_2057, 2057, WM_LANGUAGES_STRINGS_2057, WM_LANGUAGES_OFFSETS_2057 },
+    { WM_LANGUAGES_CODE_1051, 1051, WM_LANGUAGES_STRINGS_1051, WM_LANGUAGES_OFFSETS_1051 }
+};
+
+// Index of the language the firmware is built with (LanguageSupport.h), used when the request asks for none
+#if (LANGUAGE_LCID == 1051)
+const uint8_t WM_LANGUAGES_DEFAULT = 1;
+#else
+const uint8_t WM_LANGUAGES_DEFAULT = 0;
+#endif
+
+const char WM_PK_OTA_JS_LT_0[] PROGMEM = "const $m0=(()=>{const gebi=s=>document.getElementById(s);const IH=(l,v)=>{gebi(l).textContent=v};return{IH,gebi};})();const $m1=(()=>{function A(l){return l&&l.__esModule&&Object.prototype.hasOwnProperty.call(l,'default')?l.default:l}\nvar L={exports:{}},x={exports:{}};(function(){var l='ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/',f={rotl:function(s,d){return s<<d|s>>>32-d},rotr:function(s,d){return s<<32-d|s>>>d},endian:function(s){if(s.constructor==Number)\nreturn f.rotl(s,8)&16711935|f.rotl(s,24)&4278255360;for(var d=0;d<s.length;d++)s[d]=f.endian(s[d]);return s},randomBytes:function(s){for(var d=[];s>0;s--)\nd.push(Math.floor(Math.random()*256));return d},bytesToWords:function(s){for(var d=[],a=0,c=0;a<s.length;a++,c+=8)\nd[c>>>5]|=s[a]<<24-c%32;return d},wordsToBytes:function(s){for(var d=[],a=0;a<s.length*32;a+=8)\nd.push(s[a>>>5]>>>24-a%32&255);return d},bytesToHex:function(s){for(var d=[],a=0;a<s.length;a++)\nd.push((s[a]>>>4).toString(16)),d.push((s[a]&15).toString(16));return d.join('')},hexToBytes:function(s){for(var d=[],a=0;a<s.length;a+=2)\nd.push(parseInt(s.substr(a,2),16));return d},bytesToBase64:function(s){for(var d=[],a=0;a<s.length;a+=3)\nfor(var c=s[a]<<16|s[a+1]<<8|s[a+2],i=0;i<4;i++)\na*8+i*6<=s.length*8?d.push(l.charAt(c>>>6*(3-i)&63)):d.push('=');return d.join('')},base64ToBytes:function(s){s=s.replace(/[^A-Z0-9+\\/]/ig,'');for(var d=[],a=0,c=0;a<s.length;c=++a%4)\nc!=0&&d.push((l.indexOf(s.charAt(a-1))&Math.pow(2,-2*c+8)-1)<<c*2|l.indexOf(s.charAt(a))>>>6-c*2);return d}};x.exports=f})();var H=x.exports,F={utf8:{stringToBytes:function(l){return F.bin.stringToBytes(unescape(encodeURIComponent(l)))},bytesToString:function(l){return decodeURIComponent(escape(F.bin.bytesToString(l)))}},bin:{stringToBytes:function(l){for(var f=[],s=0;s<l.length;s++)\nf.push(l.charCodeAt(s)&255);return f},bytesToString:function(l){for(var f=[],s=0;s<l.length;s++)\nf.push(String.fromCharCode(l[s]));return f.join('')}}},I=F;var O=function(l){return l!=null&&(M(l)||P(l)||!!l._isBuffer)};function M(l){return!!l.constructor&&typeof l.constructor.isBuffer=='function'&&l.constructor.isBuffer(l)}\nfunction P(l){return typeof l.readFloatLE=='function'&&typeof l.slice=='function'&&M(l.slice(0,0))}\n(function(){var l=H,f=I.utf8,s=O,d=I.bin,a=function(c,i){c.constructor==String?i&&i.encoding==='binary'?c=d.stringToBytes(c):c=f.stringToBytes(c):s(c)?c=Array.prototype.slice.call(c,0):!Array.isArray(c)&&c.constructor!==Uint8Array&&(c=c.toString());for(var r=l.bytesToWords(c),p=c.length*8,n=1732584193,e=-271733879,o=-1732584194,t=271733878,u=0;u<r.length;u++)\nr[u]=(r[u]<<8|r[u]>>>24)&16711935|(r[u]<<24|r[u]>>>8)&4278255360;r[p>>>5]|=128<<p%32,r[(p+64>>>9<<4)+14]=p;for(var m=a._ff,g=a._gg,h=a._hh,y=a._ii,u=0;u<r.length;u+=16){var C=n,S=e,k=o,_=t;n=m(n,e,o,t,r[u+0],7,-680876936),t=m(t,n,e,o,r[u+1],12,-389564586),o=m(o,t,n,e,r[u+2],17,606105819),e=m(e,o,t,n,r[u+3],22,-1044525330),n=m(n,e,o,t,r[u+4],7,-176418897),t=m(t,n,e,o,r[u+5],12,1200080426),o=m(o,t,n,e,r[u+6],17,-1473231341),e=m(e,o,t,n,r[u+7],22,-45705983),n=m(n,e,o,t,r[u+8],7,1770035416),t=m(t,n,e,o,r[u+9],12,-1958414417),o=m(o,t,n,e,r[u+10],17,-42063),e=m(e,o,t,n,r[u+11],22,-1990404162),n=m(n,e,o,t,r[u+12],7,1804603682),t=m(t,n,e,o,r[u+13],12,-40341101),o=m(o,t,n,e,r[u+14],17,-1502002290),e=m(e,o,t,n,r[u+15],22,1236535329),n=g(n,e,o,t,r[u+1],5,-165796510),t=g(t,n,e,o,r[u+6],9,-1069501632),o=g(o,t,n,e,r[u+11],14,643717713),e=g(e,o,t,n,r[u+0],20,-373897302),n=g(n,e,o,t,r[u+5],5,-701558691),t=g(t,n,e,o,r[u+10],9,38016083),o=g(o,t,n,e,r[u+15],14,-660478335),e=g(e,o,t,n,r[u+4],20,-405537848),n=g(n,e,o,t,r[u+9],5,568446438),t=g(t,n,e,o,r[u+14],9,-1019803690),o=g(o,t,n,e,r[u+3],14,-187363961),e=g(e,o,t,n,r[u+8],20,1163531501),n=g(n,e,o,t,r[u+13],5,-1444681467),t=g(t,n,e,o,r[u+2],9,-51403784),o=g(o,t,n,e,r[u+7],14,1735328473),e=g(e,o,t,n,r[u+12],20,-1926607734),n=h(n,e,o,t,r[u+5],4,-378558),t=h(t,n,e,o,r[u+8],11,-2022574463),o=h(o,t,n,e,r[u+11],16,1839030562),e=h(e,o,t,n,r[u+14],23,-35309556),n=h(n,e,o,t,r[u+1],4,-1530992060),t=h(t,n,e,o,r[u+4],11,1272893353),o=h(o,t,n,e,r[u+7],16,-155497632),e=h(e,o,t,n,r[u+10],23,-1094730640),n=h(n,e,o,t,r[u+13],4,681279174),t=h(t,n,e,o,r[u+0],11,-358537222),o=h(o,t,n,e,r[u+3],16,-722521979),e=h(e,o,t,n,r[u+6],23,76029189),n=h(n,e,o,t,r[u+9],4,-640364487),t=h(t,n,e,o,r[u+12],11,-421815835),o=h(o,t,n,e,r[u+15],16,530742520),e=h(e,o,t,n,r[u+2],23,-995338651),n=y(n,e,o,t,r[u+0],6,-198630844),t=y(t,n,e,o,r[u+7],10,1126891415),o=y(o,t,n,e,r[u+14],15,-1416354905),e=y(e,o,t,n,r[u+5],21,-57434055),n=y(n,e,o,t,r[u+12],6,1700485571),t=y(t,n,e,o,r[u+3],10,-1894986606),o=y(o,t,n,e,r[u+10],15,-1051523),e=y(e,o,t,n,r[u+1],21,-2054922799),n=y(n,e,o,t,r[u+8],6,1873313359),t=y(t,n,e,o,r[u+15],10,-30611744),o=y(o,t,n,e,r[u+6],15,-1560198380),e=y(e,o,t,n,r[u+13],21,1309151649),n=y(n,e,o,t,r[u+4],6,-145523070),t=y(t,n,e,o,r[u+11],10,-1120210379),o=y(o,t,n,e,r[u+2],15,718787259),e=y(e,o,t,n,r[u+9],21,-343485551),n=n+C>>>0,e=e+S>>>0,o=o+k>>>0,t=t+_>>>0}\nreturn l.endian([n,e,o,t])};a._ff=function(c,i,r,p,n,e,o){var t=c+(i&r|~i&p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._gg=function(c,i,r,p,n,e,o){var t=c+(i&p|r&~p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._hh=function(c,i,r,p,n,e,o){var t=c+(i^r^p)+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._ii=function(c,i,r,p,n,e,o){var t=c+(r^(i|~p))+(n>>>0)+o;return(t<<e|t>>>32-e)+i},a._blocksize=16,a._digestsize=16,L.exports=function(c,i){if(c==null)\nthrow new Error('";
+const char WM_PK_OTA_JS_LT_1[] PROGMEM = "'+c);var r=l.wordsToBytes(a(c,i));return i&&i.asBytes?r:i&&i.asString?d.bytesToString(r):l.bytesToHex(r)}})();var U=L.exports;const R=A(U);return{R};})();const $m2=(()=>{var _modalCss='.modal-overlay{position:fixed;inset:0;background:rgba(0,0,0,0.55);display:flex;align-items:center;justify-content:center;z-index:9999}'+\n'.modal-box{background:#fff;border-radius:.75rem;box-shadow:0 8px 32px rgba(0,0,0,.28);padding:2.5rem 2rem;text-align:center;min-width:220px}'+\n'.spinner{width:52px;height:52px;border:5px solid rgba(25,118,210,.15);border-top-color:#1976d2;border-radius:50%;animation:spin .8s linear infinite;margin:0 auto 1.25rem}'+\n'@keyframes spin{to{transform:rotate(360deg)}}'+\n'.modal-msg{color:#718792;margin-bottom:.75rem;font-size:1.05rem;white-space:pre-line}'+\n'.modal-cnt{font-size:2.5rem;font-weight:700;color:#1976d2}'+\n'.modal-btn-row{display:flex;gap:.75rem;justify-content:center;margin-top:1.25rem}'+\n'.modal-btn{padding:.6rem 1.5rem;border:none;border-radius:.5rem;font-size:1rem;font-weight:600;cursor:pointer}'+\n'.modal-btn-yes{background:#1976d2;color:#fff}'+\n'.modal-btn-no{background:transparent;color:#718792;border:.125rem solid rgba(25,118,210,.2)}';function ensureModalCss(){if(!document.getElementById('rModalCss')){var s=document.createElement('style');s.id='rModalCss';s.textContent=_modalCss;document.head.appendChild(s);}}\nfunction showRestartModal(seconds,message){ensureModalCss();var msg=(message!==undefined)?message:'";
+const char WM_PK_OTA_JS_LT_2[] PROGMEM = "';var div=document.createElement('div');div.className='modal-overlay';div.innerHTML='<div class=\\'modal-box\\'>'+\n'<div class=\\'spinner\\'></div>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-cnt\\' id=\\'rCnt\\'>'+seconds+'</div>'+\n'</div>';document.body.appendChild(div);var n=seconds;var t=setInterval(function(){n--;var el=document.getElementById('rCnt');if(el)el.textContent=n;if(n<=0){clearInterval(t);location.href='/';}},1000);}\nreturn{showRestartModal};})();(()=>{const{gebi,IH}=$m0;const{R}=$m1;const{showRestartModal}=$m2;const v=l=>{gebi(l).classList.remove('hidden');};const H=l=>{gebi(l).classList.add('hidden');};const w=l=>{gebi('progInfo').textContent=l;};const E=l=>{gebi('err').textContent=l;};function fid(buf,tag){const b=new Uint8Array(buf);const tb=new TextEncoder().encode(tag);for(let i=0;i<=b.length-tb.length;i++){let found=true;for(let j=0;j<tb.length;j++){if(b[i+j]!==tb[j]){found=false;break;}}\nif(found){let ib=[];let k=i+tb.length;while(k<b.length&&b[k]!==0){ib.push(b[k]);k++;}\nreturn new TextDecoder().decode(new Uint8Array(ib));}}\nreturn null;}\nconst D1=async(f)=>new Promise((resolve,reject)=>{let reader=new FileReader();reader.onload=function(event){const arrayBuffer=event.target.result;const md5=R(arrayBuffer);const hwid=fid(arrayBuffer,'@*MAGic*@:hw:');const ver=fid(arrayBuffer,'@*MAGic*@:ve:');const lang=fid(arrayBuffer,'@*MAGic*@:lg:');resolve({md5,hwid,ver,lang});};reader.onerror=reject;reader.readAsArrayBuffer(f);});let hwidQuery=null;const devHwid=()=>hwidQuery||(hwidQuery=fetch('/sq?dx=hwid').then(r=>r.json()).catch(e=>{hwidQuery=null;throw e;}));const N=async l=>{let f='fr';const{md5,hwid,ver,lang}=await D1(l);if(hwid!=null&&ver!=null)\n{v('fileProps');IH('fwName',l.name);IH('filesize',l.size.toString()+' B');IH('hwid',hwid);IH('fmver',ver);IH('fmlang',lang!=null?lang:'');H('successRow');try{const dJ=await devHwid();if(dJ.hwid&&dJ.hwid===hwid){gebi('hwid').classList.remove('red-txt');gebi('updateBtn').disabled=false;gebi('err').textContent='';H('errRow');}else{gebi('hwid').classList.add('red-txt');gebi('updateBtn').disabled=true;E('";
+const char WM_PK_OTA_JS_LT_3[] PROGMEM = "');v('errRow');return null;}}catch(e){gebi('updateBtn').disabled=true;E('";
+const char WM_PK_OTA_JS_LT_4[] PROGMEM = "');v('errRow');return null;}\nreturn{'md5':md5,'file':l,'hwid':hwid};}\nelse\n{H('fileProps');IH('fwName',l.name);gebi('updateBtn').disabled=true;E('Incorrect file selected.');H('successRow');v('errRow');}\nreturn null;};const V=l=>l.length>1&&!multiple?(alert('";
+const char WM_PK_OTA_JS_LT_5[] PROGMEM = "'),!1):l[0].name.split('.').pop()!='bin'?(alert('";
+const char WM_PK_OTA_JS_LT_6[] PROGMEM = "'),!1):!0;function G(){window.location.reload()}\nfunction PG(v){gebi('otaProg').value=v;gebi('otaProgTxt').innerHTML=v.toString()+'%';}\nvar timeOut;function updateProgress(){var prog=gebi('otaProg');if(prog.value>=100){PG(100);clearTimeout(timeOut);failed('Updated failed');return;}\nPG(prog.value+10);timeOut=setTimeout(updateProgress,500);}\nfunction finishedOK(){H('progRow');showRestartModal(15,'";
+const char WM_PK_OTA_JS_LT_7[] PROGMEM = "');}\nfunction failed(msg){E(msg);gebi('updateBtn').disabled=false;gebi('back').disabled=false;H('progRow');v('errRow');}\nasync function startUpload(file,md5,hwid){let f='fr';PG(0);H('errRow');H('successRow');v('progRow');try{w('Uploading '+file.name);const d=await fetch(`/ota/start?mode=${f}&hash=${md5}&hwid=${hwid}`);if(!d.ok)\n{throw new Error(d.statusText);}\nif(d.status==200&&d.statusText!=='OK')\n{throw new Error(d.statusText);}\nconst a=await d.text();console.log('Start OTA response:',a);const c=new FormData;let i=new XMLHttpRequest;i.open('POST','/ota/upload');i.upload.addEventListener('progress',function(r){let p=Math.round(r.loaded/r.total*100);PG(p);},!1);i.upload.onprogress=function(r){if(r.lengthComputable){let p=Math.round(r.loaded/r.total*100);PG(p);}};i.onreadystatechange=function(){if(i.readyState==4)\nif(i.status==200)\nfinishedOK();else if(i.status==400){let r=i.responseText;throw new Error('";
+const char WM_PK_OTA_JS_LT_8[] PROGMEM = "'+' '+r);}\nelse{let r='";
+const char WM_PK_OTA_JS_LT_9[] PROGMEM = "'+i.status;throw new Error('";
+const char WM_PK_OTA_JS_LT_10[] PROGMEM = "'+' '+r);}};c.append('file',file,file.name);i.send(c);}\ncatch(s){failed(s);}}\nlet selectedFile=null;async function z(files){if(!V(files))\nreturn false;const result=await N(files[0]);if(result!=null){selectedFile=result;}else{selectedFile=null;}\ngebi('fileInput').value='';}\nwindow.resetView=G;window.onFileInput=z;document.addEventListener('DOMContentLoaded',()=>{var q=gebi('selFile'),fileInp=gebi('fileInput');const updateBtn=gebi('updateBtn');q.addEventListener('click',function(l){l.preventDefault(),fileInp.click()});updateBtn.addEventListener('click',async(e)=>{e.preventDefault();if(selectedFile&&selectedFile.file&&selectedFile.md5){updateBtn.disabled=true;gebi('back').disabled=true;startUpload(selectedFile.file,selectedFile.md5,selectedFile.hwid);}else{console.error('No valid file selected for upload.');alert('Please select a valid firmware file first.');}});});})();\n";
+const HTTPTemplatePart WM_PK_OTA_JS_LT_PARTS[] PROGMEM = {
+    { WM_PK_OTA_JS_LT_0, WM_STR_OTA_JS_ILEGAL_ARGUMENT },
+    { WM_PK_OTA_JS_LT_1, WM_STR_RESTART_IN_PROGRESS },
+    { WM_PK_OTA_JS_LT_2, WM_STR_OTA_JS_HWID_MISMATCH },
+    { WM_PK_OTA_JS_LT_3, WM_STR_OTA_JS_HWID_MISMATCH },
+    { WM_PK_OTA_JS_LT_4, WM_STR_OTA_JS_UPLOAD_ONE_BIN_FILE },
+    { WM_PK_OTA_JS_LT_5, WM_STR_OTA_JS_UPLOAD_ONLY_BIN_FILES },
+    { WM_PK_OTA_JS_LT_6, WM_STR_OTA_UPDATE_IN_PROGRESS },
+    { WM_PK_OTA_JS_LT_7, WM_STR_OTA_JS_UPLOAD_FAILED },
+    { WM_PK_OTA_JS_LT_8, WM_STR_OTA_JS_SERVER_RETURNED_STATUS },
+    { WM_PK_OTA_JS_LT_9, WM_STR_OTA_JS_UPLOAD_FAILED },
+    { WM_PK_OTA_JS_LT_10, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_OTA_JS_LT = { WM_PK_OTA_JS_LT_PARTS, ARRAY_LENGTH(WM_PK_OTA_JS_LT_PARTS) };
+const char WM_PK_OTA_JS_LT_ETAG[] PROGMEM = "cc5ed4942c0383ff";
+const char WM_PK_RESTART_JS_LT_0[] PROGMEM = "var _modalCss='.modal-overlay{position:fixed;inset:0;background:rgba(0,0,0,0.55);display:flex;align-items:center;justify-content:center;z-index:9999}'+\n'.modal-box{background:#fff;border-radius:.75rem;box-shadow:0 8px 32px rgba(0,0,0,.28);padding:2.5rem 2rem;text-align:center;min-width:220px}'+\n'.spinner{width:52px;height:52px;border:5px solid rgba(25,118,210,.15);border-top-color:#1976d2;border-radius:50%;animation:spin .8s linear infinite;margin:0 auto 1.25rem}'+\n'@keyframes spin{to{transform:rotate(360deg)}}'+\n'.modal-msg{color:#718792;margin-bottom:.75rem;font-size:1.05rem;white-space:pre-line}'+\n'.modal-cnt{font-size:2.5rem;font-weight:700;color:#1976d2}'+\n'.modal-btn-row{display:flex;gap:.75rem;justify-content:center;margin-top:1.25rem}'+\n'.modal-btn{padding:.6rem 1.5rem;border:none;border-radius:.5rem;font-size:1rem;font-weight:600;cursor:pointer}'+\n'.modal-btn-yes{background:#1976d2;color:#fff}'+\n'.modal-btn-no{background:transparent;color:#718792;border:.125rem solid rgba(25,118,210,.2)}';function ensureModalCss(){if(!document.getElementById('rModalCss')){var s=document.createElement('style');s.id='rModalCss';s.textContent=_modalCss;document.head.appendChild(s);}}\nexport function showConfirmModal(onConfirm){ensureModalCss();var overlay=document.createElement('div');overlay.className='modal-overlay';overlay.innerHTML='<div class=\\'modal-box\\'>'+\n'<p class=\\'modal-msg\\'>'+'";
+const char WM_PK_RESTART_JS_LT_1[] PROGMEM = "'+'</p>'+\n'<div class=\\'modal-btn-row\\'>'+\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'mBtnY\\'>'+'";
+const char WM_PK_RESTART_JS_LT_2[] PROGMEM = "'+'</button>'+\n'<button class=\\'modal-btn modal-btn-no\\' id=\\'mBtnN\\'>'+'";
+const char WM_PK_RESTART_JS_LT_3[] PROGMEM = "'+'</button>'+\n'</div></div>';document.body.appendChild(overlay);document.getElementById('mBtnY').onclick=function(){document.body.removeChild(overlay);onConfirm();};document.getElementById('mBtnN').onclick=function(){document.body.removeChild(overlay);};}\nexport function showRestartModal(seconds,message){ensureModalCss();var msg=(message!==undefined)?message:'";
+const char WM_PK_RESTART_JS_LT_4[] PROGMEM = "';var div=document.createElement('div');div.className='modal-overlay';div.innerHTML='<div class=\\'modal-box\\'>'+\n'<div class=\\'spinner\\'></div>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-cnt\\' id=\\'rCnt\\'>'+seconds+'</div>'+\n'</div>';document.body.appendChild(div);var n=seconds;var t=setInterval(function(){n--;var el=document.getElementById('rCnt');if(el)el.textContent=n;if(n<=0){clearInterval(t);location.href='/';}},1000);}\n";
+const HTTPTemplatePart WM_PK_RESTART_JS_LT_PARTS[] PROGMEM = {
+    { WM_PK_RESTART_JS_LT_0, WM_STR_RESTART_CONFIRM },
+    { WM_PK_RESTART_JS_LT_1, WM_STR_GENERAL_YES },
+    { WM_PK_RESTART_JS_LT_2, WM_STR_GENERAL_NO },
+    { WM_PK_RESTART_JS_LT_3, WM_STR_RESTART_IN_PROGRESS },
+    { WM_PK_RESTART_JS_LT_4, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_RESTART_JS_LT = { WM_PK_RESTART_JS_LT_PARTS, ARRAY_LENGTH(WM_PK_RESTART_JS_LT_PARTS) };
+const char WM_PK_RESTART_JS_LT_ETAG[] PROGMEM = "9232ccfc1b540a73";
+const char WM_PK_INDEX_HTML_LT_0[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width, initial-scale=1.0'>\n<title data-app='title'>IoT Device Control</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script src='hw-status.3bc5e939.js'></script>\n<script src='app.js'></script>\n</head>\n<body>\n<div class='container'>\n<h1 data-app='title'>IoT Device Control</h1>\n<table class='sttbl' style='margin-bottom:1rem'>\n<thead><tr><th>";
+const char WM_PK_INDEX_HTML_LT_1[] PROGMEM = "</th><th>";
+constexpr decltype(WM_PK_INDEX_HTML_LT_1)& WM_PK_INDEX_HTML_LT_2 = WM_PK_INDEX_HTML_LT_1;
+const char WM_PK_INDEX_HTML_LT_3[] PROGMEM = "</th></tr></thead>\n<tbody id='hw-st-body'>\n<tr><td colspan='3' style='text-align:center;color:var(--muted)'>";
+const char WM_PK_INDEX_HTML_LT_4[] PROGMEM = "</td></tr>\n</tbody>\n</table>\n<div class='btncol'>\n<a class='mainbtn' href='/info'>";
+const char WM_PK_INDEX_HTML_LT_5[] PROGMEM = "</a>\n<a class='mainbtn' href='/wifi'>";
+const char WM_PK_INDEX_HTML_LT_6[] PROGMEM = "</a>\n<a class='mainbtn' href='/mqtt'>";
+const char WM_PK_INDEX_HTML_LT_7[] PROGMEM = "</a>\n<a class='mainbtn' href='/ota'>";
+const char WM_PK_INDEX_HTML_LT_8[] PROGMEM = "</a>\n<a class='mainbtn' href='#' id='rstBtn'>";
+const char WM_PK_INDEX_HTML_LT_9[] PROGMEM = "</a>\n</div>\n<script type='module'>import{showConfirmModal,showRestartModal}from'./restart.9232ccfc.js';document.getElementById('rstBtn').addEventListener('click',function(e){e.preventDefault();showConfirmModal(function(){fetch('/r');showRestartModal(10,/*L_RESTART_IN_PROGRESS*/'Restart in progress...');});});</script>\n<footer class='ftr'>\n<hr>\n<div class='ftr-line'><span data-app='copyright'>© 2025 Kalejap — </span><span class='muted'>Author: Kalejap</span></div>\n<div class='ftr-line' id='fwVer'>Firmware: <span data-app='version'>v1.0.3</span></div>\n</footer>\n</div>\n</body>\n</html>\n";
+const HTTPTemplatePart WM_PK_INDEX_HTML_LT_PARTS[] PROGMEM = {
+    { WM_PK_INDEX_HTML_LT_0, WM_STR_STATUS_SENSOR },
+    { WM_PK_INDEX_HTML_LT_1, WM_STR_STATUS_VALUE },
+    { WM_PK_INDEX_HTML_LT_2, WM_STR_STATUS_UNIT },
+    { WM_PK_INDEX_HTML_LT_3, WM_STR_STATUS_LOADING },
+    { WM_PK_INDEX_HTML_LT_4, WM_STR_INFORMATION_3DOTS },
+    { WM_PK_INDEX_HTML_LT_5, WM_STR_WIFI_CONFIGURATION_3DOTS },
+    { WM_PK_INDEX_HTML_LT_6, WM_STR_MQTT_CONFIGURATION_3DOTS },
+    { WM_PK_INDEX_HTML_LT_7, WM_STR_FIRMWARE_UPDATE_3DOTS },
+    { WM_PK_INDEX_HTML_LT_8, WM_STR_RESTART_3DOTS },
+    { WM_PK_INDEX_HTML_LT_9, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_INDEX_HTML_LT = { WM_PK_INDEX_HTML_LT_PARTS, ARRAY_LENGTH(WM_PK_INDEX_HTML_LT_PARTS) };
+const char WM_PK_INDEX_HTML_LT_ETAG[] PROGMEM = "759c38ada6d5ddee";
+#ifdef WM_REMOTE_UPDATE
+constexpr decltype(WM_PK_OTA_JS_LT_0)& WM_PK_OTA_REMOTE_JS_LT_0 = WM_PK_OTA_JS_LT_0;
+constexpr decltype(WM_PK_OTA_JS_LT_1)& WM_PK_OTA_REMOTE_JS_LT_1 = WM_PK_OTA_JS_LT_1;
+const char WM_PK_OTA_REMOTE_JS_LT_2[] PROGMEM = "';var div=document.createElement('div');div.className='modal-overlay';div.innerHTML='<div class=\\'modal-box\\'>'+\n'<div class=\\'spinner\\'></div>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-cnt\\' id=\\'rCnt\\'>'+seconds+'</div>'+\n'</div>';document.body.appendChild(div);var n=seconds;var t=setInterval(function(){n--;var el=document.getElementById('rCnt');if(el)el.textContent=n;if(n<=0){clearInterval(t);location.href='/';}},1000);}\nreturn{showRestartModal};})();const $m3=(()=>{const{gebi,IH}=$m0;const{R}=$m1;const{showRestartModal}=$m2;const v=l=>{gebi(l).classList.remove('hidden');};const H=l=>{gebi(l).classList.add('hidden');};const w=l=>{gebi('progInfo').textContent=l;};const E=l=>{gebi('err').textContent=l;};function fid(buf,tag){const b=new Uint8Array(buf);const tb=new TextEncoder().encode(tag);for(let i=0;i<=b.length-tb.length;i++){let found=true;for(let j=0;j<tb.length;j++){if(b[i+j]!==tb[j]){found=false;break;}}\nif(found){let ib=[];let k=i+tb.length;while(k<b.length&&b[k]!==0){ib.push(b[k]);k++;}\nreturn new TextDecoder().decode(new Uint8Array(ib));}}\nreturn null;}\nconst D1=async(f)=>new Promise((resolve,reject)=>{let reader=new FileReader();reader.onload=function(event){const arrayBuffer=event.target.result;const md5=R(arrayBuffer);const hwid=fid(arrayBuffer,'@*MAGic*@:hw:');const ver=fid(arrayBuffer,'@*MAGic*@:ve:');const lang=fid(arrayBuffer,'@*MAGic*@:lg:');resolve({md5,hwid,ver,lang});};reader.onerror=reject;reader.readAsArrayBuffer(f);});let hwidQuery=null;const devHwid=()=>hwidQuery||(hwidQuery=fetch('/sq?dx=hwid').then(r=>r.json()).catch(e=>{hwidQuery=null;throw e;}));const N=async l=>{let f='fr';const{md5,hwid,ver,lang}=await D1(l);if(hwid!=null&&ver!=null)\n{v('fileProps');IH('fwName',l.name);IH('filesize',l.size.toString()+' B');IH('hwid',hwid);IH('fmver',ver);IH('fmlang',lang!=null?lang:'');H('successRow');try{const dJ=await devHwid();if(dJ.hwid&&dJ.hwid===hwid){gebi('hwid').classList.remove('red-txt');gebi('updateBtn').disabled=false;gebi('err').textContent='';H('errRow');}else{gebi('hwid').classList.add('red-txt');gebi('updateBtn').disabled=true;E('";
+constexpr decltype(WM_PK_OTA_JS_LT_3)& WM_PK_OTA_REMOTE_JS_LT_3 = WM_PK_OTA_JS_LT_3;
+constexpr decltype(WM_PK_OTA_JS_LT_4)& WM_PK_OTA_REMOTE_JS_LT_4 = WM_PK_OTA_JS_LT_4;
+constexpr decltype(WM_PK_OTA_JS_LT_5)& WM_PK_OTA_REMOTE_JS_LT_5 = WM_PK_OTA_JS_LT_5;
+const char WM_PK_OTA_REMOTE_JS_LT_6[] PROGMEM = "'),!1):!0;function G(){window.location.reload()}\nfunction PG(v){gebi('otaProg').value=v;gebi('otaProgTxt').innerHTML=v.toString()+'%';}\nvar timeOut;function finishedOK(){H('progRow');showRestartModal(15,'";
+constexpr decltype(WM_PK_OTA_JS_LT_7)& WM_PK_OTA_REMOTE_JS_LT_7 = WM_PK_OTA_JS_LT_7;
+constexpr decltype(WM_PK_OTA_JS_LT_8)& WM_PK_OTA_REMOTE_JS_LT_8 = WM_PK_OTA_JS_LT_8;
+constexpr decltype(WM_PK_OTA_JS_LT_9)& WM_PK_OTA_REMOTE_JS_LT_9 = WM_PK_OTA_JS_LT_9;
+const char WM_PK_OTA_REMOTE_JS_LT_10[] PROGMEM = "'+' '+r);}};c.append('file',file,file.name);i.send(c);}\ncatch(s){failed(s);}}\nlet selectedFile=null;async function z(files){if(!V(files))\nreturn false;const result=await N(files[0]);if(result!=null){selectedFile=result;}else{selectedFile=null;}\ngebi('fileInput').value='';}\nwindow.resetView=G;window.onFileInput=z;document.addEventListener('DOMContentLoaded',()=>{var q=gebi('selFile'),fileInp=gebi('fileInput');const updateBtn=gebi('updateBtn');q.addEventListener('click',function(l){l.preventDefault(),fileInp.click()});updateBtn.addEventListener('click',async(e)=>{e.preventDefault();if(selectedFile&&selectedFile.file&&selectedFile.md5){updateBtn.disabled=true;gebi('back').disabled=true;startUpload(selectedFile.file,selectedFile.md5,selectedFile.hwid);}else{console.error('No valid file selected for upload.');alert('Please select a valid firmware file first.');}});});return{};})();(()=>{const{gebi}=$m0;const{showRestartModal}=$m2;function showInfoModal(msg){var overlay=document.createElement('div');overlay.className='modal-overlay';overlay.innerHTML='<div class=\\'modal-box\\'>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div class=\\'modal-btn-row\\'>'+\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'rmOk\\'>OK</button>'+\n'</div></div>';document.body.appendChild(overlay);document.getElementById('rmOk').onclick=function(){document.body.removeChild(overlay);};}\nfunction showUpdateModal(data){var langs=Object.keys(data.firmwares);var opts=langs.map(function(l){var sel=(l===data.lang)?' selected':'';return'<option value=\\''+l+'\\''+sel+'>'+l+'</option>';}).join('');var msg=data.available?('";
+const char WM_PK_OTA_REMOTE_JS_LT_11[] PROGMEM = "'+'<strong>'+data.version+'</strong><br>'+'";
+const char WM_PK_OTA_REMOTE_JS_LT_12[] PROGMEM = "'+data.current):('";
+const char WM_PK_OTA_REMOTE_JS_LT_13[] PROGMEM = "'+data.version+')');var overlay=document.createElement('div');overlay.className='modal-overlay';overlay.innerHTML='<div class=\\'modal-box\\'>'+\n'<p class=\\'modal-msg\\'>'+msg+'</p>'+\n'<div style=\\'margin-bottom:0.75rem;\\'>'+\n'<label class=\\'flbl\\' for=\\'rmLang\\'>'+'";
+const char WM_PK_OTA_REMOTE_JS_LT_14[] PROGMEM = "'+'</label>'+\n'<select class=\\'finp\\' id=\\'rmLang\\'>'+opts+'</select>'+\n'</div>'+\n'<div class=\\'modal-btn-row\\'>'+\n'<button class=\\'modal-btn modal-btn-yes\\' id=\\'rmUpdate\\'>'+'";
+const char WM_PK_OTA_REMOTE_JS_LT_15[] PROGMEM = "'+'</button>'+\n'<button class=\\'modal-btn modal-btn-no\\' id=\\'rmBack\\'>'+'";
+const char WM_PK_OTA_REMOTE_JS_LT_16[] PROGMEM = "'+'</button>'+\n'</div></div>';document.body.appendChild(overlay);document.getElementById('rmUpdate').onclick=function(){var lang=document.getElementById('rmLang').value;var url=data.firmwares[lang];document.body.removeChild(overlay);fetch('/ota/remote-start?url='+encodeURIComponent(url))\n.then(function(){showRestartModal(30,'";
+const char WM_PK_OTA_REMOTE_JS_LT_17[] PROGMEM = "');})\n.catch(function(e){gebi('remoteStatus').textContent='";
+const char WM_PK_OTA_REMOTE_JS_LT_18[] PROGMEM = "'+e.message;});};document.getElementById('rmBack').onclick=function(){document.body.removeChild(overlay);};}\ndocument.addEventListener('DOMContentLoaded',function(){gebi('checkRemoteBtn').addEventListener('click',async function(){var url=gebi('remoteUrl').value.trim();if(!url)return;gebi('remoteStatus').textContent='";
+const char WM_PK_OTA_REMOTE_JS_LT_19[] PROGMEM = "';try{var r=await fetch('/ota/remote-check?url='+encodeURIComponent(url));var j=await r.json();if(j.error){gebi('remoteStatus').textContent='";
+const char WM_PK_OTA_REMOTE_JS_LT_20[] PROGMEM = "'+j.error;return;}\ngebi('remoteStatus').textContent='';if(!j.available&&!j.canSwitch){showInfoModal('";
+const char WM_PK_OTA_REMOTE_JS_LT_21[] PROGMEM = "'+j.current);}else{showUpdateModal(j);}}catch(e){gebi('remoteStatus').textContent='";
+const char WM_PK_OTA_REMOTE_JS_LT_22[] PROGMEM = "'+e.message;}});});})();\n";
+const HTTPTemplatePart WM_PK_OTA_REMOTE_JS_LT_PARTS[] PROGMEM = {
+    { WM_PK_OTA_REMOTE_JS_LT_0, WM_STR_OTA_JS_ILEGAL_ARGUMENT },
+    { WM_PK_OTA_REMOTE_JS_LT_1, WM_STR_RESTART_IN_PROGRESS },
+    { WM_PK_OTA_REMOTE_JS_LT_2, WM_STR_OTA_JS_HWID_MISMATCH },
+    { WM_PK_OTA_REMOTE_JS_LT_3, WM_STR_OTA_JS_HWID_MISMATCH },
+    { WM_PK_OTA_REMOTE_JS_LT_4, WM_STR_OTA_JS_UPLOAD_ONE_BIN_FILE },
+    { WM_PK_OTA_REMOTE_JS_LT_5, WM_STR_OTA_JS_UPLOAD_ONLY_BIN_FILES },
+    { WM_PK_OTA_REMOTE_JS_LT_6, WM_STR_OTA_UPDATE_IN_PROGRESS },
+    { WM_PK_OTA_REMOTE_JS_LT_7, WM_STR_OTA_JS_UPLOAD_FAILED },
+    { WM_PK_OTA_REMOTE_JS_LT_8, WM_STR_OTA_JS_SERVER_RETURNED_STATUS },
+    { WM_PK_OTA_REMOTE_JS_LT_9, WM_STR_OTA_JS_UPLOAD_FAILED },
+    { WM_PK_OTA_REMOTE_JS_LT_10, WM_STR_OTA_REMOTE_NEW_VERSION },
+    { WM_PK_OTA_REMOTE_JS_LT_11, WM_STR_OTA_REMOTE_CURRENT },
+    { WM_PK_OTA_REMOTE_JS_LT_12, WM_STR_OTA_REMOTE_SWITCH_LANG },
+    { WM_PK_OTA_REMOTE_JS_LT_13, WM_STR_OTA_REMOTE_LANGUAGE_LABEL },
+    { WM_PK_OTA_REMOTE_JS_LT_14, WM_STR_OTA_REMOTE_UPDATE_BTN },
+    { WM_PK_OTA_REMOTE_JS_LT_15, WM_STR_GENERAL_BACK },
+    { WM_PK_OTA_REMOTE_JS_LT_16, WM_STR_OTA_UPDATE_IN_PROGRESS },
+    { WM_PK_OTA_REMOTE_JS_LT_17, WM_STR_OTA_REMOTE_START_FAILED },
+    { WM_PK_OTA_REMOTE_JS_LT_18, WM_STR_OTA_REMOTE_CHECKING },
+    { WM_PK_OTA_REMOTE_JS_LT_19, WM_STR_OTA_REMOTE_ERROR },
+    { WM_PK_OTA_REMOTE_JS_LT_20, WM_STR_OTA_REMOTE_UP_TO_DATE },
+    { WM_PK_OTA_REMOTE_JS_LT_21, WM_STR_OTA_REMOTE_CHECK_FAILED },
+    { WM_PK_OTA_REMOTE_JS_LT_22, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_OTA_REMOTE_JS_LT = { WM_PK_OTA_REMOTE_JS_LT_PARTS, ARRAY_LENGTH(WM_PK_OTA_REMOTE_JS_LT_PARTS) };
+const char WM_PK_OTA_REMOTE_JS_LT_ETAG[] PROGMEM = "e05884bb40e98ffe";
+const char WM_PK_OTA_HTML_LT_0[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>";
+const char WM_PK_OTA_HTML_LT_1[] PROGMEM = "</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script type='module' src='ota-remote.e05884bb.js'></script>\n<script src='app.js'></script>\n</head>\n<body>\n<div class='container'>\n<h1>";
+const char WM_PK_OTA_HTML_LT_2[] PROGMEM = "</h1>\n<div class='btncol' aria-live='polite'>\n<button id='selFile' class='mainbtn' type='button'>";
+const char WM_PK_OTA_HTML_LT_3[] PROGMEM = "</button>\n<span id='fwName' class='fname'>";
+const char WM_PK_OTA_HTML_LT_4[] PROGMEM = "</span>\n<input class='hidden' type='file' id='fileInput' name='firmware' accept='.bin,.bin.gz' onchange='onFileInput(files)'>\n<div id='fileProps' class='meta-wrap hidden' aria-hidden='false'>\n<div class='meta-item'>\n<div class='meta-label'>";
+const char WM_PK_OTA_HTML_LT_5[] PROGMEM = "</div>\n<div id='filesize' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>";
+const char WM_PK_OTA_HTML_LT_6[] PROGMEM = "</div>\n<div id='fmver' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>";
+const char WM_PK_OTA_HTML_LT_7[] PROGMEM = "</div>\n<div id='hwid' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>";
+const char WM_PK_OTA_HTML_LT_8[] PROGMEM = "</div>\n<div id='fmlang' class='meta-val'></div>\n</div>\n</div>\n</div>\n<div class='btncol hidden' id='progRow'>\n<div class='progwrap'>\n<progress id='otaProg' class='prog' value='0' max='100'></progress>\n<div id='otaProgTxt' class='prog-txt'>0%</div>\n</div>\n<div id='progInfo' class='meta-val'>";
+const char WM_PK_OTA_HTML_LT_9[] PROGMEM = "</div>\n</div>\n<div id='errRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='red-txt'><path d='m21.73 18-8-14a2 2 0 0 0-3.48 0l-8 14A2 2 0 0 0 4 21h16a2 2 0 0 0 1.73-3Z'/><path d='M12 9v4'/><path d='M12 17h.01'/></svg>\n<div id='err' class='meta-val'></div>\n</div>\n<div id='successRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='green-txt'><path d='M3.85 8.62a4 4 0 0 1 4.78-4.77 4 4 0 0 1 6.74 0 4 4 0 0 1 4.78 4.78 4 4 0 0 1 0 6.74 4 4 0 0 1-4.77 4.78 4 4 0 0 1-6.75 0 4 4 0 0 1-4.78-4.77 4 4 0 0 1 0-6.76Z'/><path d='m9 12 2 2 4-4'/></svg>\n<div id='success' class='meta-val'></div>\n</div>\n<div class='row-center'>\n<button id='updateBtn' class='formbtn' disabled>";
+const char WM_PK_OTA_HTML_LT_10[] PROGMEM = "</button>\n<a class='formbtn secbtn' id='back' href='./'>";
+const char WM_PK_OTA_HTML_LT_11[] PROGMEM = "</a>\n</div>\n<div id='otaStatus' class='muted center-txt' style='margin-top:0.625rem;'>";
+const char WM_PK_OTA_HTML_LT_12[] PROGMEM = "</div>\n<hr>\n<h2>";
+const char WM_PK_OTA_HTML_LT_13[] PROGMEM = "</h2>\n<div class='btncol'>\n<div>\n<label class='flbl' for='remoteUrl'>";
+const char WM_PK_OTA_HTML_LT_14[] PROGMEM = "</label>\n<input class='finp' type='text' id='remoteUrl' value='' data-app='otaUrl'>\n</div>\n<button id='checkRemoteBtn' class='mainbtn' type='button'>";
+const char WM_PK_OTA_HTML_LT_15[] PROGMEM = "</button>\n</div>\n<div id='remoteStatus' class='muted center-txt' style='margin-top:0.625rem;'>";
+const char WM_PK_OTA_HTML_LT_16[] PROGMEM = "</div>\n</div>\n</body>\n</html>\n";
+const HTTPTemplatePart WM_PK_OTA_HTML_LT_PARTS[] PROGMEM = {
+    { WM_PK_OTA_HTML_LT_0, WM_STR_OTA_TITLE },
+    { WM_PK_OTA_HTML_LT_1, WM_STR_OTA_HEADING },
+    { WM_PK_OTA_HTML_LT_2, WM_STR_OTA_SELECT_FILE },
+    { WM_PK_OTA_HTML_LT_3, WM_STR_OTA_NO_FILE_CHOSEN },
+    { WM_PK_OTA_HTML_LT_4, WM_STR_OTA_FILESIZE_LABEL },
+    { WM_PK_OTA_HTML_LT_5, WM_STR_OTA_FIRMWARE_VERSION_LABEL },
+    { WM_PK_OTA_HTML_LT_6, WM_STR_OTA_HARDWARE_ID_LABEL },
+    { WM_PK_OTA_HTML_LT_7, WM_STR_OTA_LANGUAGE_LABEL },
+    { WM_PK_OTA_HTML_LT_8, WM_STR_OTA_UPLOADING_FILE },
+    { WM_PK_OTA_HTML_LT_9, WM_STR_OTA_UPLOAD_UPDATE },
+    { WM_PK_OTA_HTML_LT_10, WM_STR_GENERAL_BACK },
+    { WM_PK_OTA_HTML_LT_11, WM_STR_OTA_STATUS_HINT },
+    { WM_PK_OTA_HTML_LT_12, WM_STR_OTA_REMOTE_HEADING },
+    { WM_PK_OTA_HTML_LT_13, WM_STR_OTA_REMOTE_URL_LABEL },
+    { WM_PK_OTA_HTML_LT_14, WM_STR_OTA_REMOTE_CHECK_BTN },
+    { WM_PK_OTA_HTML_LT_15, WM_STR_OTA_REMOTE_STATUS_HINT },
+    { WM_PK_OTA_HTML_LT_16, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_OTA_HTML_LT = { WM_PK_OTA_HTML_LT_PARTS, ARRAY_LENGTH(WM_PK_OTA_HTML_LT_PARTS) };
+const char WM_PK_OTA_HTML_LT_ETAG[] PROGMEM = "32b77d5dc3170056";
+#else
+const char WM_PK_OTA_HTML_LT_0[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>";
+const char WM_PK_OTA_HTML_LT_1[] PROGMEM = "</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script type='module' src='ota.cc5ed494.js'></script>\n</head>\n<body>\n<div class='container'>\n<h1>";
+const char WM_PK_OTA_HTML_LT_2[] PROGMEM = "</h1>\n<div class='btncol' aria-live='polite'>\n<button id='selFile' class='mainbtn' type='button'>";
+const char WM_PK_OTA_HTML_LT_3[] PROGMEM = "</button>\n<span id='fwName' class='fname'>";
+const char WM_PK_OTA_HTML_LT_4[] PROGMEM = "</span>\n<input class='hidden' type='file' id='fileInput' name='firmware' accept='.bin,.bin.gz' onchange='onFileInput(files)'>\n<div id='fileProps' class='meta-wrap hidden' aria-hidden='false'>\n<div class='meta-item'>\n<div class='meta-label'>";
+const char WM_PK_OTA_HTML_LT_5[] PROGMEM = "</div>\n<div id='filesize' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>";
+const char WM_PK_OTA_HTML_LT_6[] PROGMEM = "</div>\n<div id='fmver' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>";
+const char WM_PK_OTA_HTML_LT_7[] PROGMEM = "</div>\n<div id='hwid' class='meta-val'></div>\n</div>\n<div class='meta-item'>\n<div class='meta-label'>";
+const char WM_PK_OTA_HTML_LT_8[] PROGMEM = "</div>\n<div id='fmlang' class='meta-val'></div>\n</div>\n</div>\n</div>\n<div class='btncol hidden' id='progRow'>\n<div class='progwrap'>\n<progress id='otaProg' class='prog' value='0' max='100'></progress>\n<div id='otaProgTxt' class='prog-txt'>0%</div>\n</div>\n<div id='progInfo' class='meta-val'>";
+const char WM_PK_OTA_HTML_LT_9[] PROGMEM = "</div>\n</div>\n<div id='errRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='red-txt'><path d='m21.73 18-8-14a2 2 0 0 0-3.48 0l-8 14A2 2 0 0 0 4 21h16a2 2 0 0 0 1.73-3Z'/><path d='M12 9v4'/><path d='M12 17h.01'/></svg>\n<div id='err' class='meta-val'></div>\n</div>\n<div id='successRow' class='row-center hidden' >\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='green-txt'><path d='M3.85 8.62a4 4 0 0 1 4.78-4.77 4 4 0 0 1 6.74 0 4 4 0 0 1 4.78 4.78 4 4 0 0 1 0 6.74 4 4 0 0 1-4.77 4.78 4 4 0 0 1-6.75 0 4 4 0 0 1-4.78-4.77 4 4 0 0 1 0-6.76Z'/><path d='m9 12 2 2 4-4'/></svg>\n<div id='success' class='meta-val'></div>\n</div>\n<div class='row-center'>\n<button id='updateBtn' class='formbtn' disabled>";
+const char WM_PK_OTA_HTML_LT_10[] PROGMEM = "</button>\n<a class='formbtn secbtn' id='back' href='./'>";
+const char WM_PK_OTA_HTML_LT_11[] PROGMEM = "</a>\n</div>\n<div id='otaStatus' class='muted center-txt' style='margin-top:0.625rem;'>";
+const char WM_PK_OTA_HTML_LT_12[] PROGMEM = "</div>\n</div>\n</body>\n</html>\n";
+const HTTPTemplatePart WM_PK_OTA_HTML_LT_PARTS[] PROGMEM = {
+    { WM_PK_OTA_HTML_LT_0, WM_STR_OTA_TITLE },
+    { WM_PK_OTA_HTML_LT_1, WM_STR_OTA_HEADING },
+    { WM_PK_OTA_HTML_LT_2, WM_STR_OTA_SELECT_FILE },
+    { WM_PK_OTA_HTML_LT_3, WM_STR_OTA_NO_FILE_CHOSEN },
+    { WM_PK_OTA_HTML_LT_4, WM_STR_OTA_FILESIZE_LABEL },
+    { WM_PK_OTA_HTML_LT_5, WM_STR_OTA_FIRMWARE_VERSION_LABEL },
+    { WM_PK_OTA_HTML_LT_6, WM_STR_OTA_HARDWARE_ID_LABEL },
+    { WM_PK_OTA_HTML_LT_7, WM_STR_OTA_LANGUAGE_LABEL },
+    { WM_PK_OTA_HTML_LT_8, WM_STR_OTA_UPLOADING_FILE },
+    { WM_PK_OTA_HTML_LT_9, WM_STR_OTA_UPLOAD_UPDATE },
+    { WM_PK_OTA_HTML_LT_10, WM_STR_GENERAL_BACK },
+    { WM_PK_OTA_HTML_LT_11, WM_STR_OTA_STATUS_HINT },
+    { WM_PK_OTA_HTML_LT_12, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_OTA_HTML_LT = { WM_PK_OTA_HTML_LT_PARTS, ARRAY_LENGTH(WM_PK_OTA_HTML_LT_PARTS) };
+const char WM_PK_OTA_HTML_LT_ETAG[] PROGMEM = "611c8fbbf838d170";
+#endif
+const char WM_PK_INFO_HTML_LT_0[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='utf-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>";
+const char WM_PK_INFO_HTML_LT_1[] PROGMEM = "</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script type='module'>import{gebi,IH,d2t,sq}from'./utils.f070d5e4.js';window.onload=async()=>{const opt={tableClass:'sttbl',colHeadLocals:{}};try{const d=await sq('hwinfo','fwinfo');d2t(d.hwinfo,'tcont1',opt);d2t(d.fwinfo,'tcont2',opt);}catch(error){IH('tcont1',`Error: ${error.message}`);}};</script>\n</head>\n<body>\n<div class='container'>\n<h1>";
+const char WM_PK_INFO_HTML_LT_2[] PROGMEM = "</h1>\n<div id='tcont1'></div>\n<div id='tcont2'></div>\n<div class='row-center' style='margin-top:1.125rem;'>\n<a class='mainbtn' href='/status/update'>";
+const char WM_PK_INFO_HTML_LT_3[] PROGMEM = "</a>\n<a class='formbtn secbtn' href='/'>";
+const char WM_PK_INFO_HTML_LT_4[] PROGMEM = "</a>\n</div>\n</div>\n</body>\n</html>\n";
+const HTTPTemplatePart WM_PK_INFO_HTML_LT_PARTS[] PROGMEM = {
+    { WM_PK_INFO_HTML_LT_0, WM_STR_DEVICE_STATUS },
+    { WM_PK_INFO_HTML_LT_1, WM_STR_DEVICE_INFO },
+    { WM_PK_INFO_HTML_LT_2, WM_STR_GENERAL_REFRESH },
+    { WM_PK_INFO_HTML_LT_3, WM_STR_GENERAL_BACK },
+    { WM_PK_INFO_HTML_LT_4, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_INFO_HTML_LT = { WM_PK_INFO_HTML_LT_PARTS, ARRAY_LENGTH(WM_PK_INFO_HTML_LT_PARTS) };
+const char WM_PK_INFO_HTML_LT_ETAG[] PROGMEM = "95205714e14ef703";
+const char WM_PK_WIFI_HTML_LT_0[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width, initial-scale=1.0'>\n<title>";
+const char WM_PK_WIFI_HTML_LT_1[] PROGMEM = "</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script type='module'>import{gebi,qsa,u2f}from'./utils.f070d5e4.js';const toggleButtons=qsa('.toggle-password');document.addEventListener('DOMContentLoaded',()=>{toggleButtons.forEach(button=>{button.addEventListener('click',function(){const targetId=this.getAttribute('data-target');const passwordInput=gebi(targetId);if(passwordInput){const type=passwordInput.getAttribute('type')==='password'?'text':'password';passwordInput.setAttribute('type',type);this.textContent=type==='password'?'👁️':'🔒';}});});});window.onload=()=>{u2f('./sq?dx=wifi');};</script>\n</head>\n<body>\n<div class='container'>\n<h1>";
+const char WM_PK_WIFI_HTML_LT_2[] PROGMEM = "</h1>\n<form class='formsec' method='POST' action='./wifi'>\n<h2>";
+const char WM_PK_WIFI_HTML_LT_3[] PROGMEM = "</h2>\n<div>\n<label class='flbl' for='ssid1'>";
+const char WM_PK_WIFI_HTML_LT_4[] PROGMEM = "</label>\n<input class='finp' type='text' id='ssid1' name='ssid1' required aria-label='WiFi SSID'>\n</div>\n<div>\n<label class='flbl' for='pwd1'>";
+const char WM_PK_WIFI_HTML_LT_5[] PROGMEM = "</label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd1' name='pwd1' aria-label='WiFi Password'>\n<button type='button' class='toggle-password' id='toggle_p' data-target='pwd1' aria-label='Toggle password 1 visibility'>👁️</button>\n</div>\n</div>\n<div class='muted'>";
+const char WM_PK_WIFI_HTML_LT_6[] PROGMEM = "</div>\n<hr>\n<h2>";
+const char WM_PK_WIFI_HTML_LT_7[] PROGMEM = "</h2>\n<div>\n<label class='flbl' for='ssid2'>";
+const char WM_PK_WIFI_HTML_LT_8[] PROGMEM = "</label>\n<input class='finp' type='text' id='ssid2' name='ssid2' required aria-label='WiFi SSID'>\n</div>\n<div>\n<label class='flbl' for='pwd2'>";
+const char WM_PK_WIFI_HTML_LT_9[] PROGMEM = "</label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd2' name='pwd2' aria-label='WiFi Password'>\n<button type='button' class='toggle-password' id='toggle_pwd1' data-target='pwd2' aria-label='Toggle password 2 visibility'>👁️</button>\n</div>\n</div>\n<div class='muted'>";
+const char WM_PK_WIFI_HTML_LT_10[] PROGMEM = "</div>\n<div class='row-center'>\n<button class='formbtn' type='submit'>";
+const char WM_PK_WIFI_HTML_LT_11[] PROGMEM = "</button>\n<a class='formbtn secbtn' href='/'>";
+const char WM_PK_WIFI_HTML_LT_12[] PROGMEM = "</a>\n</div>\n</form>\n</div>\n</body>\n</html>\n";
+const HTTPTemplatePart WM_PK_WIFI_HTML_LT_PARTS[] PROGMEM = {
+    { WM_PK_WIFI_HTML_LT_0, WM_STR_WIFI_CONFIGURATION },
+    { WM_PK_WIFI_HTML_LT_1, WM_STR_WIFI_CONFIGURATION },
+    { WM_PK_WIFI_HTML_LT_2, WM_STR_WIFI_PRIMARY_NETWORK },
+    { WM_PK_WIFI_HTML_LT_3, WM_STR_WIFI_SSID_1 },
+    { WM_PK_WIFI_HTML_LT_4, WM_STR_WIFI_PASSWORD_1 },
+    { WM_PK_WIFI_HTML_LT_5, WM_STR_WIFI_OPEN_NETWORK_HINT },
+    { WM_PK_WIFI_HTML_LT_6, WM_STR_WIFI_ALT_NETWORK },
+    { WM_PK_WIFI_HTML_LT_7, WM_STR_WIFI_SSID_2 },
+    { WM_PK_WIFI_HTML_LT_8, WM_STR_WIFI_PASSWORD_2 },
+    { WM_PK_WIFI_HTML_LT_9, WM_STR_WIFI_OPEN_NETWORK_HINT },
+    { WM_PK_WIFI_HTML_LT_10, WM_STR_WIFI_SAVE },
+    { WM_PK_WIFI_HTML_LT_11, WM_STR_GENERAL_BACK },
+    { WM_PK_WIFI_HTML_LT_12, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_WIFI_HTML_LT = { WM_PK_WIFI_HTML_LT_PARTS, ARRAY_LENGTH(WM_PK_WIFI_HTML_LT_PARTS) };
+const char WM_PK_WIFI_HTML_LT_ETAG[] PROGMEM = "f5d1d810ab35f98b";
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+const char WM_PK_MQTT_HTML_LT_0[] PROGMEM = "<!DOCTYPE html>\n<html lang='en'>\n<head>\n<meta charset='UTF-8'>\n<meta name='viewport' content='width=device-width,initial-scale=1'>\n<title>";
+const char WM_PK_MQTT_HTML_LT_1[] PROGMEM = "</title>\n<link rel='stylesheet' href='style.c9c548e6.css'>\n<script src='module_polyfill.51ea247b.js'></script>\n<script type='module'>import{gebi,qsa,u2f}from'./utils.f070d5e4.js';const toggleButtons=qsa('.toggle-password');window.onload=()=>{u2f('./sq?dx=mqtt');};document.addEventListener('DOMContentLoaded',()=>{toggleButtons.forEach(button=>{button.addEventListener('click',function(){const targetId=this.getAttribute('data-target');const passwordInput=gebi(targetId);if(passwordInput){const type=passwordInput.getAttribute('type')==='password'?'text':'password';passwordInput.setAttribute('type',type);this.textContent=type==='password'?'👁️':'🔒';}});});});</script>\n</head>\n<body>\n<div class='container'>\n<h1 class='ttl'>";
+const char WM_PK_MQTT_HTML_LT_2[] PROGMEM = "</h1>\n<form class='formsec' method='POST' action='/mqtt'>\n<div>\n<label class='flbl' for='host'>";
+const char WM_PK_MQTT_HTML_LT_3[] PROGMEM = "</label>\n<input class='finp' type='text' id='host' name='host' required aria-label='MQTT host'>\n</div>\n<div>\n<label class='flbl' for='port'>";
+const char WM_PK_MQTT_HTML_LT_4[] PROGMEM = "</label>\n<input class='finp' type='number' id='port' name='port' value='1883' required aria-label='MQTT port'>\n</div>\n<div>\n<label class='flbl' for='user'>";
+const char WM_PK_MQTT_HTML_LT_5[] PROGMEM = "</label>\n<input class='finp' type='text' id='user' name='user' aria-label='MQTT username'>\n</div>\n<div>\n<label class='flbl' for='pwd'>";
+const char WM_PK_MQTT_HTML_LT_6[] PROGMEM = "</label>\n<div class='password-wrapper'>\n<input class='finp password-input' type='password' id='pwd' name='pwd' aria-label='MQTT Password'>\n<button type='button' class='toggle-password' id='toggle_pwd' data-target='pwd' aria-label='Toggle password visibility'>👁️</button>\n</div>\n</div>\n<div class='muted'>";
+constexpr decltype(WM_PK_WIFI_HTML_LT_10)& WM_PK_MQTT_HTML_LT_7 = WM_PK_WIFI_HTML_LT_10;
+constexpr decltype(WM_PK_WIFI_HTML_LT_11)& WM_PK_MQTT_HTML_LT_8 = WM_PK_WIFI_HTML_LT_11;
+constexpr decltype(WM_PK_WIFI_HTML_LT_12)& WM_PK_MQTT_HTML_LT_9 = WM_PK_WIFI_HTML_LT_12;
+const HTTPTemplatePart WM_PK_MQTT_HTML_LT_PARTS[] PROGMEM = {
+    { WM_PK_MQTT_HTML_LT_0, WM_STR_MQTT_CONFIGURATION },
+    { WM_PK_MQTT_HTML_LT_1, WM_STR_MQTT_CONFIGURATION },
+    { WM_PK_MQTT_HTML_LT_2, WM_STR_MQTT_HOST },
+    { WM_PK_MQTT_HTML_LT_3, WM_STR_MQTT_PORT },
+    { WM_PK_MQTT_HTML_LT_4, WM_STR_MQTT_USERNAME },
+    { WM_PK_MQTT_HTML_LT_5, WM_STR_MQTT_PASSWORD },
+    { WM_PK_MQTT_HTML_LT_6, WM_STR_MQTT_BROKER_HINT },
+    { WM_PK_MQTT_HTML_LT_7, WM_STR_MQTT_SAVE },
+    { WM_PK_MQTT_HTML_LT_8, WM_STR_GENERAL_BACK },
+    { WM_PK_MQTT_HTML_LT_9, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_MQTT_HTML_LT = { WM_PK_MQTT_HTML_LT_PARTS, ARRAY_LENGTH(WM_PK_MQTT_HTML_LT_PARTS) };
+const char WM_PK_MQTT_HTML_LT_ETAG[] PROGMEM = "15c35ebe49a6377c";
+#endif
+#endif
+
+// Entity tags (content hash) of the files above, used to answer conditional requests with 304 Not Modified.
+// Empty when the hash can't be computed at build time.
+const char WM_PK_UTILS_JS_ETAG[] PROGMEM = "a00f445d27b05b11";
+#if (LANGUAGE_LCID == 2057)
+const char WM_PK_OTA_JS_ETAG[] PROGMEM = "515fa2691e375f9a";
+#elif (LANGUAGE_LCID == 1051)
+const char WM_PK_OTA_JS_ETAG[] PROGMEM = "06146f2ab9a7d9d5";
+#else
+constexpr decltype(WM_PK_EMPTY_STR)& WM_PK_OTA_JS_ETAG = WM_PK_EMPTY_STR;
+#endif
+const char WM_PK_MODULE_POLYFILL_JS_ETAG[] PROGMEM = "20597c225bce0456";
+#if (LANGUAGE_LCID == 2057)
+const char WM_PK_RESTART_JS_ETAG[] PROGMEM = "61ce3e06f4b58773";
+#elif (LANGUAGE_LCID == 1051)
+const char WM_PK_RESTART_JS_ETAG[] PROGMEM = "d9bf804920126568";
+#else
+constexpr decltype(WM_PK_EMPTY_STR)& WM_PK_RESTART_JS_ETAG = WM_PK_EMPTY_STR;
+#endif
+const char WM_PK_HW_STATUS_JS_ETAG[] PROGMEM = "e72ff94e3694954f";
+const char WM_PK_JSTZ_JS_ETAG[] PROGMEM = "99b619b28ef38be7";
+#if (LANGUAGE_LCID == 2057)
+const char WM_PK_INDEX_HTML_ETAG[] PROGMEM = "af9d37cadcf94d9a";
+#elif (LANGUAGE_LCID == 1051)
+const char WM_PK_INDEX_HTML_ETAG[] PROGMEM = "05a72a3b3a967638";
+#else
+constexpr decltype(WM_PK_EMPTY_STR)& WM_PK_INDEX_HTML_ETAG = WM_PK_EMPTY_STR;
+#endif
+#ifdef WM_REMOTE_UPDATE
+#if (LANGUAGE_LCID == 2057)
+const char WM_PK_OTA_REMOTE_JS_ETAG[] PROGMEM = "d6e9d40346bf8fdb";
+#elif (LANGUAGE_LCID == 1051)
+const char WM_PK_OTA_REMOTE_JS_ETAG[] PROGMEM = "874d0f145f1b6371";
+#else
+constexpr decltype(WM_PK_EMPTY_STR)& WM_PK_OTA_REMOTE_JS_ETAG = WM_PK_EMPTY_STR;
+#endif
+#if (LANGUAGE_LCID == 2057)
+const char WM_PK_OTA_HTML_ETAG[] PROGMEM = "ce5ff97778cbe4da";
+#elif (LANGUAGE_LCID == 1051)
+const char WM_PK_OTA_HTML_ETAG[] PROGMEM = "d0e803c60c9a6f2f";
+#else
+constexpr decltype(WM_PK_EMPTY_STR)& WM_PK_OTA_HTML_ETAG = WM_PK_EMPTY_STR;
+#endif
+#else
+#if (LANGUAGE_LCID == 2057)
+const char WM_PK_OTA_HTML_ETAG[] PROGMEM = "746593a290c6cded";
+#elif (LANGUAGE_LCID == 1051)
+const char WM_PK_OTA_HTML_ETAG[] PROGMEM = "45a0e5dbedab5e1d";
+#else
+constexpr decltype(WM_PK_EMPTY_STR)& WM_PK_OTA_HTML_ETAG = WM_PK_EMPTY_STR;
+#endif
+#endif
+#if (LANGUAGE_LCID == 2057)
+const char WM_PK_INFO_HTML_ETAG[] PROGMEM = "bbe06f4e20cff6ce";
+#elif (LANGUAGE_LCID == 1051)
+const char WM_PK_INFO_HTML_ETAG[] PROGMEM = "bea439f372a1d7c0";
+#else
+constexpr decltype(WM_PK_EMPTY_STR)& WM_PK_INFO_HTML_ETAG = WM_PK_EMPTY_STR;
+#endif
+#if (LANGUAGE_LCID == 2057)
+const char WM_PK_WIFI_HTML_ETAG[] PROGMEM = "f7ff844b25f1134d";
+#elif (LANGUAGE_LCID == 1051)
+const char WM_PK_WIFI_HTML_ETAG[] PROGMEM = "27cda02b5bff59c5";
+#else
+constexpr decltype(WM_PK_EMPTY_STR)& WM_PK_WIFI_HTML_ETAG = WM_PK_EMPTY_STR;
+#endif
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+#if (LANGUAGE_LCID == 2057)
+const char WM_PK_MQTT_HTML_ETAG[] PROGMEM = "9ae3301c94265dae";
+#elif (LANGUAGE_LCID == 1051)
+const char WM_PK_MQTT_HTML_ETAG[] PROGMEM = "6234eb937f13d13a";
+#else
+constexpr decltype(WM_PK_EMPTY_STR)& WM_PK_MQTT_HTML_ETAG = WM_PK_EMPTY_STR;
+#endif
+#endif
+const char WM_PK_STYLE_CSS_ETAG[] PROGMEM = "21c992906551ee3e";
+
+
+// Static file routes served by handleStaticFileRequest(). The URL path hashed with
+// ESPAsync_WiFiManagerUtils::HashPath(path, WM_STATIC_ROUTES_SEED) >> WM_STATIC_ROUTES_SHIFT
+// selects the only slot that can hold it, one compare confirms the match.
+struct HTTPStaticRoute
+{
+    const char* pPath;  // URL path in program memory, nullptr for an empty slot
+    uint8_t file;       // WMStaticFile id
+    bool immutable;     // Fingerprinted name, the content behind it never changes
+};
+
+enum WMStaticFile : uint8_t
+{
+    WM_STATIC_FILE_NONE = 0,
+    WM_STATIC_FILE_OTA_HTML,
+    WM_STATIC_FILE_INFO_HTML,
+    WM_STATIC_FILE_INDEX_HTML,
+    WM_STATIC_FILE_WIFI_HTML,
+    WM_STATIC_FILE_MQTT_HTML,
+    WM_STATIC_FILE_STYLE_CSS,
+    WM_STATIC_FILE_OTA_JS,
+    WM_STATIC_FILE_UTILS_JS,
+    WM_STATIC_FILE_MODULE_POLYFILL_JS,
+    WM_STATIC_FILE_RESTART_JS,
+    WM_STATIC_FILE_HW_STATUS_JS,
+    WM_STATIC_FILE_APP_JS,
+    WM_STATIC_FILE_JSTZ_JS,
+    WM_STATIC_FILE_OTA_REMOTE_JS,
+    WM_STATIC_FILE_LANG_JS,
+    WM_STATIC_FILE_LANG_EN_JSON,
+    WM_STATIC_FILE_LANG_SK_JSON,
+};
+
+#if WM_LANGUAGE_TABLE
+const char WM_STATIC_ROUTES_PATH_OTA_HTML[] PROGMEM = "/ota";
+const char WM_STATIC_ROUTES_PATH_INFO_HTML[] PROGMEM = "/info";
+const char WM_STATIC_ROUTES_PATH_INDEX_HTML[] PROGMEM = "/index";
+const char WM_STATIC_ROUTES_PATH_WIFI_HTML[] PROGMEM = "/wifi";
+const char WM_STATIC_ROUTES_PATH_MQTT_HTML[] PROGMEM = "/mqtt";
+const char WM_STATIC_ROUTES_PATH_STYLE_CSS[] PROGMEM = "/style.css";
+const char WM_STATIC_ROUTES_PATH_STYLE_CSS_FP[] PROGMEM = "/style.c9c548e6.css";
+const char WM_STATIC_ROUTES_PATH_OTA_JS[] PROGMEM = "/ota.js";
+const char WM_STATIC_ROUTES_PATH_OTA_JS_FP[] PROGMEM = "/ota.14cce972.js";
+const char WM_STATIC_ROUTES_PATH_UTILS_JS[] PROGMEM = "/utils.js";
+const char WM_STATIC_ROUTES_PATH_UTILS_JS_FP[] PROGMEM = "/utils.f070d5e4.js";
+const char WM_STATIC_ROUTES_PATH_MODULE_POLYFILL_JS[] PROGMEM = "/module_polyfill.js";
+const char WM_STATIC_ROUTES_PATH_MODULE_POLYFILL_JS_FP[] PROGMEM = "/module_polyfill.51ea247b.js";
+const char WM_STATIC_ROUTES_PATH_RESTART_JS[] PROGMEM = "/restart.js";
+const char WM_STATIC_ROUTES_PATH_RESTART_JS_FP[] PROGMEM = "/restart.d11a9278.js";
+const char WM_STATIC_ROUTES_PATH_HW_STATUS_JS[] PROGMEM = "/hw-status.js";
+const char WM_STATIC_ROUTES_PATH_HW_STATUS_JS_FP[] PROGMEM = "/hw-status.3bc5e939.js";
+const char WM_STATIC_ROUTES_PATH_APP_JS[] PROGMEM = "/app.js";
+const char WM_STATIC_ROUTES_PATH_JSTZ_JS[] PROGMEM = "/jstz.js";
+const char WM_STATIC_ROUTES_PATH_JSTZ_JS_FP[] PROGMEM = "/jstz.7069864b.js";
+const char WM_STATIC_ROUTES_PATH_OTA_REMOTE_JS[] PROGMEM = "/ota-remote.js";
+const char WM_STATIC_ROUTES_PATH_OTA_REMOTE_JS_FP[] PROGMEM = "/ota-remote.eea67e0f.js";
+const char WM_STATIC_ROUTES_PATH_LANG_JS[] PROGMEM = "/lang.js";
+const char WM_STATIC_ROUTES_PATH_LANG_JS_FP[] PROGMEM = "/lang.20cef9d9.js";
+const char WM_STATIC_ROUTES_PATH_LANG_EN_JSON[] PROGMEM = "/lang/en.json";
+const char WM_STATIC_ROUTES_PATH_LANG_EN_JSON_FP[] PROGMEM = "/lang/en.ac201ea0.json";
+const char WM_STATIC_ROUTES_PATH_LANG_SK_JSON[] PROGMEM = "/lang/sk.json";
+const char WM_STATIC_ROUTES_PATH_LANG_SK_JSON_FP[] PROGMEM = "/lang/sk.21c914a1.json";
+
+const uint32_t WM_STATIC_ROUTES_SEED = 0x811c9e9d;
+const uint8_t WM_STATIC_ROUTES_SHIFT = 26;
+const HTTPStaticRoute WM_STATIC_ROUTES[] PROGMEM = {
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_MQTT_HTML, WM_STATIC_FILE_MQTT_HTML, false },
+    { WM_STATIC_ROUTES_PATH_MODULE_POLYFILL_JS_FP, WM_STATIC_FILE_MODULE_POLYFILL_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_MODULE_POLYFILL_JS, WM_STATIC_FILE_MODULE_POLYFILL_JS, false },
+    { WM_STATIC_ROUTES_PATH_LANG_SK_JSON_FP, WM_STATIC_FILE_LANG_SK_JSON, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_JSTZ_JS, WM_STATIC_FILE_JSTZ_JS, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_STYLE_CSS_FP, WM_STATIC_FILE_STYLE_CSS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_LANG_EN_JSON, WM_STATIC_FILE_LANG_EN_JSON, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_LANG_JS, WM_STATIC_FILE_LANG_JS, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_RESTART_JS_FP, WM_STATIC_FILE_RESTART_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_UTILS_JS, WM_STATIC_FILE_UTILS_JS, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_LANG_SK_JSON, WM_STATIC_FILE_LANG_SK_JSON, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_APP_JS, WM_STATIC_FILE_APP_JS, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_JSTZ_JS_FP, WM_STATIC_FILE_JSTZ_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_UTILS_JS_FP, WM_STATIC_FILE_UTILS_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_HW_STATUS_JS, WM_STATIC_FILE_HW_STATUS_JS, false },
+    { WM_STATIC_ROUTES_PATH_OTA_REMOTE_JS_FP, WM_STATIC_FILE_OTA_REMOTE_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_STYLE_CSS, WM_STATIC_FILE_STYLE_CSS, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_INFO_HTML, WM_STATIC_FILE_INFO_HTML, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_OTA_HTML, WM_STATIC_FILE_OTA_HTML, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_WIFI_HTML, WM_STATIC_FILE_WIFI_HTML, false },
+    { WM_STATIC_ROUTES_PATH_LANG_JS_FP, WM_STATIC_FILE_LANG_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_LANG_EN_JSON_FP, WM_STATIC_FILE_LANG_EN_JSON, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_RESTART_JS, WM_STATIC_FILE_RESTART_JS, false },
+    { WM_STATIC_ROUTES_PATH_OTA_REMOTE_JS, WM_STATIC_FILE_OTA_REMOTE_JS, false },
+    { WM_STATIC_ROUTES_PATH_OTA_JS, WM_STATIC_FILE_OTA_JS, false },
+    { WM_STATIC_ROUTES_PATH_OTA_JS_FP, WM_STATIC_FILE_OTA_JS, true },
+    { WM_STATIC_ROUTES_PATH_HW_STATUS_JS_FP, WM_STATIC_FILE_HW_STATUS_JS, true },
+    { WM_STATIC_ROUTES_PATH_INDEX_HTML, WM_STATIC_FILE_INDEX_HTML, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false }
+};
+#else
+const char WM_STATIC_ROUTES_PATH_OTA_HTML[] PROGMEM = "/ota";
+const char WM_STATIC_ROUTES_PATH_INFO_HTML[] PROGMEM = "/info";
+const char WM_STATIC_ROUTES_PATH_INDEX_HTML[] PROGMEM = "/index";
+const char WM_STATIC_ROUTES_PATH_WIFI_HTML[] PROGMEM = "/wifi";
+const char WM_STATIC_ROUTES_PATH_MQTT_HTML[] PROGMEM = "/mqtt";
+const char WM_STATIC_ROUTES_PATH_STYLE_CSS[] PROGMEM = "/style.css";
+const char WM_STATIC_ROUTES_PATH_STYLE_CSS_FP[] PROGMEM = "/style.c9c548e6.css";
+const char WM_STATIC_ROUTES_PATH_OTA_JS[] PROGMEM = "/ota.js";
+const char WM_STATIC_ROUTES_PATH_OTA_JS_FP[] PROGMEM = "/ota.cc5ed494.js";
+const char WM_STATIC_ROUTES_PATH_UTILS_JS[] PROGMEM = "/utils.js";
+const char WM_STATIC_ROUTES_PATH_UTILS_JS_FP[] PROGMEM = "/utils.f070d5e4.js";
+const char WM_STATIC_ROUTES_PATH_MODULE_POLYFILL_JS[] PROGMEM = "/module_polyfill.js";
+const char WM_STATIC_ROUTES_PATH_MODULE_POLYFILL_JS_FP[] PROGMEM = "/module_polyfill.51ea247b.js";
+const char WM_STATIC_ROUTES_PATH_RESTART_JS[] PROGMEM = "/restart.js";
+const char WM_STATIC_ROUTES_PATH_RESTART_JS_FP[] PROGMEM = "/restart.9232ccfc.js";
+const char WM_STATIC_ROUTES_PATH_HW_STATUS_JS[] PROGMEM = "/hw-status.js";
+const char WM_STATIC_ROUTES_PATH_HW_STATUS_JS_FP[] PROGMEM = "/hw-status.3bc5e939.js";
+const char WM_STATIC_ROUTES_PATH_APP_JS[] PROGMEM = "/app.js";
+const char WM_STATIC_ROUTES_PATH_JSTZ_JS[] PROGMEM = "/jstz.js";
+const char WM_STATIC_ROUTES_PATH_JSTZ_JS_FP[] PROGMEM = "/jstz.7069864b.js";
+const char WM_STATIC_ROUTES_PATH_OTA_REMOTE_JS[] PROGMEM = "/ota-remote.js";
+const char WM_STATIC_ROUTES_PATH_OTA_REMOTE_JS_FP[] PROGMEM = "/ota-remote.e05884bb.js";
+const char WM_STATIC_ROUTES_PATH_LANG_JS[] PROGMEM = "/lang.js";
+const char WM_STATIC_ROUTES_PATH_LANG_JS_FP[] PROGMEM = "/lang.20cef9d9.js";
+const char WM_STATIC_ROUTES_PATH_LANG_EN_JSON[] PROGMEM = "/lang/en.json";
+const char WM_STATIC_ROUTES_PATH_LANG_EN_JSON_FP[] PROGMEM = "/lang/en.ac201ea0.json";
+const char WM_STATIC_ROUTES_PATH_LANG_SK_JSON[] PROGMEM = "/lang/sk.json";
+const char WM_STATIC_ROUTES_PATH_LANG_SK_JSON_FP[] PROGMEM = "/lang/sk.21c914a1.json";
+
+const uint32_t WM_STATIC_ROUTES_SEED = 0x811ca590;
+const uint8_t WM_STATIC_ROUTES_SHIFT = 26;
+const HTTPStaticRoute WM_STATIC_ROUTES[] PROGMEM = {
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_INFO_HTML, WM_STATIC_FILE_INFO_HTML, false },
+    { WM_STATIC_ROUTES_PATH_LANG_SK_JSON_FP, WM_STATIC_FILE_LANG_SK_JSON, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_JSTZ_JS, WM_STATIC_FILE_JSTZ_JS, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_MODULE_POLYFILL_JS, WM_STATIC_FILE_MODULE_POLYFILL_JS, false },
+    { WM_STATIC_ROUTES_PATH_LANG_EN_JSON, WM_STATIC_FILE_LANG_EN_JSON, false },
+    { WM_STATIC_ROUTES_PATH_WIFI_HTML, WM_STATIC_FILE_WIFI_HTML, false },
+    { WM_STATIC_ROUTES_PATH_MQTT_HTML, WM_STATIC_FILE_MQTT_HTML, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_LANG_JS, WM_STATIC_FILE_LANG_JS, false },
+    { WM_STATIC_ROUTES_PATH_INDEX_HTML, WM_STATIC_FILE_INDEX_HTML, false },
+    { WM_STATIC_ROUTES_PATH_JSTZ_JS_FP, WM_STATIC_FILE_JSTZ_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_HW_STATUS_JS_FP, WM_STATIC_FILE_HW_STATUS_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_OTA_HTML, WM_STATIC_FILE_OTA_HTML, false },
+    { WM_STATIC_ROUTES_PATH_RESTART_JS, WM_STATIC_FILE_RESTART_JS, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_RESTART_JS_FP, WM_STATIC_FILE_RESTART_JS, true },
+    { WM_STATIC_ROUTES_PATH_LANG_SK_JSON, WM_STATIC_FILE_LANG_SK_JSON, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_APP_JS, WM_STATIC_FILE_APP_JS, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_MODULE_POLYFILL_JS_FP, WM_STATIC_FILE_MODULE_POLYFILL_JS, true },
+    { WM_STATIC_ROUTES_PATH_OTA_REMOTE_JS, WM_STATIC_FILE_OTA_REMOTE_JS, false },
+    { WM_STATIC_ROUTES_PATH_STYLE_CSS_FP, WM_STATIC_FILE_STYLE_CSS, true },
+    { WM_STATIC_ROUTES_PATH_LANG_JS_FP, WM_STATIC_FILE_LANG_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_UTILS_JS_FP, WM_STATIC_FILE_UTILS_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_HW_STATUS_JS, WM_STATIC_FILE_HW_STATUS_JS, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_OTA_REMOTE_JS_FP, WM_STATIC_FILE_OTA_REMOTE_JS, true },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_OTA_JS_FP, WM_STATIC_FILE_OTA_JS, true },
+    { WM_STATIC_ROUTES_PATH_LANG_EN_JSON_FP, WM_STATIC_FILE_LANG_EN_JSON, true },
+    { WM_STATIC_ROUTES_PATH_OTA_JS, WM_STATIC_FILE_OTA_JS, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { nullptr, WM_STATIC_FILE_NONE, false },
+    { WM_STATIC_ROUTES_PATH_STYLE_CSS, WM_STATIC_FILE_STYLE_CSS, false },
+    { WM_STATIC_ROUTES_PATH_UTILS_JS, WM_STATIC_FILE_UTILS_JS, false }
+};
+#endif
+
+
+const char WM_PK_HTTP_COMMON_SCRIPT[] PROGMEM = "<script>qs=s=>document.querySelector(s);gebi=s=>document.getElementById(s);wl=f=>window.addEventListener('load',f);\n</script>";
+const char WM_PK_HTTP_WM_SCRIPT[] PROGMEM = "<script>qs=s=>document.querySelector(s);gebi=s=>document.getElementById(s);wl=f=>window.addEventListener('load',f);function c(l){gebi('s').value=l.innerText||l.textContent;gebi('p').focus();gebi('s1').value=l.innerText||l.textContent;gebi('p1').focus();gebi('timezone').value=timezone.name();}\n</script>";
+const char WM_PK_HTTP_JSTZ_SCRIPT[] PROGMEM = "<script src='jstz.7069864b.js'></script>\n";
 const char WM_PK_HTTP_OTA_SCRIPT[] PROGMEM = "<script type=\"module\" crossorigin>%OTA_SCRIPT%</script>";
-const char WM_PK_HTTP_STYLE[] PROGMEM = "fieldset,input,select{\nfont-size:1rem;\n}\n\ndiv{\npadding:2px;\nfont-size:1em;\n}\n\np{\nmargin:0.5em 0;\n}\n\ninput{\nwidth:100%;\nbox-sizing:border-box;\n-webkit-box-sizing:border-box;\n-moz-box-sizing:border-box;\n\nborder-radius:0.4rem;\nborder-width: 2px;\nborder-color: #48c;\n\nbackground:#fff;\ncolor:#000;\npadding: 0.5rem 0.7rem 0.5rem 0.7rem;\nmargin: 2px 2px 10px 2px;\n}\n\nlabel{\nmargin: 2px;\n}\n\ninput[type=checkbox],input[type=radio]{\nwidth:1em;\nmargin-right:6px;\nvertical-align:-1px;\n}\n\ninput[type=range]{\nwidth:99%;\n}\n\nselect{\nwidth:100%;\nbackground:#dddddd;\ncolor:#000000;\n}\n\ntextarea{\nresize:vertical;\nwidth:98%;\nheight:1.6em; /* 318px; */\npadding:5px;\noverflow:auto;\nbackground:#1f1f1f;\ncolor:#65c115;\n}\n\nbody{\ntext-align:center;\nfont-family:verdana,sans-serif;\nbackground:#fff;\n}\n\ntd{\npadding:0px;\n}\n\n.btn{\nborder-radius:0.4rem;\nborder-width: 2px;\nborder-color: #48c;\nbackground: #49d;\ncolor:#fff;\n/* line-height:1.6rem; */\nfont-size:1.5rem;\ncursor:pointer;\nmargin: 2px;\npadding: 0.5rem 0.7rem 0.5rem 0.7rem;\nwidth: 100%;\n-webkit-transition-duration:0.5s;\ntransition-duration:0.5s;\n}\n\n.btn:hover{\nbackground: #6bf;\nborder-color: #49d;\n/*color:#090246;*/\ncolor:rgb(254 199 28)\n}\n\n.btn:active,.btn:focus{\nbackground: #48b\n}\n\n.btn:disabled{\nborder-color: #aaa;\nbackground: #ccc;\ncolor:#eee\n}\n\n.table{\nwidth: 100%\n}\n.table td{\npadding:.5em;\ntext-align:left\n}\n.table th{\npadding:.5em;\ntext-align:left\n}\n.table tbody>:nth-child(2n-1){\nbackground:#6bf\n}\n\n.inpgrp{\npadding: 0rem 0rem 0rem 1rem;\n}\n\n.bred{\nbackground:#d43535;\n}\n\n.bred:hover{\nbackground:#931f1f;\n}\n\n.bgrn{\nbackground:#47c266;\n}\n\n.bgrn:hover{\nbackground:#5aaf6f;\n}\n\na{\ncolor:#1fa3ec;\ntext-decoration:none;\n}\n\n.msg{\nbackground: #def;\nborder-left: 5px solid #59d;\npadding: 1.5em;\nmargin: 1rem 0rem 0rem 0rem;\n}\n\n.p{\nfloat:left;\ntext-align:left;\n}\n\n.q{\nfloat:right;\ntext-align:right;\n}\n\n.r{\nborder-radius:0.3em;\npadding:2px;\nmargin:6px 2px;\n}\n\n.hf{\ndisplay:none;\n}\n\n/* from Tasmota html */\n.container{\ntext-align:left;\ndisplay:inline-block;\nmin-width:300px;\n}\n\n.block{\ndisplay: block;\n}\n\n/* from WifiManager */\nfieldset{\n/* border-radius:0.5rem; */\nborder-width: 3px;\nbackground-color: #def;\nmargin:0px;\n}\n\nh1{\nfont-size: 2.5rem;\ntext-align:center;\n}\n\nh2{\nfont-size: 2rem;\ntext-align:center\n}\n\n.flex{\ndisplay:flex\n}\n.flex-col{\nflex-direction:column;\nwidth: 100%\n}\n.hidden{\ndisplay:none\n}\n.items-center{\nalign-items:center\n}\n.gap-4{\ngap:1rem\n}\n.mb-2{\nmargin-bottom:.5rem\n}\n.mb-10{\nmargin-bottom:2.5rem\n}\n.mt-12{\nmargin-top:3rem\n}\n.mt-14{\nmargin-top:3.5rem\n}\n.text-green-500{\n--tw-text-opacity: 1;\ncolor:rgb(34 197 94 / var(--tw-text-opacity))\n}\n.text-red-500{\n--tw-text-opacity: 1;\ncolor:rgb(239 68 68 / var(--tw-text-opacity))\n}\n.text-yellow-500{\n--tw-text-opacity: 1;\ncolor:rgb(234 179 8 / var(--tw-text-opacity))\n}\n.text-center{\ntext-align:center\n}\n.text-sm{\nfont-size:1.25rem;\nline-height:1.5rem\n}\n.text-xs{\nfont-size:1rem;\nline-height:1.25rem\n}\n.font-medium{\nfont-weight:500\n}\n.uppercase{\ntext-transform:uppercase\n}\n";
+const char WM_PK_HTTP_STYLE[] PROGMEM = "fieldset,input,select{font-size:1rem}div{padding:2px;font-size:1em}p{margin:0.5em 0}input{width:100%;box-sizing:border-box;-webkit-box-sizing:border-box;-moz-box-sizing:border-box;border-radius:0.4rem;border-width:2px;border-color:#48c;background:#fff;color:#000;padding:0.5rem 0.7rem 0.5rem 0.7rem;margin:2px 2px 10px 2px}label{margin:2px}input[type=checkbox],input[type=radio]{width:1em;margin-right:6px;vertical-align:-1px}input[type=range]{width:99%}select{width:100%;background:#dddddd;color:#000000}textarea{resize:vertical;width:98%;height:1.6em;padding:5px;overflow:auto;background:#1f1f1f;color:#65c115}body{text-align:center;font-family:verdana,sans-serif;background:#fff}td{padding:0px}.btn{border-radius:0.4rem;border-width:2px;border-color:#48c;background:#49d;color:#fff;font-size:1.5rem;cursor:pointer;margin:2px;padding:0.5rem 0.7rem 0.5rem 0.7rem;width:100%;-webkit-transition-duration:0.5s;transition-duration:0.5s}.btn:hover{background:#6bf;border-color:#49d;color:rgb(254 199 28)}.btn:active,.btn:focus{background:#48b}.btn:disabled{border-color:#aaa;background:#ccc;color:#eee}.table{width:100%}.table td{padding:.5em;text-align:left}.table th{padding:.5em;text-align:left}.table tbody>:nth-child(2n-1){background:#6bf}.inpgrp{padding:0rem 0rem 0rem 1rem}.bred{background:#d43535}.bred:hover{background:#931f1f}.bgrn{background:#47c266}.bgrn:hover{background:#5aaf6f}a{color:#1fa3ec;text-decoration:none}.msg{background:#def;border-left:5px solid #59d;padding:1.5em;margin:1rem 0rem 0rem 0rem}.p{float:left;text-align:left}.q{float:right;text-align:right}.r{border-radius:0.3em;padding:2px;margin:6px 2px}.hf{display:none}.container{text-align:left;display:inline-block;min-width:300px}.block{display:block}fieldset{border-width:3px;background-color:#def;margin:0px}h1{font-size:2.5rem;text-align:center}h2{font-size:2rem;text-align:center}.flex{display:flex}.flex-col{flex-direction:column;width:100%}.hidden{display:none}.items-center{align-items:center}.gap-4{gap:1rem}.mb-2{margin-bottom:.5rem}.mb-10{margin-bottom:2.5rem}.mt-12{margin-top:3rem}.mt-14{margin-top:3.5rem}.text-green-500{--tw-text-opacity:1;color:rgb(34 197 94 / var(--tw-text-opacity))}.text-red-500{--tw-text-opacity:1;color:rgb(239 68 68 / var(--tw-text-opacity))}.text-yellow-500{--tw-text-opacity:1;color:rgb(234 179 8 / var(--tw-text-opacity))}.text-center{text-align:center}.text-sm{font-size:1.25rem;line-height:1.5rem}.text-xs{font-size:1rem;line-height:1.25rem}.font-medium{font-weight:500}.uppercase{text-transform:uppercase}\n";
 const char WM_PK_HTTP_OPTIONS_MSG[] PROGMEM = L_GENERAL_OPTIONS;
 const char WM_PK_HTTP_SETTINGS_MSG[] PROGMEM = L_GENERAL_SETTINGS;
 const char WM_PK_HTTP_CLOSE_SERVER_MSG[] PROGMEM = L_CLOSE_SERVER;
@@ -85,7 +4648,6 @@ const char WM_PK_HTTP_INFO_MSG[] PROGMEM = L_INFO;
 const char WM_PK_HTTP_RESETTING_MSG[] PROGMEM = L_RESETTING;
 const char WM_PK_HTTP_FIRMWARE_UPDATE_MSG[] PROGMEM = L_OTA_FIRMWARE_UPDATE;
 const char WM_PK_HTTP_MESSAGE[] PROGMEM = "<div class=\"msg\">%{msg}%</div>";
-const char WM_PK_HTTP_NETWORK_INFO[] PROGMEM = "%NETWORK_INFO%";
 const char WM_PK_HTTP_FLDSET_START[] PROGMEM = "<fieldset>";
 const char WM_PK_HTTP_FLDSET_END[] PROGMEM = "</fieldset>";
 const char WM_PK_HTTP_OTA_UPDATE[] PROGMEM = "%OTA_UPDATE%";
@@ -94,9 +4656,9 @@ const char WM_PK_HTTP_OTA_UPDATE[] PROGMEM = "%OTA_UPDATE%";
 #endif
 #ifdef WM_SUPPORT_TRAIN_CONTROL
     const char WM_PK_HTTP_TRAIN_CONTROL_OPTION[] PROGMEM = "<form action='/tcontrol' method='get'>\n<button class='btn'>Train Control</button>\n</form>\n";
-    const char WM_PK_HTTP_TRAIN_CONTROL[] PROGMEM = "<div id='top'></div>\n<div id='middle' class='train-dashboard'>\n<div class='vert-slider-item pwr-item'>\n<label>100%</label>\n<input type='range' orient='vertical' min='0' max='100' value='0' step='0.5' id='pwr-slider' onchange='cmd()' oninput='updGauge()'/>\n<label>0%</label>\n<label>" L_TC_POWER "</label>\n</div>\n<div class='item2'>\n<select class='cab' name='cab' id='cab' onchange='toggleCab(this)'>\n<option value='cab1'>" L_TC_CAB1 "</option>\n<option value='cab2'>" L_TC_CAB2 "</option>\n</select>\n</div>\n<div class='item3'>3</div>\n<div class='ggauge A'>\n<canvas class='gauge' id='gauge'></canvas>\n</div>\n<div class='vert-slider-item dir-item'>\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='lucide lucide-arrow-left'><path d='M 5,12 L 12,4 L 19,12 M 12,4 V 20'/></svg>\n<input type='range' orient='vertical' min='0' max='1' value='1' step='1' id='dir-slider' onchange='changeDir()'/>\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='lucide lucide-arrow-left'><path d='M 5,12 L 12,20 L 19,12 M 12,4 V 20'/></svg>\n<label>" L_TC_DIRECTION "</label>\n</div>\n<div class='item6'><button class='stopBtn' onclick='stop()'>" L_TC_EMERGENCY_STOP "</button></div>\n<!-- <div class='item7'>7</div>\nsee: https://webdesign.tutsplus.com/21-ridiculously-impressive-html5-canvas-experiments--net-14210a\n-->\n</div>\n<div id='bottom'></div>\n";
-    const char WM_PK_HTTP_PWMCTRL_SCRIPT[] PROGMEM = "<script>var xcmd=null,tmid1,tmid2,tmid3,isMoving=false;\nvar gauge = null;\nfunction cmd(p)\n{\nclearTimeout(tmid1);\nclearTimeout(tmid2);\na=p||'';\nif(xcmd!=null)\n{\nxcmd.abort()\n}\nvar pwr=gebi('pwr-slider').value;\nif(gauge)\n{\ngauge.setTargetValue(pwr);\n//gauge.setCurrentValue(pwr);\n}\n\nxcmd=new XMLHttpRequest();\nxcmd.onreadystatechange=()=>\n{\nif(xcmd.readyState==4&&xcmd.status==200)\n{\nclearTimeout(tmid1);\nclearTimeout(tmid2);\n\nvar s=xcmd.responseText;\nvar res=JSON.parse(s);\nvar still=(res['pwr_current']===0)?true:false;\ngebi('pwr-value').innerHTML=s;\nif (still === isMoving)\n{\nisMoving = !still;\ndisableCtrls(!still);\n}\n\ntmid2=setTimeout(cmd,2000);\n}\n};\n//xcmd.responseType = 'json';\nxcmd.open('GET','/tcontrol?pwr='+pwr+a,true);\nxcmd.send();\ntmid1=setTimeout(cmd,5000);\n}\n\nfunction changeDir()\n{\ncmd('&dir='+gebi('dir-slider').value);\n}\n\nfunction toggleCab(el)\n{\nvar value = el.options[el.selectedIndex].value;\nvar cab=(value==='cab1')?'0':'1';\ncmd('&cab='+cab);\n}\n\nfunction disableCtrls(val)\n{\ngebi('dir-slider').disabled=val;\ngebi('cab').disabled=val;\n}\n\nfunction updGauge()\n{\nvar pwr=gebi('pwr-slider').value;\nif(gauge)\ngauge.setTargetValue(pwr);\n}\n\nfunction updCurrentPower()\n{\nclearTimeout(tmid3);\n\nvar dpwr = 0.125;\nvar diff = gauge.tv - gauge.cv;\nvar delta = 0;\nif (diff > 0)\n{\ndelta=Math.min(dpwr, diff);\ngauge.setCurrentValue(gauge.cv+delta);\n}\nelse if (diff < 0)\n{\ndelta=Math.max(-3*dpwr, diff);\ngauge.setCurrentValue(gauge.cv+delta);\n}\ntmid3=setTimeout(updCurrentPower,25);\n}\n\n//\n\nclass GaugeClassic\n{\nconstructor(canvas)\n{\nthis.opts={};\nthis.cvs=canvas;\n\nthis.cvs.style.width ='100%';\nthis.cvs.style.height ='100%';\nthis.minv=0;\nthis.maxv=100;\nthis.tv=this.cv=this.minv;\nthis.smallStep=2;\nthis.bigStep=10;\nthis.stAng=-20;\nthis.rangeAng=220;\nthis.resize();\n}\n\nresize()\n{\nthis.w = this.cvs.width = this.cvs.offsetWidth;\nthis.h = this.cvs.height = this.cvs.offsetHeight;\n}\n\ndraw()\n{\nvar ctx=this.cvs.getContext('2d');\nctx.save();\nvar sz = Math.min(this.w,this.h);\nvar ofs=15;\nctx.clearRect(ofs, ofs, this.w-2*ofs, this.h-2*ofs);\n\n// h=57+textHeight/2 + 57*sin(this.toRad(-this.stAng))+textHeight/2\n// w=2*(57+textWidth/2)\n/*\nctx.save();\nctx.shadowBlur = ofs;\nctx.shadowColor = '#555';\nctx.fillStyle = '#555';\nctx.fillRect(ofs, ofs, this.w-2*ofs, this.h-2*ofs);\nctx.restore();\n*/\n\nvar sc = sz/120.0;\nctx.translate(this.w/2.0, this.h*2.0/3.0);\nctx.scale(sc, sc);\n\nctx.strokeStyle = 'black';\nctx.fillStyle = 'white';\nctx.lineWidth = 1;\nctx.lineCap = 'round';\n/*\nctx.beginPath();\nctx.arc(0, 0, 50, 0, Math.PI * 2, true);\nctx.stroke();\n*/\n// draw\nctx.save();\nctx.lineWidth = 0.8;\nthis.drawScale(ctx, this.smallStep, 48, 45)\nctx.restore();\n\nctx.save();\nctx.lineWidth = 1.3;\nthis.drawScale(ctx, this.bigStep, 48, 42)\nctx.restore();\n\nctx.save();\nctx.font = '5 serif';\nctx.textAlign='center';\nctx.textBaseline='middle';\nctx.fillStyle = 'black';\nthis.drawTextScale(ctx, this.bigStep, 57)\nctx.restore();\n\nctx.save();\nthis.drawWheel(ctx, this.tv);\nctx.restore();\n\n// draw hand shadow\nctx.save();\nctx.lineJoin = 'miter';\nctx.lineWidth = 1;\nctx.fillStyle = '#666';\nctx.strokeStyle = '#666';\nctx.filter = 'blur(3px)';\nctx.translate(-1,-1);\nthis.drawTextHand(ctx, 49, this.cv);\nctx.restore();\n\n// draw hand\nctx.save();\nctx.lineJoin = 'miter';\nctx.lineWidth = 1;\nctx.fillStyle = 'red';\nctx.strokeStyle = 'red';\nthis.drawTextHand(ctx, 49, this.cv);\nctx.restore();\n\nctx.save();\nctx.fillStyle='gold';\nctx.beginPath();\nctx.arc(0, 0, 1.3, 0, Math.PI * 2, true);\nctx.fill();\nctx.restore();\n\nctx.restore();\n}\n\ndrawScale(ctx, step, r1, r2)\n{\nctx.rotate(this.toRad(this.stAng));\nvar angStep=this.toRad(this.rangeAng*step/(this.maxv-this.minv));\nfor (let v = this.minv; v <= this.maxv; v+=step) {\nctx.beginPath();\nctx.moveTo(-r1, 0);\nctx.lineTo(-r2, 0);\nctx.closePath();\nctx.stroke();\nctx.rotate(angStep);\n}\n}\n\ndrawTextScale(ctx, step, r)\n{\nvar angStep=this.toRad(this.rangeAng*step/(this.maxv-this.minv));\nvar angRad = this.toRad(this.stAng);\nfor (let v = this.minv; v <= this.maxv; v+=step, angRad+=angStep) {\nvar x = -Math.cos(angRad)*r;\nvar y = -Math.sin(angRad)*r;\nvar s = Math.round(v).toString();\nctx.fillText(s,x,y);\n}\n}\n\ndrawTextHand(ctx, r, v)\n{\nvar angRad=this.toRad(this.stAng+this.rangeAng*v/(this.maxv-this.minv));\nvar r1=3;\nvar r2=8;\nctx.rotate(angRad);\nctx.beginPath();\nvar prevLW = ctx.lineWidth;\nctx.lineWidth = prevLW*2;\nctx.arc(0, 0, r1, 0, Math.PI * 2, true);\nctx.stroke();\nctx.lineWidth = prevLW;\n\nctx.beginPath();\nctx.moveTo(-r1, -r1/2.0);\nctx.lineTo(-r, 0);\nctx.lineTo(-r1, r1/2.0);\nctx.closePath();\n//ctx.stroke();\nctx.fill();\n\nctx.beginPath();\nctx.moveTo(r1, -r1/2.0);\nctx.lineTo(r2, -r1/2.0);\nctx.lineTo(r2, r1/2.0);\nctx.lineTo(r1, r1/2.0);\nctx.closePath();\n//ctx.stroke();\nctx.fill();\n}\n\ndrawWheel(ctx,v)\n{\nvar stAng=Math.PI+this.toRad(this.stAng);\nvar enAng=Math.PI+this.toRad(this.stAng+this.rangeAng);\nctx.beginPath();\nctx.strokeStyle = '#555';\nctx.lineWidth = 6;\nctx.shadowBlur = 10;\nctx.shadowColor = '#555';\nctx.arc(0, 0, 35, stAng, enAng, false);\nctx.stroke();\n\nctx.beginPath();\nctx.strokeStyle = '#66e';\nctx.lineWidth = 4;\nctx.shadowBlur = 6;\nctx.shadowColor = '#d6d';\n//stAng=Math.PI+this.toRad(this.stAng);\nenAng=Math.PI+this.toRad(this.stAng+this.rangeAng*v/(this.maxv-this.minv));\nctx.beginPath();\nctx.arc(0, 0, 35, stAng, enAng, false);\nctx.stroke();\n\n}\n\ntoRad(deg)\n{\nreturn Math.PI*deg/180.0;\n}\n\nsetTargetValue(v)\n{\nif (v < this.minv)\nthis.tv=this.minv;\nelse if (v > this.maxv)\nthis.tv=this.maxv;\nelse\nthis.tv=v;\n}\n\nsetCurrentValue(v)\n{\nif (v < this.minv)\nthis.cv=this.minv;\nelse if (v > this.maxv)\nthis.cv=this.maxv;\nelse\nthis.cv=v;\n}\n\n}\n\nfunction init()\n{\ngauge = new GaugeClassic(gebi('gauge'));\nwindow.requestAnimationFrame( loop );\nupdCurrentPower();\n}\n\nfunction loop()\n{\ngauge.draw();\nwindow.requestAnimationFrame( loop );\n}\n\nfunction stop()\n{\ngebi('confirmDlg').style.display = 'block';\n}\n\nwindow.addEventListener('resize', function(){\ngauge.resize();\n});\n\nwl(init);\nwl(cmd);\n</script>";
-    const char WM_PK_HTTP_TRAIN_STYLE[] PROGMEM = "html,body {\nheight:100%;\nmargin:0;\npadding:0;\nfont-family:verdana,sans-serif;\nbackground:#fff;\ntext-align:center;\n}\n\n.stopBtn{\nborder-radius:0.4rem;\nborder-width: 2px;\nborder-color: rgb(111, 22, 25);\nbackground: rgb(216, 42, 48);\ncolor:#fff;\n/* line-height:1.6rem; */\nfont-size:1.5rem;\ncursor:pointer;\nmargin: 0;\npadding: 0.5rem 0.7rem 0.5rem 0.7rem;\nwidth: 100%;\n-webkit-transition-duration:0.5s;\ntransition-duration:0.5s;\n}\n\n.stopBtn:hover{\nbackground: rgb(249, 49, 55);\nborder-color: rgb(216, 42, 48);\n/*color:#090246;*/\ncolor:rgb(254 199 28)\n}\n\n.stopBtn:active,.btn:focus{\nbackground: #48b\n}\n\n.cab{\nborder-radius:0.4rem;\nborder-width: 2px;\nborder-color: rgb(67, 115, 166);\nbackground: rgb(117, 178, 244);\ncolor:#fff;\n/* line-height:1.6rem; */\nfont-size:1.5rem;\ncursor:pointer;\nmargin: 0;\npadding: 0.5rem 0.7rem 0.5rem 0.7rem;\nwidth: 100%;\n-webkit-transition-duration:0.5s;\ntransition-duration:0.5s;\n}\n\n.cab:disabled{\nbackground:#ccc;\n}\n\n.inpgrp{\npadding: 0rem 0rem 0rem 1rem;\n}\n\na{\ncolor:#1fa3ec;\ntext-decoration:none;\n}\n\n.msg{\nbackground: #def;\nborder-left: 5px solid #59d;\npadding: 1.5em;\nmargin: 1rem 0rem 0rem 0rem;\n}\n\n.p{\nfloat:left;\ntext-align:left;\n}\n\n.q{\nfloat:right;\ntext-align:right;\n}\n\n.r{\nborder-radius:0.3em;\npadding:2px;\nmargin:6px 2px;\n}\n\n.hf{\ndisplay:none;\n}\n\n.block{\ndisplay: block;\n}\n\n/* from WifiManager */\nfieldset{\n/* border-radius:0.5rem; */\nborder-width: 3px;\nbackground-color: #def;\nmargin:0px;\n}\n\n/*\nGrid\n*/\n.train-dashboard {\ntop:10%;\nbottom:10%;\n/*left:25%;*/\n/*width:50%;*/\naspect-ratio: 2/3;\ndisplay:grid;\ngrid-template-columns:10% 80% 10%;\ngrid-template-rows:15% 70% 15%;\ngap:0;\nalign-items:stretch;\nmargin: auto;\n}\n\n.train-dashboard > div {\nbackground-color:#fff;\ntext-align:center;\nfont-size:1rem;\n}\n\n.pwr-item {\ngrid-row-start: 1;\ngrid-row-end: 4;\n}\n\n.pwr-item > input[type=range]{\nheight: 80%;\n}\n\n.dir-item > input[type=range]{\nheight: 20%;\n}\n\n.vert-slider-item > label{\nwidth: 100%;\ndisplay: block;\npadding: 0.5rem 0;\n}\n\n.vert-slider-item > svg{\nwidth: 100%;\ndisplay: block;\npadding: 0.5rem 0;\nborder: 0;\n}\n\n/*\n.dir-item {\ngrid-row-start: 2;\ngrid-row-end: 3;\n}\n*/\n\n.power-gauge-item {\nwidth: 30rem;\n}\n\n/*\ninput range styling: https://css-tricks.com/styling-cross-browser-compatible-range-inputs-css/\n*/\n\n.vert-slider-item > input[type=range] {\n-webkit-appearance: none;\nmargin: 0 8px;\n\nwriting-mode: vertical-lr;\ndirection: rtl;\nwidth: 2rem;\nvertical-align: bottom;\n}\n\n.vert-slider-item > input[type=range]:focus {\noutline: none;\n}\n\n.vert-slider-item > input[type=range]:focus {\noutline: none;\n}\n\n.vert-slider-item > input[type=range]::-webkit-slider-runnable-track {\nwidth: 1rem;\ncursor: pointer;\nbox-shadow: 1px 1px 1px #000000, 0px 0px 1px #0d0d0d;\nbackground: #eee;\nborder-radius: 1.3px;\nborder: 0.2px solid #010101;\n}\n\n.vert-slider-item > input[type=range]::-webkit-slider-thumb {\nborder: 1px solid #000000;\n-webkit-appearance: none;\nbox-shadow: 1px 1px 1px #48c, 0px 0px 1px #0d0d0d;\nheight: 2rem;\nwidth: 3rem;\nborder-radius: 3px;\nbackground: #49d;\ncursor: pointer;\n-webkit-appearance: none;\nmargin-left: -18px;\n}\n\n.vert-slider-item > input[type=range]:focus::-webkit-slider-thumb {\nbackground: #38c;\n}\n\n.vert-slider-item > input[type=range]:disabled::-webkit-slider-thumb {\nbox-shadow: 1px 1px 1px #48c, 0px 0px 1px #080808;\nbackground: #ccc;\n}\n\n.vert-slider-item > input[type=range]:focus::-webkit-slider-runnable-track {\nbackground: #ccc;\n}\n\n/*\ninput[type=range] {\n-webkit-appearance: none;\nmargin: 18px 0;\nwidth: 100%;\n}\ninput[type=range]:focus {\noutline: none;\n}\n\ninput[type=range]::-webkit-slider-runnable-track {\nwidth: 100%;\nheight: 8.4px;\ncursor: pointer;\nbox-shadow: 1px 1px 1px #000000, 0px 0px 1px #0d0d0d;\nbackground: #eee;\nborder-radius: 1.3px;\nborder: 0.2px solid #010101;\n}\n\ninput[type=range]::-webkit-slider-thumb {\nbox-shadow: 1px 1px 1px #48c, 0px 0px 1px #0d0d0d;\nborder: 1px solid #000000;\nheight: 36px;\nwidth: 16px;\nborder-radius: 3px;\nbackground: #49d;\ncursor: pointer;\n-webkit-appearance: none;\nmargin-top: -14px;\n}\n\ninput[type=range]:focus::-webkit-slider-runnable-track {\nbackground: #ccc;\n}\ninput[type=range]::-moz-range-track {\nwidth: 100%;\nheight: 8.4px;\ncursor: pointer;\nbox-shadow: 1px 1px 1px #000000, 0px 0px 1px #0d0d0d;\nbackground: #3071a9;\nborder-radius: 1.3px;\nborder: 0.2px solid #010101;\n}\ninput[type=range]::-moz-range-thumb {\nbox-shadow: 1px 1px 1px #000000, 0px 0px 1px #0d0d0d;\nborder: 1px solid #000000;\nheight: 36px;\nwidth: 16px;\nborder-radius: 3px;\nbackground: #ffffff;\ncursor: pointer;\n}\ninput[type=range]::-ms-track {\nwidth: 100%;\nheight: 8.4px;\ncursor: pointer;\nbackground: transparent;\nborder-color: transparent;\nborder-width: 16px 0;\ncolor: transparent;\n}\ninput[type=range]::-ms-fill-lower {\nbackground: #2a6495;\nborder: 0.2px solid #010101;\nborder-radius: 2.6px;\nbox-shadow: 1px 1px 1px #000000, 0px 0px 1px #0d0d0d;\n}\ninput[type=range]::-ms-fill-upper {\nbackground: #3071a9;\nborder: 0.2px solid #010101;\nborder-radius: 2.6px;\nbox-shadow: 1px 1px 1px #000000, 0px 0px 1px #0d0d0d;\n}\ninput[type=range]::-ms-thumb {\nbox-shadow: 1px 1px 1px #000000, 0px 0px 1px #0d0d0d;\nborder: 1px solid #000000;\nheight: 36px;\nwidth: 16px;\nborder-radius: 3px;\nbackground: #ffffff;\ncursor: pointer;\n}\ninput[type=range]:focus::-ms-fill-lower {\nbackground: #3071a9;\n}\ninput[type=range]:focus::-ms-fill-upper {\nbackground: #367ebd;\n}\n*/\n\n/*\ngauge\n*/\n.gauge {\n/*\nposition: relative;\nmargin: 100px auto 50px auto;\n*/\nheight: 300px;\nwidth: auto;\n}\n\n/*SVG*/\n\nsvg {\nmargin: 0px;\npadding: 0;\ncursor: pointer;\nborder: 1px solid #0a1a17;\n}\n\nsvg.focusable {\nborder: 1px solid #0f4534;\n}\n\n/*\ntext {\ntext-anchor: middle;\ndominant-baseline: alphabetic;\nfont: 12px verdana, sans-serif;\nfill: #aaa;\n}\n*/\nhtml,body{\nheight:100%;\nmargin:0;\npadding:0;\n}\n.container{\nheight:100%;\n/*min-width: 300px;*/\nposition:relative;\npadding: 0;\nmargin: auto;\n}\n\n#top, #middle, #bottom{\nposition:absolute;\nwidth: 100%;\n}\n\n#top{\nheight:8%;\nwidth:100%;\nbackground:grey;\n}\n#bottom{\nbottom:0;\nheight:8%;\nwidth:100%;\nbackground:grey;\n}\n\n.modal {\ndisplay: none;\n/* Hidden by default */\nposition: fixed;\n/* Stay in place */\nz-index: 1;\n/* Sit on top */\npadding-top: 100px;\n/* Location of the box */\nleft: 0;\ntop: 0;\nwidth: 100%;\n/* Full width */\nheight: 100%;\n/* Full height */\noverflow: auto;\n/* Enable scroll if needed */\nbackground-color: rgb(0, 0, 0);\n/* Fallback color */\nbackground-color: rgba(0, 0, 0, 0.4);\n/* Black w/ opacity */\n}\n\n.modal-content {\nbackground-color: #fefefe;\nmargin: auto;\npadding: 20px;\nborder: 1px solid #888;\nwidth: 80%;\n}\n\n.close {\ncolor: #aaaaaa;\nfloat: right;\nfont-size: 28px;\nfont-weight: bold;\n}\n\n.close:hover,\n.close:focus {\ncolor: #000;\ntext-decoration: none;\ncursor: pointer;\n}\n";
+    const char WM_PK_HTTP_TRAIN_CONTROL[] PROGMEM = "<div id='top'></div>\n<div id='middle' class='train-dashboard'>\n<div class='vert-slider-item pwr-item'>\n<label>100%</label>\n<input type='range' orient='vertical' min='0' max='100' value='0' step='0.5' id='pwr-slider' onchange='cmd()' oninput='updGauge()'/>\n<label>0%</label>\n<label>" L_TC_POWER "</label>\n</div>\n<div class='item2'>\n<select class='cab' name='cab' id='cab' onchange='toggleCab(this)'>\n<option value='cab1'>" L_TC_CAB1 "</option>\n<option value='cab2'>" L_TC_CAB2 "</option>\n</select>\n</div>\n<div class='item3'>3</div>\n<div class='ggauge A'>\n<canvas class='gauge' id='gauge'></canvas>\n</div>\n<div class='vert-slider-item dir-item'>\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='lucide lucide-arrow-left'><path d='M 5,12 L 12,4 L 19,12 M 12,4 V 20'/></svg>\n<input type='range' orient='vertical' min='0' max='1' value='1' step='1' id='dir-slider' onchange='changeDir()'/>\n<svg xmlns='http://www.w3.org/2000/svg' width='42' height='42' viewBox='0 0 24 24' fill='none' stroke='currentColor' stroke-width='2' stroke-linecap='round' stroke-linejoin='round' class='lucide lucide-arrow-left'><path d='M 5,12 L 12,20 L 19,12 M 12,4 V 20'/></svg>\n<label>" L_TC_DIRECTION "</label>\n</div>\n<div class='item6'><button class='stopBtn' onclick='stop()'>" L_TC_EMERGENCY_STOP "</button></div>\n\n</div>\n<div id='bottom'></div>\n";
+    const char WM_PK_HTTP_PWMCTRL_SCRIPT[] PROGMEM = "<script>var xcmd=null,tmid1,tmid2,tmid3,isMoving=false;var gauge=null;function cmd(p)\n{clearTimeout(tmid1);clearTimeout(tmid2);a=p||'';if(xcmd!=null)\n{xcmd.abort()}\nvar pwr=gebi('pwr-slider').value;if(gauge)\n{gauge.setTargetValue(pwr);}\nxcmd=new XMLHttpRequest();xcmd.onreadystatechange=()=>{if(xcmd.readyState==4&&xcmd.status==200)\n{clearTimeout(tmid1);clearTimeout(tmid2);var s=xcmd.responseText;var res=JSON.parse(s);var still=(res['pwr_current']===0)?true:false;gebi('pwr-value').innerHTML=s;if(still===isMoving)\n{isMoving=!still;disableCtrls(!still);}\ntmid2=setTimeout(cmd,2000);}};xcmd.open('GET','/tcontrol?pwr='+pwr+a,true);xcmd.send();tmid1=setTimeout(cmd,5000);}\nfunction changeDir()\n{cmd('&dir='+gebi('dir-slider').value);}\nfunction toggleCab(el)\n{var value=el.options[el.selectedIndex].value;var cab=(value==='cab1')?'0':'1';cmd('&cab='+cab);}\nfunction disableCtrls(val)\n{gebi('dir-slider').disabled=val;gebi('cab').disabled=val;}\nfunction updGauge()\n{var pwr=gebi('pwr-slider').value;if(gauge)\ngauge.setTargetValue(pwr);}\nfunction updCurrentPower()\n{clearTimeout(tmid3);var dpwr=0.125;var diff=gauge.tv-gauge.cv;var delta=0;if(diff>0)\n{delta=Math.min(dpwr,diff);gauge.setCurrentValue(gauge.cv+delta);}\nelse if(diff<0)\n{delta=Math.max(-3*dpwr,diff);gauge.setCurrentValue(gauge.cv+delta);}\ntmid3=setTimeout(updCurrentPower,25);}\nclass GaugeClassic\n{constructor(canvas)\n{this.opts={};this.cvs=canvas;this.cvs.style.width='100%';this.cvs.style.height='100%';this.minv=0;this.maxv=100;this.tv=this.cv=this.minv;this.smallStep=2;this.bigStep=10;this.stAng=-20;this.rangeAng=220;this.resize();}\nresize()\n{this.w=this.cvs.width=this.cvs.offsetWidth;this.h=this.cvs.height=this.cvs.offsetHeight;}\ndraw()\n{var ctx=this.cvs.getContext('2d');ctx.save();var sz=Math.min(this.w,this.h);var ofs=15;ctx.clearRect(ofs,ofs,this.w-2*ofs,this.h-2*ofs);var sc=sz/120.0;ctx.translate(this.w/2.0,this.h*2.0/3.0);ctx.scale(sc,sc);ctx.strokeStyle='black';ctx.fillStyle='white';ctx.lineWidth=1;ctx.lineCap='round';ctx.save();ctx.lineWidth=0.8;this.drawScale(ctx,this.smallStep,48,45)\nctx.restore();ctx.save();ctx.lineWidth=1.3;this.drawScale(ctx,this.bigStep,48,42)\nctx.restore();ctx.save();ctx.font='5 serif';ctx.textAlign='center';ctx.textBaseline='middle';ctx.fillStyle='black';this.drawTextScale(ctx,this.bigStep,57)\nctx.restore();ctx.save();this.drawWheel(ctx,this.tv);ctx.restore();ctx.save();ctx.lineJoin='miter';ctx.lineWidth=1;ctx.fillStyle='#666';ctx.strokeStyle='#666';ctx.filter='blur(3px)';ctx.translate(-1,-1);this.drawTextHand(ctx,49,this.cv);ctx.restore();ctx.save();ctx.lineJoin='miter';ctx.lineWidth=1;ctx.fillStyle='red';ctx.strokeStyle='red';this.drawTextHand(ctx,49,this.cv);ctx.restore();ctx.save();ctx.fillStyle='gold';ctx.beginPath();ctx.arc(0,0,1.3,0,Math.PI*2,true);ctx.fill();ctx.restore();ctx.restore();}\ndrawScale(ctx,step,r1,r2)\n{ctx.rotate(this.toRad(this.stAng));var angStep=this.toRad(this.rangeAng*step/(this.maxv-this.minv));for(let v=this.minv;v<=this.maxv;v+=step){ctx.beginPath();ctx.moveTo(-r1,0);ctx.lineTo(-r2,0);ctx.closePath();ctx.stroke();ctx.rotate(angStep);}}\ndrawTextScale(ctx,step,r)\n{var angStep=this.toRad(this.rangeAng*step/(this.maxv-this.minv));var angRad=this.toRad(this.stAng);for(let v=this.minv;v<=this.maxv;v+=step,angRad+=angStep){var x=-Math.cos(angRad)*r;var y=-Math.sin(angRad)*r;var s=Math.round(v).toString();ctx.fillText(s,x,y);}}\ndrawTextHand(ctx,r,v)\n{var angRad=this.toRad(this.stAng+this.rangeAng*v/(this.maxv-this.minv));var r1=3;var r2=8;ctx.rotate(angRad);ctx.beginPath();var prevLW=ctx.lineWidth;ctx.lineWidth=prevLW*2;ctx.arc(0,0,r1,0,Math.PI*2,true);ctx.stroke();ctx.lineWidth=prevLW;ctx.beginPath();ctx.moveTo(-r1,-r1/2.0);ctx.lineTo(-r,0);ctx.lineTo(-r1,r1/2.0);ctx.closePath();ctx.fill();ctx.beginPath();ctx.moveTo(r1,-r1/2.0);ctx.lineTo(r2,-r1/2.0);ctx.lineTo(r2,r1/2.0);ctx.lineTo(r1,r1/2.0);ctx.closePath();ctx.fill();}\ndrawWheel(ctx,v)\n{var stAng=Math.PI+this.toRad(this.stAng);var enAng=Math.PI+this.toRad(this.stAng+this.rangeAng);ctx.beginPath();ctx.strokeStyle='#555';ctx.lineWidth=6;ctx.shadowBlur=10;ctx.shadowColor='#555';ctx.arc(0,0,35,stAng,enAng,false);ctx.stroke();ctx.beginPath();ctx.strokeStyle='#66e';ctx.lineWidth=4;ctx.shadowBlur=6;ctx.shadowColor='#d6d';enAng=Math.PI+this.toRad(this.stAng+this.rangeAng*v/(this.maxv-this.minv));ctx.beginPath();ctx.arc(0,0,35,stAng,enAng,false);ctx.stroke();}\ntoRad(deg)\n{return Math.PI*deg/180.0;}\nsetTargetValue(v)\n{if(v<this.minv)\nthis.tv=this.minv;else if(v>this.maxv)\nthis.tv=this.maxv;else\nthis.tv=v;}\nsetCurrentValue(v)\n{if(v<this.minv)\nthis.cv=this.minv;else if(v>this.maxv)\nthis.cv=this.maxv;else\nthis.cv=v;}}\nfunction init()\n{gauge=new GaugeClassic(gebi('gauge'));window.requestAnimationFrame(loop);updCurrentPower();}\nfunction loop()\n{gauge.draw();window.requestAnimationFrame(loop);}\nfunction stop()\n{gebi('confirmDlg').style.display='block';}\nwindow.addEventListener('resize',function(){gauge.resize();});wl(init);wl(cmd);\n</script>";
+    const char WM_PK_HTTP_TRAIN_STYLE[] PROGMEM = "html,body{height:100%;margin:0;padding:0;font-family:verdana,sans-serif;background:#fff;text-align:center}.stopBtn{border-radius:0.4rem;border-width:2px;border-color:rgb(111,22,25);background:rgb(216,42,48);color:#fff;font-size:1.5rem;cursor:pointer;margin:0;padding:0.5rem 0.7rem 0.5rem 0.7rem;width:100%;-webkit-transition-duration:0.5s;transition-duration:0.5s}.stopBtn:hover{background:rgb(249,49,55);border-color:rgb(216,42,48);color:rgb(254 199 28)}.stopBtn:active,.btn:focus{background:#48b}.cab{border-radius:0.4rem;border-width:2px;border-color:rgb(67,115,166);background:rgb(117,178,244);color:#fff;font-size:1.5rem;cursor:pointer;margin:0;padding:0.5rem 0.7rem 0.5rem 0.7rem;width:100%;-webkit-transition-duration:0.5s;transition-duration:0.5s}.cab:disabled{background:#ccc}.inpgrp{padding:0rem 0rem 0rem 1rem}a{color:#1fa3ec;text-decoration:none}.msg{background:#def;border-left:5px solid #59d;padding:1.5em;margin:1rem 0rem 0rem 0rem}.p{float:left;text-align:left}.q{float:right;text-align:right}.r{border-radius:0.3em;padding:2px;margin:6px 2px}.hf{display:none}.block{display:block}fieldset{border-width:3px;background-color:#def;margin:0px}.train-dashboard{top:10%;bottom:10%;aspect-ratio:2/3;display:grid;grid-template-columns:10% 80% 10%;grid-template-rows:15% 70% 15%;gap:0;align-items:stretch;margin:auto}.train-dashboard>div{background-color:#fff;text-align:center;font-size:1rem}.pwr-item{grid-row-start:1;grid-row-end:4}.pwr-item>input[type=range]{height:80%}.dir-item>input[type=range]{height:20%}.vert-slider-item>label{width:100%;display:block;padding:0.5rem 0}.vert-slider-item>svg{width:100%;display:block;padding:0.5rem 0;border:0}.power-gauge-item{width:30rem}.vert-slider-item>input[type=range]{-webkit-appearance:none;margin:0 8px;writing-mode:vertical-lr;direction:rtl;width:2rem;vertical-align:bottom}.vert-slider-item>input[type=range]:focus{outline:none}.vert-slider-item>input[type=range]:focus{outline:none}.vert-slider-item>input[type=range]::-webkit-slider-runnable-track{width:1rem;cursor:pointer;box-shadow:1px 1px 1px #000000,0px 0px 1px #0d0d0d;background:#eee;border-radius:1.3px;border:0.2px solid #010101}.vert-slider-item>input[type=range]::-webkit-slider-thumb{border:1px solid #000000;-webkit-appearance:none;box-shadow:1px 1px 1px #48c,0px 0px 1px #0d0d0d;height:2rem;width:3rem;border-radius:3px;background:#49d;cursor:pointer;-webkit-appearance:none;margin-left:-18px}.vert-slider-item>input[type=range]:focus::-webkit-slider-thumb{background:#38c}.vert-slider-item>input[type=range]:disabled::-webkit-slider-thumb{box-shadow:1px 1px 1px #48c,0px 0px 1px #080808;background:#ccc}.vert-slider-item>input[type=range]:focus::-webkit-slider-runnable-track{background:#ccc}.gauge{height:300px;width:auto}svg{margin:0px;padding:0;cursor:pointer;border:1px solid #0a1a17}svg.focusable{border:1px solid #0f4534}html,body{height:100%;margin:0;padding:0}.container{height:100%;position:relative;padding:0;margin:auto}#top,#middle,#bottom{position:absolute;width:100%}#top{height:8%;width:100%;background:grey}#bottom{bottom:0;height:8%;width:100%;background:grey}.modal{display:none;position:fixed;z-index:1;padding-top:100px;left:0;top:0;width:100%;height:100%;overflow:auto;background-color:rgb(0,0,0);background-color:rgba(0,0,0,0.4)}.modal-content{background-color:#fefefe;margin:auto;padding:20px;border:1px solid #888;width:80%}.close{color:#aaaaaa;float:right;font-size:28px;font-weight:bold}.close:hover,.close:focus{color:#000;text-decoration:none;cursor:pointer}\n";
 #endif
 
 const char WM_PK_HTTP_FORM_START[] PROGMEM = "<form method='get' action='%{action}%'>\n";
@@ -105,10 +4667,113 @@ const char WM_PK_HTTP_FORM_LABEL_BEFORE[]  PROGMEM   = "<div>\n<label for='%{i}%
 const char WM_PK_HTTP_FORM_LABEL_AFTER[]   PROGMEM   = "<div>\n<input id='%{i}%' name='%{n}%' length=%{l}% placeholder='%{p}%' value='%{v}%' %{c}%>\n<label for='%{i}%'>%{p}%</label>\n<div>\n";
 const char WM_PK_HTTP_FORM_LABEL[] PROGMEM = "<label for='%{i}%'>%{p}%</label>\n";
 const char WM_PK_HTTP_FORM_PARAM[] PROGMEM = "<input id='%{i}%' name='%{n}%' length=%{l}% placeholder='%{p}%' value='%{v}%' %{c}%>\n";
-const char WM_PK_HTTP_SAVED[] PROGMEM = "<div class='msg'><b>Credentials Saved</b><br>Try connecting ESP to the %{x}%/%{x1}% network. Wait around 10 seconds then check <a href='/'>if it's OK.</a> <p/>The %{v}% AP will run on the same WiFi channel of the %{x}%/%{x1}% AP. You may have to manually reconnect to the %{v}% AP.</div>\n";
-const char WM_PK_HTTP_CHIP_INFO_ESP8266[] PROGMEM = "<fieldset>\n<table class='table'>\n<thead>\n<tr>\n<th>" L_CHIP_INFO_NAME "</th>\n<th>" L_CHIP_INFO_VALUE "</th>\n</tr>\n</thead>\n<tbody>\n<tr>\n<td>" L_CHIP_INFO_CHIP_ID "</td>\n<td>%{chipid}%</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_FLASH_CHIP_ID "</td>\n<td>%{flashid}%</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_IDE_FLASH_SIZE "</td>\n<td>%{ideFlashSize}%</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_REAL_FLASH_SIZE "</td>\n<td>%{realFlashSize}%</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_AP_IP "</td>\n<td>%{apip}%</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_AP_MAC "</td>\n<td>%{apmac}%</td>\n</tr>\n<tr>\n<td>" L_WIFI_SSID "</td>\n<td>%{ssid}%</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_STA_IP "</td>\n<td>%{staip}%</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_STA_MAC "</td>\n<td>%{stamac}%</td>\n</tr>\n</tbody>\n</table>\n</fieldset>\n";
 const char WM_PK_HTTP_ITEM[] PROGMEM = "<div><a href='#p' onclick='c(this)'>%{v}%</a>&nbsp;<span class='q %{i}%'>%{r}%%</span></div>\n";
 const char WM_PK_JSON_ITEM[] PROGMEM = "{\"SSID\":\"%{v}%\", \"Encryption\":%{i}%, \"Quality\":\"%{r}%\"}";
 
+// Templates split at build time, rendered by filling the slot array (HTTPTemplateStream::add)
+enum WMSavedSlot : uint8_t
+{
+    WM_SAVED_SLOT_X,
+    WM_SAVED_SLOT_X1,
+    WM_SAVED_SLOT_V,
+    WM_SAVED_SLOT_COUNT
+};
+
+const char WM_PK_HTTP_SAVED_0[] PROGMEM = "<div class='msg'><b>Credentials Saved</b><br>Try connecting ESP to the ";
+const char WM_PK_HTTP_SAVED_1[] PROGMEM = "/";
+const char WM_PK_HTTP_SAVED_2[] PROGMEM = " network. Wait around 10 seconds then check <a href='/'>if it's OK.</a> <p/>The ";
+const char WM_PK_HTTP_SAVED_3[] PROGMEM = " AP will run on the same WiFi channel of the ";
+constexpr decltype(WM_PK_HTTP_SAVED_1)& WM_PK_HTTP_SAVED_4 = WM_PK_HTTP_SAVED_1;
+const char WM_PK_HTTP_SAVED_5[] PROGMEM = " AP. You may have to manually reconnect to the ";
+const char WM_PK_HTTP_SAVED_6[] PROGMEM = " AP.</div>\n";
+const HTTPTemplatePart WM_PK_HTTP_SAVED_PARTS[] PROGMEM = {
+    { WM_PK_HTTP_SAVED_0, WM_SAVED_SLOT_X },
+    { WM_PK_HTTP_SAVED_1, WM_SAVED_SLOT_X1 },
+    { WM_PK_HTTP_SAVED_2, WM_SAVED_SLOT_V },
+    { WM_PK_HTTP_SAVED_3, WM_SAVED_SLOT_X },
+    { WM_PK_HTTP_SAVED_4, WM_SAVED_SLOT_X1 },
+    { WM_PK_HTTP_SAVED_5, WM_SAVED_SLOT_V },
+    { WM_PK_HTTP_SAVED_6, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_HTTP_SAVED = { WM_PK_HTTP_SAVED_PARTS, ARRAY_LENGTH(WM_PK_HTTP_SAVED_PARTS) };
+
+enum WMNetworkInfoSlot : uint8_t
+{
+    WM_NETWORK_INFO_SLOT_SSID,
+    WM_NETWORK_INFO_SLOT_IP,
+    WM_NETWORK_INFO_SLOT_COUNT
+};
+
+const char WM_PK_HTTP_NETWORK_INFO_0[] PROGMEM = "<div class='msg'><dl><dt>" L_WIFI_SSID "</dt><dd>";
+const char WM_PK_HTTP_NETWORK_INFO_1[] PROGMEM = "</dd><dt>" L_CHIP_INFO_STA_IP "</dt><dd>";
+const char WM_PK_HTTP_NETWORK_INFO_2[] PROGMEM = "</dd></dl></div>\n";
+const HTTPTemplatePart WM_PK_HTTP_NETWORK_INFO_PARTS[] PROGMEM = {
+    { WM_PK_HTTP_NETWORK_INFO_0, WM_NETWORK_INFO_SLOT_SSID },
+    { WM_PK_HTTP_NETWORK_INFO_1, WM_NETWORK_INFO_SLOT_IP },
+    { WM_PK_HTTP_NETWORK_INFO_2, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_HTTP_NETWORK_INFO = { WM_PK_HTTP_NETWORK_INFO_PARTS, ARRAY_LENGTH(WM_PK_HTTP_NETWORK_INFO_PARTS) };
+
+enum WMChipInfoSlot : uint8_t
+{
+    WM_CHIP_INFO_SLOT_CHIPID,
+    WM_CHIP_INFO_SLOT_FLASHID,
+    WM_CHIP_INFO_SLOT_IDE_FLASH_SIZE,
+    WM_CHIP_INFO_SLOT_REAL_FLASH_SIZE,
+    WM_CHIP_INFO_SLOT_APIP,
+    WM_CHIP_INFO_SLOT_APMAC,
+    WM_CHIP_INFO_SLOT_SSID,
+    WM_CHIP_INFO_SLOT_STAIP,
+    WM_CHIP_INFO_SLOT_STAMAC,
+    WM_CHIP_INFO_SLOT_COUNT
+};
+
+const char WM_PK_HTTP_CHIP_INFO_0[] PROGMEM = "<fieldset>\n<table class='table'>\n<thead>\n<tr>\n<th>" L_CHIP_INFO_NAME "</th>\n<th>" L_CHIP_INFO_VALUE "</th>\n</tr>\n</thead>\n<tbody>\n<tr>\n<td>" L_CHIP_INFO_CHIP_ID "</td>\n<td>";
+const char WM_PK_HTTP_CHIP_INFO_1[] PROGMEM = "</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_FLASH_CHIP_ID "</td>\n<td>";
+const char WM_PK_HTTP_CHIP_INFO_2[] PROGMEM = "</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_IDE_FLASH_SIZE "</td>\n<td>";
+const char WM_PK_HTTP_CHIP_INFO_3[] PROGMEM = "</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_REAL_FLASH_SIZE "</td>\n<td>";
+const char WM_PK_HTTP_CHIP_INFO_4[] PROGMEM = "</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_AP_IP "</td>\n<td>";
+const char WM_PK_HTTP_CHIP_INFO_5[] PROGMEM = "</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_AP_MAC "</td>\n<td>";
+const char WM_PK_HTTP_CHIP_INFO_6[] PROGMEM = "</td>\n</tr>\n<tr>\n<td>" L_WIFI_SSID "</td>\n<td>";
+const char WM_PK_HTTP_CHIP_INFO_7[] PROGMEM = "</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_STA_IP "</td>\n<td>";
+const char WM_PK_HTTP_CHIP_INFO_8[] PROGMEM = "</td>\n</tr>\n<tr>\n<td>" L_CHIP_INFO_STA_MAC "</td>\n<td>";
+const char WM_PK_HTTP_CHIP_INFO_9[] PROGMEM = "</td>\n</tr>\n</tbody>\n</table>\n</fieldset>\n";
+const HTTPTemplatePart WM_PK_HTTP_CHIP_INFO_PARTS[] PROGMEM = {
+    { WM_PK_HTTP_CHIP_INFO_0, WM_CHIP_INFO_SLOT_CHIPID },
+    { WM_PK_HTTP_CHIP_INFO_1, WM_CHIP_INFO_SLOT_FLASHID },
+    { WM_PK_HTTP_CHIP_INFO_2, WM_CHIP_INFO_SLOT_IDE_FLASH_SIZE },
+    { WM_PK_HTTP_CHIP_INFO_3, WM_CHIP_INFO_SLOT_REAL_FLASH_SIZE },
+    { WM_PK_HTTP_CHIP_INFO_4, WM_CHIP_INFO_SLOT_APIP },
+    { WM_PK_HTTP_CHIP_INFO_5, WM_CHIP_INFO_SLOT_APMAC },
+    { WM_PK_HTTP_CHIP_INFO_6, WM_CHIP_INFO_SLOT_SSID },
+    { WM_PK_HTTP_CHIP_INFO_7, WM_CHIP_INFO_SLOT_STAIP },
+    { WM_PK_HTTP_CHIP_INFO_8, WM_CHIP_INFO_SLOT_STAMAC },
+    { WM_PK_HTTP_CHIP_INFO_9, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_HTTP_CHIP_INFO = { WM_PK_HTTP_CHIP_INFO_PARTS, ARRAY_LENGTH(WM_PK_HTTP_CHIP_INFO_PARTS) };
+
+enum WMAppSlot : uint8_t
+{
+    WM_APP_SLOT_TITLE,
+    WM_APP_SLOT_COPYRIGHT,
+    WM_APP_SLOT_VERSION,
+    WM_APP_SLOT_OTA_URL,
+    WM_APP_SLOT_COUNT
+};
+
+const char WM_PK_HTTP_APP_JS_0[] PROGMEM = "(function(){var APP={title:";
+const char WM_PK_HTTP_APP_JS_1[] PROGMEM = ",copyright:";
+const char WM_PK_HTTP_APP_JS_2[] PROGMEM = ",version:";
+const char WM_PK_HTTP_APP_JS_3[] PROGMEM = ",otaUrl:";
+const char WM_PK_HTTP_APP_JS_4[] PROGMEM = "};document.addEventListener('DOMContentLoaded',function(){var items=document.querySelectorAll('[data-app]');for(var i=0;i<items.length;i++){var v=APP[items[i].getAttribute('data-app')];if(items[i].tagName==='INPUT')items[i].value=v;else items[i].textContent=v;}});})();\n";
+const HTTPTemplatePart WM_PK_HTTP_APP_JS_PARTS[] PROGMEM = {
+    { WM_PK_HTTP_APP_JS_0, WM_APP_SLOT_TITLE },
+    { WM_PK_HTTP_APP_JS_1, WM_APP_SLOT_COPYRIGHT },
+    { WM_PK_HTTP_APP_JS_2, WM_APP_SLOT_VERSION },
+    { WM_PK_HTTP_APP_JS_3, WM_APP_SLOT_OTA_URL },
+    { WM_PK_HTTP_APP_JS_4, HTTP_TEMPLATE_NO_SLOT }
+};
+const HTTPTemplate WM_PK_HTTP_APP_JS = { WM_PK_HTTP_APP_JS_PARTS, ARRAY_LENGTH(WM_PK_HTTP_APP_JS_PARTS) };
+
 
 #endif    // WiFiManagerLangResource_h
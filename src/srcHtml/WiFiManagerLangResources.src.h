@@ -14,6 +14,9 @@
 
 ////////////////////////////////////////////////////
 
+// Identical strings below are emitted as references to the first one (string pool of the generator)
+const char WM_PK_EMPTY_STR[] PROGMEM = "";
+
 const char WM_PK_HTML_HEAD_1[] PROGMEM = "%HEAD_1%";
 // Title
 const char WM_PK_HTML_HEAD_2[] PROGMEM = "</title>";
@@ -45,11 +48,11 @@ const char WM_PK_HTTP_HTML[] PROGMEM =
 
 // Javascript files
 const char WM_PK_UTILS_JS[] PROGMEM = "%WM_PK_UTILS_JS%";
-const char WM_PK_MD5_UTILS_JS[] PROGMEM = "%WM_PK_MD5_UTILS_JS%";
 const char WM_PK_OTA_JS[] PROGMEM = "%WM_PK_OTA_JS%";
 const char WM_PK_MODULE_POLYFILL_JS[] PROGMEM = "%WM_PK_MODULE_POLYFILL_JS%";
 const char WM_PK_RESTART_JS[] PROGMEM = "%WM_PK_RESTART_JS%";
 const char WM_PK_HW_STATUS_JS[] PROGMEM = "%WM_PK_HW_STATUS_JS%";
+const char WM_PK_JSTZ_JS[] PROGMEM = "%WM_PK_JSTZ_JS%";
 
 // HTML files
 const char WM_PK_INDEX_HTML[] PROGMEM = "%WM_PK_INDEX_HTML%";
@@ -69,10 +72,190 @@ const char WM_PK_MQTT_HTML[] PROGMEM = "%WM_PK_MQTT_HTML%";
 // CSS files
 const char WM_PK_STYLE_CSS[] PROGMEM = "%WM_PK_STYLE_CSS%";
 
+// Gzip-compressed copies of the files above, sent when the client accepts gzip.
+// *_LEN is 0 when the file can't be compressed at build time (e.g. it depends on application defines).
+%WM_PK_UTILS_JS_GZ%
+%WM_PK_OTA_JS_GZ%
+%WM_PK_MODULE_POLYFILL_JS_GZ%
+%WM_PK_RESTART_JS_GZ%
+%WM_PK_HW_STATUS_JS_GZ%
+%WM_PK_JSTZ_JS_GZ%
+%WM_PK_INDEX_HTML_GZ%
+#ifdef WM_REMOTE_UPDATE
+%WM_PK_OTA_REMOTE_JS_GZ%
+%WM_PK_OTA_REMOTE_HTML_GZ%
+#else
+%WM_PK_OTA_HTML_GZ%
+#endif
+%WM_PK_INFO_HTML_GZ%
+%WM_PK_WIFI_HTML_GZ%
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+%WM_PK_MQTT_HTML_GZ%
+#endif
+%WM_PK_STYLE_CSS_GZ%
+
+// Brotli-compressed copies, preferred when the client accepts br and they are smaller than gzip.
+// Stored only with WM_STATIC_BROTLI, *_LEN is 0 when the generator had no brotli module.
+#if WM_STATIC_BROTLI
+%WM_PK_UTILS_JS_BR%
+%WM_PK_OTA_JS_BR%
+%WM_PK_MODULE_POLYFILL_JS_BR%
+%WM_PK_RESTART_JS_BR%
+%WM_PK_HW_STATUS_JS_BR%
+%WM_PK_JSTZ_JS_BR%
+%WM_PK_INDEX_HTML_BR%
+#ifdef WM_REMOTE_UPDATE
+%WM_PK_OTA_REMOTE_JS_BR%
+%WM_PK_OTA_REMOTE_HTML_BR%
+#else
+%WM_PK_OTA_HTML_BR%
+#endif
+%WM_PK_INFO_HTML_BR%
+%WM_PK_WIFI_HTML_BR%
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+%WM_PK_MQTT_HTML_BR%
+#endif
+%WM_PK_STYLE_CSS_BR%
+#endif
+
+// Copies of the translated files that look their strings up by key in the language table of the client,
+// the loader and the table of every language. With WM_LANGUAGE_TABLE they are served instead of the files above.
+#if WM_LANGUAGE_TABLE
+const char WM_PK_OTA_JS_KEYS[] PROGMEM = "%WM_PK_OTA_JS_KEYS%";
+const char WM_PK_RESTART_JS_KEYS[] PROGMEM = "%WM_PK_RESTART_JS_KEYS%";
+const char WM_PK_INDEX_HTML_KEYS[] PROGMEM = "%WM_PK_INDEX_HTML_KEYS%";
+#ifdef WM_REMOTE_UPDATE
+const char WM_PK_OTA_REMOTE_JS_KEYS[] PROGMEM = "%WM_PK_OTA_REMOTE_JS_KEYS%";
+const char WM_PK_OTA_HTML_KEYS[] PROGMEM = "%WM_PK_OTA_REMOTE_HTML_KEYS%";
+#else
+const char WM_PK_OTA_HTML_KEYS[] PROGMEM = "%WM_PK_OTA_HTML_KEYS%";
+#endif
+const char WM_PK_INFO_HTML_KEYS[] PROGMEM = "%WM_PK_INFO_HTML_KEYS%";
+const char WM_PK_WIFI_HTML_KEYS[] PROGMEM = "%WM_PK_WIFI_HTML_KEYS%";
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+const char WM_PK_MQTT_HTML_KEYS[] PROGMEM = "%WM_PK_MQTT_HTML_KEYS%";
+#endif
+const char WM_PK_LANG_JS[] PROGMEM = "%WM_PK_LANG_JS%";
+const char WM_PK_LANG_EN_JSON[] PROGMEM = "%WM_PK_LANG_EN_JSON%";
+const char WM_PK_LANG_SK_JSON[] PROGMEM = "%WM_PK_LANG_SK_JSON%";
+
+%WM_PK_OTA_JS_KEYS_GZ%
+%WM_PK_RESTART_JS_KEYS_GZ%
+%WM_PK_INDEX_HTML_KEYS_GZ%
+#ifdef WM_REMOTE_UPDATE
+%WM_PK_OTA_REMOTE_JS_KEYS_GZ%
+%WM_PK_OTA_REMOTE_HTML_KEYS_GZ%
+#else
+%WM_PK_OTA_HTML_KEYS_GZ%
+#endif
+%WM_PK_INFO_HTML_KEYS_GZ%
+%WM_PK_WIFI_HTML_KEYS_GZ%
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+%WM_PK_MQTT_HTML_KEYS_GZ%
+#endif
+%WM_PK_LANG_JS_GZ%
+%WM_PK_LANG_EN_JSON_GZ%
+%WM_PK_LANG_SK_JSON_GZ%
+
+#if WM_STATIC_BROTLI
+%WM_PK_OTA_JS_KEYS_BR%
+%WM_PK_RESTART_JS_KEYS_BR%
+%WM_PK_INDEX_HTML_KEYS_BR%
+#ifdef WM_REMOTE_UPDATE
+%WM_PK_OTA_REMOTE_JS_KEYS_BR%
+%WM_PK_OTA_REMOTE_HTML_KEYS_BR%
+#else
+%WM_PK_OTA_HTML_KEYS_BR%
+#endif
+%WM_PK_INFO_HTML_KEYS_BR%
+%WM_PK_WIFI_HTML_KEYS_BR%
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+%WM_PK_MQTT_HTML_KEYS_BR%
+#endif
+%WM_PK_LANG_JS_BR%
+%WM_PK_LANG_EN_JSON_BR%
+%WM_PK_LANG_SK_JSON_BR%
+#endif
+
+%WM_PK_OTA_JS_KEYS_ETAG%
+%WM_PK_RESTART_JS_KEYS_ETAG%
+%WM_PK_INDEX_HTML_KEYS_ETAG%
+#ifdef WM_REMOTE_UPDATE
+%WM_PK_OTA_REMOTE_JS_KEYS_ETAG%
+%WM_PK_OTA_REMOTE_HTML_KEYS_ETAG%
+#else
+%WM_PK_OTA_HTML_KEYS_ETAG%
+#endif
+%WM_PK_INFO_HTML_KEYS_ETAG%
+%WM_PK_WIFI_HTML_KEYS_ETAG%
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+%WM_PK_MQTT_HTML_KEYS_ETAG%
+#endif
+%WM_PK_LANG_JS_ETAG%
+%WM_PK_LANG_EN_JSON_ETAG%
+%WM_PK_LANG_SK_JSON_ETAG%
+#endif
+
+// Language neutral copies of the translated files, split at their strings, and the string tables of all
+// languages. With WM_RUNTIME_LANGUAGE they are served in the language of the request instead of the files above.
+#if WM_RUNTIME_LANGUAGE
+%WM_LANGUAGES%
+
+%WM_PK_OTA_JS_LT%
+%WM_PK_RESTART_JS_LT%
+%WM_PK_INDEX_HTML_LT%
+#ifdef WM_REMOTE_UPDATE
+%WM_PK_OTA_REMOTE_JS_LT%
+%WM_PK_OTA_REMOTE_HTML_LT%
+#else
+%WM_PK_OTA_HTML_LT%
+#endif
+%WM_PK_INFO_HTML_LT%
+%WM_PK_WIFI_HTML_LT%
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+%WM_PK_MQTT_HTML_LT%
+#endif
+#endif
+
+// Entity tags (content hash) of the files above, used to answer conditional requests with 304 Not Modified.
+// Empty when the hash can't be computed at build time.
+%WM_PK_UTILS_JS_ETAG%
+%WM_PK_OTA_JS_ETAG%
+%WM_PK_MODULE_POLYFILL_JS_ETAG%
+%WM_PK_RESTART_JS_ETAG%
+%WM_PK_HW_STATUS_JS_ETAG%
+%WM_PK_JSTZ_JS_ETAG%
+%WM_PK_INDEX_HTML_ETAG%
+#ifdef WM_REMOTE_UPDATE
+%WM_PK_OTA_REMOTE_JS_ETAG%
+%WM_PK_OTA_REMOTE_HTML_ETAG%
+#else
+%WM_PK_OTA_HTML_ETAG%
+#endif
+%WM_PK_INFO_HTML_ETAG%
+%WM_PK_WIFI_HTML_ETAG%
+#ifdef WM_SUPPORT_HOME_ASSISTANT
+%WM_PK_MQTT_HTML_ETAG%
+#endif
+%WM_PK_STYLE_CSS_ETAG%
+
+
+// Static file routes served by handleStaticFileRequest(). The URL path hashed with
+// ESPAsync_WiFiManagerUtils::HashPath(path, WM_STATIC_ROUTES_SEED) >> WM_STATIC_ROUTES_SHIFT
+// selects the only slot that can hold it, one compare confirms the match.
+struct HTTPStaticRoute
+{
+    const char* pPath;  // URL path in program memory, nullptr for an empty slot
+    uint8_t file;       // WMStaticFile id
+    bool immutable;     // Fingerprinted name, the content behind it never changes
+};
+
+%WM_STATIC_ROUTES%
 
 
 const char WM_PK_HTTP_COMMON_SCRIPT[] PROGMEM = "<script>%COMMON_SCRIPT%</script>";
 const char WM_PK_HTTP_WM_SCRIPT[] PROGMEM = "<script>%WM_SCRIPT%</script>";
+const char WM_PK_HTTP_JSTZ_SCRIPT[] PROGMEM = "%JSTZ_SCRIPT%";
 const char WM_PK_HTTP_OTA_SCRIPT[] PROGMEM = "<script type=\"module\" crossorigin>%OTA_SCRIPT%</script>";
 const char WM_PK_HTTP_STYLE[] PROGMEM = "%STYLE%";
 const char WM_PK_HTTP_OPTIONS_MSG[] PROGMEM = L_GENERAL_OPTIONS;
@@ -85,7 +268,6 @@ const char WM_PK_HTTP_INFO_MSG[] PROGMEM = L_INFO;
 const char WM_PK_HTTP_RESETTING_MSG[] PROGMEM = L_RESETTING;
 const char WM_PK_HTTP_FIRMWARE_UPDATE_MSG[] PROGMEM = L_OTA_FIRMWARE_UPDATE;
 const char WM_PK_HTTP_MESSAGE[] PROGMEM = "<div class=\"msg\">%{msg}%</div>";
-const char WM_PK_HTTP_NETWORK_INFO[] PROGMEM = "%NETWORK_INFO%";
 const char WM_PK_HTTP_FLDSET_START[] PROGMEM = "<fieldset>";
 const char WM_PK_HTTP_FLDSET_END[] PROGMEM = "</fieldset>";
 const char WM_PK_HTTP_OTA_UPDATE[] PROGMEM = "%OTA_UPDATE%";
@@ -105,10 +287,17 @@ const char WM_PK_HTTP_FORM_LABEL_BEFORE[]  PROGMEM   = "%FORM_LABEL_BEFORE%";
 const char WM_PK_HTTP_FORM_LABEL_AFTER[]   PROGMEM   = "%FORM_LABEL_AFTER%";
 const char WM_PK_HTTP_FORM_LABEL[] PROGMEM = "%FORM_LABEL%";
 const char WM_PK_HTTP_FORM_PARAM[] PROGMEM = "%FORM_PARAM%";
-const char WM_PK_HTTP_SAVED[] PROGMEM = "%SAVED%";
-const char WM_PK_HTTP_CHIP_INFO_ESP8266[] PROGMEM = "%CHIP_INFO_ESP8266%";
 const char WM_PK_HTTP_ITEM[] PROGMEM = "%ITEM%";
 const char WM_PK_JSON_ITEM[] PROGMEM = "%JSON_ITEM%";
 
+// Templates split at build time, rendered by filling the slot array (HTTPTemplateStream::add)
+%WM_PK_HTTP_SAVED%
+
+%WM_PK_HTTP_NETWORK_INFO%
+
+%WM_PK_HTTP_CHIP_INFO%
+
+%WM_PK_HTTP_APP_JS%
+
 
 #endif    // WiFiManagerLangResource_h
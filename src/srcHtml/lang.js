@@ -0,0 +1,43 @@
+// String table of the portal language (WM_LANGUAGE_TABLE). Pages mark the translated elements
+// with data-l='KEY', scripts read $L.KEY. The table of each language is a fingerprinted
+// /lang/<code>.json, so the browser fetches it once and keeps it.
+var $L = {};
+
+(function () {
+    var paths = %LANGUAGE_PATHS%;
+
+    // Language chosen on the page (wm_lang cookie), else the first one the browser prefers
+    function selectLanguage() {
+        var m = document.cookie.match(/(?:^|;\s*)wm_lang=([^;]*)/);
+        if (m && paths[m[1]]) {
+            return m[1];
+        }
+        var preferred = navigator.languages || [navigator.language];
+        for (var i = 0; i < preferred.length; i++) {
+            var code = (preferred[i] || '').split('-')[0].toLowerCase();
+            if (paths[code]) {
+                return code;
+            }
+        }
+        return /*L_HTML_LANGUAGE*/'en';
+    }
+
+    var code = selectLanguage();
+    document.documentElement.lang = code;
+    var table = fetch(paths[code]).then(function (r) { return r.json(); });
+
+    function apply() {
+        table.then(function (t) {
+            Object.assign($L, t);
+            document.querySelectorAll('[data-l]').forEach(function (e) {
+                e.textContent = t[e.getAttribute('data-l')];
+            });
+        });
+    }
+
+    if (document.readyState == 'loading') {
+        document.addEventListener('DOMContentLoaded', apply);
+    } else {
+        apply();
+    }
+})();
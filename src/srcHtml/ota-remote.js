@@ -1,6 +1,7 @@
 /**
  * Remote OTA update module — served as /ota-remote.js when WM_REMOTE_UPDATE is defined.
  */
+import './ota.js';
 import { gebi } from './utils.js';
 import { showRestartModal } from './restart.js';
 
@@ -79,6 +79,10 @@ const D1 = async (f) => new Promise((resolve, reject) => {
     reader.readAsArrayBuffer(f);
 });
 
+// Hardware ID of the device, queried once per page and reused for every selected file
+let hwidQuery=null;
+const devHwid=()=>hwidQuery||(hwidQuery=fetch('/sq?dx=hwid').then(r=>r.json()).catch(e=>{hwidQuery=null;throw e;}));
+
 /**
  * Main function to process the selected firmware file and prepare for upload.
  * @param {File} l - The firmware file object.
@@ -97,8 +101,7 @@ const N = async l => {
       IH('fmlang',lang!=null?lang:'');
       H('successRow');
       try {
-        const dR = await fetch('/sq?dx=hwid');
-        const dJ = await dR.json();
+        const dJ = await devHwid();
         if (dJ.hwid && dJ.hwid === hwid) {
           gebi('hwid').classList.remove('red-txt');
           gebi('updateBtn').disabled = false;
@@ -0,0 +1,12 @@
+(function(){
+  // Application defines of the firmware, the device fills the slots with JSON strings
+  var APP={title:%{title}%,copyright:%{copyright}%,version:%{version}%,otaUrl:%{otaUrl}%};
+  document.addEventListener('DOMContentLoaded',function(){
+    var items=document.querySelectorAll('[data-app]');
+    for(var i=0;i<items.length;i++){
+      var v=APP[items[i].getAttribute('data-app')];
+      if(items[i].tagName==='INPUT')items[i].value=v;
+      else items[i].textContent=v;
+    }
+  });
+})();
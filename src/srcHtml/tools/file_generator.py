@@ -4,8 +4,32 @@ import os
 import argparse
 import math
 import re
+import gzip
+import hashlib
+try:
+    import brotli
+except ImportError:
+    brotli = None
 
 gInputDir = ''
+# Languages the static assets are pre-compressed for, loaded from "languages" in the input JSON
+gLanguages = []
+# Entries of the top level replaceMap, used to look up sources of derived entries (e.g. gzip)
+gReplaceMap = []
+# Cache of already translated replaceMap entries
+gTranslated = {}
+# Static routes served under a fingerprinted name, URL path -> replaceMap var of the content
+gFingerprintSources = {}
+# Content served for the same routes with WM_LANGUAGE_TABLE, URL path -> replaceMap var of the keyed variant
+gKeyedFingerprintSources = {}
+# Cache of computed fingerprints, (URL path, keyed) -> fingerprint or None
+gFingerprints = {}
+# Minify html, css and js templates before translation
+gMinify = True
+# Templates already listed in the minification size report
+gMinifyReported = set()
+# Strings emitted as references to an identical one by the string pool, name -> name of the shared copy
+gPooled = {}
 
 def makeFilePath(fname):
     if gInputDir == '':
@@ -19,6 +43,22 @@ def replaceVar(fstr, varEntry, skipLangTranslation):
         value = varEntry["value"]["value"]
     elif "template" == tp:
         value = translate(varEntry["value"], skipLangTranslation)
+    elif "gzip" == tp or "brotli" == tp:
+        value = compressedArray(varEntry["value"], tp, skipLangTranslation)
+    elif "etag" == tp:
+        value = contentETag(varEntry["value"], skipLangTranslation)
+    elif "routes" == tp:
+        value = routeTable(varEntry["value"])
+    elif "slots" == tp:
+        value = slotTemplate(varEntry["value"], skipLangTranslation)
+    elif "language" == tp:
+        value = languageTemplate(varEntry["value"], skipLangTranslation)
+    elif "strings" == tp:
+        value = languageTables(varEntry["value"], skipLangTranslation)
+    elif "languageTable" == tp:
+        value = languageTable(varEntry["value"])
+    elif "languagePaths" == tp:
+        value = languagePaths(varEntry["value"])
      
     fstr = fstr.replace(varEntry["var"], value)
 
@@ -35,25 +75,39 @@ def translate(data, skipLangTranslation):
     if format == "css" or format == "html" or format == "js":
         if os.path.exists(fname):
             # print(f"Processing file '{fname}'.")
-            file = open(fname, "r", encoding='utf-8')
-            # Read each line one by one
-            for line in file:  
+            if data.get("bundle", False):
+                source = bundleModules(data["template"])
+            else:
+                file = open(fname, "r", encoding='utf-8')
+                source = file.read()
+                # Close the file
+                file.close()
+            if gMinify:
+                source = minify(fname, source, format)
+            # Strings looked up by key in the language table instead of inlined (WM_LANGUAGE_TABLE)
+            keys = data.get("keys", False) and not skipLangTranslation
+            if keys and format == "html":
+                source = source.replace("</head>", f"<script src='{LANGUAGE_LOADER}'></script></head>", 1)
+            # Process each line one by one
+            for line in source.splitlines():
                 line = line.strip()
                 if format == "js":
                     if not skipLangTranslation:
-                        line = replaceJavascriptLanguageTags(line)
+                        line = replaceJavascriptLanguageKeys(line) if keys else replaceJavascriptLanguageTags(line)
+                        line = replaceAssetReferences(line, keys)
                     line = line.replace("\\", "\\\\")
                 elif format == "html":
                     if not skipLangTranslation:
+                        if keys:
+                            line = replaceJavascriptLanguageKeys(replaceHTMLLanguageKeys(line))
                         line = replaceHTMLLanguageTags(line)
                         line = replaceHTMLTokens(line)
+                        line = replaceAssetReferences(line, keys)
                 elif format == "css":
                     line = line.replace("\"", "\\\"")
                 if not skipLangTranslation:
                     line += "\\n"
                 content += line
-            # Close the file
-            file.close()
 
         else:
             print(f"The file '{fname}' does not exist.")
@@ -75,16 +129,811 @@ def translate(data, skipLangTranslation):
     return content
 
 def translateFile(jsonFname, outputFname, skipLangTranslation):
+    global gReplaceMap
     data = ''
     with open(jsonFname, 'r') as file:
         data = json.load(file)
         file.close()
 
+    if "languages" in data:
+        for fname in data["languages"]:
+            gLanguages.append(loadLanguage(makeFilePath(fname)))
+    if "replaceMap" in data:
+        gReplaceMap = data["replaceMap"]
+        for entry in gReplaceMap:
+            if entry["value"]["type"] == "routes":
+                for route in entry["value"]["routes"]:
+                    if "fingerprint" in route:
+                        gFingerprintSources[route["path"]] = route["fingerprint"]
+                    if "fingerprintKeys" in route:
+                        gKeyedFingerprintSources[route["path"]] = route["fingerprintKeys"]
+
     content = translate(data, skipLangTranslation)
+    if not skipLangTranslation:
+        content = stringPool(content)
+        flashReport(content)
     of = open(makeFilePath(outputFname), "w", encoding='utf-8')
     of.write(content)
     of.close()
 
+def sourceContent(var, skipLangTranslation):
+    # Translated content of another replaceMap entry, e.g. the asset a gzip entry compresses
+    if var not in gTranslated:
+        entry = next((e for e in gReplaceMap if e["var"] == var), None)
+        if entry is None:
+            print(f"The source '{var}' does not exist.")
+            return None
+        if entry["value"]["type"] == "template":
+            gTranslated[var] = translate(entry["value"], skipLangTranslation)
+        else:
+            gTranslated[var] = replaceVar(var, entry, skipLangTranslation)
+    return gTranslated[var]
+
+
+class UnresolvedSymbol(Exception):
+    pass
+
+
+def loadLanguage(fname):
+    # Collect '#define NAME value' lines of a language header (language/wm_*.h)
+    defines = {}
+    file = open(fname, "r", encoding='utf-8')
+    for line in file:
+        m = re.match(r'\s*#define\s+([A-Za-z_][A-Za-z0-9_]*)\s+(.*)$', line)
+        if m:
+            defines[m.group(1)] = m.group(2).strip()
+    file.close()
+    return { "lcid": int(defines["LANGUAGE_LCID"]), "defines": defines }
+
+
+def unescapeCString(body):
+    # Convert body of a C string literal (without quotes) to the bytes the compiler stores
+    out = bytearray()
+    i = 0
+    while i < len(body):
+        ch = body[i]
+        if ch != '\\':
+            out += ch.encode('utf-8')
+            i += 1
+            continue
+        i += 1
+        ch = body[i]
+        if ch == 'x':
+            m = re.match(r'[0-9A-Fa-f]+', body[i + 1:])
+            out.append(int(m.group(0), 16) & 0xFF)
+            i += 1 + len(m.group(0))
+        elif ch in '01234567':
+            m = re.match(r'[0-7]{1,3}', body[i:])
+            out.append(int(m.group(0), 8) & 0xFF)
+            i += len(m.group(0))
+        else:
+            out += { 'n': b'\n', 'r': b'\r', 't': b'\t' }.get(ch, ch.encode('utf-8'))
+            i += 1
+    return bytes(out)
+
+
+def evalCString(expr, defines, depth = 0):
+    # Evaluate a sequence of adjacent C string literals and macros (e.g. '"<a>" L_TITLE "</a>"') to bytes
+    token = re.compile(r'\s*(?:"((?:[^"\\]|\\.)*)"|([A-Za-z_][A-Za-z0-9_]*))', re.S)
+    out = b''
+    pos = 0
+    expr = expr.rstrip()
+    while pos < len(expr):
+        if expr.startswith('//', pos) or expr[pos:].strip() == '':
+            break
+        m = token.match(expr, pos)
+        if m is None:
+            raise UnresolvedSymbol(f"unexpected input '{expr[pos:pos + 20]}'")
+        if m.group(2) is not None:
+            name = m.group(2)
+            if name not in defines or depth > 8:
+                raise UnresolvedSymbol(f"symbol '{name}' is not known at build time")
+            out += evalCString(defines[name], defines, depth + 1)
+        else:
+            out += unescapeCString(m.group(1))
+        pos = m.end()
+    return out
+
+
+def formatByteArray(name, data):
+    lines = []
+    for i in range(0, len(data), 32):
+        lines.append(','.join(f'0x{b:02x}' for b in data[i:i + 32]))
+    content = f"const uint8_t {name}[] PROGMEM = {{\n" + ',\n'.join(lines) + "\n};\n"
+    content += f"const size_t {name}_LEN = {len(data)};"
+    return content
+
+
+def languageVariants(data, skipLangTranslation):
+    # Bytes of the source entry as the compiler stores them, one (lcid, bytes) pair per language.
+    # None when the source depends on symbols not known at build time.
+    source = sourceContent(data["source"], skipLangTranslation)
+    if source is None:
+        return None
+
+    variants = []
+    for lang in gLanguages:
+        try:
+            variants.append((lang["lcid"], evalCString('"' + source + '"', lang["defines"])))
+        except UnresolvedSymbol as e:
+            print(f"'{data['name']}' not generated: {e}.")
+            return None
+    return variants if len(variants) > 0 else None
+
+
+def perLanguage(variants, format, empty):
+    # Single definition when all languages produce the same output, otherwise select by LANGUAGE_LCID
+    if all(v == variants[0][1] for _, v in variants):
+        return format(variants[0][1])
+
+    content = ''
+    for i, (lcid, v) in enumerate(variants):
+        content += ("#if" if i == 0 else "#elif") + f" (LANGUAGE_LCID == {lcid})\n"
+        content += format(v) + "\n"
+    content += "#else\n" + empty + "\n#endif"
+    return content
+
+
+def compressedArray(data, encoding, skipLangTranslation):
+    # Gzip or Brotli compressed copy of another entry, one variant per language when the content is translated
+    name = data["name"]
+    empty = f"const uint8_t {name}[] PROGMEM = {{ 0 }};\nconst size_t {name}_LEN = 0;"
+    if encoding == "brotli" and brotli is None:
+        print(f"'{name}' not generated: Python module 'brotli' is not installed.")
+        return empty
+    variants = languageVariants(data, skipLangTranslation)
+    if variants is None:
+        return empty
+
+    compressed = []
+    for lcid, raw in variants:
+        if encoding == "brotli":
+            packed = brotli.compress(raw, mode=brotli.MODE_TEXT, quality=11)
+        else:
+            packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        print(f"{name} ({lcid}): {len(raw)} -> {len(packed)} B")
+        compressed.append((lcid, packed))
+
+    return perLanguage(compressed, lambda packed: formatByteArray(name, packed), empty)
+
+
+def contentETag(data, skipLangTranslation):
+    # Strong entity tag of another entry: truncated SHA-1 of its content, empty when it can't be computed
+    name = data["name"]
+    empty = f"const char {name}[] PROGMEM = \"\";"
+    variants = languageVariants(data, skipLangTranslation)
+    if variants is None:
+        return empty
+
+    tags = [(lcid, hashlib.sha1(raw).hexdigest()[:16]) for lcid, raw in variants]
+    return perLanguage(tags, lambda tag: f"const char {name}[] PROGMEM = \"{tag}\";", empty)
+
+
+def assetFingerprint(path, keys):
+    # Short hash of the asset content in all languages, None when it can't be computed at build time.
+    # WM_RUNTIME_LANGUAGE serves one of these language variants, WM_LANGUAGE_TABLE the keyed variant if the route has one.
+    source = gKeyedFingerprintSources.get(path, gFingerprintSources[path]) if keys else gFingerprintSources[path]
+    if (path, keys) not in gFingerprints:
+        gFingerprints[(path, keys)] = None  # Guards against reference cycles
+        variants = languageVariants({ "name": path, "source": source }, False)
+        if variants is not None:
+            h = hashlib.sha1()
+            for _, raw in variants:
+                h.update(raw)
+            gFingerprints[(path, keys)] = h.hexdigest()[:8]
+    return gFingerprints[(path, keys)]
+
+
+def fingerprintedPath(path, keys = False):
+    # '/utils.js' -> '/utils.3fa2c1d0.js', keys selects the name the route has with WM_LANGUAGE_TABLE
+    if path not in gFingerprintSources:
+        return None
+    fingerprint = assetFingerprint(path, keys)
+    if fingerprint is None:
+        return None
+    base, ext = os.path.splitext(path)
+    return f"{base}.{fingerprint}{ext}"
+
+
+def replaceAssetReferences(line, keys):
+    # Quoted references to fingerprinted assets: 'style.css' -> 'style.3fa2c1d0.css', './utils.js' -> './utils.3fa2c1d0.js'
+    # Keyed templates are only served with WM_LANGUAGE_TABLE, they reference the keyed variants.
+    pattern = re.compile(r"(['\"])(\./)?([A-Za-z0-9_\-]+\.(?:js|css))\1")
+    def replace(m):
+        path = fingerprintedPath("/" + m.group(3), keys)
+        if path is None:
+            return m.group(0)
+        return f"{m.group(1)}{m.group(2) or ''}{path[1:]}{m.group(1)}"
+    return pattern.sub(replace, line)
+
+
+def hashPath(path, seed):
+    # 32-bit FNV-1a with the seed as offset basis, must match ESPAsync_WiFiManagerUtils::HashPath()
+    h = seed
+    for b in path.encode('utf-8'):
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def routeTable(data):
+    # Enum of the static files and their route table, one table per language mode when the fingerprinted
+    # names differ (keyed variants served with WM_LANGUAGE_TABLE hash to other names than the baked ones).
+    content = "enum " + data["enum"] + " : uint8_t\n{\n"
+    content += f"    {data['prefix']}NONE = 0,\n"
+    content += ''.join(f"    {data['prefix']}{r['file']},\n" for r in data["routes"])
+    content += "};\n\n"
+
+    baked = routeHashTable(data, False)
+    keyed = routeHashTable(data, True)
+    if keyed == baked:
+        return content + baked
+    return content + "#if WM_LANGUAGE_TABLE\n" + keyed + "\n#else\n" + baked + "\n#endif"
+
+
+def routeHashTable(data, keys):
+    # Perfect hash table of URL paths: search for a seed that puts every path into its own slot.
+    # The slot is taken from the top bits of the hash, the low bits only depend on the low bits of the seed.
+    # Routes with a fingerprint are also registered under the fingerprinted name, flagged immutable.
+    name = data["name"]
+    routes = []
+    for r in data["routes"]:
+        routes.append({ "path": r["path"], "file": r["file"], "const": r["file"], "immutable": False })
+        path = fingerprintedPath(r["path"], keys)
+        if path is not None:
+            routes.append({ "path": path, "file": r["file"], "const": r["file"] + "_FP", "immutable": True })
+
+    bits = 0
+    while (1 << bits) < len(routes):
+        bits += 1
+
+    seed = None
+    while seed is None:
+        for candidate in range(0x811c9dc5, 0x811c9dc5 + 100000):
+            slots = set(hashPath(r["path"], candidate) >> (32 - bits) for r in routes)
+            if len(slots) == len(routes):
+                seed = candidate
+                break
+        else:
+            bits += 1
+    size = 1 << bits
+    print(f"{name}{' (keys)' if keys else ''}: {len(routes)} routes in {size} slots, seed 0x{seed:08x}")
+
+    content = ''
+    for r in routes:
+        content += f"const char {name}_PATH_{r['const']}[] PROGMEM = \"{r['path']}\";\n"
+    content += f"\nconst uint32_t {name}_SEED = 0x{seed:08x};\n"
+    content += f"const uint8_t {name}_SHIFT = {32 - bits};\n"
+
+    table = [None] * size
+    for r in routes:
+        table[hashPath(r["path"], seed) >> (32 - bits)] = r
+    content += f"const HTTPStaticRoute {name}[] PROGMEM = {{\n"
+    content += ',\n'.join(
+        f"    {{ {name}_PATH_{r['const']}, {data['prefix']}{r['file']}, {'true' if r['immutable'] else 'false'} }}" if r
+        else f"    {{ nullptr, {data['prefix']}NONE, false }}" for r in table)
+    content += "\n};"
+    return content
+
+
+def slotTemplate(data, skipLangTranslation):
+    # Template split at its %{name}% placeholders: literal parts in program memory, each followed by
+    # the slot the renderer fills in. Slots are enum IDs, a misspelled placeholder fails to build.
+    name = data["name"]
+    source = sourceContent(data["source"], skipLangTranslation)
+    if source is None:
+        return ''
+    pieces = re.split(r'%\{([A-Za-z0-9_]+)\}%', source)
+    texts = pieces[0::2]
+    names = pieces[1::2]
+
+    def slotId(var):
+        # 'ideFlashSize' -> 'WM_CHIP_INFO_SLOT_IDE_FLASH_SIZE'
+        return data["prefix"] + re.sub(r'([a-z0-9])([A-Z])', r'\1_\2', var).upper()
+
+    slots = list(dict.fromkeys(names))
+    print(f"{name}: {len(texts)} parts, slots {', '.join(slots)}")
+
+    content = "enum " + data["enum"] + " : uint8_t\n{\n"
+    content += ''.join(f"    {slotId(v)},\n" for v in slots)
+    content += f"    {data['prefix']}COUNT\n}};\n\n"
+    return content + templateParts(name, texts, [slotId(v) for v in names])
+
+
+def templateParts(name, texts, slots):
+    # HTTPTemplate of literal parts in program memory, each followed by the slot in slots (one less than texts)
+    content = ''
+    for i, text in enumerate(texts):
+        content += f"const char {name}_{i}[] PROGMEM = \"{text}\";\n"
+    content += f"const HTTPTemplatePart {name}_PARTS[] PROGMEM = {{\n"
+    content += ',\n'.join(f"    {{ {name}_{i}, {slots[i] if i < len(slots) else 'HTTP_TEMPLATE_NO_SLOT'} }}"
+        for i in range(len(texts)))
+    content += "\n};\n"
+    content += f"const HTTPTemplate {name} = {{ {name}_PARTS, ARRAY_LENGTH({name}_PARTS) }};"
+    return content
+
+
+# Translated strings inside generated C literals: '"<p>" L_INFO "</p>"'
+LANGUAGE_STRING = re.compile(r'(?<!\\)" (L_[A-Za-z0-9_]+) "')
+
+
+def languageStringId(prefix, name):
+    # 'L_GENERAL_YES' -> 'WM_STR_GENERAL_YES'
+    return prefix + name[2:]
+
+
+def languageTemplate(data, skipLangTranslation):
+    # Language neutral copy of an asset for WM_RUNTIME_LANGUAGE: literal parts in program memory, split at
+    # the translated strings, which become slots filled from the string table of the language of the request.
+    # The entity tag covers all languages, the server adds the language code to it.
+    name = data["name"]
+    source = sourceContent(data["source"], skipLangTranslation)
+    if source is None:
+        return ''
+    pieces = LANGUAGE_STRING.split(source)
+    texts = pieces[0::2]
+    strings = [languageStringId(data["prefix"], s) for s in pieces[1::2]]
+    print(f"{name}: {len(texts)} parts, {len(set(strings))} strings")
+
+    content = templateParts(name, texts, strings) + "\n"
+    variants = languageVariants({ "name": name + "_ETAG", "source": data["source"] }, skipLangTranslation)
+    tag = hashlib.sha1(b''.join(raw for _, raw in variants)).hexdigest()[:16] if variants else ''
+    content += f"const char {name}_ETAG[] PROGMEM = \"{tag}\";"
+    return content
+
+
+def languageTables(data, skipLangTranslation):
+    # String table of every language for WM_RUNTIME_LANGUAGE: the strings the language templates use,
+    # '\0' separated, with the offset of each string. Strings missing in a language fall back to the first one.
+    name = data["name"]
+    used = []
+    for entry in gReplaceMap:
+        if entry["value"]["type"] == "language":
+            source = sourceContent(entry["value"]["source"], skipLangTranslation) or ''
+            used += LANGUAGE_STRING.findall(source)
+    used = list(dict.fromkeys(used))
+    if len(used) >= 0xFF:
+        print(f"'{name}' not generated: {len(used)} strings don't fit template slots.")
+        return ''
+
+    content = "enum " + data["enum"] + " : uint8_t\n{\n"
+    content += ''.join(f"    {languageStringId(data['prefix'], s)},\n" for s in used)
+    content += f"    {data['prefix']}COUNT\n}};\n\n"
+
+    rows = []
+    for lang in gLanguages:
+        lcid = lang["lcid"]
+        blob = b''
+        offsets = []
+        for s in used:
+            defines = lang["defines"] if s in lang["defines"] else gLanguages[0]["defines"]
+            if s not in lang["defines"]:
+                print(f"{name} ({lcid}): '{s}' is not translated, using LCID {gLanguages[0]['lcid']}.")
+            offsets.append(len(blob))
+            blob += evalCString(defines[s], defines) + b'\0'
+        code = evalCString(lang["defines"]["L_HTML_LANGUAGE"], lang["defines"]).decode('utf-8')
+        print(f"{name} ({lcid}): {len(used)} strings, {len(blob)} B")
+
+        ends = offsets[1:] + [len(blob)]
+        literal = ' "\\0" '.join(cLiteral(blob[o:e - 1].decode('utf-8')) for o, e in zip(offsets, ends))
+        content += f"const char {name}_CODE_{lcid}[] PROGMEM = \"{code}\";\n"
+        content += f"const char {name}_STRINGS_{lcid}[] PROGMEM = {literal};\n"
+        content += f"const uint16_t {name}_OFFSETS_{lcid}[] PROGMEM = {{ {', '.join(str(o) for o in offsets)} }};\n\n"
+        rows.append(f"    {{ {name}_CODE_{lcid}, {lcid}, {name}_STRINGS_{lcid}, {name}_OFFSETS_{lcid} }}")
+
+    content += f"const HTTPLanguage {name}[] PROGMEM = {{\n" + ',\n'.join(rows) + "\n};\n\n"
+    content += "// Index of the language the firmware is built with (LanguageSupport.h), used when the request asks for none\n"
+    defaults = ''.join(f"#{'if' if i == 1 else 'elif'} (LANGUAGE_LCID == {lang['lcid']})\nconst uint8_t {name}_DEFAULT = {i};\n"
+        for i, lang in enumerate(gLanguages[1:], 1))
+    content += defaults + ("#else\n" if defaults else '') + f"const uint8_t {name}_DEFAULT = 0;" + ("\n#endif" if defaults else '')
+    return content
+
+
+def cLiteral(text):
+    # Text as a C string literal
+    return '"' + text.replace('\\', '\\\\').replace('"', '\\"').replace('\n', '\\n') + '"'
+
+
+PROGMEM_STRING = re.compile(r'^(\s*)const char (\w+)\[\] PROGMEM = (.*);\s*$')
+PROGMEM_BYTES = re.compile(r'^\s*const uint8_t (\w+)\[\] PROGMEM = \{')
+PROGMEM_BYTES_LEN = re.compile(r'^\s*const size_t (\w+)_LEN = (\d+);\s*$')
+
+
+def conditionalLines(content):
+    # Lines of a C header with the preprocessor branches they are in, None for lines in block comments.
+    # A branch is (block id, branch index, condition).
+    stack = []
+    blocks = 0
+    inComment = False
+    for line in content.split('\n'):
+        text = line.strip()
+        if inComment or (text.startswith('/*') and '*/' not in text):
+            inComment = '*/' not in text
+            yield line, None
+            continue
+        m = re.match(r'#\s*(if|ifdef|ifndef|elif|else|endif)\b\s*(.*)', text)
+        if m:
+            directive, condition = m.groups()
+            if directive in ('if', 'ifdef', 'ifndef'):
+                blocks += 1
+                stack.append((blocks, 0, '!' + condition if directive == 'ifndef' else condition))
+            elif directive == 'endif':
+                stack.pop()
+            else:
+                block, index, previous = stack.pop()
+                stack.append((block, index + 1, condition if directive == 'elif' else '!' + previous))
+        yield line, tuple(stack)
+
+
+def stringPool(content):
+    # Identical PROGMEM strings share one flash copy: a later definition becomes a reference to the
+    # first one, provided the first is compiled in every branch the later one is.
+    pool = {}
+    out = []
+    for line, branches in conditionalLines(content):
+        m = PROGMEM_STRING.match(line) if branches is not None else None
+        if m:
+            indent, name, literal = m.groups()
+            first = next((n for n, b in pool.get(literal, []) if branches[:len(b)] == b), None)
+            if first is not None and first != name:
+                gPooled[name] = first
+                line = f"{indent}constexpr decltype({first})& {name} = {first};"
+            else:
+                pool.setdefault(literal, []).append((name, branches))
+        out.append(line)
+    return '\n'.join(out)
+
+
+def flashReport(content):
+    # Bytes of program memory taken by each array of the generated header, in the first language.
+    # Arrays compiled only with some defines are listed with their condition.
+    if len(gLanguages) == 0:
+        return
+    lcid = gLanguages[0]["lcid"]
+    defines = gLanguages[0]["defines"]
+    rows = []
+    pending = None
+    for line, branches in conditionalLines(content):
+        if branches is None:
+            continue
+        # The include guard and the selected language don't limit where an array is compiled
+        conditions = [c for _, _, c in branches if not re.match(r'!\w+_h$', c)]
+        if any('LANGUAGE_LCID' in c and c != f"(LANGUAGE_LCID == {lcid})" for c in conditions):
+            continue
+        where = ' && '.join(c for c in conditions if 'LANGUAGE_LCID' not in c)
+        m = PROGMEM_STRING.match(line)
+        alias = re.match(r'\s*constexpr decltype\((\w+)\)& (\w+) =', line)
+        if m:
+            try:
+                size = len(evalCString(m.group(3), defines)) + 1
+            except UnresolvedSymbol:
+                size = None
+            rows.append((m.group(2), size, where, ''))
+        elif alias:
+            rows.append((alias.group(2), 0, where, alias.group(1)))
+        elif PROGMEM_BYTES.match(line):
+            pending = PROGMEM_BYTES.match(line).group(1)
+        elif PROGMEM_BYTES_LEN.match(line) and pending == PROGMEM_BYTES_LEN.match(line).group(1):
+            rows.append((pending, int(PROGMEM_BYTES_LEN.match(line).group(2)), where, ''))
+            pending = None
+
+    print(f"Flash usage (LCID {lcid}):")
+    for name, size, where, shared in sorted(rows, key=lambda r: -(r[1] or 0)):
+        note = f" = {shared}" if shared else ''
+        note += f" [{where}]" if where else ''
+        print(f"{size if size is not None else '?':>8}  {name}{note}")
+    totals = {}
+    for _, size, where, _ in rows:
+        totals[where] = totals.get(where, 0) + (size or 0)
+    print('Total: ' + ', '.join(f"{where or 'always'} {total} B" for where, total in totals.items()))
+    print(f"String pool: {len(gPooled)} strings share an identical copy")
+
+
+# Minification of templates. Language tags (/*L_...*/, <!--L_...-->, <!--D_...-->) are kept,
+# they are replaced after minification.
+JS_IDENT = re.compile(r'[A-Za-z0-9_$\u0080-￿]')
+JS_LANGUAGE_TAG = re.compile(r'/\*L_[A-Za-z0-9_]+\*/')
+# Characters that can't end a statement, a newline after them is never significant
+JS_NO_END = set('{([,;:=&|?!~^<>*%')
+# Characters that can't start a statement, a newline before them is never significant
+JS_NO_START = set('})],;?:=&|*%^<>')
+# Tokens after which '/' starts a regular expression rather than a division
+JS_REGEX_PREFIX = set('(,=:[!&|?{};+-*%<>~^')
+JS_REGEX_KEYWORDS = ('return', 'typeof', 'case', 'do', 'else', 'in', 'of', 'new', 'delete', 'void', 'throw',
+    'instanceof', 'yield', 'await')
+
+
+def jsEndOfString(js, i):
+    # Index after the string or template literal starting at js[i]
+    quote = js[i]
+    i += 1
+    while i < len(js) and js[i] != quote:
+        i += 2 if js[i] == '\\' else 1
+    return i + 1
+
+
+def jsEndOfRegex(js, i):
+    # Index after the regular expression literal (including flags) starting at js[i]
+    i += 1
+    inClass = False
+    while i < len(js):
+        ch = js[i]
+        if ch == '\\':
+            i += 2
+            continue
+        if ch == '[':
+            inClass = True
+        elif ch == ']':
+            inClass = False
+        elif ch == '/' and not inClass:
+            break
+        i += 1
+    i += 1
+    while i < len(js) and JS_IDENT.match(js[i]):
+        i += 1
+    return i
+
+
+def minifyJS(js):
+    # Strip comments and whitespace. Newlines are kept where automatic semicolon insertion may depend on them.
+    out = []
+    last = ''          # Last emitted significant character
+    pendingSpace = False
+    pendingNewline = False
+
+    def emit(token):
+        nonlocal last, pendingSpace, pendingNewline
+        first = token[0]
+        if out and pendingNewline and last not in JS_NO_END and first not in JS_NO_START:
+            out.append('\n')
+        elif out and (pendingSpace or pendingNewline) and \
+            ((JS_IDENT.match(last) and JS_IDENT.match(first)) or (last == first and first in '+-/')):
+            out.append(' ')
+        out.append(token)
+        last = token[-1]
+        pendingSpace = pendingNewline = False
+
+    def lastWord():
+        m = re.search(r'[A-Za-z_$]+$', ''.join(out[-4:]))
+        return m.group(0) if m else ''
+
+    i = 0
+    while i < len(js):
+        ch = js[i]
+        if ch in ' \t\r\n':
+            pendingSpace = True
+            pendingNewline = pendingNewline or ch == '\n'
+            i += 1
+        elif ch in '\'"`':
+            end = jsEndOfString(js, i)
+            emit(js[i:end])
+            i = end
+        elif js.startswith('//', i):
+            end = js.find('\n', i)
+            i = len(js) if end < 0 else end
+        elif js.startswith('/*', i):
+            end = js.find('*/', i + 2) + 2
+            if JS_LANGUAGE_TAG.fullmatch(js, i, end):
+                emit(js[i:end])
+            else:
+                pendingSpace = True
+                pendingNewline = pendingNewline or '\n' in js[i:end]
+            i = end
+        elif ch == '/' and (last == '' or last in JS_REGEX_PREFIX or lastWord() in JS_REGEX_KEYWORDS):
+            end = jsEndOfRegex(js, i)
+            emit(js[i:end])
+            i = end
+        else:
+            emit(ch)
+            i += 1
+    return ''.join(out)
+
+
+def minifyCSS(css):
+    # Strip comments and whitespace around punctuation, drop the last ';' of a block
+    out = []
+    i = 0
+    while i < len(css):
+        if css.startswith('/*', i):
+            end = css.find('*/', i + 2)
+            i = len(css) if end < 0 else end + 2
+            out.append(' ')
+        elif css[i] in '\'"':
+            end = jsEndOfString(css, i)
+            out.append(css[i:end])
+            i = end
+        else:
+            out.append(css[i])
+            i += 1
+    css = ''.join(out)
+    # Whitespace and punctuation rules don't apply inside strings, protect them first
+    strings = []
+    def protect(m):
+        strings.append(m.group(0))
+        return f'\x00{len(strings) - 1}\x00'
+    css = re.sub(r"'(?:[^'\\]|\\.)*'|\"(?:[^\"\\]|\\.)*\"", protect, css)
+    css = re.sub(r'\s+', ' ', css)
+    css = re.sub(r' ?([{};,>]) ?', r'\1', css)
+    css = re.sub(r': ', ':', css)
+    css = css.replace(';}', '}')
+    css = re.sub('\x00(\\d+)\x00', lambda m: strings[int(m.group(1))], css)
+    return css.strip()
+
+
+def minifyHTML(html):
+    # Drop comments other than language tags, collapse whitespace, minify inline scripts and styles
+    out = []
+    pos = 0
+    block = re.compile(r'<!--(?![LD]_).*?-->|(<script\b[^>]*>)(.*?)(</script>)|(<style\b[^>]*>)(.*?)(</style>)|(<(pre|textarea)\b.*?</\8>)',
+        re.S | re.I)
+    for m in block.finditer(html):
+        out.append(collapseWhitespace(html[pos:m.start()]))
+        if m.group(1):
+            out.append(collapseWhitespace(m.group(1)) + minifyJS(m.group(2)).strip() + m.group(3))
+        elif m.group(4):
+            out.append(collapseWhitespace(m.group(4)) + minifyCSS(m.group(5)).strip() + m.group(6))
+        elif m.group(7):
+            out.append(m.group(7))
+        pos = m.end()
+    out.append(collapseWhitespace(html[pos:]))
+    return ''.join(out).strip()
+
+
+def collapseWhitespace(text):
+    # Runs of whitespace render as a single space; keep a newline so the output stays readable
+    return re.sub(r'\s+', lambda m: '\n' if '\n' in m.group(0) else ' ', text)
+
+
+def minify(fname, source, format):
+    if format == "js":
+        content = minifyJS(source)
+    elif format == "css":
+        content = minifyCSS(source)
+    else:
+        content = minifyHTML(source)
+
+    if fname not in gMinifyReported:
+        gMinifyReported.add(fname)
+        before = len(source.encode('utf-8'))
+        after = len(content.encode('utf-8'))
+        print(f"{os.path.basename(fname)}: {before} -> {after} B ({(after - before) * 100 // max(before, 1)}%)")
+    return content
+
+
+# Bundling of ES modules: an entry module and its relative imports are flattened into one script.
+# Each imported module runs in its own function scope and returns only the names other modules import,
+# top-level functions nobody reaches are dropped.
+JS_IMPORT = re.compile(r"import(?:\{([^}]*)\}from)?(['\"])\./([^'\"]+)\2;?")
+JS_EXPORT_LIST = re.compile(r"export\{([^}]*)\};?")
+JS_EXPORT_DECL = re.compile(r"export (?=(?:async |const |let |var |class |function))")
+JS_REMOVABLE = re.compile(r"(?:async )?function\*? ?([\w$]+)\(|(?:const|let|var) ([\w$]+)=(?:async)?(?:function\b|[\w$]+=>|\([^()]*\)=>)")
+
+
+def jsStatements(js):
+    # Top-level statements of minified code. A statement ends with ';', with a newline kept by the minifier
+    # or with the '}' closing a function or class declaration.
+    statements = []
+    start = 0
+    depth = 0
+    last = ''
+    i = 0
+    while i < len(js):
+        ch = js[i]
+        if ch in '\'"`':
+            i = jsEndOfString(js, i)
+            last = ch
+            continue
+        if ch == '/' and (last == '' or last in JS_REGEX_PREFIX):
+            i = jsEndOfRegex(js, i)
+            last = '/'
+            continue
+        i += 1
+        if ch in '([{':
+            depth += 1
+        elif ch in ')]}':
+            depth -= 1
+        if depth == 0 and (ch in ';\n' or
+            (ch == '}' and re.match(r'(?:async )?(?:function|class)\b', js[start:]) and js[i:i + 1] != '(')):
+            statement = js[start:i].strip()
+            if statement:
+                statements.append(statement)
+            start = i
+        if not ch.isspace():
+            last = ch
+    if js[start:].strip():
+        statements.append(js[start:].strip())
+    return statements
+
+
+def jsImportBindings(names):
+    # 'a,b as c' -> 'a,b:c'
+    return ','.join(n.strip().replace(' as ', ':') for n in names.split(',') if n.strip())
+
+
+def bundleModules(entry):
+    modules = {}    # path -> statements without import/export
+    imports = {}    # path -> [(module, names)]
+    exports = {}    # path -> exported names
+    order = []      # Dependencies first
+
+    def load(path):
+        if path in modules:
+            return
+        modules[path] = None    # Guards against import cycles
+        with open(makeFilePath(path), "r", encoding='utf-8') as file:
+            statements = jsStatements(minifyJS(file.read()))
+        imports[path] = []
+        exports[path] = []
+        body = []
+        for st in statements:
+            m = JS_IMPORT.fullmatch(st)
+            if m:
+                imports[path].append((m.group(3), jsImportBindings(m.group(1) or '')))
+                load(m.group(3))
+                continue
+            m = JS_EXPORT_LIST.fullmatch(st)
+            if m:
+                exports[path] += [n.strip() for n in m.group(1).split(',') if n.strip()]
+                continue
+            if JS_EXPORT_DECL.match(st):
+                st = JS_EXPORT_DECL.sub('', st, 1)
+                m = JS_REMOVABLE.match(st)
+                if m:
+                    exports[path].append(m.group(1) or m.group(2))
+            body.append(st)
+        modules[path] = body
+        order.append(path)
+
+    load(entry)
+
+    # Names each module has to hand out
+    needed = { path: set() for path in order }
+    for path in order:
+        for module, bindings in imports[path]:
+            for b in bindings.split(','):
+                if b:
+                    name = b.split(':')[0]
+                    if name not in exports[module]:
+                        raise Exception(f"'{path}' imports '{name}' which '{module}' doesn't export.")
+                    needed[module].add(name)
+
+    ids = { path: f"$m{i}" for i, path in enumerate(order) }
+    content = ''
+    for path in order:
+        body = modules[path]
+        if path != entry:
+            body = dropUnusedDeclarations(body, needed[path])
+        head = ''.join(f"const{{{b}}}={ids[m]};" for m, b in imports[path] if b)
+        code = head + '\n'.join(body)
+        if path == entry:
+            content += f"(()=>{{{code}\n}})();\n"
+        else:
+            returned = ','.join(sorted(needed[path]))
+            content += f"const {ids[path]}=(()=>{{{code}\nreturn{{{returned}}};}})();\n"
+    if "bundle:" + entry not in gMinifyReported:
+        gMinifyReported.add("bundle:" + entry)
+        print(f"{entry}: bundled {', '.join(order)}")
+    return content
+
+
+def dropUnusedDeclarations(statements, live):
+    # Keep statements with side effects and the function declarations reachable from them or from the exports
+    live = set(live)
+    declared = [JS_REMOVABLE.match(st) for st in statements]
+    names = [(m.group(1) or m.group(2)) if m else None for m in declared]
+    kept = [name is None for name in names]
+    for st, keep in zip(statements, kept):
+        if keep:
+            live.update(re.findall(r'[\w$]+', st))
+    changed = True
+    while changed:
+        changed = False
+        for i, name in enumerate(names):
+            if not kept[i] and name in live:
+                kept[i] = changed = True
+                live.update(re.findall(r'[\w$]+', statements[i]))
+    return [st for st, keep in zip(statements, kept) if keep]
+
+
 def replaceHTMLLanguageTags(html):
     # Case 3: '<!--L_ID-->' -> '" L_ID "' (token as sole attribute value, no default text)
     case3 = re.compile(r"'<!--(L_[A-Za-z0-9_]+)-->'")
@@ -116,6 +965,71 @@ def replaceHTMLTokens(html):
     return html
 
 
+# Language table mode: translated strings are looked up by key ('L_GENERAL_YES' -> 'GENERAL_YES') in the
+# table of the client language, loaded by lang.js from /lang/<code>.json, instead of being inlined.
+LANGUAGE_LOADER = 'lang.js'
+JS_LANGUAGE_KEY = re.compile(r"/\*L_([A-Za-z0-9_]+)\*/'(?:[^'\\]|\\.)*'")
+HTML_LANGUAGE_KEY = re.compile(r"<([a-zA-Z0-9]+)([^<>]*)><!--L_([A-Za-z0-9_]+)-->[^<]*</")
+JS_IMPORT_PATH = re.compile(r"(?:from|import)\s*['\"]\./([^'\"]+)['\"]")
+
+
+def replaceJavascriptLanguageKeys(js_code):
+    # /*L_GENERAL_YES*/'Yes' -> $L.GENERAL_YES
+    return JS_LANGUAGE_KEY.sub(lambda m: f"$L.{m.group(1)}", js_code)
+
+
+def replaceHTMLLanguageKeys(html):
+    # <h1><!--L_DEVICE_INFO-->Device Info</h1> -> <h1 data-l='DEVICE_INFO'></h1>, filled by lang.js
+    return HTML_LANGUAGE_KEY.sub(lambda m: f"<{m.group(1)}{m.group(2)} data-l='{m.group(3)}'></", html)
+
+
+def keyedStrings():
+    # L_* names used by the templates with "keys", including the modules they import
+    files = []
+    def add(fname):
+        if fname not in files:
+            files.append(fname)
+            with open(makeFilePath(fname), "r", encoding='utf-8') as file:
+                for module in JS_IMPORT_PATH.findall(file.read()):
+                    add(module)
+    for entry in gReplaceMap:
+        if entry["value"].get("keys", False):
+            add(entry["value"]["template"])
+
+    names = []
+    for fname in files:
+        with open(makeFilePath(fname), "r", encoding='utf-8') as file:
+            names += re.findall(r"/\*(L_[A-Za-z0-9_]+)\*/'|<!--(L_[A-Za-z0-9_]+)-->", file.read())
+    return list(dict.fromkeys(a or b for a, b in names if (a or b) != "L_HTML_LANGUAGE"))
+
+
+def javascriptUnescape(text):
+    # Language strings are written for JS literals ("...\\n..."), the table holds the text itself
+    return re.sub(r"\\(.)", lambda m: '\n' if m.group(1) == 'n' else m.group(1), text)
+
+
+def languageTable(data):
+    # JSON object with the keyed strings of one language, as the body of a C literal
+    lang = next((l for l in gLanguages if l["lcid"] == data["lcid"]), None)
+    if lang is None:
+        print(f"Language table: LCID {data['lcid']} is not loaded.")
+        return ''
+    table = {}
+    for name in keyedStrings():
+        defines = lang["defines"] if name in lang["defines"] else gLanguages[0]["defines"]
+        if name not in lang["defines"]:
+            print(f"Language table ({data['lcid']}): '{name}' is not translated, using LCID {gLanguages[0]['lcid']}.")
+        table[name[2:]] = javascriptUnescape(evalCString(defines[name], defines).decode('utf-8'))
+    content = json.dumps(table, ensure_ascii=False, separators=(',', ':'))
+    print(f"Language table ({data['lcid']}): {len(table)} strings, {len(content.encode('utf-8'))} B")
+    return cLiteral(content)[1:-1]
+
+
+def languagePaths(data):
+    # JS object literal mapping the language codes to the fingerprinted table paths, for lang.js
+    return '{' + ','.join(f"{code}:'{fingerprintedPath(path) or path}'" for code, path in data["paths"].items()) + '}'
+
+
 def replaceJavascriptLanguageTags2(js_code):
     # Pattern: /*L_ABC123*/'String to be replaced'
     pattern = r"/\*(L_[A-Za-z0-9_]+)\*/'[^']*'"
@@ -138,6 +1052,8 @@ if __name__ == '__main__':
     parser.add_argument("output", help="Output filename", type=str)
     # Optional argument to skip translation of language tags
     parser.add_argument('-s', '--skipLangTranslation', action='store_true', help='Skip translation of language tags.')
+    # Optional argument to keep html, css and js templates as they are
+    parser.add_argument('-n', '--noMinify', action='store_true', help='Do not minify html, css and js templates.')
 
     args = parser.parse_args()
 
@@ -146,4 +1062,5 @@ if __name__ == '__main__':
         sys.exit()
 
     gInputDir = os.path.dirname(args.json)
+    gMinify = not args.noMinify
     translateFile(args.json, args.output, args.skipLangTranslation)
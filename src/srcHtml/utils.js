@@ -168,20 +168,7 @@ async function u2t(url, id, opt = {}) {
 
         // 2. Parse JSON
         // The data is expected to be an array of objects, e.g., [{'ID': 101, 'Name': 'Alpha'}, ...]
-        const data = await response.json(); 
-
-        if (data.length === 0) {
-            el.innerHTML = 'No data available.';
-            return;
-        }
-
-        // Convert JSON to table
-        const table = j2t(data, opt);
-
-        // 5. Insert Table into DOM
-        // Instead of setting innerHTML, we replace the content with the new DOM node.
-        el.innerHTML = ''; // Clear loading message
-        el.appendChild(table);
+        d2t(await response.json(), id, opt);
 
     } catch (error) {
         console.error('Failed to load or convert data:', error);
@@ -189,6 +176,43 @@ async function u2t(url, id, opt = {}) {
     }
 }
 
+/**
+ * Converts JSON data already fetched to an HTML table and inserts it into a target element.
+ * @param {Array<Object>} data The rows of the table.
+ * @param {string} id The ID of the HTML element where the table will be inserted.
+ */
+function d2t(data, id, opt = {}) {
+    const el = gebi(id);
+
+    if (!data || data.length === 0) {
+        el.innerHTML = 'No data available.';
+        return;
+    }
+
+    // Convert JSON to table
+    const table = j2t(data, opt);
+
+    // Instead of setting innerHTML, we replace the content with the new DOM node.
+    el.innerHTML = ''; // Clear loading message
+    el.appendChild(table);
+}
+
+/**
+ * Fetches several /sq queries in one request (/sq?dx=a,b,c).
+ * @param {...string} dx Names of the queries.
+ * @returns {Promise<Object>} The answers keyed by name. An unknown one is null in a list, {} when asked alone.
+ */
+async function sq(...dx) {
+    const response = await mfetch('./sq?dx=' + dx.join(','));
+
+    if (!response.ok) {
+        throw new Error(`HTTP error! status: ${response.status}`);
+    }
+    // A single name is answered with the query result itself, key it like a list
+    const data = await response.json();
+    return dx.length === 1 ? { [dx[0]]: data } : data;
+}
+
 /**
  * Fetches JSON data from a server, converts it to an HTML table,
  * and inserts the table into a target element.
@@ -219,4 +243,4 @@ async function mfetch(url) {
 }
 
 // Export all utility functions for use in main.js
-export { gebi, qs, qsa, wl, IH, j2t, u2t, j2f, u2f };
\ No newline at end of file
+export { gebi, qs, qsa, wl, IH, j2t, u2t, d2t, j2f, u2f, sq };
\ No newline at end of file